@@ -30,6 +30,7 @@
 #include "src/carnot/plan/plan.h"
 #include "src/carnot/planner/compiler/compiler.h"
 #include "src/carnot/planner/distributed/annotate_abortable_sources_for_limits_rule.h"
+#include "src/carnot/query_scheduler.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/perf/perf.h"
 #include "src/shared/types/type_utils.h"
@@ -67,8 +68,6 @@ class CarnotImpl final : public Carnot {
   const udf::Registry* FuncRegistry() const override { return engine_state_->func_registry(); }
 
  private:
-  Status RegisterUDFs(exec::ExecState* exec_state, plan::Plan* plan);
-
   Status RegisterUDFsInPlanFragment(exec::ExecState* exec_state, plan::PlanFragment* pf);
   Status WalkExpression(exec::ExecState* exec_state, const plan::ScalarExpression& expr);
   /**
@@ -91,6 +90,9 @@ class CarnotImpl final : public Carnot {
   planner::compiler::Compiler compiler_;
   std::unique_ptr<EngineState> engine_state_;
 
+  // Admits queries into execution by priority class. See QueryScheduler.
+  QueryScheduler query_scheduler_;
+
   std::unique_ptr<std::thread> grpc_server_thread_;
   std::unique_ptr<grpc::Server> grpc_server_;
   std::unique_ptr<ClientsConfig> clients_config_;
@@ -111,6 +113,9 @@ Status CarnotImpl::Init(const sole::uuid& agent_id, std::unique_ptr<udf::Registr
     grpc_server_thread_ = std::make_unique<std::thread>(&CarnotImpl::GRPCServerFunc, this);
   }
 
+  // All funcs are registered before Carnot is created, so freeze the registry here to get the
+  // flat per-query lookup path.
+  func_registry->Freeze();
   PL_ASSIGN_OR_RETURN(engine_state_,
                       EngineState::CreateDefault(std::move(func_registry), table_store,
                                                  clients_config_->stub_generator,
@@ -144,13 +149,6 @@ Status CarnotImpl::ExecuteQuery(const std::string& query, const sole::uuid& quer
  * aren't shared by non-matching RegistryKeys.
  */
 
-Status CarnotImpl::RegisterUDFs(exec::ExecState* exec_state, plan::Plan* plan) {
-  return plan::PlanWalker()
-      .OnPlanFragment(std::bind(&CarnotImpl::RegisterUDFsInPlanFragment, this, exec_state,
-                                std::placeholders::_1))
-      .Walk(plan);
-}
-
 Status CarnotImpl::RegisterUDFsInPlanFragment(exec::ExecState* exec_state, plan::PlanFragment* pf) {
   auto no_op = [&](const auto&) { return Status::OK(); };
   return plan::PlanFragmentWalker()
@@ -319,13 +317,19 @@ Status InitiateOutgoingConns(
 Status CarnotImpl::ExecutePlan(const planpb::Plan& logical_plan, const sole::uuid& query_id,
                                bool analyze) {
   auto timer = ElapsedTimer();
+
+  // Wait for admission under the query's priority class, and hold the slot for the duration of
+  // the execution. Isolates latency-sensitive scripted queries from bursts of ad-hoc ones.
+  PL_ASSIGN_OR_RETURN(QueryScheduler::QuerySlot query_slot,
+                      query_scheduler_.Admit(logical_plan.plan_options().priority()));
+
   plan::Plan plan;
 
   PL_RETURN_IF_ERROR(plan.Init(logical_plan));
 
   // For each of the plan fragments in the plan, execute the query.
   std::vector<std::string> output_table_strs;
-  auto exec_state = engine_state_->CreateExecState(query_id);
+  auto exec_state = engine_state_->CreateExecState(query_id, query_slot.query_memory_limit_bytes());
   auto outgoing_conns = GetOutgoingConns(exec_state.get(), logical_plan);
   PL_RETURN_IF_ERROR(InitiateOutgoingConns(query_id, outgoing_conns,
                                            engine_state_->add_auth_to_grpc_context_func()));
@@ -338,8 +342,6 @@ Status CarnotImpl::ExecutePlan(const planpb::Plan& logical_plan, const sole::uui
     exec_state->set_metadata_state(metadata_state);
   }
 
-  PL_RETURN_IF_ERROR(RegisterUDFs(exec_state.get(), &plan));
-
   auto plan_state = engine_state_->CreatePlanState();
   int64_t bytes_processed = 0;
   int64_t rows_processed = 0;
@@ -353,6 +355,9 @@ Status CarnotImpl::ExecutePlan(const planpb::Plan& logical_plan, const sole::uui
   auto s =
       plan::PlanWalker()
           .OnPlanFragment([&](auto* pf) {
+            // UDFs are registered per fragment at schedule time, so fragments that never run
+            // are never deserialized.
+            PL_RETURN_IF_ERROR(RegisterUDFsInPlanFragment(exec_state.get(), pf));
             auto exec_graph = exec::ExecutionGraph();
             PL_RETURN_IF_ERROR(exec_graph.Init(schema.get(), plan_state.get(), exec_state.get(), pf,
                                                /* collect_exec_node_stats */ analyze));
@@ -373,12 +378,17 @@ Status CarnotImpl::ExecutePlan(const planpb::Plan& logical_plan, const sole::uui
                     absl::Substitute("$0 (id=$1)", pf->nodes()[node_id]->DebugString(), node_id);
                 exec::ExecNodeStats* stats = exec_node->stats();
                 stats->AddExtraMetric("batches_output", stats->batches_output);
+                stats->AddExtraMetric("self_cpu_time_ns", stats->SelfCpuTime());
+                stats->AddExtraMetric("total_cpu_time_ns", stats->TotalCpuTime());
+                stats->AddExtraMetric("peak_pool_bytes", stats->peak_pool_bytes);
                 int64_t total_time_ns = stats->TotalExecTime();
                 int64_t self_time_ns = stats->SelfExecTime();
                 LOG(INFO) << absl::Substitute(
-                    "self_time:$1\ttotal_time: $2\tbytes_output: $3\trows_output: $4\tnode_id:$0",
+                    "self_time:$1\ttotal_time: $2\tself_cpu_time: $3\tbytes_output: "
+                    "$4\trows_output: $5\tpeak_pool_bytes: $6\tnode_id:$0",
                     node_name, PrettyDuration(self_time_ns), PrettyDuration(total_time_ns),
-                    stats->bytes_output, stats->rows_output);
+                    PrettyDuration(stats->SelfCpuTime()), stats->bytes_output, stats->rows_output,
+                    stats->peak_pool_bytes);
 
                 queryresultspb::OperatorExecutionStats* stats_pb =
                     agent_operator_exec_stats.add_operator_execution_stats();
@@ -31,6 +31,7 @@
 #include "src/carnot/planner/compiler_state/compiler_state.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/base.h"
+#include "src/common/grpcutils/channel_pool.h"
 #include "src/table_store/table_store.h"
 
 namespace px {
@@ -76,7 +77,8 @@ class EngineState : public NotCopyable {
   }
 
   table_store::TableStore* table_store() { return table_store_.get(); }
-  std::unique_ptr<exec::ExecState> CreateExecState(const sole::uuid& query_id) {
+  std::unique_ptr<exec::ExecState> CreateExecState(const sole::uuid& query_id,
+                                                   int64_t query_mem_limit_bytes = 0) {
     return std::make_unique<exec::ExecState>(
         func_registry_.get(), table_store_, stub_generator_,
         [this](const std::string& remote_addr, bool insecure) {
@@ -85,7 +87,8 @@ class EngineState : public NotCopyable {
         [this](const std::string& remote_addr, bool insecure) {
           return TraceStubGenerator(remote_addr, insecure);
         },
-        query_id, model_pool_.get(), grpc_router_, add_auth_to_grpc_context_func_);
+        query_id, model_pool_.get(), grpc_router_, add_auth_to_grpc_context_func_,
+        query_mem_limit_bytes);
   }
   std::shared_ptr<grpc::Channel> CreateChannel(const std::string& remote_addr, bool insecure) {
     grpc::ChannelArguments args;
@@ -98,7 +101,9 @@ class EngineState : public NotCopyable {
 
     auto channel_creds = insecure ? grpc::InsecureChannelCredentials()
                                   : grpc::SslCredentials(grpc::SslCredentialsOptions());
-    return grpc::CreateCustomChannel(remote_addr, channel_creds, args);
+    // Exporters in concurrently executing queries share one connection per endpoint.
+    return grpcutils::ChannelPool::GetInstance().GetOrCreateChannel(
+        remote_addr, channel_creds, args, insecure ? "carnot-insecure" : "carnot-ssl");
   }
 
   std::unique_ptr<opentelemetry::proto::collector::metrics::v1::MetricsService::StubInterface>
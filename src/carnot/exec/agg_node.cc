@@ -21,8 +21,11 @@
 #include <arrow/array.h>
 #include <arrow/array/builder_base.h>
 #include <arrow/status.h>
+#include <unistd.h>
 #include <algorithm>
 #include <cstdint>
+#include <string>
+#include <utility>
 
 #include <magic_enum.hpp>
 
@@ -31,10 +34,21 @@
 #include "src/carnot/planpb/plan.pb.h"
 #include "src/carnot/udf/udf_wrapper.h"
 #include "src/common/base/base.h"
+#include "src/common/fs/fs_wrapper.h"
 #include "src/shared/types/arrow_adapter.h"
 #include "src/shared/types/type_utils.h"
 #include "src/shared/types/types.h"
 
+DEFINE_int64(carnot_agg_spill_threshold_bytes,
+             gflags::Int64FromEnv("PL_CARNOT_AGG_SPILL_THRESHOLD_BYTES", 1024LL * 1024 * 1024),
+             "Approximate budget for in-memory blocking aggregate state. Once the resident "
+             "group-by state of an aggregate node exceeds this many bytes, rows for new groups "
+             "are spilled to temp files and re-aggregated at emission. 0 disables spilling.");
+
+DEFINE_string(carnot_agg_spill_dir, gflags::StringFromEnv("PL_CARNOT_AGG_SPILL_DIR", ""),
+              "Directory used for blocking aggregate spill files. An empty value uses the "
+              "system temp directory.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -57,13 +71,119 @@ void ExtractIntoGroupArgs(std::vector<GroupArgs>* group_args, arrow::Array* col,
 template <types::DataType DT>
 void AppendToBuilder(arrow::ArrayBuilder* builder, RowTuple* rt, size_t rt_idx) {
   using ArrowBuilder = typename types::DataTypeTraits<DT>::arrow_builder_type;
-  using ValueType = typename types::DataTypeTraits<DT>::value_type;
-  auto status =
-      static_cast<ArrowBuilder*>(builder)->Append(udf::UnWrap(rt->GetValue<ValueType>(rt_idx)));
+  arrow::Status status;
+  if constexpr (DT == types::DataType::STRING) {
+    const auto view = rt->GetStringValue(rt_idx);
+    status = static_cast<ArrowBuilder*>(builder)->Append(view.data(), view.size());
+  } else {
+    using ValueType = typename types::DataTypeTraits<DT>::value_type;
+    status =
+        static_cast<ArrowBuilder*>(builder)->Append(udf::UnWrap(rt->GetValue<ValueType>(rt_idx)));
+  }
   PL_DCHECK_OK(status);
   PL_UNUSED(status);
 }
 
+// The hash-map state (row tuples, UDA instances, pending column wrappers) is heap-allocated
+// rather than drawn from the arrow memory pool, so the spill budget is tracked with an explicit
+// per-group estimate. String group keys add their length on top of this.
+constexpr size_t kApproxBytesPerGroup = 512;
+
+size_t ApproxGroupBytes(const RowTuple* rt, const std::vector<types::DataType>& group_types) {
+  size_t bytes = kApproxBytesPerGroup;
+  for (size_t idx = 0; idx < group_types.size(); ++idx) {
+    if (group_types[idx] == types::DataType::STRING) {
+      bytes += rt->GetStringValue(idx).size();
+    }
+  }
+  return bytes;
+}
+
+// Spill files hold raw rows: group key values followed by the stored agg input values, in
+// column-mapping order. Fixed-size values are written as their in-memory representation;
+// strings are length-prefixed.
+void SerializeString(std::string_view val, std::string* out) {
+  uint64_t size = val.size();
+  out->append(reinterpret_cast<const char*>(&size), sizeof(size));
+  out->append(val.data(), val.size());
+}
+
+template <types::DataType DT>
+void SerializeRowTupleValue(const RowTuple& rt, size_t rt_idx, std::string* out) {
+  using ValueType = typename types::DataTypeTraits<DT>::value_type;
+  if constexpr (DT == types::DataType::STRING) {
+    SerializeString(rt.GetStringValue(rt_idx), out);
+  } else {
+    const ValueType& val = rt.GetValue<ValueType>(rt_idx);
+    out->append(reinterpret_cast<const char*>(&val), sizeof(ValueType));
+  }
+}
+
+template <types::DataType DT>
+void SerializeArrowValue(const arrow::Array* arr, int64_t row_idx, std::string* out) {
+  using ValueType = typename types::DataTypeTraits<DT>::value_type;
+  if constexpr (DT == types::DataType::STRING) {
+    SerializeString(types::GetStringViewFromArrowArray(arr, row_idx), out);
+  } else {
+    const ValueType val(types::GetValueFromArrowArray<DT>(arr, row_idx));
+    out->append(reinterpret_cast<const char*>(&val), sizeof(ValueType));
+  }
+}
+
+bool ReadExact(std::ifstream* in, char* buf, size_t size) {
+  in->read(buf, size);
+  return static_cast<size_t>(in->gcount()) == size;
+}
+
+bool DeserializeString(std::ifstream* in, std::string* out) {
+  uint64_t size = 0;
+  if (!ReadExact(in, reinterpret_cast<char*>(&size), sizeof(size))) {
+    return false;
+  }
+  out->resize(size);
+  return ReadExact(in, out->data(), size);
+}
+
+template <types::DataType DT>
+bool DeserializeIntoRowTuple(std::ifstream* in, RowTuple* rt, size_t rt_idx) {
+  using ValueType = typename types::DataTypeTraits<DT>::value_type;
+  if constexpr (DT == types::DataType::STRING) {
+    std::string val;
+    if (!DeserializeString(in, &val)) {
+      return false;
+    }
+    rt->SetStringValue(rt_idx, val);
+    return true;
+  } else {
+    ValueType val;
+    if (!ReadExact(in, reinterpret_cast<char*>(&val), sizeof(ValueType))) {
+      return false;
+    }
+    rt->SetValue(rt_idx, val);
+    return true;
+  }
+}
+
+template <types::DataType DT>
+bool DeserializeIntoColumnWrapper(std::ifstream* in, types::ColumnWrapper* col) {
+  using ValueType = typename types::DataTypeTraits<DT>::value_type;
+  if constexpr (DT == types::DataType::STRING) {
+    std::string val;
+    if (!DeserializeString(in, &val)) {
+      return false;
+    }
+    col->Append<types::StringValue>(types::StringValue(std::move(val)));
+    return true;
+  } else {
+    ValueType val;
+    if (!ReadExact(in, reinterpret_cast<char*>(&val), sizeof(ValueType))) {
+      return false;
+    }
+    col->Append<ValueType>(val);
+    return true;
+  }
+}
+
 template <types::DataType DT>
 void ExtractToColumnWrapper(const std::vector<GroupArgs>& group_args,
                             const table_store::schema::RowBatch& rb, size_t col_idx,
@@ -71,7 +191,10 @@ void ExtractToColumnWrapper(const std::vector<GroupArgs>& group_args,
   size_t num_rows = rb.num_rows();
   DCHECK(num_rows <= group_args.size());
   for (size_t row_idx = 0; row_idx < num_rows; ++row_idx) {
-    DCHECK(group_args[row_idx].av != nullptr);
+    if (group_args[row_idx].av == nullptr) {
+      // The row was routed to a spill file and has no resident group.
+      continue;
+    }
     auto col_wrapper = group_args[row_idx].av->agg_cols[col_idx].get();
     auto arr = rb.ColumnAt(rb_col_idx).get();
     types::ExtractValueToColumnWrapper<DT>(col_wrapper, arr, row_idx);
@@ -162,6 +285,7 @@ Status AggNode::CloseImpl(ExecState*) {
   group_args_chunk_.clear();
   group_args_pool_.Clear();
   udas_pool_.Clear();
+  DropSpillFiles();
 
   return Status::OK();
 }
@@ -175,7 +299,10 @@ Status AggNode::ClearAggState(ExecState* exec_state) {
     udas_no_groups_.clear();
     PL_RETURN_IF_ERROR(CreateUDAInfoValues(&udas_no_groups_, exec_state));
   }
-  agg_hash_map_.clear();
+  for (auto& partition : agg_hash_map_partitions_) {
+    partition.clear();
+  }
+  DropSpillFiles();
   return Status::OK();
 }
 
@@ -233,26 +360,65 @@ Status AggNode::ExtractRowTupleForBatch(const RowBatch& rb) {
 }
 
 Status AggNode::HashRowBatch(ExecState* exec_state, const RowBatch& rb) {
-  PL_UNUSED(exec_state);
   // Loop through all the row and basically store the values into column chunk based on which
   // group they belong to.
+  // Time-ordered input tends to arrive in runs of identical group keys, so the previous row's
+  // group is checked first to skip the hash probe entirely for contiguous runs.
+  const RowTuple* prev_rt = nullptr;
+  AggHashValue* prev_val = nullptr;
+  size_t prev_partition = 0;
   for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
     auto& ga = group_args_chunk_[row_idx];
-    AggHashValue* val = nullptr;
-    // Check to see if in hash
-    // TODO(zasgar): Change this to upsert.
-    auto it = agg_hash_map_.find(ga.rt);
-    // If not in hash then insert
-    if (it == agg_hash_map_.end()) {
-      // Create a val array.
-      val = CreateAggHashValue(exec_state);
-      agg_hash_map_[ga.rt] = val;
+    if (prev_rt != nullptr && *ga.rt == *prev_rt) {
+      if (prev_val == nullptr) {
+        // The previous identical row overflowed to disk, so this one goes to the same file.
+        PL_RETURN_IF_ERROR(SpillRow(prev_partition, *ga.rt, rb, row_idx));
+        ga.av = nullptr;
+        continue;
+      }
+      ga.av = prev_val;
+      continue;
+    }
+    const size_t hash = RowTuplePtrHasher()(ga.rt);
+    AggHashMap& partition = AggHashMapPartition(hash);
+    if (spilling_) {
+      // Over budget: resident groups keep aggregating in memory, but rows whose group is not
+      // already resident overflow to the partition's spill file.
+      auto it = partition.find(ga.rt);
+      if (it == partition.end()) {
+        prev_partition = PartitionIdx(hash);
+        PL_RETURN_IF_ERROR(SpillRow(prev_partition, *ga.rt, rb, row_idx));
+        ga.av = nullptr;
+        prev_rt = ga.rt;
+        prev_val = nullptr;
+        continue;
+      }
+      ga.av = it->second;
+      prev_rt = it->first;
+      prev_val = it->second;
+      continue;
+    }
+    // Upsert: try_emplace hashes the key once, and only creates the agg value the first time
+    // the group is seen (find + insert would hash the tuple twice for every new group).
+    auto [it, inserted] = partition.try_emplace(ga.rt, nullptr);
+    if (inserted) {
+      it->second = CreateAggHashValue(exec_state);
+      resident_bytes_estimate_ += ApproxGroupBytes(it->first, group_data_types_);
       // We have inserted this, so the stored RowTuple is now in the table.
       ga.rt = nullptr;
-    } else {
-      val = it->second;
     }
-    ga.av = val;
+    ga.av = it->second;
+    prev_rt = it->first;
+    prev_val = it->second;
+  }
+
+  if (!spilling_ && FLAGS_carnot_agg_spill_threshold_bytes > 0 &&
+      resident_bytes_estimate_ > static_cast<size_t>(FLAGS_carnot_agg_spill_threshold_bytes)) {
+    spilling_ = true;
+    LOG(INFO) << absl::Substitute(
+        "AggNode: resident group state (~$0 bytes) exceeded the spill threshold ($1 bytes); "
+        "overflowing new groups to disk.",
+        resident_bytes_estimate_, FLAGS_carnot_agg_spill_threshold_bytes);
   }
 
   auto values = plan_node_->values();
@@ -277,7 +443,10 @@ Status AggNode::EvaluatePartialAggregates(ExecState* exec_state, size_t num_reco
   for (size_t i = 0; i < num_records; ++i) {
     DCHECK(i < group_args_chunk_.size());
     auto& ga = group_args_chunk_[i];
-    DCHECK(ga.av != nullptr);
+    if (ga.av == nullptr) {
+      // The row was routed to a spill file and has no resident group.
+      continue;
+    }
     if (ga.av->agg_cols[0]->Size() > kAggCompactionThreshold) {
       PL_RETURN_IF_ERROR(EvaluateAggHashValue(exec_state, ga.av));
     }
@@ -300,27 +469,30 @@ Status AggNode::ResetGroupArgs() {
   return Status::OK();
 }
 
-Status AggNode::ConvertAggHashMapToRowBatch(ExecState* exec_state, RowBatch* output_rb) {
-  PL_UNUSED(exec_state);
-  DCHECK(output_rb != nullptr);
-  std::vector<std::unique_ptr<arrow::ArrayBuilder>> group_builders;
+void AggNode::MakeOutputBuilders(ExecState* exec_state,
+                                 std::vector<std::unique_ptr<arrow::ArrayBuilder>>* group_builders,
+                                 std::vector<std::unique_ptr<arrow::ArrayBuilder>>* value_builders) {
   for (const auto& group_dt : group_data_types_) {
-    group_builders.push_back(types::MakeArrowBuilder(group_dt, exec_state->exec_mem_pool()));
+    group_builders->push_back(types::MakeArrowBuilder(group_dt, exec_state->exec_mem_pool()));
   }
-  std::vector<std::unique_ptr<arrow::ArrayBuilder>> value_builders;
   for (const auto& value_data_type : value_data_types_) {
-    value_builders.push_back(types::MakeArrowBuilder(value_data_type, exec_state->exec_mem_pool()));
+    value_builders->push_back(
+        types::MakeArrowBuilder(value_data_type, exec_state->exec_mem_pool()));
   }
+}
 
-  // Agg into agg values and emit!
-  for (const auto& kv : agg_hash_map_) {
+Status AggNode::AppendGroupsToBuilders(
+    ExecState* exec_state, const AggHashMap& map,
+    std::vector<std::unique_ptr<arrow::ArrayBuilder>>* group_builders,
+    std::vector<std::unique_ptr<arrow::ArrayBuilder>>* value_builders) {
+  for (const auto& kv : map) {
     auto* groups_rt = kv.first;
     auto* val = kv.second;
 
     for (size_t i = 0; i < group_data_types_.size(); ++i) {
-      DCHECK(i < group_builders.size());
+      DCHECK(i < group_builders->size());
 
-#define TYPE_CASE(_dt_) AppendToBuilder<_dt_>(group_builders[i].get(), groups_rt, i);
+#define TYPE_CASE(_dt_) AppendToBuilder<_dt_>((*group_builders)[i].get(), groups_rt, i);
       PL_SWITCH_FOREACH_DATATYPE(group_data_types_[i], TYPE_CASE);
 #undef TYPE_CASE
     }
@@ -329,17 +501,22 @@ Status AggNode::ConvertAggHashMapToRowBatch(ExecState* exec_state, RowBatch* out
     for (size_t i = 0; i < val->udas.size(); ++i) {
       const auto& uda_info = val->udas[i];
       PL_RETURN_IF_ERROR(uda_info.def->FinalizeArrow(uda_info.uda.get(), function_ctx_.get(),
-                                                     value_builders[i].get()));
+                                                     (*value_builders)[i].get()));
     }
   }
+  return Status::OK();
+}
 
-  for (const auto& group_builder : group_builders) {
+Status AggNode::FinishBuilders(std::vector<std::unique_ptr<arrow::ArrayBuilder>>* group_builders,
+                               std::vector<std::unique_ptr<arrow::ArrayBuilder>>* value_builders,
+                               RowBatch* output_rb) {
+  for (const auto& group_builder : *group_builders) {
     std::shared_ptr<arrow::Array> arr;
     PL_RETURN_IF_ERROR(group_builder->Finish(&arr));
     PL_RETURN_IF_ERROR(output_rb->AddColumn(arr));
   }
 
-  for (const auto& value_builder : value_builders) {
+  for (const auto& value_builder : *value_builders) {
     std::shared_ptr<arrow::Array> arr;
     PL_RETURN_IF_ERROR(value_builder->Finish(&arr));
     PL_RETURN_IF_ERROR(output_rb->AddColumn(arr));
@@ -348,6 +525,154 @@ Status AggNode::ConvertAggHashMapToRowBatch(ExecState* exec_state, RowBatch* out
   return Status::OK();
 }
 
+Status AggNode::ConvertAggHashMapToRowBatch(ExecState* exec_state, RowBatch* output_rb) {
+  DCHECK(output_rb != nullptr);
+  std::vector<std::unique_ptr<arrow::ArrayBuilder>> group_builders;
+  std::vector<std::unique_ptr<arrow::ArrayBuilder>> value_builders;
+  MakeOutputBuilders(exec_state, &group_builders, &value_builders);
+
+  // Agg into agg values and emit, one partition at a time.
+  for (const auto& partition : agg_hash_map_partitions_) {
+    PL_RETURN_IF_ERROR(
+        AppendGroupsToBuilders(exec_state, partition, &group_builders, &value_builders));
+  }
+
+  return FinishBuilders(&group_builders, &value_builders, output_rb);
+}
+
+Status AggNode::SpillRow(size_t partition_idx, const RowTuple& rt, const RowBatch& rb,
+                         int64_t row_idx) {
+  auto& file = spill_files_[partition_idx];
+  if (file == nullptr) {
+    file = std::make_unique<SpillFile>();
+    std::filesystem::path dir = FLAGS_carnot_agg_spill_dir.empty()
+                                    ? fs::TempDirectoryPath()
+                                    : std::filesystem::path(FLAGS_carnot_agg_spill_dir);
+    file->path = dir / absl::Substitute("px_agg_spill_$0_$1_$2", getpid(),
+                                        reinterpret_cast<uintptr_t>(this), partition_idx);
+    file->out.open(file->path, std::ios::binary | std::ios::trunc);
+    if (!file->out.is_open()) {
+      return error::Internal("Failed to open aggregate spill file $0", file->path.string());
+    }
+  }
+
+  std::string record;
+  for (size_t i = 0; i < group_data_types_.size(); ++i) {
+#define TYPE_CASE(_dt_) SerializeRowTupleValue<_dt_>(rt, i, &record);
+    PL_SWITCH_FOREACH_DATATYPE(group_data_types_[i], TYPE_CASE);
+#undef TYPE_CASE
+  }
+  for (size_t i = 0; i < stored_cols_data_types_.size(); ++i) {
+    const auto& rb_col_idx = stored_cols_to_plan_idx_[i];
+#define TYPE_CASE(_dt_) SerializeArrowValue<_dt_>(rb.ColumnAt(rb_col_idx).get(), row_idx, &record);
+    PL_SWITCH_FOREACH_DATATYPE(stored_cols_data_types_[i], TYPE_CASE);
+#undef TYPE_CASE
+  }
+
+  file->out.write(record.data(), record.size());
+  if (!file->out.good()) {
+    return error::Internal("Failed to write to aggregate spill file $0", file->path.string());
+  }
+  ++file->num_rows;
+  return Status::OK();
+}
+
+Status AggNode::ReplaySpillFile(ExecState* exec_state, SpillFile* file, AggHashMap* out_map) {
+  file->out.close();
+  std::ifstream in(file->path, std::ios::binary);
+  if (!in.is_open()) {
+    return error::Internal("Failed to open aggregate spill file $0", file->path.string());
+  }
+
+  RowTuple* rt = nullptr;
+  for (size_t row = 0; row < file->num_rows; ++row) {
+    if (rt == nullptr) {
+      rt = CreateGroupArgsRowTuple();
+    } else {
+      rt->Reset();
+    }
+    for (size_t i = 0; i < group_data_types_.size(); ++i) {
+      bool ok = false;
+#define TYPE_CASE(_dt_) ok = DeserializeIntoRowTuple<_dt_>(&in, rt, i);
+      PL_SWITCH_FOREACH_DATATYPE(group_data_types_[i], TYPE_CASE);
+#undef TYPE_CASE
+      if (!ok) {
+        return error::Internal("Truncated aggregate spill file $0", file->path.string());
+      }
+    }
+
+    auto [it, inserted] = out_map->try_emplace(rt, nullptr);
+    if (inserted) {
+      it->second = CreateAggHashValue(exec_state);
+      // The stored RowTuple is now owned by the map; allocate a fresh one for the next row.
+      rt = nullptr;
+    }
+    AggHashValue* val = it->second;
+
+    for (size_t i = 0; i < stored_cols_data_types_.size(); ++i) {
+      bool ok = false;
+#define TYPE_CASE(_dt_) ok = DeserializeIntoColumnWrapper<_dt_>(&in, val->agg_cols[i].get());
+      PL_SWITCH_FOREACH_DATATYPE(stored_cols_data_types_[i], TYPE_CASE);
+#undef TYPE_CASE
+      if (!ok) {
+        return error::Internal("Truncated aggregate spill file $0", file->path.string());
+      }
+    }
+
+    if (!stored_cols_data_types_.empty() &&
+        val->agg_cols[0]->Size() > kAggCompactionThreshold) {
+      PL_RETURN_IF_ERROR(EvaluateAggHashValue(exec_state, val));
+    }
+  }
+  return Status::OK();
+}
+
+Status AggNode::EmitSpilledPartitions(ExecState* exec_state, bool eow, bool eos) {
+  size_t last_idx = 0;
+  for (size_t i = 0; i < kAggHashMapPartitions; ++i) {
+    if (spill_files_[i] != nullptr) {
+      last_idx = i;
+    }
+  }
+
+  // Each spilled partition holds only groups that never became resident, so its replayed
+  // aggregates are disjoint from both the resident output and the other partitions.
+  for (size_t i = 0; i < kAggHashMapPartitions; ++i) {
+    if (spill_files_[i] == nullptr) {
+      continue;
+    }
+    AggHashMap replay_map;
+    PL_RETURN_IF_ERROR(ReplaySpillFile(exec_state, spill_files_[i].get(), &replay_map));
+
+    RowBatch output_rb(*output_descriptor_, replay_map.size());
+    std::vector<std::unique_ptr<arrow::ArrayBuilder>> group_builders;
+    std::vector<std::unique_ptr<arrow::ArrayBuilder>> value_builders;
+    MakeOutputBuilders(exec_state, &group_builders, &value_builders);
+    PL_RETURN_IF_ERROR(
+        AppendGroupsToBuilders(exec_state, replay_map, &group_builders, &value_builders));
+    PL_RETURN_IF_ERROR(FinishBuilders(&group_builders, &value_builders, &output_rb));
+
+    output_rb.set_eow(eow && i == last_idx);
+    output_rb.set_eos(eos && i == last_idx);
+    PL_RETURN_IF_ERROR(SendRowBatchToChildren(exec_state, output_rb));
+  }
+  return Status::OK();
+}
+
+void AggNode::DropSpillFiles() {
+  for (auto& file : spill_files_) {
+    if (file == nullptr) {
+      continue;
+    }
+    file->out.close();
+    std::error_code ec;
+    std::filesystem::remove(file->path, ec);
+    file.reset();
+  }
+  spilling_ = false;
+  resident_bytes_estimate_ = 0;
+}
+
 Status AggNode::AggregateGroupByClause(ExecState* exec_state, const RowBatch& rb) {
   // Extracts the row tuples (column wise).
   // TODO(zasgar): PL-455 - Chunk this so we don't create a crazy number of row tuples if the batch
@@ -364,11 +689,17 @@ Status AggNode::AggregateGroupByClause(ExecState* exec_state, const RowBatch& rb
   }
   PL_RETURN_IF_ERROR(ResetGroupArgs());
   if (ReadyToEmitBatches(rb)) {
-    RowBatch output_rb(*output_descriptor_, agg_hash_map_.size());
+    const bool has_spilled = HasSpilledGroups();
+    RowBatch output_rb(*output_descriptor_, AggHashMapSize());
     PL_RETURN_IF_ERROR(ConvertAggHashMapToRowBatch(exec_state, &output_rb));
-    output_rb.set_eow(rb.eow());
-    output_rb.set_eos(rb.eos());
+    output_rb.set_eow(rb.eow() && !has_spilled);
+    output_rb.set_eos(rb.eos() && !has_spilled);
     PL_RETURN_IF_ERROR(SendRowBatchToChildren(exec_state, output_rb));
+    if (has_spilled) {
+      // Spilled groups are re-aggregated and emitted as follow-on batches, one partition at a
+      // time; the last one carries the eow/eos markers.
+      PL_RETURN_IF_ERROR(EmitSpilledPartitions(exec_state, rb.eow(), rb.eos()));
+    }
     PL_RETURN_IF_ERROR(ClearAggState(exec_state));
   }
   return Status::OK();
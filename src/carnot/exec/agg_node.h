@@ -17,7 +17,12 @@
  */
 
 #pragma once
+#include <arrow/array/builder_base.h>
+
+#include <array>
 #include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <map>
 #include <memory>
 #include <string>
@@ -66,6 +71,13 @@ struct GroupArgs {
 class AggNode : public ProcessingNode {
   using AggHashMap = AbslRowTupleHashMap<AggHashValue*>;
 
+  // High-cardinality group-bys (millions of groups) degrade a single hash table through cache
+  // misses and long rehash pauses. The groups are therefore radix-partitioned on the upper bits
+  // of the key hash into sub-tables: each rehash touches only one partition (1/16th of the
+  // groups), and emission walks one cache-friendlier partition at a time.
+  static constexpr size_t kAggHashMapPartitionBits = 4;
+  static constexpr size_t kAggHashMapPartitions = 1 << kAggHashMapPartitionBits;
+
  public:
   AggNode() = default;
   virtual ~AggNode() = default;
@@ -83,7 +95,53 @@ class AggNode : public ProcessingNode {
                          size_t parent_index) override;
 
  private:
-  AggHashMap agg_hash_map_;
+  std::array<AggHashMap, kAggHashMapPartitions> agg_hash_map_partitions_;
+
+  // Selects the partition for a key hash. The upper bits are used, since the table's internal
+  // probing is driven by the lower bits.
+  size_t PartitionIdx(size_t hash) const {
+    return hash >> (sizeof(size_t) * 8 - kAggHashMapPartitionBits);
+  }
+  AggHashMap& AggHashMapPartition(size_t hash) {
+    return agg_hash_map_partitions_[PartitionIdx(hash)];
+  }
+
+  // Spill-to-disk state for large group-bys (see FLAGS_carnot_agg_spill_threshold_bytes).
+  // Once the resident group state exceeds the budget, rows whose group is not already resident
+  // are appended to a per-partition spill file instead of growing the hash table. Spilled
+  // partitions are re-aggregated and emitted one at a time at finalize, so peak memory is
+  // bounded by the resident groups plus one partition's worth of overflow groups.
+  struct SpillFile {
+    std::filesystem::path path;
+    std::ofstream out;
+    size_t num_rows = 0;
+  };
+  bool spilling_ = false;
+  size_t resident_bytes_estimate_ = 0;
+  std::array<std::unique_ptr<SpillFile>, kAggHashMapPartitions> spill_files_;
+
+  bool HasSpilledGroups() const {
+    for (const auto& file : spill_files_) {
+      if (file != nullptr) {
+        return true;
+      }
+    }
+    return false;
+  }
+  Status SpillRow(size_t partition_idx, const RowTuple& rt, const table_store::schema::RowBatch& rb,
+                  int64_t row_idx);
+  Status ReplaySpillFile(ExecState* exec_state, SpillFile* file, AggHashMap* out_map);
+  Status EmitSpilledPartitions(ExecState* exec_state, bool eow, bool eos);
+  void DropSpillFiles();
+
+  size_t AggHashMapSize() const {
+    size_t size = 0;
+    for (const auto& partition : agg_hash_map_partitions_) {
+      size += partition.size();
+    }
+    return size;
+  }
+
   bool HasNoGroups() const { return plan_node_->groups().empty(); }
   // ReadyToEmitBatches returns true when the input stream has reached a point where output batches
   // can be emitted. In the windowed aggregate case, this happens whenever end of window (eow) is
@@ -142,6 +200,15 @@ class AggNode : public ProcessingNode {
   Status ResetGroupArgs();
   Status ConvertAggHashMapToRowBatch(ExecState* exec_state,
                                      table_store::schema::RowBatch* output_rb);
+  void MakeOutputBuilders(ExecState* exec_state,
+                          std::vector<std::unique_ptr<arrow::ArrayBuilder>>* group_builders,
+                          std::vector<std::unique_ptr<arrow::ArrayBuilder>>* value_builders);
+  Status AppendGroupsToBuilders(ExecState* exec_state, const AggHashMap& map,
+                                std::vector<std::unique_ptr<arrow::ArrayBuilder>>* group_builders,
+                                std::vector<std::unique_ptr<arrow::ArrayBuilder>>* value_builders);
+  Status FinishBuilders(std::vector<std::unique_ptr<arrow::ArrayBuilder>>* group_builders,
+                        std::vector<std::unique_ptr<arrow::ArrayBuilder>>* value_builders,
+                        table_store::schema::RowBatch* output_rb);
 
   AggHashValue* CreateAggHashValue(ExecState* exec_state);
   RowTuple* CreateGroupArgsRowTuple() {
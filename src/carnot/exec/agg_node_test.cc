@@ -30,6 +30,8 @@
 #include "src/common/testing/testing.h"
 #include "src/shared/types/typespb/wrapper/types_pb_wrapper.h"
 
+DECLARE_int64(carnot_agg_spill_threshold_bytes);
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -446,6 +448,80 @@ TEST_F(AggNodeTest, multiple_groups_with_string_blocking) {
       .Close();
 }
 
+TEST_F(AggNodeTest, single_group_blocking_with_spill) {
+  // Force spilling after the first batch, so the new group in the second batch overflows to
+  // disk and is emitted as a follow-on batch.
+  const int64_t old_threshold = FLAGS_carnot_agg_spill_threshold_bytes;
+  FLAGS_carnot_agg_spill_threshold_bytes = 1;
+
+  auto plan_node = PlanNodeFromPbtxt(kBlockingSingleGroupAgg);
+  RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64});
+
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<AggNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 2, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::Int64Value>({1, 1})
+                       .AddColumn<types::Int64Value>({2, 3})
+                       .get(),
+                   0, 0)
+      // Group 1 stays resident; group 2 is new while spilling, so its rows go to a spill file
+      // and come back as a second output batch.
+      .ConsumeNext(RowBatchBuilder(input_rd, 4, true, true)
+                       .AddColumn<types::Int64Value>({1, 2, 2, 2})
+                       .AddColumn<types::Int64Value>({0, 1, 5, 2})
+                       .get(),
+                   0, 2)
+      .ExpectRowBatchesData(RowBatchBuilder(output_rd, 2, true, true)
+                                .AddColumn<types::Int64Value>({1, 2})
+                                .AddColumn<types::Int64Value>({2, 5})
+                                .get(),
+                            2)
+      .Close();
+
+  FLAGS_carnot_agg_spill_threshold_bytes = old_threshold;
+}
+
+TEST_F(AggNodeTest, multiple_groups_with_string_blocking_with_spill) {
+  const int64_t old_threshold = FLAGS_carnot_agg_spill_threshold_bytes;
+  FLAGS_carnot_agg_spill_threshold_bytes = 1;
+
+  auto plan_node = PlanNodeFromPbtxt(kBlockingMultipleGroupAgg);
+  RowDescriptor input_rd({types::DataType::STRING, types::DataType::INT64, types::DataType::INT64});
+
+  RowDescriptor output_rd(
+      {types::DataType::STRING, types::DataType::INT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<AggNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 2, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::StringValue>({"abc", "abc"})
+                       .AddColumn<types::Int64Value>({1, 1})
+                       .AddColumn<types::Int64Value>({2, 3})
+                       .get(),
+                   0, 0)
+      .ConsumeNext(RowBatchBuilder(input_rd, 3, true, true)
+                       .AddColumn<types::StringValue>({"abc", "bb", "bb"})
+                       .AddColumn<types::Int64Value>({1, 2, 2})
+                       .AddColumn<types::Int64Value>({5, 7, 1})
+                       .get(),
+                   0, 2)
+      .ExpectRowBatchesData(RowBatchBuilder(output_rd, 2, true, true)
+                                .AddColumn<types::StringValue>({"abc", "bb"})
+                                .AddColumn<types::Int64Value>({1, 2})
+                                .AddColumn<types::Int64Value>({3, 3})
+                                .get(),
+                            2)
+      .Close();
+
+  FLAGS_carnot_agg_spill_threshold_bytes = old_threshold;
+}
+
 TEST_F(AggNodeTest, no_groups_windowed) {
   auto plan_node = PlanNodeFromPbtxt(kWindowedNoGroupAgg);
   RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64});
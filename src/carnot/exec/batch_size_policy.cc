@@ -0,0 +1,66 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/batch_size_policy.h"
+
+#include <algorithm>
+
+#include "src/shared/types/arrow_adapter.h"
+#include "src/shared/types/type_utils.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+namespace {
+
+size_t EstimatedRowWidthBytes(const table_store::schema::RowDescriptor& rd) {
+  size_t width = 0;
+  for (const auto& type : rd.types()) {
+    if (type == types::DataType::STRING) {
+      width += kStringColumnWidthEstimateBytes;
+    } else {
+      width += types::ArrowTypeToBytes(types::ToArrowType(type));
+    }
+  }
+  return std::max<size_t>(width, 1);
+}
+
+size_t RowsForWidth(size_t row_width_bytes) {
+  return std::clamp(kTargetBatchSizeBytes / row_width_bytes, kMinTargetRowsPerBatch,
+                    kMaxTargetRowsPerBatch);
+}
+
+}  // namespace
+
+size_t TargetRowsPerBatch(const table_store::schema::RowDescriptor& rd) {
+  return RowsForWidth(EstimatedRowWidthBytes(rd));
+}
+
+size_t TargetRowsPerBatch(const table_store::schema::RowDescriptor& rd, int64_t observed_bytes,
+                          int64_t observed_rows) {
+  if (observed_rows <= 0 || observed_bytes <= 0) {
+    return TargetRowsPerBatch(rd);
+  }
+  size_t observed_width = std::max<int64_t>(observed_bytes / observed_rows, 1);
+  return RowsForWidth(observed_width);
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "src/table_store/table_store.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+// Output batches are sized by byte footprint rather than a fixed row count, so wide rows
+// (e.g. http_events with header and body columns) don't blow past the cache while narrow
+// timeseries rows still amortize per-batch overhead.
+constexpr size_t kTargetBatchSizeBytes = 256 * 1024;
+
+// Assumed width of a STRING cell until observed data provides a measured average.
+constexpr size_t kStringColumnWidthEstimateBytes = 64;
+
+// Bounds on the computed rows-per-batch, guarding against degenerate schemas (a single narrow
+// column, or rows wider than the whole byte budget).
+constexpr size_t kMinTargetRowsPerBatch = 64;
+constexpr size_t kMaxTargetRowsPerBatch = 64 * 1024;
+
+/**
+ * Returns the rows-per-batch that targets kTargetBatchSizeBytes for the given output schema,
+ * using the fixed column widths and kStringColumnWidthEstimateBytes per STRING column.
+ */
+size_t TargetRowsPerBatch(const table_store::schema::RowDescriptor& rd);
+
+/**
+ * Like the above, but refines the row width with the observed average (output bytes over output
+ * rows), so the batch size adapts to the data actually flowing through the operator. Falls back
+ * to the schema estimate until there are observations.
+ */
+size_t TargetRowsPerBatch(const table_store::schema::RowDescriptor& rd, int64_t observed_bytes,
+                          int64_t observed_rows);
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/batch_size_policy.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "src/common/testing/testing.h"
+#include "src/shared/types/types.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowDescriptor;
+
+TEST(BatchSizePolicyTest, narrow_schema_gets_more_rows_than_wide) {
+  RowDescriptor narrow({types::DataType::TIME64NS, types::DataType::FLOAT64});
+  RowDescriptor wide({types::DataType::TIME64NS, types::DataType::STRING, types::DataType::STRING,
+                      types::DataType::STRING, types::DataType::STRING, types::DataType::STRING});
+
+  size_t narrow_rows = TargetRowsPerBatch(narrow);
+  size_t wide_rows = TargetRowsPerBatch(wide);
+
+  EXPECT_GT(narrow_rows, wide_rows);
+  EXPECT_EQ(kTargetBatchSizeBytes / 16, narrow_rows);
+}
+
+TEST(BatchSizePolicyTest, rows_are_clamped) {
+  // A single INT64 column: byte budget over 8-byte rows exceeds the upper clamp.
+  RowDescriptor narrow({types::DataType::INT64});
+  EXPECT_EQ(kMaxTargetRowsPerBatch, TargetRowsPerBatch(narrow));
+
+  // Observed rows a megabyte wide: clamp at the lower bound.
+  EXPECT_EQ(kMinTargetRowsPerBatch,
+            TargetRowsPerBatch(narrow, /* observed_bytes */ 10 * 1024 * 1024,
+                               /* observed_rows */ 10));
+}
+
+TEST(BatchSizePolicyTest, observed_width_overrides_estimate) {
+  RowDescriptor rd({types::DataType::STRING});
+
+  // 1 KiB average rows, much wider than the 64-byte string estimate.
+  size_t adapted = TargetRowsPerBatch(rd, /* observed_bytes */ 1024 * 1000, /* observed_rows */
+                                      1000);
+  EXPECT_EQ(kTargetBatchSizeBytes / 1024, adapted);
+
+  // No observations yet: falls back to the schema estimate.
+  EXPECT_EQ(TargetRowsPerBatch(rd), TargetRowsPerBatch(rd, 0, 0));
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
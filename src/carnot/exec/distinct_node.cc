@@ -0,0 +1,187 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/distinct_node.h"
+
+#include <arrow/array.h>
+#include <arrow/memory_pool.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/substitute.h>
+
+#include "src/carnot/planpb/plan.pb.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/shared/types/type_utils.h"
+#include "src/shared/types/types.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowBatch;
+using table_store::schema::RowDescriptor;
+
+namespace {
+
+template <types::DataType DT>
+Status CopySelectedValues(const std::vector<bool>& selected, const arrow::Array* input_col,
+                          RowBatch* output_rb) {
+  size_t num_output_records = output_rb->num_rows();
+  size_t num_input_records = input_col->length();
+  auto output_col_builder_generic = MakeArrowBuilder(DT, arrow::default_memory_pool());
+  auto* output_col_builder = static_cast<typename types::DataTypeTraits<DT>::arrow_builder_type*>(
+      output_col_builder_generic.get());
+  PL_RETURN_IF_ERROR(output_col_builder->Reserve(num_output_records));
+  for (size_t idx = 0; idx < num_input_records; ++idx) {
+    if (selected[idx]) {
+      if constexpr (DT == types::DataType::STRING) {
+        PL_RETURN_IF_ERROR(
+            output_col_builder->Append(types::GetValueFromArrowArray<DT>(input_col, idx)));
+      } else {
+        output_col_builder->UnsafeAppend(types::GetValueFromArrowArray<DT>(input_col, idx));
+      }
+    }
+  }
+  std::shared_ptr<arrow::Array> output_array;
+  PL_RETURN_IF_ERROR(output_col_builder->Finish(&output_array));
+  PL_RETURN_IF_ERROR(output_rb->AddColumn(output_array));
+  return Status::OK();
+}
+
+}  // namespace
+
+std::string DistinctNode::DebugStringImpl() {
+  return absl::Substitute("Exec::DistinctNode<$0 key cols>", key_data_types_.size());
+}
+
+Status DistinctNode::InitImpl(const plan::Operator& plan_node) {
+  CHECK(plan_node.op_type() == planpb::OperatorType::AGGREGATE_OPERATOR);
+  const auto* agg_plan_node = static_cast<const plan::AggregateOperator*>(&plan_node);
+  // copy the plan node to local object;
+  plan_node_ = std::make_unique<plan::AggregateOperator>(*agg_plan_node);
+  DCHECK(plan_node_->values().empty())
+      << "DistinctNode only handles aggregates without aggregate expressions";
+  return Status::OK();
+}
+
+Status DistinctNode::PrepareImpl(ExecState*) {
+  // With no aggregate expressions, the output descriptor is exactly the group columns in group
+  // order, so it doubles as the key schema.
+  key_data_types_ = output_descriptor_->types();
+  DCHECK_EQ(key_data_types_.size(), plan_node_->groups().size());
+  return Status::OK();
+}
+
+Status DistinctNode::OpenImpl(ExecState*) { return Status::OK(); }
+
+Status DistinctNode::CloseImpl(ExecState*) {
+  seen_keys_.clear();
+  key_pool_.Clear();
+  return Status::OK();
+}
+
+RowTuple* DistinctNode::MaterializeKey(const std::vector<arrow::Array*>& key_columns,
+                                       int64_t row_idx) {
+  RowTuple* rt = key_pool_.Add(new RowTuple(&key_data_types_));
+  for (size_t col_idx = 0; col_idx < key_columns.size(); ++col_idx) {
+#define TYPE_CASE(_dt_) \
+  ExtractIntoRowTuple<_dt_>(rt, key_columns[col_idx], col_idx, row_idx);
+    PL_SWITCH_FOREACH_DATATYPE(key_data_types_[col_idx], TYPE_CASE);
+#undef TYPE_CASE
+  }
+  return rt;
+}
+
+Status DistinctNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb, size_t) {
+  const int64_t num_rows = rb.num_rows();
+
+  // Keep the shared_ptrs alive for the duration of the batch while hashing raw pointers.
+  std::vector<std::shared_ptr<arrow::Array>> key_columns_shared;
+  std::vector<arrow::Array*> key_columns;
+  key_columns_shared.reserve(plan_node_->groups().size());
+  key_columns.reserve(plan_node_->groups().size());
+  for (const auto& group : plan_node_->groups()) {
+    key_columns_shared.push_back(rb.ColumnAt(group.idx));
+    key_columns.push_back(key_columns_shared.back().get());
+  }
+
+  std::vector<size_t> hashes = HashKeyColumns(key_columns, key_data_types_);
+
+  // Probe columnar-ly; only rows with previously unseen keys materialize a RowTuple.
+  std::vector<bool> is_new(num_rows, false);
+  int64_t num_new = 0;
+  int64_t first_new = -1;
+  int64_t last_new = -1;
+  for (int64_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+    ColumnarRowKeyRef ref{&key_columns, &key_data_types_, row_idx, hashes[row_idx]};
+    if (seen_keys_.contains(ref)) {
+      continue;
+    }
+    seen_keys_.insert(MaterializeKey(key_columns, row_idx));
+    is_new[row_idx] = true;
+    if (num_new == 0) {
+      first_new = row_idx;
+    }
+    last_new = row_idx;
+    ++num_new;
+  }
+
+  // Batch-level early-out: a batch of already-seen keys produces no output at all, unless the
+  // eow/eos markers still need to flow downstream.
+  if (num_new == 0 && !rb.eow() && !rb.eos()) {
+    return Status::OK();
+  }
+
+  RowBatch output_rb(*output_descriptor_, num_new);
+  if (num_new == num_rows) {
+    // Every row was new: forward the key columns without copying.
+    for (const auto& col : key_columns_shared) {
+      PL_RETURN_IF_ERROR(output_rb.AddColumn(col));
+    }
+  } else if (num_new == 0) {
+    for (auto col_type : key_data_types_) {
+      auto builder = MakeArrowBuilder(col_type, arrow::default_memory_pool());
+      std::shared_ptr<arrow::Array> empty_col;
+      PL_RETURN_IF_ERROR(builder->Finish(&empty_col));
+      PL_RETURN_IF_ERROR(output_rb.AddColumn(empty_col));
+    }
+  } else if (last_new - first_new + 1 == num_new) {
+    // The new rows form one contiguous run: zero-copy arrow slices.
+    for (const auto& col : key_columns_shared) {
+      PL_RETURN_IF_ERROR(output_rb.AddColumn(col->Slice(first_new, num_new)));
+    }
+  } else {
+    for (size_t col_idx = 0; col_idx < key_columns.size(); ++col_idx) {
+#define TYPE_CASE(_dt_) \
+  PL_RETURN_IF_ERROR(CopySelectedValues<_dt_>(is_new, key_columns[col_idx], &output_rb));
+      PL_SWITCH_FOREACH_DATATYPE(key_data_types_[col_idx], TYPE_CASE);
+#undef TYPE_CASE
+    }
+  }
+
+  output_rb.set_eow(rb.eow());
+  output_rb.set_eos(rb.eos());
+  PL_RETURN_IF_ERROR(SendRowBatchToChildren(exec_state, output_rb));
+  return Status::OK();
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
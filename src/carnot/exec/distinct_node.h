@@ -0,0 +1,75 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/carnot/exec/exec_node.h"
+#include "src/carnot/exec/exec_state.h"
+#include "src/carnot/exec/row_tuple.h"
+#include "src/carnot/plan/operators.h"
+#include "src/common/base/base.h"
+#include "src/common/memory/memory.h"
+#include "src/table_store/table_store.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * DistinctNode deduplicates rows by the group columns of a group-by-all aggregate.
+ *
+ * Dedup patterns like df.drop_duplicates() compile to an AggregateOperator with groups and no
+ * aggregate expressions. AggNode handles that shape with the full UDA machinery and blocks until
+ * eos, although the query is pure set membership. This node instead keys rows columnar-ly with
+ * HashKeyColumns, streams a row out the first time its key is seen, and skips the output batch
+ * entirely when a batch contains no new keys, which is the common case for low-cardinality
+ * columns. Seen keys are materialized once into pool-backed RowTuples; repeat rows never
+ * allocate.
+ */
+class DistinctNode : public ProcessingNode {
+ public:
+  DistinctNode() = default;
+  virtual ~DistinctNode() = default;
+
+ protected:
+  std::string DebugStringImpl() override;
+  Status InitImpl(const plan::Operator& plan_node) override;
+  Status PrepareImpl(ExecState* exec_state) override;
+  Status OpenImpl(ExecState* exec_state) override;
+  Status CloseImpl(ExecState* exec_state) override;
+  Status ConsumeNextImpl(ExecState* exec_state, const table_store::schema::RowBatch& rb,
+                         size_t parent_index) override;
+
+ private:
+  RowTuple* MaterializeKey(const std::vector<arrow::Array*>& key_columns, int64_t row_idx);
+
+  std::unique_ptr<plan::AggregateOperator> plan_node_;
+  std::vector<types::DataType> key_data_types_;
+
+  // Set of keys seen so far. The tuples are owned by key_pool_ and live for the node's lifetime.
+  AbslRowTupleHashSet seen_keys_;
+  ObjectPool key_pool_{"distinct_keys_pool"};
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/distinct_node.h"
+
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+#include <sole.hpp>
+
+#include "src/carnot/exec/test_utils.h"
+#include "src/carnot/planpb/plan.pb.h"
+#include "src/carnot/udf/registry.h"
+#include "src/common/testing/testing.h"
+#include "src/shared/types/typespb/wrapper/types_pb_wrapper.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowDescriptor;
+
+constexpr char kSingleColumnDistinct[] = R"(
+op_type: AGGREGATE_OPERATOR
+agg_op {
+  groups {
+     node: 0
+     index: 0
+  }
+  group_names: "g1"
+})";
+
+constexpr char kMultiColumnDistinct[] = R"(
+op_type: AGGREGATE_OPERATOR
+agg_op {
+  groups {
+     node: 0
+     index: 0
+  }
+  groups {
+     node: 0
+     index: 1
+  }
+  group_names: "g1"
+  group_names: "g2"
+})";
+
+std::unique_ptr<ExecState> MakeTestExecState(udf::Registry* registry) {
+  auto table_store = std::make_shared<table_store::TableStore>();
+  return std::make_unique<ExecState>(registry, table_store, MockResultSinkStubGenerator,
+                                     MockMetricsStubGenerator, MockTraceStubGenerator,
+                                     sole::uuid4(), nullptr);
+}
+
+std::unique_ptr<plan::Operator> PlanNodeFromPbtxt(const std::string& pbtxt) {
+  planpb::Operator op_pb;
+  EXPECT_TRUE(google::protobuf::TextFormat::MergeFromString(pbtxt, &op_pb));
+  return plan::AggregateOperator::FromProto(op_pb, 1);
+}
+
+class DistinctNodeTest : public ::testing::Test {
+ public:
+  DistinctNodeTest() {
+    func_registry_ = std::make_unique<udf::Registry>("test");
+    exec_state_ = MakeTestExecState(func_registry_.get());
+  }
+
+ protected:
+  std::unique_ptr<ExecState> exec_state_;
+  std::unique_ptr<udf::Registry> func_registry_;
+};
+
+TEST_F(DistinctNodeTest, streams_first_occurrences) {
+  auto plan_node = PlanNodeFromPbtxt(kSingleColumnDistinct);
+  RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<DistinctNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 4, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::Int64Value>({2, 1, 2, 3})
+                       .AddColumn<types::Int64Value>({9, 9, 9, 9})
+                       .get(),
+                   0)
+      // New keys stream out immediately, in first-seen order, without waiting for eos.
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 3, false, false)
+                          .AddColumn<types::Int64Value>({2, 1, 3})
+                          .get(),
+                      false)
+      .ConsumeNext(RowBatchBuilder(input_rd, 3, true, true)
+                       .AddColumn<types::Int64Value>({3, 4, 1})
+                       .AddColumn<types::Int64Value>({9, 9, 9})
+                       .get(),
+                   0)
+      .ExpectRowBatch(
+          RowBatchBuilder(output_rd, 1, true, true).AddColumn<types::Int64Value>({4}).get(), false)
+      .Close();
+}
+
+TEST_F(DistinctNodeTest, early_out_on_batches_with_no_new_keys) {
+  auto plan_node = PlanNodeFromPbtxt(kSingleColumnDistinct);
+  RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<DistinctNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 2, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::Int64Value>({1, 2})
+                       .AddColumn<types::Int64Value>({0, 0})
+                       .get(),
+                   0)
+      .ExpectRowBatch(
+          RowBatchBuilder(output_rd, 2, false, false).AddColumn<types::Int64Value>({1, 2}).get(),
+          false)
+      // A batch of only repeats produces no output batch at all.
+      .ConsumeNext(RowBatchBuilder(input_rd, 3, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::Int64Value>({2, 1, 2})
+                       .AddColumn<types::Int64Value>({0, 0, 0})
+                       .get(),
+                   0, 0)
+      // But a repeats-only eos batch still forwards the marker as an empty batch.
+      .ConsumeNext(RowBatchBuilder(input_rd, 2, true, true)
+                       .AddColumn<types::Int64Value>({1, 1})
+                       .AddColumn<types::Int64Value>({0, 0})
+                       .get(),
+                   0)
+      .ExpectRowBatch(
+          RowBatchBuilder(output_rd, 0, true, true).AddColumn<types::Int64Value>({}).get(), false)
+      .Close();
+}
+
+TEST_F(DistinctNodeTest, multi_column_keys_with_strings) {
+  auto plan_node = PlanNodeFromPbtxt(kMultiColumnDistinct);
+  RowDescriptor input_rd({types::DataType::STRING, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::STRING, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<DistinctNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 4, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::StringValue>({"a", "a", "b", "a"})
+                       .AddColumn<types::Int64Value>({1, 2, 1, 1})
+                       .get(),
+                   0)
+      // ("a", 1) repeats within the batch; the other three column combinations are distinct.
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 3, false, false)
+                          .AddColumn<types::StringValue>({"a", "a", "b"})
+                          .AddColumn<types::Int64Value>({1, 2, 1})
+                          .get(),
+                      false)
+      .ConsumeNext(RowBatchBuilder(input_rd, 2, true, true)
+                       .AddColumn<types::StringValue>({"b", "b"})
+                       .AddColumn<types::Int64Value>({1, 2})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 1, true, true)
+                          .AddColumn<types::StringValue>({"b"})
+                          .AddColumn<types::Int64Value>({2})
+                          .get(),
+                      false)
+      .Close();
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -24,17 +24,30 @@
 #include <algorithm>
 #include <cstdint>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include <absl/strings/str_join.h>
 #include <absl/strings/substitute.h>
 
+#include "src/carnot/exec/batch_size_policy.h"
 #include "src/carnot/planpb/plan.pb.h"
 #include "src/carnot/udf/udf_wrapper.h"
 #include "src/common/base/base.h"
 #include "src/shared/types/arrow_adapter.h"
 #include "src/shared/types/type_utils.h"
 
+DEFINE_bool(carnot_equijoin_probe_bloom_filter,
+            gflags::BoolFromEnv("PL_CARNOT_EQUIJOIN_PROBE_BLOOM_FILTER", true),
+            "Build a bloom filter over the build-side join keys once the build phase completes, "
+            "and reject non-matching probe rows before the hash-table lookup.");
+
+DEFINE_int64(carnot_equijoin_probe_threads,
+             gflags::Int64FromEnv("PL_CARNOT_EQUIJOIN_PROBE_THREADS", 4),
+             "Number of worker threads used for the probe lookup phase of hash joins. The "
+             "lookups are read-only on the partitioned build buffer, so workers share no "
+             "mutable state. Values of 0 or 1 run the probe on the execution thread.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -42,6 +55,93 @@ namespace exec {
 using table_store::schema::RowBatch;
 using table_store::schema::RowDescriptor;
 
+// Probe batches smaller than this per worker stay on the execution thread, since thread
+// launch overhead would dominate the lookups.
+constexpr int64_t kMinProbeRowsPerThread = 1024;
+
+// False positive rate for the build-key bloom filter. False positives only cost a redundant
+// hash-table lookup, so this does not need to be aggressive.
+constexpr double kProbeKeyFilterErrorRate = 0.01;
+
+namespace {
+
+// Serializes the key tuple to a flat byte string for bloom filter insert/lookup. Strings are
+// length-prefixed so that adjacent string keys cannot alias each other.
+template <types::DataType DT>
+void AppendKeyValue(const RowTuple& rt, size_t idx, std::string* out) {
+  using ValueType = typename types::DataTypeTraits<DT>::value_type;
+  if constexpr (DT == types::DataType::STRING) {
+    const auto view = rt.GetStringValue(idx);
+    uint64_t size = view.size();
+    out->append(reinterpret_cast<const char*>(&size), sizeof(size));
+    out->append(view.data(), view.size());
+  } else {
+    const ValueType& val = rt.GetValue<ValueType>(idx);
+    out->append(reinterpret_cast<const char*>(&val), sizeof(ValueType));
+  }
+}
+
+void SerializeKeyTuple(const RowTuple& rt, const std::vector<types::DataType>& key_types,
+                       std::string* out) {
+  for (size_t idx = 0; idx < key_types.size(); ++idx) {
+#define TYPE_CASE(_dt_) AppendKeyValue<_dt_>(rt, idx, out);
+    PL_SWITCH_FOREACH_DATATYPE(key_types[idx], TYPE_CASE);
+#undef TYPE_CASE
+  }
+}
+
+// Columnar counterpart of AppendKeyValue: serializes the value at the given row of a key column,
+// producing the same bytes as a RowTuple built from that row.
+template <types::DataType DT>
+void AppendKeyValueFromColumn(const arrow::Array* col, int64_t row_idx, std::string* out) {
+  using ValueType = typename types::DataTypeTraits<DT>::value_type;
+  if constexpr (DT == types::DataType::STRING) {
+    const auto view = types::GetStringViewFromArrowArray(col, row_idx);
+    uint64_t size = view.size();
+    out->append(reinterpret_cast<const char*>(&size), sizeof(size));
+    out->append(view.data(), view.size());
+  } else {
+    const ValueType val(types::GetValueFromArrowArray<DT>(col, row_idx));
+    out->append(reinterpret_cast<const char*>(&val), sizeof(ValueType));
+  }
+}
+
+void SerializeKeyColumnsRow(const std::vector<arrow::Array*>& key_columns,
+                            const std::vector<types::DataType>& key_types, int64_t row_idx,
+                            std::string* out) {
+  for (size_t idx = 0; idx < key_types.size(); ++idx) {
+#define TYPE_CASE(_dt_) AppendKeyValueFromColumn<_dt_>(key_columns[idx], row_idx, out);
+    PL_SWITCH_FOREACH_DATATYPE(key_types[idx], TYPE_CASE);
+#undef TYPE_CASE
+  }
+}
+
+// Three-way comparison of the merge-join key at two (column, row) positions.
+template <types::DataType DT>
+int CompareKeyAt(const arrow::Array* left, int64_t left_row, const arrow::Array* right,
+                 int64_t right_row) {
+  if constexpr (DT == types::DataType::STRING) {
+    const auto left_view = types::GetStringViewFromArrowArray(left, left_row);
+    const auto right_view = types::GetStringViewFromArrowArray(right, right_row);
+    return left_view.compare(right_view);
+  } else {
+    const auto left_val = types::GetValueFromArrowArray<DT>(left, left_row);
+    const auto right_val = types::GetValueFromArrowArray<DT>(right, right_row);
+    return left_val < right_val ? -1 : (right_val < left_val ? 1 : 0);
+  }
+}
+
+int CompareKeys(types::DataType dt, const arrow::Array* left, int64_t left_row,
+                const arrow::Array* right, int64_t right_row) {
+  int result = 0;
+#define TYPE_CASE(_dt_) result = CompareKeyAt<_dt_>(left, left_row, right, right_row);
+  PL_SWITCH_FOREACH_DATATYPE(dt, TYPE_CASE);
+#undef TYPE_CASE
+  return result;
+}
+
+}  // namespace
+
 std::string EquijoinNode::DebugStringImpl() {
   return absl::Substitute("Exec::JoinNode<$0>", absl::StrJoin(plan_node_->column_names(), ","));
 }
@@ -58,8 +158,10 @@ Status EquijoinNode::InitImpl(const plan::Operator& plan_node) {
   }
   const auto* join_plan_node = static_cast<const plan::JoinOperator*>(&plan_node);
   plan_node_ = std::make_unique<plan::JoinOperator>(*join_plan_node);
-  output_rows_per_batch_ =
-      plan_node_->rows_per_batch() == 0 ? kDefaultJoinRowBatchSize : plan_node_->rows_per_batch();
+  // When the plan doesn't pin a batch size, target a byte footprint computed from the output
+  // schema's row width, so wide schemas get fewer rows per batch and narrow ones get more.
+  output_rows_per_batch_ = plan_node_->rows_per_batch() == 0 ? TargetRowsPerBatch(*output_descriptor_)
+                                                             : plan_node_->rows_per_batch();
 
   if (plan_node_->order_by_time() && plan_node_->time_column().parent_index() == 0) {
     // Make the probe table the left table when we need to preserve the order of the left table in
@@ -100,6 +202,10 @@ Status EquijoinNode::InitImpl(const plan::Operator& plan_node) {
         probe_table_ == EquijoinNode::JoinInputTable::kLeftTable ? left_index : right_index);
   }
 
+  // Sort-merge mode needs a single sort key; with multiple equality conditions the planner's
+  // ordering proof doesn't cover the composite key, so those joins stay on the hash path.
+  merge_join_ = plan_node_->sorted_inputs() && plan_node_->equality_conditions().size() == 1;
+
   const auto& output_cols = plan_node_->output_columns();
   for (size_t i = 0; i < output_cols.size(); ++i) {
     auto parent_index = output_cols[i].parent_index();
@@ -135,7 +241,13 @@ Status EquijoinNode::OpenImpl(ExecState* /*exec_state*/) { return Status::OK();
 
 Status EquijoinNode::CloseImpl(ExecState* /*exec_state*/) {
   join_keys_chunk_.clear();
-  build_buffer_.clear();
+  for (auto& side : merge_sides_) {
+    side.batches.clear();
+  }
+  for (auto& partition : build_buffer_partitions_) {
+    partition.clear();
+  }
+  build_key_filter_.reset();
   probed_keys_.clear();
   key_values_pool_.Clear();
   return Status::OK();
@@ -150,8 +262,9 @@ void ExtractIntoRowTuples(std::vector<RowTuple*>* row_tuples, arrow::Array* inpu
   }
 }
 
-Status EquijoinNode::ExtractJoinKeysForBatch(const table_store::schema::RowBatch& rb,
-                                             bool is_probe) {
+// Materializes the key tuples for a build-side batch. The probe side keys stay columnar
+// (see DoProbe), so only build batches pay for tuple extraction.
+Status EquijoinNode::ExtractJoinKeysForBatch(const table_store::schema::RowBatch& rb) {
   // Reset the row tuples
   for (auto& rt : join_keys_chunk_) {
     if (rt == nullptr) {
@@ -172,7 +285,7 @@ Status EquijoinNode::ExtractJoinKeysForBatch(const table_store::schema::RowBatch
     }
   }
 
-  const TableSpec& spec = is_probe ? probe_spec_ : build_spec_;
+  const TableSpec& spec = build_spec_;
 
   // Scan through all the group args in column order and extract the entire column.
   for (size_t tuple_col_idx = 0; tuple_col_idx < spec.key_indices.size(); ++tuple_col_idx) {
@@ -211,8 +324,11 @@ Status EquijoinNode::HashRowBatch(const table_store::schema::RowBatch& rb) {
   // Make sure the map has constructed the necessary column wrappers for all of the tuples.
   for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
     auto& rt = join_keys_chunk_[row_idx];
-    auto& current = build_buffer_[rt];
-    auto wrappers_ptr = current != nullptr ? current : build_wrappers_chunk_[row_idx];
+    const size_t hash = RowTuplePtrHasher()(rt);
+    auto [it, inserted] = BuildBufferPartition(hash).try_emplace(rt);
+    BuildBufferValue& current = it->second;
+    auto wrappers_ptr =
+        current.wrappers != nullptr ? current.wrappers : build_wrappers_chunk_[row_idx];
 
     // Now extract the values into the corresponding column wrappers.
     for (size_t i = 0; i < build_spec_.input_col_indices.size(); ++i) {
@@ -226,10 +342,10 @@ Status EquijoinNode::HashRowBatch(const table_store::schema::RowBatch& rb) {
 #undef TYPE_CASE
     }
     // Keep track of the number of rows that the build buffer matches for each key.
-    build_buffer_rows_[rt]++;
+    current.num_rows++;
 
-    if (current == nullptr) {
-      std::swap(build_wrappers_chunk_[row_idx], current);
+    if (current.wrappers == nullptr) {
+      std::swap(build_wrappers_chunk_[row_idx], current.wrappers);
       // Reset the new tuples that we added
       join_keys_chunk_[row_idx] = nullptr;
     }
@@ -351,25 +467,77 @@ Status EquijoinNode::DoProbe(ExecState* exec_state, const table_store::schema::R
     probe_eos_ = true;
   }
 
-  PL_RETURN_IF_ERROR(ExtractJoinKeysForBatch(rb, true));
-
-  if (rb.num_rows() > static_cast<int64_t>(probe_wrappers_chunk_.size())) {
-    probe_wrappers_chunk_.resize(rb.num_rows());
-  }
-
-  for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
-    auto it = build_buffer_.find(join_keys_chunk_[row_idx]);
-    if (it != build_buffer_.end()) {
-      probe_wrappers_chunk_[row_idx] = it->second;
-      probed_keys_.insert(it->first);
-    } else {
-      probe_wrappers_chunk_[row_idx] = nullptr;
+  // Probe keys are kept columnar: hash the key columns vector-wise and look up with refs back
+  // into the batch, so no RowTuple is materialized per probe row. Only the build side still
+  // materializes tuples, since the map keys need owned storage.
+  std::vector<arrow::Array*> key_columns;
+  key_columns.reserve(probe_spec_.key_indices.size());
+  for (const auto& input_col_idx : probe_spec_.key_indices) {
+    key_columns.push_back(rb.ColumnAt(input_col_idx).get());
+  }
+  const std::vector<size_t> key_hashes = HashKeyColumns(key_columns, key_data_types_);
+
+  const int64_t num_rows = rb.num_rows();
+  if (num_rows > static_cast<int64_t>(probe_wrappers_chunk_.size())) {
+    probe_wrappers_chunk_.resize(num_rows);
+    probe_matched_keys_chunk_.resize(num_rows);
+    probe_match_rows_chunk_.resize(num_rows);
+  }
+
+  // Lookup phase: read-only on the partitioned build buffer, with each worker writing only its
+  // own row range of the scratch chunks, so it can fan out across threads.
+  auto probe_rows = [this, &key_columns, &key_hashes](int64_t start_row, int64_t end_row) {
+    std::string key_buf;
+    for (int64_t row_idx = start_row; row_idx < end_row; ++row_idx) {
+      if (build_key_filter_ != nullptr) {
+        key_buf.clear();
+        SerializeKeyColumnsRow(key_columns, key_data_types_, row_idx, &key_buf);
+        if (!build_key_filter_->Contains(key_buf)) {
+          probe_wrappers_chunk_[row_idx] = nullptr;
+          probe_matched_keys_chunk_[row_idx] = nullptr;
+          probe_match_rows_chunk_[row_idx] = 0;
+          continue;
+        }
+      }
+      const ColumnarRowKeyRef key_ref{&key_columns, &key_data_types_, row_idx,
+                                      key_hashes[row_idx]};
+      const auto& partition = BuildBufferPartition(key_ref.hash);
+      auto it = partition.find(key_ref);
+      if (it != partition.end()) {
+        probe_wrappers_chunk_[row_idx] = it->second.wrappers;
+        probe_matched_keys_chunk_[row_idx] = it->first;
+        probe_match_rows_chunk_[row_idx] = it->second.num_rows;
+      } else {
+        probe_wrappers_chunk_[row_idx] = nullptr;
+        probe_matched_keys_chunk_[row_idx] = nullptr;
+        probe_match_rows_chunk_[row_idx] = 0;
+      }
+    }
+  };
+
+  const int64_t num_threads =
+      std::min<int64_t>(FLAGS_carnot_equijoin_probe_threads, num_rows / kMinProbeRowsPerThread);
+  if (num_threads > 1) {
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    const int64_t rows_per_thread = (num_rows + num_threads - 1) / num_threads;
+    for (int64_t t = 0; t < num_threads; ++t) {
+      const int64_t start_row = t * rows_per_thread;
+      const int64_t end_row = std::min(num_rows, start_row + rows_per_thread);
+      workers.emplace_back(probe_rows, start_row, end_row);
+    }
+    for (auto& worker : workers) {
+      worker.join();
     }
+  } else {
+    probe_rows(0, num_rows);
   }
 
   auto rb_ptr = std::make_shared<RowBatch>(rb);
 
-  for (auto row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
+  // Emission phase: output chunking and the column builders are single-threaded state, so this
+  // stays on the execution thread.
+  for (int64_t row_idx = 0; row_idx < num_rows; ++row_idx) {
     if (queued_rows_ >= output_rows_per_batch_ - column_builders_[0]->length()) {
       PL_RETURN_IF_ERROR(FlushChunkedRows(exec_state));
     }
@@ -383,9 +551,11 @@ Status EquijoinNode::DoProbe(ExecState* exec_state, const table_store::schema::R
       continue;
     }
 
+    if (build_spec_.emit_unmatched_rows) {
+      probed_keys_.insert(probe_matched_keys_chunk_[row_idx]);
+    }
     PL_RETURN_IF_ERROR(MatchBuildValuesAndFlush(exec_state, probe_wrappers_chunk_[row_idx], rb_ptr,
-                                                row_idx,
-                                                build_buffer_rows_[join_keys_chunk_[row_idx]]));
+                                                row_idx, probe_match_rows_chunk_[row_idx]));
   }
 
   if (probe_eos_ && queued_rows_ > 0) {
@@ -396,12 +566,14 @@ Status EquijoinNode::DoProbe(ExecState* exec_state, const table_store::schema::R
 }
 
 Status EquijoinNode::EmitUnmatchedBuildRows(ExecState* exec_state) {
-  for (auto it = build_buffer_.begin(); it != build_buffer_.end(); ++it) {
-    if (probed_keys_.find(it->first) != probed_keys_.end()) {
-      continue;
+  for (auto& partition : build_buffer_partitions_) {
+    for (auto it = partition.begin(); it != partition.end(); ++it) {
+      if (probed_keys_.find(it->first) != probed_keys_.end()) {
+        continue;
+      }
+      PL_RETURN_IF_ERROR(MatchBuildValuesAndFlush(exec_state, it->second.wrappers, nullptr, 0,
+                                                  it->second.num_rows));
     }
-    PL_RETURN_IF_ERROR(MatchBuildValuesAndFlush(exec_state, it->second, nullptr, 0,
-                                                build_buffer_rows_[it->first]));
   }
 
   if (queued_rows_ > 0) {
@@ -410,16 +582,43 @@ Status EquijoinNode::EmitUnmatchedBuildRows(ExecState* exec_state) {
   return Status::OK();
 }
 
+Status EquijoinNode::BuildProbeKeyFilter() {
+  if (!FLAGS_carnot_equijoin_probe_bloom_filter) {
+    return Status::OK();
+  }
+  size_t num_keys = 0;
+  for (const auto& partition : build_buffer_partitions_) {
+    num_keys += partition.size();
+  }
+  if (num_keys == 0) {
+    // Nothing can match; the empty-partition lookups are already trivial.
+    return Status::OK();
+  }
+
+  PL_ASSIGN_OR_RETURN(build_key_filter_, bloomfilter::XXHash64BloomFilter::Create(
+                                             num_keys, kProbeKeyFilterErrorRate));
+  std::string key_buf;
+  for (const auto& partition : build_buffer_partitions_) {
+    for (const auto& kv : partition) {
+      key_buf.clear();
+      SerializeKeyTuple(*kv.first, key_data_types_, &key_buf);
+      build_key_filter_->Insert(key_buf);
+    }
+  }
+  return Status::OK();
+}
+
 Status EquijoinNode::ConsumeBuildBatch(ExecState* exec_state,
                                        const table_store::schema::RowBatch& rb) {
   if (rb.eos()) {
     build_eos_ = true;
   }
 
-  PL_RETURN_IF_ERROR(ExtractJoinKeysForBatch(rb, false));
+  PL_RETURN_IF_ERROR(ExtractJoinKeysForBatch(rb));
   PL_RETURN_IF_ERROR(HashRowBatch(rb));
 
   if (build_eos_) {
+    PL_RETURN_IF_ERROR(BuildProbeKeyFilter());
     while (probe_batches_.size()) {
       PL_RETURN_IF_ERROR(DoProbe(exec_state, probe_batches_.front()));
       probe_batches_.pop();
@@ -437,9 +636,184 @@ Status EquijoinNode::ConsumeProbeBatch(ExecState* exec_state,
   return DoProbe(exec_state, rb);
 }
 
+// Pops any fully consumed front batches and returns whether the side has an unconsumed row.
+bool EquijoinNode::SideHasRow(size_t parent_index) {
+  auto& side = merge_sides_[parent_index];
+  while (!side.batches.empty() && side.row_idx >= side.batches.front()->num_rows()) {
+    side.batches.pop_front();
+    side.row_idx = 0;
+  }
+  return !side.batches.empty();
+}
+
+EquijoinNode::MergeRowRef EquijoinNode::CurrentRow(size_t parent_index) {
+  const auto& side = merge_sides_[parent_index];
+  return MergeRowRef{side.batches.front().get(), side.row_idx};
+}
+
+// Collects the run of rows whose key equals the side's current key. Returns false if the run may
+// extend past the buffered input (i.e. the buffer ends mid-run and the side is not at eos), in
+// which case nothing is consumed and the merge waits for more input.
+bool EquijoinNode::GatherRun(size_t parent_index, std::vector<MergeRowRef>* run) {
+  run->clear();
+  const auto& side = merge_sides_[parent_index];
+  const int64_t key_idx = SideSpec(parent_index).key_indices[0];
+  const auto dt = key_data_types_[0];
+  const MergeRowRef first = CurrentRow(parent_index);
+  const arrow::Array* first_col = first.rb->ColumnAt(key_idx).get();
+
+  for (size_t batch_idx = 0; batch_idx < side.batches.size(); ++batch_idx) {
+    const RowBatch* rb = side.batches[batch_idx].get();
+    const arrow::Array* col = rb->ColumnAt(key_idx).get();
+    for (int64_t row = batch_idx == 0 ? side.row_idx : 0; row < rb->num_rows(); ++row) {
+      const int cmp = CompareKeys(dt, col, row, first_col, first.row);
+      DCHECK_GE(cmp, 0) << "Merge join input is not sorted on the join key";
+      if (cmp != 0) {
+        return true;
+      }
+      run->push_back(MergeRowRef{rb, row});
+    }
+  }
+  return side.eos;
+}
+
+void EquijoinNode::AdvanceSide(size_t parent_index, int64_t num_rows) {
+  auto& side = merge_sides_[parent_index];
+  while (num_rows > 0) {
+    DCHECK(!side.batches.empty());
+    const int64_t available = side.batches.front()->num_rows() - side.row_idx;
+    const int64_t step = std::min(available, num_rows);
+    side.row_idx += step;
+    num_rows -= step;
+    if (side.row_idx >= side.batches.front()->num_rows()) {
+      side.batches.pop_front();
+      side.row_idx = 0;
+    }
+  }
+}
+
+// Appends one output row built from the given left/right input rows. A null batch on either side
+// fills that side's output columns with default values, same as unmatched rows on the hash path.
+Status EquijoinNode::EmitMergedRow(ExecState* exec_state,
+                                   const table_store::schema::RowBatch* left_rb, int64_t left_row,
+                                   const table_store::schema::RowBatch* right_rb,
+                                   int64_t right_row) {
+  for (size_t parent = 0; parent < 2; ++parent) {
+    const TableSpec& spec = SideSpec(parent);
+    const RowBatch* rb = parent == 0 ? left_rb : right_rb;
+    const int64_t row = parent == 0 ? left_row : right_row;
+    for (size_t i = 0; i < spec.input_col_indices.size(); ++i) {
+      auto builder = column_builders_[spec.output_col_indices[i]].get();
+      const auto dt = output_descriptor_->type(spec.output_col_indices[i]);
+      if (rb == nullptr) {
+#define TYPE_CASE(_dt_) PL_RETURN_IF_ERROR(AppendColumnDefaultValue<_dt_>(builder, 1))
+        PL_SWITCH_FOREACH_DATATYPE(dt, TYPE_CASE);
+#undef TYPE_CASE
+      } else {
+        auto input_col = rb->ColumnAt(spec.input_col_indices[i]).get();
+#define TYPE_CASE(_dt_)                                    \
+  PL_RETURN_IF_ERROR(table_store::schema::CopyValue<_dt_>( \
+      builder, types::GetValueFromArrowArray<_dt_>(input_col, row)))
+        PL_SWITCH_FOREACH_DATATYPE(dt, TYPE_CASE);
+#undef TYPE_CASE
+      }
+    }
+  }
+
+  if (column_builders_[0]->length() >= output_rows_per_batch_) {
+    PL_RETURN_IF_ERROR(NextOutputBatch(exec_state));
+  }
+  return Status::OK();
+}
+
+// Merges as far as the buffered input allows. Since both inputs arrive sorted ascending on the
+// key, the side with the smaller current key can never match later rows of the other side, so it
+// is emitted (if its unmatched rows are kept) or dropped and the merge advances. Equal keys emit
+// the cross product of the two runs. Consumed batches are released immediately, so memory is
+// bounded by how far the two inputs are apart, not by the size of a build side.
+Status EquijoinNode::DoMerge(ExecState* exec_state) {
+  std::vector<MergeRowRef> left_run;
+  std::vector<MergeRowRef> right_run;
+  const auto dt = key_data_types_[0];
+
+  while (true) {
+    const bool left_has = SideHasRow(0);
+    const bool right_has = SideHasRow(1);
+    if (!left_has && !right_has) {
+      return Status::OK();
+    }
+    if (!left_has || !right_has) {
+      const size_t present = left_has ? 0 : 1;
+      if (!merge_sides_[1 - present].eos) {
+        // The drained side may still produce matching keys; wait for more input.
+        return Status::OK();
+      }
+      // The other side is exhausted, so every remaining row here is unmatched.
+      const auto row = CurrentRow(present);
+      if (SideSpec(present).emit_unmatched_rows) {
+        PL_RETURN_IF_ERROR(EmitMergedRow(exec_state, present == 0 ? row.rb : nullptr,
+                                         present == 0 ? row.row : 0,
+                                         present == 1 ? row.rb : nullptr,
+                                         present == 1 ? row.row : 0));
+      }
+      AdvanceSide(present, 1);
+      continue;
+    }
+
+    const auto left = CurrentRow(0);
+    const auto right = CurrentRow(1);
+    const int cmp = CompareKeys(dt, left.rb->ColumnAt(SideSpec(0).key_indices[0]).get(), left.row,
+                                right.rb->ColumnAt(SideSpec(1).key_indices[0]).get(), right.row);
+    if (cmp < 0) {
+      if (SideSpec(0).emit_unmatched_rows) {
+        PL_RETURN_IF_ERROR(EmitMergedRow(exec_state, left.rb, left.row, nullptr, 0));
+      }
+      AdvanceSide(0, 1);
+      continue;
+    }
+    if (cmp > 0) {
+      if (SideSpec(1).emit_unmatched_rows) {
+        PL_RETURN_IF_ERROR(EmitMergedRow(exec_state, nullptr, 0, right.rb, right.row));
+      }
+      AdvanceSide(1, 1);
+      continue;
+    }
+
+    // Keys are equal. Both runs must be complete before the cross product is emitted, since a
+    // later batch could extend either run.
+    if (!GatherRun(0, &left_run) || !GatherRun(1, &right_run)) {
+      return Status::OK();
+    }
+    for (const auto& l : left_run) {
+      for (const auto& r : right_run) {
+        PL_RETURN_IF_ERROR(EmitMergedRow(exec_state, l.rb, l.row, r.rb, r.row));
+      }
+    }
+    AdvanceSide(0, static_cast<int64_t>(left_run.size()));
+    AdvanceSide(1, static_cast<int64_t>(right_run.size()));
+  }
+}
+
+Status EquijoinNode::ConsumeMergeBatch(ExecState* exec_state,
+                                       const table_store::schema::RowBatch& rb,
+                                       size_t parent_index) {
+  auto& side = merge_sides_[parent_index];
+  DCHECK(!side.eos);
+  if (rb.eos()) {
+    side.eos = true;
+    (IsProbeTable(parent_index) ? probe_eos_ : build_eos_) = true;
+  }
+  if (rb.num_rows() > 0) {
+    side.batches.push_back(std::make_shared<RowBatch>(rb));
+  }
+  return DoMerge(exec_state);
+}
+
 Status EquijoinNode::ConsumeNextImpl(ExecState* exec_state, const table_store::schema::RowBatch& rb,
                                      size_t parent_index) {
-  if (IsProbeTable(parent_index)) {
+  if (merge_join_) {
+    PL_RETURN_IF_ERROR(ConsumeMergeBatch(exec_state, rb, parent_index));
+  } else if (IsProbeTable(parent_index)) {
     DCHECK(!probe_eos_);
     PL_RETURN_IF_ERROR(ConsumeProbeBatch(exec_state, rb));
   } else {
@@ -448,7 +822,8 @@ Status EquijoinNode::ConsumeNextImpl(ExecState* exec_state, const table_store::s
   }
 
   if (build_eos_ && probe_eos_) {
-    if (build_spec_.emit_unmatched_rows) {
+    // The merge path emits unmatched rows inline as the sweep passes them.
+    if (!merge_join_ && build_spec_.emit_unmatched_rows) {
       PL_RETURN_IF_ERROR(EmitUnmatchedBuildRows(exec_state));
     }
 
@@ -19,7 +19,9 @@
 #pragma once
 
 #include <arrow/array/builder_base.h>
+#include <array>
 #include <cstddef>
+#include <deque>
 #include <memory>
 #include <queue>
 #include <string>
@@ -35,6 +37,7 @@
 #include "src/common/base/base.h"
 #include "src/common/base/status.h"
 #include "src/common/memory/memory.h"
+#include "src/shared/bloomfilter/bloomfilter.h"
 #include "src/shared/types/column_wrapper.h"
 #include "src/shared/types/types.h"
 #include "src/table_store/table_store.h"
@@ -43,11 +46,16 @@ namespace px {
 namespace carnot {
 namespace exec {
 
-constexpr size_t kDefaultJoinRowBatchSize = 1024;
 
 class EquijoinNode : public ProcessingNode {
   enum class JoinInputTable { kLeftTable, kRightTable };
 
+  // The build side is radix-partitioned on the upper bits of the key hash into independent
+  // tables, mirroring AggNode: rehashes stay partition-local, and the probe lookup phase can
+  // fan out across worker threads without any shared-state writes.
+  static constexpr size_t kBuildBufferPartitionBits = 4;
+  static constexpr size_t kBuildBufferPartitions = 1 << kBuildBufferPartitionBits;
+
   struct TableSpec {
     bool emit_unmatched_rows;
     // Indices of the input columns for the keys.
@@ -77,7 +85,7 @@ class EquijoinNode : public ProcessingNode {
   Status InitializeColumnBuilders();
   bool IsProbeTable(size_t parent_index);
   Status FlushChunkedRows(ExecState* exec_state);
-  Status ExtractJoinKeysForBatch(const table_store::schema::RowBatch& rb, bool is_probe);
+  Status ExtractJoinKeysForBatch(const table_store::schema::RowBatch& rb);
   Status HashRowBatch(const table_store::schema::RowBatch& rb);
 
   Status DoProbe(ExecState* exec_state, const table_store::schema::RowBatch& rb);
@@ -90,8 +98,40 @@ class EquijoinNode : public ProcessingNode {
   Status ConsumeBuildBatch(ExecState* exec_state, const table_store::schema::RowBatch& rb);
   Status ConsumeProbeBatch(ExecState* exec_state, const table_store::schema::RowBatch& rb);
 
+  // A reference to one buffered input row during the merge join.
+  struct MergeRowRef {
+    const table_store::schema::RowBatch* rb;
+    int64_t row;
+  };
+
+  const TableSpec& SideSpec(size_t parent_index) {
+    return IsProbeTable(parent_index) ? probe_spec_ : build_spec_;
+  }
+  Status ConsumeMergeBatch(ExecState* exec_state, const table_store::schema::RowBatch& rb,
+                           size_t parent_index);
+  Status DoMerge(ExecState* exec_state);
+  bool SideHasRow(size_t parent_index);
+  MergeRowRef CurrentRow(size_t parent_index);
+  bool GatherRun(size_t parent_index, std::vector<MergeRowRef>* run);
+  void AdvanceSide(size_t parent_index, int64_t num_rows);
+  Status EmitMergedRow(ExecState* exec_state, const table_store::schema::RowBatch* left_rb,
+                       int64_t left_row, const table_store::schema::RowBatch* right_rb,
+                       int64_t right_row);
+
   bool build_eos_ = false;
   bool probe_eos_ = false;
+  // Whether this join runs as a streaming sort-merge join. Selected when the planner proves
+  // both inputs arrive sorted ascending on the single equality condition key; only the
+  // unconsumed tails of both inputs are buffered, instead of a whole build side.
+  bool merge_join_ = false;
+  // Buffered input per parent for the merge join, indexed by parent (0 = left, 1 = right).
+  struct MergeSideState {
+    std::deque<std::shared_ptr<table_store::schema::RowBatch>> batches;
+    // Position of the next unconsumed row within batches.front().
+    int64_t row_idx = 0;
+    bool eos = false;
+  };
+  std::array<MergeSideState, 2> merge_sides_;
   // Note whether the left or the right table is the probe table.
   JoinInputTable probe_table_;
   // output_rows_per_batch is only used in the ordered case, because in the unordered case,
@@ -139,15 +179,38 @@ class EquijoinNode : public ProcessingNode {
   std::vector<std::vector<types::SharedColumnWrapper>*> build_wrappers_chunk_;
 
   // Chunk of data to use when performing the probe stage of the join.
-  // This will store build table data from `build_buffer_`.
+  // This will store build table data from the build buffer.
   std::vector<std::vector<types::SharedColumnWrapper>*> probe_wrappers_chunk_;
-  AbslRowTupleHashMap<std::vector<types::SharedColumnWrapper>*> build_buffer_;
-  // Store the number of rows that match a given set of keys for the build buffer.
-  // This is necessary to store in addition to the values in `build_buffer_` in
-  // the event that no columns from the build side are emitted.
-  AbslRowTupleHashMap<int64_t> build_buffer_rows_;
-
-  // For joins where the build_buffer_ needs to emit any non-probed rows at the end of the join,
+  // The matched build-side key and row count for each probe row, filled alongside
+  // probe_wrappers_chunk_ by the (possibly parallel) lookup phase.
+  std::vector<RowTuple*> probe_matched_keys_chunk_;
+  std::vector<int64_t> probe_match_rows_chunk_;
+
+  // The column data and row count accumulated for one build-side key. The row count is needed
+  // in addition to the wrappers in the event that no columns from the build side are emitted.
+  struct BuildBufferValue {
+    std::vector<types::SharedColumnWrapper>* wrappers = nullptr;
+    int64_t num_rows = 0;
+  };
+  std::array<AbslRowTupleHashMap<BuildBufferValue>, kBuildBufferPartitions>
+      build_buffer_partitions_;
+
+  // Selects the partition for a key hash. The upper bits are used, since the table's internal
+  // probing is driven by the lower bits.
+  size_t PartitionIdx(size_t hash) const {
+    return hash >> (sizeof(size_t) * 8 - kBuildBufferPartitionBits);
+  }
+  AbslRowTupleHashMap<BuildBufferValue>& BuildBufferPartition(size_t hash) {
+    return build_buffer_partitions_[PartitionIdx(hash)];
+  }
+
+  // Bloom filter over the build-side join keys, built once the build side reaches eos. Probe
+  // rows that miss the filter are rejected before the hash-table lookup; since the filter has
+  // no false negatives this cannot drop a matching row.
+  Status BuildProbeKeyFilter();
+  std::unique_ptr<bloomfilter::XXHash64BloomFilter> build_key_filter_;
+
+  // For joins where the build buffer needs to emit any non-probed rows at the end of the join,
   // keep track of which ones they were.
   AbslRowTupleHashSet probed_keys_;
 
@@ -24,12 +24,17 @@
 #include <gtest/gtest.h>
 #include <sole.hpp>
 
+#include <vector>
+
 #include "src/carnot/exec/test_utils.h"
 #include "src/carnot/planpb/plan.pb.h"
 #include "src/carnot/planpb/test_proto.h"
 #include "src/carnot/udf/base.h"
 #include "src/carnot/udf/registry.h"
 
+DECLARE_bool(carnot_equijoin_probe_bloom_filter);
+DECLARE_int64(carnot_equijoin_probe_threads);
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -686,6 +691,239 @@ TEST_F(JoinNodeTest, unordered_many_matches) {
       .Close();
 }
 
+TEST_F(JoinNodeTest, parallel_probe_large_batch) {
+  // Large enough probe batch to fan the lookup phase out across worker threads.
+  const int64_t old_threads = FLAGS_carnot_equijoin_probe_threads;
+  FLAGS_carnot_equijoin_probe_threads = 3;
+
+  const char* proto = R"(
+    type: INNER
+    equality_conditions {
+      left_column_index: 0
+      right_column_index: 0
+    }
+    output_columns: {
+      parent_index: 0
+      column_index: 1
+    }
+    output_columns: {
+      parent_index: 1
+      column_index: 1
+    }
+    column_names: "left_val"
+    column_names: "right_val"
+    rows_per_batch: 4096
+  )";
+
+  auto plan_node = PlanNodeFromPbtxt(proto);
+  // Left (build)
+  RowDescriptor input_rd_0({types::DataType::INT64, types::DataType::INT64});
+  // Right (probe)
+  RowDescriptor input_rd_1({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  constexpr int64_t kNumRows = 4096;
+  std::vector<types::Int64Value> keys;
+  std::vector<types::Int64Value> left_vals;
+  std::vector<types::Int64Value> right_vals;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    keys.emplace_back(i);
+    left_vals.emplace_back(i + 10);
+    right_vals.emplace_back(2 * i);
+  }
+
+  auto tester = exec::ExecNodeTester<EquijoinNode, plan::JoinOperator>(
+      *plan_node, output_rd, {input_rd_0, input_rd_1}, exec_state_.get());
+
+  tester
+      // Build
+      .ConsumeNext(RowBatchBuilder(input_rd_0, kNumRows, true, true)
+                       .AddColumn<types::Int64Value>(keys)
+                       .AddColumn<types::Int64Value>(left_vals)
+                       .get(),
+                   0, 0)
+      // Probe: each row matches exactly one build row, in probe order.
+      .ConsumeNext(RowBatchBuilder(input_rd_1, kNumRows, true, true)
+                       .AddColumn<types::Int64Value>(keys)
+                       .AddColumn<types::Int64Value>(right_vals)
+                       .get(),
+                   1)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, kNumRows, true, true)
+                          .AddColumn<types::Int64Value>(left_vals)
+                          .AddColumn<types::Int64Value>(right_vals)
+                          .get())
+      .Close();
+
+  FLAGS_carnot_equijoin_probe_threads = old_threads;
+}
+
+TEST_F(JoinNodeTest, inner_join_without_probe_bloom_filter) {
+  // The bloom filter is on by default, so the remaining tests exercise the filtered path;
+  // this one covers the direct-lookup path.
+  const bool old_bloom = FLAGS_carnot_equijoin_probe_bloom_filter;
+  FLAGS_carnot_equijoin_probe_bloom_filter = false;
+
+  const char* proto = R"(
+    type: INNER
+    equality_conditions {
+      left_column_index: 0
+      right_column_index: 0
+    }
+    output_columns: {
+      parent_index: 0
+      column_index: 1
+    }
+    output_columns: {
+      parent_index: 1
+      column_index: 1
+    }
+    column_names: "left_val"
+    column_names: "right_val"
+    rows_per_batch: 10
+  )";
+
+  auto plan_node = PlanNodeFromPbtxt(proto);
+  RowDescriptor input_rd_0({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor input_rd_1({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<EquijoinNode, plan::JoinOperator>(
+      *plan_node, output_rd, {input_rd_0, input_rd_1}, exec_state_.get());
+
+  tester
+      // Build
+      .ConsumeNext(RowBatchBuilder(input_rd_0, 3, true, true)
+                       .AddColumn<types::Int64Value>({1, 2, 3})
+                       .AddColumn<types::Int64Value>({10, 20, 30})
+                       .get(),
+                   0, 0)
+      // Probe: keys 4 and 5 have no match and are dropped.
+      .ConsumeNext(RowBatchBuilder(input_rd_1, 4, true, true)
+                       .AddColumn<types::Int64Value>({2, 4, 1, 5})
+                       .AddColumn<types::Int64Value>({200, 400, 100, 500})
+                       .get(),
+                   1)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 2, true, true)
+                          .AddColumn<types::Int64Value>({20, 10})
+                          .AddColumn<types::Int64Value>({200, 100})
+                          .get())
+      .Close();
+
+  FLAGS_carnot_equijoin_probe_bloom_filter = old_bloom;
+}
+
+TEST_F(JoinNodeTest, sorted_inputs_merge_inner_join) {
+  // Both inputs arrive sorted ascending on the key, so the node runs a streaming merge join.
+  const char* proto = R"(
+    type: INNER
+    equality_conditions {
+      left_column_index: 0
+      right_column_index: 0
+    }
+    output_columns: {
+      parent_index: 0
+      column_index: 1
+    }
+    output_columns: {
+      parent_index: 1
+      column_index: 1
+    }
+    column_names: "left_val"
+    column_names: "right_val"
+    rows_per_batch: 10
+    sorted_inputs: true
+  )";
+
+  auto plan_node = PlanNodeFromPbtxt(proto);
+  RowDescriptor input_rd_0({types::DataType::INT64, types::DataType::FLOAT64});
+  RowDescriptor input_rd_1({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::FLOAT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<EquijoinNode, plan::JoinOperator>(
+      *plan_node, output_rd, {input_rd_0, input_rd_1}, exec_state_.get());
+
+  tester
+      // Left keys 1 and 4 wait for the right side; key 2 has a two-row run.
+      .ConsumeNext(RowBatchBuilder(input_rd_0, 4, false, false)
+                       .AddColumn<types::Int64Value>({1, 2, 2, 4})
+                       .AddColumn<types::Float64Value>({1.0, 2.0, 2.1, 4.0})
+                       .get(),
+                   0, 0)
+      // Right key 3 has no left match; the key-2 cross product can be emitted now, but
+      // nothing is sent downstream yet since rows_per_batch hasn't been reached.
+      .ConsumeNext(RowBatchBuilder(input_rd_1, 2, false, false)
+                       .AddColumn<types::Int64Value>({2, 3})
+                       .AddColumn<types::Int64Value>({20, 30})
+                       .get(),
+                   1, 0)
+      // The right run for key 4 ends at eos, but the left run may still grow, so the merge
+      // waits for the left side.
+      .ConsumeNext(RowBatchBuilder(input_rd_1, 2, true, true)
+                       .AddColumn<types::Int64Value>({4, 4})
+                       .AddColumn<types::Int64Value>({40, 41})
+                       .get(),
+                   1, 0)
+      // Left key 5 has no right match and the right side is exhausted, so it is dropped.
+      .ConsumeNext(RowBatchBuilder(input_rd_0, 1, true, true)
+                       .AddColumn<types::Int64Value>({5})
+                       .AddColumn<types::Float64Value>({5.0})
+                       .get(),
+                   0, 1)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 4, true, true)
+                          .AddColumn<types::Float64Value>({2.0, 2.1, 4.0, 4.0})
+                          .AddColumn<types::Int64Value>({20, 20, 40, 41})
+                          .get())
+      .Close();
+}
+
+TEST_F(JoinNodeTest, sorted_inputs_merge_left_join) {
+  const char* proto = R"(
+    type: LEFT_OUTER
+    equality_conditions {
+      left_column_index: 0
+      right_column_index: 0
+    }
+    output_columns: {
+      parent_index: 0
+      column_index: 1
+    }
+    output_columns: {
+      parent_index: 1
+      column_index: 1
+    }
+    column_names: "left_val"
+    column_names: "right_val"
+    rows_per_batch: 10
+    sorted_inputs: true
+  )";
+
+  auto plan_node = PlanNodeFromPbtxt(proto);
+  RowDescriptor input_rd_0({types::DataType::INT64, types::DataType::FLOAT64});
+  RowDescriptor input_rd_1({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::FLOAT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<EquijoinNode, plan::JoinOperator>(
+      *plan_node, output_rd, {input_rd_0, input_rd_1}, exec_state_.get());
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd_0, 3, true, true)
+                       .AddColumn<types::Int64Value>({1, 2, 5})
+                       .AddColumn<types::Float64Value>({1.0, 2.0, 5.0})
+                       .get(),
+                   0, 0)
+      .ConsumeNext(RowBatchBuilder(input_rd_1, 2, true, true)
+                       .AddColumn<types::Int64Value>({2, 3})
+                       .AddColumn<types::Int64Value>({20, 30})
+                       .get(),
+                   1, 1)
+      // Unmatched left rows are kept with default right values; unmatched right key 3 is dropped.
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 3, true, true)
+                          .AddColumn<types::Float64Value>({1.0, 2.0, 5.0})
+                          .AddColumn<types::Int64Value>({0, 20, 0})
+                          .get())
+      .Close();
+}
+
 }  // namespace exec
 }  // namespace carnot
 }  // namespace px
@@ -23,7 +23,11 @@
 #include <set>
 #include <unordered_map>
 
+#include <absl/strings/str_cat.h>
+#include <absl/strings/str_join.h>
+
 #include "src/carnot/exec/agg_node.h"
+#include "src/carnot/exec/distinct_node.h"
 #include "src/carnot/exec/empty_source_node.h"
 #include "src/carnot/exec/equijoin_node.h"
 #include "src/carnot/exec/exec_node.h"
@@ -32,11 +36,15 @@
 #include "src/carnot/exec/grpc_sink_node.h"
 #include "src/carnot/exec/grpc_source_node.h"
 #include "src/carnot/exec/limit_node.h"
+#include "src/carnot/exec/live_query_registry.h"
 #include "src/carnot/exec/map_node.h"
 #include "src/carnot/exec/memory_sink_node.h"
 #include "src/carnot/exec/memory_source_node.h"
 #include "src/carnot/exec/otel_export_sink_node.h"
+#include "src/carnot/exec/sample_node.h"
+#include "src/carnot/exec/top_n_node.h"
 #include "src/carnot/exec/udtf_source_node.h"
+#include "src/carnot/exec/window_agg_node.h"
 #include "src/carnot/exec/union_node.h"
 #include "src/carnot/plan/operators.h"
 #include "src/carnot/plan/plan_state.h"
@@ -70,10 +78,24 @@ Status ExecutionGraph::Init(table_store::schema::Schema* schema, plan::PlanState
         return OnOperatorImpl<plan::MemorySinkOperator, MemorySinkNode>(node, &descriptors);
       })
       .OnAggregate([&](auto& node) {
+        if (node.has_streaming_window()) {
+          return OnOperatorImpl<plan::AggregateOperator, WindowAggNode>(node, &descriptors);
+        }
+        if (!node.windowed() && node.values().empty() && !node.groups().empty()) {
+          // A group-by with no aggregate expressions is a distinct (df.drop_duplicates()-style
+          // dedup): stream it instead of running the blocking UDA machinery.
+          return OnOperatorImpl<plan::AggregateOperator, DistinctNode>(node, &descriptors);
+        }
         return OnOperatorImpl<plan::AggregateOperator, AggNode>(node, &descriptors);
       })
       .OnMemorySource([&](auto& node) {
-        return OnOperatorImpl<plan::MemorySourceOperator, MemorySourceNode>(node, &descriptors);
+        PL_RETURN_IF_ERROR(
+            OnOperatorImpl<plan::MemorySourceOperator, MemorySourceNode>(node, &descriptors));
+        // Wake the execution loop as soon as a batch lands in the source table, so streaming
+        // sources don't wait out the yield timeout (see YieldWithTimeout).
+        static_cast<MemorySourceNode*>(nodes_[node.id()])
+            ->SetBatchWakeupCallback(std::bind(&ExecutionGraph::Continue, this));
+        return Status::OK();
       })
       .OnFilter([&](auto& node) {
         return OnOperatorImpl<plan::FilterOperator, FilterNode>(node, &descriptors);
@@ -81,6 +103,12 @@ Status ExecutionGraph::Init(table_store::schema::Schema* schema, plan::PlanState
       .OnLimit([&](auto& node) {
         return OnOperatorImpl<plan::LimitOperator, LimitNode>(node, &descriptors);
       })
+      .OnTopN([&](auto& node) {
+        return OnOperatorImpl<plan::TopNOperator, TopNNode>(node, &descriptors);
+      })
+      .OnSample([&](auto& node) {
+        return OnOperatorImpl<plan::SampleOperator, SampleNode>(node, &descriptors);
+      })
       .OnUnion([&](auto& node) {
         return OnOperatorImpl<plan::UnionOperator, UnionNode>(node, &descriptors);
       })
@@ -217,7 +245,18 @@ Status ExecutionGraph::ExecuteSources() {
 
       // keep_running will be set to false when a downstream limit for this particular
       // source (set in exec_state) has been reached.
-      if (!source->HasBatchesRemaining() || !exec_state_->keep_running()) {
+      if (!exec_state_->keep_running()) {
+        // Actively stop the source so it releases table cursors and drops any row batches
+        // still streaming in from remote sinks, rather than just abandoning it.
+        auto s = source->Stop(exec_state_);
+        if (!s.ok()) {
+          LOG(ERROR) << absl::Substitute("Failed to stop source node $0: $1",
+                                         source->DebugString(), s.msg());
+        }
+        completed_sources_execute_loop.insert(source);
+        break;
+      }
+      if (!source->HasBatchesRemaining()) {
         completed_sources_execute_loop.insert(source);
         break;
       }
@@ -295,6 +334,10 @@ Status ExecutionGraph::ExecuteSources() {
 Status ExecutionGraph::Execute() {
   query_start_time_ = std::chrono::system_clock::now();
 
+  // Make this graph visible to live inspection for the duration of the execution.
+  LiveQueryRegistry::GetInstance().Register(exec_state_->query_id(), this);
+  DEFER(LiveQueryRegistry::GetInstance().Unregister(exec_state_->query_id(), this));
+
   // Get vector of nodes.
   std::vector<ExecNode*> nodes(nodes_.size());
   transform(nodes_.begin(), nodes_.end(), nodes.begin(), [](auto pair) { return pair.second; });
@@ -324,6 +367,11 @@ Status ExecutionGraph::Execute() {
     }
   }
 
+  VLOG(1) << absl::Substitute("Query $0 peak arrow allocation: $1 bytes ($2 still allocated)",
+                              exec_state_->query_id().str(),
+                              exec_state_->query_mem_pool()->max_memory(),
+                              exec_state_->query_mem_pool()->bytes_allocated());
+
   if (!source_status.ok()) {
     return source_status;
   }
@@ -346,6 +394,60 @@ ExecutionStats ExecutionGraph::GetStats() const {
   return ExecutionStats({bytes_processed, rows_processed});
 }
 
+std::vector<OperatorProfile> ExecutionGraph::SampleOperatorProfiles() const {
+  std::vector<OperatorProfile> profiles;
+  profiles.reserve(nodes_.size());
+  for (int64_t node_id : pf_->dag().TopologicalSort()) {
+    auto node_it = nodes_.find(node_id);
+    if (node_it == nodes_.end()) {
+      continue;
+    }
+    ExecNodeStats* stats = node_it->second->stats();
+
+    OperatorProfile profile;
+    profile.node_id = node_id;
+    profile.name = pf_->nodes().at(node_id)->DebugString();
+    profile.rows_input = stats->rows_input;
+    profile.rows_output = stats->rows_output;
+    profile.bytes_output = stats->bytes_output;
+    profile.batches_input = stats->batches_input;
+    profile.batches_output = stats->batches_output;
+    profile.self_time_ns = stats->SelfExecTime();
+    profile.peak_pool_bytes = stats->peak_pool_bytes;
+    profiles.push_back(std::move(profile));
+  }
+  return profiles;
+}
+
+std::string ExecutionGraph::FoldedStacks() const {
+  std::string out;
+  for (int64_t node_id : pf_->dag().TopologicalSort()) {
+    auto node_it = nodes_.find(node_id);
+    if (node_it == nodes_.end()) {
+      continue;
+    }
+
+    // Build the chain of upstream operators feeding this node, root (source) first.
+    std::vector<std::string> stack;
+    int64_t cur = node_id;
+    while (true) {
+      stack.push_back(absl::Substitute("$0 (id=$1)", pf_->nodes().at(cur)->DebugString(), cur));
+      auto parents = pf_->dag().ParentsOf(cur);
+      if (parents.empty()) {
+        break;
+      }
+      cur = parents[0];
+    }
+    std::reverse(stack.begin(), stack.end());
+
+    // Each operator appears exactly once, weighted by its self time, so the totals in the flame
+    // graph add up to the query's execution time.
+    int64_t self_time_us = node_it->second->stats()->SelfExecTime() / 1000;
+    absl::StrAppend(&out, absl::StrJoin(stack, ";"), " ", self_time_us, "\n");
+  }
+  return out;
+}
+
 }  // namespace exec
 }  // namespace carnot
 }  // namespace px
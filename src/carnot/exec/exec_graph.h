@@ -48,6 +48,22 @@ struct ExecutionStats {
   int64_t rows_processed;
 };
 
+/**
+ * A point-in-time sample of one operator's counters, taken while the query may still be running.
+ * Only populated meaningfully when the graph was initialized with collect_exec_node_stats.
+ */
+struct OperatorProfile {
+  int64_t node_id = 0;
+  std::string name;
+  int64_t rows_input = 0;
+  int64_t rows_output = 0;
+  int64_t bytes_output = 0;
+  int64_t batches_input = 0;
+  int64_t batches_output = 0;
+  int64_t self_time_ns = 0;
+  int64_t peak_pool_bytes = 0;
+};
+
 constexpr std::chrono::milliseconds kDefaultYieldTimeoutMS{1000};
 constexpr std::chrono::milliseconds kDefaultUpstreamResultConnectionTimeout{5000};
 constexpr int32_t kDefaultConsecutiveGenerateCallsPerSource = 10;
@@ -139,6 +155,21 @@ class ExecutionGraph {
 
   ExecutionStats GetStats() const;
 
+  /**
+   * Samples the per-operator counters of this graph, in topological order.
+   * Safe to call from another thread while the query executes: the counters are monotone and
+   * read without synchronization, so a sample may be slightly stale but never invalid.
+   */
+  std::vector<OperatorProfile> SampleOperatorProfiles() const;
+
+  /**
+   * Renders the graph in the collapsed stack format consumed by flame graph tooling: one
+   * "<source>;<op>;...;<this op> <self time us>" line per operator. The stack is the chain of
+   * upstream operators feeding each node (first parent on multi-parent operators), so the flame
+   * graph reads as data flowing from sources at the root to sinks at the leaves.
+   */
+  std::string FoldedStacks() const;
+
   void AddNode(int64_t id, ExecNode* node) {
     nodes_[id] = node;
     if (node->IsSource()) {
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -63,24 +64,37 @@ struct ExecNodeStats {
       return;
     }
     children_timer.Resume();
+    children_cpu_timer.Resume();
   }
   void StopChildTimer() {
     if (!collect_exec_stats) {
       return;
     }
     children_timer.Stop();
+    children_cpu_timer.Stop();
   }
   void ResumeTotalTimer() {
     if (!collect_exec_stats) {
       return;
     }
     total_timer.Resume();
+    total_cpu_timer.Resume();
   }
   void StopTotalTimer() {
     if (!collect_exec_stats) {
       return;
     }
     total_timer.Stop();
+    total_cpu_timer.Stop();
+  }
+
+  // Records the current memory pool usage; the peak across samples approximates this node's
+  // high-water pool footprint since samples are taken right after the node processes a batch.
+  void SamplePoolBytes(int64_t bytes) {
+    if (!collect_exec_stats) {
+      return;
+    }
+    peak_pool_bytes = std::max(peak_pool_bytes, bytes);
   }
 
   void AddExtraMetric(std::string_view key, double value) {
@@ -103,6 +117,10 @@ struct ExecNodeStats {
   int64_t TotalExecTime() const { return total_timer.ElapsedTime_us() * 1000; }
   int64_t SelfExecTime() const { return TotalExecTime() - ChildExecTime(); }
 
+  int64_t ChildCpuTime() const { return children_cpu_timer.ElapsedTime_us() * 1000; }
+  int64_t TotalCpuTime() const { return total_cpu_timer.ElapsedTime_us() * 1000; }
+  int64_t SelfCpuTime() const { return TotalCpuTime() - ChildCpuTime(); }
+
   // Total bytes input to this exec node.
   int64_t bytes_input = 0;
   // Total rows input to this exec node.
@@ -119,6 +137,12 @@ struct ExecNodeStats {
   ElapsedTimer total_timer;
   // Total timer for the children of the ndoe.
   ElapsedTimer children_timer;
+  // CPU-time equivalents of the wall timers above, so wait-heavy nodes (e.g. GRPC sources) can
+  // be told apart from compute-heavy ones.
+  ThreadCpuTimer total_cpu_timer;
+  ThreadCpuTimer children_cpu_timer;
+  // Peak memory pool usage observed while this node was processing, in bytes.
+  int64_t peak_pool_bytes = 0;
   // Flag to determine whether to collect stats or not.
   bool collect_exec_stats;
 
@@ -197,6 +221,7 @@ class ExecNode {
     stats_->ResumeTotalTimer();
     PL_RETURN_IF_ERROR(GenerateNextImpl(exec_state));
     stats_->StopTotalTimer();
+    stats_->SamplePoolBytes(exec_state->exec_mem_pool()->bytes_allocated());
     return Status::OK();
   }
 
@@ -222,6 +247,7 @@ class ExecNode {
     stats_->ResumeTotalTimer();
     PL_RETURN_IF_ERROR(ConsumeNextImpl(exec_state, rb, parent_index));
     stats_->StopTotalTimer();
+    stats_->SamplePoolBytes(exec_state->exec_mem_pool()->bytes_allocated());
     return Status::OK();
   }
 
@@ -367,6 +393,13 @@ class SourceNode : public ExecNode {
     return SendRowBatchToChildren(exec_state, *rb);
   }
 
+  /**
+   * Stop is called by the execution graph when downstream consumers no longer need this
+   * source's data (e.g. a limit has been satisfied), before Close. Sources should release any
+   * resources held for producing data and stop buffering upstream input.
+   */
+  virtual Status Stop(ExecState* /*exec_state*/) { return Status::OK(); }
+
  protected:
   int64_t rows_processed_ = 0;
   int64_t bytes_processed_ = 0;
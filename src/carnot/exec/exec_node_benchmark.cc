@@ -32,11 +32,23 @@
 #include "src/carnot/udf/udf.h"
 #include "src/common/base/base.h"
 #include "src/common/benchmark/benchmark.h"
+#include "src/common/perf/perf.h"
 #include "src/datagen/datagen.h"
 #include "src/shared/types/arrow_adapter.h"
 #include "src/shared/types/column_wrapper.h"
 #include "src/table_store/test_utils.h"
 
+// Consolidated benchmark suite for the exec nodes, parameterized over operator, batch size,
+// column mix and key cardinality. Each case runs a small query end to end through Carnot so the
+// measured node sees realistic batches from the memory source; the source and sink cost is
+// visible in the sink_only baseline below and can be subtracted out.
+//
+// Besides wall time, each case reports cycles, instructions, cache misses and branch misses per
+// iteration via perf_event (see src/common/perf/perf_counters.h), so regressions in IPC or
+// locality show up even when wall time is noisy. Record baselines as JSON with
+// --benchmark_out=<file> --benchmark_out_format=json and diff them with benchmark's
+// tools/compare.py.
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -44,6 +56,27 @@ namespace exec {
 using table_store::Table;
 using table_store::schema::RowDescriptor;
 
+// Source and sink only: the baseline cost of moving batches through the engine.
+constexpr char kSinkOnlyQuery[] = R"pxl(
+import px
+df = px.DataFrame(table='test_table', select=['col0', 'col1'])
+px.display(df, '$0')
+)pxl";
+
+constexpr char kMapQuery[] = R"pxl(
+import px
+df = px.DataFrame(table='test_table', select=['col0', 'col1'])
+df.sum = df.col0 + df.col1
+px.display(df, '$0')
+)pxl";
+
+constexpr char kFilterQuery[] = R"pxl(
+import px
+df = px.DataFrame(table='test_table', select=['col0', 'col1'])
+df = df[df.col0 > 500]
+px.display(df, '$0')
+)pxl";
+
 constexpr char kGroupByNoneQuery[] = R"pxl(
 import px
 df = px.DataFrame(table='test_table', select=['col0', 'col1'])
@@ -65,6 +98,24 @@ df = df.groupby(['col0', 'col1']).agg(sum=('col2', px.sum))
 px.display(df, '$0')
 )pxl";
 
+// Self-join on the key column; output width doubles, so the build and probe sides see the same
+// key distribution.
+constexpr char kJoinQuery[] = R"pxl(
+import px
+df1 = px.DataFrame(table='test_table', select=['col0', 'col1'])
+df2 = px.DataFrame(table='test_table', select=['col0', 'col1'])
+df = df1.merge(df2, how='inner', left_on='col0', right_on='col0', suffixes=['', '_x'])
+px.display(df, '$0')
+)pxl";
+
+constexpr char kUnionQuery[] = R"pxl(
+import px
+df1 = px.DataFrame(table='test_table', select=['col0', 'col1'])
+df2 = px.DataFrame(table='test_table', select=['col0', 'col1'])
+df = df1.append(df2)
+px.display(df, '$0')
+)pxl";
+
 std::unique_ptr<Carnot> SetUpCarnot(std::shared_ptr<table_store::TableStore> table_store,
                                     LocalGRPCResultSinkServer* server) {
   auto func_registry = std::make_unique<px::carnot::udf::Registry>("default_registry");
@@ -97,20 +148,33 @@ void BM_Query(benchmark::State& state, std::vector<types::DataType> types,
                    .ConsumeValueOrDie();
   table_store->AddTable("test_table", table);
 
+  PerfCounters counters;
   int64_t bytes_processed = 0;
   int i = 0;
+  counters.Start();
   for (auto _ : state) {
     auto queryWithTableName = absl::Substitute(query, "results_" + std::to_string(i));
     auto res = carnot->ExecuteQuery(queryWithTableName, sole::uuid4(), CurrentTimeNS());
     if (!res.ok()) {
-      LOG(FATAL) << "Aggregate benchmark query did not execute successfully.";
+      LOG(FATAL) << "Exec node benchmark query did not execute successfully.";
     }
     bytes_processed += server.exec_stats().ConsumeValueOrDie().execution_stats().bytes_processed();
     server.ResetQueryResults();
     ++i;
   }
+  auto stats = counters.End();
 
   state.SetBytesProcessed(int64_t(bytes_processed));
+  if (counters.available()) {
+    state.counters["cycles"] =
+        benchmark::Counter(static_cast<double>(stats.cycles), benchmark::Counter::kAvgIterations);
+    state.counters["instructions"] = benchmark::Counter(static_cast<double>(stats.instructions),
+                                                        benchmark::Counter::kAvgIterations);
+    state.counters["cache_misses"] = benchmark::Counter(static_cast<double>(stats.cache_misses),
+                                                        benchmark::Counter::kAvgIterations);
+    state.counters["branch_misses"] = benchmark::Counter(static_cast<double>(stats.branch_misses),
+                                                         benchmark::Counter::kAvgIterations);
+  }
 }
 
 // NOLINTNEXTLINE : runtime/references.
@@ -135,55 +199,48 @@ const std::unique_ptr<const datagen::DistributionParams> sample_selection_params
 const std::unique_ptr<const datagen::DistributionParams> sample_length_params =
     std::make_unique<const datagen::UniformParams>(0, 255);
 
-// TODO(philkuz) delete if this is a duplicate of L117.
-BENCHMARK_CAPTURE(BM_Query_String, eval_group_by_one_uniform_string,
-                  {types::DataType::STRING, types::DataType::INT64},
-                  {datagen::DistributionType::kZipfian, datagen::DistributionType::kUniform},
-                  kGroupByOneQuery, 20, sample_selection_params.get(), sample_length_params.get())
+// Baseline: memory source into result sink, no compute in between.
+BENCHMARK_CAPTURE(BM_Query_Int, sink_only, {types::DataType::INT64, types::DataType::INT64},
+                  {datagen::DistributionType::kUniform, datagen::DistributionType::kUniform},
+                  kSinkOnlyQuery, 20)
     ->RangeMultiplier(2)
     ->Range(1, 1 << 16);
 
-// Group By String Tests
-BENCHMARK_CAPTURE(BM_Query_String, eval_group_by_none_string,
-                  {types::DataType::STRING, types::DataType::INT64},
-                  {datagen::DistributionType::kZipfian, datagen::DistributionType::kUniform},
-                  kGroupByNoneQuery, 20, sample_selection_params.get(), sample_length_params.get())
+// Map / Filter over ints.
+BENCHMARK_CAPTURE(BM_Query_Int, map_int_add, {types::DataType::INT64, types::DataType::INT64},
+                  {datagen::DistributionType::kUniform, datagen::DistributionType::kUniform},
+                  kMapQuery, 20)
     ->RangeMultiplier(2)
     ->Range(1, 1 << 16);
 
-BENCHMARK_CAPTURE(BM_Query_String, eval_group_by_one_uniform_string,
-                  {types::DataType::STRING, types::DataType::INT64},
-                  {datagen::DistributionType::kZipfian, datagen::DistributionType::kUniform},
-                  kGroupByOneQuery, 20, sample_selection_params.get(), sample_length_params.get())
+BENCHMARK_CAPTURE(BM_Query_Int, filter_int_gt, {types::DataType::INT64, types::DataType::INT64},
+                  {datagen::DistributionType::kUniform, datagen::DistributionType::kUniform},
+                  kFilterQuery, 20)
     ->RangeMultiplier(2)
     ->Range(1, 1 << 16);
 
-// TODO(philkuz) fails in table.cc because batch size > table size.
-// BENCHMARK_CAPTURE(BM_Query_String, eval_group_by_one_uniform_string_two_data_cols,
-//                   {types::DataType::STRING, types::DataType::STRING, types::DataType::INT64},
-//                   {datagen::DistributionType::kZipfian, datagen::DistributionType::kUniform,
-//                    datagen::DistributionType::kUniform},
-//                   kGroupByTwoQuery, 20, sample_selection_params.get(),
-//                   sample_length_params.get())
-//     ->RangeMultiplier(2)
-//     ->Range(1, 1 << 16);
-
-// Group By Int Tests
-BENCHMARK_CAPTURE(BM_Query_Int, eval_group_by_none,
-                  {types::DataType::INT64, types::DataType::INT64},
+// Aggregates: no group, low-cardinality skewed string keys, and one or two uniform int keys.
+BENCHMARK_CAPTURE(BM_Query_Int, agg_group_by_none, {types::DataType::INT64, types::DataType::INT64},
                   {datagen::DistributionType::kUniform, datagen::DistributionType::kUniform},
                   kGroupByNoneQuery, 20)
     ->RangeMultiplier(2)
     ->Range(1, 1 << 16);
 
-BENCHMARK_CAPTURE(BM_Query_Int, eval_group_by_one_uniform_int,
+BENCHMARK_CAPTURE(BM_Query_String, agg_group_by_one_zipfian_string,
+                  {types::DataType::STRING, types::DataType::INT64},
+                  {datagen::DistributionType::kZipfian, datagen::DistributionType::kUniform},
+                  kGroupByOneQuery, 20, sample_selection_params.get(), sample_length_params.get())
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 16);
+
+BENCHMARK_CAPTURE(BM_Query_Int, agg_group_by_one_uniform_int,
                   {types::DataType::INT64, types::DataType::INT64},
                   {datagen::DistributionType::kUniform, datagen::DistributionType::kUniform},
                   kGroupByOneQuery, 20)
     ->RangeMultiplier(2)
     ->Range(1, 1 << 16);
 
-BENCHMARK_CAPTURE(BM_Query_Int, eval_group_by_two_uniform_ints,
+BENCHMARK_CAPTURE(BM_Query_Int, agg_group_by_two_uniform_ints,
                   {types::DataType::INT64, types::DataType::INT64, types::DataType::INT64},
                   {datagen::DistributionType::kUniform, datagen::DistributionType::kUniform,
                    datagen::DistributionType::kUniform},
@@ -191,13 +248,43 @@ BENCHMARK_CAPTURE(BM_Query_Int, eval_group_by_two_uniform_ints,
     ->RangeMultiplier(2)
     ->Range(1, 1 << 16);
 
-BENCHMARK_CAPTURE(BM_Query_Int, eval_group_by_one_exponential_int,
+BENCHMARK_CAPTURE(BM_Query_Int, agg_group_by_one_exponential_int,
                   {types::DataType::INT64, types::DataType::INT64},
                   {datagen::DistributionType::kExponential, datagen::DistributionType::kUniform},
                   kGroupByOneQuery, 20)
     ->RangeMultiplier(2)
     ->Range(1, 1 << 16);
 
+// Join on uniform and skewed int keys; the zipfian case stresses the probe side with hot keys.
+BENCHMARK_CAPTURE(BM_Query_Int, join_uniform_int_key,
+                  {types::DataType::INT64, types::DataType::INT64},
+                  {datagen::DistributionType::kUniform, datagen::DistributionType::kUniform},
+                  kJoinQuery, 20)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 16);
+
+BENCHMARK_CAPTURE(BM_Query_Int, join_exponential_int_key,
+                  {types::DataType::INT64, types::DataType::INT64},
+                  {datagen::DistributionType::kExponential, datagen::DistributionType::kUniform},
+                  kJoinQuery, 20)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 16);
+
+// Union of two readers over the same table.
+BENCHMARK_CAPTURE(BM_Query_Int, union_int, {types::DataType::INT64, types::DataType::INT64},
+                  {datagen::DistributionType::kUniform, datagen::DistributionType::kUniform},
+                  kUnionQuery, 20)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 16);
+
+// String column mix for the row-shape sensitive operators.
+BENCHMARK_CAPTURE(BM_Query_String, map_string_passthrough,
+                  {types::DataType::STRING, types::DataType::INT64},
+                  {datagen::DistributionType::kZipfian, datagen::DistributionType::kUniform},
+                  kSinkOnlyQuery, 20, sample_selection_params.get(), sample_length_params.get())
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 16);
+
 }  // namespace exec
 }  // namespace carnot
 }  // namespace px
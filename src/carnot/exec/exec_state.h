@@ -31,6 +31,7 @@
 #include "src/carnot/carnotpb/carnot.pb.h"
 #include "src/carnot/exec/grpc_router.h"
 #include "src/carnot/exec/ml/model_pool.h"
+#include "src/carnot/exec/query_memory_pool.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/base.h"
 #include "src/shared/metadata/metadata_state.h"
@@ -70,7 +71,8 @@ class ExecState {
       const MetricsStubGenerator& metrics_stub_generator,
       const TraceStubGenerator& trace_stub_generator, const sole::uuid& query_id,
       ml::ModelPool* model_pool, GRPCRouter* grpc_router = nullptr,
-      std::function<void(grpc::ClientContext*)> add_auth_func = [](grpc::ClientContext*) {})
+      std::function<void(grpc::ClientContext*)> add_auth_func = [](grpc::ClientContext*) {},
+      int64_t query_mem_limit_bytes = 0)
       : func_registry_(func_registry),
         table_store_(std::move(table_store)),
         stub_generator_(stub_generator),
@@ -79,17 +81,20 @@ class ExecState {
         query_id_(query_id),
         model_pool_(model_pool),
         grpc_router_(grpc_router),
-        add_auth_to_grpc_client_context_func_(add_auth_func) {}
+        add_auth_to_grpc_client_context_func_(add_auth_func),
+        query_mem_pool_(arrow::default_memory_pool(),
+                        query_mem_limit_bytes != 0 ? query_mem_limit_bytes
+                                                   : FLAGS_carnot_query_memory_limit_bytes) {}
 
   ~ExecState() {
     if (grpc_router_ != nullptr) {
       grpc_router_->DeleteQuery(query_id_);
     }
   }
-  arrow::MemoryPool* exec_mem_pool() {
-    // TOOD(zasgar): Make this the correct pool.
-    return arrow::default_memory_pool();
-  }
+  arrow::MemoryPool* exec_mem_pool() { return &query_mem_pool_; }
+
+  // Typed accessor for accounting (current/peak usage and the configured limit).
+  QueryMemoryPool* query_mem_pool() { return &query_mem_pool_; }
 
   udf::Registry* func_registry() { return func_registry_; }
 
@@ -211,6 +216,12 @@ class ExecState {
   GRPCRouter* grpc_router_ = nullptr;
   std::function<void(grpc::ClientContext*)> add_auth_to_grpc_client_context_func_;
 
+  // Per-query tracking pool backing all arrow allocations made for this query. Dies with the
+  // ExecState, so any remaining accounting is dropped wholesale at query end.
+  // The limit comes from the query scheduler's per-class memory quota when one is set, and from
+  // --carnot_query_memory_limit_bytes otherwise.
+  QueryMemoryPool query_mem_pool_;
+
   int64_t current_source_ = 0;
   bool current_source_set_ = false;
   std::map<int64_t, bool> source_id_to_keep_running_map_;
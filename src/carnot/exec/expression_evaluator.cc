@@ -25,7 +25,12 @@
 #include <cstdint>
 #include <iterator>
 #include <memory>
+#include <map>
+#include <optional>
 #include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <absl/strings/str_join.h>
@@ -37,6 +42,14 @@
 #include "src/shared/types/types.h"
 #include "src/shared/types/typespb/wrapper/types_pb_wrapper.h"
 
+DEFINE_int64(carnot_expr_eval_chunk_rows,
+             gflags::Int64FromEnv("PL_CARNOT_EXPR_EVAL_CHUNK_ROWS", 1024),
+             "The number of rows to evaluate at a time for nested scalar expressions, so that "
+             "intermediate results stay cache-resident. Set to 0 to disable chunked evaluation.");
+DEFINE_int64(carnot_expr_eval_threads, gflags::Int64FromEnv("PL_CARNOT_EXPR_EVAL_THREADS", 1),
+             "The maximum number of threads to use when evaluating a scalar expression over a "
+             "large row batch. The default of 1 evaluates on the execution thread.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -180,22 +193,246 @@ Status VectorNativeScalarExpressionEvaluator::Open(ExecState* exec_state) {
   for (auto expr : expressions_) {
     PL_RETURN_IF_ERROR(InitFuncsInExpression(exec_state, expr));
   }
+
+  // Fingerprint every sub-expression so that subtrees appearing more than once (within one
+  // expression or across the operator's expressions) are evaluated once per batch and shared.
+  node_fingerprints_.clear();
+  shared_fingerprints_.clear();
+  absl::flat_hash_map<std::string, int64_t> fingerprint_counts;
+  for (auto expr : expressions_) {
+    PL_RETURN_IF_ERROR(ComputeNodeFingerprints(expr, &fingerprint_counts));
+  }
+  for (const auto& [fingerprint, count] : fingerprint_counts) {
+    if (count > 1) {
+      shared_fingerprints_.insert(fingerprint);
+    }
+  }
   return Status::OK();
 }
 
+Status VectorNativeScalarExpressionEvaluator::ComputeNodeFingerprints(
+    std::shared_ptr<const plan::ScalarExpression> expr,
+    absl::flat_hash_map<std::string, int64_t>* fingerprint_counts) {
+  plan::ExpressionWalker<std::string> walker;
+  walker.OnScalarValue(
+      [&](const plan::ScalarValue& val, const std::vector<std::string>&) -> std::string {
+        auto fingerprint = absl::Substitute("v<$0:$1>", val.DataType(), val.DebugString());
+        node_fingerprints_[&val] = fingerprint;
+        (*fingerprint_counts)[fingerprint]++;
+        return fingerprint;
+      });
+  walker.OnColumn([&](const plan::Column& col, const std::vector<std::string>&) -> std::string {
+    auto fingerprint = absl::Substitute("c<$0:$1>", col.NodeID(), col.Index());
+    node_fingerprints_[&col] = fingerprint;
+    (*fingerprint_counts)[fingerprint]++;
+    return fingerprint;
+  });
+  walker.OnScalarFunc(
+      [&](const plan::ScalarFunc& fn, const std::vector<std::string>& children) -> std::string {
+        // The udf_id alone identifies the UDF and its argument types, but not its init
+        // arguments, so those are part of the fingerprint as well.
+        std::vector<std::string> init_args;
+        for (const auto& init_arg : fn.init_arguments()) {
+          init_args.push_back(init_arg.DebugString());
+        }
+        auto fingerprint = absl::Substitute("f<$0>[$1]($2)", fn.udf_id(),
+                                            absl::StrJoin(init_args, ","),
+                                            absl::StrJoin(children, ","));
+        node_fingerprints_[&fn] = fingerprint;
+        (*fingerprint_counts)[fingerprint]++;
+        return fingerprint;
+      });
+  PL_RETURN_IF_ERROR(walker.Walk(*expr));
+  return Status::OK();
+}
+
+Status VectorNativeScalarExpressionEvaluator::Evaluate(ExecState* exec_state, const RowBatch& input,
+                                                       RowBatch* output) {
+  // Scope the sub-expression cache to this batch, shared across all of its expressions.
+  subexpr_cache_.clear();
+  batch_cache_active_ = true;
+  auto status = ScalarExpressionEvaluator::Evaluate(exec_state, input, output);
+  batch_cache_active_ = false;
+  subexpr_cache_.clear();
+  return status;
+}
+
 Status VectorNativeScalarExpressionEvaluator::Close(ExecState*) {
   // Nothing here yet.
   return Status();
 }
 
+namespace {
+
+// Expressions over fewer rows than this per thread are not worth parallelizing.
+constexpr int64_t kMinExprRowsPerThread = 4096;
+
+// Returns the maximum nesting depth of scalar funcs in the expression. Column and constant
+// leaves have depth 0, so `a + b` has depth 1 and `a * b + c` has depth 2.
+StatusOr<int64_t> FuncNestingDepth(const plan::ScalarExpression& expr) {
+  plan::ExpressionWalker<int64_t> walker;
+  walker.OnScalarValue([](const auto&, const auto&) -> int64_t { return 0; });
+  walker.OnColumn([](const auto&, const auto&) -> int64_t { return 0; });
+  walker.OnScalarFunc([](const plan::ScalarFunc&, const std::vector<int64_t>& children) -> int64_t {
+    int64_t max_child = 0;
+    for (int64_t child : children) {
+      max_child = std::max(max_child, child);
+    }
+    return max_child + 1;
+  });
+  return walker.Walk(expr);
+}
+
+}  // namespace
+
 StatusOr<types::SharedColumnWrapper>
 VectorNativeScalarExpressionEvaluator::EvaluateSingleExpression(
     ExecState* exec_state, const RowBatch& input, const plan::ScalarExpression& expr) {
   CHECK(exec_state != nullptr);
   CHECK_GT(input.num_columns(), 0);
 
+  // When called outside of Evaluate() (e.g. by FilterNode), the sub-expression cache is scoped
+  // to this one call.
+  if (!batch_cache_active_) {
+    subexpr_cache_.clear();
+  }
+
+  int64_t num_rows = input.num_rows();
+  int64_t chunk_rows = FLAGS_carnot_expr_eval_chunk_rows;
+
+  PL_ASSIGN_OR_RETURN(int64_t nesting_depth, FuncNestingDepth(expr));
+
+  // Batch-level parallelism for expressions with funcs over large batches. Each worker gets its
+  // own UDF instances and evaluates a contiguous row range; results are stitched together in
+  // order. Workers bypass the sub-expression cache, which is not thread-safe.
+  int64_t num_threads = std::min(FLAGS_carnot_expr_eval_threads, num_rows / kMinExprRowsPerThread);
+  if (nesting_depth >= 1 && num_threads > 1) {
+    std::vector<std::map<int64_t, std::unique_ptr<udf::ScalarUDF>>> worker_udf_maps(num_threads);
+    for (auto& udf_map : worker_udf_maps) {
+      PL_RETURN_IF_ERROR(MakeWorkerUDFMap(exec_state, expr, &udf_map));
+    }
+
+    auto eval_range = [&](int64_t start, int64_t end,
+                          std::map<int64_t, std::unique_ptr<udf::ScalarUDF>>* udf_map)
+        -> StatusOr<types::SharedColumnWrapper> {
+      int64_t step =
+          (nesting_depth > 1 && chunk_rows > 0) ? std::min(chunk_rows, end - start) : end - start;
+      types::SharedColumnWrapper range_result;
+      for (int64_t offset = start; offset < end; offset += step) {
+        int64_t length = std::min(step, end - offset);
+        PL_ASSIGN_OR_RETURN(auto chunk, input.Slice(offset, length));
+        PL_ASSIGN_OR_RETURN(auto chunk_result,
+                            EvaluateExpressionTree(exec_state, *chunk, expr, offset, udf_map,
+                                                   /* use_cache */ false));
+        if (range_result == nullptr) {
+          range_result = chunk_result;
+          range_result->Reserve(end - start);
+        } else {
+          range_result->AppendFrom(*chunk_result);
+        }
+      }
+      return range_result;
+    };
+
+    std::vector<Status> worker_statuses(num_threads);
+    std::vector<types::SharedColumnWrapper> worker_results(num_threads);
+    int64_t rows_per_thread = (num_rows + num_threads - 1) / num_threads;
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (int64_t i = 0; i < num_threads; ++i) {
+      int64_t start = i * rows_per_thread;
+      int64_t end = std::min(num_rows, start + rows_per_thread);
+      workers.emplace_back([&, i, start, end]() {
+        auto res = eval_range(start, end, &worker_udf_maps[i]);
+        if (!res.ok()) {
+          worker_statuses[i] = res.status();
+        } else {
+          worker_results[i] = res.ConsumeValueOrDie();
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    for (const auto& status : worker_statuses) {
+      PL_RETURN_IF_ERROR(status);
+    }
+
+    auto result = worker_results[0];
+    result->Reserve(num_rows);
+    for (int64_t i = 1; i < num_threads; ++i) {
+      result->AppendFrom(*worker_results[i]);
+    }
+    return result;
+  }
+
+  // Nested expressions (`a*b+c > d` style) materialize one intermediate column per
+  // sub-expression. Evaluating such trees a chunk of rows at a time keeps the intermediates
+  // sized to the chunk, so they stay cache-resident instead of costing a full column
+  // allocation per operator per batch.
+  if (nesting_depth > 1 && chunk_rows > 0 && num_rows > chunk_rows) {
+    PL_ASSIGN_OR_RETURN(auto first_chunk, input.Slice(0, chunk_rows));
+    PL_ASSIGN_OR_RETURN(auto result, EvaluateExpressionTree(exec_state, *first_chunk, expr, 0,
+                                                            &id_to_udf_map_, /* use_cache */ true));
+    result->Reserve(num_rows);
+    for (int64_t offset = chunk_rows; offset < num_rows; offset += chunk_rows) {
+      int64_t length = std::min(chunk_rows, num_rows - offset);
+      PL_ASSIGN_OR_RETURN(auto chunk, input.Slice(offset, length));
+      PL_ASSIGN_OR_RETURN(auto chunk_result,
+                          EvaluateExpressionTree(exec_state, *chunk, expr, offset, &id_to_udf_map_,
+                                                 /* use_cache */ true));
+      result->AppendFrom(*chunk_result);
+    }
+    return result;
+  }
+
+  return EvaluateExpressionTree(exec_state, input, expr, 0, &id_to_udf_map_, /* use_cache */ true);
+}
+
+Status VectorNativeScalarExpressionEvaluator::MakeWorkerUDFMap(
+    ExecState* exec_state, const plan::ScalarExpression& expr,
+    std::map<int64_t, std::unique_ptr<udf::ScalarUDF>>* udf_map) {
+  plan::ExpressionWalker<bool> walker;
+  walker.OnScalarValue([](auto, auto) -> bool { return true; });
+  walker.OnColumn([](auto, auto) -> bool { return true; });
+  walker.OnScalarFunc([&](const plan::ScalarFunc& fn, const std::vector<bool>&) -> bool {
+    if (udf_map->count(fn.udf_id()) > 0) {
+      return true;
+    }
+    auto def = exec_state->GetScalarUDFDefinition(fn.udf_id());
+    auto udf = def->Make();
+
+    std::vector<std::shared_ptr<types::BaseValueType>> init_args;
+    for (const auto& scalar_val : fn.init_arguments()) {
+      init_args.push_back(scalar_val.ToBaseValueType());
+    }
+    PL_CHECK_OK(def->ExecInit(udf.get(), function_ctx_, init_args));
+    (*udf_map)[fn.udf_id()] = std::move(udf);
+    return true;
+  });
+  PL_RETURN_IF_ERROR(walker.Walk(expr));
+  return Status::OK();
+}
+
+StatusOr<types::SharedColumnWrapper> VectorNativeScalarExpressionEvaluator::EvaluateExpressionTree(
+    ExecState* exec_state, const RowBatch& input, const plan::ScalarExpression& expr,
+    int64_t chunk_offset, std::map<int64_t, std::unique_ptr<udf::ScalarUDF>>* udf_map,
+    bool use_cache) {
   size_t num_rows = input.num_rows();
 
+  // Cache key for sub-expressions that occur more than once. The chunk offset and length scope
+  // the entry to this exact slice of the batch.
+  auto cache_key = [&](const plan::ScalarExpression* node) -> std::optional<std::string> {
+    if (!use_cache) {
+      return std::nullopt;
+    }
+    auto it = node_fingerprints_.find(node);
+    if (it == node_fingerprints_.end() || !shared_fingerprints_.contains(it->second)) {
+      return std::nullopt;
+    }
+    return absl::Substitute("$0@$1:$2", it->second, chunk_offset, num_rows);
+  };
+
   // Path for scalar funcs an their dependencies to get evaluated.
   // The Arrow arrays are converted to type erased column wrappers
   // and then evaluated.
@@ -211,12 +448,31 @@ VectorNativeScalarExpressionEvaluator::EvaluateSingleExpression(
       [&](const plan::Column& col,
           const std::vector<types::SharedColumnWrapper>& children) -> types::SharedColumnWrapper {
         DCHECK_EQ(children.size(), 0ULL);
-        return ColumnWrapper::FromArrow(input.ColumnAt(col.Index()));
+        auto key = cache_key(&col);
+        if (key.has_value()) {
+          auto cached = subexpr_cache_.find(*key);
+          if (cached != subexpr_cache_.end()) {
+            return cached->second;
+          }
+        }
+        auto output = ColumnWrapper::FromArrow(input.ColumnAt(col.Index()));
+        if (key.has_value()) {
+          subexpr_cache_[*key] = output;
+        }
+        return output;
       });
 
   walker.OnScalarFunc(
       [&](const plan::ScalarFunc& fn,
           const std::vector<types::SharedColumnWrapper>& children) -> types::SharedColumnWrapper {
+        auto key = cache_key(&fn);
+        if (key.has_value()) {
+          auto cached = subexpr_cache_.find(*key);
+          if (cached != subexpr_cache_.end()) {
+            return cached->second;
+          }
+        }
+
         std::vector<types::DataType> arg_types;
         arg_types.reserve(children.size());
         for (const auto& child : children) {
@@ -224,7 +480,7 @@ VectorNativeScalarExpressionEvaluator::EvaluateSingleExpression(
         }
 
         auto def = exec_state->GetScalarUDFDefinition(fn.udf_id());
-        auto udf = id_to_udf_map_[fn.udf_id()].get();
+        auto udf = (*udf_map)[fn.udf_id()].get();
 
         std::vector<const types::ColumnWrapper*> raw_children;
         raw_children.reserve(children.size());
@@ -234,6 +490,9 @@ VectorNativeScalarExpressionEvaluator::EvaluateSingleExpression(
         auto output = types::ColumnWrapper::Make(def->exec_return_type(), num_rows);
         // TODO(zasgar): need a better way to handle errors.
         PL_CHECK_OK(def->ExecBatch(udf, function_ctx_, raw_children, output.get(), num_rows));
+        if (key.has_value()) {
+          subexpr_cache_[*key] = output;
+        }
         return output;
       });
 
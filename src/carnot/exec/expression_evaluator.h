@@ -26,6 +26,9 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
 #include "src/carnot/exec/exec_state.h"
 #include "src/carnot/plan/scalar_expression.h"
 #include "src/carnot/udf/base.h"
@@ -141,6 +144,9 @@ class VectorNativeScalarExpressionEvaluator : public ScalarExpressionEvaluator {
   Status Open(ExecState* exec_state) override;
   Status Close(ExecState* exec_state) override;
 
+  Status Evaluate(ExecState* exec_state, const table_store::schema::RowBatch& input,
+                  table_store::schema::RowBatch* output) override;
+
   StatusOr<types::SharedColumnWrapper> EvaluateSingleExpression(
       ExecState* exec_state, const table_store::schema::RowBatch& input,
       const plan::ScalarExpression& expr);
@@ -149,6 +155,36 @@ class VectorNativeScalarExpressionEvaluator : public ScalarExpressionEvaluator {
   Status EvaluateSingleExpression(ExecState* exec_state, const table_store::schema::RowBatch& input,
                                   const plan::ScalarExpression& expr,
                                   table_store::schema::RowBatch* output) override;
+
+ private:
+  // Walks the expression tree once over all rows of input, materializing one intermediate
+  // column wrapper per sub-expression. `chunk_offset` is the offset of `input` within the full
+  // batch being evaluated; it scopes sub-expression cache entries to the chunk. UDF instances
+  // are taken from `udf_map` so that parallel workers can use their own instances; only the
+  // serial path may use the sub-expression cache.
+  StatusOr<types::SharedColumnWrapper> EvaluateExpressionTree(
+      ExecState* exec_state, const table_store::schema::RowBatch& input,
+      const plan::ScalarExpression& expr, int64_t chunk_offset,
+      std::map<int64_t, std::unique_ptr<udf::ScalarUDF>>* udf_map, bool use_cache);
+
+  // Creates and initializes a fresh set of UDF instances for the funcs in expr, for use by one
+  // worker thread.
+  Status MakeWorkerUDFMap(ExecState* exec_state, const plan::ScalarExpression& expr,
+                          std::map<int64_t, std::unique_ptr<udf::ScalarUDF>>* udf_map);
+
+  // Records the fingerprint of every sub-expression node in expressions_, and the set of
+  // fingerprints that occur more than once (shared subtrees worth caching).
+  Status ComputeNodeFingerprints(std::shared_ptr<const plan::ScalarExpression> expr,
+                                 absl::flat_hash_map<std::string, int64_t>* fingerprint_counts);
+
+  absl::flat_hash_map<const plan::ScalarExpression*, std::string> node_fingerprints_;
+  absl::flat_hash_set<std::string> shared_fingerprints_;
+
+  // Evaluated shared sub-expressions for the current row batch, keyed by fingerprint and chunk
+  // offset. Valid for one batch; cleared by Evaluate()/EvaluateSingleExpression().
+  absl::flat_hash_map<std::string, types::SharedColumnWrapper> subexpr_cache_;
+  // True while Evaluate() owns the cache across all of the batch's expressions.
+  bool batch_cache_active_ = false;
 };
 
 /**
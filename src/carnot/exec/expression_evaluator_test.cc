@@ -38,6 +38,9 @@
 #include "src/shared/types/arrow_adapter.h"
 #include "src/shared/types/types.h"
 
+DECLARE_int64(carnot_expr_eval_chunk_rows);
+DECLARE_int64(carnot_expr_eval_threads);
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -60,6 +63,16 @@ class AddUDF : public udf::ScalarUDF {
   }
 };
 
+class CountingAddUDF : public udf::ScalarUDF {
+ public:
+  types::Int64Value Exec(FunctionContext*, types::Int64Value v1, types::Int64Value v2) {
+    ++exec_count;
+    return v1.val + v2.val;
+  }
+  static int64_t exec_count;
+};
+int64_t CountingAddUDF::exec_count = 0;
+
 class InitArgUDF : public udf::ScalarUDF {
  public:
   Status Init(FunctionContext*, types::StringValue str, types::Int64Value i) {
@@ -218,6 +231,63 @@ TEST_P(ScalarExpressionTest, eval_add_nested) {
   EXPECT_EQ(1345, casted->Value(2));
 }
 
+TEST_P(ScalarExpressionTest, eval_add_nested_chunked) {
+  // Force the batch to be evaluated in chunks smaller than the batch size, so the nested
+  // expression's intermediates are materialized per-chunk rather than per-batch.
+  int64_t prev_chunk_rows = FLAGS_carnot_expr_eval_chunk_rows;
+  FLAGS_carnot_expr_eval_chunk_rows = 2;
+
+  RowDescriptor rd_output({types::DataType::INT64});
+  RowBatch output_rb(rd_output, input_rb_->num_rows());
+
+  auto se = ScalarExpressionOf(kAddScalarFuncNestedPbtxt);
+  RunEvaluator({se}, &output_rb);
+
+  auto out_col = output_rb.ColumnAt(0);
+  EXPECT_EQ(3, out_col->length());
+  auto casted = static_cast<arrow::Int64Array*>(out_col.get());
+  EXPECT_EQ(1341, casted->Value(0));
+  EXPECT_EQ(1343, casted->Value(1));
+  EXPECT_EQ(1345, casted->Value(2));
+
+  FLAGS_carnot_expr_eval_chunk_rows = prev_chunk_rows;
+}
+
+TEST_P(ScalarExpressionTest, eval_add_parallel) {
+  int64_t prev_threads = FLAGS_carnot_expr_eval_threads;
+  FLAGS_carnot_expr_eval_threads = 2;
+
+  // Large enough for the vector-native evaluator to split the batch across worker threads.
+  constexpr int64_t kNumRows = 16384;
+  std::vector<types::Int64Value> in1(kNumRows);
+  std::vector<types::Int64Value> in2(kNumRows);
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    in1[i] = i;
+    in2[i] = 2 * i;
+  }
+  RowDescriptor rd({types::DataType::INT64, types::DataType::INT64, types::DataType::STRING});
+  input_rb_ = std::make_unique<RowBatch>(rd, kNumRows);
+  EXPECT_OK(input_rb_->AddColumn(ToArrow(in1, arrow::default_memory_pool())));
+  EXPECT_OK(input_rb_->AddColumn(ToArrow(in2, arrow::default_memory_pool())));
+  EXPECT_OK(input_rb_->AddColumn(
+      ToArrow(std::vector<types::StringValue>(kNumRows, "x"), arrow::default_memory_pool())));
+
+  RowDescriptor rd_output({types::DataType::INT64});
+  RowBatch output_rb(rd_output, kNumRows);
+
+  auto se = AddScalarExpr();
+  RunEvaluator({se}, &output_rb);
+
+  auto out_col = output_rb.ColumnAt(0);
+  EXPECT_EQ(kNumRows, out_col->length());
+  auto casted = static_cast<arrow::Int64Array*>(out_col.get());
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    ASSERT_EQ(3 * i, casted->Value(i));
+  }
+
+  FLAGS_carnot_expr_eval_threads = prev_threads;
+}
+
 TEST_P(ScalarExpressionTest, eval_uint128_constant) {
   RowDescriptor rd_output({types::DataType::UINT128});
   RowBatch output_rb(rd_output, input_rb_->num_rows());
@@ -233,6 +303,57 @@ TEST_P(ScalarExpressionTest, eval_uint128_constant) {
   EXPECT_EQ(types::UInt128Value(123, 456), casted->Value(2));
 }
 
+constexpr char kCountingAddScalarFuncPbtxt[] = R"(
+func {
+  name: "counting_add"
+  id: 2
+  args {
+    column {
+      node: 0
+      index: 0
+    }
+  }
+  args {
+    column {
+      node: 0
+      index: 1
+    }
+  }
+  args_data_types: INT64
+  args_data_types: INT64
+})";
+
+TEST_P(ScalarExpressionTest, shared_subexpression_evaluated_once) {
+  EXPECT_OK(func_registry_->Register<CountingAddUDF>("counting_add"));
+  EXPECT_OK(exec_state_->AddScalarUDF(
+      2, "counting_add",
+      std::vector<types::DataType>({types::DataType::INT64, types::DataType::INT64})));
+
+  RowDescriptor rd_output({types::DataType::INT64, types::DataType::INT64});
+  RowBatch output_rb(rd_output, input_rb_->num_rows());
+
+  auto se = ScalarExpressionOf(kCountingAddScalarFuncPbtxt);
+  CountingAddUDF::exec_count = 0;
+  RunEvaluator({se, se}, &output_rb);
+
+  for (int64_t col_idx = 0; col_idx < 2; ++col_idx) {
+    auto out_col = output_rb.ColumnAt(col_idx);
+    EXPECT_EQ(3, out_col->length());
+    auto casted = static_cast<arrow::Int64Array*>(out_col.get());
+    EXPECT_EQ(4, casted->Value(0));
+    EXPECT_EQ(6, casted->Value(1));
+    EXPECT_EQ(8, casted->Value(2));
+  }
+
+  // The vector-native evaluator shares the result of identical expressions within a batch; the
+  // arrow-native evaluator evaluates each one independently.
+  if (GetParam() == ScalarExpressionEvaluatorType::kVectorNative) {
+    EXPECT_EQ(3, CountingAddUDF::exec_count);
+  } else {
+    EXPECT_EQ(6, CountingAddUDF::exec_count);
+  }
+}
+
 constexpr char kInitArgScalarFunc[] = R"pb(
 func {
   name: "init_arg"
@@ -144,24 +144,57 @@ Status FilterNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb, si
 
   DCHECK_EQ(static_cast<size_t>(rb.num_rows()), num_pred);
 
-  // Find out how many of them returned true;
+  // Find out how many of them returned true, and whether the surviving rows form a single
+  // contiguous run (common for predicates over sorted data, such as time ranges).
   size_t num_output_records = 0;
+  int64_t first_match = -1;
+  int64_t last_match = -1;
   for (size_t i = 0; i < num_pred; ++i) {
     if (pred_col_wrapper[i].val) {
+      if (num_output_records == 0) {
+        first_match = i;
+      }
+      last_match = i;
       ++num_output_records;
     }
   }
+  const bool contiguous_match =
+      num_output_records > 0 &&
+      static_cast<size_t>(last_match - first_match + 1) == num_output_records;
 
   RowBatch output_rb(*output_descriptor_, num_output_records);
   DCHECK_EQ(output_descriptor_->size(), plan_node_->selected_cols().size());
 
-  for (const auto& [output_col_idx, input_col_idx] : Enumerate(plan_node_->selected_cols())) {
-    auto input_col = rb.ColumnAt(input_col_idx);
-    auto col_type = output_descriptor_->type(output_col_idx);
+  if (num_output_records == static_cast<size_t>(rb.num_rows())) {
+    // Every row survived: forward the selected columns without copying.
+    for (int64_t input_col_idx : plan_node_->selected_cols()) {
+      PL_RETURN_IF_ERROR(output_rb.AddColumn(rb.ColumnAt(input_col_idx)));
+    }
+  } else if (num_output_records == 0) {
+    // No rows survived: emit empty columns without re-scanning the predicate per column.
+    for (const auto& [output_col_idx, input_col_idx] : Enumerate(plan_node_->selected_cols())) {
+      PL_UNUSED(input_col_idx);
+      auto builder =
+          MakeArrowBuilder(output_descriptor_->type(output_col_idx), arrow::default_memory_pool());
+      std::shared_ptr<arrow::Array> empty_col;
+      PL_RETURN_IF_ERROR(builder->Finish(&empty_col));
+      PL_RETURN_IF_ERROR(output_rb.AddColumn(empty_col));
+    }
+  } else if (contiguous_match) {
+    // The survivors are one contiguous run: zero-copy arrow slices of the input columns.
+    for (int64_t input_col_idx : plan_node_->selected_cols()) {
+      PL_RETURN_IF_ERROR(
+          output_rb.AddColumn(rb.ColumnAt(input_col_idx)->Slice(first_match, num_output_records)));
+    }
+  } else {
+    for (const auto& [output_col_idx, input_col_idx] : Enumerate(plan_node_->selected_cols())) {
+      auto input_col = rb.ColumnAt(input_col_idx);
+      auto col_type = output_descriptor_->type(output_col_idx);
 #define TYPE_CASE(_dt_) \
   PL_RETURN_IF_ERROR(PredicateCopyValues<_dt_>(pred_col_wrapper, input_col.get(), &output_rb));
-    PL_SWITCH_FOREACH_DATATYPE(col_type, TYPE_CASE);
+      PL_SWITCH_FOREACH_DATATYPE(col_type, TYPE_CASE);
 #undef TYPE_CASE
+    }
   }
 
   output_rb.set_eow(rb.eow());
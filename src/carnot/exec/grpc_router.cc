@@ -103,18 +103,21 @@ void GRPCRouter::MarkResultStreamContextAsComplete(QueryTracker* query_tracker,
 ::grpc::Status GRPCRouter::HandleTransferResultChunkMessage(
     std::unique_ptr<carnotpb::TransferResultChunkRequest> req, ::grpc::ServerContext* context,
     TransferResultChunkState* state) {
-  auto query_id = px::ParseUUID(req->query_id()).ConsumeValueOrDie();
-  {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    if (!id_to_query_tracker_map_.contains(query_id)) {
+  // The stream's query tracker is resolved once and cached in the per-stream state, so the
+  // common row-batch path below never touches the shared query map.
+  if (state->query_tracker == nullptr) {
+    auto query_id = px::ParseUUID(req->query_id()).ConsumeValueOrDie();
+    auto* shard = ShardForQuery(query_id);
+    absl::base_internal::SpinLockHolder lock(&shard->lock);
+    if (!shard->trackers.contains(query_id)) {
       if (!req->has_initiate_conn()) {
         return ::grpc::Status(
             grpc::StatusCode::INVALID_ARGUMENT,
             "Attempting to TransferResultChunk for uninitiated or completed query.");
       }
-      id_to_query_tracker_map_[query_id] = std::make_shared<QueryTracker>();
+      shard->trackers[query_id] = std::make_shared<QueryTracker>();
     }
-    state->query_tracker = id_to_query_tracker_map_[query_id];
+    state->query_tracker = shard->trackers[query_id];
   }
 
   if (!state->registered_server_context) {
@@ -157,11 +160,12 @@ void GRPCRouter::MarkResultStreamContextAsComplete(QueryTracker* query_tracker,
 std::vector<statuspb::Status> GRPCRouter::GetIncomingWorkerErrors(const sole::uuid& query_id) {
   std::shared_ptr<QueryTracker> query_tracker;
   {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    if (!id_to_query_tracker_map_.contains(query_id)) {
+    auto* shard = ShardForQuery(query_id);
+    absl::base_internal::SpinLockHolder lock(&shard->lock);
+    if (!shard->trackers.contains(query_id)) {
       return {};
     }
-    query_tracker = id_to_query_tracker_map_[query_id];
+    query_tracker = shard->trackers[query_id];
   }
   absl::base_internal::SpinLockHolder lock(&query_tracker->query_lock);
   return query_tracker->upstream_exec_errors;
@@ -209,11 +213,12 @@ Status GRPCRouter::AddGRPCSourceNode(sole::uuid query_id, int64_t source_id,
   // We need to check and see if there is backlog data, if so flush it from the vector.
   std::shared_ptr<QueryTracker> query_tracker;
   {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    if (!id_to_query_tracker_map_.contains(query_id)) {
-      id_to_query_tracker_map_[query_id] = std::make_shared<QueryTracker>();
+    auto* shard = ShardForQuery(query_id);
+    absl::base_internal::SpinLockHolder lock(&shard->lock);
+    if (!shard->trackers.contains(query_id)) {
+      shard->trackers[query_id] = std::make_shared<QueryTracker>();
     }
-    query_tracker = id_to_query_tracker_map_[query_id];
+    query_tracker = shard->trackers[query_id];
   }
 
   {
@@ -244,9 +249,10 @@ StatusOr<std::vector<queryresultspb::AgentExecutionStats>> GRPCRouter::GetIncomi
     const sole::uuid& query_id) {
   std::shared_ptr<QueryTracker> query_tracker;
   {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    auto it = id_to_query_tracker_map_.find(query_id);
-    if (it == id_to_query_tracker_map_.end()) {
+    auto* shard = ShardForQuery(query_id);
+    absl::base_internal::SpinLockHolder lock(&shard->lock);
+    auto it = shard->trackers.find(query_id);
+    if (it == shard->trackers.end()) {
       return error::Internal("No query ID $0 found in the GRPCRouter", query_id.str());
     }
     query_tracker = it->second;
@@ -261,12 +267,13 @@ StatusOr<std::vector<queryresultspb::AgentExecutionStats>> GRPCRouter::GetIncomi
 Status GRPCRouter::DeleteGRPCSourceNode(sole::uuid query_id, int64_t source_id) {
   std::shared_ptr<QueryTracker> query_tracker;
   {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    if (!id_to_query_tracker_map_.contains(query_id)) {
+    auto* shard = ShardForQuery(query_id);
+    absl::base_internal::SpinLockHolder lock(&shard->lock);
+    if (!shard->trackers.contains(query_id)) {
       return error::Internal("Query map does not contain query ID $0 when deleting GRPC source $1",
                              query_id.str(), source_id);
     }
-    query_tracker = id_to_query_tracker_map_[query_id];
+    query_tracker = shard->trackers[query_id];
   }
 
   absl::base_internal::SpinLockHolder lock(&query_tracker->query_lock);
@@ -283,15 +290,16 @@ void GRPCRouter::DeleteQuery(sole::uuid query_id) {
   VLOG(1) << "Deleting query ID from GRPC Router: " << query_id.str();
   std::shared_ptr<QueryTracker> query_tracker;
   {
-    absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-    auto it = id_to_query_tracker_map_.find(query_id);
-    if (it == id_to_query_tracker_map_.end()) {
+    auto* shard = ShardForQuery(query_id);
+    absl::base_internal::SpinLockHolder lock(&shard->lock);
+    auto it = shard->trackers.find(query_id);
+    if (it == shard->trackers.end()) {
       VLOG(1) << "No such query when deleting: " << query_id.str()
               << "(this is expected if no grpc sources are present)";
       return;
     }
     query_tracker = it->second;
-    id_to_query_tracker_map_.erase(it);
+    shard->trackers.erase(it);
   }
   absl::base_internal::SpinLockHolder lock(&query_tracker->query_lock);
   query_tracker->ResetRestartExecutionFunc();
@@ -302,8 +310,12 @@ void GRPCRouter::DeleteQuery(sole::uuid query_id) {
 }
 
 size_t GRPCRouter::NumQueriesTracking() const {
-  absl::base_internal::SpinLockHolder lock(&id_to_query_tracker_map_lock_);
-  return id_to_query_tracker_map_.size();
+  size_t num_queries = 0;
+  for (const auto& shard : query_tracker_shards_) {
+    absl::base_internal::SpinLockHolder lock(&shard.lock);
+    num_queries += shard.trackers.size();
+  }
+  return num_queries;
 }
 
 }  // namespace exec
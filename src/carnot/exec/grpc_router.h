@@ -19,6 +19,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <array>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -177,9 +178,24 @@ class GRPCRouter final : public carnotpb::ResultSinkService::Service {
                                          ::grpc::ServerContext* context);
   SourceNodeTracker* GetSourceNodeTracker(QueryTracker* query_tracker, int64_t source_id);
 
-  absl::node_hash_map<sole::uuid, std::shared_ptr<QueryTracker>> id_to_query_tracker_map_
-      GUARDED_BY(id_to_query_tracker_map_lock_);
-  mutable absl::base_internal::SpinLock id_to_query_tracker_map_lock_;
+  // The query tracker map is sharded by query-id hash so that concurrent streams for different
+  // queries don't serialize on a single lock. Streams only touch their shard on the first message;
+  // after that the tracker is cached in the per-stream TransferResultChunkState, so row batch
+  // enqueue takes no router-wide lock at all.
+  static constexpr size_t kNumQueryTrackerShards = 16;
+  using QueryTrackerMap = absl::node_hash_map<sole::uuid, std::shared_ptr<QueryTracker>>;
+  struct QueryTrackerShard {
+    QueryTrackerMap trackers GUARDED_BY(lock);
+    mutable absl::base_internal::SpinLock lock;
+  };
+  QueryTrackerShard* ShardForQuery(const sole::uuid& query_id) {
+    return &query_tracker_shards_[QueryTrackerMap::hasher{}(query_id) % kNumQueryTrackerShards];
+  }
+  const QueryTrackerShard* ShardForQuery(const sole::uuid& query_id) const {
+    return &query_tracker_shards_[QueryTrackerMap::hasher{}(query_id) % kNumQueryTrackerShards];
+  }
+
+  std::array<QueryTrackerShard, kNumQueryTrackerShards> query_tracker_shards_;
 };
 
 }  // namespace exec
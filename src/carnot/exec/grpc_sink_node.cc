@@ -19,10 +19,14 @@
 #include "src/carnot/exec/grpc_sink_node.h"
 
 #include <chrono>
+#include <filesystem>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <sole.hpp>
+
 #include <absl/strings/substitute.h>
 
 #include "src/carnot/carnotpb/carnot.pb.h"
@@ -31,6 +35,25 @@
 #include "src/common/uuid/uuid_utils.h"
 #include "src/table_store/table_store.h"
 
+DEFINE_int64(carnot_grpc_sink_queue_size,
+             gflags::Int64FromEnv("PL_CARNOT_GRPC_SINK_QUEUE_SIZE", 0),
+             "Number of result chunks the GRPC sink buffers for its background writer thread, so "
+             "that execution is decoupled from network jitter. 0 writes synchronously on the "
+             "execution thread.");
+DEFINE_int64(carnot_grpc_sink_coalesce_bytes,
+             gflags::Int64FromEnv("PL_CARNOT_GRPC_SINK_COALESCE_BYTES", 0),
+             "Coalesce consecutive row batches into a single outgoing result chunk until it "
+             "reaches this many bytes, to amortize per-message overhead. 0 disables coalescing.");
+DEFINE_int64(carnot_grpc_sink_spill_bytes,
+             gflags::Int64FromEnv("PL_CARNOT_GRPC_SINK_SPILL_BYTES", 0),
+             "When the background writer's send queue is full, spill further result chunks to a "
+             "temp file of up to this many bytes rather than blocking execution, so that large "
+             "results stream reliably to slow consumers. 0 disables spilling and blocks instead.");
+DEFINE_bool(carnot_grpc_sink_compression,
+            gflags::BoolFromEnv("PL_CARNOT_GRPC_SINK_COMPRESSION", false),
+            "Whether to compress the result stream with gzip. Useful for text-heavy tables sent "
+            "across the network.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -38,6 +61,22 @@ namespace exec {
 using table_store::schema::RowBatch;
 using table_store::schema::RowDescriptor;
 
+GRPCSinkNode::~GRPCSinkNode() {
+  // The writer thread is normally stopped when the EOS is sent or in CloseImpl; this covers error
+  // paths where neither happened.
+  PL_UNUSED(StopWriterThread());
+}
+
+void GRPCSinkNode::UpdateLastSendTime() {
+  std::lock_guard<std::mutex> lock(last_send_time_mu_);
+  last_send_time_ = std::chrono::system_clock::now();
+}
+
+std::chrono::time_point<std::chrono::system_clock> GRPCSinkNode::LastSendTime() const {
+  std::lock_guard<std::mutex> lock(last_send_time_mu_);
+  return last_send_time_;
+}
+
 std::string GRPCSinkNode::DebugStringImpl() {
   std::string destination;
   if (plan_node_->has_table_name()) {
@@ -67,6 +106,17 @@ StatusOr<carnotpb::TransferResultChunkRequest> RequestWithMetadata(
   return req;
 }
 
+Status GRPCSinkNode::SerializeRowBatch(const RowBatch& rb,
+                                       table_store::schemapb::RowBatchData* proto) {
+  // Batches routed to another Carnot instance use the raw-buffer column encoding, which copies
+  // each column's arrow buffers instead of packing values one at a time. External consumers such
+  // as the query broker only understand the value-by-value form.
+  if (plan_node_->has_grpc_source_id()) {
+    return rb.ToEncodedProto(proto);
+  }
+  return rb.ToProto(proto);
+}
+
 Status GRPCSinkNode::OptionallyCheckConnection(ExecState* exec_state) {
   if (sent_eos_ || cancelled_) {
     return Status::OK();
@@ -74,18 +124,24 @@ Status GRPCSinkNode::OptionallyCheckConnection(ExecState* exec_state) {
 
   auto time_now = std::chrono::system_clock::now();
   auto since_last_flush =
-      std::chrono::duration_cast<std::chrono::milliseconds>(time_now - last_send_time_);
+      std::chrono::duration_cast<std::chrono::milliseconds>(time_now - LastSendTime());
   bool recheck_connection = since_last_flush > connection_check_timeout_;
   if (!recheck_connection) {
     return Status::OK();
   }
 
+  // Coalesced batches that have been sitting for a full connection-check interval are sent now
+  // rather than waiting for more data; this doubles as the connection check.
+  if (pending_rows_ > 0) {
+    return FlushCoalescedBatches(exec_state);
+  }
+
   PL_ASSIGN_OR_RETURN(auto req, RequestWithMetadata(plan_node_.get(), exec_state));
   PL_ASSIGN_OR_RETURN(auto rb,
                       RowBatch::WithZeroRows(*input_descriptor_, /* eow */ false, /* eos */ false));
-  PL_RETURN_IF_ERROR(rb->ToProto(req.mutable_query_result()->mutable_row_batch()));
+  PL_RETURN_IF_ERROR(SerializeRowBatch(*rb, req.mutable_query_result()->mutable_row_batch()));
 
-  PL_RETURN_IF_ERROR(TryWriteRequest(exec_state, req));
+  PL_RETURN_IF_ERROR(EnqueueOrWriteRequest(exec_state, std::move(req)));
   return Status::OK();
 }
 
@@ -120,6 +176,9 @@ Status GRPCSinkNode::StartConnectionWithRetries(ExecState* exec_state, size_t n_
   stub_ = exec_state->ResultSinkServiceStub(plan_node_->address(), plan_node_->ssl_targetname());
 
   context_ = std::make_unique<grpc::ClientContext>();
+  if (FLAGS_carnot_grpc_sink_compression) {
+    context_->set_compression_algorithm(GRPC_COMPRESS_GZIP);
+  }
   // When we are sending the results to an external service, such as the query broker,
   // add authentication to the client context.
   if (plan_node_->has_table_name()) {
@@ -135,13 +194,13 @@ Status GRPCSinkNode::StartConnectionWithRetries(ExecState* exec_state, size_t n_
   // initiate_result_stream request.
   PL_ASSIGN_OR_RETURN(auto rb,
                       RowBatch::WithZeroRows(*input_descriptor_, /* eow */ false, /* eos */ false));
-  PL_RETURN_IF_ERROR(rb->ToProto(req.mutable_query_result()->mutable_row_batch()));
+  PL_RETURN_IF_ERROR(SerializeRowBatch(*rb, req.mutable_query_result()->mutable_row_batch()));
 
   if (!writer_->Write(req)) {
     return StartConnectionWithRetries(exec_state, n_retries - 1);
   }
 
-  last_send_time_ = std::chrono::system_clock::now();
+  UpdateLastSendTime();
   return Status::OK();
 }
 
@@ -156,7 +215,7 @@ Status GRPCSinkNode::CancelledByServer(ExecState* exec_state) {
 Status GRPCSinkNode::TryWriteRequest(ExecState* exec_state,
                                      const carnotpb::TransferResultChunkRequest& req) {
   if (writer_->Write(req)) {
-    last_send_time_ = std::chrono::system_clock::now();
+    UpdateLastSendTime();
     return Status::OK();
   }
 
@@ -179,11 +238,181 @@ Status GRPCSinkNode::TryWriteRequest(ExecState* exec_state,
   if (!writer_->Write(req)) {
     return CancelledByServer(exec_state);
   }
-  last_send_time_ = std::chrono::system_clock::now();
+  UpdateLastSendTime();
+  return Status::OK();
+}
+
+Status GRPCSinkNode::OpenImpl(ExecState* exec_state) {
+  PL_RETURN_IF_ERROR(StartConnection(exec_state));
+  if (FLAGS_carnot_grpc_sink_queue_size > 0) {
+    StartWriterThread(exec_state);
+  }
   return Status::OK();
 }
 
-Status GRPCSinkNode::OpenImpl(ExecState* exec_state) { return StartConnection(exec_state); }
+void GRPCSinkNode::StartWriterThread(ExecState* exec_state) {
+  send_queue_capacity_ = FLAGS_carnot_grpc_sink_queue_size;
+  spill_capacity_bytes_ = FLAGS_carnot_grpc_sink_spill_bytes;
+  writer_shutdown_ = false;
+  writer_status_ = Status::OK();
+  writer_thread_running_ = true;
+  writer_thread_ = std::thread(&GRPCSinkNode::WriterThreadLoop, this, exec_state);
+}
+
+void GRPCSinkNode::WriterThreadLoop(ExecState* exec_state) {
+  while (true) {
+    carnotpb::TransferResultChunkRequest req;
+    {
+      std::unique_lock<std::mutex> lock(send_queue_mu_);
+      send_queue_cv_.wait(lock, [this] {
+        return !send_queue_.empty() || spill_pending_records_ > 0 || writer_shutdown_;
+      });
+      if (!send_queue_.empty()) {
+        req = std::move(send_queue_.front());
+        send_queue_.pop_front();
+      } else if (spill_pending_records_ > 0) {
+        auto s = ReadSpilledRequestLocked(&req);
+        if (!s.ok()) {
+          writer_status_ = s;
+          spill_pending_records_ = 0;
+          send_queue_cv_.notify_all();
+          return;
+        }
+      } else {
+        return;
+      }
+      send_queue_cv_.notify_all();
+    }
+    auto s = TryWriteRequest(exec_state, req);
+    if (!s.ok()) {
+      // Record the failure for the execution thread and drop anything still queued or spilled;
+      // the stream is dead so those requests can never be delivered.
+      std::lock_guard<std::mutex> lock(send_queue_mu_);
+      writer_status_ = s;
+      send_queue_.clear();
+      spill_pending_records_ = 0;
+      send_queue_cv_.notify_all();
+      return;
+    }
+  }
+}
+
+Status GRPCSinkNode::StopWriterThread() {
+  if (!writer_thread_.joinable()) {
+    return Status::OK();
+  }
+  {
+    std::lock_guard<std::mutex> lock(send_queue_mu_);
+    writer_shutdown_ = true;
+    send_queue_cv_.notify_all();
+  }
+  writer_thread_.join();
+  writer_thread_running_ = false;
+  CleanupSpillFile();
+  return writer_status_;
+}
+
+Status GRPCSinkNode::EnqueueOrWriteRequest(ExecState* exec_state,
+                                           carnotpb::TransferResultChunkRequest req) {
+  if (!writer_thread_running_) {
+    return TryWriteRequest(exec_state, req);
+  }
+  std::unique_lock<std::mutex> lock(send_queue_mu_);
+  if (spill_capacity_bytes_ > 0 && writer_status_.ok()) {
+    // Once requests have spilled, later ones must follow them to the file to preserve ordering,
+    // so the queue only becomes usable again after the writer has drained the spill file.
+    bool queue_full = static_cast<int64_t>(send_queue_.size()) >= send_queue_capacity_;
+    if ((queue_full || spill_pending_records_ > 0) &&
+        spill_write_pos_ - spill_read_pos_ < spill_capacity_bytes_) {
+      return SpillRequestLocked(req);
+    }
+  }
+  send_queue_cv_.wait(lock, [this] {
+    return (static_cast<int64_t>(send_queue_.size()) < send_queue_capacity_ &&
+            spill_pending_records_ == 0) ||
+           !writer_status_.ok();
+  });
+  if (!writer_status_.ok()) {
+    return writer_status_;
+  }
+  send_queue_.push_back(std::move(req));
+  send_queue_cv_.notify_all();
+  return Status::OK();
+}
+
+Status GRPCSinkNode::SpillRequestLocked(const carnotpb::TransferResultChunkRequest& req) {
+  if (spill_stream_ == nullptr) {
+    std::error_code ec;
+    auto tmp_dir = std::filesystem::temp_directory_path(ec);
+    if (ec) {
+      return error::Internal("GRPCSinkNode: could not resolve a temp directory for spilling: $0",
+                             ec.message());
+    }
+    spill_path_ =
+        (tmp_dir / absl::Substitute("carnot_sink_spill_$0.bin", sole::uuid4().str())).string();
+    spill_stream_ = std::make_unique<std::fstream>(
+        spill_path_, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!spill_stream_->is_open()) {
+      spill_stream_ = nullptr;
+      return error::Internal("GRPCSinkNode: failed to open spill file $0.", spill_path_);
+    }
+  }
+  std::string serialized;
+  if (!req.SerializeToString(&serialized)) {
+    return error::Internal("GRPCSinkNode: failed to serialize result chunk for spilling.");
+  }
+  uint64_t size = serialized.size();
+  spill_stream_->clear();
+  spill_stream_->seekp(spill_write_pos_);
+  spill_stream_->write(reinterpret_cast<const char*>(&size), sizeof(size));
+  spill_stream_->write(serialized.data(), serialized.size());
+  spill_stream_->flush();
+  if (!spill_stream_->good()) {
+    return error::Internal("GRPCSinkNode: failed to write to spill file $0.", spill_path_);
+  }
+  spill_write_pos_ += static_cast<int64_t>(sizeof(size) + serialized.size());
+  ++spill_pending_records_;
+  ++total_spilled_records_;
+  send_queue_cv_.notify_all();
+  return Status::OK();
+}
+
+Status GRPCSinkNode::ReadSpilledRequestLocked(carnotpb::TransferResultChunkRequest* req) {
+  uint64_t size = 0;
+  spill_stream_->clear();
+  spill_stream_->seekg(spill_read_pos_);
+  spill_stream_->read(reinterpret_cast<char*>(&size), sizeof(size));
+  std::string serialized(size, '\0');
+  spill_stream_->read(serialized.data(), serialized.size());
+  if (!spill_stream_->good() || !req->ParseFromString(serialized)) {
+    return error::Internal("GRPCSinkNode: failed to read back spilled result chunk from $0.",
+                           spill_path_);
+  }
+  spill_read_pos_ += static_cast<int64_t>(sizeof(size) + serialized.size());
+  --spill_pending_records_;
+  if (spill_pending_records_ == 0) {
+    // Everything spilled so far has been drained, so rewind rather than letting the file grow
+    // without bound across repeated slow phases of the consumer.
+    spill_read_pos_ = 0;
+    spill_write_pos_ = 0;
+  }
+  return Status::OK();
+}
+
+void GRPCSinkNode::CleanupSpillFile() {
+  if (spill_stream_ == nullptr) {
+    return;
+  }
+  spill_stream_ = nullptr;
+  std::error_code ec;
+  std::filesystem::remove(spill_path_, ec);
+  if (ec) {
+    LOG(WARNING) << absl::Substitute("GRPCSinkNode: failed to remove spill file $0: $1",
+                                     spill_path_, ec.message());
+  }
+  VLOG(1) << absl::Substitute("GRPCSinkNode $0: spilled $1 result chunks to disk.",
+                              plan_node_->id(), total_spilled_records_);
+}
 
 Status GRPCSinkNode::CloseWriter(ExecState* exec_state) {
   if (writer_ == nullptr) {
@@ -201,12 +430,15 @@ Status GRPCSinkNode::CloseWriter(ExecState* exec_state) {
 
 Status GRPCSinkNode::CloseImpl(ExecState* exec_state) {
   if (sent_eos_ || cancelled_) {
+    PL_UNUSED(StopWriterThread());
     return Status::OK();
   }
 
   if (writer_ != nullptr) {
     LOG(INFO) << absl::Substitute("Closing GRPCSinkNode $0 in query $1 before receiving EOS",
                                   plan_node_->id(), exec_state->query_id().str());
+    PL_UNUSED(FlushCoalescedBatches(exec_state));
+    PL_UNUSED(StopWriterThread());
     PL_RETURN_IF_ERROR(CloseWriter(exec_state));
   }
 
@@ -302,7 +534,57 @@ Status GRPCSinkNode::SplitAndSendBatch(ExecState* exec_state, const RowBatch& rb
   return ConsumeNextImplNoSplit(exec_state, *output_rb, parent_idx);
 }
 
+Status GRPCSinkNode::BufferForCoalescing(const RowBatch& rb) {
+  if (pending_wrappers_.empty()) {
+    for (int col_idx = 0; col_idx < rb.num_columns(); ++col_idx) {
+      pending_wrappers_.push_back(types::ColumnWrapper::FromArrow(rb.ColumnAt(col_idx)));
+    }
+  } else {
+    for (int col_idx = 0; col_idx < rb.num_columns(); ++col_idx) {
+      pending_wrappers_[col_idx]->AppendFrom(*types::ColumnWrapper::FromArrow(rb.ColumnAt(col_idx)));
+    }
+  }
+  pending_rows_ += rb.num_rows();
+  pending_bytes_ += rb.NumBytes();
+  return Status::OK();
+}
+
+Status GRPCSinkNode::FlushCoalescedBatches(ExecState* exec_state) {
+  if (pending_rows_ == 0) {
+    pending_wrappers_.clear();
+    return Status::OK();
+  }
+
+  RowBatch coalesced_rb(*input_descriptor_, pending_rows_);
+  for (const auto& wrapper : pending_wrappers_) {
+    PL_RETURN_IF_ERROR(
+        coalesced_rb.AddColumn(wrapper->ConvertToArrow(arrow::default_memory_pool())));
+  }
+  pending_wrappers_.clear();
+  pending_rows_ = 0;
+  pending_bytes_ = 0;
+
+  // The coalesce threshold may be configured above the max request size, so the merged batch
+  // still goes through the split check.
+  if (coalesced_rb.NumBytes() > (max_batch_size_ * batch_size_factor_)) {
+    return SplitAndSendBatch(exec_state, coalesced_rb, /* parent_idx */ 0);
+  }
+  return ConsumeNextImplNoSplit(exec_state, coalesced_rb, /* parent_idx */ 0);
+}
+
 Status GRPCSinkNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb, size_t parent_idx) {
+  int64_t coalesce_bytes = FLAGS_carnot_grpc_sink_coalesce_bytes;
+  if (coalesce_bytes > 0 && !rb.eow() && !rb.eos() && rb.num_rows() > 0) {
+    PL_RETURN_IF_ERROR(BufferForCoalescing(rb));
+    if (pending_bytes_ < coalesce_bytes) {
+      return Status::OK();
+    }
+    return FlushCoalescedBatches(exec_state);
+  }
+  // Batches that can't be coalesced (end-of-window/stream markers or zero-row connection checks)
+  // are sent after anything buffered ahead of them, preserving order.
+  PL_RETURN_IF_ERROR(FlushCoalescedBatches(exec_state));
+
   if (rb.NumBytes() > (max_batch_size_ * batch_size_factor_)) {
     return SplitAndSendBatch(exec_state, rb, parent_idx);
   }
@@ -312,14 +594,16 @@ Status GRPCSinkNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb,
 Status GRPCSinkNode::ConsumeNextImplNoSplit(ExecState* exec_state, const RowBatch& rb, size_t) {
   PL_ASSIGN_OR_RETURN(auto req, RequestWithMetadata(plan_node_.get(), exec_state));
   // Serialize the RowBatch.
-  PL_RETURN_IF_ERROR(rb.ToProto(req.mutable_query_result()->mutable_row_batch()));
+  PL_RETURN_IF_ERROR(SerializeRowBatch(rb, req.mutable_query_result()->mutable_row_batch()));
 
-  PL_RETURN_IF_ERROR(TryWriteRequest(exec_state, req));
+  PL_RETURN_IF_ERROR(EnqueueOrWriteRequest(exec_state, std::move(req)));
 
   if (!rb.eos()) {
     return Status::OK();
   }
 
+  // Drain any asynchronously queued requests before finishing the stream.
+  PL_RETURN_IF_ERROR(StopWriterThread());
   PL_RETURN_IF_ERROR(CloseWriter(exec_state));
   sent_eos_ = true;
 
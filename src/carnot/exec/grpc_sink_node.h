@@ -19,9 +19,15 @@
 #pragma once
 
 #include <stddef.h>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <grpcpp/grpcpp.h>
@@ -31,6 +37,7 @@
 #include "src/carnot/exec/exec_state.h"
 #include "src/carnot/plan/operators.h"
 #include "src/common/base/base.h"
+#include "src/shared/types/column_wrapper.h"
 #include "src/table_store/table_store.h"
 
 #include "src/carnot/carnotpb/carnot.grpc.pb.h"
@@ -56,7 +63,7 @@ class GRPCSinkNode : public SinkNode {
   GRPCSinkNode(size_t max_batch_size, float batch_size_factor)
       : max_batch_size_(max_batch_size), batch_size_factor_(batch_size_factor) {}
   GRPCSinkNode() : GRPCSinkNode(kMaxBatchSize, kBatchSizeFactor) {}
-  virtual ~GRPCSinkNode() = default;
+  virtual ~GRPCSinkNode();
 
   // Used to check the downstream connection after connection_check_timeout_ has elapsed.
   Status OptionallyCheckConnection(ExecState* exec_state);
@@ -64,8 +71,8 @@ class GRPCSinkNode : public SinkNode {
   void testing_set_connection_check_timeout(const std::chrono::milliseconds& timeout) {
     connection_check_timeout_ = timeout;
   }
-  const std::chrono::time_point<std::chrono::system_clock>& testing_last_send_time() const {
-    return last_send_time_;
+  std::chrono::time_point<std::chrono::system_clock> testing_last_send_time() const {
+    return LastSendTime();
   }
 
  protected:
@@ -85,13 +92,43 @@ class GRPCSinkNode : public SinkNode {
                                        int64_t other_col_row_size) const;
 
  private:
+  Status SerializeRowBatch(const table_store::schema::RowBatch& rb,
+                           table_store::schemapb::RowBatchData* proto);
   Status CloseWriter(ExecState* exec_state);
   Status StartConnection(ExecState* exec_state);
   Status StartConnectionWithRetries(ExecState* exec_state, size_t n_retries);
   Status CancelledByServer(ExecState* exec_state);
   Status TryWriteRequest(ExecState* exec_state, const carnotpb::TransferResultChunkRequest& req);
 
-  bool cancelled_ = false;
+  // Hands the request to the background writer thread when one is running, otherwise writes it
+  // synchronously on the calling thread. When the send queue is full, the request spills to a
+  // temp file if --carnot_grpc_sink_spill_bytes allows it; otherwise this blocks, which applies
+  // back-pressure to the execution thread instead of growing the queue without bound.
+  Status EnqueueOrWriteRequest(ExecState* exec_state, carnotpb::TransferResultChunkRequest req);
+  void StartWriterThread(ExecState* exec_state);
+  // Flushes any queued requests, joins the writer thread, and returns the first write error the
+  // writer encountered, if any.
+  Status StopWriterThread();
+  void WriterThreadLoop(ExecState* exec_state);
+
+  // Overflow handling for the writer thread's send queue. When spilling is enabled and the queue
+  // is full, requests are framed to a temp file instead of blocking the execution thread, and the
+  // writer reads them back once the queue drains. Both must be called with send_queue_mu_ held.
+  Status SpillRequestLocked(const carnotpb::TransferResultChunkRequest& req);
+  Status ReadSpilledRequestLocked(carnotpb::TransferResultChunkRequest* req);
+  // Closes and deletes the spill file, if one was created. Called once the writer thread has been
+  // joined, so it does not need the lock.
+  void CleanupSpillFile();
+
+  // Appends rb's columns to the pending coalesce buffer.
+  Status BufferForCoalescing(const table_store::schema::RowBatch& rb);
+  // Sends the coalesce buffer (if non-empty) as a single row batch.
+  Status FlushCoalescedBatches(ExecState* exec_state);
+
+  void UpdateLastSendTime();
+  std::chrono::time_point<std::chrono::system_clock> LastSendTime() const;
+
+  std::atomic<bool> cancelled_ = false;
 
   std::unique_ptr<grpc::ClientContext> context_;
   carnotpb::TransferResultChunkResponse response_;
@@ -103,8 +140,36 @@ class GRPCSinkNode : public SinkNode {
   std::unique_ptr<table_store::schema::RowDescriptor> input_descriptor_;
 
   std::chrono::milliseconds connection_check_timeout_ = kDefaultConnectionCheckTimeoutMS;
+  // Updated by whichever thread performs the write, so guarded by last_send_time_mu_.
+  mutable std::mutex last_send_time_mu_;
   std::chrono::time_point<std::chrono::system_clock> last_send_time_;
 
+  // Small row batches accumulated for coalescing, one wrapper per input column.
+  std::vector<types::SharedColumnWrapper> pending_wrappers_;
+  int64_t pending_rows_ = 0;
+  int64_t pending_bytes_ = 0;
+
+  // State for the optional background writer thread. The queue and status are guarded by
+  // send_queue_mu_; writer_thread_running_ is only touched by the execution thread.
+  std::thread writer_thread_;
+  bool writer_thread_running_ = false;
+  std::mutex send_queue_mu_;
+  std::condition_variable send_queue_cv_;
+  std::deque<carnotpb::TransferResultChunkRequest> send_queue_;
+  int64_t send_queue_capacity_ = 0;
+  bool writer_shutdown_ = false;
+  Status writer_status_;
+
+  // Overflow spill state, guarded by send_queue_mu_ like the queue itself. Spilled requests are
+  // always newer than anything in the queue, so FIFO order is queue first, then the spill file.
+  std::unique_ptr<std::fstream> spill_stream_;
+  std::string spill_path_;
+  int64_t spill_capacity_bytes_ = 0;
+  int64_t spill_read_pos_ = 0;
+  int64_t spill_write_pos_ = 0;
+  int64_t spill_pending_records_ = 0;
+  int64_t total_spilled_records_ = 0;
+
   size_t max_batch_size_;
   float batch_size_factor_;
 };
@@ -18,6 +18,8 @@
 
 #include "src/carnot/exec/grpc_sink_node.h"
 
+#include <atomic>
+#include <future>
 #include <utility>
 #include <vector>
 
@@ -35,6 +37,10 @@
 #include "src/common/uuid/uuid_utils.h"
 #include "src/shared/types/types.h"
 
+DECLARE_int64(carnot_grpc_sink_queue_size);
+DECLARE_int64(carnot_grpc_sink_coalesce_bytes);
+DECLARE_int64(carnot_grpc_sink_spill_bytes);
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -94,7 +100,8 @@ query_id {
 query_result {
   row_batch {
     cols {
-      int64_data {
+      encoded_data {
+        data_type: INT64
       }
     }
   }
@@ -111,7 +118,8 @@ query_id {
 query_result {
   row_batch {
     cols {
-      int64_data {
+      encoded_data {
+        data_type: INT64
       }
     }
   }
@@ -128,8 +136,9 @@ query_id {
 query_result {
   row_batch {
     cols {
-      int64_data {
-        data: 1
+      encoded_data {
+        data_type: INT64
+        values: "\001\000\000\000\000\000\000\000"
       }
     }
     num_rows: 1
@@ -147,9 +156,9 @@ query_id {
 query_result {
   row_batch {
     cols {
-      int64_data {
-        data: 2
-        data: 2
+      encoded_data {
+        data_type: INT64
+        values: "\002\000\000\000\000\000\000\000\002\000\000\000\000\000\000\000"
       }
     }
     num_rows: 2
@@ -722,6 +731,183 @@ TEST_F(GRPCSinkNodeTest, retry_failed_writes) {
   EXPECT_FALSE(add_metadata_called_);
 }
 
+TEST_F(GRPCSinkNodeTest, coalesce_small_batches) {
+  auto old_coalesce_bytes = FLAGS_carnot_grpc_sink_coalesce_bytes;
+  FLAGS_carnot_grpc_sink_coalesce_bytes = 1024;
+
+  auto op_proto = planpb::testutils::CreateTestGRPCSink1PB();
+  auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
+  auto s = plan_node->Init(op_proto.grpc_sink_op());
+  RowDescriptor input_rd({types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  TransferResultChunkResponse resp;
+  resp.set_success(true);
+
+  std::vector<TransferResultChunkRequest> actual_protos;
+  auto save_arg = [&](TransferResultChunkRequest req, grpc::WriteOptions) {
+    actual_protos.push_back(req);
+  };
+
+  auto writer = new grpc::testing::MockClientWriter<TransferResultChunkRequest>();
+  // Initiate stream + one coalesced batch + the final eos batch.
+  EXPECT_CALL(*writer, Write(_, _))
+      .Times(3)
+      .WillRepeatedly(DoAll(Invoke(save_arg), Return(true)));
+  EXPECT_CALL(*writer, WritesDone());
+  EXPECT_CALL(*writer, Finish()).WillOnce(Return(grpc::Status::OK));
+  EXPECT_CALL(*mock_, TransferResultChunkRaw(_, _))
+      .WillOnce(DoAll(SetArgPointee<1>(resp), Return(writer)));
+
+  auto tester = exec::ExecNodeTester<GRPCSinkNode, plan::GRPCSinkOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  // These two batches are both below the coalesce threshold, so neither triggers a write.
+  tester.ConsumeNext(RowBatchBuilder(output_rd, 1, /*eow*/ false, /*eos*/ false)
+                         .AddColumn<types::Int64Value>({1})
+                         .get(),
+                     5, 0);
+  tester.ConsumeNext(RowBatchBuilder(output_rd, 2, /*eow*/ false, /*eos*/ false)
+                         .AddColumn<types::Int64Value>({2, 3})
+                         .get(),
+                     5, 0);
+  // The eos batch flushes the coalesced rows ahead of itself.
+  tester.ConsumeNext(RowBatchBuilder(output_rd, 1, /*eow*/ true, /*eos*/ true)
+                         .AddColumn<types::Int64Value>({4})
+                         .get(),
+                     5, 0);
+  tester.Close();
+
+  ASSERT_EQ(3, actual_protos.size());
+  EXPECT_EQ(0, actual_protos[0].query_result().row_batch().num_rows());
+  EXPECT_EQ(3, actual_protos[1].query_result().row_batch().num_rows());
+  EXPECT_FALSE(actual_protos[1].query_result().row_batch().eos());
+  EXPECT_EQ(1, actual_protos[2].query_result().row_batch().num_rows());
+  EXPECT_TRUE(actual_protos[2].query_result().row_batch().eos());
+
+  FLAGS_carnot_grpc_sink_coalesce_bytes = old_coalesce_bytes;
+}
+
+TEST_F(GRPCSinkNodeTest, async_writer_flushes_in_order) {
+  auto old_queue_size = FLAGS_carnot_grpc_sink_queue_size;
+  FLAGS_carnot_grpc_sink_queue_size = 2;
+
+  auto op_proto = planpb::testutils::CreateTestGRPCSink1PB();
+  auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
+  auto s = plan_node->Init(op_proto.grpc_sink_op());
+  RowDescriptor input_rd({types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  TransferResultChunkResponse resp;
+  resp.set_success(true);
+
+  std::vector<TransferResultChunkRequest> actual_protos;
+  auto save_arg = [&](TransferResultChunkRequest req, grpc::WriteOptions) {
+    actual_protos.push_back(req);
+  };
+
+  auto writer = new grpc::testing::MockClientWriter<TransferResultChunkRequest>();
+  EXPECT_CALL(*writer, Write(_, _))
+      .Times(4)
+      .WillRepeatedly(DoAll(Invoke(save_arg), Return(true)));
+  EXPECT_CALL(*writer, WritesDone());
+  EXPECT_CALL(*writer, Finish()).WillOnce(Return(grpc::Status::OK));
+  EXPECT_CALL(*mock_, TransferResultChunkRaw(_, _))
+      .WillOnce(DoAll(SetArgPointee<1>(resp), Return(writer)));
+
+  auto tester = exec::ExecNodeTester<GRPCSinkNode, plan::GRPCSinkOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  for (auto i = 0; i < 3; ++i) {
+    std::vector<types::Int64Value> data(i, i);
+    auto rb = RowBatchBuilder(output_rd, i, /*eow*/ i == 2, /*eos*/ i == 2)
+                  .AddColumn<types::Int64Value>(data)
+                  .get();
+    // The eos batch joins the writer thread, so all writes have completed by the time
+    // ConsumeNext returns for the final batch.
+    tester.ConsumeNext(rb, 5, 0);
+  }
+  tester.Close();
+
+  ASSERT_EQ(4, actual_protos.size());
+  for (auto i = 0; i < 3; ++i) {
+    EXPECT_EQ(i, actual_protos[i + 1].query_result().row_batch().num_rows());
+  }
+  EXPECT_TRUE(actual_protos[3].query_result().row_batch().eos());
+
+  FLAGS_carnot_grpc_sink_queue_size = old_queue_size;
+}
+
+TEST_F(GRPCSinkNodeTest, async_writer_spills_overflow_to_disk) {
+  auto old_queue_size = FLAGS_carnot_grpc_sink_queue_size;
+  auto old_spill_bytes = FLAGS_carnot_grpc_sink_spill_bytes;
+  FLAGS_carnot_grpc_sink_queue_size = 1;
+  FLAGS_carnot_grpc_sink_spill_bytes = 16 * 1024 * 1024;
+
+  auto op_proto = planpb::testutils::CreateTestGRPCSink1PB();
+  auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
+  auto s = plan_node->Init(op_proto.grpc_sink_op());
+  RowDescriptor input_rd({types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  TransferResultChunkResponse resp;
+  resp.set_success(true);
+
+  // The first write (the stream initiation request) stalls until the execution thread has pushed
+  // enough batches to overflow the 1-entry send queue into the spill file.
+  std::promise<void> unblock_writer;
+  std::shared_future<void> writer_unblocked(unblock_writer.get_future());
+  std::atomic<bool> first_write{true};
+  std::vector<TransferResultChunkRequest> actual_protos;
+  auto save_arg = [&](TransferResultChunkRequest req, grpc::WriteOptions) {
+    if (first_write.exchange(false)) {
+      writer_unblocked.wait();
+    }
+    actual_protos.push_back(req);
+  };
+
+  auto writer = new grpc::testing::MockClientWriter<TransferResultChunkRequest>();
+  EXPECT_CALL(*writer, Write(_, _))
+      .Times(5)
+      .WillRepeatedly(DoAll(Invoke(save_arg), Return(true)));
+  EXPECT_CALL(*writer, WritesDone());
+  EXPECT_CALL(*writer, Finish()).WillOnce(Return(grpc::Status::OK));
+  EXPECT_CALL(*mock_, TransferResultChunkRaw(_, _))
+      .WillOnce(DoAll(SetArgPointee<1>(resp), Return(writer)));
+
+  auto tester = exec::ExecNodeTester<GRPCSinkNode, plan::GRPCSinkOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  // With the writer stalled, the first batch fills the queue and the next two must spill; none of
+  // these ConsumeNext calls may block.
+  for (auto i = 0; i < 3; ++i) {
+    std::vector<types::Int64Value> data(i, i);
+    auto rb = RowBatchBuilder(output_rd, i, /*eow*/ false, /*eos*/ false)
+                  .AddColumn<types::Int64Value>(data)
+                  .get();
+    tester.ConsumeNext(rb, 5, 0);
+  }
+
+  // Release the writer, then send the eos batch, which joins the writer thread and so guarantees
+  // the queue and the spill file have fully drained, in order, by the time it returns.
+  unblock_writer.set_value();
+  std::vector<types::Int64Value> data(3, 3);
+  auto rb = RowBatchBuilder(output_rd, 3, /*eow*/ true, /*eos*/ true)
+                .AddColumn<types::Int64Value>(data)
+                .get();
+  tester.ConsumeNext(rb, 5, 0);
+  tester.Close();
+
+  ASSERT_EQ(5, actual_protos.size());
+  for (auto i = 0; i < 4; ++i) {
+    EXPECT_EQ(i, actual_protos[i + 1].query_result().row_batch().num_rows());
+  }
+  EXPECT_TRUE(actual_protos[4].query_result().row_batch().eos());
+
+  FLAGS_carnot_grpc_sink_queue_size = old_queue_size;
+  FLAGS_carnot_grpc_sink_spill_bytes = old_spill_bytes;
+}
+
 TEST_F(GRPCSinkNodeTest, check_connection_after_eos) {
   auto op_proto = planpb::testutils::CreateTestGRPCSink2PB();
   auto plan_node = std::make_unique<plan::GRPCSinkOperator>(1);
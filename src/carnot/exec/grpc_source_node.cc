@@ -55,8 +55,23 @@ Status GRPCSourceNode::GenerateNextImpl(ExecState* exec_state) {
   return Status::OK();
 }
 
+Status GRPCSourceNode::Stop(ExecState*) {
+  // The remote sink may still be streaming row batches; drop them on arrival rather than
+  // queueing data nobody will consume. The stream itself is cancelled by the GRPC router when
+  // the query finishes, which stopping this source unblocks.
+  stopped_ = true;
+  // Drain anything already queued.
+  std::unique_ptr<carnotpb::TransferResultChunkRequest> dropped;
+  while (row_batch_queue_.try_dequeue(dropped)) {
+  }
+  return Status::OK();
+}
+
 Status GRPCSourceNode::EnqueueRowBatch(
     std::unique_ptr<carnotpb::TransferResultChunkRequest> row_batch) {
+  if (stopped_) {
+    return Status::OK();
+  }
   if (!row_batch_queue_.enqueue(std::move(row_batch))) {
     return error::Internal("Failed to enqueue RowBatch");
   }
@@ -78,12 +93,16 @@ Status GRPCSourceNode::PopRowBatch() {
         "message.");
   }
 
-  PL_ASSIGN_OR_RETURN(rb_, RowBatch::FromProto(rb_request->query_result().row_batch()));
+  // The request becomes shared so that encoded columns can reference its wire buffers zero-copy;
+  // the arrays hold it alive until all downstream consumers are done with the batch.
+  std::shared_ptr<const carnotpb::TransferResultChunkRequest> owned_request(std::move(rb_request));
+  PL_ASSIGN_OR_RETURN(
+      rb_, RowBatch::FromProto(owned_request->query_result().row_batch(), owned_request));
   return Status::OK();
 }
 
 bool GRPCSourceNode::NextBatchReady() {
-  return HasBatchesRemaining() && row_batch_queue_.size_approx() > 0;
+  return !stopped_ && HasBatchesRemaining() && row_batch_queue_.size_approx() > 0;
 }
 
 }  // namespace exec
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -42,6 +43,7 @@ class GRPCSourceNode : public SourceNode {
   virtual ~GRPCSourceNode() = default;
 
   bool NextBatchReady() override;
+  Status Stop(ExecState* exec_state) override;
   virtual Status EnqueueRowBatch(std::unique_ptr<carnotpb::TransferResultChunkRequest> row_batch);
 
   // Tracks whether the upstream sink node has successfully initiated the connection to
@@ -74,6 +76,9 @@ class GRPCSourceNode : public SourceNode {
   std::unique_ptr<plan::GRPCSourceOperator> plan_node_;
   bool upstream_initiated_connection_ = false;
   bool upstream_closed_connection_ = false;
+  // Set once downstream consumers no longer need this source's data. Row batches received from
+  // the remote sink after this point are dropped instead of queued.
+  std::atomic<bool> stopped_ = false;
 };
 
 }  // namespace exec
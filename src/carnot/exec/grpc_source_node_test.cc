@@ -87,6 +87,32 @@ TEST_F(GRPCSourceNodeTest, basic) {
   EXPECT_FALSE(tester.node()->HasBatchesRemaining());
 }
 
+TEST_F(GRPCSourceNodeTest, stop_drops_queued_and_incoming_batches) {
+  auto op_proto = planpb::testutils::CreateTestGRPCSource1PB();
+  std::unique_ptr<plan::Operator> plan_node = plan::GRPCSourceOperator::FromProto(op_proto, 1);
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<GRPCSourceNode, plan::GRPCSourceOperator>(
+      *plan_node, output_rd, std::vector<RowDescriptor>({}), exec_state_.get());
+
+  auto rb = RowBatchBuilder(output_rd, 2, /*eow*/ false, /*eos*/ false)
+                .AddColumn<types::Int64Value>({1, 2})
+                .get();
+  auto rb_wrapper = std::make_unique<carnotpb::TransferResultChunkRequest>();
+  EXPECT_OK(rb.ToProto(rb_wrapper->mutable_query_result()->mutable_row_batch()));
+  EXPECT_OK(tester.node()->EnqueueRowBatch(std::move(rb_wrapper)));
+  EXPECT_TRUE(tester.node()->NextBatchReady());
+
+  EXPECT_OK(tester.node()->Stop(exec_state_.get()));
+  EXPECT_FALSE(tester.node()->NextBatchReady());
+
+  // Row batches still streaming in from the remote sink are dropped.
+  auto late_rb_wrapper = std::make_unique<carnotpb::TransferResultChunkRequest>();
+  EXPECT_OK(rb.ToProto(late_rb_wrapper->mutable_query_result()->mutable_row_batch()));
+  EXPECT_OK(tester.node()->EnqueueRowBatch(std::move(late_rb_wrapper)));
+  EXPECT_FALSE(tester.node()->NextBatchReady());
+}
+
 }  // namespace exec
 }  // namespace carnot
 }  // namespace px
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/live_query_registry.h"
+
+#include <algorithm>
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+LiveQueryRegistry& LiveQueryRegistry::GetInstance() {
+  static LiveQueryRegistry registry;
+  return registry;
+}
+
+void LiveQueryRegistry::Register(const sole::uuid& query_id, const ExecutionGraph* graph) {
+  std::lock_guard<std::mutex> lock(lock_);
+  graphs_[query_id].push_back(graph);
+}
+
+void LiveQueryRegistry::Unregister(const sole::uuid& query_id, const ExecutionGraph* graph) {
+  std::lock_guard<std::mutex> lock(lock_);
+  auto iter = graphs_.find(query_id);
+  if (iter == graphs_.end()) {
+    return;
+  }
+  auto& graphs = iter->second;
+  graphs.erase(std::remove(graphs.begin(), graphs.end(), graph), graphs.end());
+  if (graphs.empty()) {
+    graphs_.erase(iter);
+  }
+}
+
+std::vector<sole::uuid> LiveQueryRegistry::ListQueries() const {
+  std::lock_guard<std::mutex> lock(lock_);
+  std::vector<sole::uuid> query_ids;
+  query_ids.reserve(graphs_.size());
+  for (const auto& [query_id, graphs] : graphs_) {
+    query_ids.push_back(query_id);
+  }
+  return query_ids;
+}
+
+StatusOr<std::vector<OperatorProfile>> LiveQueryRegistry::SampleQuery(
+    const sole::uuid& query_id) const {
+  std::lock_guard<std::mutex> lock(lock_);
+  auto iter = graphs_.find(query_id);
+  if (iter == graphs_.end()) {
+    return error::NotFound("Query $0 is not currently executing.", query_id.str());
+  }
+
+  std::vector<OperatorProfile> profiles;
+  for (const ExecutionGraph* graph : iter->second) {
+    auto graph_profiles = graph->SampleOperatorProfiles();
+    profiles.insert(profiles.end(), std::make_move_iterator(graph_profiles.begin()),
+                    std::make_move_iterator(graph_profiles.end()));
+  }
+  return profiles;
+}
+
+StatusOr<std::string> LiveQueryRegistry::DumpFolded(const sole::uuid& query_id) const {
+  std::lock_guard<std::mutex> lock(lock_);
+  auto iter = graphs_.find(query_id);
+  if (iter == graphs_.end()) {
+    return error::NotFound("Query $0 is not currently executing.", query_id.str());
+  }
+
+  std::string out;
+  for (const ExecutionGraph* graph : iter->second) {
+    absl::StrAppend(&out, graph->FoldedStacks());
+  }
+  return out;
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
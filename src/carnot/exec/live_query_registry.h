@@ -0,0 +1,80 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <absl/base/thread_annotations.h>
+#include <absl/container/node_hash_map.h>
+#include <sole.hpp>
+
+#include "src/carnot/exec/exec_graph.h"
+#include "src/common/base/base.h"
+#include "src/common/uuid/uuid.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * LiveQueryRegistry tracks the ExecutionGraphs of queries currently executing in this process,
+ * so in-flight queries can be inspected without killing them.
+ *
+ * ExecutionGraph::Execute() registers the graph for the duration of the execution; a query with
+ * multiple plan fragments has one entry per executing fragment. The registry only guards its own
+ * map: samples read the running graph's counters without synchronization, which is safe because
+ * the counters are monotone — a sample may be slightly stale but never invalid. Intended for
+ * debug surfaces, not for metrics.
+ */
+class LiveQueryRegistry : public NotCopyable {
+ public:
+  static LiveQueryRegistry& GetInstance();
+
+  void Register(const sole::uuid& query_id, const ExecutionGraph* graph);
+  void Unregister(const sole::uuid& query_id, const ExecutionGraph* graph);
+
+  /**
+   * Returns the IDs of all queries currently executing in this process.
+   */
+  std::vector<sole::uuid> ListQueries() const;
+
+  /**
+   * Samples the per-operator counters of all executing fragments of the given query.
+   * Returns error::NotFound if the query is not currently executing.
+   */
+  StatusOr<std::vector<OperatorProfile>> SampleQuery(const sole::uuid& query_id) const;
+
+  /**
+   * Dumps the given query in the collapsed stack format consumed by flame graph tooling:
+   * one "<op stack> <self time us>" line per operator, across all executing fragments.
+   * Returns error::NotFound if the query is not currently executing.
+   */
+  StatusOr<std::string> DumpFolded(const sole::uuid& query_id) const;
+
+ private:
+  mutable std::mutex lock_;
+  // Graphs of in-flight queries; one entry per executing plan fragment.
+  absl::node_hash_map<sole::uuid, std::vector<const ExecutionGraph*>> graphs_ GUARDED_BY(lock_);
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
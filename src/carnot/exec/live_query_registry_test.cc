@@ -0,0 +1,124 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/live_query_registry.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+#include <sole.hpp>
+
+#include "src/carnot/exec/test_utils.h"
+#include "src/carnot/plan/plan_fragment.h"
+#include "src/carnot/plan/plan_state.h"
+#include "src/carnot/planpb/plan.pb.h"
+#include "src/carnot/planpb/test_proto.h"
+#include "src/carnot/udf/registry.h"
+#include "src/carnot/udf/udf.h"
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using google::protobuf::TextFormat;
+using ::testing::Contains;
+using ::testing::HasSubstr;
+using ::testing::Not;
+using ::testing::SizeIs;
+
+class LiveQueryRegistryTestAddUDF : public udf::ScalarUDF {
+ public:
+  types::Float64Value Exec(udf::FunctionContext*, types::Int64Value v1, types::Float64Value v2) {
+    return v1.val + v2.val;
+  }
+};
+
+class LiveQueryRegistryTestMultiplyUDF : public udf::ScalarUDF {
+ public:
+  types::Float64Value Exec(udf::FunctionContext*, types::Float64Value v1, types::Int64Value v2) {
+    return v1.val * v2.val;
+  }
+};
+
+class LiveQueryRegistryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    planpb::PlanFragment pf_pb;
+    ASSERT_TRUE(TextFormat::MergeFromString(planpb::testutils::kPlanFragmentWithFourNodes, &pf_pb));
+    ASSERT_OK(plan_fragment_->Init(pf_pb));
+
+    func_registry_ = std::make_unique<udf::Registry>("test_registry");
+    func_registry_->RegisterOrDie<LiveQueryRegistryTestAddUDF>("add");
+    func_registry_->RegisterOrDie<LiveQueryRegistryTestMultiplyUDF>("multiply");
+
+    auto table_store = std::make_shared<table_store::TableStore>();
+    exec_state_ = std::make_unique<ExecState>(func_registry_.get(), table_store,
+                                              MockResultSinkStubGenerator, MockMetricsStubGenerator,
+                                              MockTraceStubGenerator, sole::uuid4(), nullptr);
+  }
+
+  std::unique_ptr<udf::Registry> func_registry_;
+  std::shared_ptr<plan::PlanFragment> plan_fragment_ = std::make_shared<plan::PlanFragment>(1);
+  std::unique_ptr<ExecState> exec_state_;
+};
+
+TEST_F(LiveQueryRegistryTest, register_sample_unregister) {
+  ExecutionGraph e;
+  auto plan_state = std::make_unique<plan::PlanState>(func_registry_.get());
+
+  auto schema = std::make_shared<table_store::schema::Schema>();
+  table_store::schema::Relation relation(std::vector<types::DataType>({types::DataType::INT64}),
+                                         std::vector<std::string>({"test"}));
+  schema->AddRelation(1, relation);
+
+  ASSERT_OK(e.Init(schema.get(), plan_state.get(), exec_state_.get(), plan_fragment_.get(),
+                   /* collect_exec_node_stats */ true));
+
+  const sole::uuid query_id = exec_state_->query_id();
+  auto& registry = LiveQueryRegistry::GetInstance();
+
+  // Not registered yet.
+  EXPECT_NOT_OK(registry.SampleQuery(query_id));
+
+  registry.Register(query_id, &e);
+  EXPECT_THAT(registry.ListQueries(), Contains(query_id));
+
+  ASSERT_OK_AND_ASSIGN(std::vector<OperatorProfile> profiles, registry.SampleQuery(query_id));
+  EXPECT_THAT(profiles, SizeIs(4));
+  for (const auto& profile : profiles) {
+    EXPECT_FALSE(profile.name.empty());
+  }
+
+  // Every operator gets one folded-stack line, and non-root operators have a stacked path.
+  ASSERT_OK_AND_ASSIGN(std::string folded, registry.DumpFolded(query_id));
+  EXPECT_EQ(4, std::count(folded.begin(), folded.end(), '\n'));
+  EXPECT_THAT(folded, HasSubstr(";"));
+
+  registry.Unregister(query_id, &e);
+  EXPECT_THAT(registry.ListQueries(), Not(Contains(query_id)));
+  EXPECT_NOT_OK(registry.SampleQuery(query_id));
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
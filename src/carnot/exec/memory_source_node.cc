@@ -81,10 +81,20 @@ Status MemorySourceNode::OpenImpl(ExecState* exec_state) {
   }
   cursor_ = std::make_unique<Table::Cursor>(table_, start_spec, stop_spec);
 
+  // Infinite streams outlive the data currently in the table, so have the table wake the
+  // execution loop when a new batch lands instead of relying on the timed yield alone.
+  if (infinite_stream_ && batch_wakeup_callback_) {
+    batch_wakeup_callback_id_ = table_->RegisterBatchArrivalCallback(batch_wakeup_callback_);
+  }
+
   return Status::OK();
 }
 
 Status MemorySourceNode::CloseImpl(ExecState*) {
+  if (batch_wakeup_callback_id_ >= 0) {
+    table_->UnregisterBatchArrivalCallback(batch_wakeup_callback_id_);
+    batch_wakeup_callback_id_ = -1;
+  }
   stats()->AddExtraInfo("infinite_stream", infinite_stream_ ? "true" : "false");
   return Status::OK();
 }
@@ -126,11 +136,20 @@ Status MemorySourceNode::GenerateNextImpl(ExecState* exec_state) {
 bool MemorySourceNode::InfiniteStreamNextBatchReady() { return cursor_->NextBatchReady(); }
 
 bool MemorySourceNode::NextBatchReady() {
+  if (cursor_ == nullptr) {
+    return false;
+  }
   // Next batch is ready if we haven't seen an eow and if it's an infinite_stream that has batches
   // to push.
   return HasBatchesRemaining() && (!infinite_stream_ || InfiniteStreamNextBatchReady());
 }
 
+Status MemorySourceNode::Stop(ExecState*) {
+  // Release the cursor so the table can reclaim the rows it was holding for this query.
+  cursor_.reset();
+  return Status::OK();
+}
+
 }  // namespace exec
 }  // namespace carnot
 }  // namespace px
@@ -19,8 +19,10 @@
 #pragma once
 
 #include <stdint.h>
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "src/carnot/exec/exec_node.h"
@@ -45,6 +47,14 @@ class MemorySourceNode : public SourceNode {
   virtual ~MemorySourceNode() = default;
 
   bool NextBatchReady() override;
+  Status Stop(ExecState* exec_state) override;
+
+  // Sets the callback used to wake the execution loop when a new batch arrives in the source
+  // table. For streaming sources this replaces waiting out the full yield timeout; without it the
+  // execution loop still makes progress via the timed yield. Must be set before Open().
+  void SetBatchWakeupCallback(std::function<void()> callback) {
+    batch_wakeup_callback_ = std::move(callback);
+  }
 
  protected:
   std::string DebugStringImpl() override;
@@ -65,6 +75,11 @@ class MemorySourceNode : public SourceNode {
 
   std::unique_ptr<plan::MemorySourceOperator> plan_node_;
   table_store::Table* table_ = nullptr;
+
+  // Wakes the execution loop on batch arrival; registered with the table for the lifetime of the
+  // query (Open() to Close()) when this source is an infinite stream.
+  std::function<void()> batch_wakeup_callback_;
+  int64_t batch_wakeup_callback_id_ = -1;
 };
 
 }  // namespace exec
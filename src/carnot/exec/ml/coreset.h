@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -286,17 +287,20 @@ class CoresetDriver {
   CoresetDriver(int m, int d, Args... args)
       : m_(m), d_(d), coreset_data_(args...), points_(m_, d_), weights_(m_), size_(0) {}
 
+  ~CoresetDriver() { JoinPendingFlush(); }
+
   void Update(const Eigen::VectorXf& p) {
     points_(size_, Eigen::indexing::all) = p.transpose();
     weights_(size_) = 1.0f;
     size_++;
     if (size_ == m_) {
-      coreset_data_.Update(std::make_shared<WeightedPointSet>(points_, weights_));
+      FlushAsync();
       size_ = 0;
     }
   }
 
   std::shared_ptr<WeightedPointSet> Query() {
+    JoinPendingFlush();
     auto coreset = coreset_data_.Coreset();
     if (size_ == 0) {
       // If we haven't seen any data, this could return an empty set.
@@ -309,6 +313,8 @@ class CoresetDriver {
   }
 
   void Merge(const CoresetDriver<TCoresetStructure>& other) {
+    JoinPendingFlush();
+    other.JoinPendingFlush();
     coreset_data_.Merge(other.coreset_data_);
     auto new_set = WeightedPointSet::Union({CurrentSet(), other.CurrentSet()});
     if (new_set->size() >= m_) {
@@ -320,6 +326,7 @@ class CoresetDriver {
   }
 
   std::string ToJSON() const {
+    JoinPendingFlush();
     rapidjson::StringBuffer sb;
     rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
     writer.StartObject();
@@ -332,6 +339,7 @@ class CoresetDriver {
   }
 
   void FromJSON(std::string data) {
+    JoinPendingFlush();
     rapidjson::Document doc;
     doc.Parse(data.data());
     DCHECK(doc.IsObject());
@@ -343,6 +351,22 @@ class CoresetDriver {
   }
 
  private:
+  // Hands the full buffer off to a background thread to fold into the coreset structure, so
+  // coreset construction for one batch overlaps with accumulating the next one. The point set is
+  // copied out of the buffer before the thread starts, so Update can keep writing into it. At
+  // most one flush runs at a time, and every other access to coreset_data_ joins it first.
+  void FlushAsync() {
+    JoinPendingFlush();
+    auto set = std::make_shared<WeightedPointSet>(points_, weights_);
+    flush_thread_ = std::thread([this, set]() { coreset_data_.Update(set); });
+  }
+
+  void JoinPendingFlush() const {
+    if (flush_thread_.joinable()) {
+      flush_thread_.join();
+    }
+  }
+
   std::shared_ptr<WeightedPointSet> CurrentSet() const {
     if (size_ == 0) {
       return std::make_shared<WeightedPointSet>(0, points_.cols());
@@ -367,6 +391,8 @@ class CoresetDriver {
   Eigen::MatrixXf points_;
   Eigen::VectorXf weights_;
   int size_;
+  // In-flight flush of the previous batch, if any. Mutable so const readers can join it.
+  mutable std::thread flush_thread_;
 };
 
 }  // namespace ml
@@ -26,6 +26,27 @@ namespace carnot {
 namespace exec {
 namespace ml {
 
+namespace {
+
+// Above this many points a full pass over the data per iteration becomes the bottleneck, so Fit
+// switches to mini-batch updates.
+constexpr int kMiniBatchThreshold = 2048;
+// Number of points sampled per mini-batch iteration.
+constexpr int kMiniBatchSize = 256;
+
+// Returns the matrix of squared distances with dists(i, j) = ||points_i - centroids_j||^2,
+// expanded into ||points_i||^2 + ||centroids_j||^2 - 2 * points_i . centroids_j so that the
+// dominant cost is a single matrix product Eigen can vectorize, rather than a per-point loop.
+Eigen::MatrixXf PairwiseSquaredDists(const Eigen::MatrixXf& points,
+                                     const Eigen::MatrixXf& centroids) {
+  Eigen::MatrixXf dists = -2.0f * (points * centroids.transpose());
+  dists.colwise() += points.rowwise().squaredNorm();
+  dists.rowwise() += centroids.rowwise().squaredNorm().transpose();
+  return dists;
+}
+
+}  // namespace
+
 void KMeans::Fit(std::shared_ptr<WeightedPointSet> set) {
   if (set->size() < 2) {
     LOG(ERROR) << "Fitting KMeans on less than 2 points is currently unsupported.";
@@ -40,6 +61,11 @@ void KMeans::Fit(std::shared_ptr<WeightedPointSet> set) {
       KMeansPlusPlusInit(points, weights);
   }
 
+  if (points.rows() > kMiniBatchThreshold) {
+    MiniBatchFit(points, weights);
+    return;
+  }
+
   int iter_count = 0;
   bool changed = true;
   while (iter_count < max_iters_ && changed) {
@@ -52,12 +78,10 @@ bool KMeans::LloydsIteration(const Eigen::MatrixXf& points, const Eigen::VectorX
   Eigen::MatrixXf new_centroids = Eigen::MatrixXf::Zero(centroids_.rows(), centroids_.cols());
   Eigen::ArrayXf centroid_weights = Eigen::ArrayXf::Zero(centroids_.rows());
 
+  Eigen::MatrixXf dists = PairwiseSquaredDists(points, centroids_);
   for (int i = 0; i < points.rows(); i++) {
     Eigen::VectorXf::Index closest_centroid;
-    (centroids_.rowwise() - points(i, Eigen::indexing::all))
-        .rowwise()
-        .squaredNorm()
-        .minCoeff(&closest_centroid);
+    dists(i, Eigen::indexing::all).minCoeff(&closest_centroid);
     new_centroids(closest_centroid, Eigen::indexing::all) +=
         weights(i) * points(i, Eigen::indexing::all);
     centroid_weights(closest_centroid) += weights(i);
@@ -78,25 +102,51 @@ bool KMeans::LloydsIteration(const Eigen::MatrixXf& points, const Eigen::VectorX
   return true;
 }
 
-void KMeans::KMeansPlusPlusInit(const Eigen::MatrixXf& points, const Eigen::VectorXf& weights) {
+void KMeans::MiniBatchFit(const Eigen::MatrixXf& points, const Eigen::VectorXf& weights) {
+  // Mini-batch kmeans in the style of Sculley (WWW 2010), adapted for weighted points: each
+  // centroid moves towards its assigned samples with a learning rate that decays as the total
+  // weight assigned to it grows.
+  Eigen::ArrayXf centroid_weights = Eigen::ArrayXf::Zero(k_);
   std::uniform_int_distribution<> dist(0, points.rows() - 1);
-  auto firstCentroid = dist(random_gen_);
-  centroids_(0, Eigen::indexing::all) = points(firstCentroid, Eigen::indexing::all);
 
-  Eigen::VectorXf probDist(points.rows());
-  for (auto i = 1; i < k_; i++) {
-    for (auto j = 0; j < probDist.rows(); j++) {
-      auto point = points(j, Eigen::indexing::all);
-      Eigen::VectorXf::Index closestCentroid;
-      auto dist = (centroids_(Eigen::seq(0, i - 1), Eigen::indexing::all).rowwise() - point)
-                      .rowwise()
-                      .squaredNorm()
-                      .minCoeff(&closestCentroid);
-      probDist(j) = weights(j) * dist;
+  Eigen::MatrixXf batch(kMiniBatchSize, points.cols());
+  Eigen::VectorXf batch_weights(kMiniBatchSize);
+  for (int iter = 0; iter < max_iters_; iter++) {
+    for (int i = 0; i < kMiniBatchSize; i++) {
+      auto ind = dist(random_gen_);
+      batch(i, Eigen::indexing::all) = points(ind, Eigen::indexing::all);
+      batch_weights(i) = weights(ind);
     }
-    std::discrete_distribution<> pointDist(probDist.begin(), probDist.end());
-    auto ind = pointDist(random_gen_);
+    Eigen::MatrixXf dists = PairwiseSquaredDists(batch, centroids_);
+    for (int i = 0; i < kMiniBatchSize; i++) {
+      Eigen::VectorXf::Index closest_centroid;
+      dists(i, Eigen::indexing::all).minCoeff(&closest_centroid);
+      centroid_weights(closest_centroid) += batch_weights(i);
+      auto eta = batch_weights(i) / centroid_weights(closest_centroid);
+      centroids_(closest_centroid, Eigen::indexing::all) +=
+          eta *
+          (batch(i, Eigen::indexing::all) - centroids_(closest_centroid, Eigen::indexing::all));
+    }
+  }
+}
+
+void KMeans::KMeansPlusPlusInit(const Eigen::MatrixXf& points, const Eigen::VectorXf& weights) {
+  std::uniform_int_distribution<> dist(0, points.rows() - 1);
+  auto first_centroid = dist(random_gen_);
+  centroids_(0, Eigen::indexing::all) = points(first_centroid, Eigen::indexing::all);
+
+  // Squared distance from each point to the closest centroid chosen so far. Folding each new
+  // centroid into this running minimum keeps init at one distance computation per point per
+  // centroid, instead of recomputing against every chosen centroid each round.
+  Eigen::VectorXf min_dists =
+      (points.rowwise() - centroids_(0, Eigen::indexing::all)).rowwise().squaredNorm();
+  for (auto i = 1; i < k_; i++) {
+    Eigen::VectorXf prob_dist = (weights.array() * min_dists.array()).matrix();
+    std::discrete_distribution<> point_dist(prob_dist.begin(), prob_dist.end());
+    auto ind = point_dist(random_gen_);
     centroids_(i, Eigen::indexing::all) = points(ind, Eigen::indexing::all);
+    min_dists = min_dists.cwiseMin(
+        (points.rowwise() - centroids_(i, Eigen::indexing::all)).rowwise().squaredNorm());
   }
 }
 
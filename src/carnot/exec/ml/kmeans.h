@@ -43,6 +43,8 @@ class KMeans {
    * Updates centroids_ based on running kmeans on this set.
    * Note that only the last call to Fit matters, eg. Fit(set1); Fit(set2); is equivalent to
    * Fit(set2).
+   * Small sets run full Lloyd's iterations; large sets use mini-batch updates so that fit time
+   * stays bounded by max_iters rather than growing with the set size.
    **/
   void Fit(std::shared_ptr<WeightedPointSet> set);
 
@@ -58,6 +60,7 @@ class KMeans {
 
  private:
   bool LloydsIteration(const Eigen::MatrixXf& points, const Eigen::VectorXf& weights);
+  void MiniBatchFit(const Eigen::MatrixXf& points, const Eigen::VectorXf& weights);
   void KMeansPlusPlusInit(const Eigen::MatrixXf& points, const Eigen::VectorXf& weights);
 
   int k_;
@@ -97,6 +97,26 @@ TEST(KMeans, trimodal_normal_dist) {
   }
 }
 
+TEST(KMeans, minibatch_trimodal_normal_dist) {
+  int k = 3;
+
+  // Tile the trimodal set until it's large enough that Fit takes the mini-batch path.
+  Eigen::MatrixXf base = kmeans_test_data();
+  int reps = 40;
+  Eigen::MatrixXf points(base.rows() * reps, base.cols());
+  for (int i = 0; i < reps; i++) {
+    points(Eigen::seq(i * base.rows(), (i + 1) * base.rows() - 1), Eigen::indexing::all) = base;
+  }
+  Eigen::VectorXf weights = Eigen::VectorXf::Ones(points.rows());
+
+  auto set = std::make_shared<WeightedPointSet>(points, weights);
+
+  KMeans kmeans(k, /*max_iters*/ 20);
+  kmeans.Fit(set);
+
+  ASSERT_THAT(kmeans.centroids(), UnorderedRowsAre(kmeans_expected_centroids(), 0.15));
+}
+
 }  // namespace ml
 }  // namespace exec
 }  // namespace carnot
@@ -145,12 +145,15 @@ inline std::vector<std::string> ParseStringOrArray(const std::string& input) {
   return out;
 }
 
+// Expands the last element of `out` into the cross-product of its JSON-encoded resource
+// attribute values. The element has already been fully populated apart from these attributes;
+// the extra permutations are allocated from the same arena and cloned from it. If an attribute
+// has no values the element is removed, matching the row-drop behavior of the value encoding.
 template <typename ResourceData>
 void ReplicateData(const std::vector<planpb::OTelAttribute>& attributes_spec,
-                   std::function<void(ResourceData)> add_data, ResourceData resource_data,
-                   const RowBatch& rb, int64_t row_idx) {
+                   google::protobuf::RepeatedPtrField<ResourceData>* out, const RowBatch& rb,
+                   int64_t row_idx) {
   if (attributes_spec.empty()) {
-    add_data(std::move(resource_data));
     return;
   }
   // We need to calculate the cross-product of all the attribute values across each other.
@@ -188,14 +191,25 @@ void ReplicateData(const std::vector<planpb::OTelAttribute>& attributes_spec,
     }
   }
 
-  for (const auto& permutation : permutation_sets) {
-    ResourceData data = resource_data;
+  if (permutation_sets.empty()) {
+    out->RemoveLast();
+    return;
+  }
+
+  std::vector<ResourceData*> outputs;
+  outputs.reserve(permutation_sets.size());
+  outputs.push_back(out->Mutable(out->size() - 1));
+  for (size_t i = 1; i < permutation_sets.size(); ++i) {
+    ResourceData* data = out->Add();
+    data->CopyFrom(*outputs[0]);
+    outputs.push_back(data);
+  }
+  for (const auto& [output_idx, permutation] : Enumerate(permutation_sets)) {
     for (const auto& [attribute_idx, value_idx] : Enumerate(permutation)) {
-      auto attribute = data.mutable_resource()->add_attributes();
+      auto attribute = outputs[output_idx]->mutable_resource()->add_attributes();
       attribute->set_key(attributes_spec[attribute_idx].name());
       attribute->mutable_value()->set_string_value(values[attribute_idx][value_idx]);
     }
-    add_data(std::move(data));
   }
 }
 
@@ -214,17 +228,19 @@ Status OTelExportSinkNode::ConsumeMetrics(const RowBatch& rb) {
   context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
 
   metrics_response_.Clear();
-  opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest request;
+  arena_.Reset();
+  auto* request = google::protobuf::Arena::CreateMessage<
+      opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest>(&arena_);
 
   for (int64_t row_idx = 0; row_idx < rb.ColumnAt(0)->length(); ++row_idx) {
-    ::opentelemetry::proto::metrics::v1::ResourceMetrics resource_metrics;
-    auto resource = resource_metrics.mutable_resource();
+    auto* resource_metrics = request->add_resource_metrics();
+    auto resource = resource_metrics->mutable_resource();
     AddAttributes(resource->mutable_attributes(), plan_node_->resource_attributes_normal_encoding(),
                   rb, row_idx);
     // TODO(philkuz) optimize by pooling metrics by resource within a batch.
     // TODO(philkuz) optimize by pooling data per metric per resource.
 
-    auto library_metrics = resource_metrics.add_instrumentation_library_metrics();
+    auto library_metrics = resource_metrics->add_instrumentation_library_metrics();
     for (const auto& metric_pb : plan_node_->metrics()) {
       auto metric = library_metrics->add_metrics();
       metric->set_name(metric_pb.name());
@@ -273,15 +289,11 @@ Status OTelExportSinkNode::ConsumeMetrics(const RowBatch& rb) {
         }
       }
     }
-    ReplicateData<ResourceMetrics>(
-        plan_node_->resource_attributes_optional_json_encoded(),
-        [&request](ResourceMetrics metrics) {
-          *request.add_resource_metrics() = std::move(metrics);
-        },
-        std::move(resource_metrics), rb, row_idx);
+    ReplicateData<ResourceMetrics>(plan_node_->resource_attributes_optional_json_encoded(),
+                                   request->mutable_resource_metrics(), rb, row_idx);
   }
 
-  grpc::Status status = metrics_service_stub_->Export(&context, request, &metrics_response_);
+  grpc::Status status = metrics_service_stub_->Export(&context, *request, &metrics_response_);
   if (!status.ok()) {
     return FormatOTelStatus(plan_node_->id(), status);
   }
@@ -321,15 +333,17 @@ Status OTelExportSinkNode::ConsumeSpans(const RowBatch& rb) {
   context.set_compression_algorithm(GRPC_COMPRESS_GZIP);
 
   metrics_response_.Clear();
-  opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request;
+  arena_.Reset();
+  auto* request = google::protobuf::Arena::CreateMessage<
+      opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest>(&arena_);
 
   for (int64_t row_idx = 0; row_idx < rb.ColumnAt(0)->length(); ++row_idx) {
     // TODO(philkuz) aggregate spans by resource.
-    ::opentelemetry::proto::trace::v1::ResourceSpans resource_spans;
-    auto resource = resource_spans.mutable_resource();
+    auto* resource_spans = request->add_resource_spans();
+    auto resource = resource_spans->mutable_resource();
     AddAttributes(resource->mutable_attributes(), plan_node_->resource_attributes_normal_encoding(),
                   rb, row_idx);
-    auto library_spans = resource_spans.add_instrumentation_library_spans();
+    auto library_spans = resource_spans->add_instrumentation_library_spans();
     for (const auto& span_pb : plan_node_->spans()) {
       auto span = library_spans->add_spans();
       if (span_pb.has_name_string()) {
@@ -395,13 +409,11 @@ Status OTelExportSinkNode::ConsumeSpans(const RowBatch& rb) {
       }
     }
 
-    ReplicateData<ResourceSpans>(
-        plan_node_->resource_attributes_optional_json_encoded(),
-        [&request](ResourceSpans span) { *request.add_resource_spans() = std::move(span); },
-        std::move(resource_spans), rb, row_idx);
+    ReplicateData<ResourceSpans>(plan_node_->resource_attributes_optional_json_encoded(),
+                                 request->mutable_resource_spans(), rb, row_idx);
   }
 
-  grpc::Status status = trace_service_stub_->Export(&context, request, &trace_response_);
+  grpc::Status status = trace_service_stub_->Export(&context, *request, &trace_response_);
   if (!status.ok()) {
     return FormatOTelStatus(plan_node_->id(), status);
   }
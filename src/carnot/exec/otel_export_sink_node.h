@@ -17,6 +17,7 @@
  */
 #pragma once
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/grpcpp.h>
 #include <memory>
 #include <string>
@@ -62,6 +63,10 @@ class OTelExportSinkNode : public SinkNode {
   opentelemetry::proto::collector::trace::v1::TraceService::StubInterface* trace_service_stub_;
   std::unique_ptr<plan::OTelExportSinkOperator> plan_node_;
 
+  // Export requests are built on this arena, so span/metric/attribute messages come from bump
+  // allocation instead of individual heap allocations. Reset between batches to reuse the memory.
+  google::protobuf::Arena arena_;
+
   std::unique_ptr<SpanConfig> span_config_;
 };
 
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/query_memory_pool.h"
+
+#include <algorithm>
+
+#include <absl/strings/substitute.h>
+
+DEFINE_int64(carnot_query_memory_limit_bytes,
+             gflags::Int64FromEnv("PL_CARNOT_QUERY_MEMORY_LIMIT_BYTES", 0),
+             "Hard limit on the arrow memory a single query may have allocated at once, in "
+             "bytes. Allocations beyond the limit fail the query cleanly instead of letting it "
+             "grow without bound. A value of 0 disables the limit.");
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+arrow::Status QueryMemoryPool::Reserve(int64_t delta) {
+  int64_t allocated = bytes_allocated_.fetch_add(delta, std::memory_order_relaxed) + delta;
+  if (limit_bytes_ > 0 && allocated > limit_bytes_) {
+    bytes_allocated_.fetch_sub(delta, std::memory_order_relaxed);
+    return arrow::Status::OutOfMemory(
+        absl::Substitute("query memory limit exceeded: requested $0 bytes with $1 of $2 in use",
+                         delta, allocated - delta, limit_bytes_));
+  }
+  // Track the high-water mark for query profile output.
+  int64_t prev_max = max_memory_.load(std::memory_order_relaxed);
+  while (allocated > prev_max &&
+         !max_memory_.compare_exchange_weak(prev_max, allocated, std::memory_order_relaxed)) {
+  }
+  return arrow::Status::OK();
+}
+
+void QueryMemoryPool::Release(int64_t delta) {
+  bytes_allocated_.fetch_sub(delta, std::memory_order_relaxed);
+}
+
+arrow::Status QueryMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  ARROW_RETURN_NOT_OK(Reserve(size));
+  auto s = wrapped_->Allocate(size, out);
+  if (!s.ok()) {
+    Release(size);
+  }
+  return s;
+}
+
+arrow::Status QueryMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  const int64_t delta = new_size - old_size;
+  if (delta > 0) {
+    ARROW_RETURN_NOT_OK(Reserve(delta));
+  }
+  auto s = wrapped_->Reallocate(old_size, new_size, ptr);
+  if (!s.ok()) {
+    if (delta > 0) {
+      Release(delta);
+    }
+    return s;
+  }
+  if (delta < 0) {
+    Release(-delta);
+  }
+  return s;
+}
+
+void QueryMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  wrapped_->Free(buffer, size);
+  Release(size);
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
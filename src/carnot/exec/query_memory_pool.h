@@ -0,0 +1,93 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <arrow/memory_pool.h>
+#include <arrow/status.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "src/common/base/base.h"
+
+DECLARE_int64(carnot_query_memory_limit_bytes);
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * QueryMemoryPool is a per-query arrow MemoryPool that tracks every allocation made on behalf of
+ * a query and enforces a hard byte limit. Operators get it via ExecState::exec_mem_pool(), so
+ * all arrow buffers built while executing a query are accounted to that query rather than to a
+ * process-wide pool. Allocations beyond the limit fail with an OutOfMemory status, which fails
+ * the query cleanly instead of letting one runaway query OOM the process. The pool lives and
+ * dies with the query's ExecState.
+ *
+ * Accounting is atomic, since sink nodes may allocate off the execution thread.
+ */
+class QueryMemoryPool : public arrow::MemoryPool {
+ public:
+  /**
+   * Creates a pool that delegates to wrapped and enforces the limit from the
+   * --carnot_query_memory_limit_bytes flag.
+   */
+  explicit QueryMemoryPool(arrow::MemoryPool* wrapped)
+      : QueryMemoryPool(wrapped, FLAGS_carnot_query_memory_limit_bytes) {}
+
+  /**
+   * Creates a pool that delegates to wrapped and enforces the given limit.
+   * A limit_bytes of 0 disables the limit.
+   */
+  QueryMemoryPool(arrow::MemoryPool* wrapped, int64_t limit_bytes)
+      : wrapped_(wrapped), limit_bytes_(limit_bytes) {}
+
+  arrow::Status Allocate(int64_t size, uint8_t** out) override;
+  arrow::Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /**
+   * Bytes currently allocated by this query.
+   */
+  int64_t bytes_allocated() const override {
+    return bytes_allocated_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Peak bytes allocated by this query.
+   */
+  int64_t max_memory() const override { return max_memory_.load(std::memory_order_relaxed); }
+
+  int64_t limit_bytes() const { return limit_bytes_; }
+
+ private:
+  // Reserves delta bytes of budget, returning OutOfMemory when it would exceed the limit.
+  arrow::Status Reserve(int64_t delta);
+  // Returns delta bytes of budget (on free, shrink, or failed delegate allocation).
+  void Release(int64_t delta);
+
+  arrow::MemoryPool* wrapped_;
+  const int64_t limit_bytes_;
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "src/carnot/exec/query_memory_pool.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+TEST(QueryMemoryPoolTest, tracks_allocations) {
+  QueryMemoryPool pool(arrow::default_memory_pool(), /* limit_bytes */ 0);
+
+  uint8_t* buf = nullptr;
+  ASSERT_TRUE(pool.Allocate(1024, &buf).ok());
+  EXPECT_EQ(1024, pool.bytes_allocated());
+  EXPECT_EQ(1024, pool.max_memory());
+
+  ASSERT_TRUE(pool.Reallocate(1024, 4096, &buf).ok());
+  EXPECT_EQ(4096, pool.bytes_allocated());
+  EXPECT_EQ(4096, pool.max_memory());
+
+  ASSERT_TRUE(pool.Reallocate(4096, 512, &buf).ok());
+  EXPECT_EQ(512, pool.bytes_allocated());
+  // Max memory tracks the high-water mark.
+  EXPECT_EQ(4096, pool.max_memory());
+
+  pool.Free(buf, 512);
+  EXPECT_EQ(0, pool.bytes_allocated());
+  EXPECT_EQ(4096, pool.max_memory());
+}
+
+TEST(QueryMemoryPoolTest, enforces_limit) {
+  QueryMemoryPool pool(arrow::default_memory_pool(), /* limit_bytes */ 1024);
+
+  uint8_t* buf = nullptr;
+  ASSERT_TRUE(pool.Allocate(512, &buf).ok());
+
+  // This would put the query over the limit, so it must fail without affecting accounting.
+  uint8_t* buf2 = nullptr;
+  auto s = pool.Allocate(1024, &buf2);
+  EXPECT_TRUE(s.IsOutOfMemory());
+  EXPECT_EQ(512, pool.bytes_allocated());
+
+  // Growing past the limit fails too, and leaves the original allocation intact.
+  EXPECT_TRUE(pool.Reallocate(512, 2048, &buf).IsOutOfMemory());
+  EXPECT_EQ(512, pool.bytes_allocated());
+
+  // Freeing returns budget.
+  pool.Free(buf, 512);
+  ASSERT_TRUE(pool.Allocate(1024, &buf2).ok());
+  pool.Free(buf2, 1024);
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -27,6 +27,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -38,7 +39,6 @@
 #include "src/common/base/base.h"
 #include "src/common/base/hash_utils.h"
 #include "src/shared/types/arrow_adapter.h"
-#include "src/shared/types/hash_utils.h"
 #include "src/shared/types/type_utils.h"
 #include "src/shared/types/types.h"
 #include "src/shared/types/typespb/wrapper/types_pb_wrapper.h"
@@ -47,7 +47,9 @@ namespace px {
 namespace carnot {
 namespace exec {
 
-using VariableSizeValueTypeVariant = std::variant<types::StringValue>;
+// Strings are stored as SmallStringValue so that short keys (methods, status codes, pod names)
+// are kept inline in the tuple instead of costing a heap allocation per value.
+using VariableSizeValueTypeVariant = std::variant<types::SmallStringValue>;
 
 struct RowTuple;
 
@@ -60,8 +62,6 @@ inline void SetValueHelper<types::StringValue>(RowTuple* rt, size_t idx,
 
 template <typename T>
 inline const T& GetValueHelper(const RowTuple& rt, size_t idx);
-template <>
-inline const types::StringValue& GetValueHelper<types::StringValue>(const RowTuple& rt, size_t idx);
 
 }  // namespace internal
 
@@ -106,6 +106,32 @@ struct RowTuple : public NotCopyable {
     return internal::GetValueHelper<T>(*this, idx);
   }
 
+  /**
+   * Sets the string value at the given index, copying from the view. Short strings are stored
+   * inline (see SmallStringValue), so this avoids materializing an intermediate std::string.
+   * @param idx The index in the tuple.
+   * @param val The string bytes to copy in.
+   */
+  void SetStringValue(size_t idx, std::string_view val) {
+    DCHECK_LT(idx, fixed_values.size());
+    SetValue(idx, types::Int64Value(static_cast<int64_t>(variable_values.size())));
+    variable_values.emplace_back(types::SmallStringValue(val));
+  }
+
+  /**
+   * Gets a view of the string value at the given index. The view is valid as long as this tuple
+   * is alive and the value is not overwritten.
+   * @param idx The index to read.
+   * @return A view of the stored string bytes.
+   */
+  std::string_view GetStringValue(size_t idx) const {
+    DCHECK_LT(idx, types->size());
+    DCHECK_EQ(types::DataType::STRING, types->at(idx));
+    size_t v_offset = types::Get<types::Int64Value>(fixed_values[idx]).val;
+    DCHECK_LT(v_offset, variable_values.size());
+    return std::get<types::SmallStringValue>(variable_values[v_offset]).view();
+  }
+
   bool operator==(const RowTuple& other) const {
     DCHECK(types != nullptr);
     DCHECK(other.types != nullptr);
@@ -145,9 +171,9 @@ struct RowTuple : public NotCopyable {
     // For variable sized data we run the appropriate hash function.
     for (const auto& val : variable_values) {
       // This should be edited when we add support for new variable sized types.
-      DCHECK(std::holds_alternative<types::StringValue>(val));
-      hash = ::px::HashCombine(
-          hash, types::utils::hash<types::StringValue>()(std::get<types::StringValue>(val)));
+      DCHECK(std::holds_alternative<types::SmallStringValue>(val));
+      const auto view = std::get<types::SmallStringValue>(val).view();
+      hash = ::px::HashCombine(hash, ::util::Hash64(view.data(), view.size()));
     }
     return hash;
   }
@@ -197,11 +223,11 @@ inline void SetValueHelper(RowTuple* rt, size_t idx, const T& val) {
 template <>
 inline void SetValueHelper<types::StringValue>(RowTuple* rt, size_t idx,
                                                const types::StringValue& val) {
-  DCHECK_LT(idx, rt->fixed_values.size());
-  rt->SetValue(idx, types::Int64Value(rt->variable_values.size()));
-  rt->variable_values.emplace_back(val);
+  rt->SetStringValue(idx, val);
 }
 
+// Strings must be read through GetStringValue(); the stored representation is SmallStringValue,
+// so there is no StringValue to return a reference to.
 template <typename T>
 inline const T& GetValueHelper(const RowTuple& rt, size_t idx) {
   static_assert(types::ValueTypeTraits<T>::is_fixed_size, "Only fixed size values allowed");
@@ -209,33 +235,158 @@ inline const T& GetValueHelper(const RowTuple& rt, size_t idx) {
   DCHECK_EQ(types::ValueTypeTraits<T>::data_type, rt.types->at(idx));
   return types::Get<T>(rt.fixed_values[idx]);
 }
+}  // namespace internal
 
-template <>
-inline const types::StringValue& GetValueHelper<types::StringValue>(const RowTuple& rt,
-                                                                    size_t idx) {
-  DCHECK_LT(idx, rt.types->size());
-  DCHECK_EQ(types::ValueTypeTraits<types::StringValue>::data_type, rt.types->at(idx));
-  size_t v_offset = types::Get<types::Int64Value>(rt.fixed_values[idx]).val;
-  DCHECK_LT(v_offset, rt.variable_values.size());
-  return std::get<types::StringValue>(rt.variable_values[v_offset]);
+/**
+ * ColumnarRowKeyRef refers to one row's key values in place in the source key columns, instead of
+ * materializing them into a heap-backed RowTuple. The hash must be precomputed with
+ * HashKeyColumns (which is RowTuple::Hash() compatible), so a batch of refs can be used for
+ * heterogeneous lookups into RowTuple-keyed containers without any per-row allocation.
+ * The referenced columns must outlive the ref.
+ */
+struct ColumnarRowKeyRef {
+  const std::vector<arrow::Array*>* columns;
+  const std::vector<types::DataType>* types;
+  int64_t row_idx;
+  size_t hash;
+};
+
+namespace internal {
+
+// Packs one fixed-size key column into its slots of the row-major scratch matrix used by
+// HashKeyColumns. STRING columns are packed by the caller as sequence ids, matching RowTuple's
+// fixed-value layout.
+template <types::DataType DT>
+inline void PackKeyColumn(types::FixedSizeValueUnion* fixed, size_t num_cols, size_t col_idx,
+                          arrow::Array* col) {
+  if constexpr (DT == types::DataType::STRING) {
+    LOG(DFATAL) << "STRING key columns must be packed as sequence ids";
+    PL_UNUSED(fixed);
+    PL_UNUSED(num_cols);
+    PL_UNUSED(col_idx);
+    PL_UNUSED(col);
+  } else {
+    using UDFValueType = typename types::DataTypeTraits<DT>::value_type;
+    using ArrowArrayType = typename types::DataTypeTraits<DT>::arrow_array_type;
+    auto* typed_col = static_cast<ArrowArrayType*>(col);
+    const int64_t num_rows = col->length();
+    for (int64_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+      types::SetValue(&fixed[row_idx * num_cols + col_idx],
+                      UDFValueType(types::GetValue(typed_col, row_idx)));
+    }
+  }
 }
+
+// Compares one key column of a RowTuple against the value at the given row of an arrow array.
+template <types::DataType DT>
+inline bool RowTupleColumnEquals(const RowTuple& rt, size_t col_idx, const arrow::Array* col,
+                                 int64_t row_idx) {
+  if constexpr (DT == types::DataType::STRING) {
+    // Compare through a view to avoid copying the arrow string.
+    return types::GetStringViewFromArrowArray(col, row_idx) == rt.GetStringValue(col_idx);
+  } else {
+    using UDFValueType = typename types::DataTypeTraits<DT>::value_type;
+    return rt.GetValue<UDFValueType>(col_idx) ==
+           UDFValueType(types::GetValueFromArrowArray<DT>(col, row_idx));
+  }
+}
+
 }  // namespace internal
 
 /**
- * Hash operator for RowTuple pointers.
+ * Computes RowTuple::Hash()-compatible hashes for every row of the given key columns, scanning
+ * column-wise. Fixed-size values are packed into a zero-initialized row-major scratch matrix that
+ * mirrors RowTuple's fixed-value storage (including the sequence-id slots that stand in for
+ * variable-size values), so the per-row hash over that matrix matches a RowTuple built from the
+ * same values. String hashes are then combined per row in column order, as RowTuple::Hash() does.
+ */
+inline std::vector<size_t> HashKeyColumns(const std::vector<arrow::Array*>& columns,
+                                          const std::vector<types::DataType>& types) {
+  DCHECK_EQ(columns.size(), types.size());
+  const size_t num_cols = columns.size();
+  const int64_t num_rows = num_cols == 0 ? 0 : columns[0]->length();
+
+  std::vector<types::FixedSizeValueUnion> fixed(num_cols * num_rows);
+  memset(reinterpret_cast<uint8_t*>(fixed.data()), 0,
+         sizeof(types::FixedSizeValueUnion) * fixed.size());
+
+  int64_t string_seq_id = 0;
+  std::vector<const arrow::StringArray*> string_cols;
+  for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+    DCHECK_EQ(columns[col_idx]->length(), num_rows);
+    if (types[col_idx] == types::STRING) {
+      for (int64_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+        types::SetValue(&fixed[row_idx * num_cols + col_idx], types::Int64Value(string_seq_id));
+      }
+      ++string_seq_id;
+      string_cols.push_back(static_cast<const arrow::StringArray*>(columns[col_idx]));
+      continue;
+    }
+#define TYPE_CASE(_dt_) \
+  internal::PackKeyColumn<_dt_>(fixed.data(), num_cols, col_idx, columns[col_idx]);
+    PL_SWITCH_FOREACH_DATATYPE(types[col_idx], TYPE_CASE);
+#undef TYPE_CASE
+  }
+
+  std::vector<size_t> hashes(num_rows);
+  const size_t row_bytes = sizeof(types::FixedSizeValueUnion) * num_cols;
+  for (int64_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+    size_t hash =
+        ::util::Hash64(reinterpret_cast<const char*>(&fixed[row_idx * num_cols]), row_bytes);
+    for (const auto* str_col : string_cols) {
+      auto view = str_col->GetView(row_idx);
+      hash = ::px::HashCombine(hash, ::util::Hash64(view.data(), view.size()));
+    }
+    hashes[row_idx] = hash;
+  }
+  return hashes;
+}
+
+/**
+ * Deep-compares a RowTuple against the row of key columns referenced by a ColumnarRowKeyRef.
+ */
+inline bool RowTupleEqualsColumnarRow(const RowTuple& rt, const ColumnarRowKeyRef& ref) {
+  const auto& key_types = *ref.types;
+  DCHECK_EQ(rt.types->size(), key_types.size());
+  for (size_t col_idx = 0; col_idx < key_types.size(); ++col_idx) {
+    bool eq = false;
+#define TYPE_CASE(_dt_) \
+  eq = internal::RowTupleColumnEquals<_dt_>(rt, col_idx, (*ref.columns)[col_idx], ref.row_idx);
+    PL_SWITCH_FOREACH_DATATYPE(key_types[col_idx], TYPE_CASE);
+#undef TYPE_CASE
+    if (!eq) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Hash operator for RowTuple pointers. Transparent so RowTuple-keyed containers can also be
+ * probed with ColumnarRowKeyRefs.
  */
 struct RowTuplePtrHasher {
+  using is_transparent = void;
   size_t operator()(const RowTuple* k) const {
     DCHECK(k != nullptr);
     return k->Hash();
   }
+  size_t operator()(const ColumnarRowKeyRef& k) const { return k.hash; }
 };
 
 /**
- * Equality operator for RowTuple pointers.
+ * Equality operator for RowTuple pointers. Transparent so RowTuple-keyed containers can also be
+ * probed with ColumnarRowKeyRefs.
  */
 struct RowTuplePtrEq {
+  using is_transparent = void;
   bool operator()(const RowTuple* k1, const RowTuple* k2) const { return *k1 == *k2; }
+  bool operator()(const RowTuple* k1, const ColumnarRowKeyRef& k2) const {
+    return RowTupleEqualsColumnarRow(*k1, k2);
+  }
+  bool operator()(const ColumnarRowKeyRef& k1, const RowTuple* k2) const {
+    return RowTupleEqualsColumnarRow(*k2, k1);
+  }
 };
 
 template <class T>
@@ -245,10 +396,16 @@ using AbslRowTupleHashSet = absl::flat_hash_set<RowTuple*, RowTuplePtrHasher, Ro
 
 template <types::DataType DT>
 void ExtractIntoRowTuple(RowTuple* rt, arrow::Array* col, int rt_col_idx, int rt_row_idx) {
-  using UDFValueType = typename types::DataTypeTraits<DT>::value_type;
-  using ArrowArrayType = typename types::DataTypeTraits<DT>::arrow_array_type;
-  rt->SetValue<UDFValueType>(rt_col_idx,
-                             types::GetValue(static_cast<ArrowArrayType*>(col), rt_row_idx));
+  if constexpr (DT == types::DataType::STRING) {
+    // Copy straight from the arrow buffer; short strings land inline in the tuple without any
+    // intermediate std::string materialization.
+    rt->SetStringValue(rt_col_idx, types::GetStringViewFromArrowArray(col, rt_row_idx));
+  } else {
+    using UDFValueType = typename types::DataTypeTraits<DT>::value_type;
+    using ArrowArrayType = typename types::DataTypeTraits<DT>::arrow_array_type;
+    rt->SetValue<UDFValueType>(rt_col_idx,
+                               types::GetValue(static_cast<ArrowArrayType*>(col), rt_row_idx));
+  }
 }
 
 }  // namespace exec
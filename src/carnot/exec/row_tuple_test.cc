@@ -74,7 +74,27 @@ TEST_F(RowTupleTest, check_equality_func_with_same_types) {
 
 TEST_F(RowTupleTest, check_getter) {
   EXPECT_EQ(1, rt1_.GetValue<types::Int64Value>(1).val);
-  EXPECT_EQ("ABC", rt1_.GetValue<types::StringValue>(3));
+  EXPECT_EQ("ABC", rt1_.GetStringValue(3));
+}
+
+TEST_F(RowTupleTest, strings_beyond_inline_capacity) {
+  // Longer than SmallStringValue::kInlineCapacity, so the heap fallback path is exercised.
+  const std::string long_str(100, 'x');
+
+  rt3_.SetValue(0, types::Int64Value(1));
+  rt3_.SetStringValue(1, long_str);
+  rt3_.SetValue(2, types::Int64Value(2));
+  rt3_.SetStringValue(3, "short");
+
+  rt4_.SetValue(0, types::Int64Value(1));
+  rt4_.SetStringValue(1, long_str);
+  rt4_.SetValue(2, types::Int64Value(2));
+  rt4_.SetStringValue(3, "short");
+
+  EXPECT_EQ(long_str, rt3_.GetStringValue(1));
+  EXPECT_EQ("short", rt3_.GetStringValue(3));
+  EXPECT_TRUE(rt3_ == rt4_);
+  EXPECT_EQ(rt3_.Hash(), rt4_.Hash());
 }
 
 TEST_F(RowTupleTest, check_equality_func_with_same_types_same_after_reset) {
@@ -97,6 +117,58 @@ TEST_F(RowTupleTest, check_equality_func_with_same_types_different_after_reset)
   EXPECT_NE(rt1_.Hash(), rt2_.Hash());
 }
 
+TEST_F(RowTupleTest, columnar_hash_matches_row_tuple_hash) {
+  std::vector<types::BoolValue> bools = {false, true};
+  std::vector<types::Int64Value> ints = {1, 2};
+  std::vector<types::Float64Value> floats = {2.0, 3.5};
+  std::vector<types::StringValue> strs = {"ABC", "DEF"};
+  auto bool_arr = types::ToArrow(bools, arrow::default_memory_pool());
+  auto int_arr = types::ToArrow(ints, arrow::default_memory_pool());
+  auto float_arr = types::ToArrow(floats, arrow::default_memory_pool());
+  auto str_arr = types::ToArrow(strs, arrow::default_memory_pool());
+  std::vector<arrow::Array*> columns = {bool_arr.get(), int_arr.get(), float_arr.get(),
+                                        str_arr.get()};
+
+  auto hashes = HashKeyColumns(columns, types_variable1);
+  ASSERT_EQ(2U, hashes.size());
+
+  // Row 0 matches rt1_ built from the same values.
+  EXPECT_EQ(rt1_.Hash(), hashes[0]);
+
+  RowTuple row1(&types_variable1);
+  row1.SetValue(0, types::BoolValue(true));
+  row1.SetValue(1, types::Int64Value(2));
+  row1.SetValue(2, types::Float64Value(3.5));
+  row1.SetValue(3, types::StringValue("DEF"));
+  EXPECT_EQ(row1.Hash(), hashes[1]);
+}
+
+TEST_F(RowTupleTest, columnar_ref_lookup_in_row_tuple_map) {
+  std::vector<types::BoolValue> bools = {false, true};
+  std::vector<types::Int64Value> ints = {1, 2};
+  std::vector<types::Float64Value> floats = {2.0, 3.5};
+  std::vector<types::StringValue> strs = {"ABC", "DEF"};
+  auto bool_arr = types::ToArrow(bools, arrow::default_memory_pool());
+  auto int_arr = types::ToArrow(ints, arrow::default_memory_pool());
+  auto float_arr = types::ToArrow(floats, arrow::default_memory_pool());
+  auto str_arr = types::ToArrow(strs, arrow::default_memory_pool());
+  std::vector<arrow::Array*> columns = {bool_arr.get(), int_arr.get(), float_arr.get(),
+                                        str_arr.get()};
+  auto hashes = HashKeyColumns(columns, types_variable1);
+
+  // rt1_ holds {false, 1, 2.0, "ABC"}, which is row 0 of the columns.
+  AbslRowTupleHashMap<int> map;
+  map[&rt1_] = 42;
+
+  ColumnarRowKeyRef hit{&columns, &types_variable1, 0, hashes[0]};
+  auto it = map.find(hit);
+  ASSERT_NE(map.end(), it);
+  EXPECT_EQ(42, it->second);
+
+  ColumnarRowKeyRef miss{&columns, &types_variable1, 1, hashes[1]};
+  EXPECT_EQ(map.end(), map.find(miss));
+}
+
 using RowTupleDeathTest = RowTupleTest;
 
 TEST_F(RowTupleDeathTest, read_wrong_type) {
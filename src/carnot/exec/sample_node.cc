@@ -0,0 +1,251 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/sample_node.h"
+
+#include <arrow/array.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/substitute.h>
+
+#include "src/carnot/planpb/plan.pb.h"
+#include "src/common/base/base.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/shared/types/type_utils.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowBatch;
+using table_store::schema::RowDescriptor;
+
+namespace {
+
+template <types::DataType DT>
+void SetTupleValue(RowTuple* t, size_t idx, const arrow::Array* arr, int64_t row_idx) {
+  if constexpr (DT == types::DataType::STRING) {
+    t->SetStringValue(idx, types::GetStringViewFromArrowArray(arr, row_idx));
+  } else {
+    using ValueType = typename types::DataTypeTraits<DT>::value_type;
+    t->SetValue(idx, ValueType(types::GetValueFromArrowArray<DT>(arr, row_idx)));
+  }
+}
+
+template <types::DataType DT>
+void AppendTupleValue(types::ColumnWrapper* wrapper, const RowTuple& t, size_t idx) {
+  if constexpr (DT == types::DataType::STRING) {
+    wrapper->AppendString(t.GetStringValue(idx));
+  } else {
+    using ValueType = typename types::DataTypeTraits<DT>::value_type;
+    static_cast<typename types::ColumnWrapperType<DT>::type*>(wrapper)->Append(
+        t.GetValue<ValueType>(idx));
+  }
+}
+
+}  // namespace
+
+std::string SampleNode::DebugStringImpl() {
+  return absl::Substitute("Exec::SampleNode<$0>", plan_node_->DebugString());
+}
+
+Status SampleNode::InitImpl(const plan::Operator& plan_node) {
+  CHECK(plan_node.op_type() == planpb::OperatorType::SAMPLE_OPERATOR);
+  const auto* sample_plan_node = static_cast<const plan::SampleOperator*>(&plan_node);
+  // copy the plan node to local object;
+  plan_node_ = std::make_unique<plan::SampleOperator>(*sample_plan_node);
+
+  tuple_types_ = output_descriptor_->types();
+
+  const auto& selected_cols = plan_node_->selected_cols();
+  group_data_types_.reserve(plan_node_->group_indices().size());
+  for (int64_t group_idx : plan_node_->group_indices()) {
+    auto it = std::find(selected_cols.begin(), selected_cols.end(), group_idx);
+    if (it == selected_cols.end()) {
+      return error::InvalidArgument("Sample group column (col $0) is not in the selected columns",
+                                    group_idx);
+    }
+    group_data_types_.push_back(tuple_types_[it - selected_cols.begin()]);
+  }
+
+  return Status::OK();
+}
+
+Status SampleNode::PrepareImpl(ExecState* /*exec_state*/) { return Status::OK(); }
+
+Status SampleNode::OpenImpl(ExecState* /*exec_state*/) { return Status::OK(); }
+
+Status SampleNode::CloseImpl(ExecState* /*exec_state*/) {
+  uniform_reservoir_.rows.clear();
+  group_reservoirs_.clear();
+  reservoir_pool_.Clear();
+  key_pool_.Clear();
+  return Status::OK();
+}
+
+std::unique_ptr<RowTuple> SampleNode::MaterializeRow(const RowBatch& rb, int64_t row_idx) const {
+  auto tuple = std::make_unique<RowTuple>(&tuple_types_);
+  const auto& selected_cols = plan_node_->selected_cols();
+  for (size_t i = 0; i < selected_cols.size(); ++i) {
+    auto arr = rb.ColumnAt(selected_cols[i]).get();
+#define TYPE_CASE(_dt_) SetTupleValue<_dt_>(tuple.get(), i, arr, row_idx)
+    PL_SWITCH_FOREACH_DATATYPE(tuple_types_[i], TYPE_CASE);
+#undef TYPE_CASE
+  }
+  return tuple;
+}
+
+void SampleNode::AdvanceNextTake() {
+  // Algorithm L: the gap to the next admitted row follows a geometric-style distribution in the
+  // running weight, so all the skipped rows cost one draw instead of one draw each.
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  next_take_ += static_cast<int64_t>(std::log(uniform(rng_)) / std::log1p(-skip_w_)) + 1;
+}
+
+Status SampleNode::ConsumeUniform(const RowBatch& rb) {
+  const int64_t k = plan_node_->num_rows();
+  const int64_t num_rows = rb.num_rows();
+  const int64_t batch_start = uniform_reservoir_.rows_seen;
+  int64_t row_idx = 0;
+
+  // Fill phase: the first k rows are all admitted.
+  while (row_idx < num_rows && static_cast<int64_t>(uniform_reservoir_.rows.size()) < k) {
+    uniform_reservoir_.rows.push_back(MaterializeRow(rb, row_idx));
+    ++row_idx;
+    if (static_cast<int64_t>(uniform_reservoir_.rows.size()) == k) {
+      // Reservoir just filled: seed the skip state and jump from the last admitted row.
+      std::uniform_real_distribution<double> uniform(0.0, 1.0);
+      skip_w_ = std::exp(std::log(uniform(rng_)) / static_cast<double>(k));
+      next_take_ = batch_start + row_idx - 1;
+      AdvanceNextTake();
+    }
+  }
+
+  // Skip phase: batches that fall entirely inside a skip only advance the seen counter.
+  const int64_t batch_end = batch_start + num_rows;
+  while (static_cast<int64_t>(uniform_reservoir_.rows.size()) == k && next_take_ < batch_end) {
+    std::uniform_int_distribution<int64_t> slot(0, k - 1);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    uniform_reservoir_.rows[slot(rng_)] = MaterializeRow(rb, next_take_ - batch_start);
+    skip_w_ *= std::exp(std::log(uniform(rng_)) / static_cast<double>(k));
+    AdvanceNextTake();
+  }
+
+  uniform_reservoir_.rows_seen = batch_end;
+  return Status::OK();
+}
+
+Status SampleNode::ConsumeStratified(const RowBatch& rb) {
+  const int64_t k = plan_node_->num_rows();
+  const int64_t num_rows = rb.num_rows();
+
+  // Keep the shared_ptrs alive for the duration of the batch while hashing raw pointers.
+  std::vector<std::shared_ptr<arrow::Array>> group_columns_shared;
+  std::vector<arrow::Array*> group_columns;
+  group_columns_shared.reserve(plan_node_->group_indices().size());
+  group_columns.reserve(plan_node_->group_indices().size());
+  for (int64_t group_idx : plan_node_->group_indices()) {
+    group_columns_shared.push_back(rb.ColumnAt(group_idx));
+    group_columns.push_back(group_columns_shared.back().get());
+  }
+
+  std::vector<size_t> hashes = HashKeyColumns(group_columns, group_data_types_);
+
+  for (int64_t row_idx = 0; row_idx < num_rows; ++row_idx) {
+    ColumnarRowKeyRef ref{&group_columns, &group_data_types_, row_idx, hashes[row_idx]};
+    auto it = group_reservoirs_.find(ref);
+    if (it == group_reservoirs_.end()) {
+      RowTuple* key = key_pool_.Add(new RowTuple(&group_data_types_));
+      for (size_t col_idx = 0; col_idx < group_columns.size(); ++col_idx) {
+#define TYPE_CASE(_dt_) \
+  ExtractIntoRowTuple<_dt_>(key, group_columns[col_idx], col_idx, row_idx);
+        PL_SWITCH_FOREACH_DATATYPE(group_data_types_[col_idx], TYPE_CASE);
+#undef TYPE_CASE
+      }
+      it = group_reservoirs_.emplace(key, reservoir_pool_.Add(new Reservoir())).first;
+    }
+    Reservoir* reservoir = it->second;
+    ++reservoir->rows_seen;
+    if (static_cast<int64_t>(reservoir->rows.size()) < k) {
+      reservoir->rows.push_back(MaterializeRow(rb, row_idx));
+      continue;
+    }
+    // Algorithm R per stratum: admit with probability k / rows_seen.
+    std::uniform_int_distribution<int64_t> slot(0, reservoir->rows_seen - 1);
+    int64_t j = slot(rng_);
+    if (j < k) {
+      reservoir->rows[j] = MaterializeRow(rb, row_idx);
+    }
+  }
+  return Status::OK();
+}
+
+Status SampleNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb, size_t) {
+  if (plan_node_->group_indices().empty()) {
+    PL_RETURN_IF_ERROR(ConsumeUniform(rb));
+  } else {
+    PL_RETURN_IF_ERROR(ConsumeStratified(rb));
+  }
+
+  if (rb.eos()) {
+    return EmitResults(exec_state);
+  }
+  return Status::OK();
+}
+
+Status SampleNode::EmitResults(ExecState* exec_state) {
+  std::vector<const Reservoir*> reservoirs;
+  int64_t total_rows = 0;
+  if (plan_node_->group_indices().empty()) {
+    reservoirs.push_back(&uniform_reservoir_);
+    total_rows = uniform_reservoir_.rows.size();
+  } else {
+    reservoirs.reserve(group_reservoirs_.size());
+    for (const auto& [key, reservoir] : group_reservoirs_) {
+      PL_UNUSED(key);
+      reservoirs.push_back(reservoir);
+      total_rows += reservoir->rows.size();
+    }
+  }
+
+  RowBatch output_rb(*output_descriptor_, total_rows);
+  for (size_t col_idx = 0; col_idx < tuple_types_.size(); ++col_idx) {
+    auto wrapper = types::ColumnWrapper::Make(tuple_types_[col_idx], 0);
+    for (const auto* reservoir : reservoirs) {
+      for (const auto& tuple : reservoir->rows) {
+#define TYPE_CASE(_dt_) AppendTupleValue<_dt_>(wrapper.get(), *tuple, col_idx)
+        PL_SWITCH_FOREACH_DATATYPE(tuple_types_[col_idx], TYPE_CASE);
+#undef TYPE_CASE
+      }
+    }
+    PL_RETURN_IF_ERROR(output_rb.AddColumn(wrapper->ConvertToArrow(exec_state->exec_mem_pool())));
+  }
+  output_rb.set_eow(true);
+  output_rb.set_eos(true);
+  uniform_reservoir_.rows.clear();
+  group_reservoirs_.clear();
+  return SendRowBatchToChildren(exec_state, output_rb);
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "src/carnot/exec/exec_node.h"
+#include "src/carnot/exec/exec_state.h"
+#include "src/carnot/exec/row_tuple.h"
+#include "src/carnot/plan/operators.h"
+#include "src/common/base/base.h"
+#include "src/common/base/status.h"
+#include "src/common/memory/memory.h"
+#include "src/table_store/table_store.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * SampleNode keeps a bounded uniform random sample of its input rows and emits it at end of
+ * stream.
+ *
+ * The uniform mode runs reservoir sampling with skips (Li's algorithm L): once the reservoir is
+ * full, the index of the next admitted row is drawn from a geometric-style distribution, so
+ * batches that fall entirely inside a skip are accounted with a single counter update and no
+ * per-row work. The stratified mode keeps one reservoir per distinct group key, hashing the
+ * group columns columnar-ly with HashKeyColumns, so low-volume groups survive next to
+ * high-volume ones. Either way, at most num_rows rows (per stratum) are ever materialized.
+ */
+class SampleNode : public ProcessingNode {
+ public:
+  SampleNode() = default;
+  virtual ~SampleNode() = default;
+
+  // Tests fix the seed to make the sampled indices reproducible.
+  void testing_set_seed(uint64_t seed) { rng_.seed(seed); }
+
+ protected:
+  std::string DebugStringImpl() override;
+  Status InitImpl(const plan::Operator& plan_node) override;
+  Status PrepareImpl(ExecState* exec_state) override;
+  Status OpenImpl(ExecState* exec_state) override;
+  Status CloseImpl(ExecState* exec_state) override;
+  Status ConsumeNextImpl(ExecState* exec_state, const table_store::schema::RowBatch& rb,
+                         size_t parent_index) override;
+
+ private:
+  struct Reservoir {
+    int64_t rows_seen = 0;
+    std::vector<std::unique_ptr<RowTuple>> rows;
+  };
+
+  std::unique_ptr<RowTuple> MaterializeRow(const table_store::schema::RowBatch& rb,
+                                           int64_t row_idx) const;
+  Status ConsumeUniform(const table_store::schema::RowBatch& rb);
+  Status ConsumeStratified(const table_store::schema::RowBatch& rb);
+  // Draws the gap until the next admitted row and advances the skip state (algorithm L).
+  void AdvanceNextTake();
+  Status EmitResults(ExecState* exec_state);
+
+  std::unique_ptr<plan::SampleOperator> plan_node_;
+  // Types of the selected columns; backs the RowTuples in the reservoirs.
+  std::vector<types::DataType> tuple_types_;
+  // Types of the group columns, for stratified mode.
+  std::vector<types::DataType> group_data_types_;
+
+  std::mt19937_64 rng_{std::random_device{}()};
+
+  // Uniform mode state. next_take_ is the absolute input row index of the next admitted row;
+  // skip_w_ is algorithm L's running weight.
+  Reservoir uniform_reservoir_;
+  int64_t next_take_ = 0;
+  double skip_w_ = 0;
+
+  // Stratified mode state: one reservoir per group key. The key tuples are owned by key_pool_.
+  AbslRowTupleHashMap<Reservoir*> group_reservoirs_;
+  ObjectPool key_pool_{"sample_keys_pool"};
+  ObjectPool reservoir_pool_{"sample_reservoirs_pool"};
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/sample_node.h"
+
+#include <memory>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <sole.hpp>
+
+#include "src/carnot/exec/test_utils.h"
+#include "src/carnot/planpb/test_proto.h"
+#include "src/carnot/udf/base.h"
+#include "src/carnot/udf/registry.h"
+#include "src/common/base/base.h"
+#include "src/shared/types/types.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowBatch;
+using table_store::schema::RowDescriptor;
+using ::testing::_;
+using types::Int64Value;
+using udf::FunctionContext;
+
+class SampleNodeTest : public ::testing::Test {
+ public:
+  SampleNodeTest() {
+    func_registry_ = std::make_unique<udf::Registry>("test_registry");
+
+    auto table_store = std::make_shared<table_store::TableStore>();
+
+    exec_state_ = std::make_unique<ExecState>(func_registry_.get(), table_store,
+                                              MockResultSinkStubGenerator, MockMetricsStubGenerator,
+                                              MockTraceStubGenerator, sole::uuid4(), nullptr);
+  }
+
+ protected:
+  std::unique_ptr<ExecState> exec_state_;
+  std::unique_ptr<udf::Registry> func_registry_;
+};
+
+// With fewer input rows than the reservoir size, every row survives in input order.
+TEST_F(SampleNodeTest, fewer_rows_than_reservoir) {
+  auto plan_node = plan::SampleOperator::FromProto(planpb::testutils::CreateTestSample1PB(), 1);
+  RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<SampleNode, plan::SampleOperator>(*plan_node, output_rd,
+                                                                       {input_rd}, exec_state_.get());
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 2, /*eow*/ true, /*eos*/ true)
+                       .AddColumn<types::Int64Value>({1, 2})
+                       .AddColumn<types::Int64Value>({5, 10})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 2, true, true)
+                          .AddColumn<types::Int64Value>({1, 2})
+                          .AddColumn<types::Int64Value>({5, 10})
+                          .get())
+      .Close();
+}
+
+// The input columns are constant, so any 3-row sample has a known value; this pins down the
+// output size through the fill and skip phases without depending on which rows the RNG admits.
+TEST_F(SampleNodeTest, uniform_sample_is_bounded) {
+  auto plan_node = plan::SampleOperator::FromProto(planpb::testutils::CreateTestSample1PB(), 1);
+  RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<SampleNode, plan::SampleOperator>(*plan_node, output_rd,
+                                                                       {input_rd}, exec_state_.get());
+  tester.node()->testing_set_seed(42);
+
+  std::vector<types::Int64Value> col0(50, 7);
+  std::vector<types::Int64Value> col1(50, 9);
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 50, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<types::Int64Value>(col0)
+                       .AddColumn<types::Int64Value>(col1)
+                       .get(),
+                   0, 0)
+      .ConsumeNext(RowBatchBuilder(input_rd, 50, /*eow*/ true, /*eos*/ true)
+                       .AddColumn<types::Int64Value>(col0)
+                       .AddColumn<types::Int64Value>(col1)
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 3, true, true)
+                          .AddColumn<types::Int64Value>({7, 7, 7})
+                          .AddColumn<types::Int64Value>({9, 9, 9})
+                          .get())
+      .Close();
+}
+
+// Stratified mode keeps up to num_rows rows per distinct group: the low-volume group survives
+// next to the high-volume one. Column 1 is constant within each group, so the output values are
+// deterministic even though the admitted row indices are not.
+TEST_F(SampleNodeTest, stratified_keeps_every_group) {
+  auto plan_node = plan::SampleOperator::FromProto(planpb::testutils::CreateTestSample2PB(), 1);
+  RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<SampleNode, plan::SampleOperator>(*plan_node, output_rd,
+                                                                       {input_rd}, exec_state_.get());
+  tester.node()->testing_set_seed(42);
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 6, /*eow*/ true, /*eos*/ true)
+                       .AddColumn<types::Int64Value>({1, 1, 1, 1, 1, 2})
+                       .AddColumn<types::Int64Value>({10, 10, 10, 10, 10, 20})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 3, true, true)
+                          .AddColumn<types::Int64Value>({1, 1, 2})
+                          .AddColumn<types::Int64Value>({10, 10, 20})
+                          .get(),
+                      /*ordered*/ false)
+      .Close();
+}
+
+TEST_F(SampleNodeTest, empty_input) {
+  auto plan_node = plan::SampleOperator::FromProto(planpb::testutils::CreateTestSample1PB(), 1);
+  RowDescriptor input_rd({types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<SampleNode, plan::SampleOperator>(*plan_node, output_rd,
+                                                                       {input_rd}, exec_state_.get());
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 0, /*eow*/ true, /*eos*/ true)
+                       .AddColumn<types::Int64Value>({})
+                       .AddColumn<types::Int64Value>({})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 0, true, true)
+                          .AddColumn<types::Int64Value>({})
+                          .AddColumn<types::Int64Value>({})
+                          .get())
+      .Close();
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -495,10 +495,15 @@ class ExecNodeTester {
   template <px::types::DataType DT>
   void SetRowTupleValues(RowTuple* expected_rt, RowTuple* actual_rt, arrow::Array* expected_arr,
                          arrow::Array* actual_arr, int64_t col, int64_t row) {
-    using ValueType = typename px::types::DataTypeTraits<DT>::value_type;
+    if constexpr (DT == px::types::DataType::STRING) {
+      expected_rt->SetStringValue(col, types::GetStringViewFromArrowArray(expected_arr, row));
+      actual_rt->SetStringValue(col, types::GetStringViewFromArrowArray(actual_arr, row));
+    } else {
+      using ValueType = typename px::types::DataTypeTraits<DT>::value_type;
 
-    expected_rt->SetValue(col, ValueType(types::GetValueFromArrowArray<DT>(expected_arr, row)));
-    actual_rt->SetValue(col, ValueType(types::GetValueFromArrowArray<DT>(actual_arr, row)));
+      expected_rt->SetValue(col, ValueType(types::GetValueFromArrowArray<DT>(expected_arr, row)));
+      actual_rt->SetValue(col, ValueType(types::GetValueFromArrowArray<DT>(actual_arr, row)));
+    }
   }
 
   void ValidateUnorderedRowBatch(const table_store::schema::RowBatch& expected_rb,
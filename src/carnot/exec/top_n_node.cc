@@ -0,0 +1,230 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/top_n_node.h"
+
+#include <arrow/array.h>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/substitute.h>
+
+#include "src/carnot/planpb/plan.pb.h"
+#include "src/common/base/base.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/shared/types/type_utils.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowBatch;
+using table_store::schema::RowDescriptor;
+
+namespace {
+
+template <types::DataType DT>
+int CompareTupleValues(const RowTuple& a, const RowTuple& b, size_t idx) {
+  if constexpr (DT == types::DataType::STRING) {
+    return a.GetStringValue(idx).compare(b.GetStringValue(idx));
+  } else {
+    using ValueType = typename types::DataTypeTraits<DT>::value_type;
+    const auto& lhs = a.GetValue<ValueType>(idx);
+    const auto& rhs = b.GetValue<ValueType>(idx);
+    if (lhs < rhs) {
+      return -1;
+    }
+    if (rhs < lhs) {
+      return 1;
+    }
+    return 0;
+  }
+}
+
+template <types::DataType DT>
+int CompareArrayToTuple(const arrow::Array* arr, int64_t row_idx, const RowTuple& t, size_t idx) {
+  if constexpr (DT == types::DataType::STRING) {
+    return types::GetStringViewFromArrowArray(arr, row_idx).compare(t.GetStringValue(idx));
+  } else {
+    using ValueType = typename types::DataTypeTraits<DT>::value_type;
+    const ValueType lhs(types::GetValueFromArrowArray<DT>(arr, row_idx));
+    const auto& rhs = t.GetValue<ValueType>(idx);
+    if (lhs < rhs) {
+      return -1;
+    }
+    if (rhs < lhs) {
+      return 1;
+    }
+    return 0;
+  }
+}
+
+template <types::DataType DT>
+void SetTupleValue(RowTuple* t, size_t idx, const arrow::Array* arr, int64_t row_idx) {
+  if constexpr (DT == types::DataType::STRING) {
+    t->SetStringValue(idx, types::GetStringViewFromArrowArray(arr, row_idx));
+  } else {
+    using ValueType = typename types::DataTypeTraits<DT>::value_type;
+    t->SetValue(idx, ValueType(types::GetValueFromArrowArray<DT>(arr, row_idx)));
+  }
+}
+
+template <types::DataType DT>
+void AppendTupleValue(types::ColumnWrapper* wrapper, const RowTuple& t, size_t idx) {
+  if constexpr (DT == types::DataType::STRING) {
+    wrapper->AppendString(t.GetStringValue(idx));
+  } else {
+    using ValueType = typename types::DataTypeTraits<DT>::value_type;
+    static_cast<typename types::ColumnWrapperType<DT>::type*>(wrapper)->Append(
+        t.GetValue<ValueType>(idx));
+  }
+}
+
+}  // namespace
+
+std::string TopNNode::DebugStringImpl() {
+  return absl::Substitute("Exec::TopNNode<$0>", plan_node_->DebugString());
+}
+
+Status TopNNode::InitImpl(const plan::Operator& plan_node) {
+  CHECK(plan_node.op_type() == planpb::OperatorType::TOPN_OPERATOR);
+  const auto* topn_plan_node = static_cast<const plan::TopNOperator*>(&plan_node);
+  // copy the plan node to local object;
+  plan_node_ = std::make_unique<plan::TopNOperator>(*topn_plan_node);
+
+  tuple_types_ = output_descriptor_->types();
+
+  const auto& selected_cols = plan_node_->selected_cols();
+  key_tuple_idxs_.reserve(plan_node_->sort_keys().size());
+  for (const auto& key : plan_node_->sort_keys()) {
+    auto it = std::find(selected_cols.begin(), selected_cols.end(), key.column_index);
+    if (it == selected_cols.end()) {
+      return error::InvalidArgument("TopN sort key (col $0) is not in the selected columns",
+                                    key.column_index);
+    }
+    key_tuple_idxs_.push_back(it - selected_cols.begin());
+  }
+
+  return Status::OK();
+}
+
+Status TopNNode::PrepareImpl(ExecState* /*exec_state*/) { return Status::OK(); }
+
+Status TopNNode::OpenImpl(ExecState* /*exec_state*/) { return Status::OK(); }
+
+Status TopNNode::CloseImpl(ExecState* /*exec_state*/) {
+  heap_.clear();
+  return Status::OK();
+}
+
+bool TopNNode::TupleLessThan(const std::unique_ptr<RowTuple>& a,
+                             const std::unique_ptr<RowTuple>& b) const {
+  for (size_t i = 0; i < key_tuple_idxs_.size(); ++i) {
+    size_t idx = key_tuple_idxs_[i];
+    int cmp = 0;
+#define TYPE_CASE(_dt_) cmp = CompareTupleValues<_dt_>(*a, *b, idx)
+    PL_SWITCH_FOREACH_DATATYPE(tuple_types_[idx], TYPE_CASE);
+#undef TYPE_CASE
+    if (cmp != 0) {
+      return plan_node_->sort_keys()[i].ascending ? cmp < 0 : cmp > 0;
+    }
+  }
+  return false;
+}
+
+bool TopNNode::RowBeforeTuple(const RowBatch& rb, int64_t row_idx, const RowTuple& tuple) const {
+  for (size_t i = 0; i < key_tuple_idxs_.size(); ++i) {
+    size_t idx = key_tuple_idxs_[i];
+    auto arr = rb.ColumnAt(plan_node_->sort_keys()[i].column_index).get();
+    int cmp = 0;
+#define TYPE_CASE(_dt_) cmp = CompareArrayToTuple<_dt_>(arr, row_idx, tuple, idx)
+    PL_SWITCH_FOREACH_DATATYPE(tuple_types_[idx], TYPE_CASE);
+#undef TYPE_CASE
+    if (cmp != 0) {
+      return plan_node_->sort_keys()[i].ascending ? cmp < 0 : cmp > 0;
+    }
+  }
+  return false;
+}
+
+std::unique_ptr<RowTuple> TopNNode::MaterializeRow(const RowBatch& rb, int64_t row_idx) const {
+  auto tuple = std::make_unique<RowTuple>(&tuple_types_);
+  const auto& selected_cols = plan_node_->selected_cols();
+  for (size_t i = 0; i < selected_cols.size(); ++i) {
+    auto arr = rb.ColumnAt(selected_cols[i]).get();
+#define TYPE_CASE(_dt_) SetTupleValue<_dt_>(tuple.get(), i, arr, row_idx)
+    PL_SWITCH_FOREACH_DATATYPE(tuple_types_[i], TYPE_CASE);
+#undef TYPE_CASE
+  }
+  return tuple;
+}
+
+Status TopNNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb, size_t) {
+  size_t record_limit = plan_node_->record_limit();
+  auto less_than = [this](const std::unique_ptr<RowTuple>& a, const std::unique_ptr<RowTuple>& b) {
+    return TupleLessThan(a, b);
+  };
+
+  for (int64_t row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
+    if (heap_.size() < record_limit) {
+      heap_.push_back(MaterializeRow(rb, row_idx));
+      std::push_heap(heap_.begin(), heap_.end(), less_than);
+      continue;
+    }
+    // The heap is full; only rows that sort strictly before the current worst row are admitted.
+    if (record_limit == 0 || !RowBeforeTuple(rb, row_idx, *heap_.front())) {
+      continue;
+    }
+    std::pop_heap(heap_.begin(), heap_.end(), less_than);
+    heap_.back() = MaterializeRow(rb, row_idx);
+    std::push_heap(heap_.begin(), heap_.end(), less_than);
+  }
+
+  if (rb.eos()) {
+    return EmitResults(exec_state);
+  }
+  return Status::OK();
+}
+
+Status TopNNode::EmitResults(ExecState* exec_state) {
+  auto less_than = [this](const std::unique_ptr<RowTuple>& a, const std::unique_ptr<RowTuple>& b) {
+    return TupleLessThan(a, b);
+  };
+  std::sort_heap(heap_.begin(), heap_.end(), less_than);
+
+  RowBatch output_rb(*output_descriptor_, heap_.size());
+  for (size_t col_idx = 0; col_idx < tuple_types_.size(); ++col_idx) {
+    auto wrapper = types::ColumnWrapper::Make(tuple_types_[col_idx], 0);
+    for (const auto& tuple : heap_) {
+#define TYPE_CASE(_dt_) AppendTupleValue<_dt_>(wrapper.get(), *tuple, col_idx)
+      PL_SWITCH_FOREACH_DATATYPE(tuple_types_[col_idx], TYPE_CASE);
+#undef TYPE_CASE
+    }
+    PL_RETURN_IF_ERROR(output_rb.AddColumn(wrapper->ConvertToArrow(exec_state->exec_mem_pool())));
+  }
+  output_rb.set_eow(true);
+  output_rb.set_eos(true);
+  heap_.clear();
+  return SendRowBatchToChildren(exec_state, output_rb);
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
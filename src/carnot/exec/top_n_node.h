@@ -0,0 +1,79 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/carnot/exec/exec_node.h"
+#include "src/carnot/exec/exec_state.h"
+#include "src/carnot/exec/row_tuple.h"
+#include "src/carnot/plan/operators.h"
+#include "src/common/base/base.h"
+#include "src/common/base/status.h"
+#include "src/table_store/table_store.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * TopNNode streams its input through a bounded heap of at most `limit` rows and emits the
+ * retained rows in sort-key order at end of stream. It never materializes more than `limit`
+ * rows, so sort+head style queries cost k*log(n) instead of a full sort over the input.
+ */
+class TopNNode : public ProcessingNode {
+ public:
+  TopNNode() = default;
+  virtual ~TopNNode() = default;
+
+ protected:
+  std::string DebugStringImpl() override;
+  Status InitImpl(const plan::Operator& plan_node) override;
+  Status PrepareImpl(ExecState* exec_state) override;
+  Status OpenImpl(ExecState* exec_state) override;
+  Status CloseImpl(ExecState* exec_state) override;
+  Status ConsumeNextImpl(ExecState* exec_state, const table_store::schema::RowBatch& rb,
+                         size_t parent_index) override;
+
+ private:
+  // Returns true if tuple a should appear before tuple b in the sorted output.
+  bool TupleLessThan(const std::unique_ptr<RowTuple>& a, const std::unique_ptr<RowTuple>& b) const;
+  // Same ordering, but with the left-hand row still in its input batch. Used to reject rows
+  // without materializing them when the heap is already full.
+  bool RowBeforeTuple(const table_store::schema::RowBatch& rb, int64_t row_idx,
+                      const RowTuple& tuple) const;
+  std::unique_ptr<RowTuple> MaterializeRow(const table_store::schema::RowBatch& rb,
+                                           int64_t row_idx) const;
+  Status EmitResults(ExecState* exec_state);
+
+  std::unique_ptr<plan::TopNOperator> plan_node_;
+  // Types of the selected columns; backs the RowTuples in the heap.
+  std::vector<types::DataType> tuple_types_;
+  // Position of each sort key within the selected columns, aligned with plan_node_->sort_keys().
+  std::vector<size_t> key_tuple_idxs_;
+  // Max-heap under TupleLessThan: heap_[0] is the worst retained row, the first to be evicted.
+  std::vector<std::unique_ptr<RowTuple>> heap_;
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -20,9 +20,12 @@
 
 #include <arrow/array/builder_base.h>
 #include <arrow/memory_pool.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <magic_enum.hpp>
@@ -36,6 +39,12 @@
 #include "src/shared/types/typespb/wrapper/types_pb_wrapper.h"
 #include "src/table_store/table_store.h"
 
+DEFINE_int64(carnot_udtf_partitions, gflags::Int64FromEnv("PL_CARNOT_UDTF_PARTITIONS", 1),
+             "Number of concurrent instances to run for UDTF sources whose UDTF implements the "
+             "optional partitioning interface. Each instance produces one partition of the "
+             "output on its own thread and the batches are interleaved. Values of 0 or 1 run a "
+             "single instance.");
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -55,17 +64,12 @@ Status UDTFSourceNode::InitImpl(const plan::Operator& plan_node) {
 }
 
 Status UDTFSourceNode::PrepareImpl(ExecState* exec_state) {
-  // Always has more batches to start with.
-  has_more_batches_ = true;
   PL_ASSIGN_OR_RETURN(udtf_def_,
                       exec_state->func_registry()->GetUDTFDefinition(plan_node_->name()));
   return Status::OK();
 }
 
 Status UDTFSourceNode::OpenImpl(ExecState* exec_state) {
-  function_ctx_ = exec_state->CreateFunctionContext();
-  udtf_inst_ = udtf_def_->Make();
-
   ObjectPool init_args_pool{"udtf_init_args_pool"};
   std::vector<const types::BaseValueType*> init_args;
 
@@ -93,36 +97,103 @@ Status UDTFSourceNode::OpenImpl(ExecState* exec_state) {
     }
   }
 
-  return udtf_def_->ExecInit(udtf_inst_.get(), function_ctx_.get(), init_args);
+  int64_t num_partitions = 1;
+  if (udtf_def_->supports_partitioning() && FLAGS_carnot_udtf_partitions > 1) {
+    num_partitions = FLAGS_carnot_udtf_partitions;
+  }
+
+  partitions_.resize(num_partitions);
+  for (int64_t partition_idx = 0; partition_idx < num_partitions; ++partition_idx) {
+    auto& partition = partitions_[partition_idx];
+    partition.function_ctx = exec_state->CreateFunctionContext();
+    partition.udtf_inst = udtf_def_->Make();
+    PL_RETURN_IF_ERROR(
+        udtf_def_->ExecInit(partition.udtf_inst.get(), partition.function_ctx.get(), init_args));
+    if (num_partitions > 1) {
+      PL_RETURN_IF_ERROR(
+          udtf_def_->SetPartition(partition.udtf_inst.get(), partition_idx, num_partitions));
+    }
+  }
+  return Status::OK();
 }
 
 Status UDTFSourceNode::CloseImpl(ExecState* /*exec_state*/) { return Status::OK(); }
 
-Status UDTFSourceNode::GenerateNextImpl(ExecState* exec_state) {
-  std::vector<std::unique_ptr<arrow::ArrayBuilder>> outputs;
+Status UDTFSourceNode::GenerateRound() {
+  if (udtf_def_->has_deferred_init() && !waited_for_deferred_init_) {
+    for (auto& partition : partitions_) {
+      PL_RETURN_IF_ERROR(udtf_def_->WaitForInit(partition.udtf_inst.get()));
+    }
+    waited_for_deferred_init_ = true;
+  }
 
-  for (const auto& r : udtf_def_->output_relation()) {
-    outputs.emplace_back(types::MakeArrowBuilder(r.type(), arrow::default_memory_pool()));
+  std::vector<size_t> active;
+  for (size_t i = 0; i < partitions_.size(); ++i) {
+    if (partitions_[i].has_more) {
+      active.push_back(i);
+    }
   }
 
+  // Build the output builders on the execution thread; each active partition writes only to its
+  // own set.
+  std::vector<std::vector<std::unique_ptr<arrow::ArrayBuilder>>> outputs(active.size());
   // TODO(zasgar): Change Exec to take in unique_ptrs.
-  std::vector<arrow::ArrayBuilder*> outputs_raw;
-  for (auto& out : outputs) {
-    outputs_raw.emplace_back(out.get());
+  std::vector<std::vector<arrow::ArrayBuilder*>> outputs_raw(active.size());
+  for (size_t i = 0; i < active.size(); ++i) {
+    for (const auto& r : udtf_def_->output_relation()) {
+      outputs[i].emplace_back(types::MakeArrowBuilder(r.type(), arrow::default_memory_pool()));
+    }
+    DCHECK_GT(outputs[i].size(), 0);
+    for (auto& out : outputs[i]) {
+      outputs_raw[i].emplace_back(out.get());
+    }
   }
 
-  auto has_more_batches = udtf_def_->ExecBatchUpdate(udtf_inst_.get(), function_ctx_.get(),
-                                                     kUDTFBatchSize, &outputs_raw);
+  // Partition instances share no state, so they can each generate their batch on their own
+  // thread.
+  auto run_partition = [this, &active, &outputs_raw](size_t i) {
+    auto& partition = partitions_[active[i]];
+    partition.has_more = udtf_def_->ExecBatchUpdate(
+        partition.udtf_inst.get(), partition.function_ctx.get(), kUDTFBatchSize, &outputs_raw[i]);
+  };
+  if (active.size() > 1) {
+    std::vector<std::thread> workers;
+    workers.reserve(active.size());
+    for (size_t i = 0; i < active.size(); ++i) {
+      workers.emplace_back(run_partition, i);
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  } else if (active.size() == 1) {
+    run_partition(0);
+  }
 
-  DCHECK_GT(outputs.size(), 0);
+  const bool all_done = std::none_of(partitions_.begin(), partitions_.end(),
+                                     [](const PartitionState& p) { return p.has_more; });
 
-  auto rb_or_s = table_store::schema::RowBatch::FromColumnBuilders(
-      *output_descriptor_, /*eow*/ !has_more_batches, /*eow*/ !has_more_batches, &outputs);
-  if (!rb_or_s.ok()) {
-    return rb_or_s.status();
+  for (size_t i = 0; i < active.size(); ++i) {
+    // Only the final batch of the final round carries eow/eos.
+    const bool last = all_done && (i == active.size() - 1);
+    PL_ASSIGN_OR_RETURN(auto rb, table_store::schema::RowBatch::FromColumnBuilders(
+                                     *output_descriptor_, /*eow*/ last, /*eos*/ last, &outputs[i]));
+    pending_batches_.push_back(std::move(rb));
   }
-  auto rb = rb_or_s.ConsumeValueOrDie();
+  if (pending_batches_.empty()) {
+    // All partitions were already exhausted; emit the end-of-stream marker.
+    PL_ASSIGN_OR_RETURN(auto rb, table_store::schema::RowBatch::WithZeroRows(
+                                     *output_descriptor_, /*eow*/ true, /*eos*/ true));
+    pending_batches_.push_back(std::move(rb));
+  }
+  return Status::OK();
+}
 
+Status UDTFSourceNode::GenerateNextImpl(ExecState* exec_state) {
+  if (pending_batches_.empty()) {
+    PL_RETURN_IF_ERROR(GenerateRound());
+  }
+  auto rb = std::move(pending_batches_.front());
+  pending_batches_.pop_front();
   return SendRowBatchToChildren(exec_state, *rb);
 }
 
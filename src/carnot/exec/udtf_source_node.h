@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "src/carnot/udf/udtf.h"
 #include "src/common/base/base.h"
 #include "src/common/base/status.h"
+#include "src/table_store/schema/row_batch.h"
 #include "src/table_store/schema/row_descriptor.h"
 
 namespace px {
@@ -53,11 +55,27 @@ class UDTFSourceNode : public SourceNode {
   Status GenerateNextImpl(ExecState* exec_state) override;
 
  private:
-  bool has_more_batches_ = true;
+  // One instance of the UDTF. There is a single partition unless the UDTF implements the
+  // optional partitioning interface and --carnot_udtf_partitions asks for more.
+  struct PartitionState {
+    std::unique_ptr<udf::FunctionContext> function_ctx;
+    std::unique_ptr<udf::AnyUDTF> udtf_inst;
+    bool has_more = true;
+  };
+
+  // Runs one generation round: every partition that still has records produces a batch, with
+  // partitions running concurrently. The resulting batches are queued onto pending_batches_.
+  Status GenerateRound();
+
   udf::UDTFDefinition* udtf_def_ = nullptr;
   std::unique_ptr<plan::UDTFSourceOperator> plan_node_;
-  std::unique_ptr<udf::FunctionContext> function_ctx_;
-  std::unique_ptr<udf::AnyUDTF> udtf_inst_;
+  std::vector<PartitionState> partitions_;
+  // Whether WaitForInit has been called for UDTFs with deferred init. The wait happens right
+  // before the first round so async work started in Init overlaps the rest of query setup.
+  bool waited_for_deferred_init_ = false;
+  // Batches generated by the last round, interleaved across partitions; one is sent per
+  // GenerateNext call.
+  std::deque<std::unique_ptr<table_store::schema::RowBatch>> pending_batches_;
 };
 
 }  // namespace exec
@@ -37,6 +37,8 @@
 #include "src/shared/types/typespb/wrapper/types_pb_wrapper.h"
 #include "src/table_store/table_store.h"
 
+DECLARE_int64(carnot_udtf_partitions);
+
 namespace px {
 namespace carnot {
 namespace exec {
@@ -87,6 +89,62 @@ class BasicTestUDTF : public UDTF<BasicTestUDTF> {
   std::string some_string_;
 };
 
+// Emits the integers [0, kNumRecords), sharded across instances by stride when partitioned.
+class PartitionedTestUDTF : public UDTF<PartitionedTestUDTF> {
+ public:
+  static constexpr int64_t kNumRecords = 4;
+
+  static constexpr auto Executor() { return udfspb::UDTFSourceExecutor::UDTF_ALL_AGENTS; }
+
+  static constexpr auto OutputRelation() {
+    return MakeArray(
+        ColInfo("out_int", types::DataType::INT64, types::PatternType::GENERAL, "int result"));
+  }
+
+  Status SetPartition(int64_t partition_idx, int64_t num_partitions) {
+    idx_ = partition_idx;
+    stride_ = num_partitions;
+    return Status::OK();
+  }
+
+  bool NextRecord(FunctionContext*, RecordWriter* rw) {
+    rw->Append<IndexOf("out_int")>(idx_);
+    idx_ += stride_;
+    return idx_ < kNumRecords;
+  }
+
+ private:
+  int64_t idx_ = 0;
+  int64_t stride_ = 1;
+};
+
+// Simulates a UDTF that starts async work (e.g. an RPC) in Init; records are only valid once
+// WaitForInit has run.
+class DeferredInitTestUDTF : public UDTF<DeferredInitTestUDTF> {
+ public:
+  static constexpr auto Executor() { return udfspb::UDTFSourceExecutor::UDTF_ALL_AGENTS; }
+
+  static constexpr auto OutputRelation() {
+    return MakeArray(
+        ColInfo("out_int", types::DataType::INT64, types::PatternType::GENERAL, "int result"));
+  }
+
+  Status Init(FunctionContext*) { return Status::OK(); }
+
+  Status WaitForInit() {
+    value_ = 42;
+    return Status::OK();
+  }
+
+  bool NextRecord(FunctionContext*, RecordWriter* rw) {
+    rw->Append<IndexOf("out_int")>(value_);
+    return false;
+  }
+
+ private:
+  int64_t value_ = -1;
+};
+
 constexpr char kUDTFTestPbtxt[] = R"proto(
   op_type: UDTF_SOURCE_OPERATOR
   udtf_source_op {
@@ -111,6 +169,8 @@ class UDTFSourceNodeTest : public ::testing::Test {
 
     func_registry_ = std::make_unique<udf::Registry>("test_registry");
     EXPECT_OK(func_registry_->Register<BasicTestUDTF>("test_udtf"));
+    EXPECT_OK(func_registry_->Register<PartitionedTestUDTF>("partitioned_udtf"));
+    EXPECT_OK(func_registry_->Register<DeferredInitTestUDTF>("deferred_init_udtf"));
     auto table_store = std::make_shared<table_store::TableStore>();
 
     exec_state_ = std::make_unique<ExecState>(func_registry_.get(), table_store,
@@ -136,6 +196,64 @@ TEST_F(UDTFSourceNodeTest, single_output_batch_test) {
           .get());
 }
 
+constexpr char kPartitionedUDTFPbtxt[] = R"proto(
+  op_type: UDTF_SOURCE_OPERATOR
+  udtf_source_op {
+    name: "partitioned_udtf"
+  }
+)proto";
+
+TEST_F(UDTFSourceNodeTest, partitioned_execution) {
+  const int64_t old_partitions_flag = FLAGS_carnot_udtf_partitions;
+  FLAGS_carnot_udtf_partitions = 2;
+
+  planpb::Operator op_pb;
+  EXPECT_TRUE(google::protobuf::TextFormat::MergeFromString(kPartitionedUDTFPbtxt, &op_pb));
+  auto plan_node = plan::UDTFSourceOperator::FromProto(op_pb, 1);
+
+  RowDescriptor output_rd({types::DataType::INT64});
+  auto tester = exec::ExecNodeTester<UDTFSourceNode, plan::UDTFSourceOperator>(
+      *plan_node, output_rd, {}, exec_state_.get());
+
+  // Partition 0 emits the even records, partition 1 the odd ones; their batches interleave.
+  tester.GenerateNextResult().ExpectRowBatch(
+      RowBatchBuilder(output_rd, 2, /*eow*/ false, /*eos*/ false)
+          .AddColumn<types::Int64Value>({0, 2})
+          .get());
+  EXPECT_TRUE(tester.node()->HasBatchesRemaining());
+  tester.GenerateNextResult().ExpectRowBatch(
+      RowBatchBuilder(output_rd, 2, /*eow*/ true, /*eos*/ true)
+          .AddColumn<types::Int64Value>({1, 3})
+          .get());
+  EXPECT_FALSE(tester.node()->HasBatchesRemaining());
+
+  FLAGS_carnot_udtf_partitions = old_partitions_flag;
+}
+
+constexpr char kDeferredInitUDTFPbtxt[] = R"proto(
+  op_type: UDTF_SOURCE_OPERATOR
+  udtf_source_op {
+    name: "deferred_init_udtf"
+  }
+)proto";
+
+TEST_F(UDTFSourceNodeTest, deferred_init_runs_before_first_batch) {
+  planpb::Operator op_pb;
+  EXPECT_TRUE(google::protobuf::TextFormat::MergeFromString(kDeferredInitUDTFPbtxt, &op_pb));
+  auto plan_node = plan::UDTFSourceOperator::FromProto(op_pb, 1);
+
+  RowDescriptor output_rd({types::DataType::INT64});
+  auto tester = exec::ExecNodeTester<UDTFSourceNode, plan::UDTFSourceOperator>(
+      *plan_node, output_rd, {}, exec_state_.get());
+
+  // The emitted value is only set by WaitForInit, so seeing it proves the wait ran first.
+  tester.GenerateNextResult().ExpectRowBatch(
+      RowBatchBuilder(output_rd, 1, /*eow*/ true, /*eos*/ true)
+          .AddColumn<types::Int64Value>({42})
+          .get());
+  EXPECT_FALSE(tester.node()->HasBatchesRemaining());
+}
+
 }  // namespace exec
 }  // namespace carnot
 }  // namespace px
@@ -28,6 +28,7 @@
 #include <absl/strings/str_join.h>
 #include <absl/strings/substitute.h>
 
+#include "src/carnot/exec/batch_size_policy.h"
 #include "src/carnot/planpb/plan.pb.h"
 #include "src/common/base/base.h"
 #include "src/shared/types/arrow_adapter.h"
@@ -49,8 +50,10 @@ Status UnionNode::InitImpl(const plan::Operator& plan_node) {
   CHECK(plan_node.op_type() == planpb::OperatorType::UNION_OPERATOR);
   const auto* union_plan_node = static_cast<const plan::UnionOperator*>(&plan_node);
   plan_node_ = std::make_unique<plan::UnionOperator>(*union_plan_node);
-  output_rows_per_batch_ =
-      plan_node_->rows_per_batch() == 0 ? kDefaultUnionRowBatchSize : plan_node_->rows_per_batch();
+  // When the plan doesn't pin a batch size, target a byte footprint computed from the output
+  // schema's row width, so wide schemas get fewer rows per batch and narrow ones get more.
+  output_rows_per_batch_ = plan_node_->rows_per_batch() == 0 ? TargetRowsPerBatch(*output_descriptor_)
+                                                             : plan_node_->rows_per_batch();
   num_parents_ = input_descriptors_.size();
 
   return Status::OK();
@@ -111,13 +114,66 @@ types::Time64NSValue UnionNode::GetTimeAtParentCursor(size_t parent_index) const
                                                         row_cursors_[parent_index]);
 }
 
-Status UnionNode::AppendRow(size_t parent) {
-  auto row = row_cursors_[parent];
+namespace {
+
+// Appends rows [start_row, start_row + count) of the input column to the builder in one
+// column-at-a-time pass.
+template <types::DataType T>
+Status AppendColumnRun(arrow::ArrayBuilder* builder, arrow::Array* input_col, size_t start_row,
+                       size_t count) {
+  auto* typed_builder =
+      static_cast<typename types::DataTypeTraits<T>::arrow_builder_type*>(builder);
+  PL_RETURN_IF_ERROR(typed_builder->Reserve(count));
+  for (size_t i = 0; i < count; ++i) {
+    typed_builder->UnsafeAppend(types::GetValueFromArrowArray<T>(input_col, start_row + i));
+  }
+  return Status::OK();
+}
+
+template <>
+Status AppendColumnRun<types::STRING>(arrow::ArrayBuilder* builder, arrow::Array* input_col,
+                                      size_t start_row, size_t count) {
+  auto* typed_builder =
+      static_cast<types::DataTypeTraits<types::STRING>::arrow_builder_type*>(builder);
+  PL_RETURN_IF_ERROR(typed_builder->Reserve(count));
+  size_t total_size = 0;
+  for (size_t i = 0; i < count; ++i) {
+    total_size += types::GetValueFromArrowArray<types::STRING>(input_col, start_row + i).size();
+  }
+  PL_RETURN_IF_ERROR(typed_builder->ReserveData(total_size));
+  for (size_t i = 0; i < count; ++i) {
+    typed_builder->UnsafeAppend(
+        types::GetValueFromArrowArray<types::STRING>(input_col, start_row + i));
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+size_t UnionNode::RunEndAtParentCursor(size_t parent_index, types::Time64NSValue limit_time,
+                                       bool inclusive) const {
+  const auto* time_col = time_columns_[parent_index];
+  // The row at the cursor is already known to be within the limit.
+  size_t lo = row_cursors_[parent_index] + 1;
+  size_t hi = time_col->length();
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    auto time = types::GetValueFromArrowArray<types::TIME64NS>(time_col, mid);
+    if (time < limit_time || (inclusive && time == limit_time)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+Status UnionNode::AppendRun(size_t parent, size_t start_row, size_t count) {
   for (size_t i = 0; i < output_descriptor_->size(); ++i) {
     auto input_col = data_columns_[parent][i];
-#define TYPE_CASE(_dt_)                                    \
-  PL_RETURN_IF_ERROR(table_store::schema::CopyValue<_dt_>( \
-      column_builders_[i].get(), types::GetValueFromArrowArray<_dt_>(input_col, row)));
+#define TYPE_CASE(_dt_) \
+  PL_RETURN_IF_ERROR(   \
+      AppendColumnRun<_dt_>(column_builders_[i].get(), input_col, start_row, count));
     PL_SWITCH_FOREACH_DATATYPE(output_descriptor_->type(i), TYPE_CASE);
 #undef TYPE_CASE
   }
@@ -164,6 +220,16 @@ Status UnionNode::FlushBatch(ExecState* exec_state) {
   bool eos = InputsComplete();
   PL_ASSIGN_OR_RETURN(auto rb, RowBatch::FromColumnBuilders(*output_descriptor_, /*eow*/ eos,
                                                             /*eos*/ eos, &column_builders_));
+
+  // Refine the batch size from the observed average row width, so schemas whose string columns
+  // are much smaller or larger than the estimate converge to the target byte footprint.
+  if (plan_node_->rows_per_batch() == 0) {
+    total_output_bytes_ += rb->NumBytes();
+    total_output_rows_ += rb->num_rows();
+    output_rows_per_batch_ =
+        TargetRowsPerBatch(*output_descriptor_, total_output_bytes_, total_output_rows_);
+  }
+
   PL_RETURN_IF_ERROR(InitializeColumnBuilders());
   last_data_flush_time_ = std::chrono::system_clock::now();
   return SendRowBatchToChildren(exec_state, *rb);
@@ -202,37 +268,45 @@ Status UnionNode::MergeData(ExecState* exec_state) {
     size_t parent = parent_streams[0];
 
     while (parent_row_batches_[parent].size()) {
+      const auto& rb = parent_row_batches_[parent][0];
+      size_t num_rows = rb.num_rows();
+      size_t run_end = num_rows;
       if (has_limit) {
         size_t next_parent = parent_streams[1];
+        auto limit_time = GetTimeAtParentCursor(next_parent);
         // If this time is greater than another parent stream's earliest time,
         // or if they are the same but the first parent is at a smaller index, stop merging.
         // This way rows are always stable with respect to input parent index.
-        if (GetTimeAtParentCursor(parent) > GetTimeAtParentCursor(next_parent) ||
-            (GetTimeAtParentCursor(parent) == GetTimeAtParentCursor(next_parent) &&
-             parent > next_parent)) {
+        if (GetTimeAtParentCursor(parent) > limit_time ||
+            (GetTimeAtParentCursor(parent) == limit_time && parent > next_parent)) {
           break;
         }
+        // Take the whole run of rows up to the next parent's earliest time in one go, rather
+        // than re-comparing after every row.
+        run_end = RunEndAtParentCursor(parent, limit_time, /* inclusive */ parent < next_parent);
       }
 
-      PL_RETURN_IF_ERROR(AppendRow(parent));
-
-      // Mark whether or not we hit the eos for this stream, and whether the row batch needs to be
-      // popped.
-      const auto& rb = parent_row_batches_[parent][0];
-      bool pop_row_batch = ++row_cursors_[parent] == static_cast<size_t>(rb.num_rows());
-      if (pop_row_batch && rb.eos()) {
-        flushed_parent_eoses_[parent] = true;
+      while (row_cursors_[parent] < run_end) {
+        // Respect the output batch size; flushing resets the builders between chunks.
+        size_t remaining_capacity = output_rows_per_batch_ - column_builders_[0]->length();
+        size_t count = std::min(run_end - row_cursors_[parent], remaining_capacity);
+        PL_RETURN_IF_ERROR(AppendRun(parent, row_cursors_[parent], count));
+        row_cursors_[parent] += count;
+        PL_RETURN_IF_ERROR(OptionallyFlushRowBatchIfMaxRowsOrEOS(exec_state));
       }
 
-      if (pop_row_batch) {
-        // Delete the top row batch from our buffer and update the cursor.
-        parent_row_batches_[parent].erase(parent_row_batches_[parent].begin());
-        row_cursors_[parent] = 0;
-        CacheNextRowBatch(parent);
+      if (row_cursors_[parent] < num_rows) {
+        // The run ended at the next parent's time: go back and re-select the winning stream.
+        break;
       }
 
-      // Flush the current RowBatch if necessary.
-      PL_RETURN_IF_ERROR(OptionallyFlushRowBatchIfMaxRowsOrEOS(exec_state));
+      // Delete the exhausted top row batch from our buffer and update the cursor.
+      if (rb.eos()) {
+        flushed_parent_eoses_[parent] = true;
+      }
+      parent_row_batches_[parent].erase(parent_row_batches_[parent].begin());
+      row_cursors_[parent] = 0;
+      CacheNextRowBatch(parent);
     }
   }
   return Status::OK();
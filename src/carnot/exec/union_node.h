@@ -38,7 +38,6 @@ namespace px {
 namespace carnot {
 namespace exec {
 
-constexpr size_t kDefaultUnionRowBatchSize = 1024;
 constexpr size_t kDefaultDataFlushTimeoutMillis = 1000;
 
 // This node presumes that input streams will always come in ordered by time
@@ -91,7 +90,11 @@ class UnionNode : public ProcessingNode {
   void CacheNextRowBatch(size_t parent);
   Status InitializeColumnBuilders();
   types::Time64NSValue GetTimeAtParentCursor(size_t parent_index) const;
-  Status AppendRow(size_t parent);
+  // Returns the end (exclusive) of the run of rows at the parent's cursor whose times are below
+  // limit_time (or equal to it, if inclusive), via binary search over the sorted time column.
+  size_t RunEndAtParentCursor(size_t parent_index, types::Time64NSValue limit_time,
+                              bool inclusive) const;
+  Status AppendRun(size_t parent, size_t start_row, size_t count);
   Status OptionallyFlushRowBatchIfMaxRowsOrEOS(ExecState* exec_state);
   Status OptionallyFlushRowBatchIfTimeout(ExecState* exec_state);
   Status FlushBatch(ExecState* exec_state);
@@ -100,6 +103,10 @@ class UnionNode : public ProcessingNode {
   // output_rows_per_batch is only used in the ordered case, because in the unordered case,
   // we just maintain the original row count to avoid copying the data.
   size_t output_rows_per_batch_;
+  // Running output totals, used to adapt output_rows_per_batch_ to the observed row width when
+  // the plan doesn't pin a batch size.
+  int64_t total_output_bytes_ = 0;
+  int64_t total_output_rows_ = 0;
 
   // Column builders will flush a batch once they hit output_rows_per_batch_ rows.
   std::vector<std::unique_ptr<arrow::ArrayBuilder>> column_builders_;
@@ -0,0 +1,502 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/window_agg_node.h"
+
+#include <arrow/array.h>
+#include <arrow/status.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <absl/container/flat_hash_map.h>
+#include <magic_enum.hpp>
+
+#include "src/carnot/exec/expression_evaluator.h"
+#include "src/carnot/plan/scalar_expression.h"
+#include "src/carnot/planpb/plan.pb.h"
+#include "src/carnot/udf/udf_wrapper.h"
+#include "src/common/base/base.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/shared/types/type_utils.h"
+#include "src/shared/types/types.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowBatch;
+using table_store::schema::RowDescriptor;
+
+// Pending per-group agg columns are folded into the UDAs once they exceed this many rows, same
+// as AggNode's compaction threshold.
+constexpr int64_t kWindowAggCompactionThreshold = 512;
+
+namespace {
+
+template <types::DataType DT>
+void AppendToBuilder(arrow::ArrayBuilder* builder, RowTuple* rt, size_t rt_idx) {
+  using ArrowBuilder = typename types::DataTypeTraits<DT>::arrow_builder_type;
+  arrow::Status status;
+  if constexpr (DT == types::DataType::STRING) {
+    const auto view = rt->GetStringValue(rt_idx);
+    status = static_cast<ArrowBuilder*>(builder)->Append(view.data(), view.size());
+  } else {
+    using ValueType = typename types::DataTypeTraits<DT>::value_type;
+    status =
+        static_cast<ArrowBuilder*>(builder)->Append(udf::UnWrap(rt->GetValue<ValueType>(rt_idx)));
+  }
+  PL_DCHECK_OK(status);
+  PL_UNUSED(status);
+}
+
+}  // namespace
+
+std::string WindowAggNode::DebugStringImpl() {
+  return absl::Substitute("Exec::WindowAggNode<window_size=$0ns, lateness=$1ns>",
+                          plan_node_->window_size_ns(), plan_node_->allowed_lateness_ns());
+}
+
+Status WindowAggNode::InitImpl(const plan::Operator& plan_node) {
+  CHECK(plan_node.op_type() == planpb::OperatorType::AGGREGATE_OPERATOR);
+  const auto* agg_plan_node = static_cast<const plan::AggregateOperator*>(&plan_node);
+
+  // Copy the plan node to local object.
+  plan_node_ = std::make_unique<plan::AggregateOperator>(*agg_plan_node);
+
+  if (!plan_node_->has_streaming_window()) {
+    return error::InvalidArgument("Window aggregate operator requires a window size");
+  }
+  if (input_descriptors_.size() != 1) {
+    return error::InvalidArgument(
+        "Window aggregate operator expects a single input relation, got $0",
+        input_descriptors_.size());
+  }
+  input_descriptor_ = std::make_unique<RowDescriptor>(input_descriptors_[0]);
+
+  auto time_idx = plan_node_->window_time_column_index();
+  if (time_idx < 0 || static_cast<size_t>(time_idx) >= input_descriptor_->size()) {
+    return error::InvalidArgument("Window time column index $0 is out of bounds", time_idx);
+  }
+  time_col_type_ = input_descriptor_->type(time_idx);
+  if (time_col_type_ != types::DataType::TIME64NS && time_col_type_ != types::DataType::INT64) {
+    return error::InvalidArgument("Window time column must be TIME64NS or INT64, got $0",
+                                  magic_enum::enum_name(time_col_type_));
+  }
+
+  for (const auto& value : plan_node_->values()) {
+    if (value->ExpressionType() != plan::Expression::kAgg) {
+      return error::InvalidArgument("Window aggregate operator can only use aggregate expressions");
+    }
+  }
+
+  size_t output_size = plan_node_->values().size() + plan_node_->groups().size();
+  if (output_size != output_descriptor_->size()) {
+    return error::InvalidArgument("Output size mismatch in window aggregate");
+  }
+
+  auto groups_size = plan_node_->groups().size();
+  group_data_types_.reserve(groups_size);
+  for (const auto& group : plan_node_->groups()) {
+    DCHECK(group.idx < input_descriptor_->size());
+    group_data_types_.emplace_back(input_descriptor_->type(group.idx));
+  }
+
+  for (size_t i = 0; i < plan_node_->values().size(); ++i) {
+    auto values_idx = i + groups_size;
+    DCHECK(values_idx < output_descriptor_->size());
+    value_data_types_.emplace_back(output_descriptor_->type(values_idx));
+  }
+
+  return CreateColumnMapping();
+}
+
+Status WindowAggNode::PrepareImpl(ExecState* exec_state) {
+  function_ctx_ = exec_state->CreateFunctionContext();
+  return Status::OK();
+}
+
+Status WindowAggNode::OpenImpl(ExecState*) { return Status::OK(); }
+
+Status WindowAggNode::CloseImpl(ExecState*) {
+  if (late_rows_dropped_ > 0) {
+    LOG(INFO) << absl::Substitute(
+        "WindowAggNode: dropped $0 rows that arrived after their window was emitted.",
+        late_rows_dropped_);
+  }
+  open_windows_.clear();
+  return Status::OK();
+}
+
+int64_t WindowAggNode::EventTimeAt(const RowBatch& rb, int64_t row_idx) const {
+  auto* arr = rb.ColumnAt(plan_node_->window_time_column_index()).get();
+  if (time_col_type_ == types::DataType::TIME64NS) {
+    return types::Time64NSValue(
+               types::GetValueFromArrowArray<types::DataType::TIME64NS>(arr, row_idx))
+        .val;
+  }
+  return types::Int64Value(types::GetValueFromArrowArray<types::DataType::INT64>(arr, row_idx))
+      .val;
+}
+
+StatusOr<WindowAggNode::WindowState*> WindowAggNode::GetOrCreateWindow(ExecState* exec_state,
+                                                                       int64_t window_start) {
+  auto& window = open_windows_[window_start];
+  if (window == nullptr) {
+    window = std::make_unique<WindowState>();
+    if (HasNoGroups()) {
+      PL_RETURN_IF_ERROR(CreateUDAInfoValues(&window->udas_no_groups, exec_state));
+    }
+  }
+  return window.get();
+}
+
+Status WindowAggNode::ConsumeNextImpl(ExecState* exec_state, const RowBatch& rb, size_t) {
+  // Assign each row to its tumbling window and advance the watermark.
+  absl::flat_hash_map<int64_t, std::vector<int64_t>> window_rows;
+  for (int64_t row_idx = 0; row_idx < rb.num_rows(); ++row_idx) {
+    int64_t event_time = EventTimeAt(rb, row_idx);
+    max_event_time_ = std::max(max_event_time_, event_time);
+    int64_t window_start = WindowStart(event_time);
+    if (window_start + plan_node_->window_size_ns() <= emitted_through_) {
+      // This row's window has already been emitted downstream.
+      ++late_rows_dropped_;
+      continue;
+    }
+    window_rows[window_start].push_back(row_idx);
+  }
+
+  for (const auto& [window_start, row_indices] : window_rows) {
+    PL_ASSIGN_OR_RETURN(WindowState * window, GetOrCreateWindow(exec_state, window_start));
+    if (HasNoGroups()) {
+      PL_RETURN_IF_ERROR(UpdateWindowNoGroups(exec_state, window, rb, row_indices));
+    } else {
+      PL_RETURN_IF_ERROR(UpdateWindowGroups(exec_state, window, rb, row_indices));
+    }
+  }
+
+  if (rb.eos()) {
+    return FlushAllWindows(exec_state);
+  }
+  return EmitClosedWindows(exec_state);
+}
+
+Status WindowAggNode::UpdateWindowNoGroups(ExecState* exec_state, WindowState* window,
+                                           const RowBatch& rb,
+                                           const std::vector<int64_t>& row_indices) {
+  auto values = plan_node_->values();
+  for (size_t i = 0; i < values.size(); ++i) {
+    const auto& uda_info = window->udas_no_groups[i];
+    plan::ExpressionWalker<StatusOr<types::SharedColumnWrapper>> walker;
+    walker.OnScalarValue([&](const plan::ScalarValue& scalar_val,
+                             const std::vector<StatusOr<types::SharedColumnWrapper>>& children)
+                             -> types::SharedColumnWrapper {
+      DCHECK_EQ(children.size(), 0ULL);
+      return EvalScalarToColumnWrapper(exec_state, scalar_val, row_indices.size());
+    });
+    walker.OnColumn([&](const plan::Column& col,
+                        const std::vector<StatusOr<types::SharedColumnWrapper>>& children)
+                        -> types::SharedColumnWrapper {
+      DCHECK_EQ(children.size(), 0ULL);
+      // Gather just this window's rows from the input column.
+      auto dt = input_descriptor_->type(col.Index());
+      auto wrapper = types::ColumnWrapper::Make(dt, 0);
+      auto* arr = rb.ColumnAt(col.Index()).get();
+      for (int64_t row_idx : row_indices) {
+#define TYPE_CASE(_dt_) types::ExtractValueToColumnWrapper<_dt_>(wrapper.get(), arr, row_idx);
+        PL_SWITCH_FOREACH_DATATYPE(dt, TYPE_CASE);
+#undef TYPE_CASE
+      }
+      return wrapper;
+    });
+    walker.OnAggregateExpression(
+        [&](const plan::AggregateExpression& agg,
+            const std::vector<StatusOr<types::SharedColumnWrapper>>& children)
+            -> StatusOr<types::SharedColumnWrapper> {
+          DCHECK(agg.name() == uda_info.def->name());
+          std::vector<const types::ColumnWrapper*> raw_children;
+          raw_children.reserve(children.size());
+          for (auto& child : children) {
+            PL_RETURN_IF_ERROR(child);
+            raw_children.push_back(child.ValueOrDie().get());
+          }
+          PL_RETURN_IF_ERROR(
+              uda_info.def->ExecBatchUpdate(uda_info.uda.get(), nullptr /* ctx */, raw_children));
+          return {};
+        });
+    PL_RETURN_IF_ERROR(walker.Walk(*values[i]));
+  }
+  return Status::OK();
+}
+
+Status WindowAggNode::UpdateWindowGroups(ExecState* exec_state, WindowState* window,
+                                         const RowBatch& rb,
+                                         const std::vector<int64_t>& row_indices) {
+  RowTuple* rt = nullptr;
+  for (int64_t row_idx : row_indices) {
+    if (rt == nullptr) {
+      rt = window->pool.Add(new RowTuple(&group_data_types_));
+    } else {
+      rt->Reset();
+    }
+    for (size_t i = 0; i < plan_node_->groups().size(); ++i) {
+      const auto& grp = plan_node_->groups()[i];
+#define TYPE_CASE(_dt_) \
+  ExtractIntoRowTuple<_dt_>(rt, rb.ColumnAt(grp.idx).get(), i, row_idx);
+      PL_SWITCH_FOREACH_DATATYPE(group_data_types_[i], TYPE_CASE);
+#undef TYPE_CASE
+    }
+
+    auto [it, inserted] = window->groups.try_emplace(rt, nullptr);
+    if (inserted) {
+      it->second = CreateAggHashValue(exec_state, window);
+      // The stored RowTuple is now owned by the map; allocate a fresh one for the next row.
+      rt = nullptr;
+    }
+    AggHashValue* val = it->second;
+
+    for (size_t i = 0; i < stored_cols_data_types_.size(); ++i) {
+      auto* arr = rb.ColumnAt(stored_cols_to_plan_idx_[i]).get();
+#define TYPE_CASE(_dt_) \
+  types::ExtractValueToColumnWrapper<_dt_>(val->agg_cols[i].get(), arr, row_idx);
+      PL_SWITCH_FOREACH_DATATYPE(stored_cols_data_types_[i], TYPE_CASE);
+#undef TYPE_CASE
+    }
+
+    if (!stored_cols_data_types_.empty() &&
+        val->agg_cols[0]->Size() > kWindowAggCompactionThreshold) {
+      PL_RETURN_IF_ERROR(EvaluateAggHashValue(exec_state, val));
+    }
+  }
+  return Status::OK();
+}
+
+Status WindowAggNode::EmitClosedWindows(ExecState* exec_state) {
+  int64_t watermark = max_event_time_ - plan_node_->allowed_lateness_ns();
+  while (!open_windows_.empty()) {
+    auto it = open_windows_.begin();
+    int64_t window_end = it->first + plan_node_->window_size_ns();
+    if (window_end > watermark) {
+      break;
+    }
+    PL_RETURN_IF_ERROR(EmitWindow(exec_state, it->second.get(), /* eow */ true, /* eos */ false));
+    emitted_through_ = std::max(emitted_through_, window_end);
+    open_windows_.erase(it);
+  }
+  return Status::OK();
+}
+
+Status WindowAggNode::FlushAllWindows(ExecState* exec_state) {
+  if (open_windows_.empty()) {
+    // Still need to forward the end-of-stream marker.
+    RowBatch output_rb(*output_descriptor_, 0);
+    for (auto dt : output_descriptor_->types()) {
+      auto builder = types::MakeArrowBuilder(dt, exec_state->exec_mem_pool());
+      std::shared_ptr<arrow::Array> arr;
+      PL_RETURN_IF_ERROR(builder->Finish(&arr));
+      PL_RETURN_IF_ERROR(output_rb.AddColumn(arr));
+    }
+    output_rb.set_eow(true);
+    output_rb.set_eos(true);
+    return SendRowBatchToChildren(exec_state, output_rb);
+  }
+  while (!open_windows_.empty()) {
+    auto it = open_windows_.begin();
+    bool last = open_windows_.size() == 1;
+    PL_RETURN_IF_ERROR(EmitWindow(exec_state, it->second.get(), /* eow */ true, /* eos */ last));
+    emitted_through_ =
+        std::max(emitted_through_, it->first + plan_node_->window_size_ns());
+    open_windows_.erase(it);
+  }
+  return Status::OK();
+}
+
+Status WindowAggNode::EmitWindow(ExecState* exec_state, WindowState* window, bool eow, bool eos) {
+  if (HasNoGroups()) {
+    RowBatch output_rb(*output_descriptor_, 1);
+    for (size_t i = 0; i < window->udas_no_groups.size(); ++i) {
+      const auto& uda_info = window->udas_no_groups[i];
+      auto builder = types::MakeArrowBuilder(uda_info.def->finalize_return_type(),
+                                             exec_state->exec_mem_pool());
+      PL_RETURN_IF_ERROR(
+          uda_info.def->FinalizeArrow(uda_info.uda.get(), function_ctx_.get(), builder.get()));
+      std::shared_ptr<arrow::Array> out_col;
+      PL_RETURN_IF_ERROR(builder->Finish(&out_col));
+      PL_RETURN_IF_ERROR(output_rb.AddColumn(out_col));
+    }
+    output_rb.set_eow(eow);
+    output_rb.set_eos(eos);
+    return SendRowBatchToChildren(exec_state, output_rb);
+  }
+
+  RowBatch output_rb(*output_descriptor_, window->groups.size());
+  std::vector<std::unique_ptr<arrow::ArrayBuilder>> group_builders;
+  std::vector<std::unique_ptr<arrow::ArrayBuilder>> value_builders;
+  for (const auto& group_dt : group_data_types_) {
+    group_builders.push_back(types::MakeArrowBuilder(group_dt, exec_state->exec_mem_pool()));
+  }
+  for (const auto& value_dt : value_data_types_) {
+    value_builders.push_back(types::MakeArrowBuilder(value_dt, exec_state->exec_mem_pool()));
+  }
+
+  for (const auto& [groups_rt, val] : window->groups) {
+    for (size_t i = 0; i < group_data_types_.size(); ++i) {
+#define TYPE_CASE(_dt_) AppendToBuilder<_dt_>(group_builders[i].get(), groups_rt, i);
+      PL_SWITCH_FOREACH_DATATYPE(group_data_types_[i], TYPE_CASE);
+#undef TYPE_CASE
+    }
+    PL_RETURN_IF_ERROR(EvaluateAggHashValue(exec_state, val));
+    for (size_t i = 0; i < val->udas.size(); ++i) {
+      const auto& uda_info = val->udas[i];
+      PL_RETURN_IF_ERROR(uda_info.def->FinalizeArrow(uda_info.uda.get(), function_ctx_.get(),
+                                                     value_builders[i].get()));
+    }
+  }
+
+  for (const auto& builder : group_builders) {
+    std::shared_ptr<arrow::Array> arr;
+    PL_RETURN_IF_ERROR(builder->Finish(&arr));
+    PL_RETURN_IF_ERROR(output_rb.AddColumn(arr));
+  }
+  for (const auto& builder : value_builders) {
+    std::shared_ptr<arrow::Array> arr;
+    PL_RETURN_IF_ERROR(builder->Finish(&arr));
+    PL_RETURN_IF_ERROR(output_rb.AddColumn(arr));
+  }
+  output_rb.set_eow(eow);
+  output_rb.set_eos(eos);
+  return SendRowBatchToChildren(exec_state, output_rb);
+}
+
+Status WindowAggNode::EvaluateAggHashValue(ExecState* exec_state, AggHashValue* val) {
+  size_t values_size = plan_node_->values().size();
+  for (size_t i = 0; i < values_size; ++i) {
+    const auto& uda_info = val->udas[i];
+    const auto& expr = *plan_node_->values()[i];
+    size_t num_records = val->agg_cols[0]->Size();
+    plan::ExpressionWalker<StatusOr<types::SharedColumnWrapper>> walker;
+    walker.OnScalarValue([&](const plan::ScalarValue& scalar_val,
+                             const std::vector<StatusOr<types::SharedColumnWrapper>>& children)
+                             -> types::SharedColumnWrapper {
+      DCHECK_EQ(children.size(), 0ULL);
+      return EvalScalarToColumnWrapper(exec_state, scalar_val, num_records);
+    });
+    walker.OnColumn([&](const plan::Column& col,
+                        const std::vector<StatusOr<types::SharedColumnWrapper>>& children)
+                        -> types::SharedColumnWrapper {
+      DCHECK_EQ(children.size(), 0ULL);
+      return val->agg_cols[plan_cols_to_stored_map_[col.Index()]];
+    });
+    walker.OnAggregateExpression(
+        [&](const plan::AggregateExpression& agg,
+            const std::vector<StatusOr<types::SharedColumnWrapper>>& children)
+            -> StatusOr<types::SharedColumnWrapper> {
+          DCHECK(agg.name() == uda_info.def->name());
+          DCHECK(children.size() == uda_info.def->update_arguments().size());
+          std::vector<const types::ColumnWrapper*> raw_children;
+          raw_children.reserve(children.size());
+          for (auto& child : children) {
+            PL_RETURN_IF_ERROR(child);
+            raw_children.push_back(child.ValueOrDie().get());
+          }
+          PL_RETURN_IF_ERROR(
+              uda_info.def->ExecBatchUpdate(uda_info.uda.get(), nullptr /* ctx */, raw_children));
+          return {};
+        });
+    PL_RETURN_IF_ERROR(walker.Walk(expr));
+  }
+
+  for (auto& col : val->agg_cols) {
+    // Clear the values, so we don't aggregate them twice.
+    col->Clear();
+  }
+  return Status::OK();
+}
+
+Status WindowAggNode::CreateColumnMapping() {
+  for (const auto& expr : plan_node_->values()) {
+    plan::ExpressionWalker<int> walker;
+    walker.OnScalarValue(
+        [&](const plan::ScalarValue&, const std::vector<int>&) -> int { return 0; });
+    walker.OnColumn([&](const plan::Column& col, const std::vector<int>&) -> int {
+      auto plan_col_idx = col.Index();
+      if (plan_cols_to_stored_map_.find(plan_col_idx) == plan_cols_to_stored_map_.end()) {
+        plan_cols_to_stored_map_[plan_col_idx] = stored_cols_to_plan_idx_.size();
+        stored_cols_to_plan_idx_.emplace_back(plan_col_idx);
+        stored_cols_data_types_.emplace_back(input_descriptor_->type(plan_col_idx));
+      }
+      return 0;
+    });
+    walker.OnAggregateExpression(
+        [&](const plan::AggregateExpression&, const std::vector<int>&) -> int { return 0; });
+    PL_RETURN_IF_ERROR(walker.Walk(*expr));
+  }
+  return Status::OK();
+}
+
+AggHashValue* WindowAggNode::CreateAggHashValue(ExecState* exec_state, WindowState* window) {
+  auto* val = window->pool.Add(new AggHashValue);
+  PL_CHECK_OK(CreateUDAInfoValues(&(val->udas), exec_state));
+  for (const auto& dt : stored_cols_data_types_) {
+    val->agg_cols.emplace_back(types::ColumnWrapper::Make(dt, 0));
+  }
+  return val;
+}
+
+StatusOr<types::DataType> WindowAggNode::GetTypeOfDep(const plan::ScalarExpression& expr) const {
+  switch (expr.ExpressionType()) {
+    case plan::Expression::kColumn: {
+      auto idx = static_cast<const plan::Column*>(&expr)->Index();
+      return input_descriptor_->type(idx);
+    }
+    case plan::Expression::kConstant:
+      return static_cast<const plan::ScalarValue*>(&expr)->DataType();
+    default:
+      return error::InvalidArgument("Invalid expression type in agg: $0",
+                                    magic_enum::enum_name(expr.ExpressionType()));
+  }
+}
+
+Status WindowAggNode::CreateUDAInfoValues(std::vector<UDAInfo>* val, ExecState* exec_state) {
+  CHECK(val != nullptr);
+  CHECK_EQ(val->size(), 0ULL);
+
+  for (const auto& value : plan_node_->values()) {
+    std::vector<types::DataType> types;
+    types.reserve(value->Deps().size());
+    for (auto* dep : value->Deps()) {
+      PL_ASSIGN_OR_RETURN(auto type, GetTypeOfDep(*dep));
+      types.push_back(type);
+    }
+    auto def = exec_state->GetUDADefinition(value->uda_id());
+    auto uda = def->Make();
+
+    std::vector<std::shared_ptr<types::BaseValueType>> init_args;
+    for (const auto& arg : value->init_arguments()) {
+      init_args.push_back(arg.ToBaseValueType());
+    }
+    PL_RETURN_IF_ERROR(def->ExecInit(uda.get(), nullptr, init_args));
+    val->emplace_back(std::move(uda), def);
+  }
+  return Status::OK();
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
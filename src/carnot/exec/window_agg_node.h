@@ -0,0 +1,131 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+#include <arrow/array/builder_base.h>
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/carnot/exec/agg_node.h"
+#include "src/carnot/exec/exec_node.h"
+#include "src/carnot/exec/exec_state.h"
+#include "src/carnot/exec/row_tuple.h"
+#include "src/carnot/plan/operators.h"
+#include "src/carnot/udf/udf.h"
+#include "src/common/base/base.h"
+#include "src/common/memory/memory.h"
+#include "src/shared/types/types.h"
+#include "src/table_store/table_store.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+/**
+ * WindowAggNode performs streaming tumbling-window aggregation for continuous queries. Rows from
+ * a streaming source are assigned to event-time windows on the window time column, per-window UDA
+ * state is updated incrementally as batches arrive, and a window is emitted (with eow set) once
+ * the watermark — the max observed event time minus the allowed lateness — passes its end. This
+ * lets continuous consumers such as OTel metric export receive closed-window deltas instead of
+ * re-aggregating the trailing window every tick. Rows arriving for windows that have already been
+ * emitted are dropped.
+ *
+ * Unlike AggNode's marker-driven windowed mode, which holds exactly one window's state and
+ * requires the input to be split into windows upstream, this node keeps state for every window
+ * still open under the watermark, so it tolerates out-of-order rows up to the allowed lateness.
+ */
+class WindowAggNode : public ProcessingNode {
+  using AggHashMap = AbslRowTupleHashMap<AggHashValue*>;
+
+ public:
+  WindowAggNode() = default;
+  virtual ~WindowAggNode() = default;
+
+ protected:
+  std::string DebugStringImpl() override;
+  Status InitImpl(const plan::Operator& plan_node) override;
+  Status PrepareImpl(ExecState* exec_state) override;
+  Status OpenImpl(ExecState* exec_state) override;
+  Status CloseImpl(ExecState* exec_state) override;
+  Status ConsumeNextImpl(ExecState* exec_state, const table_store::schema::RowBatch& rb,
+                         size_t parent_index) override;
+
+ private:
+  // Incremental aggregate state for one open window. Row tuples, UDA instances and pending agg
+  // columns live in the window's pool, so closing a window releases its state wholesale.
+  struct WindowState {
+    AggHashMap groups;
+    std::vector<UDAInfo> udas_no_groups;
+    ObjectPool pool{"window_agg_pool"};
+  };
+
+  bool HasNoGroups() const { return plan_node_->groups().empty(); }
+  int64_t WindowStart(int64_t event_time) const {
+    return event_time - (event_time % plan_node_->window_size_ns());
+  }
+  int64_t EventTimeAt(const table_store::schema::RowBatch& rb, int64_t row_idx) const;
+
+  StatusOr<WindowState*> GetOrCreateWindow(ExecState* exec_state, int64_t window_start);
+  Status UpdateWindowGroups(ExecState* exec_state, WindowState* window,
+                            const table_store::schema::RowBatch& rb,
+                            const std::vector<int64_t>& row_indices);
+  Status UpdateWindowNoGroups(ExecState* exec_state, WindowState* window,
+                              const table_store::schema::RowBatch& rb,
+                              const std::vector<int64_t>& row_indices);
+
+  // Emits every open window whose end the watermark has passed, in window order.
+  Status EmitClosedWindows(ExecState* exec_state);
+  // Emits all remaining open windows; the last batch carries the eos (and eow) markers.
+  Status FlushAllWindows(ExecState* exec_state);
+  Status EmitWindow(ExecState* exec_state, WindowState* window, bool eow, bool eos);
+
+  Status EvaluateAggHashValue(ExecState* exec_state, AggHashValue* val);
+  AggHashValue* CreateAggHashValue(ExecState* exec_state, WindowState* window);
+  Status CreateUDAInfoValues(std::vector<UDAInfo>* val, ExecState* exec_state);
+  StatusOr<types::DataType> GetTypeOfDep(const plan::ScalarExpression& expr) const;
+  Status CreateColumnMapping();
+
+  std::unique_ptr<plan::AggregateOperator> plan_node_;
+  std::unique_ptr<table_store::schema::RowDescriptor> input_descriptor_;
+  std::unique_ptr<udf::FunctionContext> function_ctx_;
+
+  std::vector<types::DataType> group_data_types_;
+  std::vector<types::DataType> value_data_types_;
+  types::DataType time_col_type_ = types::DataType::DATA_TYPE_UNKNOWN;
+
+  // Mapping between plan columns referenced by the agg expressions and the per-group stored
+  // columns (same scheme as AggNode).
+  std::map<int64_t, int64_t> plan_cols_to_stored_map_;
+  std::vector<int64_t> stored_cols_to_plan_idx_;
+  std::vector<types::DataType> stored_cols_data_types_;
+
+  // Open windows keyed by window start, ordered so closed windows are emitted in time order.
+  std::map<int64_t, std::unique_ptr<WindowState>> open_windows_;
+  int64_t max_event_time_ = std::numeric_limits<int64_t>::min();
+  // End of the newest window already emitted; rows at or before this are late and get dropped.
+  int64_t emitted_through_ = std::numeric_limits<int64_t>::min();
+  int64_t late_rows_dropped_ = 0;
+};
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
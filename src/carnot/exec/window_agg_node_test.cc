@@ -0,0 +1,254 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/exec/window_agg_node.h"
+
+#include <algorithm>
+
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+#include <sole.hpp>
+
+#include "src/carnot/exec/test_utils.h"
+#include "src/carnot/planpb/plan.pb.h"
+#include "src/carnot/udf/registry.h"
+#include "src/common/testing/testing.h"
+#include "src/shared/types/typespb/wrapper/types_pb_wrapper.h"
+
+namespace px {
+namespace carnot {
+namespace exec {
+
+using table_store::schema::RowDescriptor;
+using types::Int64Value;
+using types::Time64NSValue;
+using udf::FunctionContext;
+
+// Test UDA, takes the min of two arguments and then sums them (same as the AggNode tests).
+class MinSumUDA : public udf::UDA {
+ public:
+  void Update(udf::FunctionContext*, types::Int64Value arg1, types::Int64Value arg2) {
+    sum_ = sum_.val + std::min(arg1.val, arg2.val);
+  }
+  void Merge(udf::FunctionContext*, const MinSumUDA& other) { sum_ = sum_.val + other.sum_.val; }
+  types::Int64Value Finalize(udf::FunctionContext*) { return sum_; }
+
+ protected:
+  types::Int64Value sum_ = 0;
+};
+
+// Tumbling 100ns windows on column 0, aggregating columns 1 and 2, no groups.
+constexpr char kNoGroupWindowAgg[] = R"(
+op_type: AGGREGATE_OPERATOR
+agg_op {
+  windowed: true
+  window_size_ns: 100
+  window_time_column_index: 0
+  values {
+    name: "minsum"
+    args {
+      column {
+        node: 0
+        index: 1
+      }
+    }
+    args {
+      column {
+        node: 0
+        index: 2
+      }
+    }
+  }
+  value_names: "value1"
+})";
+
+// Tumbling 100ns windows on column 0, grouped by column 1, aggregating columns 2 and 3.
+constexpr char kSingleGroupWindowAgg[] = R"(
+op_type: AGGREGATE_OPERATOR
+agg_op {
+  windowed: true
+  window_size_ns: 100
+  window_time_column_index: 0
+  allowed_lateness_ns: 50
+  values {
+    name: "minsum"
+    args {
+      column {
+        node: 0
+        index: 2
+      }
+    }
+    args {
+      column {
+        node: 0
+        index: 3
+      }
+    }
+  }
+  groups {
+    node: 0
+    index: 1
+  }
+  group_names: "g1"
+  value_names: "value1"
+})";
+
+std::unique_ptr<ExecState> MakeTestExecState(udf::Registry* registry) {
+  auto table_store = std::make_shared<table_store::TableStore>();
+  return std::make_unique<ExecState>(registry, table_store, MockResultSinkStubGenerator,
+                                     MockMetricsStubGenerator, MockTraceStubGenerator,
+                                     sole::uuid4(), nullptr);
+}
+
+std::unique_ptr<plan::Operator> PlanNodeFromPbtxt(const std::string& pbtxt) {
+  planpb::Operator op_pb;
+  EXPECT_TRUE(google::protobuf::TextFormat::MergeFromString(pbtxt, &op_pb));
+  return plan::AggregateOperator::FromProto(op_pb, 1);
+}
+
+class WindowAggNodeTest : public ::testing::Test {
+ public:
+  WindowAggNodeTest() {
+    func_registry_ = std::make_unique<udf::Registry>("test");
+    EXPECT_TRUE(func_registry_->Register<MinSumUDA>("minsum").ok());
+
+    exec_state_ = MakeTestExecState(func_registry_.get());
+    EXPECT_OK(exec_state_->AddUDA(0, "minsum",
+                                  std::vector<types::DataType>({types::INT64, types::INT64})));
+  }
+
+ protected:
+  std::unique_ptr<ExecState> exec_state_;
+  std::unique_ptr<udf::Registry> func_registry_;
+};
+
+TEST_F(WindowAggNodeTest, no_groups_emits_closed_windows) {
+  auto plan_node = PlanNodeFromPbtxt(kNoGroupWindowAgg);
+  RowDescriptor input_rd(
+      {types::DataType::TIME64NS, types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<WindowAggNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  // Rows at t=10,20 land in window [0, 100); t=110 lands in [100, 200) and advances the
+  // watermark past the first window's end, which is emitted incrementally (eow, not eos).
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 3, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<Time64NSValue>({10, 20, 110})
+                       .AddColumn<Int64Value>({1, 2, 3})
+                       .AddColumn<Int64Value>({2, 5, 6})
+                       .get(),
+                   0)
+      .ExpectRowBatch(
+          RowBatchBuilder(output_rd, 1, true, false).AddColumn<Int64Value>({Int64Value(3)}).get())
+      // The second window keeps accumulating across batches and is flushed at eos.
+      .ConsumeNext(RowBatchBuilder(input_rd, 2, /*eow*/ false, /*eos*/ true)
+                       .AddColumn<Time64NSValue>({120, 130})
+                       .AddColumn<Int64Value>({4, 5})
+                       .AddColumn<Int64Value>({8, 1})
+                       .get(),
+                   0)
+      .ExpectRowBatch(
+          RowBatchBuilder(output_rd, 1, true, true).AddColumn<Int64Value>({Int64Value(8)}).get())
+      .Close();
+}
+
+TEST_F(WindowAggNodeTest, groups_with_lateness_and_late_row_drop) {
+  auto plan_node = PlanNodeFromPbtxt(kSingleGroupWindowAgg);
+  RowDescriptor input_rd({types::DataType::TIME64NS, types::DataType::INT64,
+                          types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64, types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<WindowAggNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  // With 50ns allowed lateness, the watermark at max event time 130 is 80, so window [0, 100)
+  // stays open and nothing is emitted yet.
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 3, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<Time64NSValue>({10, 20, 130})
+                       .AddColumn<Int64Value>({1, 2, 1})
+                       .AddColumn<Int64Value>({4, 2, 5})
+                       .AddColumn<Int64Value>({6, 3, 2})
+                       .get(),
+                   0, 0)
+      // An out-of-order row at t=30 still lands in the open first window. The row at t=200
+      // pushes the watermark to 150, closing window [0, 100) with both groups.
+      .ConsumeNext(RowBatchBuilder(input_rd, 2, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<Time64NSValue>({30, 200})
+                       .AddColumn<Int64Value>({2, 3})
+                       .AddColumn<Int64Value>({1, 7})
+                       .AddColumn<Int64Value>({9, 7})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 2, true, false)
+                          .AddColumn<Int64Value>({1, 2})
+                          .AddColumn<Int64Value>({4, 3})
+                          .get(),
+                      false)
+      // A row for the already-emitted first window is dropped; eos flushes the rest in window
+      // order, with the final batch carrying eos.
+      .ConsumeNext(RowBatchBuilder(input_rd, 1, /*eow*/ false, /*eos*/ false)
+                       .AddColumn<Time64NSValue>({40})
+                       .AddColumn<Int64Value>({1})
+                       .AddColumn<Int64Value>({100})
+                       .AddColumn<Int64Value>({100})
+                       .get(),
+                   0, 0)
+      .ConsumeNext(RowBatchBuilder(input_rd, 0, /*eow*/ false, /*eos*/ true)
+                       .AddColumn<Time64NSValue>({})
+                       .AddColumn<Int64Value>({})
+                       .AddColumn<Int64Value>({})
+                       .AddColumn<Int64Value>({})
+                       .get(),
+                   0, 2)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 1, true, false)
+                          .AddColumn<Int64Value>({1})
+                          .AddColumn<Int64Value>({2})
+                          .get())
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 1, true, true)
+                          .AddColumn<Int64Value>({3})
+                          .AddColumn<Int64Value>({7})
+                          .get())
+      .Close();
+}
+
+TEST_F(WindowAggNodeTest, eos_with_no_open_windows_forwards_marker) {
+  auto plan_node = PlanNodeFromPbtxt(kNoGroupWindowAgg);
+  RowDescriptor input_rd(
+      {types::DataType::TIME64NS, types::DataType::INT64, types::DataType::INT64});
+  RowDescriptor output_rd({types::DataType::INT64});
+
+  auto tester = exec::ExecNodeTester<WindowAggNode, plan::AggregateOperator>(
+      *plan_node, output_rd, {input_rd}, exec_state_.get());
+
+  tester
+      .ConsumeNext(RowBatchBuilder(input_rd, 0, /*eow*/ false, /*eos*/ true)
+                       .AddColumn<Time64NSValue>({})
+                       .AddColumn<Int64Value>({})
+                       .AddColumn<Int64Value>({})
+                       .get(),
+                   0)
+      .ExpectRowBatch(RowBatchBuilder(output_rd, 0, true, true).AddColumn<Int64Value>({}).get())
+      .Close();
+}
+
+}  // namespace exec
+}  // namespace carnot
+}  // namespace px
@@ -18,6 +18,13 @@
 
 #pragma once
 
+#include <arrow/array.h>
+#include <arrow/builder.h>
+
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
 #include "src/carnot/udf/registry.h"
 #include "src/shared/types/types.h"
 
@@ -43,6 +50,38 @@ class SelectUDF : public udf::ScalarUDF {
     return v2;
   }
 
+  Status ExecBatchArrow(FunctionContext*, const std::vector<arrow::Array*>& inputs,
+                        arrow::ArrayBuilder* output, int count) {
+    using ArrowArrayType = typename types::ValueTypeTraits<TArg>::arrow_array_type;
+    using ArrowBuilderType = typename types::ValueTypeTraits<TArg>::arrow_builder_type;
+    auto* selector = static_cast<arrow::BooleanArray*>(inputs[0]);
+    auto* lhs = static_cast<ArrowArrayType*>(inputs[1]);
+    auto* rhs = static_cast<ArrowArrayType*>(inputs[2]);
+    auto* builder = static_cast<ArrowBuilderType*>(output);
+    PL_RETURN_IF_ERROR(builder->Reserve(count));
+    if constexpr (std::is_same_v<TArg, types::StringValue>) {
+      // Pre-size the data buffer with the lengths of the chosen sides, then append views
+      // without per-row reallocation checks.
+      int64_t data_bytes = 0;
+      for (int i = 0; i < count; ++i) {
+        data_bytes += selector->Value(i) ? lhs->value_length(i) : rhs->value_length(i);
+      }
+      PL_RETURN_IF_ERROR(builder->ReserveData(data_bytes));
+      for (int i = 0; i < count; ++i) {
+        auto v = selector->Value(i) ? lhs->GetView(i) : rhs->GetView(i);
+        builder->UnsafeAppend(v.data(), v.size());
+      }
+    } else {
+      // Both sides are already materialized columns, so blending the raw values per row is
+      // branch-predictor-free (conditional move / SIMD blend) rather than a data-dependent
+      // branch.
+      for (int i = 0; i < count; ++i) {
+        builder->UnsafeAppend(selector->Value(i) ? lhs->Value(i) : rhs->Value(i));
+      }
+    }
+    return Status::OK();
+  }
+
   static udf::InfRuleVec SemanticInferenceRules() {
     // Match the 1st and 2nd arg.
     return {udf::InheritTypeFromArgs<SelectUDF>::CreateGeneric({1, 2})};
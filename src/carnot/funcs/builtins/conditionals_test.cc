@@ -23,6 +23,8 @@
 
 #include "src/carnot/funcs/builtins/conditionals.h"
 #include "src/carnot/udf/test_utils.h"
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
 
 namespace px {
 namespace carnot {
@@ -34,6 +36,47 @@ TEST(ConditionalsTest, SelectUDF) {
   udf_tester.ForInput(true, 20, 21).Expect(20);
 }
 
+TEST(ConditionalsTest, select_batch_arrow_int) {
+  auto selectors = std::vector<types::BoolValue>({true, false, true, false});
+  auto lhs = std::vector<types::Int64Value>({1, 2, 3, 4});
+  auto rhs = std::vector<types::Int64Value>({10, 20, 30, 40});
+  auto selector_arr = types::ToArrow(selectors, arrow::default_memory_pool());
+  auto lhs_arr = types::ToArrow(lhs, arrow::default_memory_pool());
+  auto rhs_arr = types::ToArrow(rhs, arrow::default_memory_pool());
+
+  SelectUDF<types::Int64Value> select;
+  arrow::Int64Builder builder;
+  EXPECT_OK(select.ExecBatchArrow(nullptr, {selector_arr.get(), lhs_arr.get(), rhs_arr.get()},
+                                  &builder, 4));
+  std::shared_ptr<arrow::Array> res;
+  EXPECT_TRUE(builder.Finish(&res).ok());
+  auto* res_arr = static_cast<arrow::Int64Array*>(res.get());
+  EXPECT_EQ(1, res_arr->Value(0));
+  EXPECT_EQ(20, res_arr->Value(1));
+  EXPECT_EQ(3, res_arr->Value(2));
+  EXPECT_EQ(40, res_arr->Value(3));
+}
+
+TEST(ConditionalsTest, select_batch_arrow_string) {
+  auto selectors = std::vector<types::BoolValue>({false, true, false});
+  auto lhs = std::vector<types::StringValue>({"2xx", "2xx", "2xx"});
+  auto rhs = std::vector<types::StringValue>({"error", "error", "error"});
+  auto selector_arr = types::ToArrow(selectors, arrow::default_memory_pool());
+  auto lhs_arr = types::ToArrow(lhs, arrow::default_memory_pool());
+  auto rhs_arr = types::ToArrow(rhs, arrow::default_memory_pool());
+
+  SelectUDF<types::StringValue> select;
+  arrow::StringBuilder builder;
+  EXPECT_OK(select.ExecBatchArrow(nullptr, {selector_arr.get(), lhs_arr.get(), rhs_arr.get()},
+                                  &builder, 3));
+  std::shared_ptr<arrow::Array> res;
+  EXPECT_TRUE(builder.Finish(&res).ok());
+  auto* res_arr = static_cast<arrow::StringArray*>(res.get());
+  EXPECT_EQ("error", res_arr->GetString(0));
+  EXPECT_EQ("2xx", res_arr->GetString(1));
+  EXPECT_EQ("error", res_arr->GetString(2));
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
@@ -18,6 +18,9 @@
 
 #include "src/carnot/funcs/builtins/json_ops.h"
 
+#include <string>
+#include <utility>
+
 #include "src/carnot/udf/registry.h"
 
 namespace px {
@@ -26,6 +29,44 @@ namespace builtins {
 
 using types::StringValue;
 
+namespace internal {
+
+ParsedDocCache* ParsedDocCache::GetThreadInstance() {
+  static thread_local ParsedDocCache cache;
+  return &cache;
+}
+
+const rapidjson::Document* ParsedDocCache::Parse(const std::string& in) {
+  if (in.size() > kMaxCachedDocSize) {
+    rapidjson::ParseResult ok = uncached_doc_.Parse(in.data());
+    return ok == nullptr ? nullptr : &uncached_doc_;
+  }
+
+  auto it = index_.find(in);
+  if (it != index_.end()) {
+    lru_.splice(lru_.begin(), lru_, it->second);
+    const auto& entry = it->second->second;
+    return entry.ok ? &entry.doc : nullptr;
+  }
+
+  lru_.emplace_front(in, Entry{});
+  auto& [key, entry] = lru_.front();
+  rapidjson::ParseResult ok = entry.doc.Parse(key.data());
+  entry.ok = !(ok == nullptr);
+  index_[key] = lru_.begin();
+  bytes_ += key.size();
+
+  while (bytes_ > kMaxCacheBytes && lru_.size() > 1) {
+    const auto& victim = lru_.back();
+    bytes_ -= victim.first.size();
+    index_.erase(victim.first);
+    lru_.pop_back();
+  }
+  return entry.ok ? &entry.doc : nullptr;
+}
+
+}  // namespace internal
+
 void RegisterJSONOpsOrDie(udf::Registry* registry) {
   registry->RegisterOrDie<PluckUDF>("pluck");
   registry->RegisterOrDie<PluckAsInt64UDF>("pluck_int64");
@@ -18,10 +18,13 @@
 
 #pragma once
 
+#include <list>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -33,24 +36,67 @@ namespace px {
 namespace carnot {
 namespace builtins {
 
+namespace internal {
+
+/**
+ * Thread-local cache of parsed JSON documents for the pluck family.
+ *
+ * Map operators evaluate expressions column-at-a-time, so a script that plucks several keys out
+ * of the same JSON column parses every document once per key. Expressions of a node always run
+ * on the same thread, so documents parsed by the first pluck of a batch are still cached when
+ * the later plucks revisit the same rows. Entries are keyed by document content, bounded by
+ * total source bytes with LRU eviction (the parsed DOM adds a constant factor on top), and
+ * oversized documents bypass the cache. Parse failures are cached as well so invalid rows only
+ * pay for parsing once.
+ */
+class ParsedDocCache {
+ public:
+  static ParsedDocCache* GetThreadInstance();
+
+  /**
+   * Returns the parsed document for the input, from cache when possible.
+   * Returns nullptr if the input is not valid JSON. The returned pointer is only valid until
+   * the next Parse call on this thread.
+   */
+  const rapidjson::Document* Parse(const std::string& in);
+
+ private:
+  struct Entry {
+    rapidjson::Document doc;
+    bool ok = false;
+  };
+
+  static constexpr size_t kMaxCachedDocSize = 64 * 1024;
+  static constexpr size_t kMaxCacheBytes = 4 * 1024 * 1024;
+
+  // Most recently used documents at the front. The index holds views into the list's keys,
+  // which are stable across splices and insertions.
+  std::list<std::pair<std::string, Entry>> lru_;
+  absl::flat_hash_map<std::string_view, std::list<std::pair<std::string, Entry>>::iterator>
+      index_;
+  size_t bytes_ = 0;
+  rapidjson::Document uncached_doc_;
+};
+
+}  // namespace internal
+
 // TODO(zasgar): PL-419 To have proper support for JSON we need structs and nullable types.
 // Revisit when we have them.
 class PluckUDF : public udf::ScalarUDF {
  public:
   StringValue Exec(FunctionContext*, StringValue in, StringValue key) {
-    rapidjson::Document d;
-    rapidjson::ParseResult ok = d.Parse(in.data());
+    const rapidjson::Document* d = internal::ParsedDocCache::GetThreadInstance()->Parse(in);
     // TODO(zasgar/michellenguyen, PP-419): Replace with null when available.
-    if (ok == nullptr) {
+    if (d == nullptr) {
       return "";
     }
-    if (!d.IsObject()) {
+    if (!d->IsObject()) {
       return "";
     }
-    if (!d.HasMember(key.data())) {
+    if (!d->HasMember(key.data())) {
       return "";
     }
-    const auto& plucked_value = d[key.data()];
+    const auto& plucked_value = (*d)[key.data()];
     if (plucked_value.IsNull()) {
       return "";
     }
@@ -87,19 +133,18 @@ class PluckUDF : public udf::ScalarUDF {
 class PluckAsInt64UDF : public udf::ScalarUDF {
  public:
   Int64Value Exec(FunctionContext*, StringValue in, StringValue key) {
-    rapidjson::Document d;
-    rapidjson::ParseResult ok = d.Parse(in.data());
+    const rapidjson::Document* d = internal::ParsedDocCache::GetThreadInstance()->Parse(in);
     // TODO(zasgar/michellenguyen, PP-419): Replace with null when available.
-    if (ok == nullptr) {
+    if (d == nullptr) {
       return 0;
     }
-    if (!d.IsObject()) {
+    if (!d->IsObject()) {
       return 0;
     }
-    if (!d.HasMember(key.data())) {
+    if (!d->HasMember(key.data())) {
       return 0;
     }
-    const auto& plucked_value = d[key.data()];
+    const auto& plucked_value = (*d)[key.data()];
     if (plucked_value.IsNull()) {
       return 0;
     }
@@ -131,19 +176,18 @@ class PluckAsInt64UDF : public udf::ScalarUDF {
 class PluckAsFloat64UDF : public udf::ScalarUDF {
  public:
   Float64Value Exec(FunctionContext*, StringValue in, StringValue key) {
-    rapidjson::Document d;
-    rapidjson::ParseResult ok = d.Parse(in.data());
+    const rapidjson::Document* d = internal::ParsedDocCache::GetThreadInstance()->Parse(in);
     // TODO(zasgar/michellenguyen, PP-419): Replace with null when available.
-    if (ok == nullptr) {
+    if (d == nullptr) {
       return 0.0;
     }
-    if (!d.IsObject()) {
+    if (!d->IsObject()) {
       return 0.0;
     }
-    if (!d.HasMember(key.data())) {
+    if (!d->HasMember(key.data())) {
       return 0.0;
     }
-    const auto& plucked_value = d[key.data()];
+    const auto& plucked_value = (*d)[key.data()];
     if (plucked_value.IsNull()) {
       return 0.0;
     }
@@ -178,16 +222,15 @@ class PluckAsFloat64UDF : public udf::ScalarUDF {
 class PluckArrayUDF : public udf::ScalarUDF {
  public:
   StringValue Exec(FunctionContext*, StringValue in, Int64Value index) {
-    rapidjson::Document d;
-    rapidjson::ParseResult ok = d.Parse(in.data());
+    const rapidjson::Document* d = internal::ParsedDocCache::GetThreadInstance()->Parse(in);
     // TODO(zasgar/michellenguyen, PP-419): Replace with null when available.
-    if (ok == nullptr) {
+    if (d == nullptr) {
       return "";
     }
-    if (!d.IsArray()) {
+    if (!d->IsArray()) {
       return "";
     }
-    const auto& plucked_array = d.GetArray();
+    const auto& plucked_array = d->GetArray();
     if (index < 0 || index >= plucked_array.Size()) {
       return "";
     }
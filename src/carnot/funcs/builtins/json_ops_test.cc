@@ -60,6 +60,21 @@ TEST(JSONOps, PluckUDF_non_object_input_return_empty) {
   udf_tester.ForInput("[\"asdad\"]", "str_key").Expect("");
 }
 
+TEST(JSONOps, PluckUDF_repeated_plucks_share_parsed_doc) {
+  // Different pluck UDFs on the same thread share the parsed-document cache, so repeated plucks
+  // of the same document (and repeated failures on the same bad document) must stay consistent.
+  auto udf_tester = udf::UDFTester<PluckUDF>();
+  udf_tester.ForInput(kTestJSONStr, "str_plain").Expect("abc");
+  udf_tester.ForInput(kTestJSONStr, "int64_key").Expect("34243242341");
+  udf_tester.ForInput(kTestJSONStr, "str_plain").Expect("abc");
+
+  auto int_udf_tester = udf::UDFTester<PluckAsInt64UDF>();
+  int_udf_tester.ForInput(kTestJSONStr, "int64_key").Expect(34243242341);
+
+  udf_tester.ForInput("{invalid", "str_plain").Expect("");
+  udf_tester.ForInput("{invalid", "str_plain").Expect("");
+}
+
 TEST(JSONOps, PluckAsInt64UDF) {
   auto udf_tester = udf::UDFTester<PluckAsInt64UDF>();
   udf_tester.ForInput(kTestJSONStr, "str_key").Expect(0);
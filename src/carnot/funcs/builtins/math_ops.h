@@ -18,11 +18,16 @@
 
 #pragma once
 
+#include <arrow/array.h>
+
 #include <cmath>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "src/carnot/udf/registry.h"
 #include "src/carnot/udf/type_inference.h"
+#include "src/carnot/udf/uda_serde.h"
 #include "src/shared/types/types.h"
 #include "src/shared/types/typespb/types.pb.h"
 
@@ -30,6 +35,27 @@ namespace px {
 namespace carnot {
 namespace builtins {
 
+namespace internal {
+/**
+ * Cascade (pairwise) summation over a contiguous block of numeric values. Halving the block
+ * keeps the floating point error growth logarithmic in the block size instead of linear, and
+ * the base case is a straight-line loop the compiler can vectorize.
+ */
+template <typename T>
+inline double PairwiseSum(const T* vals, int64_t count) {
+  constexpr int64_t kBaseCaseSize = 128;
+  if (count <= kBaseCaseSize) {
+    double sum = 0;
+    for (int64_t i = 0; i < count; ++i) {
+      sum += static_cast<double>(vals[i]);
+    }
+    return sum;
+  }
+  int64_t half = count / 2;
+  return PairwiseSum(vals, half) + PairwiseSum(vals + half, count - half);
+}
+}  // namespace internal
+
 udf::ScalarUDFDocBuilder AddDoc();
 template <typename TReturn, typename TArg1 = TReturn, typename TArg2 = TReturn>
 class AddUDF : public udf::ScalarUDF {
@@ -588,6 +614,19 @@ class MeanUDA : public udf::UDA {
     info_.size++;
     info_.count += arg.val;
   }
+  Status UpdateBatchArrow(FunctionContext*, const std::vector<const arrow::Array*>& inputs) {
+    using ArrowArrayType = typename types::ValueTypeTraits<TArg>::arrow_array_type;
+    const auto* arr = static_cast<const ArrowArrayType*>(inputs[0]);
+    if constexpr (std::is_same_v<ArrowArrayType, arrow::BooleanArray>) {
+      for (int64_t i = 0; i < arr->length(); ++i) {
+        info_.count += arr->Value(i);
+      }
+    } else {
+      info_.count += internal::PairwiseSum(arr->raw_values(), arr->length());
+    }
+    info_.size += arr->length();
+    return Status::OK();
+  }
   void Merge(FunctionContext*, const MeanUDA& other) {
     info_.size += other.info_.size;
     info_.count += other.info_.count;
@@ -600,13 +639,10 @@ class MeanUDA : public udf::UDA {
                                                        types::ST_DURATION_NS, types::ST_PERCENT})};
   }
 
-  StringValue Serialize(FunctionContext*) {
-    return StringValue(reinterpret_cast<char*>(&info_), sizeof(info_));
-  }
+  StringValue Serialize(FunctionContext*) { return udf::SerializePodUDAState(info_); }
 
   Status Deserialize(FunctionContext*, const StringValue& data) {
-    info_ = *reinterpret_cast<const MeanInfo*>(data.data());
-    return Status::OK();
+    return udf::DeserializePodUDAState(data, &info_);
   }
   static udf::UDADocBuilder Doc() {
     return udf::UDADocBuilder("Calculate the arithmetic mean.")
@@ -631,6 +667,29 @@ template <typename TArg, typename TAggType = TArg>
 class SumUDA : public udf::UDA {
  public:
   void Update(FunctionContext*, TArg arg) { sum_ = sum_.val + arg.val; }
+  Status UpdateBatchArrow(FunctionContext*, const std::vector<const arrow::Array*>& inputs) {
+    using NativeAggType = typename types::ValueTypeTraits<TAggType>::native_type;
+    using ArrowArrayType = typename types::ValueTypeTraits<TArg>::arrow_array_type;
+    const auto* arr = static_cast<const ArrowArrayType*>(inputs[0]);
+    if constexpr (std::is_same_v<ArrowArrayType, arrow::BooleanArray>) {
+      NativeAggType sum = 0;
+      for (int64_t i = 0; i < arr->length(); ++i) {
+        sum += arr->Value(i);
+      }
+      sum_ = sum_.val + sum;
+    } else if constexpr (std::is_floating_point_v<NativeAggType>) {
+      sum_ = sum_.val + internal::PairwiseSum(arr->raw_values(), arr->length());
+    } else {
+      // Integer sums are exact regardless of order; a plain loop vectorizes well.
+      const auto* vals = arr->raw_values();
+      NativeAggType sum = 0;
+      for (int64_t i = 0; i < arr->length(); ++i) {
+        sum += vals[i];
+      }
+      sum_ = sum_.val + sum;
+    }
+    return Status::OK();
+  }
   void Merge(FunctionContext*, const SumUDA& other) { sum_ = sum_.val + other.sum_.val; }
   TAggType Finalize(FunctionContext*) { return sum_; }
   static udf::InfRuleVec SemanticInferenceRules() {
@@ -638,13 +697,12 @@ class SumUDA : public udf::UDA {
                                                       types::ST_THROUGHPUT_BYTES_PER_NS,
                                                       types::ST_PERCENT})};
   }
-  StringValue Serialize(FunctionContext*) {
-    return StringValue(reinterpret_cast<char*>(&sum_), sizeof(sum_));
-  }
+  StringValue Serialize(FunctionContext*) { return udf::SerializePodUDAState(sum_.val); }
 
   Status Deserialize(FunctionContext*, const StringValue& data) {
-    sum_ = *reinterpret_cast<const typename types::ValueTypeTraits<TAggType>::native_type*>(
-        data.data());
+    typename types::ValueTypeTraits<TAggType>::native_type val;
+    PL_RETURN_IF_ERROR(udf::DeserializePodUDAState(data, &val));
+    sum_ = val;
     return Status::OK();
   }
 
@@ -687,13 +745,12 @@ class MaxUDA : public udf::UDA {
         .Returns("The maximum value in the group.");
   }
 
-  StringValue Serialize(FunctionContext*) {
-    return StringValue(reinterpret_cast<char*>(&max_), sizeof(max_));
-  }
+  StringValue Serialize(FunctionContext*) { return udf::SerializePodUDAState(max_.val); }
 
   Status Deserialize(FunctionContext*, const StringValue& data) {
-    max_ =
-        *reinterpret_cast<const typename types::ValueTypeTraits<TArg>::native_type*>(data.data());
+    typename types::ValueTypeTraits<TArg>::native_type val;
+    PL_RETURN_IF_ERROR(udf::DeserializePodUDAState(data, &val));
+    max_ = val;
     return Status::OK();
   }
 
@@ -722,13 +779,12 @@ class MinUDA : public udf::UDA {
                                                       types::ST_DURATION_NS, types::ST_PERCENT})};
   }
 
-  StringValue Serialize(FunctionContext*) {
-    return StringValue(reinterpret_cast<char*>(&min_), sizeof(min_));
-  }
+  StringValue Serialize(FunctionContext*) { return udf::SerializePodUDAState(min_.val); }
 
   Status Deserialize(FunctionContext*, const StringValue& data) {
-    min_ =
-        *reinterpret_cast<const typename types::ValueTypeTraits<TArg>::native_type*>(data.data());
+    typename types::ValueTypeTraits<TArg>::native_type val;
+    PL_RETURN_IF_ERROR(udf::DeserializePodUDAState(data, &val));
+    min_ = val;
     return Status::OK();
   }
   static udf::UDADocBuilder Doc() {
@@ -746,16 +802,17 @@ template <typename TArg>
 class CountUDA : public udf::UDA {
  public:
   void Update(FunctionContext*, TArg) { count_++; }
+  Status UpdateBatchArrow(FunctionContext*, const std::vector<const arrow::Array*>& inputs) {
+    count_ += inputs[0]->length();
+    return Status::OK();
+  }
   void Merge(FunctionContext*, const CountUDA& other) { count_ += other.count_; }
   Int64Value Finalize(FunctionContext*) { return count_; }
 
-  StringValue Serialize(FunctionContext*) {
-    return StringValue(reinterpret_cast<char*>(&count_), sizeof(count_));
-  }
+  StringValue Serialize(FunctionContext*) { return udf::SerializePodUDAState(count_); }
 
   Status Deserialize(FunctionContext*, const StringValue& data) {
-    count_ = *reinterpret_cast<const uint64_t*>(data.data());
-    return Status::OK();
+    return udf::DeserializePodUDAState(data, &count_);
   }
 
   static udf::UDADocBuilder Doc() {
@@ -565,6 +565,43 @@ TEST(MathOps, merge_sum_test) {
   uda_tester.Merge(&other_uda_tester).Expect(expected_sum);
 }
 
+TEST(MathOps, batch_arrow_mean_uda_test) {
+  auto inputs = std::vector<types::Float64Value>({1.234, 2.442, 1.04, 5.322, 6.333});
+  auto arr = types::ToArrow(inputs, arrow::default_memory_pool());
+
+  MeanUDA<types::Float64Value> uda;
+  EXPECT_OK(uda.UpdateBatchArrow(nullptr, {arr.get()}));
+  // Mix in a scalar update to check that both paths feed the same state.
+  uda.Update(nullptr, 2.629);
+  EXPECT_DOUBLE_EQ((1.234 + 2.442 + 1.04 + 5.322 + 6.333 + 2.629) / 6, uda.Finalize(nullptr).val);
+}
+
+TEST(MathOps, batch_arrow_sum_uda_test) {
+  auto inputs = std::vector<types::Int64Value>({3, 6, 10, 5, 2});
+  auto arr = types::ToArrow(inputs, arrow::default_memory_pool());
+
+  SumUDA<types::Int64Value> uda;
+  EXPECT_OK(uda.UpdateBatchArrow(nullptr, {arr.get()}));
+  EXPECT_EQ(26, uda.Finalize(nullptr).val);
+
+  // Pairwise summation on the float path should stay close to the sequential sum.
+  auto float_inputs = std::vector<types::Float64Value>(1000, 0.1);
+  auto float_arr = types::ToArrow(float_inputs, arrow::default_memory_pool());
+  SumUDA<types::Float64Value> float_uda;
+  EXPECT_OK(float_uda.UpdateBatchArrow(nullptr, {float_arr.get()}));
+  EXPECT_NEAR(100.0, float_uda.Finalize(nullptr).val, 1e-9);
+}
+
+TEST(MathOps, batch_arrow_count_uda_test) {
+  auto inputs = std::vector<types::StringValue>({"a", "b", "c"});
+  auto arr = types::ToArrow(inputs, arrow::default_memory_pool());
+
+  CountUDA<types::StringValue> uda;
+  EXPECT_OK(uda.UpdateBatchArrow(nullptr, {arr.get()}));
+  uda.Update(nullptr, "d");
+  EXPECT_EQ(4, uda.Finalize(nullptr).val);
+}
+
 TEST(MathOps, basic_int64_max_uda_test) {
   auto uda_tester = udf::UDATester<MaxUDA<types::Int64Value>>();
   uda_tester.ForInput(3).Expect(3);
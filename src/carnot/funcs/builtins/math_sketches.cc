@@ -25,6 +25,9 @@ namespace builtins {
 void RegisterMathSketchesOrDie(udf::Registry* registry) {
   registry->RegisterOrDie<QuantilesUDA<types::Int64Value>>("quantiles");
   registry->RegisterOrDie<QuantilesUDA<types::Float64Value>>("quantiles");
+  registry->RegisterOrDie<DDSketchQuantilesUDA<types::Int64Value>>("ddsketch_quantiles");
+  registry->RegisterOrDie<DDSketchQuantilesUDA<types::Float64Value>>("ddsketch_quantiles");
+  registry->RegisterOrDie<HeavyHittersUDA>("heavy_hitters");
 }
 
 }  // namespace builtins
@@ -21,6 +21,17 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <absl/container/flat_hash_map.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include "src/carnot/udf/registry.h"
 #include "src/shared/types/types.h"
 #include "tdigest/tdigest.h"
@@ -81,6 +92,433 @@ class QuantilesUDA : public udf::UDA {
   tdigest::TDigest digest_;
 };
 
+/**
+ * DDSketch with a logarithmic mapping and a dense, collapsing bucket store.
+ *
+ * Values are mapped to buckets with key = ceil(log(v) / log(gamma)) where
+ * gamma = (1 + alpha) / (1 - alpha), which guarantees that any quantile estimate is within a
+ * relative error of alpha of an exact rank query. Updates and merges are O(1) per bucket touched,
+ * and the state is a contiguous count array that serializes to a few kilobytes regardless of how
+ * many samples were added. When the store exceeds its budget the lowest buckets are collapsed
+ * into one, so only the lowest quantiles lose accuracy.
+ *
+ * Zero and negative values (which the log mapping can't index) are tracked in a separate count.
+ */
+class DDSketch {
+ public:
+  static constexpr double kDefaultRelativeAccuracy = 0.01;
+
+  explicit DDSketch(double relative_accuracy = kDefaultRelativeAccuracy)
+      : gamma_((1.0 + relative_accuracy) / (1.0 - relative_accuracy)),
+        log_gamma_(std::log(gamma_)) {}
+
+  void Add(double val) {
+    ++total_count_;
+    if (val < std::numeric_limits<double>::min()) {
+      ++zero_count_;
+      return;
+    }
+    AddToBucket(Key(val), 1);
+  }
+
+  // Merging assumes both sketches were built with the same relative accuracy (and therefore
+  // share bucket boundaries), which holds for partials produced by the same UDA.
+  void Merge(const DDSketch& other) {
+    total_count_ += other.total_count_;
+    zero_count_ += other.zero_count_;
+    for (size_t i = 0; i < other.counts_.size(); ++i) {
+      if (other.counts_[i] > 0) {
+        AddToBucket(other.min_key_ + static_cast<int32_t>(i), other.counts_[i]);
+      }
+    }
+  }
+
+  double Quantile(double q) const {
+    if (total_count_ == 0) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    auto rank = static_cast<uint64_t>(q * static_cast<double>(total_count_ - 1));
+    if (rank < zero_count_) {
+      return 0.0;
+    }
+    uint64_t cumulative = zero_count_;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+      cumulative += counts_[i];
+      if (cumulative > rank) {
+        return BucketValue(min_key_ + static_cast<int32_t>(i));
+      }
+    }
+    return BucketValue(min_key_ + static_cast<int32_t>(counts_.size()) - 1);
+  }
+
+  uint64_t count() const { return total_count_; }
+
+  StringValue Serialize() const {
+    StringValue out;
+    out.resize(kSerializedHeaderSize + counts_.size() * sizeof(uint64_t));
+    char* buf = out.data();
+    buf[0] = kSerdeVersion;
+    size_t offset = 1;
+    auto append = [&](const auto& val) {
+      std::memcpy(buf + offset, &val, sizeof(val));
+      offset += sizeof(val);
+    };
+    append(zero_count_);
+    append(total_count_);
+    append(min_key_);
+    append(static_cast<uint32_t>(counts_.size()));
+    for (uint64_t c : counts_) {
+      append(c);
+    }
+    return out;
+  }
+
+  Status Deserialize(const StringValue& data) {
+    if (data.size() < kSerializedHeaderSize) {
+      return error::InvalidArgument("Serialized DDSketch is $0 bytes, expected at least $1",
+                                    data.size(), kSerializedHeaderSize);
+    }
+    if (data[0] != kSerdeVersion) {
+      return error::InvalidArgument("Serialized DDSketch has version $0, expected $1",
+                                    static_cast<int>(data[0]), static_cast<int>(kSerdeVersion));
+    }
+    const char* buf = data.data();
+    size_t offset = 1;
+    auto read = [&](auto* val) {
+      std::memcpy(val, buf + offset, sizeof(*val));
+      offset += sizeof(*val);
+    };
+    read(&zero_count_);
+    read(&total_count_);
+    read(&min_key_);
+    uint32_t num_buckets;
+    read(&num_buckets);
+    if (data.size() != kSerializedHeaderSize + num_buckets * sizeof(uint64_t)) {
+      return error::InvalidArgument("Serialized DDSketch is $0 bytes, expected $1 for $2 buckets",
+                                    data.size(),
+                                    kSerializedHeaderSize + num_buckets * sizeof(uint64_t),
+                                    num_buckets);
+    }
+    counts_.resize(num_buckets);
+    for (uint32_t i = 0; i < num_buckets; ++i) {
+      read(&counts_[i]);
+    }
+    return Status::OK();
+  }
+
+ private:
+  // With the default 1% accuracy, 2048 buckets span roughly 40 decades of dynamic range, so the
+  // collapse path only triggers on pathological inputs.
+  static constexpr size_t kMaxNumBuckets = 2048;
+  static constexpr uint8_t kSerdeVersion = 1;
+  // version + zero_count + total_count + min_key + num_buckets.
+  static constexpr size_t kSerializedHeaderSize =
+      1 + sizeof(uint64_t) + sizeof(uint64_t) + sizeof(int32_t) + sizeof(uint32_t);
+
+  int32_t Key(double val) const {
+    return static_cast<int32_t>(std::ceil(std::log(val) / log_gamma_));
+  }
+
+  double BucketValue(int32_t key) const { return 2.0 * std::pow(gamma_, key) / (gamma_ + 1.0); }
+
+  void AddToBucket(int32_t key, uint64_t count) {
+    if (counts_.empty()) {
+      min_key_ = key;
+      counts_.push_back(count);
+      return;
+    }
+    if (key < min_key_) {
+      counts_.insert(counts_.begin(), min_key_ - key, 0);
+      min_key_ = key;
+    } else if (key >= min_key_ + static_cast<int32_t>(counts_.size())) {
+      counts_.resize(key - min_key_ + 1, 0);
+    }
+    counts_[key - min_key_] += count;
+    if (counts_.size() > kMaxNumBuckets) {
+      CollapseLowest();
+    }
+  }
+
+  void CollapseLowest() {
+    size_t excess = counts_.size() - kMaxNumBuckets;
+    uint64_t collapsed = 0;
+    for (size_t i = 0; i <= excess; ++i) {
+      collapsed += counts_[i];
+    }
+    counts_.erase(counts_.begin(), counts_.begin() + excess);
+    counts_[0] = collapsed;
+    min_key_ += static_cast<int32_t>(excess);
+  }
+
+  double gamma_;
+  double log_gamma_;
+  uint64_t zero_count_ = 0;
+  uint64_t total_count_ = 0;
+  int32_t min_key_ = 0;
+  std::vector<uint64_t> counts_;
+};
+
+// TODO(zasgar): PL-419 Replace this when we add support for structs.
+template <typename TArg>
+class DDSketchQuantilesUDA : public udf::UDA {
+ public:
+  void Update(FunctionContext*, TArg val) { sketch_.Add(static_cast<double>(val.val)); }
+  void Merge(FunctionContext*, const DDSketchQuantilesUDA& other) { sketch_.Merge(other.sketch_); }
+
+  StringValue Finalize(FunctionContext*) {
+    rapidjson::Document d;
+    d.SetObject();
+    d.AddMember("p01", sketch_.Quantile(0.01), d.GetAllocator());
+    d.AddMember("p10", sketch_.Quantile(0.10), d.GetAllocator());
+    d.AddMember("p25", sketch_.Quantile(0.25), d.GetAllocator());
+    d.AddMember("p50", sketch_.Quantile(0.50), d.GetAllocator());
+    d.AddMember("p75", sketch_.Quantile(0.75), d.GetAllocator());
+    d.AddMember("p90", sketch_.Quantile(0.90), d.GetAllocator());
+    d.AddMember("p99", sketch_.Quantile(0.99), d.GetAllocator());
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    d.Accept(writer);
+    return sb.GetString();
+  }
+
+  StringValue Serialize(FunctionContext*) { return sketch_.Serialize(); }
+
+  Status Deserialize(FunctionContext*, const StringValue& data) {
+    return sketch_.Deserialize(data);
+  }
+
+  static udf::InfRuleVec SemanticInferenceRules() {
+    return {udf::ExplicitRule::Create<DDSketchQuantilesUDA>(types::ST_QUANTILES, {types::ST_NONE}),
+            udf::ExplicitRule::Create<DDSketchQuantilesUDA>(types::ST_DURATION_NS_QUANTILES,
+                                                            {types::ST_DURATION_NS})};
+  }
+
+  static udf::UDADocBuilder Doc() {
+    return udf::UDADocBuilder("Approximates the distribution of the aggregated data.")
+        .Details(
+            "Calculates several useful percentiles of the aggregated data using a "
+            "[DDSketch](https://arxiv.org/abs/1908.10693), which guarantees a 1% relative error "
+            "on every percentile and keeps a compact mergeable state, so it is suitable for "
+            "distributed aggregation over very large groups. Returns a serialized JSON object "
+            "with keys for 1%, 10%, 25%, 50%, 75%, 90%, and 99%. You can use `px.pluck_float64` "
+            "to grab the specific values from the result.")
+        .Example(R"doc(
+        | # Calculate the quantiles.
+        | df = df.agg(latency_dist=('latency_ms', px.ddsketch_quantiles))
+        | # Pluck p99 from the quantiles.
+        | df.p99 = px.pluck_float64(df.latency_dist, 'p99')
+        )doc")
+        .Arg("val", "The data to calculate the quantiles distribution.")
+        .Returns("The quantiles data, serialized as a JSON dictionary.");
+  }
+
+ protected:
+  DDSketch sketch_;
+};
+
+/**
+ * Space-saving summary for heavy hitters (Metwally et al., "Efficient Computation of Frequent and
+ * Top-k Elements in Data Streams").
+ *
+ * The summary keeps at most k counters. A new value that arrives when all counters are taken
+ * evicts the current minimum and inherits its count, recording that count as the new entry's
+ * error bound. Estimated counts therefore never undercount by more than N/k, where N is the
+ * stream length, regardless of the input cardinality.
+ *
+ * Merging combines the counters of two summaries and keeps the k largest, which preserves the
+ * heavy hitters of the union; the dropped tail is again bounded by N/k of the combined stream.
+ */
+class SpaceSaving {
+ public:
+  static constexpr size_t kDefaultNumCounters = 100;
+
+  explicit SpaceSaving(size_t num_counters = kDefaultNumCounters) : num_counters_(num_counters) {}
+
+  void Add(const std::string& val) { AddCount(val, 1, 0); }
+
+  void Merge(const SpaceSaving& other) {
+    for (const auto& [val, counter] : other.counters_) {
+      AddCount(val, counter.count, counter.error);
+    }
+  }
+
+  // Returns the tracked values ordered by estimated count, descending.
+  std::vector<std::tuple<std::string, uint64_t, uint64_t>> SortedCounters() const {
+    std::vector<std::tuple<std::string, uint64_t, uint64_t>> out;
+    out.reserve(counters_.size());
+    for (const auto& [val, counter] : counters_) {
+      out.emplace_back(val, counter.count, counter.error);
+    }
+    std::sort(out.begin(), out.end(), [](const auto& a, const auto& b) {
+      return std::get<1>(a) > std::get<1>(b);
+    });
+    return out;
+  }
+
+  size_t size() const { return counters_.size(); }
+
+  StringValue Serialize() const {
+    size_t num_bytes = kSerializedHeaderSize;
+    for (const auto& [val, counter] : counters_) {
+      num_bytes += sizeof(uint32_t) + val.size() + sizeof(counter.count) + sizeof(counter.error);
+    }
+    StringValue out;
+    out.resize(num_bytes);
+    char* buf = out.data();
+    buf[0] = kSerdeVersion;
+    size_t offset = 1;
+    auto append = [&](const void* data, size_t size) {
+      std::memcpy(buf + offset, data, size);
+      offset += size;
+    };
+    auto num_entries = static_cast<uint32_t>(counters_.size());
+    append(&num_entries, sizeof(num_entries));
+    for (const auto& [val, counter] : counters_) {
+      auto len = static_cast<uint32_t>(val.size());
+      append(&len, sizeof(len));
+      append(val.data(), len);
+      append(&counter.count, sizeof(counter.count));
+      append(&counter.error, sizeof(counter.error));
+    }
+    return out;
+  }
+
+  Status Deserialize(const StringValue& data) {
+    if (data.size() < kSerializedHeaderSize) {
+      return error::InvalidArgument("Serialized SpaceSaving is $0 bytes, expected at least $1",
+                                    data.size(), kSerializedHeaderSize);
+    }
+    if (data[0] != kSerdeVersion) {
+      return error::InvalidArgument("Serialized SpaceSaving has version $0, expected $1",
+                                    static_cast<int>(data[0]), static_cast<int>(kSerdeVersion));
+    }
+    const char* buf = data.data();
+    size_t offset = 1;
+    auto read = [&](void* out, size_t size) -> bool {
+      if (offset + size > data.size()) {
+        return false;
+      }
+      std::memcpy(out, buf + offset, size);
+      offset += size;
+      return true;
+    };
+    uint32_t num_entries = 0;
+    read(&num_entries, sizeof(num_entries));
+    counters_.clear();
+    for (uint32_t i = 0; i < num_entries; ++i) {
+      uint32_t len = 0;
+      if (!read(&len, sizeof(len)) || offset + len > data.size()) {
+        return error::InvalidArgument("Serialized SpaceSaving truncated at entry $0", i);
+      }
+      std::string val(buf + offset, len);
+      offset += len;
+      Counter counter;
+      if (!read(&counter.count, sizeof(counter.count)) ||
+          !read(&counter.error, sizeof(counter.error))) {
+        return error::InvalidArgument("Serialized SpaceSaving truncated at entry $0", i);
+      }
+      counters_[std::move(val)] = counter;
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Counter {
+    uint64_t count = 0;
+    // Upper bound on how much count overestimates the true frequency, inherited from the counter
+    // this entry evicted.
+    uint64_t error = 0;
+  };
+
+  static constexpr uint8_t kSerdeVersion = 1;
+  // version + num_entries.
+  static constexpr size_t kSerializedHeaderSize = 1 + sizeof(uint32_t);
+
+  void AddCount(const std::string& val, uint64_t count, uint64_t error) {
+    auto it = counters_.find(val);
+    if (it != counters_.end()) {
+      it->second.count += count;
+      it->second.error += error;
+      return;
+    }
+    if (counters_.size() < num_counters_) {
+      counters_[val] = Counter{count, error};
+      return;
+    }
+    auto min_it = counters_.begin();
+    for (auto cand = counters_.begin(); cand != counters_.end(); ++cand) {
+      if (cand->second.count < min_it->second.count) {
+        min_it = cand;
+      }
+    }
+    if (min_it->second.count >= count + error) {
+      // A merged entry smaller than the current minimum can be dropped outright; replacing the
+      // minimum with it would only lose information.
+      return;
+    }
+    uint64_t min_count = min_it->second.count;
+    counters_.erase(min_it);
+    counters_[val] = Counter{min_count + count, min_count + error};
+  }
+
+  size_t num_counters_;
+  absl::flat_hash_map<std::string, Counter> counters_;
+};
+
+// TODO(zasgar): PL-419 Replace this when we add support for structs.
+class HeavyHittersUDA : public udf::UDA {
+ public:
+  void Update(FunctionContext*, StringValue val) { summary_.Add(val); }
+  void Merge(FunctionContext*, const HeavyHittersUDA& other) { summary_.Merge(other.summary_); }
+
+  StringValue Finalize(FunctionContext*) {
+    rapidjson::Document d;
+    d.SetArray();
+    auto& allocator = d.GetAllocator();
+    for (const auto& [val, count, error] : summary_.SortedCounters()) {
+      rapidjson::Value entry(rapidjson::kObjectType);
+      entry.AddMember(
+          "value",
+          rapidjson::Value(val.data(), static_cast<rapidjson::SizeType>(val.size()), allocator),
+          allocator);
+      entry.AddMember("count", count, allocator);
+      entry.AddMember("error", error, allocator);
+      d.PushBack(entry, allocator);
+    }
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+    d.Accept(writer);
+    return sb.GetString();
+  }
+
+  StringValue Serialize(FunctionContext*) { return summary_.Serialize(); }
+
+  Status Deserialize(FunctionContext*, const StringValue& data) {
+    return summary_.Deserialize(data);
+  }
+
+  static udf::UDADocBuilder Doc() {
+    return udf::UDADocBuilder("Approximates the most frequent values of the aggregated data.")
+        .Details(
+            "Tracks the heavy hitters of the aggregated column with a space-saving sketch, which "
+            "keeps a fixed number of counters (100) no matter how many distinct values are seen, "
+            "so top-k queries over high-cardinality columns like URL paths run in kilobytes of "
+            "state. Returns a serialized JSON array of objects ordered by estimated count, "
+            "descending, where each object has the keys `value`, `count` (estimated frequency), "
+            "and `error` (upper bound on how much `count` may overestimate). Estimates are exact "
+            "whenever the number of distinct values stays under the counter budget.")
+        .Example(R"doc(
+        | # Find the most frequent request paths.
+        | df = df.agg(top_paths=('req_path', px.heavy_hitters))
+        )doc")
+        .Arg("val", "The data to find the most frequent values of.")
+        .Returns("The heavy hitters with estimated counts, serialized as a JSON array.");
+  }
+
+ protected:
+  SpaceSaving summary_;
+};
+
 void RegisterMathSketchesOrDie(udf::Registry* registry);
 
 }  // namespace builtins
@@ -22,6 +22,7 @@
 #include "src/carnot/funcs/builtins/math_sketches.h"
 #include "src/carnot/udf/test_utils.h"
 #include "src/common/base/base.h"
+#include "src/common/testing/testing.h"
 
 namespace px {
 namespace carnot {
@@ -69,6 +70,116 @@ TEST(MathSketches, quantiles_int64) {
   EXPECT_DOUBLE_EQ(d["p99"].GetDouble(), 6);
 }
 
+TEST(MathSketches, ddsketch_quantiles_relative_error) {
+  auto uda_tester = udf::UDATester<DDSketchQuantilesUDA<types::Int64Value>>();
+  for (int64_t i = 1; i <= 1000; ++i) {
+    uda_tester.ForInput(i);
+  }
+  auto res = uda_tester.Result();
+
+  rapidjson::Document d;
+  d.Parse(res.data());
+  // The sketch guarantees a 1% relative error on every quantile.
+  EXPECT_NEAR(500, d["p50"].GetDouble(), 500 * 0.011);
+  EXPECT_NEAR(900, d["p90"].GetDouble(), 900 * 0.011);
+  EXPECT_NEAR(990, d["p99"].GetDouble(), 990 * 0.011);
+}
+
+TEST(MathSketches, ddsketch_quantiles_merge) {
+  auto uda_tester = udf::UDATester<DDSketchQuantilesUDA<types::Float64Value>>();
+  auto other_uda_tester = udf::UDATester<DDSketchQuantilesUDA<types::Float64Value>>();
+  for (int64_t i = 1; i <= 500; ++i) {
+    uda_tester.ForInput(static_cast<double>(i));
+    other_uda_tester.ForInput(static_cast<double>(500 + i));
+  }
+  auto res = uda_tester.Merge(&other_uda_tester).Result();
+
+  rapidjson::Document d;
+  d.Parse(res.data());
+  EXPECT_NEAR(500, d["p50"].GetDouble(), 500 * 0.011);
+  EXPECT_NEAR(990, d["p99"].GetDouble(), 990 * 0.011);
+}
+
+TEST(MathSketches, ddsketch_serde_roundtrip) {
+  DDSketch sketch;
+  for (int64_t i = 1; i <= 1000; ++i) {
+    sketch.Add(static_cast<double>(i));
+  }
+  sketch.Add(0);
+
+  DDSketch out;
+  ASSERT_OK(out.Deserialize(sketch.Serialize()));
+  EXPECT_EQ(sketch.count(), out.count());
+  EXPECT_DOUBLE_EQ(sketch.Quantile(0.5), out.Quantile(0.5));
+  EXPECT_DOUBLE_EQ(sketch.Quantile(0.99), out.Quantile(0.99));
+
+  EXPECT_NOT_OK(out.Deserialize(types::StringValue("not a sketch")));
+}
+
+TEST(MathSketches, heavy_hitters_exact_under_budget) {
+  auto uda_tester = udf::UDATester<HeavyHittersUDA>();
+  for (int i = 0; i < 5; ++i) {
+    uda_tester.ForInput("/api/v1/query");
+  }
+  for (int i = 0; i < 3; ++i) {
+    uda_tester.ForInput("/healthz");
+  }
+  uda_tester.ForInput("/metrics");
+  auto res = uda_tester.Result();
+
+  rapidjson::Document d;
+  d.Parse(res.data());
+  ASSERT_TRUE(d.IsArray());
+  ASSERT_EQ(3, d.Size());
+  // Under the counter budget the counts are exact and ordered by frequency.
+  EXPECT_STREQ("/api/v1/query", d[0]["value"].GetString());
+  EXPECT_EQ(5, d[0]["count"].GetUint64());
+  EXPECT_EQ(0, d[0]["error"].GetUint64());
+  EXPECT_STREQ("/healthz", d[1]["value"].GetString());
+  EXPECT_EQ(3, d[1]["count"].GetUint64());
+  EXPECT_STREQ("/metrics", d[2]["value"].GetString());
+  EXPECT_EQ(1, d[2]["count"].GetUint64());
+}
+
+TEST(MathSketches, heavy_hitters_bounded_state_and_merge) {
+  auto uda_tester = udf::UDATester<HeavyHittersUDA>();
+  auto other_uda_tester = udf::UDATester<HeavyHittersUDA>();
+  // Two disjoint long tails of distinct values, plus a heavy hitter in each partial.
+  for (int i = 0; i < 1000; ++i) {
+    uda_tester.ForInput(absl::Substitute("/tail/a/$0", i));
+    uda_tester.ForInput("/hot/path");
+    other_uda_tester.ForInput(absl::Substitute("/tail/b/$0", i));
+    other_uda_tester.ForInput("/hot/path");
+  }
+  auto res = uda_tester.Merge(&other_uda_tester).Result();
+
+  rapidjson::Document d;
+  d.Parse(res.data());
+  ASSERT_TRUE(d.IsArray());
+  // State stays bounded by the counter budget despite 2001 distinct values.
+  EXPECT_LE(d.Size(), 100U);
+  // The true heavy hitter surfaces on top. Its count may overestimate (never undercount more
+  // than N/k), and the reported error bounds the overestimate.
+  EXPECT_STREQ("/hot/path", d[0]["value"].GetString());
+  EXPECT_GE(d[0]["count"].GetUint64(), 2000);
+  EXPECT_LE(d[0]["count"].GetUint64() - d[0]["error"].GetUint64(), 2000);
+}
+
+TEST(MathSketches, heavy_hitters_serde_roundtrip) {
+  SpaceSaving summary;
+  for (int i = 0; i < 10; ++i) {
+    summary.Add("/api/v1/query");
+    summary.Add(absl::Substitute("/tail/$0", i));
+  }
+
+  SpaceSaving out;
+  ASSERT_OK(out.Deserialize(summary.Serialize()));
+  EXPECT_EQ(summary.size(), out.size());
+  EXPECT_EQ(summary.SortedCounters(), out.SortedCounters());
+
+  EXPECT_NOT_OK(out.Deserialize(types::StringValue("not a summary")));
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
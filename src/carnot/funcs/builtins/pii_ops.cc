@@ -334,6 +334,22 @@ Status RedactPIIUDF::Init(FunctionContext*) {
   taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::IMEISV>>());
   taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::CC_NUMBER>>());
   taggers_.push_back(std::make_unique<RegexTagger<Tag::Type::SSN>>());
+
+  // Compile all tagger patterns into a single multi-pattern scan. Exec uses it to decide which
+  // per-type passes can possibly match before running them.
+  re2::RE2::Options opts;
+  opts.set_log_errors(false);
+  auto prefilter = std::make_unique<re2::RE2::Set>(opts, re2::RE2::UNANCHORED);
+  for (const auto& tagger : taggers_) {
+    auto pattern = tagger->pattern();
+    if (prefilter->Add(re2::StringPiece(pattern.data(), pattern.size()), nullptr) < 0) {
+      // Fall back to running every tagger per payload.
+      return Status::OK();
+    }
+  }
+  if (prefilter->Compile()) {
+    prefilter_ = std::move(prefilter);
+  }
   return Status::OK();
 }
 
@@ -394,6 +410,23 @@ static inline std::string ReplaceTagsWithSubs(std::string input, std::vector<Tag
 
 StringValue RedactPIIUDF::Exec(FunctionContext*, StringValue input) {
   std::vector<Tag> tags;
+  if (prefilter_ != nullptr) {
+    std::vector<int> candidates;
+    if (!prefilter_->Match(re2::StringPiece(input.data(), input.size()), &candidates)) {
+      // Nothing PII-shaped anywhere in the payload; hand it back untouched.
+      return input;
+    }
+    // Set::Match doesn't guarantee an ordering, but tagger order matters (see Init), so sort the
+    // ids back into registration order.
+    std::sort(candidates.begin(), candidates.end());
+    for (int id : candidates) {
+      auto s = taggers_[id]->AddTags(&input, &tags);
+      if (!s.ok()) {
+        return "Invalid regex: " + s.msg();
+      }
+    }
+    return ReplaceTagsWithSubs(input, &tags);
+  }
   for (const auto& tagger : taggers_) {
     auto s = tagger->AddTags(&input, &tags);
     if (!s.ok()) {
@@ -20,9 +20,11 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "re2/re2.h"
+#include "re2/set.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/utils.h"
 #include "src/shared/types/types.h"
@@ -70,6 +72,9 @@ class Tagger {
  public:
   virtual ~Tagger() = default;
   virtual Status AddTags(std::string* input, std::vector<Tag>* tags) = 0;
+  // The regex pattern this tagger scans for, so all patterns can be compiled into one combined
+  // prefilter scan.
+  virtual std::string_view pattern() const = 0;
 };
 
 class RedactPIIUDF : public udf::ScalarUDF {
@@ -94,6 +99,11 @@ class RedactPIIUDF : public udf::ScalarUDF {
 
  private:
   std::vector<std::unique_ptr<Tagger>> taggers_;
+  // All tagger patterns compiled into a single RE2::Set. One unanchored pass over the payload
+  // tells us which taggers can possibly match, so payloads without PII-shaped substrings (the
+  // common case) cost one scan instead of one per tagger. nullptr if compilation failed, in which
+  // case Exec falls back to running every tagger.
+  std::unique_ptr<re2::RE2::Set> prefilter_;
 };
 
 void RegisterPIIOpsOrDie(udf::Registry* registry);
@@ -132,6 +142,8 @@ class RegexTagger : public Tagger {
     return Status::OK();
   }
 
+  std::string_view pattern() const override { return TagTypeTraits<TTag>::BuildRegexPattern(); }
+
  private:
   re2::RE2 regex_;
 };
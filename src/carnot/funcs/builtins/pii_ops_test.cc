@@ -267,6 +267,21 @@ INSTANTIATE_TEST_SUITE_P(TemplatedRedactionTest, RedactionTest,
                                                           EmailGen(), CCGen(), IMEIGen(), SSNGen(),
                                                           NegativeExampleGen()})));
 
+TEST(RedactionTest, no_pii_passes_through_untouched) {
+  // Exercises the combined prefilter's early-out: nothing here is shaped like any PII type.
+  auto udf_tester = udf::UDFTester<RedactPIIUDF>();
+  udf_tester.Init().ForInput("GET /healthz HTTP/1.1").Expect("GET /healthz HTTP/1.1");
+  udf_tester.Init().ForInput("").Expect("");
+}
+
+TEST(RedactionTest, prefilter_candidates_still_filtered) {
+  // Digit runs that pass the prefilter but fail the Luhn check must come back unchanged.
+  auto udf_tester = udf::UDFTester<RedactPIIUDF>();
+  udf_tester.Init()
+      .ForInput("order ids: 1111 2222 3333 4445")
+      .Expect("order ids: 1111 2222 3333 4445");
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
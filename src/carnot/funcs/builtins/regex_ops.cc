@@ -17,6 +17,9 @@
  */
 
 #include "src/carnot/funcs/builtins/regex_ops.h"
+
+#include <absl/strings/str_cat.h>
+
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/base.h"
 
@@ -24,6 +27,72 @@ namespace px {
 namespace carnot {
 namespace builtins {
 
+namespace internal {
+
+CompiledRegexCache* CompiledRegexCache::GetInstance() {
+  static CompiledRegexCache cache;
+  return &cache;
+}
+
+std::shared_ptr<const re2::RE2> CompiledRegexCache::Get(const std::string& pattern, bool dot_nl) {
+  std::string key = absl::StrCat(dot_nl ? "d:" : "p:", pattern);
+  {
+    absl::base_internal::SpinLockHolder lock(&lock_);
+    auto it = patterns_.find(key);
+    if (it != patterns_.end()) {
+      return it->second;
+    }
+  }
+
+  re2::RE2::Options opts;
+  opts.set_dot_nl(dot_nl);
+  opts.set_log_errors(false);
+  auto compiled = std::make_shared<const re2::RE2>(pattern, opts);
+
+  absl::base_internal::SpinLockHolder lock(&lock_);
+  if (patterns_.size() >= kMaxCachedPatterns) {
+    return compiled;
+  }
+  auto [it, inserted] = patterns_.emplace(std::move(key), std::move(compiled));
+  return it->second;
+}
+
+namespace {
+bool IsRegexLiteral(std::string_view s) {
+  constexpr std::string_view kMetaChars = R"(\.^$|?*+()[]{})";
+  return s.find_first_of(kMetaChars) == std::string_view::npos;
+}
+}  // namespace
+
+RegexPrefilter ExtractLiteralPrefilter(std::string_view pattern, std::string* literal) {
+  bool leading_any = false;
+  bool trailing_any = false;
+  if (absl::StartsWith(pattern, ".*")) {
+    pattern.remove_prefix(2);
+    leading_any = true;
+  }
+  if (absl::EndsWith(pattern, ".*")) {
+    pattern.remove_suffix(2);
+    trailing_any = true;
+  }
+  if (pattern.empty() || !IsRegexLiteral(pattern)) {
+    return RegexPrefilter::kNone;
+  }
+  *literal = std::string(pattern);
+  if (leading_any && trailing_any) {
+    return RegexPrefilter::kContains;
+  }
+  if (leading_any) {
+    return RegexPrefilter::kSuffix;
+  }
+  if (trailing_any) {
+    return RegexPrefilter::kPrefix;
+  }
+  return RegexPrefilter::kExact;
+}
+
+}  // namespace internal
+
 void RegisterRegexOpsOrDie(udf::Registry* registry) {
   CHECK(registry != nullptr);
   /*****************************************
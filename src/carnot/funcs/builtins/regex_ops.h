@@ -18,14 +18,19 @@
 
 #pragma once
 
+#include <arrow/array.h>
 #include <rapidjson/document.h>
 
+#include <absl/base/internal/spinlock.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/strings/match.h>
 #include <absl/strings/strip.h>
 
 #include <algorithm>
 #include <memory>
 #include <regex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include "re2/re2.h"
@@ -37,20 +42,72 @@ namespace px {
 namespace carnot {
 namespace builtins {
 
+namespace internal {
+
+/**
+ * Process-wide cache of compiled RE2 patterns.
+ *
+ * Filters re-instantiate their UDFs for every query, and dashboards fire the same handful of
+ * patterns continuously, so each pattern was recompiled per operator per query. Compiled RE2
+ * objects are immutable and thread-safe, so one copy per distinct (pattern, options) pair is
+ * shared across all queries and threads. The cache stops inserting past a fixed size instead of
+ * evicting; callers then get an uncached compile, which matches the registry-style assumption
+ * that the live pattern set is small.
+ */
+class CompiledRegexCache {
+ public:
+  static CompiledRegexCache* GetInstance();
+
+  std::shared_ptr<const re2::RE2> Get(const std::string& pattern, bool dot_nl);
+
+ private:
+  static constexpr size_t kMaxCachedPatterns = 1024;
+
+  absl::base_internal::SpinLock lock_;
+  absl::flat_hash_map<std::string, std::shared_ptr<const re2::RE2>> patterns_;
+};
+
+/**
+ * The literal fast paths a pattern can reduce to. Full-string matching of a purely literal
+ * pattern is string equality, and the common `lit.*` / `.*lit` / `.*lit.*` shapes (with dot
+ * matching newline) reduce to prefix / suffix / substring checks that skip RE2 entirely.
+ */
+enum class RegexPrefilter { kNone, kExact, kPrefix, kSuffix, kContains };
+
+RegexPrefilter ExtractLiteralPrefilter(std::string_view pattern, std::string* literal);
+
+}  // namespace internal
+
 class RegexMatchUDF : public udf::ScalarUDF {
  public:
   Status Init(FunctionContext*, StringValue regex) {
-    re2::RE2::Options opts;
-    opts.set_dot_nl(true);
-    opts.set_log_errors(false);
-    regex_ = std::make_unique<re2::RE2>(regex, opts);
+    regex_ = internal::CompiledRegexCache::GetInstance()->Get(regex, /* dot_nl */ true);
+    prefilter_ = internal::ExtractLiteralPrefilter(regex, &literal_);
     return Status::OK();
   }
   BoolValue Exec(FunctionContext*, StringValue input) {
     if (regex_->error_code() != RE2::NoError) {
       return false;
     }
-    return RE2::FullMatch(input, *regex_);
+    return Matches(input);
+  }
+
+  Status ExecBatchArrow(FunctionContext*, const std::vector<arrow::Array*>& inputs,
+                        arrow::ArrayBuilder* output, int count) {
+    auto* input = static_cast<arrow::StringArray*>(inputs[0]);
+    auto* builder = static_cast<arrow::BooleanBuilder*>(output);
+    PL_RETURN_IF_ERROR(builder->Reserve(count));
+    if (regex_->error_code() != RE2::NoError) {
+      for (int i = 0; i < count; ++i) {
+        builder->UnsafeAppend(false);
+      }
+      return Status::OK();
+    }
+    for (int i = 0; i < count; ++i) {
+      auto view = input->GetView(i);
+      builder->UnsafeAppend(Matches(std::string_view(view.data(), view.size())));
+    }
+    return Status::OK();
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -69,15 +126,31 @@ class RegexMatchUDF : public udf::ScalarUDF {
   }
 
  private:
-  std::unique_ptr<re2::RE2> regex_;
+  bool Matches(std::string_view input) const {
+    switch (prefilter_) {
+      case internal::RegexPrefilter::kExact:
+        return input == literal_;
+      case internal::RegexPrefilter::kPrefix:
+        return absl::StartsWith(input, literal_);
+      case internal::RegexPrefilter::kSuffix:
+        return absl::EndsWith(input, literal_);
+      case internal::RegexPrefilter::kContains:
+        return input.find(literal_) != std::string_view::npos;
+      case internal::RegexPrefilter::kNone:
+        break;
+    }
+    return RE2::FullMatch(re2::StringPiece(input.data(), input.size()), *regex_);
+  }
+
+  std::shared_ptr<const re2::RE2> regex_;
+  internal::RegexPrefilter prefilter_ = internal::RegexPrefilter::kNone;
+  std::string literal_;
 };
 
 class RegexReplaceUDF : public udf::ScalarUDF {
  public:
   Status Init(FunctionContext*, StringValue regex_pattern) {
-    re2::RE2::Options opts;
-    opts.set_log_errors(false);
-    regex_ = std::make_unique<re2::RE2>(regex_pattern, opts);
+    regex_ = internal::CompiledRegexCache::GetInstance()->Get(regex_pattern, /* dot_nl */ false);
     return Status::OK();
   }
   StringValue Exec(FunctionContext*, StringValue input, StringValue sub) {
@@ -114,7 +187,7 @@ class RegexReplaceUDF : public udf::ScalarUDF {
   }
 
  private:
-  std::unique_ptr<re2::RE2> regex_;
+  std::shared_ptr<const re2::RE2> regex_;
 };
 
 class MatchRegexRule : public udf::ScalarUDF {
@@ -52,6 +52,54 @@ TEST(RegexOps, invalid_regex_match) {
   udf_tester.Init(R"regex(\K)regex").ForInput(kMultiLine).Expect(false);
 }
 
+TEST(RegexOps, regex_match_literal_fast_paths) {
+  // Each of these shapes reduces to a literal check; the results must match full RE2 semantics.
+  auto udf_tester = udf::UDFTester<RegexMatchUDF>();
+  udf_tester.Init("abcd").ForInput("abcd").Expect(true);
+  udf_tester.Init("abcd").ForInput("abcde").Expect(false);
+  udf_tester.Init("abcd.*").ForInput("abcde").Expect(true);
+  udf_tester.Init("abcd.*").ForInput("zabcd").Expect(false);
+  udf_tester.Init(".*abcd").ForInput("zabcd").Expect(true);
+  udf_tester.Init(".*abcd").ForInput("abcde").Expect(false);
+  udf_tester.Init(".*abcd.*").ForInput("zabcde").Expect(true);
+  udf_tester.Init(".*abcd.*").ForInput("ab\ncd").Expect(false);
+  // Multi-line inputs still match through the contains path, mirroring dot_nl.
+  udf_tester.Init(".*1234.*").ForInput(kMultiLine).Expect(true);
+}
+
+TEST(RegexOps, regex_match_literal_fast_path_not_taken_for_meta) {
+  // Escapes next to the `.*` anchors must not be misread as literals.
+  auto udf_tester = udf::UDFTester<RegexMatchUDF>();
+  udf_tester.Init(R"regex(ab\.*)regex").ForInput("ab...").Expect(true);
+  udf_tester.Init(R"regex(ab\.*)regex").ForInput("abc").Expect(false);
+}
+
+TEST(RegexOps, compiled_pattern_cache_shares_instances) {
+  auto first = internal::CompiledRegexCache::GetInstance()->Get("cache-test-.*", true);
+  auto second = internal::CompiledRegexCache::GetInstance()->Get("cache-test-.*", true);
+  EXPECT_EQ(first.get(), second.get());
+  // Different options compile separately.
+  auto other_opts = internal::CompiledRegexCache::GetInstance()->Get("cache-test-.*", false);
+  EXPECT_NE(first.get(), other_opts.get());
+}
+
+TEST(RegexOps, regex_match_batch_arrow) {
+  auto inputs = std::vector<types::StringValue>({"/api/v1/foo", "/healthz", "/api/v2/bar"});
+  auto arr = types::ToArrow(inputs, arrow::default_memory_pool());
+
+  RegexMatchUDF udf;
+  EXPECT_OK(udf.Init(nullptr, "/api/.*"));
+  arrow::BooleanBuilder builder;
+  EXPECT_OK(udf.ExecBatchArrow(nullptr, {arr.get()}, &builder, 3));
+
+  std::shared_ptr<arrow::Array> res;
+  EXPECT_TRUE(builder.Finish(&res).ok());
+  auto* res_arr = static_cast<arrow::BooleanArray*>(res.get());
+  EXPECT_TRUE(res_arr->Value(0));
+  EXPECT_FALSE(res_arr->Value(1));
+  EXPECT_TRUE(res_arr->Value(2));
+}
+
 TEST(RegexOps, basic_regex_replace) {
   auto udf_tester = udf::UDFTester<RegexReplaceUDF>();
   udf_tester.Init("abc").ForInput("1abc 2abcd\t\n3abcd", "__").Expect("1__ 2__d\t\n3__d");
@@ -18,6 +18,7 @@
 
 
 #include "src/carnot/funcs/builtins/request_path_ops.h"
+#include <algorithm>
 #include <string_view>
 #include <vector>
 #include "src/carnot/udf/registry.h"
@@ -38,6 +39,7 @@ void RegisterRequestPathOpsOrDie(udf::Registry* registry) {
    * Aggregate UDFs.
    *****************************************/
   registry->RegisterOrDie<RequestPathClusteringFitUDA>("_build_request_path_clusters");
+  registry->RegisterOrDie<IncrementalRequestPathClusteringFitUDA>("_update_request_path_clusters");
 }
 
 RequestPath::RequestPath(std::string request_path) {
@@ -234,14 +236,41 @@ void RequestPathClustering::AddNewCluster(const RequestPathCluster& cluster) {
     depth_to_centroid_indices_.emplace(centroid.depth(), std::vector<int64_t>());
   }
   depth_to_centroid_indices_[centroid.depth()].push_back(clusters_.size());
+  dirty_cluster_indices_.insert(static_cast<int64_t>(clusters_.size()));
   clusters_.push_back(cluster);
 }
 
 void RequestPathClustering::MergeCluster(int64_t cluster_index,
                                          const RequestPathCluster& other_cluster) {
+  dirty_cluster_indices_.insert(cluster_index);
   clusters_[cluster_index].Merge(other_cluster);
 }
 
+void RequestPathClustering::MarkClean() { dirty_cluster_indices_.clear(); }
+
+std::string RequestPathClustering::ToDeltaJSON() const {
+  rapidjson::StringBuffer sb;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(sb);
+  writer.StartArray();
+  for (const auto& [cluster_idx, cluster] : Enumerate(clusters_)) {
+    if (dirty_cluster_indices_.contains(static_cast<int64_t>(cluster_idx))) {
+      cluster.ToJSON(&writer);
+    }
+  }
+  writer.EndArray();
+  return sb.GetString();
+}
+
+void RequestPathClustering::MergeDelta(const RequestPathClustering& other_clustering) {
+  std::vector<int64_t> sorted_indices(other_clustering.dirty_cluster_indices_.begin(),
+                                      other_clustering.dirty_cluster_indices_.end());
+  // Apply deltas in cluster order so the result doesn't depend on hash iteration order.
+  std::sort(sorted_indices.begin(), sorted_indices.end());
+  for (int64_t idx : sorted_indices) {
+    Update(other_clustering.clusters_[idx]);
+  }
+}
+
 StatusOr<RequestPathClustering> RequestPathClustering::FromJSON(const std::string& json) {
   rapidjson::Document d;
   rapidjson::ParseResult ok = d.Parse(json.data());
@@ -331,6 +360,13 @@ void RequestPathClustering::Merge(const RequestPathClustering& other_clustering)
   for (const auto& cluster : singleton_clusters) {
     Update(cluster);
   }
+
+  // The rebuild above reassigns cluster indices, so the delta tracking can't be preserved;
+  // conservatively treat every cluster as modified.
+  dirty_cluster_indices_.clear();
+  for (size_t i = 0; i < clusters_.size(); ++i) {
+    dirty_cluster_indices_.insert(static_cast<int64_t>(i));
+  }
 }
 
 }  // namespace builtins
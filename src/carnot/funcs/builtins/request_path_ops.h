@@ -195,6 +195,25 @@ class RequestPathClustering {
 
   void Merge(const RequestPathClustering& other_clustering);
 
+  /**
+   * Marks the current clusters as the persisted base model. Clusters added or modified after
+   * this call are tracked as the delta, for ToDeltaJSON and MergeDelta.
+   */
+  void MarkClean();
+
+  /**
+   * Serializes only the delta clusters (added or modified since the last MarkClean), in the same
+   * array format as ToJSON, so a delta parses back with FromJSON.
+   */
+  std::string ToDeltaJSON() const;
+
+  /**
+   * Updates this clustering with the delta clusters of the other clustering. Assumes both sides
+   * were initialized from the same base model, so the unmodified base clusters don't need to be
+   * re-merged.
+   */
+  void MergeDelta(const RequestPathClustering& other_clustering);
+
   const std::vector<RequestPathCluster>& clusters() const { return clusters_; }
 
  private:
@@ -204,6 +223,8 @@ class RequestPathClustering {
   // We currently only allow request path's with the same depth to be clustered together.
   absl::flat_hash_map<int64_t, std::vector<int64_t>> depth_to_centroid_indices_;
   std::vector<RequestPathCluster> clusters_;
+  // Indices of clusters added or modified since the last MarkClean.
+  absl::flat_hash_set<int64_t> dirty_cluster_indices_;
   double thresh_ = 0.5;
 };
 
@@ -249,6 +270,44 @@ class RequestPathClusteringFitUDA : public udf::UDA {
   RequestPathClustering clustering_;
 };
 
+/**
+ * Incremental variant of RequestPathClusteringFitUDA: the previous window's model is passed in
+ * as an init arg, new paths update it online, and only the clusters touched in this window cross
+ * the network when partial aggregates merge, since every node starts from the same base model.
+ * Finalize still emits the full updated model so the script can feed it back into the next
+ * window.
+ */
+class IncrementalRequestPathClusteringFitUDA : public udf::UDA {
+ public:
+  Status Init(FunctionContext*, StringValue serialized_base_model) {
+    if (!serialized_base_model.empty()) {
+      PL_ASSIGN_OR_RETURN(clustering_, RequestPathClustering::FromJSON(serialized_base_model));
+    }
+    clustering_.MarkClean();
+    return Status::OK();
+  }
+  void Update(FunctionContext*, StringValue request_path_str) {
+    auto request_path = RequestPath(request_path_str);
+    clustering_.Update(RequestPathCluster(request_path));
+  }
+  void Merge(FunctionContext*, const IncrementalRequestPathClusteringFitUDA& other) {
+    clustering_.MergeDelta(other.clustering_);
+  }
+  StringValue Finalize(FunctionContext*) { return clustering_.ToJSON(); }
+
+  StringValue Serialize(FunctionContext*) { return clustering_.ToDeltaJSON(); }
+
+  Status Deserialize(FunctionContext*, const StringValue& data) {
+    // The incoming state is a delta relative to the shared base model; the loaded clusters stay
+    // marked dirty so they forward through Merge and a later Serialize.
+    PL_ASSIGN_OR_RETURN(clustering_, RequestPathClustering::FromJSON(data));
+    return Status::OK();
+  }
+
+ private:
+  RequestPathClustering clustering_;
+};
+
 class RequestPathEndpointMatcherUDF : public udf::ScalarUDF {
  public:
   BoolValue Exec(FunctionContext*, StringValue request_path, StringValue endpoint) {
@@ -192,6 +192,57 @@ TEST(RequestPathClusteringFit, merging_clusters_complicated) {
   } while (std::next_permutation(permutation_indices.begin(), permutation_indices.end()));
 }
 
+TEST(RequestPathClusteringDelta, delta_tracks_modified_clusters_only) {
+  // Build a base model with a fully formed /a/b/* cluster.
+  auto base_tester = udf::UDATester<RequestPathClusteringFitUDA>();
+  auto base_json = base_tester.ForInput("/a/b/a")
+                       .ForInput("/a/b/b")
+                       .ForInput("/a/b/c")
+                       .ForInput("/a/b/d")
+                       .ForInput("/a/b/e")
+                       .ForInput("/a/b/f")
+                       .Result();
+
+  auto clustering = RequestPathClustering::FromJSON(base_json).ConsumeValueOrDie();
+  clustering.MarkClean();
+  EXPECT_EQ("[]", clustering.ToDeltaJSON());
+
+  // A path from a new endpoint dirties only its own cluster.
+  clustering.Update(RequestPathCluster(RequestPath("/c/d")));
+  auto delta = RequestPathClustering::FromJSON(clustering.ToDeltaJSON()).ConsumeValueOrDie();
+  EXPECT_THAT(delta, HasCentroids(std::vector<std::string>{"/c/d"}));
+  EXPECT_THAT(clustering, HasCentroids(std::vector<std::string>{"/a/b/*", "/c/d"}));
+}
+
+TEST(IncrementalRequestPathClusteringFit, merge_of_deltas_matches_direct_updates) {
+  auto base_tester = udf::UDATester<RequestPathClusteringFitUDA>();
+  auto base_json = base_tester.ForInput("/a/b/a")
+                       .ForInput("/a/b/b")
+                       .ForInput("/a/b/c")
+                       .ForInput("/a/b/d")
+                       .ForInput("/a/b/e")
+                       .ForInput("/a/b/f")
+                       .Result();
+
+  // One node sees new paths on top of the shared base model and ships only its delta.
+  IncrementalRequestPathClusteringFitUDA sender;
+  ASSERT_OK(sender.Init(nullptr, base_json));
+  sender.Update(nullptr, "/a/b/g");
+  sender.Update(nullptr, "/x/y");
+
+  IncrementalRequestPathClusteringFitUDA delta;
+  ASSERT_OK(delta.Deserialize(nullptr, sender.Serialize(nullptr)));
+
+  IncrementalRequestPathClusteringFitUDA receiver;
+  ASSERT_OK(receiver.Init(nullptr, base_json));
+  receiver.Merge(nullptr, delta);
+
+  // The merged model must match a node that applied the same updates directly.
+  auto clustering =
+      RequestPathClustering::FromJSON(receiver.Finalize(nullptr)).ConsumeValueOrDie();
+  EXPECT_THAT(clustering, HasCentroids(std::vector<std::string>{"/a/b/*", "/x/y"}));
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
@@ -15,8 +15,12 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <string>
+#include <utility>
 #include <vector>
 
+#include <absl/strings/str_cat.h>
+
 #include "src/carnot/funcs/builtins/sql_ops.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/base.h"
@@ -42,6 +46,40 @@ namespace px {
 namespace carnot {
 namespace builtins {
 
+namespace internal {
+
+NormalizedSqlCache* NormalizedSqlCache::GetThreadInstance() {
+  static thread_local NormalizedSqlCache cache;
+  return &cache;
+}
+
+const std::string* NormalizedSqlCache::Lookup(const std::string& key) {
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    return nullptr;
+  }
+  lru_.splice(lru_.begin(), lru_, it->second);
+  return &it->second->second;
+}
+
+void NormalizedSqlCache::Insert(const std::string& key, std::string result_json) {
+  if (key.size() > kMaxCachedQuerySize) {
+    return;
+  }
+  lru_.emplace_front(key, std::move(result_json));
+  index_[lru_.front().first] = lru_.begin();
+  bytes_ += key.size();
+
+  while (bytes_ > kMaxCacheBytes && lru_.size() > 1) {
+    const auto& victim = lru_.back();
+    bytes_ -= victim.first.size();
+    index_.erase(victim.first);
+    lru_.pop_back();
+  }
+}
+
+}  // namespace internal
+
 void RegisterSQLOpsOrDie(udf::Registry* registry) {
   CHECK(registry != nullptr);
   /*****************************************
@@ -54,8 +92,9 @@ void RegisterSQLOpsOrDie(udf::Registry* registry) {
    *****************************************/
 }
 
-types::StringValue NormalizePostgresSQLUDF::Exec(FunctionContext*, StringValue sql_str,
-                                                 StringValue cmd_code) {
+namespace {
+
+std::string NormalizePostgresImpl(const std::string& sql_str, const std::string& cmd_code) {
   std::string query;
   std::vector<std::string> param_values;
 
@@ -84,8 +123,7 @@ types::StringValue NormalizePostgresSQLUDF::Exec(FunctionContext*, StringValue s
   return result_or_s.ConsumeValueOrDie().ToJSON();
 }
 
-types::StringValue NormalizeMySQLUDF::Exec(FunctionContext*, StringValue sql_str,
-                                           Int64Value cmd_code) {
+std::string NormalizeMySQLImpl(const std::string& sql_str, int64_t cmd_code) {
   std::string query;
   std::vector<std::string> param_values;
 
@@ -114,6 +152,33 @@ types::StringValue NormalizeMySQLUDF::Exec(FunctionContext*, StringValue sql_str
   return result_or_s.ConsumeValueOrDie().ToJSON();
 }
 
+}  // namespace
+
+types::StringValue NormalizePostgresSQLUDF::Exec(FunctionContext*, StringValue sql_str,
+                                                 StringValue cmd_code) {
+  auto* cache = internal::NormalizedSqlCache::GetThreadInstance();
+  // \x1f (unit separator) cannot appear between the fields by accident.
+  std::string cache_key = absl::StrCat("pg\x1f", cmd_code, "\x1f", sql_str);
+  if (const std::string* cached = cache->Lookup(cache_key)) {
+    return *cached;
+  }
+  std::string result_json = NormalizePostgresImpl(sql_str, cmd_code);
+  cache->Insert(cache_key, result_json);
+  return result_json;
+}
+
+types::StringValue NormalizeMySQLUDF::Exec(FunctionContext*, StringValue sql_str,
+                                           Int64Value cmd_code) {
+  auto* cache = internal::NormalizedSqlCache::GetThreadInstance();
+  std::string cache_key = absl::StrCat("my\x1f", cmd_code.val, "\x1f", sql_str);
+  if (const std::string* cached = cache->Lookup(cache_key)) {
+    return *cached;
+  }
+  std::string result_json = NormalizeMySQLImpl(sql_str, cmd_code.val);
+  cache->Insert(cache_key, result_json);
+  return result_json;
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
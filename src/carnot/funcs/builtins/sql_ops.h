@@ -18,9 +18,13 @@
 
 #pragma once
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/strings/strip.h>
+#include <list>
 #include <regex>
 #include <string>
+#include <string_view>
+#include <utility>
 #include "src/carnot/funcs/builtins/sql_parsing/normalization.h"
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/status.h"
@@ -31,6 +35,48 @@ namespace px {
 namespace carnot {
 namespace builtins {
 
+namespace internal {
+
+/**
+ * Thread-local cache of normalized SQL results.
+ *
+ * Production workloads repeat a few hundred distinct statements millions of times, and running
+ * every row through the ANTLR parser makes normalization parser-bound. Entries are keyed by the
+ * raw UDF input (dialect, command code and query string), so repeated statements cost one hash
+ * lookup instead of a parse. Execute-style rows embed their parameter values in the raw string,
+ * so they hit only when the values repeat too. The cache is bounded by total key bytes with LRU
+ * eviction, oversized queries bypass it, and error results are cached like any other so a bad
+ * statement only pays for parsing once. Follows the same design as ParsedDocCache in json_ops.
+ */
+class NormalizedSqlCache {
+ public:
+  static NormalizedSqlCache* GetThreadInstance();
+
+  /**
+   * Returns the cached result JSON for the key, or nullptr on a miss. The returned pointer is
+   * only valid until the next Insert call on this thread.
+   */
+  const std::string* Lookup(const std::string& key);
+
+  /**
+   * Caches the result JSON for the key. Keys larger than the per-entry bound are dropped.
+   */
+  void Insert(const std::string& key, std::string result_json);
+
+ private:
+  static constexpr size_t kMaxCachedQuerySize = 64 * 1024;
+  static constexpr size_t kMaxCacheBytes = 8 * 1024 * 1024;
+
+  // Most recently used entries at the front. The index holds views into the list's keys, which
+  // are stable across splices and insertions.
+  std::list<std::pair<std::string, std::string>> lru_;
+  absl::flat_hash_map<std::string_view, std::list<std::pair<std::string, std::string>>::iterator>
+      index_;
+  size_t bytes_ = 0;
+};
+
+}  // namespace internal
+
 static constexpr char kPgExecCmdCode[] = "Execute";
 static constexpr char kPgQueryCmdCode[] = "Query";
 static constexpr int64_t kMySQLQueryCmdCode = 0x03;
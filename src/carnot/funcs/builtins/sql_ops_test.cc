@@ -199,6 +199,29 @@ TEST(NormMySQL, invalid_utf8) {
   udf_tester.ForInput(invalid, kMySQLQueryCmdCode).Expect(expected_result.ToJSON());
 }
 
+TEST(NormalizedSqlCache, lookup_after_insert) {
+  auto* cache = internal::NormalizedSqlCache::GetThreadInstance();
+  EXPECT_EQ(nullptr, cache->Lookup("test\x1fkey"));
+  cache->Insert("test\x1fkey", "{\"query\":\"SELECT $1\"}");
+  auto* cached = cache->Lookup("test\x1fkey");
+  ASSERT_NE(nullptr, cached);
+  EXPECT_EQ("{\"query\":\"SELECT $1\"}", *cached);
+}
+
+// Repeated inputs must keep producing the same output through the cached path, including
+// interleaved statements and cached error results.
+TEST(NormalizedSqlCache, repeated_rows_are_stable) {
+  auto udf_tester = udf::UDFTester<NormalizePostgresSQLUDF>();
+  auto expected_select = NormalizeResult{"SELECT $1", {"1"}}.ToJSON();
+  auto expected_err = NormalizeResult{
+      "", {}, "Invalid UTF-8 byte sequence in SQL query"}.ToJSON();
+
+  for (int i = 0; i < 3; ++i) {
+    udf_tester.ForInput("SELECT 1", kPgQueryCmdCode).Expect(expected_select);
+    udf_tester.ForInput("\xbf\xef\xef\xbd", kPgQueryCmdCode).Expect(expected_err);
+  }
+}
+
 }  // namespace builtins
 }  // namespace carnot
 }  // namespace px
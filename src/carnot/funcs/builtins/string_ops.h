@@ -18,9 +18,13 @@
 
 #pragma once
 
+#include <arrow/array.h>
+
 #include <absl/strings/strip.h>
 #include <algorithm>
 #include <string>
+#include <string_view>
+#include <vector>
 #include "src/carnot/udf/registry.h"
 #include "src/common/base/utils.h"
 #include "src/shared/types/types.h"
@@ -35,6 +39,22 @@ class ContainsUDF : public udf::ScalarUDF {
     return absl::StrContains(b1, b2);
   }
 
+  Status ExecBatchArrow(FunctionContext*, const std::vector<arrow::Array*>& inputs,
+                        arrow::ArrayBuilder* output, int count) {
+    auto* str_arr = static_cast<arrow::StringArray*>(inputs[0]);
+    auto* substr_arr = static_cast<arrow::StringArray*>(inputs[1]);
+    auto* builder = static_cast<arrow::BooleanBuilder*>(output);
+    PL_RETURN_IF_ERROR(builder->Reserve(count));
+    for (int i = 0; i < count; ++i) {
+      auto haystack = str_arr->GetView(i);
+      auto needle = substr_arr->GetView(i);
+      builder->UnsafeAppend(std::string_view(haystack.data(), haystack.size())
+                                .find(std::string_view(needle.data(), needle.size())) !=
+                            std::string_view::npos);
+    }
+    return Status::OK();
+  }
+
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Returns whether the first string contains the second string.")
         .Example("matching_df = matching_df[px.contains(matching_df.svc_names, 'my_svc')]")
@@ -47,6 +67,19 @@ class ContainsUDF : public udf::ScalarUDF {
 class LengthUDF : public udf::ScalarUDF {
  public:
   Int64Value Exec(FunctionContext*, StringValue b1) { return b1.length(); }
+
+  Status ExecBatchArrow(FunctionContext*, const std::vector<arrow::Array*>& inputs,
+                        arrow::ArrayBuilder* output, int count) {
+    // Lengths come straight from the offsets buffer; the string data is never touched.
+    auto* input = static_cast<arrow::StringArray*>(inputs[0]);
+    auto* builder = static_cast<arrow::Int64Builder*>(output);
+    PL_RETURN_IF_ERROR(builder->Reserve(count));
+    for (int i = 0; i < count; ++i) {
+      builder->UnsafeAppend(input->value_length(i));
+    }
+    return Status::OK();
+  }
+
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Returns the length of the string")
         .Example(R"doc(df.service = 'checkout'
@@ -63,6 +96,23 @@ class FindUDF : public udf::ScalarUDF {
     return src.find(substr);
   }
 
+  Status ExecBatchArrow(FunctionContext*, const std::vector<arrow::Array*>& inputs,
+                        arrow::ArrayBuilder* output, int count) {
+    auto* src_arr = static_cast<arrow::StringArray*>(inputs[0]);
+    auto* substr_arr = static_cast<arrow::StringArray*>(inputs[1]);
+    auto* builder = static_cast<arrow::Int64Builder*>(output);
+    PL_RETURN_IF_ERROR(builder->Reserve(count));
+    for (int i = 0; i < count; ++i) {
+      auto src = src_arr->GetView(i);
+      auto substr = substr_arr->GetView(i);
+      auto pos = std::string_view(src.data(), src.size())
+                     .find(std::string_view(substr.data(), substr.size()));
+      // npos casts to -1, matching the scalar path.
+      builder->UnsafeAppend(static_cast<int64_t>(pos));
+    }
+    return Status::OK();
+  }
+
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder("Find the index of the first occurrence of the substring.")
         .Details(
@@ -108,6 +158,24 @@ class ToLowerUDF : public udf::ScalarUDF {
     transform(b1.begin(), b1.end(), b1.begin(), ::tolower);
     return b1;
   }
+
+  Status ExecBatchArrow(FunctionContext*, const std::vector<arrow::Array*>& inputs,
+                        arrow::ArrayBuilder* output, int count) {
+    auto* input = static_cast<arrow::StringArray*>(inputs[0]);
+    auto* builder = static_cast<arrow::StringBuilder*>(output);
+    PL_RETURN_IF_ERROR(builder->Reserve(count));
+    // Case folding preserves lengths, so the output data buffer can be sized up front.
+    PL_RETURN_IF_ERROR(builder->ReserveData(input->value_offset(count) - input->value_offset(0)));
+    std::string scratch;
+    for (int i = 0; i < count; ++i) {
+      auto view = input->GetView(i);
+      scratch.assign(view.data(), view.size());
+      std::transform(scratch.begin(), scratch.end(), scratch.begin(), ::tolower);
+      builder->UnsafeAppend(scratch);
+    }
+    return Status::OK();
+  }
+
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder(
                "Transforms all uppercase ascii characters in the string to lowercase.")
@@ -125,6 +193,23 @@ class ToUpperUDF : public udf::ScalarUDF {
     transform(b1.begin(), b1.end(), b1.begin(), ::toupper);
     return b1;
   }
+
+  Status ExecBatchArrow(FunctionContext*, const std::vector<arrow::Array*>& inputs,
+                        arrow::ArrayBuilder* output, int count) {
+    auto* input = static_cast<arrow::StringArray*>(inputs[0]);
+    auto* builder = static_cast<arrow::StringBuilder*>(output);
+    PL_RETURN_IF_ERROR(builder->Reserve(count));
+    PL_RETURN_IF_ERROR(builder->ReserveData(input->value_offset(count) - input->value_offset(0)));
+    std::string scratch;
+    for (int i = 0; i < count; ++i) {
+      auto view = input->GetView(i);
+      scratch.assign(view.data(), view.size());
+      std::transform(scratch.begin(), scratch.end(), scratch.begin(), ::toupper);
+      builder->UnsafeAppend(scratch);
+    }
+    return Status::OK();
+  }
+
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder(
                "Transforms all lowercase ascii characters in the string to uppercase.")
@@ -24,6 +24,7 @@
 #include "src/carnot/funcs/builtins/string_ops.h"
 #include "src/carnot/udf/test_utils.h"
 #include "src/common/base/base.h"
+#include "src/common/testing/testing.h"
 
 namespace px {
 namespace carnot {
@@ -35,6 +36,51 @@ TEST(StringOps, basic_string_contains_test) {
   udf_tester.ForInput("apple", "z").Expect(false);
 }
 
+TEST(StringOps, batch_arrow_string_kernels) {
+  auto strs = std::vector<types::StringValue>({"/api/v1/Foo", "/healthz", "API"});
+  auto needles = std::vector<types::StringValue>({"api", "api", "API"});
+  auto str_arr = types::ToArrow(strs, arrow::default_memory_pool());
+  auto needle_arr = types::ToArrow(needles, arrow::default_memory_pool());
+
+  ContainsUDF contains;
+  arrow::BooleanBuilder bool_builder;
+  EXPECT_OK(contains.ExecBatchArrow(nullptr, {str_arr.get(), needle_arr.get()}, &bool_builder, 3));
+  std::shared_ptr<arrow::Array> contains_res;
+  EXPECT_TRUE(bool_builder.Finish(&contains_res).ok());
+  auto* contains_arr = static_cast<arrow::BooleanArray*>(contains_res.get());
+  EXPECT_TRUE(contains_arr->Value(0));
+  EXPECT_FALSE(contains_arr->Value(1));
+  EXPECT_TRUE(contains_arr->Value(2));
+
+  ToLowerUDF tolower;
+  arrow::StringBuilder str_builder;
+  EXPECT_OK(tolower.ExecBatchArrow(nullptr, {str_arr.get()}, &str_builder, 3));
+  std::shared_ptr<arrow::Array> lower_res;
+  EXPECT_TRUE(str_builder.Finish(&lower_res).ok());
+  auto* lower_arr = static_cast<arrow::StringArray*>(lower_res.get());
+  EXPECT_EQ("/api/v1/foo", lower_arr->GetString(0));
+  EXPECT_EQ("api", lower_arr->GetString(2));
+
+  LengthUDF length;
+  arrow::Int64Builder int_builder;
+  EXPECT_OK(length.ExecBatchArrow(nullptr, {str_arr.get()}, &int_builder, 3));
+  std::shared_ptr<arrow::Array> length_res;
+  EXPECT_TRUE(int_builder.Finish(&length_res).ok());
+  auto* length_arr = static_cast<arrow::Int64Array*>(length_res.get());
+  EXPECT_EQ(11, length_arr->Value(0));
+  EXPECT_EQ(8, length_arr->Value(1));
+
+  FindUDF find;
+  arrow::Int64Builder find_builder;
+  EXPECT_OK(find.ExecBatchArrow(nullptr, {str_arr.get(), needle_arr.get()}, &find_builder, 3));
+  std::shared_ptr<arrow::Array> find_res;
+  EXPECT_TRUE(find_builder.Finish(&find_res).ok());
+  auto* find_arr = static_cast<arrow::Int64Array*>(find_res.get());
+  EXPECT_EQ(1, find_arr->Value(0));
+  EXPECT_EQ(-1, find_arr->Value(1));
+  EXPECT_EQ(0, find_arr->Value(2));
+}
+
 TEST(StringOps, basic_string_length_test) {
   auto udf_tester = udf::UDFTester<LengthUDF>();
   udf_tester.ForInput("").Expect(0);
@@ -20,6 +20,8 @@
 
 #include <sys/sysinfo.h>
 
+#include <arrow/array.h>
+
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -54,6 +56,36 @@ inline StatusOr<K8sNameIdentView> K8sName(std::string_view name) {
   return std::make_pair(name_parts[0], name_parts[1]);
 }
 
+/**
+ * Memoizes per-UPID resolution results within a UDF instance. Record batches commonly contain
+ * long runs of rows from the same process, so resolving each distinct UPID once and replaying
+ * the result avoids the chain of hash lookups per row. Entries are stamped with the metadata
+ * state generation they were resolved against and discarded when the state changes.
+ */
+template <typename TValue>
+class UPIDResolutionCache {
+ public:
+  template <typename TResolveFn>
+  const TValue& Resolve(const px::md::AgentMetadataState* md, const types::UInt128Value& upid,
+                        TResolveFn resolve_fn) {
+    if (md != md_ || md->sequence_number() != sequence_number_) {
+      cache_.clear();
+      md_ = md;
+      sequence_number_ = md->sequence_number();
+    }
+    auto [it, inserted] = cache_.try_emplace(absl::MakeUint128(upid.High64(), upid.Low64()));
+    if (inserted) {
+      it->second = resolve_fn();
+    }
+    return it->second;
+  }
+
+ private:
+  const px::md::AgentMetadataState* md_ = nullptr;
+  uint64_t sequence_number_ = 0;
+  absl::flat_hash_map<absl::uint128, TValue> cache_;
+};
+
 }  // namespace internal
 
 inline const px::md::AgentMetadataState* GetMetadataState(px::carnot::udf::FunctionContext* ctx) {
@@ -105,7 +137,7 @@ class PodIDToPodNameUDF : public ScalarUDF {
 
     const auto* pod_info = md->k8s_metadata_state().PodInfoByID(pod_id);
     if (pod_info != nullptr) {
-      return absl::Substitute("$0/$1", pod_info->ns(), pod_info->name());
+      return pod_info->ns_and_name();
     }
 
     return "";
@@ -237,14 +269,15 @@ class UPIDToContainerIDUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-
-    auto upid_uint128 = absl::MakeUint128(upid_value.High64(), upid_value.Low64());
-    auto upid = md::UPID(upid_uint128);
-    auto pid = md->GetPIDByUPID(upid);
-    if (pid == nullptr) {
-      return "";
-    }
-    return pid->cid();
+    return cache_.Resolve(md, upid_value, [&]() -> StringValue {
+      auto upid_uint128 = absl::MakeUint128(upid_value.High64(), upid_value.Low64());
+      auto upid = md::UPID(upid_uint128);
+      auto pid = md->GetPIDByUPID(upid);
+      if (pid == nullptr) {
+        return "";
+      }
+      return pid->cid();
+    });
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -261,6 +294,9 @@ class UPIDToContainerIDUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  internal::UPIDResolutionCache<StringValue> cache_;
 };
 
 inline const md::ContainerInfo* UPIDToContainer(const px::md::AgentMetadataState* md,
@@ -278,11 +314,13 @@ class UPIDToContainerNameUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-    auto container_info = UPIDToContainer(md, upid_value);
-    if (container_info == nullptr) {
-      return "";
-    }
-    return std::string(container_info->name());
+    return cache_.Resolve(md, upid_value, [&]() -> StringValue {
+      auto container_info = UPIDToContainer(md, upid_value);
+      if (container_info == nullptr) {
+        return "";
+      }
+      return std::string(container_info->name());
+    });
   }
 
   static udf::InfRuleVec SemanticInferenceRules() {
@@ -304,6 +342,9 @@ class UPIDToContainerNameUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  internal::UPIDResolutionCache<StringValue> cache_;
 };
 
 inline const px::md::PodInfo* UPIDtoPod(const px::md::AgentMetadataState* md,
@@ -343,11 +384,13 @@ class UPIDToNamespaceUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-    auto pod_info = UPIDtoPod(md, upid_value);
-    if (pod_info == nullptr) {
-      return "";
-    }
-    return pod_info->ns();
+    return cache_.Resolve(md, upid_value, [&]() -> StringValue {
+      auto pod_info = UPIDtoPod(md, upid_value);
+      if (pod_info == nullptr) {
+        return "";
+      }
+      return pod_info->ns();
+    });
   }
 
   static udf::InfRuleVec SemanticInferenceRules() {
@@ -369,17 +412,22 @@ class UPIDToNamespaceUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  internal::UPIDResolutionCache<StringValue> cache_;
 };
 
 class UPIDToPodIDUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-    auto container_info = UPIDToContainer(md, upid_value);
-    if (container_info == nullptr) {
-      return "";
-    }
-    return std::string(container_info->pod_id());
+    return cache_.Resolve(md, upid_value, [&]() -> StringValue {
+      auto container_info = UPIDToContainer(md, upid_value);
+      if (container_info == nullptr) {
+        return "";
+      }
+      return std::string(container_info->pod_id());
+    });
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -396,17 +444,37 @@ class UPIDToPodIDUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  internal::UPIDResolutionCache<StringValue> cache_;
 };
 
 class UPIDToPodNameUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-    auto pod_info = UPIDtoPod(md, upid_value);
-    if (pod_info == nullptr) {
-      return "";
+    return cache_.Resolve(md, upid_value, [&]() { return ResolvePodName(md, upid_value); });
+  }
+
+  Status ExecBatchArrow(FunctionContext* ctx, const std::vector<arrow::Array*>& inputs,
+                        arrow::ArrayBuilder* output, int count) {
+    auto md = GetMetadataState(ctx);
+    auto* input = static_cast<arrow::UInt128Array*>(inputs[0]);
+    auto* builder = static_cast<arrow::StringBuilder*>(output);
+    // Runs of rows from the same process replay the previous result without a cache lookup.
+    UInt128Value prev_upid;
+    StringValue prev_result;
+    bool has_prev = false;
+    for (int i = 0; i < count; ++i) {
+      UInt128Value upid(input->Value(i));
+      if (!has_prev || upid != prev_upid) {
+        prev_result = cache_.Resolve(md, upid, [&]() { return ResolvePodName(md, upid); });
+        prev_upid = upid;
+        has_prev = true;
+      }
+      PL_RETURN_IF_ERROR(builder->Append(prev_result));
     }
-    return absl::Substitute("$0/$1", pod_info->ns(), pod_info->name());
+    return Status::OK();
   }
 
   static udf::InfRuleVec SemanticInferenceRules() {
@@ -427,6 +495,17 @@ class UPIDToPodNameUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  static StringValue ResolvePodName(const px::md::AgentMetadataState* md, UInt128Value upid_value) {
+    auto pod_info = UPIDtoPod(md, upid_value);
+    if (pod_info == nullptr) {
+      return "";
+    }
+    return pod_info->ns_and_name();
+  }
+
+  internal::UPIDResolutionCache<StringValue> cache_;
 };
 
 class ServiceIDToServiceNameUDF : public ScalarUDF {
@@ -436,7 +515,7 @@ class ServiceIDToServiceNameUDF : public ScalarUDF {
 
     const auto* service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
     if (service_info != nullptr) {
-      return absl::Substitute("$0/$1", service_info->ns(), service_info->name());
+      return service_info->ns_and_name();
     }
 
     return "";
@@ -561,22 +640,24 @@ class UPIDToServiceIDUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-    auto pod_info = UPIDtoPod(md, upid_value);
-    if (pod_info == nullptr || pod_info->services().size() == 0) {
-      return "";
-    }
-    std::vector<std::string> running_service_ids;
-    for (const auto& service_id : pod_info->services()) {
-      auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
-      if (service_info == nullptr) {
-        continue;
+    return cache_.Resolve(md, upid_value, [&]() -> StringValue {
+      auto pod_info = UPIDtoPod(md, upid_value);
+      if (pod_info == nullptr || pod_info->services().size() == 0) {
+        return "";
       }
-      if (service_info->stop_time_ns() == 0) {
-        running_service_ids.push_back(service_id);
+      std::vector<std::string> running_service_ids;
+      for (const auto& service_id : pod_info->services()) {
+        auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
+        if (service_info == nullptr) {
+          continue;
+        }
+        if (service_info->stop_time_ns() == 0) {
+          running_service_ids.push_back(service_id);
+        }
       }
-    }
 
-    return StringifyVector(running_service_ids);
+      return StringifyVector(running_service_ids);
+    });
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -594,6 +675,9 @@ class UPIDToServiceIDUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  internal::UPIDResolutionCache<StringValue> cache_;
 };
 
 /**
@@ -603,22 +687,23 @@ class UPIDToServiceNameUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-    auto pod_info = UPIDtoPod(md, upid_value);
-    if (pod_info == nullptr || pod_info->services().size() == 0) {
-      return "";
-    }
-    std::vector<std::string> running_service_names;
-    for (const auto& service_id : pod_info->services()) {
-      auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
-      if (service_info == nullptr) {
-        continue;
+    return cache_.Resolve(md, upid_value, [&]() -> StringValue {
+      auto pod_info = UPIDtoPod(md, upid_value);
+      if (pod_info == nullptr || pod_info->services().size() == 0) {
+        return "";
       }
-      if (service_info->stop_time_ns() == 0) {
-        running_service_names.push_back(
-            absl::Substitute("$0/$1", service_info->ns(), service_info->name()));
+      std::vector<std::string> running_service_names;
+      for (const auto& service_id : pod_info->services()) {
+        auto service_info = md->k8s_metadata_state().ServiceInfoByID(service_id);
+        if (service_info == nullptr) {
+          continue;
+        }
+        if (service_info->stop_time_ns() == 0) {
+          running_service_names.push_back(service_info->ns_and_name());
+        }
       }
-    }
-    return StringifyVector(running_service_names);
+      return StringifyVector(running_service_names);
+    });
   }
   static udf::InfRuleVec SemanticInferenceRules() {
     return {
@@ -640,6 +725,9 @@ class UPIDToServiceNameUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  internal::UPIDResolutionCache<StringValue> cache_;
 };
 
 /**
@@ -649,12 +737,13 @@ class UPIDToNodeNameUDF : public ScalarUDF {
  public:
   StringValue Exec(FunctionContext* ctx, UInt128Value upid_value) {
     auto md = GetMetadataState(ctx);
-    auto pod_info = UPIDtoPod(md, upid_value);
-    if (pod_info == nullptr) {
-      return "";
-    }
-    std::string foo = std::string(pod_info->node_name());
-    return foo;
+    return cache_.Resolve(md, upid_value, [&]() -> StringValue {
+      auto pod_info = UPIDtoPod(md, upid_value);
+      if (pod_info == nullptr) {
+        return "";
+      }
+      return std::string(pod_info->node_name());
+    });
   }
   static udf::InfRuleVec SemanticInferenceRules() {
     return {udf::ExplicitRule::Create<UPIDToNodeNameUDF>(types::ST_NODE_NAME, {types::ST_NONE})};
@@ -672,6 +761,9 @@ class UPIDToNodeNameUDF : public ScalarUDF {
 
   // This UDF can currently only run on PEMs, because only PEMs have the UPID information.
   static udfspb::UDFSourceExecutor Executor() { return udfspb::UDFSourceExecutor::UDF_PEM; }
+
+ private:
+  internal::UPIDResolutionCache<StringValue> cache_;
 };
 
 /**
@@ -863,7 +955,7 @@ class ReplicaSetIDToReplicaSetNameUDF : public ScalarUDF {
       return "";
     }
 
-    return absl::Substitute("$0/$1", rs_info->ns(), rs_info->name());
+    return rs_info->ns_and_name();
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -1021,7 +1113,7 @@ class ReplicaSetIDToDeploymentNameUDF : public ScalarUDF {
       return "";
     }
     auto deployment = static_cast<const md::DeploymentInfo*>(deployments[0]);
-    return absl::Substitute("$0/$1", deployment->ns(), deployment->name());
+    return deployment->ns_and_name();
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -1275,7 +1367,7 @@ class ReplicaSetNameToDeploymentNameUDF : public ScalarUDF {
       return "";
     }
     auto deployment = static_cast<const md::DeploymentInfo*>(deployments[0]);
-    return absl::Substitute("$0/$1", deployment->ns(), deployment->name());
+    return deployment->ns_and_name();
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -1335,7 +1427,7 @@ class DeploymentIDToDeploymentNameUDF : public ScalarUDF {
       return "";
     }
 
-    return absl::Substitute("$0/$1", dep_info->ns(), dep_info->name());
+    return dep_info->ns_and_name();
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -1620,7 +1712,7 @@ class UPIDToReplicaSetNameUDF : public ScalarUDF {
       if (rs_info->stop_time_ns() != 0) {
         return "";
       }
-      return absl::Substitute("$0/$1", rs_info->ns(), rs_info->name());
+      return rs_info->ns_and_name();
     }
 
     return "";
@@ -1752,7 +1844,7 @@ class UPIDToDeploymentNameUDF : public ScalarUDF {
     if (deployment->stop_time_ns() != 0) {
       return "";
     }
-    return absl::Substitute("$0/$1", deployment->ns(), deployment->name());
+    return deployment->ns_and_name();
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -1868,7 +1960,7 @@ class PodIDToServiceNameUDF : public ScalarUDF {
       }
       if (service_info->stop_time_ns() == 0) {
         running_service_names.push_back(
-            absl::Substitute("$0/$1", service_info->ns(), service_info->name()));
+            service_info->ns_and_name());
       }
     }
     return StringifyVector(running_service_names);
@@ -2034,7 +2126,7 @@ class PodIDToReplicaSetNameUDF : public ScalarUDF {
       return "";
     } else {
       auto rs_info = static_cast<const md::ReplicaSetInfo*>(replica_sets[0]);
-      return absl::Substitute("$0/$1", rs_info->ns(), rs_info->name());
+      return rs_info->ns_and_name();
     }
   }
 
@@ -2109,7 +2201,7 @@ class PodIDToDeploymentNameUDF : public ScalarUDF {
       return "";
     }
     auto deployment = static_cast<const md::DeploymentInfo*>(deployments[0]);
-    return absl::Substitute("$0/$1", deployment->ns(), deployment->name());
+    return deployment->ns_and_name();
   }
 
   static udf::ScalarUDFDocBuilder Doc() {
@@ -2186,7 +2278,7 @@ class PodNameToReplicaSetNameUDF : public ScalarUDF {
       return "";
     } else {
       auto rs_info = static_cast<const md::ReplicaSetInfo*>(replica_sets[0]);
-      return absl::Substitute("$0/$1", rs_info->ns(), rs_info->name());
+      return rs_info->ns_and_name();
     }
   }
   static udf::ScalarUDFDocBuilder Doc() {
@@ -2271,7 +2363,7 @@ class PodNameToDeploymentNameUDF : public ScalarUDF {
       return "";
     }
     auto deployment = static_cast<const md::DeploymentInfo*>(deployments[0]);
-    return absl::Substitute("$0/$1", deployment->ns(), deployment->name());
+    return deployment->ns_and_name();
   }
   static udf::ScalarUDFDocBuilder Doc() {
     return udf::ScalarUDFDocBuilder(
@@ -2356,7 +2448,7 @@ class PodNameToServiceNameUDF : public ScalarUDF {
       }
       if (service_info->stop_time_ns() == 0) {
         running_service_names.push_back(
-            absl::Substitute("$0/$1", service_info->ns(), service_info->name()));
+            service_info->ns_and_name());
       }
     }
     return StringifyVector(running_service_names);
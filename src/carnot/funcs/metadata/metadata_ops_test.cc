@@ -31,6 +31,7 @@
 #include "src/common/testing/testing.h"
 #include "src/shared/k8s/metadatapb/test_proto.h"
 #include "src/shared/metadata/pids.h"
+#include "src/shared/types/arrow_adapter.h"
 #include "src/shared/metadata/state_manager.h"
 #include "src/shared/metadata/test_utils.h"
 #include "src/shared/upid/upid.h"
@@ -147,6 +148,25 @@ TEST_F(MetadataOpsTest, upid_to_pod_name_test) {
   udf_tester.ForInput(upid3).Expect("");
 }
 
+TEST_F(MetadataOpsTest, upid_to_pod_name_batch_arrow_test) {
+  auto function_ctx = std::make_unique<FunctionContext>(metadata_state_, nullptr);
+  auto upids = std::vector<types::UInt128Value>(
+      {types::UInt128Value(528280977975, 89101), types::UInt128Value(528280977975, 89101),
+       types::UInt128Value(528280977975, 468), types::UInt128Value(528280977975, 123)});
+  auto upid_arr = types::ToArrow(upids, arrow::default_memory_pool());
+
+  UPIDToPodNameUDF udf;
+  arrow::StringBuilder builder;
+  EXPECT_OK(udf.ExecBatchArrow(function_ctx.get(), {upid_arr.get()}, &builder, 4));
+  std::shared_ptr<arrow::Array> res;
+  EXPECT_TRUE(builder.Finish(&res).ok());
+  auto* str_arr = static_cast<arrow::StringArray*>(res.get());
+  EXPECT_EQ("pl/running_pod", str_arr->GetString(0));
+  EXPECT_EQ("pl/running_pod", str_arr->GetString(1));
+  EXPECT_EQ("pl/terminating_pod", str_arr->GetString(2));
+  EXPECT_EQ("", str_arr->GetString(3));
+}
+
 TEST_F(MetadataOpsTest, upid_to_namespace_test) {
   auto function_ctx = std::make_unique<FunctionContext>(metadata_state_, nullptr);
   auto udf_tester = px::carnot::udf::UDFTester<UPIDToNamespaceUDF>(std::move(function_ctx));
@@ -48,6 +48,22 @@ type GoPlanner struct {
 	planner C.PlannerPtr
 }
 
+// cPtr returns a C pointer to the slice's backing array without copying. The cgo
+// pointer-passing rules allow this as long as the C side doesn't retain the pointer past the
+// call, which the planner entry points (which parse the buffers synchronously) respect.
+func cPtr(b []byte) *C.char {
+	if len(b) == 0 {
+		return nil
+	}
+	return (*C.char)(unsafe.Pointer(&b[0]))
+}
+
+// cResult views the C result buffer in place. The caller must keep the buffer alive (i.e.
+// defer StrFree) until it is done with the returned slice.
+func cResult(res *C.char, resultLen C.int) []byte {
+	return unsafe.Slice((*byte)(unsafe.Pointer(res)), int(resultLen))
+}
+
 // New creates a new GoPlanner object.
 func New(udfInfo *udfspb.UDFInfo) (GoPlanner, error) {
 	var ret GoPlanner
@@ -70,22 +86,20 @@ func (cm GoPlanner) Plan(planState *distributedpb.LogicalPlannerState, queryRequ
 	if err != nil {
 		return nil, err
 	}
-	stateData := C.CBytes(stateBytes)
-	defer C.free(stateData)
 
 	queryRequestBytes, err := proto.Marshal(queryRequest)
 	if err != nil {
 		return nil, err
 	}
-	queryRequestData := C.CBytes(queryRequestBytes)
-	defer C.free(queryRequestData)
 
-	res := C.PlannerPlan(cm.planner, (*C.char)(stateData), C.int(len(stateBytes)), (*C.char)(queryRequestData), C.int(len(queryRequestBytes)), &resultLen)
+	res := C.PlannerPlan(cm.planner, cPtr(stateBytes), C.int(len(stateBytes)), cPtr(queryRequestBytes), C.int(len(queryRequestBytes)), &resultLen)
 	defer C.StrFree(res)
-	lp := C.GoBytes(unsafe.Pointer(res), resultLen)
 	if resultLen == 0 {
 		return nil, errors.New("no result returned")
 	}
+	// Unmarshal reads the C buffer in place and copies only what it keeps; the buffer is
+	// freed by the deferred StrFree afterwards.
+	lp := cResult(res, resultLen)
 
 	plan := &distributedpb.LogicalPlannerResult{}
 	if err := proto.Unmarshal(lp, plan); err != nil {
@@ -101,22 +115,18 @@ func (cm GoPlanner) CompileMutations(planState *distributedpb.LogicalPlannerStat
 	if err != nil {
 		return nil, err
 	}
-	stateData := C.CBytes(stateBytes)
-	defer C.free(stateData)
 
 	requestBytes, err := proto.Marshal(request)
 	if err != nil {
 		return nil, err
 	}
-	requestData := C.CBytes(requestBytes)
-	defer C.free(requestData)
 
-	res := C.PlannerCompileMutations(cm.planner, (*C.char)(stateData), C.int(len(stateBytes)), (*C.char)(requestData), C.int(len(requestBytes)), &resultLen)
+	res := C.PlannerCompileMutations(cm.planner, cPtr(stateBytes), C.int(len(stateBytes)), cPtr(requestBytes), C.int(len(requestBytes)), &resultLen)
 	defer C.StrFree(res)
-	resultBytes := C.GoBytes(unsafe.Pointer(res), resultLen)
 	if resultLen == 0 {
 		return nil, errors.New("no result returned")
 	}
+	resultBytes := cResult(res, resultLen)
 
 	resultPB := &plannerpb.CompileMutationsResponse{}
 	if err := proto.Unmarshal(resultBytes, resultPB); err != nil {
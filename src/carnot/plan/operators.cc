@@ -74,6 +74,10 @@ std::unique_ptr<Operator> Operator::FromProto(const planpb::Operator& pb, int64_
       return CreateOperator<FilterOperator>(id, pb.filter_op());
     case planpb::LIMIT_OPERATOR:
       return CreateOperator<LimitOperator>(id, pb.limit_op());
+    case planpb::TOPN_OPERATOR:
+      return CreateOperator<TopNOperator>(id, pb.topn_op());
+    case planpb::SAMPLE_OPERATOR:
+      return CreateOperator<SampleOperator>(id, pb.sample_op());
     case planpb::UNION_OPERATOR:
       return CreateOperator<UnionOperator>(id, pb.union_op());
     case planpb::JOIN_OPERATOR:
@@ -450,6 +454,125 @@ StatusOr<table_store::schema::Relation> LimitOperator::OutputRelation(
   return output_relation;
 }
 
+/**
+ * TopN Operator Implementation.
+ */
+std::string TopNOperator::DebugString() const {
+  std::vector<std::string> keys;
+  keys.reserve(sort_keys_.size());
+  for (const auto& key : sort_keys_) {
+    keys.push_back(absl::Substitute("$0$1", key.ascending ? "+" : "-", key.column_index));
+  }
+  return absl::Substitute("Op:TopN($0, keys: [$1], cols: [$2])", record_limit_,
+                          absl::StrJoin(keys, ","), absl::StrJoin(selected_cols_, ","));
+}
+
+Status TopNOperator::Init(const planpb::TopNOperator& pb) {
+  pb_ = pb;
+  record_limit_ = pb_.limit();
+
+  sort_keys_.reserve(pb_.sort_keys_size());
+  for (auto i = 0; i < pb_.sort_keys_size(); ++i) {
+    sort_keys_.push_back(SortKey{pb_.sort_keys(i).column_index(), pb_.sort_keys(i).ascending()});
+  }
+  if (sort_keys_.empty()) {
+    return error::InvalidArgument("TopN operator must have at least one sort key");
+  }
+
+  selected_cols_.reserve(pb_.columns_size());
+  for (auto i = 0; i < pb_.columns_size(); ++i) {
+    selected_cols_.push_back(pb_.columns(i).index());
+  }
+
+  is_initialized_ = true;
+  return Status::OK();
+}
+
+StatusOr<table_store::schema::Relation> TopNOperator::OutputRelation(
+    const table_store::schema::Schema& schema, const PlanState& /*state*/,
+    const std::vector<int64_t>& input_ids) const {
+  DCHECK(is_initialized_) << "Not initialized";
+
+  if (input_ids.size() != 1) {
+    return error::InvalidArgument("TopN operator must have exactly one input");
+  }
+  if (!schema.HasRelation(input_ids[0])) {
+    return error::NotFound("Missing relation ($0) for input of TopNOperator", input_ids[0]);
+  }
+
+  PL_ASSIGN_OR_RETURN(const table_store::schema::Relation& input_relation,
+                      schema.GetRelation(input_ids[0]));
+  table_store::schema::Relation output_relation;
+  for (auto selected_col_idx : selected_cols_) {
+    CHECK_LT(selected_col_idx, static_cast<int64_t>(input_relation.NumColumns()))
+        << absl::Substitute("Column index $0 is out of bounds, number of columns is $1",
+                            selected_col_idx, input_relation.NumColumns());
+
+    output_relation.AddColumn(input_relation.GetColumnType(selected_col_idx),
+                              input_relation.GetColumnName(selected_col_idx),
+                              input_relation.GetColumnDesc(selected_col_idx));
+  }
+
+  return output_relation;
+}
+
+/**
+ * Sample Operator Implementation.
+ */
+std::string SampleOperator::DebugString() const {
+  return absl::Substitute("Op:Sample($0, groups: [$1], cols: [$2])", num_rows_,
+                          absl::StrJoin(group_indices_, ","), absl::StrJoin(selected_cols_, ","));
+}
+
+Status SampleOperator::Init(const planpb::SampleOperator& pb) {
+  pb_ = pb;
+  num_rows_ = pb_.num_rows();
+  if (num_rows_ <= 0) {
+    return error::InvalidArgument("Sample operator must keep at least one row");
+  }
+
+  group_indices_.reserve(pb_.group_indices_size());
+  for (auto i = 0; i < pb_.group_indices_size(); ++i) {
+    group_indices_.push_back(pb_.group_indices(i));
+  }
+
+  selected_cols_.reserve(pb_.columns_size());
+  for (auto i = 0; i < pb_.columns_size(); ++i) {
+    selected_cols_.push_back(pb_.columns(i).index());
+  }
+
+  is_initialized_ = true;
+  return Status::OK();
+}
+
+StatusOr<table_store::schema::Relation> SampleOperator::OutputRelation(
+    const table_store::schema::Schema& schema, const PlanState& /*state*/,
+    const std::vector<int64_t>& input_ids) const {
+  DCHECK(is_initialized_) << "Not initialized";
+
+  if (input_ids.size() != 1) {
+    return error::InvalidArgument("Sample operator must have exactly one input");
+  }
+  if (!schema.HasRelation(input_ids[0])) {
+    return error::NotFound("Missing relation ($0) for input of SampleOperator", input_ids[0]);
+  }
+
+  PL_ASSIGN_OR_RETURN(const table_store::schema::Relation& input_relation,
+                      schema.GetRelation(input_ids[0]));
+  table_store::schema::Relation output_relation;
+  for (auto selected_col_idx : selected_cols_) {
+    CHECK_LT(selected_col_idx, static_cast<int64_t>(input_relation.NumColumns()))
+        << absl::Substitute("Column index $0 is out of bounds, number of columns is $1",
+                            selected_col_idx, input_relation.NumColumns());
+
+    output_relation.AddColumn(input_relation.GetColumnType(selected_col_idx),
+                              input_relation.GetColumnName(selected_col_idx),
+                              input_relation.GetColumnDesc(selected_col_idx));
+  }
+
+  return output_relation;
+}
+
 /**
  * Zip Operator Implementation.
  */
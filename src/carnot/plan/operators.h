@@ -144,6 +144,12 @@ class AggregateOperator : public Operator {
   const std::vector<GroupInfo>& groups() const { return groups_; }
   const std::vector<std::shared_ptr<AggregateExpression>>& values() const { return values_; }
   bool windowed() const { return pb_.windowed(); }
+  // A windowed aggregate with a window size does streaming tumbling-window aggregation keyed on
+  // the window time column; without one, windowing is driven by upstream eow markers.
+  bool has_streaming_window() const { return pb_.windowed() && pb_.window_size_ns() > 0; }
+  int64_t window_size_ns() const { return pb_.window_size_ns(); }
+  int64_t window_time_column_index() const { return pb_.window_time_column_index(); }
+  int64_t allowed_lateness_ns() const { return pb_.allowed_lateness_ns(); }
 
  private:
   std::vector<std::shared_ptr<AggregateExpression>> values_;
@@ -262,6 +268,56 @@ class LimitOperator : public Operator {
   planpb::LimitOperator pb_;
 };
 
+class TopNOperator : public Operator {
+ public:
+  explicit TopNOperator(int64_t id) : Operator(id, planpb::TOPN_OPERATOR) {}
+  ~TopNOperator() override = default;
+
+  struct SortKey {
+    int64_t column_index;
+    bool ascending;
+  };
+
+  StatusOr<table_store::schema::Relation> OutputRelation(
+      const table_store::schema::Schema& schema, const PlanState& state,
+      const std::vector<int64_t>& input_ids) const override;
+  Status Init(const planpb::TopNOperator& pb);
+  std::string DebugString() const override;
+  const std::vector<int64_t>& selected_cols() const { return selected_cols_; }
+
+  int64_t record_limit() const { return record_limit_; }
+  const std::vector<SortKey>& sort_keys() const { return sort_keys_; }
+
+ private:
+  int64_t record_limit_ = 0;
+  std::vector<SortKey> sort_keys_;
+  std::vector<int64_t> selected_cols_;
+  planpb::TopNOperator pb_;
+};
+
+class SampleOperator : public Operator {
+ public:
+  explicit SampleOperator(int64_t id) : Operator(id, planpb::SAMPLE_OPERATOR) {}
+  ~SampleOperator() override = default;
+
+  StatusOr<table_store::schema::Relation> OutputRelation(
+      const table_store::schema::Schema& schema, const PlanState& state,
+      const std::vector<int64_t>& input_ids) const override;
+  Status Init(const planpb::SampleOperator& pb);
+  std::string DebugString() const override;
+  const std::vector<int64_t>& selected_cols() const { return selected_cols_; }
+
+  int64_t num_rows() const { return num_rows_; }
+  // Indices of the stratification columns; empty means one uniform reservoir over all rows.
+  const std::vector<int64_t>& group_indices() const { return group_indices_; }
+
+ private:
+  int64_t num_rows_ = 0;
+  std::vector<int64_t> group_indices_;
+  std::vector<int64_t> selected_cols_;
+  planpb::SampleOperator pb_;
+};
+
 class UnionOperator : public Operator {
  public:
   explicit UnionOperator(int64_t id) : Operator(id, planpb::UNION_OPERATOR) {}
@@ -313,6 +369,7 @@ class JoinOperator : public Operator {
   }
   std::vector<planpb::JoinOperator::ParentColumn> output_columns() const { return output_columns_; }
   size_t rows_per_batch() const { return pb_.rows_per_batch(); }
+  bool sorted_inputs() const { return pb_.sorted_inputs(); }
 
   bool order_by_time() const;
   planpb::JoinOperator::ParentColumn time_column() const;
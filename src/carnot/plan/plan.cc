@@ -39,11 +39,12 @@ Status PlanWalker::CallWalkFn(PlanFragment* pf) { return on_plan_fragment_walk_f
 Status PlanWalker::Walk(Plan* plan) {
   auto plan_fragments = plan->dag().TopologicalSort();
   for (const auto& node_id : plan_fragments) {
-    auto node = plan->nodes().find(node_id);
-    if (node == plan->nodes().end()) {
+    // Fragments are deserialized from their protos on first touch, here at schedule time.
+    auto node_or = plan->GetNode(node_id);
+    if (!node_or.ok()) {
       LOG(WARNING) << absl::Substitute("Could not find node $0 in plan", node_id);
     } else {
-      PL_RETURN_IF_ERROR(CallWalkFn(node->second.get()));
+      PL_RETURN_IF_ERROR(CallWalkFn(node_or.ConsumeValueOrDie()));
     }
   }
   return Status::OK();
@@ -77,6 +77,12 @@ Status PlanFragmentWalker::CallWalkFn(const Operator& op) {
     case planpb::OperatorType::LIMIT_OPERATOR:
       PL_RETURN_IF_ERROR(CallAs<LimitOperator>(on_limit_walk_fn_, op));
       break;
+    case planpb::OperatorType::TOPN_OPERATOR:
+      PL_RETURN_IF_ERROR(CallAs<TopNOperator>(on_topn_walk_fn_, op));
+      break;
+    case planpb::OperatorType::SAMPLE_OPERATOR:
+      PL_RETURN_IF_ERROR(CallAs<SampleOperator>(on_sample_walk_fn_, op));
+      break;
     case planpb::OperatorType::JOIN_OPERATOR:
       PL_RETURN_IF_ERROR(CallAs<JoinOperator>(on_join_walk_fn_, op));
       break;
@@ -108,11 +114,12 @@ Status PlanFragmentWalker::CallWalkFn(const Operator& op) {
 Status PlanFragmentWalker::Walk(PlanFragment* plan_fragment) {
   auto operators = plan_fragment->dag().TopologicalSort();
   for (const auto& node_id : operators) {
-    auto node = plan_fragment->nodes().find(node_id);
-    if (node == plan_fragment->nodes().end()) {
+    // Operators are deserialized from their protos on first touch.
+    auto node_or = plan_fragment->GetNode(node_id);
+    if (!node_or.ok()) {
       LOG(WARNING) << absl::Substitute("Could not find node $0 in plan fragment", node_id);
     } else {
-      PL_RETURN_IF_ERROR(CallWalkFn(*node->second));
+      PL_RETURN_IF_ERROR(CallWalkFn(*node_or.ConsumeValueOrDie()));
     }
   }
   return Status::OK();
@@ -69,6 +69,8 @@ class PlanFragmentWalker {
   using MemorySinkWalkFn = std::function<Status(const MemorySinkOperator&)>;
   using FilterWalkFn = std::function<Status(const FilterOperator&)>;
   using LimitWalkFn = std::function<Status(const LimitOperator&)>;
+  using TopNWalkFn = std::function<Status(const TopNOperator&)>;
+  using SampleWalkFn = std::function<Status(const SampleOperator&)>;
   using UnionWalkFn = std::function<Status(const UnionOperator&)>;
   using JoinWalkFn = std::function<Status(const JoinOperator&)>;
   using GRPCSinkWalkFn = std::function<Status(const GRPCSinkOperator&)>;
@@ -137,6 +139,26 @@ class PlanFragmentWalker {
     return *this;
   }
 
+  /**
+   * Register callback for when a TopN operator is encountered.
+   * @param fn The function to call when a TopNOperator is encountered.
+   * @return self to allow chaining
+   */
+  PlanFragmentWalker& OnTopN(const TopNWalkFn& fn) {
+    on_topn_walk_fn_ = fn;
+    return *this;
+  }
+
+  /**
+   * Register callback for when a Sample operator is encountered.
+   * @param fn The function to call when a SampleOperator is encountered.
+   * @return self to allow chaining
+   */
+  PlanFragmentWalker& OnSample(const SampleWalkFn& fn) {
+    on_sample_walk_fn_ = fn;
+    return *this;
+  }
+
   /**
    * Register callback for when a union operator is encountered.
    * @param fn The function to call when a UnionOperator is encountered.
@@ -199,6 +221,8 @@ class PlanFragmentWalker {
   MemorySinkWalkFn on_memory_sink_walk_fn_;
   FilterWalkFn on_filter_walk_fn_;
   LimitWalkFn on_limit_walk_fn_;
+  TopNWalkFn on_topn_walk_fn_;
+  SampleWalkFn on_sample_walk_fn_;
   UnionWalkFn on_union_walk_fn_;
   JoinWalkFn on_join_walk_fn_;
   GRPCSinkWalkFn on_grpc_sink_walk_fn_;
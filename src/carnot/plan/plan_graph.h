@@ -35,21 +35,57 @@ class PlanGraph {
  public:
   virtual ~PlanGraph() = default;
   DAG& dag() { return dag_; }
-  std::unordered_map<int64_t, std::unique_ptr<TNode>>& nodes() { return nodes_; }
+
+  /**
+   * Direct access to the node map. Materializes any nodes still in proto form first, so
+   * callers see the whole graph; paths that only touch part of the graph should prefer
+   * GetNode(), which constructs nodes from their protos on first access.
+   */
+  std::unordered_map<int64_t, std::unique_ptr<TNode>>& nodes() {
+    if (!pb_nodes_.empty()) {
+      for (const auto& [id, pb] : pb_nodes_) {
+        nodes_.emplace(id, ProtoToNode(pb, id));
+      }
+      pb_nodes_.clear();
+    }
+    return nodes_;
+  }
 
   bool is_initialized() const { return is_initialized_; }
   Status Init(const TProto& pb) {
     // Add all of the nodes into the DAG.
     dag_.Init(pb.dag());
 
+    // Node construction is deferred until first access: many small queries never touch every
+    // part of the graph before a fragment is scheduled, so we only store the protos here.
     for (const auto& node : pb.nodes()) {
-      nodes_.emplace(node.id(), PlanGraph::ProtoToNode(node, node.id()));
+      pb_nodes_.emplace(node.id(), node);
     }
 
     is_initialized_ = true;
     return Status::OK();
   }
 
+  /**
+   * Returns the node with the given id, constructing it from its stored proto on first
+   * access.
+   */
+  StatusOr<TNode*> GetNode(int64_t id) {
+    auto it = nodes_.find(id);
+    if (it != nodes_.end()) {
+      return it->second.get();
+    }
+    auto pb_it = pb_nodes_.find(id);
+    if (pb_it == pb_nodes_.end()) {
+      return error::NotFound("Could not find node $0 in plan graph", id);
+    }
+    std::unique_ptr<TNode> node = ProtoToNode(pb_it->second, id);
+    TNode* raw = node.get();
+    nodes_.emplace(id, std::move(node));
+    pb_nodes_.erase(pb_it);
+    return raw;
+  }
+
   static std::unique_ptr<TNode> ProtoToNode(const planpb::PlanFragment& pb, int64_t id) {
     return TNode::FromProto(pb, id);
   }
@@ -61,6 +97,8 @@ class PlanGraph {
  protected:
   DAG dag_;
   std::unordered_map<int64_t, std::unique_ptr<TNode>> nodes_;
+  // Nodes that have not been materialized yet, keyed by id.
+  std::unordered_map<int64_t, TPbNode> pb_nodes_;
 
   bool is_initialized_ = false;
 };
@@ -46,6 +46,17 @@ class PlanWalkerTest : public ::testing::Test {
   Plan plan_;
 };
 
+TEST_F(PlanWalkerTest, get_node_materializes_on_first_touch) {
+  ASSERT_OK_AND_ASSIGN(auto* pf, plan_.GetNode(1));
+  EXPECT_EQ(1, pf->id());
+  // Repeated access returns the same materialized fragment.
+  ASSERT_OK_AND_ASSIGN(auto* pf_again, plan_.GetNode(1));
+  EXPECT_EQ(pf, pf_again);
+  EXPECT_NOT_OK(plan_.GetNode(1000));
+  // Direct map access still sees the whole graph.
+  EXPECT_EQ(5, plan_.nodes().size());
+}
+
 TEST_F(PlanWalkerTest, basic_tests) {
   EXPECT_EQ(plan_.nodes().at(1)->id(), 1);
   std::vector<int64_t> pf_order;
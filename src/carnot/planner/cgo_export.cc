@@ -63,9 +63,11 @@ PlannerPtr PlannerNew(const char* udf_info_data, int udf_info_len) {
     }                                                           \
   } while (false)
 
-px::Status LoadProto(const std::string& serialized_proto, google::protobuf::Message* output,
+// Parses directly from the buffer Go handed us; the caller guarantees it stays alive for the
+// duration of the cgo call, so there is no need to copy it into a std::string first.
+px::Status LoadProto(const char* serialized_proto, int len, google::protobuf::Message* output,
                      const std::string& error_msg) {
-  bool success = output->ParseFromString(serialized_proto);
+  bool success = output->ParseFromArray(serialized_proto, len);
   if (!success) {
     LOG(ERROR) << error_msg;
     return px::Status(px::statuspb::INVALID_ARGUMENT, error_msg);
@@ -77,22 +79,17 @@ char* PlannerPlan(PlannerPtr planner_ptr, const char* planner_state_str_c,
                   int planner_state_str_len, const char* query_request_str_c,
                   int query_request_str_len, int* resultLen) {
   DCHECK(planner_state_str_c != nullptr);
-  std::string planner_state_pb_str(planner_state_str_c,
-                                   planner_state_str_c + planner_state_str_len);
-  std::string query_request_pb_str(query_request_str_c,
-                                   query_request_str_c + query_request_str_len);
-
   // Load in the planner state protobuf.
   px::carnot::planner::distributedpb::LogicalPlannerState planner_state_pb;
   PLANNER_RETURN_IF_ERROR(LogicalPlannerResult, resultLen,
-                          LoadProto(planner_state_pb_str, &planner_state_pb,
+                          LoadProto(planner_state_str_c, planner_state_str_len, &planner_state_pb,
                                     "Failed to process the logical planner state"));
 
   // Load in the query request protobuf.
   px::carnot::planner::plannerpb::QueryRequest query_request_pb;
-  PLANNER_RETURN_IF_ERROR(
-      LogicalPlannerResult, resultLen,
-      LoadProto(query_request_pb_str, &query_request_pb, "Failed to process the query request"));
+  PLANNER_RETURN_IF_ERROR(LogicalPlannerResult, resultLen,
+                          LoadProto(query_request_str_c, query_request_str_len, &query_request_pb,
+                                    "Failed to process the query request"));
 
   auto planner = reinterpret_cast<px::carnot::planner::LogicalPlanner*>(planner_ptr);
 
@@ -116,6 +113,8 @@ char* PlannerPlan(PlannerPtr planner_ptr, const char* planner_state_str_c,
     return ExitEarly<LogicalPlannerResult>(plan_pb_status.status(), resultLen);
   }
 
+  // Move rather than copy: the distributed plan proto carries one fragment per agent and can
+  // be large on big clusters.
   *(planner_result_pb.mutable_plan()) = plan_pb_status.ConsumeValueOrDie();
 
   // Serialize the logical plan into bytes.
@@ -126,22 +125,18 @@ char* PlannerCompileMutations(PlannerPtr planner_ptr, const char* planner_state_
                               int planner_state_str_len, const char* mutation_request_str_c,
                               int mutation_request_str_len, int* resultLen) {
   DCHECK(planner_state_str_c != nullptr);
-  std::string planner_state_pb_str(planner_state_str_c,
-                                   planner_state_str_c + planner_state_str_len);
-  std::string mutation_request_pb_str(mutation_request_str_c,
-                                      mutation_request_str_c + mutation_request_str_len);
-
   // Load in the planner state protobuf.
   px::carnot::planner::distributedpb::LogicalPlannerState planner_state_pb;
   PLANNER_RETURN_IF_ERROR(CompileMutationsResponse, resultLen,
-                          LoadProto(planner_state_pb_str, &planner_state_pb,
+                          LoadProto(planner_state_str_c, planner_state_str_len, &planner_state_pb,
                                     "Failed to parse the logical planner state"));
 
   // Load in the mutation request protobuf.
   px::carnot::planner::plannerpb::CompileMutationsRequest mutation_request_pb;
-  PLANNER_RETURN_IF_ERROR(CompileMutationsResponse, resultLen,
-                          LoadProto(mutation_request_pb_str, &mutation_request_pb,
-                                    "Failed to parse the mutation request"));
+  PLANNER_RETURN_IF_ERROR(
+      CompileMutationsResponse, resultLen,
+      LoadProto(mutation_request_str_c, mutation_request_str_len, &mutation_request_pb,
+                "Failed to parse the mutation request"));
 
   auto planner = reinterpret_cast<px::carnot::planner::LogicalPlanner*>(planner_ptr);
 
@@ -167,4 +162,4 @@ void PlannerFree(PlannerPtr planner_ptr) {
   delete reinterpret_cast<px::carnot::planner::LogicalPlanner*>(planner_ptr);
 }
 
-void StrFree(char* str) { delete str; }
+void StrFree(char* str) { delete[] str; }
@@ -31,14 +31,18 @@ char* CloneStringToCharArray(std::string str, int* ret_len) {
 }
 char* PrepareResult(google::protobuf::Message* pb, int* result_len) {
   DCHECK(pb);
-  std::string serialized;
-  bool success = pb->SerializeToString(&serialized);
-
-  if (!success) {
+  // Serialize straight into the buffer handed to Go instead of through an intermediate
+  // std::string that would be copied again. For large distributed plans (one fragment per
+  // agent) this halves the allocations and memcpy work per query dispatch.
+  size_t size = pb->ByteSizeLong();
+  char* retval = new char[size];
+  if (!pb->SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(retval))) {
+    delete[] retval;
     *result_len = 0;
     return nullptr;
   }
-  return CloneStringToCharArray(serialized, result_len);
+  *result_len = size;
+  return retval;
 }
 // TMessage should be a proto type with a Status message.
 template <typename TMessage>
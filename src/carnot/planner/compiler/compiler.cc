@@ -24,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include <absl/strings/str_cat.h>
 #include <pypa/ast/tree_walker.hh>
 #include <pypa/parser/parser.hh>
 
@@ -48,10 +49,48 @@ StatusOr<planpb::Plan> Compiler::Compile(const std::string& query, CompilerState
   return Compile(query, compiler_state, /* exec_funcs */ {});
 }
 
+std::string QueryPlanCache::Key(const std::string& query, const ExecFuncs& exec_funcs,
+                                uint64_t fingerprint) {
+  std::string key = absl::StrCat(fingerprint, ":", query);
+  for (const auto& func : exec_funcs) {
+    // Exec func args are baked into the plan, so the serialized funcs are part of the key.
+    absl::StrAppend(&key, "\x1e", func.SerializeAsString());
+  }
+  return key;
+}
+
+bool QueryPlanCache::Lookup(const std::string& key, planpb::Plan* plan) {
+  absl::base_internal::SpinLockHolder lock(&lock_);
+  auto it = plans_.find(key);
+  if (it == plans_.end()) {
+    return false;
+  }
+  *plan = it->second;
+  return true;
+}
+
+void QueryPlanCache::Insert(const std::string& key, const planpb::Plan& plan) {
+  absl::base_internal::SpinLockHolder lock(&lock_);
+  if (plans_.size() >= kMaxCachedPlans) {
+    return;
+  }
+  plans_.emplace(key, plan);
+}
+
 StatusOr<planpb::Plan> Compiler::Compile(const std::string& query, CompilerState* compiler_state,
                                          const ExecFuncs& exec_funcs) {
+  auto key = QueryPlanCache::Key(query, exec_funcs, compiler_state->CacheFingerprint());
+  planpb::Plan cached;
+  if (plan_cache_->Lookup(key, &cached)) {
+    return cached;
+  }
   PL_ASSIGN_OR_RETURN(std::shared_ptr<IR> ir, CompileToIR(query, compiler_state, exec_funcs));
-  return ir->ToProto();
+  PL_ASSIGN_OR_RETURN(planpb::Plan plan, ir->ToProto());
+  // Plans that read the current time are execution-specific and cannot be replayed.
+  if (!compiler_state->time_now_read()) {
+    plan_cache_->Insert(key, plan);
+  }
+  return plan;
 }
 
 StatusOr<std::shared_ptr<IR>> Compiler::CompileToIR(const std::string& query,
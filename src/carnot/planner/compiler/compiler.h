@@ -23,6 +23,9 @@
 #include <utility>
 #include <vector>
 
+#include <absl/base/internal/spinlock.h>
+#include <absl/container/flat_hash_map.h>
+
 #include "src/carnot/planner/compiler/ast_visitor.h"
 #include "src/carnot/planner/compiler_state/compiler_state.h"
 #include "src/carnot/planner/ir/ir.h"
@@ -33,6 +36,30 @@ namespace carnot {
 namespace planner {
 namespace compiler {
 
+/**
+ * Cache of compiled plans, keyed by the query string, the serialized exec funcs, and the
+ * CompilerState fingerprint. Alert-style workloads recompile the identical script on a fixed
+ * interval; replaying the cached plan skips parse, AST-visit, and the analyzer/optimizer
+ * pipeline. Only time-invariant plans are inserted (see CompilerState::time_now_read()), since
+ * plans that read the current time bake it into the emitted protobuf. The cache stops
+ * inserting past a fixed size instead of evicting, matching the assumption that the live
+ * script set is small.
+ */
+class QueryPlanCache {
+ public:
+  static std::string Key(const std::string& query, const ExecFuncs& exec_funcs,
+                         uint64_t fingerprint);
+
+  bool Lookup(const std::string& key, planpb::Plan* plan);
+  void Insert(const std::string& key, const planpb::Plan& plan);
+
+ private:
+  static constexpr size_t kMaxCachedPlans = 128;
+
+  absl::base_internal::SpinLock lock_;
+  absl::flat_hash_map<std::string, planpb::Plan> plans_;
+};
+
 /**
  * The compiler takes a query in the form of a string and compiles it into a logical plan.
  */
@@ -72,6 +99,9 @@ class Compiler {
   Status Analyze(IR* ir, CompilerState* compiler_state);
   Status Optimize(IR* ir, CompilerState* compiler_state);
   Status VerifyGraphHasResultSink(IR* ir);
+
+  // Shared so that copies of the Compiler keep feeding the same cache.
+  std::shared_ptr<QueryPlanCache> plan_cache_ = std::make_shared<QueryPlanCache>();
 };
 
 }  // namespace compiler
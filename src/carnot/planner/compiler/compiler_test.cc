@@ -3262,6 +3262,53 @@ TEST_F(CompilerTest, pxviews) {
       compiler_state_.get()));
 }
 
+TEST_F(CompilerTest, plan_cache_replays_identical_compiles) {
+  auto query = absl::StrJoin(
+      {
+          "import px",
+          "queryDF = px.DataFrame(table='cpu', select=['cpu0', 'cpu1'])",
+          "px.display(queryDF, 'cpu_out')",
+      },
+      "\n");
+
+  auto first = compiler_.Compile(query, compiler_state_.get());
+  ASSERT_OK(first);
+  auto second = compiler_.Compile(query, compiler_state_.get());
+  ASSERT_OK(second);
+  // Whether or not the second compile was served from the cache, it must produce the same plan.
+  EXPECT_EQ(first.ConsumeValueOrDie().DebugString(), second.ConsumeValueOrDie().DebugString());
+}
+
+TEST_F(CompilerTest, plan_cache_time_dependent_compiles_not_cached) {
+  // px.now() reads the compile-time clock, which marks the plan as execution-specific.
+  auto query = absl::StrJoin(
+      {
+          "import px",
+          "queryDF = px.DataFrame(table='cpu', select=['cpu0'], start_time='-5m')",
+          "px.display(queryDF, 'cpu_out')",
+      },
+      "\n");
+  ASSERT_OK(compiler_.Compile(query, compiler_state_.get()));
+  EXPECT_TRUE(compiler_state_->time_now_read());
+}
+
+TEST(QueryPlanCache, insert_and_lookup) {
+  QueryPlanCache cache;
+  planpb::Plan plan;
+  plan.add_nodes()->set_id(42);
+
+  auto key = QueryPlanCache::Key("px.display(df)", {}, /* fingerprint */ 1);
+  planpb::Plan out;
+  EXPECT_FALSE(cache.Lookup(key, &out));
+  cache.Insert(key, plan);
+  ASSERT_TRUE(cache.Lookup(key, &out));
+  EXPECT_EQ(42, out.nodes(0).id());
+
+  // A different fingerprint (schema or settings change) misses.
+  auto other_key = QueryPlanCache::Key("px.display(df)", {}, /* fingerprint */ 2);
+  EXPECT_FALSE(cache.Lookup(other_key, &out));
+}
+
 }  // namespace compiler
 }  // namespace planner
 }  // namespace carnot
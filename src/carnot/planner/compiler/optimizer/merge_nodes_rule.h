@@ -63,6 +63,10 @@ class MergeNodesRule : public Rule {
    */
   StatusOr<bool> Execute(IR* graph) override;
 
+  // Execute() above replaces the node-by-node traversal, so the rule executor cannot track
+  // which nodes this rule changes and must run its batch with full scans.
+  bool SupportsIncrementalExecution() const override { return false; }
+
   /**
    * @brief CanMerge returns whether two Operators can merge in line with our merging criteria.
    *
@@ -112,6 +112,38 @@ TEST_F(PruneUnusedColumnsRuleTest, filter) {
   EXPECT_THAT(*sink->resolved_table_type(), IsTableType(sink_relation));
 }
 
+// A two-column query over a wide (40+ column) table must narrow the source scan to exactly
+// the columns the query touches: the sink's columns plus the filter's predicate column.
+TEST_F(PruneUnusedColumnsRuleTest, wide_table_narrows_to_scan_columns) {
+  constexpr int kNumColumns = 40;
+  std::vector<types::DataType> col_types(kNumColumns, types::DataType::INT64);
+  std::vector<std::string> col_names;
+  for (int i = 0; i < kNumColumns; ++i) {
+    col_names.push_back(absl::Substitute("c$0", i));
+  }
+  Relation relation{col_types, col_names};
+  MemorySourceIR* mem_src = MakeMemSource("wide_source", relation);
+  compiler_state_->relation_map()->emplace("wide_source", relation);
+
+  auto eq_func = MakeEqualsFunc(MakeColumn("c3", 0), MakeInt(10));
+  auto filter = MakeFilter(mem_src, eq_func);
+  MakeMemSink(filter, "out", {"c1", "c2"});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  PruneUnusedColumnsRule rule;
+  auto result = rule.Execute(graph.get());
+  ASSERT_OK(result);
+  ASSERT_TRUE(result.ConsumeValueOrDie());
+
+  EXPECT_THAT(mem_src->column_names(), ElementsAre("c1", "c2", "c3"));
+  EXPECT_THAT(
+      *mem_src->resolved_table_type(),
+      IsTableType(Relation({types::DataType::INT64, types::DataType::INT64, types::DataType::INT64},
+                           {"c1", "c2", "c3"})));
+}
+
 TEST_F(PruneUnusedColumnsRuleTest, two_filters) {
   auto relation = MakeRelation();
   MemorySourceIR* mem_src = MakeMemSource("source", relation);
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -28,6 +29,7 @@
 #include "src/carnot/planner/compiler_state/registry_info.h"
 
 #include "src/common/base/base.h"
+#include "src/common/base/hash_utils.h"
 #include "src/shared/types/types.h"
 
 namespace px {
@@ -139,7 +141,62 @@ class CompilerState : public NotCopyable {
     return &table_names_to_sensitive_columns_;
   }
   RegistryInfo* registry_info() const { return registry_info_; }
-  types::Time64NSValue time_now() const { return time_now_; }
+  types::Time64NSValue time_now() const {
+    time_now_read_ = true;
+    return time_now_;
+  }
+  /**
+   * Whether any part of compilation read the current time (px.now() or relative time strings
+   * like '-5m'). Plans that never read it are time-invariant, which the compiler's plan cache
+   * relies on to decide whether a compiled plan can be replayed for later executions.
+   */
+  bool time_now_read() const { return time_now_read_; }
+
+  /**
+   * Fingerprint of the compilation inputs other than the query string itself: the table
+   * schemas and the settings that get baked into the emitted plan. Two compiler states with
+   * the same fingerprint compile the same query to the same plan, provided the compilation
+   * never read time_now().
+   */
+  uint64_t CacheFingerprint() const {
+    std::hash<std::string> str_hash;
+    uint64_t fp = str_hash(result_address_);
+    fp = HashCombine(fp, str_hash(result_ssl_targetname_));
+    fp = HashCombine(fp, static_cast<uint64_t>(max_output_rows_per_table_));
+    fp = HashCombine(fp, (redaction_options_.use_full_redaction ? 1 : 0) |
+                             (redaction_options_.use_px_redact_pii_best_effort ? 2 : 0));
+    if (endpoint_config_ != nullptr) {
+      fp = HashCombine(fp, str_hash(endpoint_config_->SerializeAsString()));
+    }
+    if (plugin_config_ != nullptr) {
+      fp = HashCombine(fp, static_cast<uint64_t>(plugin_config_->start_time_ns));
+      fp = HashCombine(fp, static_cast<uint64_t>(plugin_config_->end_time_ns));
+    }
+    for (const auto& attr : debug_info_.otel_debug_attrs) {
+      fp = HashCombine(fp, HashCombine(str_hash(attr.name), str_hash(attr.value)));
+    }
+    // XOR the per-table hashes so the maps' iteration order doesn't matter.
+    uint64_t tables = 0;
+    for (const auto& [name, relation] : *relation_map_) {
+      uint64_t h = str_hash(name);
+      for (size_t i = 0; i < relation.NumColumns(); ++i) {
+        h = HashCombine(h, str_hash(relation.GetColumnName(i)));
+        h = HashCombine(h, static_cast<uint64_t>(relation.GetColumnType(i)));
+      }
+      tables ^= h;
+    }
+    fp = HashCombine(fp, tables);
+    uint64_t sensitive = 0;
+    for (const auto& [table, cols] : table_names_to_sensitive_columns_) {
+      uint64_t col_hash = 0;
+      for (const auto& col : cols) {
+        col_hash ^= str_hash(col);
+      }
+      sensitive ^= HashCombine(str_hash(table), col_hash);
+    }
+    fp = HashCombine(fp, sensitive);
+    return fp;
+  }
   const std::string& result_address() const { return result_address_; }
   const std::string& result_ssl_targetname() const { return result_ssl_targetname_; }
 
@@ -181,6 +238,7 @@ class CompilerState : public NotCopyable {
   SensitiveColumnMap table_names_to_sensitive_columns_;
   RegistryInfo* registry_info_;
   types::Time64NSValue time_now_;
+  mutable bool time_now_read_ = false;
   std::map<IDRegistryKey, int64_t> udf_to_id_map_;
   std::map<IDRegistryKey, int64_t> uda_to_id_map_;
 
@@ -29,6 +29,8 @@
 #include "src/carnot/planner/distributed/coordinator/prune_unavailable_sources_rule.h"
 #include "src/carnot/planner/distributed/coordinator/removable_ops_rule.h"
 #include "src/carnot/planner/distributed/splitter/splitter.h"
+#include "src/carnot/planner/ir/grpc_sink_ir.h"
+#include "src/carnot/planner/ir/grpc_source_group_ir.h"
 #include "src/carnot/planner/rules/rules.h"
 #include "src/carnot/udfspb/udfs.pb.h"
 #include "src/common/uuid/uuid.h"
@@ -217,6 +219,46 @@ StatusOr<AgentToPlanMap> GetUniquePEMPlans(IR* query, DistributedPlan* plan,
   return agent_to_plan_map;
 }
 
+/**
+ * @brief Repartitions the PEM plan sharing so that agents sharing a plan all feed the same
+ * merger Kelvin. A GRPCSink carries a single destination address, so a plan shared by agents
+ * assigned to different mergers would serialize with the wrong address for some of them.
+ */
+StatusOr<AgentToPlanMap> PartitionPEMPlansByMerger(DistributedPlan* distributed_plan,
+                                                   AgentToPlanMap agent_to_plan_map) {
+  AgentToPlanMap partitioned;
+  absl::flat_hash_map<IR*, std::unique_ptr<IR>> plan_ownership;
+  for (auto& plan_uptr : agent_to_plan_map.plan_pool) {
+    plan_ownership[plan_uptr.get()] = std::move(plan_uptr);
+  }
+  for (const auto& [shared_plan, agents] : agent_to_plan_map.plan_to_agents) {
+    absl::flat_hash_map<int64_t, absl::flat_hash_set<int64_t>> merger_to_agents;
+    for (int64_t agent_id : agents) {
+      auto mergers = distributed_plan->dag().DependenciesOf(agent_id);
+      DCHECK_EQ(1UL, mergers.size());
+      merger_to_agents[mergers[0]].insert(agent_id);
+    }
+    bool reuse_shared_plan = true;
+    for (auto& [merger_id, merger_agents] : merger_to_agents) {
+      IR* partition_plan;
+      if (reuse_shared_plan) {
+        partition_plan = shared_plan;
+        partitioned.plan_pool.push_back(std::move(plan_ownership[shared_plan]));
+        reuse_shared_plan = false;
+      } else {
+        PL_ASSIGN_OR_RETURN(auto partition_plan_uptr, shared_plan->Clone());
+        partition_plan = partition_plan_uptr.get();
+        partitioned.plan_pool.push_back(std::move(partition_plan_uptr));
+      }
+      for (int64_t agent_id : merger_agents) {
+        partitioned.agent_to_plan_map[agent_id] = partition_plan;
+      }
+      partitioned.plan_to_agents[partition_plan] = std::move(merger_agents);
+    }
+  }
+  return partitioned;
+}
+
 StatusOr<SchemaToAgentsMap> LoadSchemaMap(
     const distributedpb::DistributedState& distributed_state,
     const absl::flat_hash_map<sole::uuid, int64_t>& uuid_to_id_map) {
@@ -236,6 +278,44 @@ StatusOr<SchemaToAgentsMap> LoadSchemaMap(
   return agent_schema_map;
 }
 
+/**
+ * @brief Builds the relay plan run by an intermediate merger Kelvin and rewires the PEM-side
+ * plan to feed it.
+ *
+ * For every GRPC bridge leaving the PEM-side plan, the merger plan receives the PEM output on
+ * a fresh bridge id and forwards it on the original bridge id, which is the id the final
+ * Kelvin's GRPCSourceGroups expect. The PEM-side GRPCSinks are renumbered to the fresh ids so
+ * that PEM output lands on the merger tier; the final Kelvin's plan is left untouched.
+ */
+StatusOr<std::unique_ptr<IR>> BuildIntermediateMergerPlan(IR* pem_plan) {
+  auto merger_plan = std::make_unique<IR>();
+  std::vector<GRPCSinkIR*> bridge_sinks;
+  int64_t next_bridge_id = 0;
+  for (IRNode* ir_node : pem_plan->FindNodesOfType(IRNodeType::kGRPCSink)) {
+    DCHECK(Match(ir_node, GRPCSink()));
+    auto sink = static_cast<GRPCSinkIR*>(ir_node);
+    if (!sink->has_destination_id()) {
+      continue;
+    }
+    bridge_sinks.push_back(sink);
+    next_bridge_id = std::max(next_bridge_id, sink->destination_id() + 1);
+  }
+  for (GRPCSinkIR* sink : bridge_sinks) {
+    DCHECK_EQ(1UL, sink->parents().size());
+    OperatorIR* sink_parent = sink->parents()[0];
+    PL_ASSIGN_OR_RETURN(GRPCSourceGroupIR * relay_source,
+                        merger_plan->CreateNode<GRPCSourceGroupIR>(sink->ast(), next_bridge_id,
+                                                                   sink_parent->resolved_type()));
+    PL_ASSIGN_OR_RETURN(
+        GRPCSinkIR * relay_sink,
+        merger_plan->CreateNode<GRPCSinkIR>(sink->ast(), relay_source, sink->destination_id()));
+    PL_RETURN_IF_ERROR(relay_sink->SetResolvedType(sink_parent->resolved_type()));
+    sink->SetDestinationID(next_bridge_id);
+    ++next_bridge_id;
+  }
+  return merger_plan;
+}
+
 StatusOr<std::unique_ptr<DistributedPlan>> CoordinatorImpl::CoordinateImpl(const IR* logical_plan) {
   // TODO(zasgar) set support_partial_agg to true to enable partial aggs.
   PL_ASSIGN_OR_RETURN(std::unique_ptr<Splitter> splitter,
@@ -254,10 +334,42 @@ StatusOr<std::unique_ptr<DistributedPlan>> CoordinatorImpl::CoordinateImpl(const
   remote_carnot->AddPlan(remote_plan);
   distributed_plan->AddPlan(std::move(remote_plan_uptr));
 
+  // On large clusters the final Kelvin becomes a fan-in bottleneck, so spread the PEMs across
+  // an intermediate tier of merger Kelvins when spare Kelvin instances are available. A single
+  // merger would only move the bottleneck without dividing it, so the tier needs at least two.
+  size_t num_mergers = 0;
+  if (remote_processor_nodes_.size() > 1 && data_store_nodes_.size() > kMaxPEMsPerMergerKelvin) {
+    size_t wanted_mergers =
+        (data_store_nodes_.size() + kMaxPEMsPerMergerKelvin - 1) / kMaxPEMsPerMergerKelvin;
+    num_mergers = std::min(wanted_mergers, remote_processor_nodes_.size() - 1);
+    if (num_mergers < 2) {
+      num_mergers = 0;
+    }
+  }
+
+  std::vector<int64_t> merger_node_ids;
+  if (num_mergers > 0) {
+    PL_ASSIGN_OR_RETURN(std::unique_ptr<IR> merger_plan_template,
+                        BuildIntermediateMergerPlan(split_plan->before_blocking.get()));
+    for (size_t i = 0; i < num_mergers; ++i) {
+      PL_ASSIGN_OR_RETURN(int64_t merger_node_id,
+                          distributed_plan->AddCarnot(remote_processor_nodes_[i + 1]));
+      PL_ASSIGN_OR_RETURN(std::unique_ptr<IR> merger_plan_uptr, merger_plan_template->Clone());
+      distributed_plan->Get(merger_node_id)->AddPlan(merger_plan_uptr.get());
+      distributed_plan->AddPlan(std::move(merger_plan_uptr));
+      distributed_plan->AddEdge(merger_node_id, remote_node_id);
+      merger_node_ids.push_back(merger_node_id);
+    }
+  }
+
   std::vector<int64_t> source_node_ids;
   for (const auto& [i, data_store_info] : Enumerate(data_store_nodes_)) {
     PL_ASSIGN_OR_RETURN(int64_t source_node_id, distributed_plan->AddCarnot(data_store_info));
-    distributed_plan->AddEdge(source_node_id, remote_node_id);
+    // With a merger tier, the PEMs are spread round-robin across the mergers; otherwise they
+    // all feed the final Kelvin directly.
+    int64_t parent_node_id =
+        merger_node_ids.empty() ? remote_node_id : merger_node_ids[i % merger_node_ids.size()];
+    distributed_plan->AddEdge(source_node_id, parent_node_id);
     source_node_ids.push_back(source_node_id);
   }
 
@@ -268,6 +380,11 @@ StatusOr<std::unique_ptr<DistributedPlan>> CoordinatorImpl::CoordinateImpl(const
                       GetUniquePEMPlans(split_plan->before_blocking.get(), distributed_plan.get(),
                                         source_node_ids, agent_schema_map));
 
+  if (!merger_node_ids.empty()) {
+    PL_ASSIGN_OR_RETURN(agent_to_plan_map, PartitionPEMPlansByMerger(distributed_plan.get(),
+                                                                     std::move(agent_to_plan_map)));
+  }
+
   // Add the PEM plans to the distributed plan.
   for (const auto carnot_id : source_node_ids) {
     if (!agent_to_plan_map.agent_to_plan_map.contains(carnot_id)) {
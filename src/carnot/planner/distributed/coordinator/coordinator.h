@@ -81,9 +81,20 @@ class Coordinator : public NotCopyable {
 /**
  * @brief This coordinator creates a plan layout with 1 remote processor getting data
  * from N sources. If the passed in plan has special conditions, it will split differntly.
+ * On large clusters with spare Kelvin instances, the N sources are grouped under a tier of
+ * intermediate merger Kelvins instead of all feeding the remote processor directly.
  *
  */
 class CoordinatorImpl : public Coordinator {
+ public:
+  /**
+   * @brief The maximum number of PEMs that should feed a single Kelvin. When the cluster has
+   * more PEMs than this and spare Kelvin instances are available, the coordinator interposes a
+   * tier of intermediate merger Kelvins between the PEMs and the final Kelvin so the final
+   * Kelvin's fan-in stays bounded as the cluster grows.
+   */
+  static constexpr size_t kMaxPEMsPerMergerKelvin = 64;
+
  protected:
   StatusOr<std::unique_ptr<DistributedPlan>> CoordinateImpl(const IR* logical_plan) override;
   Status InitImpl(CompilerState* compiler_state,
@@ -21,9 +21,13 @@
 #include <gtest/gtest.h>
 
 #include <pypa/parser/parser.hh>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <absl/strings/str_format.h>
+#include <absl/strings/str_join.h>
+
 #include "src/carnot/planner/compiler/analyzer/resolve_types_rule.h"
 #include "src/carnot/planner/compiler/test_utils.h"
 #include "src/carnot/planner/distributed/coordinator/coordinator.h"
@@ -169,6 +173,87 @@ TEST_F(CoordinatorTest, one_pem_three_kelvin) {
   }
 }
 
+TEST_F(CoordinatorTest, large_cluster_gets_intermediate_merger_tier) {
+  constexpr size_t kNumPEMs = 2 * CoordinatorImpl::kMaxPEMsPerMergerKelvin + 2;
+  std::vector<std::string> carnot_infos;
+  std::vector<std::string> schema_agent_lists;
+  for (size_t i = 0; i < kNumPEMs; ++i) {
+    std::string agent_id = absl::StrFormat("00000001-0000-0000-0000-%012d", i + 1);
+    carnot_infos.push_back(
+        testutils::MakePEMCarnotInfo(absl::Substitute("pem$0", i), agent_id, 100 + i, {""}));
+    sole::uuid uuid = sole::rebuild(agent_id);
+    schema_agent_lists.push_back(
+        absl::Substitute("agent_list { high_bits: $0 low_bits: $1 }", uuid.ab, uuid.cd));
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    carnot_infos.push_back(testutils::MakeKelvinCarnotInfo(
+        absl::Substitute("kelvin$0", i), absl::StrFormat("00000002-0000-0000-0000-%012d", i + 1),
+        absl::Substitute("111$0", i), 10000 + i));
+  }
+  std::string distributed_state_str =
+      testutils::MakeDistributedState(carnot_infos) +
+      absl::Substitute("\nschema_info { name: \"table\" $0 }",
+                       absl::StrJoin(schema_agent_lists, "\n"));
+  auto ps = LoadDistributedStatePb(distributed_state_str);
+  auto coordinator = Coordinator::Create(compiler_state_.get(), ps).ConsumeValueOrDie();
+
+  MakeGraph();
+  auto physical_plan = coordinator->Coordinate(graph.get()).ConsumeValueOrDie();
+
+  // The final Kelvin, the merger tier, and all of the PEMs.
+  ASSERT_EQ(physical_plan->dag().nodes().size(), kNumPEMs + 4);
+
+  auto kelvin_instance = physical_plan->Get(0);
+  EXPECT_THAT(kelvin_instance->carnot_info().query_broker_address(), ContainsRegex("kelvin"));
+  {
+    SCOPED_TRACE("large cluster -> kelvin plan");
+    VerifyKelvinMergerPlan(kelvin_instance->plan());
+  }
+  auto kelvin_src_groups = kelvin_instance->plan()->FindNodesOfType(IRNodeType::kGRPCSourceGroup);
+  ASSERT_EQ(1, kelvin_src_groups.size());
+  int64_t final_bridge_id = static_cast<GRPCSourceGroupIR*>(kelvin_src_groups[0])->source_id();
+
+  // ceil(130 / 64) == 3 mergers, feeding the final Kelvin.
+  auto merger_ids = physical_plan->dag().ParentsOf(0);
+  ASSERT_EQ(3UL, merger_ids.size());
+  size_t num_pems_across_mergers = 0;
+  int64_t merger_receive_bridge_id = -1;
+  for (int64_t merger_id : merger_ids) {
+    auto merger_instance = physical_plan->Get(merger_id);
+    SCOPED_TRACE("large cluster -> " + merger_instance->carnot_info().query_broker_address());
+    EXPECT_TRUE(merger_instance->carnot_info().accepts_remote_sources());
+
+    auto src_groups = merger_instance->plan()->FindNodesOfType(IRNodeType::kGRPCSourceGroup);
+    ASSERT_EQ(1, src_groups.size());
+    auto merger_src_group = static_cast<GRPCSourceGroupIR*>(src_groups[0]);
+    auto sinks = merger_instance->plan()->FindNodesOfType(IRNodeType::kGRPCSink);
+    ASSERT_EQ(1, sinks.size());
+    auto merger_sink = static_cast<GRPCSinkIR*>(sinks[0]);
+    // The merger forwards on the bridge the final Kelvin expects and receives on a fresh one.
+    EXPECT_EQ(final_bridge_id, merger_sink->destination_id());
+    EXPECT_NE(final_bridge_id, merger_src_group->source_id());
+    merger_receive_bridge_id = merger_src_group->source_id();
+
+    auto merger_pems = physical_plan->dag().ParentsOf(merger_id);
+    EXPECT_GE(merger_pems.size(), 1UL);
+    EXPECT_LE(merger_pems.size(), CoordinatorImpl::kMaxPEMsPerMergerKelvin);
+    num_pems_across_mergers += merger_pems.size();
+    for (int64_t pem_id : merger_pems) {
+      EXPECT_THAT(physical_plan->Get(pem_id)->carnot_info().query_broker_address(),
+                  ContainsRegex("pem"));
+    }
+  }
+  // Every PEM feeds a merger rather than the final Kelvin.
+  EXPECT_EQ(kNumPEMs, num_pems_across_mergers);
+
+  // The PEM plans sink to the merger tier's bridge, not the final Kelvin's.
+  auto pem_instance = physical_plan->Get(4);
+  EXPECT_THAT(pem_instance->carnot_info().query_broker_address(), ContainsRegex("pem"));
+  auto pem_sinks = pem_instance->plan()->FindNodesOfType(IRNodeType::kGRPCSink);
+  ASSERT_EQ(1, pem_sinks.size());
+  EXPECT_EQ(merger_receive_bridge_id, static_cast<GRPCSinkIR*>(pem_sinks[0])->destination_id());
+}
+
 constexpr char kBadAgentSpecificationState[] = R"proto(
 carnot_info {
   query_broker_address: "pem"
@@ -52,13 +52,55 @@ Status StitchPlan(DistributedPlan* distributed_plan) {
   DistributedSetSourceGroupGRPCAddressRule set_grpc_address_rule;
   PL_RETURN_IF_ERROR(set_grpc_address_rule.Apply(remote_carnot));
 
+  // If the coordinator built an intermediate merger tier, the mergers sit between the PEMs and
+  // the final Kelvin in the instance DAG. They are the parents of the final Kelvin that accept
+  // remote sources.
+  std::vector<CarnotInstance*> mergers;
+  for (int64_t parent_id : distributed_plan->dag().ParentsOf(remote_node_id)) {
+    CarnotInstance* parent = distributed_plan->Get(parent_id);
+    if (parent->carnot_info().accepts_remote_sources()) {
+      mergers.push_back(parent);
+      PL_RETURN_IF_ERROR(set_grpc_address_rule.Apply(parent));
+    }
+  }
+
   // Connect the plans.
   for (const auto& [plan, agents] : distributed_plan->plan_to_agent_map()) {
-    PL_ASSIGN_OR_RETURN(auto did_connect_plan, AssociateDistributedPlanEdgesRule::ConnectGraphs(
-                                                   plan, agents, remote_plan));
+    if (mergers.empty()) {
+      PL_ASSIGN_OR_RETURN(auto did_connect_plan, AssociateDistributedPlanEdgesRule::ConnectGraphs(
+                                                     plan, agents, remote_plan));
+      DCHECK(did_connect_plan);
+      continue;
+    }
+    // Each agent bridges to the merger it was assigned in the instance DAG, so connect each
+    // merger to the subset of this plan's agents that feed it.
+    bool did_connect_plan = false;
+    for (CarnotInstance* merger : mergers) {
+      absl::flat_hash_set<int64_t> merger_agents;
+      for (int64_t agent_id : distributed_plan->dag().ParentsOf(merger->id())) {
+        if (agents.contains(agent_id)) {
+          merger_agents.insert(agent_id);
+        }
+      }
+      if (merger_agents.empty()) {
+        continue;
+      }
+      PL_ASSIGN_OR_RETURN(auto did_connect_merger, AssociateDistributedPlanEdgesRule::ConnectGraphs(
+                                                       plan, merger_agents, merger->plan()));
+      did_connect_plan |= did_connect_merger;
+    }
     DCHECK(did_connect_plan);
   }
 
+  // Bridge each merger into the final Kelvin plan, then expand the merger's source groups.
+  for (CarnotInstance* merger : mergers) {
+    PL_ASSIGN_OR_RETURN(auto did_connect_merger, AssociateDistributedPlanEdgesRule::ConnectGraphs(
+                                                     merger->plan(), {merger->id()}, remote_plan));
+    DCHECK(did_connect_merger);
+    GRPCSourceGroupConversionRule merger_conversion_rule;
+    PL_RETURN_IF_ERROR(merger_conversion_rule.Execute(merger->plan()));
+  }
+
   // TODO(philkuz) make this connect to self without a grpc bridge.
   PL_RETURN_IF_ERROR(
       AssociateDistributedPlanEdgesRule::ConnectGraphs(remote_plan, {remote_node_id}, remote_plan));
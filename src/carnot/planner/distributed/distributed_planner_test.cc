@@ -20,13 +20,17 @@
 #include <google/protobuf/text_format.h>
 #include <gtest/gtest.h>
 
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <absl/strings/str_format.h>
+#include <absl/strings/str_join.h>
 #include <pypa/parser/parser.hh>
 
 #include "src/carnot/planner/compiler/analyzer/resolve_types_rule.h"
 #include "src/carnot/planner/compiler/test_utils.h"
+#include "src/carnot/planner/distributed/coordinator/coordinator.h"
 #include "src/carnot/planner/distributed/distributed_planner.h"
 #include "src/carnot/planner/ir/ir.h"
 #include "src/carnot/planner/rules/rules.h"
@@ -213,6 +217,82 @@ TEST_F(DistributedPlannerTest, three_agents_one_kelvin) {
   EXPECT_THAT(grpc_sink_destinations, UnorderedElementsAreArray(grpc_source_ids));
 }
 
+TEST_F(DistributedPlannerTest, large_cluster_stitches_through_merger_tier) {
+  auto mem_src = MakeMemSource(MakeRelation());
+  compiler_state_->relation_map()->emplace("table", MakeRelation());
+  MakeMemSink(mem_src, "out");
+
+  ResolveTypesRule rule(compiler_state_.get());
+  ASSERT_OK(rule.Execute(graph.get()));
+
+  constexpr size_t kNumPEMs = 2 * CoordinatorImpl::kMaxPEMsPerMergerKelvin + 2;
+  std::vector<std::string> carnot_infos;
+  std::vector<std::string> schema_agent_lists;
+  for (size_t i = 0; i < kNumPEMs; ++i) {
+    std::string agent_id = absl::StrFormat("00000001-0000-0000-0000-%012d", i + 1);
+    carnot_infos.push_back(
+        testutils::MakePEMCarnotInfo(absl::Substitute("pem$0", i), agent_id, 100 + i, {""}));
+    sole::uuid uuid = sole::rebuild(agent_id);
+    schema_agent_lists.push_back(
+        absl::Substitute("agent_list { high_bits: $0 low_bits: $1 }", uuid.ab, uuid.cd));
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    carnot_infos.push_back(testutils::MakeKelvinCarnotInfo(
+        absl::Substitute("kelvin$0", i), absl::StrFormat("00000002-0000-0000-0000-%012d", i + 1),
+        absl::Substitute("111$0", i), 10000 + i));
+  }
+  std::string distributed_state_str =
+      testutils::MakeDistributedState(carnot_infos) +
+      absl::Substitute("\nschema_info { name: \"table\" $0 }",
+                       absl::StrJoin(schema_agent_lists, "\n"));
+  distributedpb::DistributedState ps_pb = LoadDistributedStatePb(distributed_state_str);
+
+  std::unique_ptr<DistributedPlanner> physical_planner =
+      DistributedPlanner::Create().ConsumeValueOrDie();
+  std::unique_ptr<DistributedPlan> physical_plan =
+      physical_planner->Plan(ps_pb, compiler_state_.get(), graph.get()).ConsumeValueOrDie();
+
+  auto kelvin_instance = physical_plan->Get(0);
+  EXPECT_THAT(kelvin_instance->carnot_info().query_broker_address(), ContainsRegex("kelvin"));
+  auto merger_ids = physical_plan->dag().ParentsOf(0);
+  ASSERT_EQ(3UL, merger_ids.size());
+
+  // The final Kelvin unions one GRPCSource per merger.
+  std::vector<IRNode*> kelvin_sources =
+      kelvin_instance->plan()->FindNodesOfType(IRNodeType::kGRPCSource);
+  EXPECT_EQ(merger_ids.size(), kelvin_sources.size());
+
+  for (int64_t merger_id : merger_ids) {
+    auto merger_instance = physical_plan->Get(merger_id);
+    SCOPED_TRACE("merger tier -> " + merger_instance->carnot_info().query_broker_address());
+    auto merger_pems = physical_plan->dag().ParentsOf(merger_id);
+
+    // The merger's source group expands to one GRPCSource per PEM feeding it.
+    std::vector<IRNode*> merger_sources =
+        merger_instance->plan()->FindNodesOfType(IRNodeType::kGRPCSource);
+    EXPECT_EQ(merger_pems.size(), merger_sources.size());
+
+    // The merger forwards to the final Kelvin's address.
+    std::vector<IRNode*> merger_sinks =
+        merger_instance->plan()->FindNodesOfType(IRNodeType::kGRPCSink);
+    ASSERT_EQ(1UL, merger_sinks.size());
+    auto merger_sink = static_cast<GRPCSinkIR*>(merger_sinks[0]);
+    EXPECT_EQ(kelvin_instance->carnot_info().grpc_address(), merger_sink->destination_address());
+    EXPECT_TRUE(merger_sink->agent_id_to_destination_id().contains(merger_id));
+
+    // The PEMs feeding this merger send to the merger's address, with a per-PEM destination.
+    for (int64_t pem_id : merger_pems) {
+      auto pem_instance = physical_plan->Get(pem_id);
+      std::vector<IRNode*> pem_sinks =
+          pem_instance->plan()->FindNodesOfType(IRNodeType::kGRPCSink);
+      ASSERT_EQ(1UL, pem_sinks.size());
+      auto pem_sink = static_cast<GRPCSinkIR*>(pem_sinks[0]);
+      EXPECT_EQ(merger_instance->carnot_info().grpc_address(), pem_sink->destination_address());
+      EXPECT_TRUE(pem_sink->agent_id_to_destination_id().contains(pem_id));
+    }
+  }
+}
+
 using DistributedPlannerUDTFTests = DistributedRulesTest;
 TEST_F(DistributedPlannerUDTFTests, UDTFOnlyOnPEMsDoesntRunOnKelvin) {
   uint32_t asid = 123;
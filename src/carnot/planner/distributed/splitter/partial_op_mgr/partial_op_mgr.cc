@@ -44,6 +44,40 @@ StatusOr<OperatorIR*> LimitOperatorMgr::CreateMergeOperator(IR* plan, OperatorIR
   return new_limit;
 }
 
+StatusOr<OperatorIR*> TopNOperatorMgr::CreatePrepareOperator(IR* plan, OperatorIR* op) const {
+  DCHECK(Matches(op));
+  TopNIR* topn = static_cast<TopNIR*>(op);
+  PL_ASSIGN_OR_RETURN(TopNIR * new_topn, plan->CopyNode(topn));
+  PL_RETURN_IF_ERROR(new_topn->CopyParentsFrom(topn));
+  return new_topn;
+}
+
+StatusOr<OperatorIR*> TopNOperatorMgr::CreateMergeOperator(IR* plan, OperatorIR* new_parent,
+                                                           OperatorIR* op) const {
+  DCHECK(Matches(op));
+  TopNIR* topn = static_cast<TopNIR*>(op);
+  PL_ASSIGN_OR_RETURN(TopNIR * new_topn, plan->CopyNode(topn));
+  PL_RETURN_IF_ERROR(new_topn->AddParent(new_parent));
+  return new_topn;
+}
+
+StatusOr<OperatorIR*> SampleOperatorMgr::CreatePrepareOperator(IR* plan, OperatorIR* op) const {
+  DCHECK(Matches(op));
+  SampleIR* sample = static_cast<SampleIR*>(op);
+  PL_ASSIGN_OR_RETURN(SampleIR * new_sample, plan->CopyNode(sample));
+  PL_RETURN_IF_ERROR(new_sample->CopyParentsFrom(sample));
+  return new_sample;
+}
+
+StatusOr<OperatorIR*> SampleOperatorMgr::CreateMergeOperator(IR* plan, OperatorIR* new_parent,
+                                                             OperatorIR* op) const {
+  DCHECK(Matches(op));
+  SampleIR* sample = static_cast<SampleIR*>(op);
+  PL_ASSIGN_OR_RETURN(SampleIR * new_sample, plan->CopyNode(sample));
+  PL_RETURN_IF_ERROR(new_sample->AddParent(new_parent));
+  return new_sample;
+}
+
 StatusOr<OperatorIR*> AggOperatorMgr::CreatePrepareOperator(IR* plan, OperatorIR* op) const {
   DCHECK(Matches(op));
   BlockingAggIR* agg = static_cast<BlockingAggIR*>(op);
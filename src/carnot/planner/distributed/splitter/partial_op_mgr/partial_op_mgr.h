@@ -87,6 +87,34 @@ class LimitOperatorMgr : public PartialOperatorMgr {
                                             OperatorIR* op) const override;
 };
 
+/**
+ * @brief TopNOperatorMgr manages splitting TopN over the boundary. As with limits, the Prepare
+ * TopN is the same operator as the Merge TopN: each source keeps its local top rows, so only
+ * `limit` rows per source cross the network instead of the whole table.
+ */
+class TopNOperatorMgr : public PartialOperatorMgr {
+ public:
+  bool Matches(OperatorIR* op) const override { return Match(op, TopN()); }
+  StatusOr<OperatorIR*> CreatePrepareOperator(IR* plan, OperatorIR* op) const override;
+  StatusOr<OperatorIR*> CreateMergeOperator(IR* plan, OperatorIR* new_parent,
+                                            OperatorIR* op) const override;
+};
+
+/**
+ * @brief SampleOperatorMgr manages splitting Sample over the boundary. The Prepare Sample is the
+ * same operator as the Merge Sample: each source samples its local rows, so only `num_rows` rows
+ * per source (per group when stratified) cross the network. Resampling the merged reservoirs
+ * slightly biases the uniform mode toward low-volume sources, which is acceptable for the
+ * exploratory use case.
+ */
+class SampleOperatorMgr : public PartialOperatorMgr {
+ public:
+  bool Matches(OperatorIR* op) const override { return Match(op, Sample()); }
+  StatusOr<OperatorIR*> CreatePrepareOperator(IR* plan, OperatorIR* op) const override;
+  StatusOr<OperatorIR*> CreateMergeOperator(IR* plan, OperatorIR* new_parent,
+                                            OperatorIR* op) const override;
+};
+
 /**
  * @brief AggOperatorMgr manages splitting aggregates into partial aggregate and the merging node
  * over a network boundary.
@@ -124,6 +124,8 @@ class Splitter : public NotCopyable {
       partial_operator_mgrs_.push_back(std::make_unique<AggOperatorMgr>());
     }
     partial_operator_mgrs_.push_back(std::make_unique<LimitOperatorMgr>());
+    partial_operator_mgrs_.push_back(std::make_unique<TopNOperatorMgr>());
+    partial_operator_mgrs_.push_back(std::make_unique<SampleOperatorMgr>());
     return Status::OK();
   }
   /**
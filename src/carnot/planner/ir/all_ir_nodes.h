@@ -44,10 +44,12 @@
 #include "src/carnot/planner/ir/operator_ir.h"
 #include "src/carnot/planner/ir/otel_export_sink_ir.h"
 #include "src/carnot/planner/ir/rolling_ir.h"
+#include "src/carnot/planner/ir/sample_ir.h"
 #include "src/carnot/planner/ir/stream_ir.h"
 #include "src/carnot/planner/ir/string_ir.h"
 #include "src/carnot/planner/ir/tablet_source_group_ir.h"
 #include "src/carnot/planner/ir/time_ir.h"
+#include "src/carnot/planner/ir/top_n_ir.h"
 #include "src/carnot/planner/ir/udtf_source_ir.h"
 #include "src/carnot/planner/ir/uint128_ir.h"
 #include "src/carnot/planner/ir/union_ir.h"
@@ -43,8 +43,6 @@ class ExpressionIR : public IRNode {
  public:
   ExpressionIR() = delete;
 
-  bool IsOperator() const override { return false; }
-  bool IsExpression() const override { return true; }
   virtual types::DataType EvaluatedDataType() const = 0;
   virtual bool IsDataTypeEvaluated() const = 0;
   virtual bool IsColumn() const { return false; }
@@ -39,6 +39,7 @@
 #include "src/carnot/planner/types/types.h"
 #include "src/carnot/udfspb/udfs.pb.h"
 #include "src/common/base/base.h"
+#include "src/common/memory/arena.h"
 #include "src/shared/metadatapb/metadata.pb.h"
 #include "src/shared/types/column_wrapper.h"
 #include "src/shared/types/types.h"
@@ -77,15 +78,17 @@ class IR {
   template <typename TOperator>
   StatusOr<TOperator*> MakeNode(int64_t id, const pypa::AstPtr& ast) {
     id_node_counter = std::max(id + 1, id_node_counter);
-    auto node = std::make_unique<TOperator>(id);
+    // Nodes are bump-allocated from the graph's arena: a compilation churns through many
+    // small nodes (and distributed planning clones whole graphs per agent), so individual
+    // mallocs show up. The map's deleter runs the destructor; the arena reclaims the memory.
+    TOperator* node = arena_.Create<TOperator>(id);
     dag_.AddNode(node->id());
     node->set_graph(this);
     if (ast != nullptr) {
       node->SetLineCol(ast);
     }
-    TOperator* raw = node.get();
-    id_node_map_.emplace(node->id(), std::move(node));
-    return raw;
+    id_node_map_.emplace(node->id(), IRNodePtr(node));
+    return node;
   }
   StatusOr<IRNode*> MakeNodeWithType(IRNodeType node_type, int64_t new_node_id);
 
@@ -267,6 +270,9 @@ class IR {
   // Helper function for Clone and CopySelectedOperators.
   Status CopySelectedNodesAndDeps(const IR* src, const absl::flat_hash_set<int64_t>& selected_ids);
 
+  // Backing storage for all IRNodes in this graph. Declared before id_node_map_ so it is
+  // destroyed after the map's deleters have run the node destructors.
+  Arena arena_;
   plan::DAG dag_;
   std::unordered_map<int64_t, IRNodePtr> id_node_map_;
   int64_t id_node_counter = 0;
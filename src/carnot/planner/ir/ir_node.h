@@ -36,7 +36,16 @@ namespace planner {
 
 class IR;
 class IRNode;
-using IRNodePtr = std::unique_ptr<IRNode>;
+
+/**
+ * Deleter for IRNodes, which are allocated from their IR graph's arena: it runs the node's
+ * destructor but leaves the memory to the arena, which frees it wholesale when the graph is
+ * destroyed.
+ */
+struct IRNodeDeleter {
+  inline void operator()(IRNode* node) const;
+};
+using IRNodePtr = std::unique_ptr<IRNode, IRNodeDeleter>;
 
 enum class IRNodeType {
   kAny = -1,
@@ -56,6 +65,38 @@ static constexpr const char* kIRNodeStrings[] = {
 #undef PL_IR_NODE
 };
 
+/**
+ * Compile-time classification of IRNodeTypes into the operator and expression categories,
+ * built from the same .inl lists that define the enum. Category checks on hot paths (notably
+ * pattern matching, which runs per node per rule per fixpoint iteration) compile down to a
+ * switch on type() instead of a virtual call.
+ */
+constexpr bool IsOperatorIRNodeType(IRNodeType type) {
+  switch (type) {
+#undef PL_IR_NODE
+#define PL_IR_NODE(NAME) case IRNodeType::k##NAME:
+// NOLINTNEXTLINE : build/include
+#include "src/carnot/planner/ir/operators.inl"
+#undef PL_IR_NODE
+    return true;
+    default:
+      return false;
+  }
+}
+
+constexpr bool IsExpressionIRNodeType(IRNodeType type) {
+  switch (type) {
+#undef PL_IR_NODE
+#define PL_IR_NODE(NAME) case IRNodeType::k##NAME:
+// NOLINTNEXTLINE : build/include
+#include "src/carnot/planner/ir/expressions.inl"
+#undef PL_IR_NODE
+    return true;
+    default:
+      return false;
+  }
+}
+
 StatusOr<px::types::DataType> IRNodeTypeToDataType(IRNodeType type);
 StatusOr<IRNodeType> DataTypeToIRNodeType(types::DataType type);
 
@@ -79,8 +120,8 @@ class IRNode {
   bool line_col_set() const { return line_col_set_; }
 
   virtual std::string DebugString() const;
-  virtual bool IsOperator() const = 0;
-  virtual bool IsExpression() const = 0;
+  bool IsOperator() const { return IsOperatorIRNodeType(type_); }
+  bool IsExpression() const { return IsExpressionIRNodeType(type_); }
 
   IRNodeType type() const { return type_; }
   std::string type_string() const { return TypeString(type()); }
@@ -183,6 +224,12 @@ class IRNode {
   TypePtr resolved_type_;
 };
 
+inline void IRNodeDeleter::operator()(IRNode* node) const {
+  if (node != nullptr) {
+    node->~IRNode();
+  }
+}
+
 inline std::ostream& operator<<(std::ostream& out, IRNode* node) {
   return out << node->DebugString();
 }
@@ -1575,6 +1575,30 @@ TEST_F(ToProtoTests, full_outer) {
   EXPECT_THAT(pb, EqualsProto(absl::Substitute(kExpectedJoinOpPb, "FULL_OUTER")));
 }
 
+TEST_F(ToProtoTests, join_sorted_inputs_on_time) {
+  Relation relation0({types::DataType::TIME64NS, types::DataType::INT64}, {"time_", "col1"});
+  auto mem_src1 = MakeMemSource("source0", relation0);
+  compiler_state_->relation_map()->emplace("source0", relation0);
+
+  Relation relation1({types::DataType::TIME64NS, types::DataType::INT64}, {"time_", "col2"});
+  auto mem_src2 = MakeMemSource("source1", relation1);
+  compiler_state_->relation_map()->emplace("source1", relation1);
+
+  auto join_op = MakeJoin({mem_src1, mem_src2}, "inner", relation0, relation1,
+                          std::vector<std::string>{"time_"}, std::vector<std::string>{"time_"},
+                          {"", "_right"});
+
+  ResolveTypesRule type_rule(compiler_state_.get());
+  ASSERT_OK(type_rule.Execute(graph.get()));
+
+  planpb::Operator pb;
+  EXPECT_OK(join_op->ToProto(&pb));
+
+  // Both inputs come straight from memory sources, which emit in time order, and the join key
+  // is time_ on both sides, so the join can run as a streaming sort-merge join.
+  EXPECT_TRUE(pb.join_op().sorted_inputs());
+}
+
 TEST_F(ToProtoTests, join_wrong_join_type) {
   Relation relation0({types::DataType::INT64, types::DataType::INT64, types::DataType::INT64,
                       types::DataType::INT64},
@@ -21,11 +21,53 @@
 #include "src/carnot/planner/ir/column_ir.h"
 #include "src/carnot/planner/ir/ir.h"
 #include "src/carnot/planner/ir/join_ir.h"
+#include "src/carnot/planner/ir/map_ir.h"
+#include "src/carnot/planner/ir/pattern_match.h"
 
 namespace px {
 namespace carnot {
 namespace planner {
 
+namespace {
+
+constexpr char kTimeColumnName[] = "time_";
+
+// Whether this operator's output is sorted ascending by its time_ column. Memory sources emit
+// table data in time order, and row-wise operators (filter, limit, and maps that pass time_
+// through untouched) preserve it. Anything else (aggregates, joins, unions, ...) is treated as
+// order-destroying, so this errs on the side of false.
+bool PreservesSourceTimeOrder(const OperatorIR* op) {
+  if (Match(op, MemorySource())) {
+    return true;
+  }
+  if (Match(op, Filter()) || Match(op, Limit())) {
+    return op->parents().size() == 1 && PreservesSourceTimeOrder(op->parents()[0]);
+  }
+  if (Match(op, Map())) {
+    if (op->parents().size() != 1) {
+      return false;
+    }
+    // The map must carry time_ over from its input unchanged; an expression that computes a new
+    // time_ can produce values in any order.
+    const auto* map = static_cast<const MapIR*>(op);
+    for (const auto& col_expr : map->col_exprs()) {
+      if (col_expr.name != kTimeColumnName) {
+        continue;
+      }
+      if (!Match(col_expr.node, ColumnNode())) {
+        return false;
+      }
+      if (static_cast<ColumnIR*>(col_expr.node)->col_name() != kTimeColumnName) {
+        return false;
+      }
+    }
+    return PreservesSourceTimeOrder(op->parents()[0]);
+  }
+  return false;
+}
+
+}  // namespace
+
 Status JoinIR::CopyFromNodeImpl(const IRNode* node,
                                 absl::flat_hash_map<const IRNode*, IRNode*>* copied_nodes_map) {
   const JoinIR* join_node = static_cast<const JoinIR*>(node);
@@ -99,6 +141,15 @@ Status JoinIR::ToProto(planpb::Operator* op) const {
     eq_condition->set_right_column_index(right_index);
   }
 
+  // A single-key join on both inputs' time_ columns can run as a streaming sort-merge join when
+  // both inputs still carry their source's time order, as span-correlation queries do.
+  if (left_on_columns_.size() == 1 && parents().size() == 2 &&
+      left_on_columns_[0]->col_name() == kTimeColumnName &&
+      right_on_columns_[0]->col_name() == kTimeColumnName &&
+      PreservesSourceTimeOrder(parents()[0]) && PreservesSourceTimeOrder(parents()[1])) {
+    pb->set_sorted_inputs(true);
+  }
+
   for (ColumnIR* col : output_columns_) {
     auto* parent_col = pb->add_output_columns();
     int64_t parent_idx = col->container_op_parent_idx();
@@ -51,8 +51,6 @@ class ColumnIR;
 class OperatorIR : public IRNode {
  public:
   OperatorIR() = delete;
-  bool IsOperator() const override { return true; }
-  bool IsExpression() const override { return false; }
   bool HasParents() const { return parents_.size() != 0; }
   bool IsChildOf(OperatorIR* parent) {
     return std::find(parents_.begin(), parents_.end(), parent) != parents_.end();
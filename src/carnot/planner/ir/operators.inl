@@ -37,5 +37,7 @@ PL_IR_NODE(Rolling)
 PL_IR_NODE(Stream)
 PL_IR_NODE(EmptySource)
 PL_IR_NODE(OTelExportSink)
+PL_IR_NODE(TopN)
+PL_IR_NODE(Sample)
 
 #endif
@@ -58,6 +58,7 @@
 #pragma once
 #include <limits>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include "src/carnot/planner/ir/blocking_agg_ir.h"
@@ -159,6 +160,10 @@ inline ClassMatch<IRNodeType::kEmptySource> EmptySource() {
 }
 inline ClassMatch<IRNodeType::kLimit> Limit() { return ClassMatch<IRNodeType::kLimit>(); }
 
+inline ClassMatch<IRNodeType::kTopN> TopN() { return ClassMatch<IRNodeType::kTopN>(); }
+
+inline ClassMatch<IRNodeType::kSample> Sample() { return ClassMatch<IRNodeType::kSample>(); }
+
 inline ClassMatch<IRNodeType::kGRPCSource> GRPCSource() {
   return ClassMatch<IRNodeType::kGRPCSource>();
 }
@@ -189,13 +194,20 @@ struct Source : public ParentMatch {
   Source() : ParentMatch(IRNodeType::kAny) {}
 
   bool Match(const IRNode* node) const override {
-    return GRPCSource().Match(node) || MemorySource().Match(node) || UDTFSource().Match(node);
+    switch (node->type()) {
+      case IRNodeType::kGRPCSource:
+      case IRNodeType::kMemorySource:
+      case IRNodeType::kUDTFSource:
+        return true;
+      default:
+        return false;
+    }
   }
 };
 
 struct MemorySourceTableMatcher : public ParentMatch {
   explicit MemorySourceTableMatcher(std::string_view table_name)
-      : ParentMatch(IRNodeType::kMemorySource), table_name_(std::string(table_name)) {}
+      : ParentMatch(IRNodeType::kMemorySource), table_name_(table_name) {}
   bool Match(const IRNode* node) const override {
     if (!MemorySource().Match(node)) {
       return false;
@@ -204,7 +216,9 @@ struct MemorySourceTableMatcher : public ParentMatch {
     return mem_src->table_name() == table_name_;
   }
 
-  std::string table_name_;
+  // Matchers are built inline inside Match() expressions, so a view of the caller's string is
+  // enough and avoids an allocation per match call.
+  std::string_view table_name_;
 };
 
 inline MemorySourceTableMatcher MemorySource(std::string_view table_name) {
@@ -216,7 +230,13 @@ struct Sink : public ParentMatch {
   Sink() : ParentMatch(IRNodeType::kAny) {}
 
   bool Match(const IRNode* node) const override {
-    return GRPCSink().Match(node) || MemorySink().Match(node);
+    switch (node->type()) {
+      case IRNodeType::kGRPCSink:
+      case IRNodeType::kMemorySink:
+        return true;
+      default:
+        return false;
+    }
   }
 };
 
@@ -259,8 +279,15 @@ struct ResultSink : public ParentMatch {
   ResultSink() : ParentMatch(IRNodeType::kAny) {}
 
   bool Match(const IRNode* node) const override {
-    return ExternalGRPCSink().Match(node) || MemorySink().Match(node) ||
-           OTelExportSink().Match(node);
+    switch (node->type()) {
+      case IRNodeType::kGRPCSink:
+        return static_cast<const GRPCSinkIR*>(node)->has_output_table();
+      case IRNodeType::kMemorySink:
+      case IRNodeType::kOTelExportSink:
+        return true;
+      default:
+        return false;
+    }
   }
 };
 
@@ -285,17 +312,16 @@ struct IntMatch : public ParentMatch {
  * @brief Match a specific string value.
  */
 struct StringMatch : public ParentMatch {
-  explicit StringMatch(const std::string s) : ParentMatch(IRNodeType::kString), val(s) {}
+  explicit StringMatch(std::string_view s) : ParentMatch(IRNodeType::kString), val(s) {}
 
   bool Match(const IRNode* node) const override {
     if (node->type() == type) {
-      auto node_val = static_cast<const StringIR*>(node)->str();
-      return node_val == val;
+      return static_cast<const StringIR*>(node)->str() == val;
     }
     return false;
   }
 
-  const std::string val;
+  const std::string_view val;
 };
 
 struct FloatMatch : public ParentMatch {
@@ -333,7 +359,7 @@ inline IntMatch Int(const int64_t val) { return IntMatch(val); }
 /**
  * @brief Match a specific integer value.
  */
-inline StringMatch String(const std::string val) { return StringMatch(val); }
+inline StringMatch String(std::string_view val) { return StringMatch(val); }
 
 /**
  * @brief Match a specific integer value.
@@ -629,7 +655,7 @@ struct AnyFuncAllArgsMatch : public ParentMatch {
 };
 
 struct FuncNameMatch : public ParentMatch {
-  explicit FuncNameMatch(const std::string& name) : ParentMatch(IRNodeType::kFunc), name_(name) {}
+  explicit FuncNameMatch(std::string_view name) : ParentMatch(IRNodeType::kFunc), name_(name) {}
 
   bool Match(const IRNode* node) const override {
     if (!Func().Match(node)) {
@@ -639,14 +665,14 @@ struct FuncNameMatch : public ParentMatch {
     return func->func_name() == name_;
   }
 
-  std::string name_;
+  std::string_view name_;
 };
 
-inline FuncNameMatch Func(const std::string& name) { return FuncNameMatch(name); }
+inline FuncNameMatch Func(std::string_view name) { return FuncNameMatch(name); }
 
 template <typename Arg_t>
 struct FuncNameAllArgsMatch : public ParentMatch {
-  FuncNameAllArgsMatch(const std::string& name, const Arg_t& argMatcher)
+  FuncNameAllArgsMatch(std::string_view name, const Arg_t& argMatcher)
       : ParentMatch(IRNodeType::kFunc), name_(name), argMatcher_(argMatcher) {}
 
   bool Match(const IRNode* node) const override {
@@ -662,12 +688,12 @@ struct FuncNameAllArgsMatch : public ParentMatch {
     return true;
   }
 
-  std::string name_;
+  std::string_view name_;
   Arg_t argMatcher_;
 };
 
 template <typename Arg_t>
-inline FuncNameAllArgsMatch<Arg_t> Func(const std::string& name, const Arg_t& argMatcher) {
+inline FuncNameAllArgsMatch<Arg_t> Func(std::string_view name, const Arg_t& argMatcher) {
   return FuncNameAllArgsMatch<Arg_t>(name, argMatcher);
 }
 
@@ -1012,9 +1038,6 @@ struct JoinMatch : public ParentMatch {
     auto join = static_cast<const JoinIR*>(node);
     return join->join_type() == Type;
   }
-
- private:
-  std::string join_type_;
 };
 
 inline JoinMatch<JoinIR::JoinType::kRight> RightJoin() {
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/planner/ir/sample_ir.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+
+Status SampleIR::Init(OperatorIR* parent, int64_t num_rows,
+                      const std::vector<std::string>& group_column_names) {
+  PL_RETURN_IF_ERROR(AddParent(parent));
+  if (num_rows <= 0) {
+    return CreateIRNodeError("Sample must keep at least one row.");
+  }
+  num_rows_ = num_rows;
+  group_column_names_ = group_column_names;
+  return Status::OK();
+}
+
+StatusOr<std::vector<absl::flat_hash_set<std::string>>> SampleIR::RequiredInputColumns() const {
+  DCHECK(is_type_resolved());
+  return std::vector<absl::flat_hash_set<std::string>>{
+      {resolved_table_type()->ColumnNames().begin(), resolved_table_type()->ColumnNames().end()}};
+}
+
+Status SampleIR::ToProto(planpb::Operator* op) const {
+  auto pb = op->mutable_sample_op();
+  op->set_op_type(planpb::SAMPLE_OPERATOR);
+  DCHECK_EQ(parents().size(), 1UL);
+
+  DCHECK(parents()[0]->is_type_resolved());
+  auto parent_table_type = parents()[0]->resolved_table_type();
+  auto parent_id = parents()[0]->id();
+
+  DCHECK(is_type_resolved());
+  for (const std::string& col_name : resolved_table_type()->ColumnNames()) {
+    planpb::Column* col_pb = pb->add_columns();
+    col_pb->set_node(parent_id);
+    DCHECK(parent_table_type->HasColumn(col_name));
+    col_pb->set_index(parent_table_type->GetColumnIndex(col_name));
+  }
+
+  for (const std::string& col_name : group_column_names_) {
+    if (!parent_table_type->HasColumn(col_name)) {
+      return CreateIRNodeError("Sample group column '$0' is missing from the parent relation.",
+                               col_name);
+    }
+    pb->add_group_indices(parent_table_type->GetColumnIndex(col_name));
+  }
+
+  pb->set_num_rows(num_rows_);
+  return Status::OK();
+}
+
+Status SampleIR::CopyFromNodeImpl(const IRNode* node,
+                                  absl::flat_hash_map<const IRNode*, IRNode*>*) {
+  const SampleIR* sample = static_cast<const SampleIR*>(node);
+  num_rows_ = sample->num_rows_;
+  group_column_names_ = sample->group_column_names_;
+  return Status::OK();
+}
+
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/carnot/planner/compiler_state/compiler_state.h"
+#include "src/carnot/planner/ir/operator_ir.h"
+#include "src/carnot/planner/types/types.h"
+#include "src/carnot/udfspb/udfs.pb.h"
+#include "src/common/base/base.h"
+#include "src/shared/types/types.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+
+/**
+ * @brief SampleIR keeps a bounded uniform random sample of its input rows; with group columns it
+ * keeps one reservoir per distinct group (stratified sampling). It maps to the Sample exec
+ * operator, and the distributed planner can split it so each data source samples locally before
+ * transfer and only sampled rows cross the network.
+ */
+class SampleIR : public OperatorIR {
+ public:
+  SampleIR() = delete;
+  explicit SampleIR(int64_t id) : OperatorIR(id, IRNodeType::kSample) {}
+
+  Status Init(OperatorIR* parent, int64_t num_rows,
+              const std::vector<std::string>& group_column_names);
+
+  Status ToProto(planpb::Operator*) const override;
+  int64_t num_rows() const { return num_rows_; }
+  const std::vector<std::string>& group_column_names() const { return group_column_names_; }
+
+  Status CopyFromNodeImpl(const IRNode* node,
+                          absl::flat_hash_map<const IRNode*, IRNode*>* copied_nodes_map) override;
+  inline bool IsBlocking() const override { return true; }
+
+  StatusOr<std::vector<absl::flat_hash_set<std::string>>> RequiredInputColumns() const override;
+
+ protected:
+  StatusOr<absl::flat_hash_set<std::string>> PruneOutputColumnsToImpl(
+      const absl::flat_hash_set<std::string>& output_cols) override {
+    // The group columns must survive pruning, since the operator stratifies by them.
+    absl::flat_hash_set<std::string> required = output_cols;
+    required.insert(group_column_names_.begin(), group_column_names_.end());
+    return required;
+  }
+
+ private:
+  int64_t num_rows_ = 0;
+  std::vector<std::string> group_column_names_;
+};
+
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
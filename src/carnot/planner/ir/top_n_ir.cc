@@ -0,0 +1,89 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/planner/ir/top_n_ir.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+
+Status TopNIR::Init(OperatorIR* parent, int64_t limit_value,
+                    const std::vector<std::string>& sort_column_names,
+                    const std::vector<bool>& ascending) {
+  PL_RETURN_IF_ERROR(AddParent(parent));
+  if (sort_column_names.empty()) {
+    return CreateIRNodeError("TopN must have at least one sort column.");
+  }
+  if (sort_column_names.size() != ascending.size()) {
+    return CreateIRNodeError("TopN must have a sort direction for every sort column.");
+  }
+  limit_value_ = limit_value;
+  sort_column_names_ = sort_column_names;
+  ascending_ = ascending;
+  return Status::OK();
+}
+
+StatusOr<std::vector<absl::flat_hash_set<std::string>>> TopNIR::RequiredInputColumns() const {
+  DCHECK(is_type_resolved());
+  return std::vector<absl::flat_hash_set<std::string>>{
+      {resolved_table_type()->ColumnNames().begin(), resolved_table_type()->ColumnNames().end()}};
+}
+
+Status TopNIR::ToProto(planpb::Operator* op) const {
+  auto pb = op->mutable_topn_op();
+  op->set_op_type(planpb::TOPN_OPERATOR);
+  DCHECK_EQ(parents().size(), 1UL);
+
+  DCHECK(parents()[0]->is_type_resolved());
+  auto parent_table_type = parents()[0]->resolved_table_type();
+  auto parent_id = parents()[0]->id();
+
+  DCHECK(is_type_resolved());
+  for (const std::string& col_name : resolved_table_type()->ColumnNames()) {
+    planpb::Column* col_pb = pb->add_columns();
+    col_pb->set_node(parent_id);
+    DCHECK(parent_table_type->HasColumn(col_name));
+    col_pb->set_index(parent_table_type->GetColumnIndex(col_name));
+  }
+
+  for (size_t i = 0; i < sort_column_names_.size(); ++i) {
+    const std::string& col_name = sort_column_names_[i];
+    if (!parent_table_type->HasColumn(col_name)) {
+      return CreateIRNodeError("TopN sort column '$0' is missing from the parent relation.",
+                               col_name);
+    }
+    auto* key_pb = pb->add_sort_keys();
+    key_pb->set_column_index(parent_table_type->GetColumnIndex(col_name));
+    key_pb->set_ascending(ascending_[i]);
+  }
+
+  pb->set_limit(limit_value_);
+  return Status::OK();
+}
+
+Status TopNIR::CopyFromNodeImpl(const IRNode* node, absl::flat_hash_map<const IRNode*, IRNode*>*) {
+  const TopNIR* topn = static_cast<const TopNIR*>(node);
+  limit_value_ = topn->limit_value_;
+  sort_column_names_ = topn->sort_column_names_;
+  ascending_ = topn->ascending_;
+  return Status::OK();
+}
+
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
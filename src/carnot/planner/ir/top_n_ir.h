@@ -0,0 +1,80 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/carnot/planner/compiler_state/compiler_state.h"
+#include "src/carnot/planner/ir/operator_ir.h"
+#include "src/carnot/planner/types/types.h"
+#include "src/carnot/udfspb/udfs.pb.h"
+#include "src/common/base/base.h"
+#include "src/shared/types/types.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+
+/**
+ * @brief TopNIR keeps the first `limit` rows of its input as ordered by the sort columns.
+ * It maps to the TopN exec operator, which only ever buffers `limit` rows, and it can be
+ * split by the distributed planner into a partial TopN on the data source and a merging
+ * TopN after the network boundary.
+ */
+class TopNIR : public OperatorIR {
+ public:
+  TopNIR() = delete;
+  explicit TopNIR(int64_t id) : OperatorIR(id, IRNodeType::kTopN) {}
+
+  Status Init(OperatorIR* parent, int64_t limit_value,
+              const std::vector<std::string>& sort_column_names,
+              const std::vector<bool>& ascending);
+
+  Status ToProto(planpb::Operator*) const override;
+  int64_t limit_value() const { return limit_value_; }
+  const std::vector<std::string>& sort_column_names() const { return sort_column_names_; }
+  const std::vector<bool>& ascending() const { return ascending_; }
+
+  Status CopyFromNodeImpl(const IRNode* node,
+                          absl::flat_hash_map<const IRNode*, IRNode*>* copied_nodes_map) override;
+  inline bool IsBlocking() const override { return true; }
+
+  StatusOr<std::vector<absl::flat_hash_set<std::string>>> RequiredInputColumns() const override;
+
+ protected:
+  StatusOr<absl::flat_hash_set<std::string>> PruneOutputColumnsToImpl(
+      const absl::flat_hash_set<std::string>& output_cols) override {
+    // The sort columns must survive pruning, since the operator orders by them.
+    absl::flat_hash_set<std::string> required = output_cols;
+    required.insert(sort_column_names_.begin(), sort_column_names_.end());
+    return required;
+  }
+
+ private:
+  int64_t limit_value_ = 0;
+  std::vector<std::string> sort_column_names_;
+  std::vector<bool> ascending_;
+};
+
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/str_format.h>
+#include <absl/strings/substitute.h>
+
+#include "src/carnot/planner/logical_planner.h"
+#include "src/carnot/planner/test_utils.h"
+#include "src/carnot/udf_exporter/udf_exporter.h"
+#include "src/common/perf/memory_tracker.h"
+#include "src/common/perf/perf.h"
+#include "src/common/testing/test_environment.h"
+#include "src/common/testing/testing.h"
+#include "src/stirling/stirling.h"
+#include "src/table_store/schema/schema.h"
+
+namespace px {
+namespace carnot {
+namespace planner {
+namespace logical_planner {
+
+// The bundled script library, pulled in as runfiles via //src/pxl_scripts:preset_queries.
+constexpr char kScriptDir[] = "src/pxl_scripts";
+
+struct ScriptCase {
+  std::string name;
+  std::string query;
+};
+
+// Loads the self-contained scripts from the bundled library: those with a top-level px.display
+// call. The remaining scripts are vis-driven — their entry points and argument values come from
+// vis.json, which the query broker (Go) translates into exec funcs, so they cannot be compiled
+// standalone here.
+std::vector<ScriptCase> LoadScriptCorpus() {
+  std::vector<ScriptCase> corpus;
+  auto script_dir = ::px::testing::BazelRunfilePath(kScriptDir);
+  for (const auto& entry : std::filesystem::recursive_directory_iterator(script_dir)) {
+    if (entry.path().extension() != ".pxl") {
+      continue;
+    }
+    std::ifstream f(entry.path());
+    std::stringstream contents;
+    contents << f.rdbuf();
+    std::string query = contents.str();
+    if (query.find("px.display") == std::string::npos) {
+      continue;
+    }
+    std::string name = std::filesystem::relative(entry.path().parent_path(), script_dir).string();
+    corpus.push_back(ScriptCase{std::move(name), std::move(query)});
+  }
+  // Directory iteration order is unspecified; sort so benchmark names are stable across runs.
+  std::sort(corpus.begin(), corpus.end(),
+            [](const ScriptCase& a, const ScriptCase& b) { return a.name < b.name; });
+  return corpus;
+}
+
+// Builds the production table schemas by reflecting over the Stirling source registry, the same
+// way e2e_test/vizier/planner/dump_schemas does. The bundled scripts reference tables
+// (http_events, process_stats, ...) that the test_utils schema strings don't cover.
+table_store::schemapb::Schema ProdSchema() {
+  auto source_registry = stirling::CreateProdSourceRegistry();
+  absl::flat_hash_map<std::string, table_store::schema::Relation> rel_map;
+  for (const auto& reg_element : source_registry->sources()) {
+    for (const auto& schema : reg_element.schema) {
+      table_store::schema::Relation relation;
+      for (const auto& element : schema.elements()) {
+        relation.AddColumn(element.type(), std::string(element.name()), element.stype(),
+                           element.desc());
+      }
+      rel_map[schema.name()] = relation;
+    }
+  }
+  table_store::schemapb::Schema schema_pb;
+  PL_CHECK_OK(table_store::schema::Schema::ToProto(&schema_pb, rel_map));
+  return schema_pb;
+}
+
+// Builds a planner state simulating a cluster with `num_pems` data nodes. Kelvins are scaled at
+// roughly one per hundred PEMs so that the larger topologies exercise the same multi-Kelvin
+// stitching (including the intermediate merger tier) that a production deployment of that size
+// would.
+distributedpb::LogicalPlannerState MakePlannerState(int num_pems) {
+  std::vector<std::string> carnot_infos;
+  for (int i = 0; i < num_pems; ++i) {
+    std::string uuid = absl::StrFormat("00000001-0000-0000-0000-%012d", i + 1);
+    carnot_infos.push_back(
+        testutils::MakePEMCarnotInfo(absl::Substitute("pem$0", i + 1), uuid, 100 + i, {""}));
+  }
+  int num_kelvins = 1 + num_pems / 100;
+  for (int i = 0; i < num_kelvins; ++i) {
+    std::string uuid = absl::StrFormat("00000002-0000-0000-0000-%012d", i + 1);
+    carnot_infos.push_back(testutils::MakeKelvinCarnotInfo(
+        absl::Substitute("kelvin$0", i + 1), uuid, absl::Substitute("1111$0", i), 10000 + i));
+  }
+  return testutils::LoadLogicalPlannerStatePB(testutils::MakeDistributedState(carnot_infos),
+                                              ProdSchema());
+}
+
+// Compiles `query` and runs distributed planning against a `num_pems`-PEM topology, reporting
+// peak physical memory alongside the wall time that benchmark tracks. Peak memory is sampled via
+// the tcmalloc API and reads as zero under other allocators.
+void RunPlanBenchmark(benchmark::State& state, const std::string& query, int num_pems) {
+  auto info = udfexporter::ExportUDFInfo().ConsumeValueOrDie()->info_pb();
+  auto planner = LogicalPlanner::Create(info).ConsumeValueOrDie();
+  auto planner_state = MakePlannerState(num_pems);
+  plannerpb::QueryRequest query_request;
+  query_request.set_query_str(query);
+
+  MemoryTracker mem_tracker(/* enable */ true);
+  mem_tracker.Start();
+  for (auto _ : state) {
+    auto plan_or_s = planner->Plan(planner_state, query_request);
+    if (!plan_or_s.ok()) {
+      state.SkipWithError(plan_or_s.msg().c_str());
+      break;
+    }
+    benchmark::DoNotOptimize(plan_or_s);
+  }
+  auto mem_stats = mem_tracker.End();
+  state.counters["peak_physical_mb"] =
+      static_cast<double>(mem_stats.max.physical) / (1024.0 * 1024.0);
+}
+
+// The benchmark set depends on the scripts present in the runfiles, so registration happens at
+// static-init time (as the BENCHMARK macro would) but driven by the corpus on disk.
+void RegisterPlannerBenchmarks() {
+  static const std::vector<ScriptCase>* corpus = new std::vector<ScriptCase>(LoadScriptCorpus());
+  for (const auto& script : *corpus) {
+    for (int num_pems : {10, 100, 1000}) {
+      std::string bm_name = absl::Substitute("BM_PlanScript/$0/$1_pems", script.name, num_pems);
+      benchmark::RegisterBenchmark(
+          bm_name.c_str(),
+          [&script, num_pems](benchmark::State& state) {  // NOLINT : runtime/references.
+            RunPlanBenchmark(state, script.query, num_pems);
+          })
+          ->Unit(benchmark::kMillisecond);
+    }
+  }
+}
+
+const bool kBenchmarksRegistered = (RegisterPlannerBenchmarks(), true);
+
+}  // namespace logical_planner
+}  // namespace planner
+}  // namespace carnot
+}  // namespace px
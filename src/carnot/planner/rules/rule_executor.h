@@ -17,12 +17,16 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_set.h>
+
 #include "src/carnot/planner/compiler_state/compiler_state.h"
 #include "src/carnot/planner/ir/ir.h"
 #include "src/carnot/planner/rules/rules.h"
@@ -124,16 +128,48 @@ class RuleExecutor {
  public:
   virtual ~RuleExecutor() = default;
   // TODO(philkuz) figure out how to collect stats on the execution.
+  /**
+   * Executes each rule batch to a fixed point. The first iteration of a batch scans the whole
+   * graph; subsequent iterations only revisit dirty nodes — the nodes a rule changed, their
+   * immediate neighbors, and any nodes created since the last iteration — so the work per
+   * iteration scales with the amount of change rather than the graph size. Before a batch is
+   * declared done, one more full scan confirms the fixed point, so imprecision in the dirty
+   * tracking can only cost extra iterations, never a missed rule application. Batches
+   * containing a rule with a custom Execute() override (see
+   * BaseRule::SupportsIncrementalExecution) fall back to full scans every iteration.
+   */
   Status Execute(TPlan* ir_graph) {
     for (const auto& rb : rule_batches) {
+      bool incremental = true;
+      for (const auto& rule : rb->rules()) {
+        incremental = incremental && rule->SupportsIncrementalExecution();
+      }
       bool can_continue = true;
       int64_t iteration = 0;
+      // When set, the next iteration only visits these nodes; unset means a full scan.
+      std::optional<absl::flat_hash_set<int64_t>> worklist;
       // We continue executing a batch until a stop condition is met.
       while (can_continue) {
         iteration += 1;
         bool graph_is_updated = false;
+        absl::flat_hash_set<int64_t> changed_nodes;
+        // Node ids at or above the watermark were created during this iteration.
+        int64_t id_watermark = 0;
+        if (incremental) {
+          for (int64_t node : ir_graph->dag().nodes()) {
+            id_watermark = std::max(id_watermark, node + 1);
+          }
+        }
         for (const auto& rule : rb->rules()) {
-          PL_ASSIGN_OR_RETURN(bool rule_updates_graph, rule->Execute(ir_graph));
+          bool rule_updates_graph = false;
+          if (incremental) {
+            PL_ASSIGN_OR_RETURN(
+                rule_updates_graph,
+                rule->ExecuteWithTracking(
+                    ir_graph, worklist.has_value() ? &worklist.value() : nullptr, &changed_nodes));
+          } else {
+            PL_ASSIGN_OR_RETURN(rule_updates_graph, rule->Execute(ir_graph));
+          }
           graph_is_updated = graph_is_updated || rule_updates_graph;
         }
         if (iteration >= rb->max_iterations() && graph_is_updated) {
@@ -141,13 +177,39 @@ class RuleExecutor {
           // TODO(philkuz) Reviewer: should this be a failure somehow?
           can_continue = false;
         }
-        // TODO(philkuz) in the future we might have a fast way to check whether the graph has
-        // changed. For now let's be lazy and leave it up to the user to make sure rules properly
-        // update.
         // (graph_is_updated == false) => the graph has reached a fixed point and is done
         if (!graph_is_updated) {
+          // A clean worklist pass only proves the dirty nodes settled; rescan the whole graph
+          // and stop only if the full pass agrees the batch is at a fixed point.
+          if (worklist.has_value()) {
+            worklist.reset();
+            continue;
+          }
           can_continue = false;
         }
+        if (incremental && can_continue) {
+          for (int64_t node : ir_graph->dag().nodes()) {
+            if (node >= id_watermark) {
+              changed_nodes.insert(node);
+            }
+          }
+          // Revisit the changed nodes and their neighbors, since a change can enable a rule
+          // match one hop away. Anything further is caught by the final full scan above.
+          absl::flat_hash_set<int64_t> next_worklist;
+          for (int64_t node : changed_nodes) {
+            if (!ir_graph->HasNode(node)) {
+              continue;
+            }
+            next_worklist.insert(node);
+            for (int64_t parent : ir_graph->dag().ParentsOf(node)) {
+              next_worklist.insert(parent);
+            }
+            for (int64_t child : ir_graph->dag().DependenciesOf(node)) {
+              next_worklist.insert(child);
+            }
+          }
+          worklist = std::move(next_worklist);
+        }
       }
     }
     return Status::OK();
@@ -168,6 +168,91 @@ TEST_F(RuleExecutorTest, rules_in_batch_correspond) {
   EXPECT_OK(executor->Execute(graph.get()));
 }
 
+// Reports a change on a single target node a fixed number of times and counts Apply calls, so
+// tests can observe how many nodes the executor visits on the way to a fixed point.
+class CountedTargetRule : public Rule {
+ public:
+  CountedTargetRule(CompilerState* compiler_state, int64_t target_node, int64_t times)
+      : Rule(compiler_state, /*use_topo*/ false, /*reverse_topological_execution*/ false),
+        target_node_(target_node),
+        times_(times) {}
+
+  int64_t apply_calls() const { return apply_calls_; }
+
+ protected:
+  StatusOr<bool> Apply(IRNode* node) override {
+    ++apply_calls_;
+    if (node->id() != target_node_ || times_ == 0) {
+      return false;
+    }
+    --times_;
+    return true;
+  }
+
+ private:
+  int64_t target_node_;
+  int64_t times_;
+  int64_t apply_calls_ = 0;
+};
+
+// Tests that once a batch is iterating, only the dirty neighborhood is revisited: the total
+// number of Apply calls stays below what whole-graph scans on every iteration would cost.
+TEST_F(RuleExecutorTest, incremental_worklist_limits_applies) {
+  std::unique_ptr<TestExecutor> executor = std::move(TestExecutor::Create().ValueOrDie());
+  RuleBatch* rule_batch = executor->CreateRuleBatch<FailOnMax>("incremental", 10);
+  CountedTargetRule* rule =
+      rule_batch->AddRule<CountedTargetRule>(compiler_state_.get(), int_constant->id(), 2);
+  ASSERT_OK(executor->Execute(graph.get()));
+
+  int64_t num_nodes = static_cast<int64_t>(graph->dag().nodes().size());
+  // Full scans would take 3 whole-graph iterations (change, change, clean) to converge.
+  EXPECT_LT(rule->apply_calls(), 3 * num_nodes);
+  // The confirming full scan means every node is still visited at least once.
+  EXPECT_GE(rule->apply_calls(), num_nodes);
+}
+
+// Changes one node, then only matches a node far away from it. The worklist alone would never
+// revisit the distant node; the confirming full scan has to pick it up.
+class DistantFollowUpRule : public Rule {
+ public:
+  DistantFollowUpRule(CompilerState* compiler_state, int64_t first_node, int64_t second_node)
+      : Rule(compiler_state, /*use_topo*/ false, /*reverse_topological_execution*/ false),
+        first_node_(first_node),
+        second_node_(second_node) {}
+
+  int64_t stage() const { return stage_; }
+
+ protected:
+  StatusOr<bool> Apply(IRNode* node) override {
+    if (stage_ == 0 && node->id() == first_node_) {
+      stage_ = 1;
+      return true;
+    }
+    if (stage_ == 1 && node->id() == second_node_) {
+      stage_ = 2;
+      return true;
+    }
+    return false;
+  }
+
+ private:
+  int64_t first_node_;
+  int64_t second_node_;
+  int64_t stage_ = 0;
+};
+
+// Tests that a match enabled outside the dirty neighborhood is still applied before the batch
+// is declared done.
+TEST_F(RuleExecutorTest, full_scan_confirms_fixed_point) {
+  std::unique_ptr<TestExecutor> executor = std::move(TestExecutor::Create().ValueOrDie());
+  RuleBatch* rule_batch = executor->CreateRuleBatch<FailOnMax>("incremental", 10);
+  // col and int_constant2 are more than one edge apart in the graph.
+  DistantFollowUpRule* rule = rule_batch->AddRule<DistantFollowUpRule>(
+      compiler_state_.get(), col->id(), int_constant2->id());
+  ASSERT_OK(executor->Execute(graph.get()));
+  EXPECT_EQ(rule->stage(), 2);
+}
+
 // Test to see that if the strategy exits, then following batches don't run.
 TEST_F(RuleExecutorTest, exit_early) {
   std::unique_ptr<TestExecutor> executor = std::move(TestExecutor::Create().ValueOrDie());
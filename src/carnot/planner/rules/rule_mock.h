@@ -34,6 +34,9 @@ class MockRule : public Rule {
 
   MOCK_METHOD1(Execute, StatusOr<bool>(IR* ir_graph));
 
+  // The mocked Execute() bypasses the node traversal that dirty-node tracking hooks into.
+  bool SupportsIncrementalExecution() const override { return false; }
+
  protected:
   MOCK_METHOD1(Apply, StatusOr<bool>(IRNode* ir_node));
 };
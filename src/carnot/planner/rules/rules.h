@@ -23,6 +23,7 @@
 #include <vector>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 
 #include "src/carnot/planner/compiler_state/compiler_state.h"
 #include "src/carnot/planner/compiler_state/registry_info.h"
@@ -55,45 +56,75 @@ class BaseRule {
   virtual ~BaseRule() = default;
 
   virtual StatusOr<bool> Execute(TPlan* graph) {
+    return ExecuteWithTracking(graph, /* candidates */ nullptr, /* changed_nodes */ nullptr);
+  }
+
+  /**
+   * @brief Whether the rule executor may run this rule over a subset of the graph's nodes via
+   * ExecuteWithTracking(). Rules that override Execute() with a custom whole-graph traversal
+   * must return false here so the executor falls back to full scans for their batch.
+   */
+  virtual bool SupportsIncrementalExecution() const { return true; }
+
+  /**
+   * @brief Variant of Execute() used by the rule executor's dirty-node tracking. Visits only
+   * the nodes in `candidates` (the whole graph when nullptr) and records into `changed_nodes`
+   * the ids of the nodes this rule changed, plus the neighbors of any nodes it deleted. Both
+   * pointers may be null, in which case this matches the default Execute() exactly.
+   */
+  StatusOr<bool> ExecuteWithTracking(TPlan* graph, const absl::flat_hash_set<int64_t>* candidates,
+                                     absl::flat_hash_set<int64_t>* changed_nodes) {
     bool any_changed = false;
     if (!use_topo_) {
-      PL_ASSIGN_OR_RETURN(any_changed, ExecuteUnsorted(graph));
+      PL_ASSIGN_OR_RETURN(any_changed, ExecuteUnsorted(graph, candidates, changed_nodes));
     } else {
-      PL_ASSIGN_OR_RETURN(any_changed, ExecuteTopologicalSorted(graph));
+      PL_ASSIGN_OR_RETURN(any_changed, ExecuteTopologicalSorted(graph, candidates, changed_nodes));
     }
-    PL_RETURN_IF_ERROR(EmptyDeleteQueue(graph));
+    PL_RETURN_IF_ERROR(EmptyDeleteQueue(graph, changed_nodes));
     return any_changed;
   }
 
  protected:
-  StatusOr<bool> ExecuteTopologicalSorted(TPlan* graph) {
+  StatusOr<bool> ExecuteTopologicalSorted(TPlan* graph,
+                                          const absl::flat_hash_set<int64_t>* candidates,
+                                          absl::flat_hash_set<int64_t>* changed_nodes) {
     bool any_changed = false;
     std::vector<int64_t> topo_graph = graph->dag().TopologicalSort();
     if (reverse_topological_execution_) {
       std::reverse(topo_graph.begin(), topo_graph.end());
     }
     for (int64_t node_i : topo_graph) {
+      if (candidates != nullptr && !candidates->contains(node_i)) {
+        continue;
+      }
       // The node may have been deleted by a prior call to Apply on a parent or child node.
       if (!graph->HasNode(node_i)) {
         continue;
       }
       PL_ASSIGN_OR_RETURN(bool node_is_changed, Apply(graph->Get(node_i)));
+      if (node_is_changed && changed_nodes != nullptr) {
+        changed_nodes->insert(node_i);
+      }
       any_changed = any_changed || node_is_changed;
     }
     return any_changed;
   }
 
-  StatusOr<bool> ExecuteUnsorted(TPlan* graph) {
+  StatusOr<bool> ExecuteUnsorted(TPlan* graph, const absl::flat_hash_set<int64_t>* candidates,
+                                 absl::flat_hash_set<int64_t>* changed_nodes) {
     bool any_changed = false;
     // We need to copy over nodes because the Apply() might add nodes which can affect traversal,
     // causing nodes to be skipped.
-    auto nodes = graph->dag().nodes();
+    auto nodes = candidates != nullptr ? *candidates : graph->dag().nodes();
     for (int64_t node_i : nodes) {
       // The node may have been deleted by a prior call to Apply on a parent or child node.
       if (!graph->HasNode(node_i)) {
         continue;
       }
       PL_ASSIGN_OR_RETURN(bool node_is_changed, Apply(graph->Get(node_i)));
+      if (node_is_changed && changed_nodes != nullptr) {
+        changed_nodes->insert(node_i);
+      }
       any_changed = any_changed || node_is_changed;
     }
     return any_changed;
@@ -112,10 +143,23 @@ class BaseRule {
   virtual StatusOr<bool> Apply(typename RuleTraits<TPlan>::node_type* node) = 0;
   void DeferNodeDeletion(int64_t node) { node_delete_q.push(node); }
 
-  Status EmptyDeleteQueue(TPlan* graph) {
+  Status EmptyDeleteQueue(TPlan* graph) { return EmptyDeleteQueue(graph, nullptr); }
+
+  Status EmptyDeleteQueue(TPlan* graph, absl::flat_hash_set<int64_t>* changed_nodes) {
     while (!node_delete_q.empty()) {
-      PL_RETURN_IF_ERROR(graph->DeleteNode(node_delete_q.front()));
+      int64_t node = node_delete_q.front();
       node_delete_q.pop();
+      if (changed_nodes != nullptr && graph->HasNode(node)) {
+        // Removing a node can change whether rules now match its neighbors.
+        for (int64_t parent : graph->dag().ParentsOf(node)) {
+          changed_nodes->insert(parent);
+        }
+        for (int64_t child : graph->dag().DependenciesOf(node)) {
+          changed_nodes->insert(child);
+        }
+        changed_nodes->erase(node);
+      }
+      PL_RETURN_IF_ERROR(graph->DeleteNode(node));
     }
     return Status::OK();
   }
@@ -1868,6 +1868,11 @@ relation_map {
       column_type: STRING
       column_semantic_type: ST_NONE
     }
+    columns {
+      column_name: "count"
+      column_type: INT64
+      column_semantic_type: ST_NONE
+    }
   }
 }
 relation_map {
@@ -2083,6 +2088,11 @@ relation_map {
       column_type: STRING
       column_semantic_type: ST_NONE
     }
+    columns {
+      column_name: "count"
+      column_type: INT64
+      column_semantic_type: ST_NONE
+    }
   }
 }
 )proto";
@@ -31,6 +31,30 @@ var _ = math.Inf
 // proto package needs to be updated.
 const _ = proto.GoGoProtoPackageIsVersion3 // please upgrade the proto package
 
+type QueryPriority int32
+
+const (
+	QUERY_PRIORITY_UNKNOWN           QueryPriority = 0
+	QUERY_PRIORITY_LATENCY_SENSITIVE QueryPriority = 1
+	QUERY_PRIORITY_AD_HOC            QueryPriority = 2
+)
+
+var QueryPriority_name = map[int32]string{
+	0: "QUERY_PRIORITY_UNKNOWN",
+	1: "QUERY_PRIORITY_LATENCY_SENSITIVE",
+	2: "QUERY_PRIORITY_AD_HOC",
+}
+
+var QueryPriority_value = map[string]int32{
+	"QUERY_PRIORITY_UNKNOWN":           0,
+	"QUERY_PRIORITY_LATENCY_SENSITIVE": 1,
+	"QUERY_PRIORITY_AD_HOC":            2,
+}
+
+func (QueryPriority) EnumDescriptor() ([]byte, []int) {
+	return fileDescriptor_e5dcfc8666ec3f33, []int{0}
+}
+
 type OperatorType int32
 
 const (
@@ -45,6 +69,8 @@ const (
 	LIMIT_OPERATOR            OperatorType = 2300
 	UNION_OPERATOR            OperatorType = 2400
 	JOIN_OPERATOR             OperatorType = 2500
+	TOPN_OPERATOR             OperatorType = 2600
+	SAMPLE_OPERATOR           OperatorType = 2700
 	MEMORY_SINK_OPERATOR      OperatorType = 9000
 	GRPC_SINK_OPERATOR        OperatorType = 9100
 	OTEL_EXPORT_SINK_OPERATOR OperatorType = 9200
@@ -62,6 +88,8 @@ var OperatorType_name = map[int32]string{
 	2300: "LIMIT_OPERATOR",
 	2400: "UNION_OPERATOR",
 	2500: "JOIN_OPERATOR",
+	2600: "TOPN_OPERATOR",
+	2700: "SAMPLE_OPERATOR",
 	9000: "MEMORY_SINK_OPERATOR",
 	9100: "GRPC_SINK_OPERATOR",
 	9200: "OTEL_EXPORT_SINK_OPERATOR",
@@ -79,13 +107,15 @@ var OperatorType_value = map[string]int32{
 	"LIMIT_OPERATOR":            2300,
 	"UNION_OPERATOR":            2400,
 	"JOIN_OPERATOR":             2500,
+	"TOPN_OPERATOR":             2600,
+	"SAMPLE_OPERATOR":           2700,
 	"MEMORY_SINK_OPERATOR":      9000,
 	"GRPC_SINK_OPERATOR":        9100,
 	"OTEL_EXPORT_SINK_OPERATOR": 9200,
 }
 
 func (OperatorType) EnumDescriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{0}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{1}
 }
 
 type JoinOperator_JoinType int32
@@ -109,13 +139,14 @@ var JoinOperator_JoinType_value = map[string]int32{
 }
 
 func (JoinOperator_JoinType) EnumDescriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{15, 0}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{17, 0}
 }
 
 type PlanOptions struct {
-	Explain               bool  `protobuf:"varint,2,opt,name=explain,proto3" json:"explain,omitempty"`
-	Analyze               bool  `protobuf:"varint,3,opt,name=analyze,proto3" json:"analyze,omitempty"`
-	MaxOutputRowsPerTable int64 `protobuf:"varint,4,opt,name=max_output_rows_per_table,json=maxOutputRowsPerTable,proto3" json:"max_output_rows_per_table,omitempty"`
+	Explain               bool          `protobuf:"varint,2,opt,name=explain,proto3" json:"explain,omitempty"`
+	Analyze               bool          `protobuf:"varint,3,opt,name=analyze,proto3" json:"analyze,omitempty"`
+	MaxOutputRowsPerTable int64         `protobuf:"varint,4,opt,name=max_output_rows_per_table,json=maxOutputRowsPerTable,proto3" json:"max_output_rows_per_table,omitempty"`
+	Priority              QueryPriority `protobuf:"varint,5,opt,name=priority,proto3,enum=px.carnot.planpb.QueryPriority" json:"priority,omitempty"`
 }
 
 func (m *PlanOptions) Reset()      { *m = PlanOptions{} }
@@ -171,6 +202,13 @@ func (m *PlanOptions) GetMaxOutputRowsPerTable() int64 {
 	return 0
 }
 
+func (m *PlanOptions) GetPriority() QueryPriority {
+	if m != nil {
+		return m.Priority
+	}
+	return QUERY_PRIORITY_UNKNOWN
+}
+
 type Plan struct {
 	Dag                         *DAG                               `protobuf:"bytes,1,opt,name=dag,proto3" json:"dag,omitempty"`
 	Nodes                       []*PlanFragment                    `protobuf:"bytes,2,rep,name=nodes,proto3" json:"nodes,omitempty"`
@@ -525,6 +563,8 @@ type Operator struct {
 	//	*Operator_UdtfSourceOp
 	//	*Operator_EmptySourceOp
 	//	*Operator_OTelSinkOp
+	//	*Operator_TopnOp
+	//	*Operator_SampleOp
 	Op isOperator_Op `protobuf_oneof:"op"`
 }
 
@@ -606,6 +646,12 @@ type Operator_EmptySourceOp struct {
 type Operator_OTelSinkOp struct {
 	OTelSinkOp *OTelExportSinkOperator `protobuf:"bytes,14,opt,name=otel_sink_op,json=otelSinkOp,proto3,oneof" json:"otel_sink_op,omitempty"`
 }
+type Operator_TopnOp struct {
+	TopnOp *TopNOperator `protobuf:"bytes,15,opt,name=topn_op,json=topnOp,proto3,oneof" json:"topn_op,omitempty"`
+}
+type Operator_SampleOp struct {
+	SampleOp *SampleOperator `protobuf:"bytes,16,opt,name=sample_op,json=sampleOp,proto3,oneof" json:"sample_op,omitempty"`
+}
 
 func (*Operator_MemSourceOp) isOperator_Op()   {}
 func (*Operator_MapOp) isOperator_Op()         {}
@@ -620,6 +666,8 @@ func (*Operator_JoinOp) isOperator_Op()        {}
 func (*Operator_UdtfSourceOp) isOperator_Op()  {}
 func (*Operator_EmptySourceOp) isOperator_Op() {}
 func (*Operator_OTelSinkOp) isOperator_Op()    {}
+func (*Operator_TopnOp) isOperator_Op()        {}
+func (*Operator_SampleOp) isOperator_Op()      {}
 
 func (m *Operator) GetOp() isOperator_Op {
 	if m != nil {
@@ -726,6 +774,20 @@ func (m *Operator) GetOTelSinkOp() *OTelExportSinkOperator {
 	return nil
 }
 
+func (m *Operator) GetTopnOp() *TopNOperator {
+	if x, ok := m.GetOp().(*Operator_TopnOp); ok {
+		return x.TopnOp
+	}
+	return nil
+}
+
+func (m *Operator) GetSampleOp() *SampleOperator {
+	if x, ok := m.GetOp().(*Operator_SampleOp); ok {
+		return x.SampleOp
+	}
+	return nil
+}
+
 // XXX_OneofWrappers is for the internal use of the proto package.
 func (*Operator) XXX_OneofWrappers() []interface{} {
 	return []interface{}{
@@ -742,6 +804,8 @@ func (*Operator) XXX_OneofWrappers() []interface{} {
 		(*Operator_UdtfSourceOp)(nil),
 		(*Operator_EmptySourceOp)(nil),
 		(*Operator_OTelSinkOp)(nil),
+		(*Operator_TopnOp)(nil),
+		(*Operator_SampleOp)(nil),
 	}
 }
 
@@ -1227,13 +1291,16 @@ func (m *MapOperator) GetColumnNames() []string {
 }
 
 type AggregateOperator struct {
-	Values          []*AggregateExpression `protobuf:"bytes,1,rep,name=values,proto3" json:"values,omitempty"`
-	Groups          []*Column              `protobuf:"bytes,2,rep,name=groups,proto3" json:"groups,omitempty"`
-	GroupNames      []string               `protobuf:"bytes,3,rep,name=group_names,json=groupNames,proto3" json:"group_names,omitempty"`
-	ValueNames      []string               `protobuf:"bytes,4,rep,name=value_names,json=valueNames,proto3" json:"value_names,omitempty"`
-	Windowed        bool                   `protobuf:"varint,5,opt,name=windowed,proto3" json:"windowed,omitempty"`
-	PartialAgg      bool                   `protobuf:"varint,6,opt,name=partial_agg,json=partialAgg,proto3" json:"partial_agg,omitempty"`
-	FinalizeResults bool                   `protobuf:"varint,7,opt,name=finalize_results,json=finalizeResults,proto3" json:"finalize_results,omitempty"`
+	Values                []*AggregateExpression `protobuf:"bytes,1,rep,name=values,proto3" json:"values,omitempty"`
+	Groups                []*Column              `protobuf:"bytes,2,rep,name=groups,proto3" json:"groups,omitempty"`
+	GroupNames            []string               `protobuf:"bytes,3,rep,name=group_names,json=groupNames,proto3" json:"group_names,omitempty"`
+	ValueNames            []string               `protobuf:"bytes,4,rep,name=value_names,json=valueNames,proto3" json:"value_names,omitempty"`
+	Windowed              bool                   `protobuf:"varint,5,opt,name=windowed,proto3" json:"windowed,omitempty"`
+	PartialAgg            bool                   `protobuf:"varint,6,opt,name=partial_agg,json=partialAgg,proto3" json:"partial_agg,omitempty"`
+	FinalizeResults       bool                   `protobuf:"varint,7,opt,name=finalize_results,json=finalizeResults,proto3" json:"finalize_results,omitempty"`
+	WindowSizeNs          int64                  `protobuf:"varint,8,opt,name=window_size_ns,json=windowSizeNs,proto3" json:"window_size_ns,omitempty"`
+	WindowTimeColumnIndex int64                  `protobuf:"varint,9,opt,name=window_time_column_index,json=windowTimeColumnIndex,proto3" json:"window_time_column_index,omitempty"`
+	AllowedLatenessNs     int64                  `protobuf:"varint,10,opt,name=allowed_lateness_ns,json=allowedLatenessNs,proto3" json:"allowed_lateness_ns,omitempty"`
 }
 
 func (m *AggregateOperator) Reset()      { *m = AggregateOperator{} }
@@ -1317,6 +1384,27 @@ func (m *AggregateOperator) GetFinalizeResults() bool {
 	return false
 }
 
+func (m *AggregateOperator) GetWindowSizeNs() int64 {
+	if m != nil {
+		return m.WindowSizeNs
+	}
+	return 0
+}
+
+func (m *AggregateOperator) GetWindowTimeColumnIndex() int64 {
+	if m != nil {
+		return m.WindowTimeColumnIndex
+	}
+	return 0
+}
+
+func (m *AggregateOperator) GetAllowedLatenessNs() int64 {
+	if m != nil {
+		return m.AllowedLatenessNs
+	}
+	return 0
+}
+
 type FilterOperator struct {
 	Expression *ScalarExpression `protobuf:"bytes,1,opt,name=expression,proto3" json:"expression,omitempty"`
 	Columns    []*Column         `protobuf:"bytes,2,rep,name=columns,proto3" json:"columns,omitempty"`
@@ -1427,6 +1515,175 @@ func (m *LimitOperator) GetAbortableSrcs() []uint64 {
 	return nil
 }
 
+type TopNOperator struct {
+	SortKeys []*TopNOperator_SortKey `protobuf:"bytes,1,rep,name=sort_keys,json=sortKeys,proto3" json:"sort_keys,omitempty"`
+	Limit    int64                   `protobuf:"varint,2,opt,name=limit,proto3" json:"limit,omitempty"`
+	Columns  []*Column               `protobuf:"bytes,3,rep,name=columns,proto3" json:"columns,omitempty"`
+}
+
+func (m *TopNOperator) Reset()      { *m = TopNOperator{} }
+func (*TopNOperator) ProtoMessage() {}
+func (*TopNOperator) Descriptor() ([]byte, []int) {
+	return fileDescriptor_e5dcfc8666ec3f33, []int{14}
+}
+func (m *TopNOperator) XXX_Unmarshal(b []byte) error {
+	return m.Unmarshal(b)
+}
+func (m *TopNOperator) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	if deterministic {
+		return xxx_messageInfo_TopNOperator.Marshal(b, m, deterministic)
+	} else {
+		b = b[:cap(b)]
+		n, err := m.MarshalToSizedBuffer(b)
+		if err != nil {
+			return nil, err
+		}
+		return b[:n], nil
+	}
+}
+func (m *TopNOperator) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_TopNOperator.Merge(m, src)
+}
+func (m *TopNOperator) XXX_Size() int {
+	return m.Size()
+}
+func (m *TopNOperator) XXX_DiscardUnknown() {
+	xxx_messageInfo_TopNOperator.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_TopNOperator proto.InternalMessageInfo
+
+func (m *TopNOperator) GetSortKeys() []*TopNOperator_SortKey {
+	if m != nil {
+		return m.SortKeys
+	}
+	return nil
+}
+
+func (m *TopNOperator) GetLimit() int64 {
+	if m != nil {
+		return m.Limit
+	}
+	return 0
+}
+
+func (m *TopNOperator) GetColumns() []*Column {
+	if m != nil {
+		return m.Columns
+	}
+	return nil
+}
+
+type TopNOperator_SortKey struct {
+	ColumnIndex int64 `protobuf:"varint,1,opt,name=column_index,json=columnIndex,proto3" json:"column_index,omitempty"`
+	Ascending   bool  `protobuf:"varint,2,opt,name=ascending,proto3" json:"ascending,omitempty"`
+}
+
+func (m *TopNOperator_SortKey) Reset()      { *m = TopNOperator_SortKey{} }
+func (*TopNOperator_SortKey) ProtoMessage() {}
+func (*TopNOperator_SortKey) Descriptor() ([]byte, []int) {
+	return fileDescriptor_e5dcfc8666ec3f33, []int{14, 0}
+}
+func (m *TopNOperator_SortKey) XXX_Unmarshal(b []byte) error {
+	return m.Unmarshal(b)
+}
+func (m *TopNOperator_SortKey) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	if deterministic {
+		return xxx_messageInfo_TopNOperator_SortKey.Marshal(b, m, deterministic)
+	} else {
+		b = b[:cap(b)]
+		n, err := m.MarshalToSizedBuffer(b)
+		if err != nil {
+			return nil, err
+		}
+		return b[:n], nil
+	}
+}
+func (m *TopNOperator_SortKey) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_TopNOperator_SortKey.Merge(m, src)
+}
+func (m *TopNOperator_SortKey) XXX_Size() int {
+	return m.Size()
+}
+func (m *TopNOperator_SortKey) XXX_DiscardUnknown() {
+	xxx_messageInfo_TopNOperator_SortKey.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_TopNOperator_SortKey proto.InternalMessageInfo
+
+func (m *TopNOperator_SortKey) GetColumnIndex() int64 {
+	if m != nil {
+		return m.ColumnIndex
+	}
+	return 0
+}
+
+func (m *TopNOperator_SortKey) GetAscending() bool {
+	if m != nil {
+		return m.Ascending
+	}
+	return false
+}
+
+type SampleOperator struct {
+	NumRows      int64     `protobuf:"varint,1,opt,name=num_rows,json=numRows,proto3" json:"num_rows,omitempty"`
+	GroupIndices []int64   `protobuf:"varint,2,rep,packed,name=group_indices,json=groupIndices,proto3" json:"group_indices,omitempty"`
+	Columns      []*Column `protobuf:"bytes,3,rep,name=columns,proto3" json:"columns,omitempty"`
+}
+
+func (m *SampleOperator) Reset()      { *m = SampleOperator{} }
+func (*SampleOperator) ProtoMessage() {}
+func (*SampleOperator) Descriptor() ([]byte, []int) {
+	return fileDescriptor_e5dcfc8666ec3f33, []int{15}
+}
+func (m *SampleOperator) XXX_Unmarshal(b []byte) error {
+	return m.Unmarshal(b)
+}
+func (m *SampleOperator) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	if deterministic {
+		return xxx_messageInfo_SampleOperator.Marshal(b, m, deterministic)
+	} else {
+		b = b[:cap(b)]
+		n, err := m.MarshalToSizedBuffer(b)
+		if err != nil {
+			return nil, err
+		}
+		return b[:n], nil
+	}
+}
+func (m *SampleOperator) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_SampleOperator.Merge(m, src)
+}
+func (m *SampleOperator) XXX_Size() int {
+	return m.Size()
+}
+func (m *SampleOperator) XXX_DiscardUnknown() {
+	xxx_messageInfo_SampleOperator.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_SampleOperator proto.InternalMessageInfo
+
+func (m *SampleOperator) GetNumRows() int64 {
+	if m != nil {
+		return m.NumRows
+	}
+	return 0
+}
+
+func (m *SampleOperator) GetGroupIndices() []int64 {
+	if m != nil {
+		return m.GroupIndices
+	}
+	return nil
+}
+
+func (m *SampleOperator) GetColumns() []*Column {
+	if m != nil {
+		return m.Columns
+	}
+	return nil
+}
+
 type UnionOperator struct {
 	ColumnNames    []string                       `protobuf:"bytes,1,rep,name=column_names,json=columnNames,proto3" json:"column_names,omitempty"`
 	ColumnMappings []*UnionOperator_ColumnMapping `protobuf:"bytes,2,rep,name=column_mappings,json=columnMappings,proto3" json:"column_mappings,omitempty"`
@@ -1436,7 +1693,7 @@ type UnionOperator struct {
 func (m *UnionOperator) Reset()      { *m = UnionOperator{} }
 func (*UnionOperator) ProtoMessage() {}
 func (*UnionOperator) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{14}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{16}
 }
 func (m *UnionOperator) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -1493,7 +1750,7 @@ type UnionOperator_ColumnMapping struct {
 func (m *UnionOperator_ColumnMapping) Reset()      { *m = UnionOperator_ColumnMapping{} }
 func (*UnionOperator_ColumnMapping) ProtoMessage() {}
 func (*UnionOperator_ColumnMapping) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{14, 0}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{16, 0}
 }
 func (m *UnionOperator_ColumnMapping) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -1535,12 +1792,13 @@ type JoinOperator struct {
 	OutputColumns      []*JoinOperator_ParentColumn      `protobuf:"bytes,3,rep,name=output_columns,json=outputColumns,proto3" json:"output_columns,omitempty"`
 	ColumnNames        []string                          `protobuf:"bytes,4,rep,name=column_names,json=columnNames,proto3" json:"column_names,omitempty"`
 	RowsPerBatch       uint64                            `protobuf:"varint,5,opt,name=rows_per_batch,json=rowsPerBatch,proto3" json:"rows_per_batch,omitempty"`
+	SortedInputs       bool                              `protobuf:"varint,6,opt,name=sorted_inputs,json=sortedInputs,proto3" json:"sorted_inputs,omitempty"`
 }
 
 func (m *JoinOperator) Reset()      { *m = JoinOperator{} }
 func (*JoinOperator) ProtoMessage() {}
 func (*JoinOperator) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{15}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{17}
 }
 func (m *JoinOperator) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -1604,6 +1862,13 @@ func (m *JoinOperator) GetRowsPerBatch() uint64 {
 	return 0
 }
 
+func (m *JoinOperator) GetSortedInputs() bool {
+	if m != nil {
+		return m.SortedInputs
+	}
+	return false
+}
+
 type JoinOperator_EqualityCondition struct {
 	LeftColumnIndex  uint64 `protobuf:"varint,1,opt,name=left_column_index,json=leftColumnIndex,proto3" json:"left_column_index,omitempty"`
 	RightColumnIndex uint64 `protobuf:"varint,2,opt,name=right_column_index,json=rightColumnIndex,proto3" json:"right_column_index,omitempty"`
@@ -1612,7 +1877,7 @@ type JoinOperator_EqualityCondition struct {
 func (m *JoinOperator_EqualityCondition) Reset()      { *m = JoinOperator_EqualityCondition{} }
 func (*JoinOperator_EqualityCondition) ProtoMessage() {}
 func (*JoinOperator_EqualityCondition) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{15, 0}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{17, 0}
 }
 func (m *JoinOperator_EqualityCondition) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -1663,7 +1928,7 @@ type JoinOperator_ParentColumn struct {
 func (m *JoinOperator_ParentColumn) Reset()      { *m = JoinOperator_ParentColumn{} }
 func (*JoinOperator_ParentColumn) ProtoMessage() {}
 func (*JoinOperator_ParentColumn) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{15, 1}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{17, 1}
 }
 func (m *JoinOperator_ParentColumn) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -1714,7 +1979,7 @@ type UDTFSourceOperator struct {
 func (m *UDTFSourceOperator) Reset()      { *m = UDTFSourceOperator{} }
 func (*UDTFSourceOperator) ProtoMessage() {}
 func (*UDTFSourceOperator) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{16}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{18}
 }
 func (m *UDTFSourceOperator) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -1765,7 +2030,7 @@ type EmptySourceOperator struct {
 func (m *EmptySourceOperator) Reset()      { *m = EmptySourceOperator{} }
 func (*EmptySourceOperator) ProtoMessage() {}
 func (*EmptySourceOperator) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{17}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{19}
 }
 func (m *EmptySourceOperator) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -1825,7 +2090,7 @@ type OTelSpan struct {
 func (m *OTelSpan) Reset()      { *m = OTelSpan{} }
 func (*OTelSpan) ProtoMessage() {}
 func (*OTelSpan) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{18}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{20}
 }
 func (m *OTelSpan) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -1959,7 +2224,7 @@ type OTelMetricGauge struct {
 func (m *OTelMetricGauge) Reset()      { *m = OTelMetricGauge{} }
 func (*OTelMetricGauge) ProtoMessage() {}
 func (*OTelMetricGauge) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{19}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{21}
 }
 func (m *OTelMetricGauge) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2043,7 +2308,7 @@ type OTelMetricSummary struct {
 func (m *OTelMetricSummary) Reset()      { *m = OTelMetricSummary{} }
 func (*OTelMetricSummary) ProtoMessage() {}
 func (*OTelMetricSummary) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{20}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{22}
 }
 func (m *OTelMetricSummary) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2101,7 +2366,7 @@ type OTelMetricSummary_ValueAtQuantile struct {
 func (m *OTelMetricSummary_ValueAtQuantile) Reset()      { *m = OTelMetricSummary_ValueAtQuantile{} }
 func (*OTelMetricSummary_ValueAtQuantile) ProtoMessage() {}
 func (*OTelMetricSummary_ValueAtQuantile) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{20, 0}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{22, 0}
 }
 func (m *OTelMetricSummary_ValueAtQuantile) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2155,7 +2420,7 @@ type OTelAttribute struct {
 func (m *OTelAttribute) Reset()      { *m = OTelAttribute{} }
 func (*OTelAttribute) ProtoMessage() {}
 func (*OTelAttribute) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{21}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{23}
 }
 func (m *OTelAttribute) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2246,7 +2511,7 @@ type OTelAttribute_Column struct {
 func (m *OTelAttribute_Column) Reset()      { *m = OTelAttribute_Column{} }
 func (*OTelAttribute_Column) ProtoMessage() {}
 func (*OTelAttribute_Column) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{21, 0}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{23, 0}
 }
 func (m *OTelAttribute_Column) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2311,7 +2576,7 @@ type OTelMetric struct {
 func (m *OTelMetric) Reset()      { *m = OTelMetric{} }
 func (*OTelMetric) ProtoMessage() {}
 func (*OTelMetric) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{22}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{24}
 }
 func (m *OTelMetric) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2430,7 +2695,7 @@ type OTelEndpointConfig struct {
 func (m *OTelEndpointConfig) Reset()      { *m = OTelEndpointConfig{} }
 func (*OTelEndpointConfig) ProtoMessage() {}
 func (*OTelEndpointConfig) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{23}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{25}
 }
 func (m *OTelEndpointConfig) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2487,7 +2752,7 @@ type OTelResource struct {
 func (m *OTelResource) Reset()      { *m = OTelResource{} }
 func (*OTelResource) ProtoMessage() {}
 func (*OTelResource) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{24}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{26}
 }
 func (m *OTelResource) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2533,7 +2798,7 @@ type OTelExportSinkOperator struct {
 func (m *OTelExportSinkOperator) Reset()      { *m = OTelExportSinkOperator{} }
 func (*OTelExportSinkOperator) ProtoMessage() {}
 func (*OTelExportSinkOperator) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{25}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{27}
 }
 func (m *OTelExportSinkOperator) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2601,7 +2866,7 @@ type ScalarExpression struct {
 func (m *ScalarExpression) Reset()      { *m = ScalarExpression{} }
 func (*ScalarExpression) ProtoMessage() {}
 func (*ScalarExpression) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{26}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{28}
 }
 func (m *ScalarExpression) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2703,7 +2968,7 @@ type ScalarValue struct {
 func (m *ScalarValue) Reset()      { *m = ScalarValue{} }
 func (*ScalarValue) ProtoMessage() {}
 func (*ScalarValue) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{27}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{29}
 }
 func (m *ScalarValue) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2844,7 +3109,7 @@ type ScalarFunc struct {
 func (m *ScalarFunc) Reset()      { *m = ScalarFunc{} }
 func (*ScalarFunc) ProtoMessage() {}
 func (*ScalarFunc) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{28}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{30}
 }
 func (m *ScalarFunc) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2919,7 +3184,7 @@ type AggregateExpression struct {
 func (m *AggregateExpression) Reset()      { *m = AggregateExpression{} }
 func (*AggregateExpression) ProtoMessage() {}
 func (*AggregateExpression) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{29}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{31}
 }
 func (m *AggregateExpression) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -2993,7 +3258,7 @@ type AggregateExpression_Arg struct {
 func (m *AggregateExpression_Arg) Reset()      { *m = AggregateExpression_Arg{} }
 func (*AggregateExpression_Arg) ProtoMessage() {}
 func (*AggregateExpression_Arg) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{29, 0}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{31, 0}
 }
 func (m *AggregateExpression_Arg) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -3076,7 +3341,7 @@ type Column struct {
 func (m *Column) Reset()      { *m = Column{} }
 func (*Column) ProtoMessage() {}
 func (*Column) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e5dcfc8666ec3f33, []int{30}
+	return fileDescriptor_e5dcfc8666ec3f33, []int{32}
 }
 func (m *Column) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -3120,6 +3385,7 @@ func (m *Column) GetIndex() uint64 {
 }
 
 func init() {
+	proto.RegisterEnum("px.carnot.planpb.QueryPriority", QueryPriority_name, QueryPriority_value)
 	proto.RegisterEnum("px.carnot.planpb.OperatorType", OperatorType_name, OperatorType_value)
 	proto.RegisterEnum("px.carnot.planpb.JoinOperator_JoinType", JoinOperator_JoinType_name, JoinOperator_JoinType_value)
 	proto.RegisterType((*PlanOptions)(nil), "px.carnot.planpb.PlanOptions")
@@ -3140,6 +3406,9 @@ func init() {
 	proto.RegisterType((*AggregateOperator)(nil), "px.carnot.planpb.AggregateOperator")
 	proto.RegisterType((*FilterOperator)(nil), "px.carnot.planpb.FilterOperator")
 	proto.RegisterType((*LimitOperator)(nil), "px.carnot.planpb.LimitOperator")
+	proto.RegisterType((*TopNOperator)(nil), "px.carnot.planpb.TopNOperator")
+	proto.RegisterType((*TopNOperator_SortKey)(nil), "px.carnot.planpb.TopNOperator.SortKey")
+	proto.RegisterType((*SampleOperator)(nil), "px.carnot.planpb.SampleOperator")
 	proto.RegisterType((*UnionOperator)(nil), "px.carnot.planpb.UnionOperator")
 	proto.RegisterType((*UnionOperator_ColumnMapping)(nil), "px.carnot.planpb.UnionOperator.ColumnMapping")
 	proto.RegisterType((*JoinOperator)(nil), "px.carnot.planpb.JoinOperator")
@@ -3169,209 +3438,230 @@ func init() {
 func init() { proto.RegisterFile("src/carnot/planpb/plan.proto", fileDescriptor_e5dcfc8666ec3f33) }
 
 var fileDescriptor_e5dcfc8666ec3f33 = []byte{
-	// 3191 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd4, 0x59, 0xcf, 0x6f, 0x1b, 0xc7,
-	0xf5, 0xe7, 0x92, 0x14, 0x45, 0x3e, 0xfe, 0x10, 0x35, 0xb6, 0x1c, 0x99, 0xb6, 0x29, 0x87, 0xb1,
-	0xbf, 0x51, 0xfc, 0x4d, 0x68, 0x5b, 0x76, 0x5c, 0xc7, 0x71, 0x9a, 0x50, 0x12, 0x25, 0x51, 0x91,
-	0x44, 0x75, 0x44, 0x25, 0x4d, 0x1b, 0x74, 0x31, 0xe2, 0x8e, 0xd6, 0x1b, 0x93, 0xbb, 0x9b, 0xfd,
-	0x11, 0x4b, 0x01, 0x8a, 0xa6, 0xe8, 0xa5, 0x87, 0x14, 0xe8, 0xa1, 0x87, 0xa2, 0xf7, 0x16, 0x39,
-	0x15, 0x39, 0xf4, 0x0f, 0x68, 0x81, 0x02, 0xe9, 0xa1, 0x08, 0xdc, 0xa2, 0x87, 0x9c, 0x8c, 0x58,
-	0xb9, 0xf8, 0xd0, 0x43, 0x7a, 0xef, 0xa1, 0x98, 0x1f, 0x4b, 0x2e, 0xc9, 0xa5, 0xa5, 0xe4, 0x50,
-	0xa0, 0x07, 0x89, 0x3b, 0x6f, 0x3e, 0xef, 0xcd, 0xfb, 0x35, 0x6f, 0xde, 0xec, 0xc2, 0x79, 0xd7,
-	0x69, 0x5f, 0x6d, 0x13, 0xc7, 0xb4, 0xbc, 0xab, 0x76, 0x87, 0x98, 0xf6, 0x1e, 0xff, 0xa9, 0xda,
-	0x8e, 0xe5, 0x59, 0xa8, 0x68, 0x1f, 0x54, 0xc5, 0x64, 0x55, 0x4c, 0x96, 0x5e, 0xd2, 0x0d, 0xef,
-	0x9e, 0xbf, 0x57, 0x6d, 0x5b, 0xdd, 0xab, 0xba, 0xa5, 0x5b, 0x57, 0x39, 0x70, 0xcf, 0xdf, 0xe7,
-	0x23, 0x3e, 0xe0, 0x4f, 0x42, 0x40, 0xa9, 0xac, 0x5b, 0x96, 0xde, 0xa1, 0x7d, 0xd4, 0x03, 0x87,
-	0xd8, 0x36, 0x75, 0x5c, 0x39, 0x3f, 0xc7, 0x96, 0x27, 0xb6, 0x21, 0x00, 0x57, 0x7d, 0xdf, 0xd0,
-	0xec, 0x3d, 0xfe, 0x23, 0x01, 0x97, 0x18, 0xc0, 0xbd, 0x47, 0x1c, 0xaa, 0x5d, 0xf5, 0x0e, 0x6d,
-	0xea, 0x8a, 0xff, 0xf6, 0x9e, 0xf8, 0x15, 0xa8, 0xca, 0x4f, 0x15, 0xc8, 0x6e, 0x77, 0x88, 0xd9,
-	0xb4, 0x3d, 0xc3, 0x32, 0x5d, 0x34, 0x0b, 0x93, 0xf4, 0xc0, 0xee, 0x10, 0xc3, 0x9c, 0x8d, 0x5f,
-	0x54, 0xe6, 0xd3, 0x38, 0x18, 0xb2, 0x19, 0x62, 0x92, 0xce, 0xe1, 0x87, 0x74, 0x36, 0x21, 0x66,
-	0xe4, 0x10, 0xdd, 0x86, 0xb3, 0x5d, 0x72, 0xa0, 0x5a, 0xbe, 0x67, 0xfb, 0x9e, 0xea, 0x58, 0x0f,
-	0x5c, 0xd5, 0xa6, 0x8e, 0xea, 0x91, 0xbd, 0x0e, 0x9d, 0x4d, 0x5e, 0x54, 0xe6, 0x13, 0x78, 0xa6,
-	0x4b, 0x0e, 0x9a, 0x7c, 0x1e, 0x5b, 0x0f, 0xdc, 0x6d, 0xea, 0xb4, 0xd8, 0xe4, 0x7a, 0x32, 0xad,
-	0x14, 0xe3, 0x95, 0xc7, 0x09, 0x48, 0x32, 0x1d, 0xd0, 0xf3, 0x90, 0xd0, 0x88, 0x3e, 0xab, 0x5c,
-	0x54, 0xe6, 0xb3, 0x0b, 0x33, 0xd5, 0x61, 0x17, 0x56, 0x97, 0x6b, 0xab, 0x98, 0x21, 0xd0, 0x4d,
-	0x98, 0x30, 0x2d, 0x8d, 0xba, 0xb3, 0xf1, 0x8b, 0x89, 0xf9, 0xec, 0x42, 0x79, 0x14, 0xca, 0xe4,
-	0xad, 0x38, 0x44, 0xef, 0x52, 0xd3, 0xc3, 0x02, 0x8c, 0xde, 0x80, 0x1c, 0x9b, 0x55, 0x2d, 0x61,
-	0x2b, 0x57, 0x2d, 0xbb, 0x70, 0x21, 0x9a, 0x59, 0x3a, 0x04, 0x67, 0xed, 0x90, 0x77, 0x76, 0x00,
-	0x19, 0x66, 0xdb, 0xea, 0x1a, 0xa6, 0xae, 0x12, 0x9d, 0x9a, 0x9e, 0x6a, 0x68, 0xee, 0xec, 0x04,
-	0x57, 0x62, 0x8a, 0xc9, 0x11, 0x61, 0xa8, 0xee, 0xee, 0x36, 0x96, 0x17, 0x4f, 0x1f, 0x3d, 0x9a,
-	0x2b, 0x36, 0x24, 0xbc, 0xc6, 0xd0, 0x8d, 0x65, 0x17, 0x17, 0x8d, 0x01, 0x8a, 0xe6, 0x22, 0x1f,
-	0x2e, 0xd0, 0x03, 0xda, 0xf6, 0xd9, 0x12, 0xaa, 0xeb, 0x11, 0xcf, 0x77, 0x55, 0x8d, 0xba, 0x9e,
-	0x61, 0x12, 0xa1, 0x67, 0x8a, 0xcb, 0xbf, 0x1e, 0xad, 0x67, 0xb5, 0x1e, 0xf0, 0xee, 0x70, 0xd6,
-	0xe5, 0x3e, 0x27, 0x3e, 0x47, 0xc7, 0xce, 0xb9, 0xa5, 0x7d, 0x28, 0x8d, 0x67, 0x45, 0xcf, 0x42,
-	0x4e, 0x77, 0xec, 0xb6, 0x4a, 0x34, 0xcd, 0xa1, 0xae, 0xcb, 0x63, 0x92, 0xc1, 0x59, 0x46, 0xab,
-	0x09, 0x12, 0xba, 0x0c, 0x05, 0xd7, 0xed, 0xa8, 0x1e, 0x71, 0x74, 0xea, 0x99, 0xa4, 0x4b, 0x79,
-	0xc6, 0x64, 0x70, 0xde, 0x75, 0x3b, 0xad, 0x1e, 0x71, 0x3d, 0x99, 0x4e, 0x14, 0x93, 0x95, 0x43,
-	0xc8, 0x85, 0x43, 0x82, 0x0a, 0x10, 0x37, 0x34, 0x2e, 0x35, 0x89, 0xe3, 0x86, 0x16, 0x84, 0x3e,
-	0x7e, 0x6c, 0xe8, 0xaf, 0x05, 0xa1, 0x4f, 0x70, 0xaf, 0x94, 0xa2, 0xbd, 0xb2, 0x65, 0x69, 0x54,
-	0x86, 0xbd, 0xf2, 0x5b, 0x05, 0x12, 0xcb, 0xb5, 0x55, 0x74, 0x23, 0xe0, 0x54, 0x38, 0xe7, 0x85,
-	0xc8, 0x45, 0xd8, 0x5f, 0x88, 0xb9, 0x64, 0xc0, 0xa4, 0xa4, 0x8c, 0xa8, 0xcc, 0xec, 0xb7, 0x1c,
-	0x8f, 0x6a, 0xaa, 0x4d, 0x1c, 0x6a, 0x7a, 0x2c, 0xa1, 0x12, 0xf3, 0x49, 0x9c, 0x17, 0xd4, 0x6d,
-	0x41, 0x44, 0xcf, 0xc3, 0x94, 0x84, 0xb5, 0xef, 0x19, 0x1d, 0xcd, 0xa1, 0x26, 0x57, 0x3d, 0x89,
-	0x25, 0xf7, 0x92, 0xa4, 0x56, 0x56, 0x20, 0x1d, 0xa8, 0x3e, 0xb2, 0xd6, 0x15, 0x88, 0x5b, 0xb6,
-	0xf4, 0x4e, 0x84, 0xc9, 0x4d, 0x9b, 0x3a, 0xc4, 0xb3, 0x1c, 0x1c, 0xb7, 0xec, 0xca, 0xcf, 0xd2,
-	0x90, 0x0e, 0x08, 0xe8, 0x3b, 0x30, 0x69, 0xd9, 0x2a, 0xdb, 0xf1, 0x5c, 0x5a, 0x21, 0x6a, 0xaf,
-	0x04, 0xe0, 0xd6, 0xa1, 0x4d, 0x71, 0xca, 0xb2, 0xd9, 0x2f, 0xda, 0x80, 0x7c, 0x97, 0x76, 0x55,
-	0xd7, 0xf2, 0x9d, 0x36, 0x55, 0x7b, 0x8b, 0xff, 0xdf, 0x28, 0xfb, 0x26, 0xed, 0x5a, 0xce, 0xe1,
-	0x0e, 0x07, 0x06, 0xa2, 0xd6, 0x62, 0x38, 0xdb, 0xa5, 0xdd, 0x80, 0x88, 0x6e, 0x41, 0xaa, 0x4b,
-	0x6c, 0x26, 0x26, 0x31, 0x6e, 0xd3, 0x6d, 0x12, 0x3b, 0xc4, 0x3d, 0xd1, 0x65, 0x43, 0x74, 0x17,
-	0x52, 0x44, 0xd7, 0x19, 0x9f, 0xd8, 0xac, 0xcf, 0x8d, 0xf2, 0xd5, 0x74, 0xdd, 0xa1, 0x3a, 0xf1,
-	0xc2, 0x6b, 0x4f, 0x10, 0x5d, 0x6f, 0xda, 0x68, 0x05, 0xb2, 0xdc, 0x06, 0xc3, 0xbc, 0xcf, 0x44,
-	0x4c, 0x70, 0x11, 0x97, 0xc6, 0x5a, 0x60, 0x98, 0xf7, 0x43, 0x32, 0x32, 0x4c, 0x7f, 0x4e, 0x42,
-	0xaf, 0x43, 0x66, 0xdf, 0xe8, 0x78, 0xd4, 0x61, 0x52, 0x52, 0x5c, 0xca, 0xc5, 0x51, 0x29, 0x2b,
-	0x1c, 0x12, 0x92, 0x90, 0xde, 0x97, 0x14, 0x74, 0x17, 0xd2, 0x1d, 0xa3, 0x6b, 0x78, 0x8c, 0x7f,
-	0x92, 0xf3, 0xcf, 0x8d, 0xf2, 0x6f, 0x30, 0x44, 0x88, 0x7d, 0xb2, 0x23, 0x08, 0x8c, 0xdb, 0x37,
-	0x59, 0x71, 0xb0, 0xec, 0xd9, 0xf4, 0x38, 0xee, 0x5d, 0x86, 0x08, 0x73, 0xfb, 0x82, 0x80, 0x7e,
-	0x04, 0x05, 0xbe, 0x93, 0xfb, 0x91, 0xcc, 0x8c, 0xf3, 0xc3, 0x2a, 0xde, 0x5e, 0x1a, 0x8c, 0xe3,
-	0x62, 0xf1, 0xe8, 0xd1, 0x5c, 0x2e, 0x4c, 0x5f, 0x8b, 0x61, 0x5e, 0x19, 0x7a, 0xa1, 0x7d, 0x5b,
-	0x56, 0x8a, 0xc0, 0xcb, 0x4f, 0x84, 0x81, 0x95, 0x31, 0xe2, 0x43, 0x4e, 0x5e, 0x2c, 0x1c, 0x3d,
-	0x9a, 0x83, 0x3e, 0x75, 0x2d, 0x86, 0x81, 0x8b, 0x16, 0x5e, 0x7f, 0x05, 0x26, 0xdf, 0xb3, 0x0c,
-	0x6e, 0x75, 0x96, 0x8b, 0x8c, 0x48, 0xdd, 0x75, 0xcb, 0x08, 0x1b, 0x9d, 0x7a, 0x8f, 0x8f, 0xd1,
-	0x06, 0x14, 0x7c, 0xcd, 0xdb, 0x0f, 0xd9, 0x9c, 0x1b, 0x67, 0xf3, 0xee, 0x72, 0x6b, 0x65, 0x24,
-	0x77, 0x73, 0x8c, 0xbb, 0x67, 0x61, 0x13, 0xa6, 0x68, 0xd7, 0xf6, 0x0e, 0x43, 0xe2, 0xf2, 0x5c,
-	0xdc, 0xe5, 0x51, 0x71, 0x75, 0x06, 0x1c, 0x91, 0x97, 0xa7, 0x61, 0x32, 0x7a, 0x17, 0x72, 0x96,
-	0x47, 0x3b, 0x3d, 0x97, 0x15, 0xb8, 0xb4, 0xf9, 0x88, 0x9d, 0xd9, 0xa2, 0x9d, 0xfa, 0x81, 0x6d,
-	0x39, 0xde, 0xa8, 0xdf, 0xd8, 0x5c, 0xdf, 0x6f, 0x4c, 0x9e, 0x18, 0x2d, 0x26, 0x59, 0xad, 0xa8,
-	0xfc, 0x2d, 0x0e, 0xa7, 0xa3, 0x76, 0x26, 0x42, 0x90, 0xe4, 0xc5, 0x5a, 0x54, 0x74, 0xfe, 0x8c,
-	0xe6, 0x20, 0xdb, 0xb6, 0x3a, 0x7e, 0xd7, 0x54, 0x0d, 0xed, 0x40, 0x9c, 0xaa, 0x09, 0x0c, 0x82,
-	0xd4, 0xd0, 0x0e, 0x5c, 0x76, 0x1c, 0x48, 0x00, 0xc3, 0x8b, 0xe2, 0x9b, 0xc1, 0x92, 0x69, 0x8b,
-	0x91, 0xd0, 0xcb, 0x3d, 0x08, 0xef, 0x2f, 0x78, 0x31, 0x2c, 0x2c, 0x20, 0x66, 0x94, 0x68, 0x38,
-	0x96, 0x89, 0x47, 0x78, 0x89, 0x91, 0x6c, 0xec, 0xd9, 0x45, 0x77, 0x00, 0x5c, 0x8f, 0x38, 0x9e,
-	0xea, 0x19, 0x5d, 0x2a, 0xb7, 0xe8, 0xb9, 0xaa, 0x68, 0x7e, 0xaa, 0x41, 0xf3, 0x53, 0x6d, 0x98,
-	0xde, 0xad, 0x9b, 0x6f, 0x91, 0x8e, 0x4f, 0x71, 0x86, 0xc3, 0x5b, 0x46, 0x97, 0x35, 0x1e, 0x19,
-	0xd7, 0x63, 0xe5, 0x8d, 0xb1, 0xa6, 0x8e, 0x67, 0x4d, 0x33, 0x34, 0xe7, 0x3c, 0x03, 0x29, 0xde,
-	0x9e, 0x78, 0x7c, 0x3b, 0x66, 0xb0, 0x1c, 0xa1, 0xf3, 0x4c, 0xa2, 0x43, 0x09, 0x3b, 0xa0, 0xf9,
-	0x5e, 0x4b, 0xe3, 0x3e, 0xa1, 0xf2, 0xb9, 0x02, 0x68, 0xb4, 0x56, 0x44, 0x7a, 0x74, 0xd8, 0x1b,
-	0xf1, 0x93, 0x79, 0xe3, 0x04, 0x7e, 0x5e, 0x87, 0x19, 0x09, 0x71, 0x69, 0x97, 0x98, 0x9e, 0xd1,
-	0x1e, 0x70, 0xf8, 0x99, 0xfe, 0x12, 0x3b, 0x72, 0x9e, 0x2f, 0x73, 0x4a, 0x30, 0x85, 0x69, 0x6e,
-	0xc5, 0x04, 0x34, 0xba, 0xe7, 0x47, 0x74, 0x57, 0xbe, 0x9d, 0xee, 0xf1, 0x11, 0xdd, 0x2b, 0x9f,
-	0x27, 0xa1, 0x38, 0x5c, 0x05, 0x78, 0x63, 0x39, 0xd0, 0x65, 0x04, 0x43, 0x74, 0x7b, 0xb0, 0x74,
-	0x19, 0x1a, 0x3f, 0x3d, 0x92, 0xc3, 0x45, 0xa9, 0xb1, 0x3c, 0x58, 0x94, 0x1a, 0x1a, 0xda, 0x81,
-	0x9c, 0x6c, 0x47, 0xfb, 0x5d, 0x68, 0x76, 0xa1, 0x7a, 0x7c, 0x4d, 0xaa, 0x62, 0xea, 0xfa, 0x1d,
-	0x8f, 0xb7, 0xa7, 0xec, 0x10, 0x13, 0x52, 0xf8, 0x10, 0xe9, 0x80, 0xda, 0x96, 0x69, 0xd2, 0xb6,
-	0x27, 0x8a, 0xb1, 0xe8, 0xce, 0x44, 0xca, 0xde, 0x3e, 0x81, 0x68, 0x46, 0x58, 0xea, 0x09, 0x08,
-	0x1a, 0xcc, 0xe9, 0xf6, 0x30, 0xa9, 0xf4, 0x77, 0x05, 0xb2, 0x21, 0x3d, 0xd0, 0x05, 0x00, 0x6e,
-	0x86, 0x1a, 0x4a, 0xb3, 0x0c, 0xa7, 0x6c, 0xfd, 0xcf, 0xe4, 0x5a, 0xe9, 0xbb, 0x30, 0x13, 0xe9,
-	0x80, 0x88, 0x3e, 0x52, 0x89, 0xe8, 0x23, 0x17, 0xf3, 0x90, 0x0d, 0x75, 0xc5, 0xeb, 0xc9, 0x74,
-	0xbc, 0x98, 0xa8, 0x7c, 0x00, 0xd9, 0x50, 0xdf, 0x80, 0x96, 0x21, 0x4b, 0x0f, 0x6c, 0x96, 0x3b,
-	0x3c, 0x34, 0xa2, 0xd1, 0x8b, 0x38, 0x89, 0x76, 0xda, 0xa4, 0x43, 0x9c, 0x7a, 0x0f, 0x8a, 0xc3,
-	0x6c, 0x27, 0x49, 0xe4, 0xdf, 0xc7, 0x61, 0x7a, 0xa4, 0xf1, 0x40, 0xaf, 0x41, 0xea, 0x03, 0x56,
-	0x68, 0x82, 0x95, 0x2f, 0x3f, 0xa5, 0x5b, 0x09, 0x2d, 0x2e, 0x99, 0xd0, 0x35, 0x48, 0xe9, 0x8e,
-	0xe5, 0xdb, 0xc1, 0xb5, 0x66, 0x76, 0x94, 0x7d, 0x89, 0xeb, 0x80, 0x25, 0x8e, 0xd5, 0x6d, 0xfe,
-	0x34, 0x10, 0x41, 0xe0, 0x24, 0x11, 0xc0, 0x39, 0xc8, 0x72, 0xe1, 0x12, 0x90, 0x14, 0x00, 0x4e,
-	0x12, 0x80, 0x12, 0xa4, 0x1f, 0x18, 0xa6, 0x66, 0x3d, 0xa0, 0x1a, 0xcf, 0xe4, 0x34, 0xee, 0x8d,
-	0x19, 0xb3, 0x4d, 0x1c, 0xcf, 0x20, 0x1d, 0x95, 0xe8, 0x3a, 0x2f, 0xb0, 0x69, 0x0c, 0x92, 0x54,
-	0xd3, 0x75, 0xf4, 0x02, 0x14, 0xf7, 0x0d, 0x93, 0x74, 0x8c, 0x0f, 0xa9, 0xea, 0xf0, 0x7c, 0x75,
-	0x79, 0x3d, 0x4d, 0xe3, 0xa9, 0x80, 0x2e, 0xd2, 0xd8, 0xad, 0xfc, 0x5c, 0x81, 0xc2, 0x60, 0x83,
-	0x84, 0x16, 0x01, 0xfa, 0x5e, 0x97, 0x97, 0xbe, 0x93, 0xc4, 0x2a, 0xc4, 0x85, 0x16, 0x60, 0x52,
-	0x84, 0xe5, 0x78, 0x9f, 0x05, 0xc0, 0xca, 0x47, 0x0a, 0xe4, 0x07, 0x7a, 0x2d, 0x74, 0x1a, 0x26,
-	0x78, 0xaf, 0xc5, 0x95, 0x48, 0x60, 0x31, 0xf8, 0x36, 0xb2, 0x59, 0x2e, 0x93, 0x3d, 0xcb, 0x11,
-	0xbb, 0xd5, 0x75, 0xda, 0xae, 0xec, 0xf5, 0xf3, 0x3d, 0xea, 0x8e, 0xd3, 0x76, 0x2b, 0x4f, 0x14,
-	0xc8, 0x0f, 0x34, 0x6c, 0x23, 0x39, 0xa7, 0x8c, 0x6e, 0xc6, 0xb7, 0x60, 0x4a, 0x42, 0xba, 0xc4,
-	0xb6, 0x0d, 0x53, 0x0f, 0xf4, 0x7a, 0xe9, 0x98, 0x6e, 0x50, 0x6a, 0xb9, 0x29, 0xb8, 0x70, 0xa1,
-	0x1d, 0x1e, 0xba, 0xe8, 0x12, 0x14, 0x7a, 0x77, 0xf6, 0x3d, 0xe2, 0xb5, 0xef, 0x89, 0x2a, 0x8b,
-	0x73, 0x8e, 0xb8, 0xaa, 0x2f, 0x32, 0x5a, 0xe9, 0x16, 0xe4, 0x07, 0xc4, 0x30, 0x53, 0x83, 0x9e,
-	0xc1, 0xd4, 0xe8, 0x81, 0xd4, 0x39, 0x81, 0xf3, 0xb2, 0x6d, 0x10, 0xc4, 0xca, 0x67, 0x49, 0xc8,
-	0x85, 0xbb, 0x34, 0xf4, 0x2a, 0x24, 0x43, 0xd7, 0x91, 0xe7, 0x9f, 0xde, 0xd3, 0xf1, 0x01, 0xaf,
-	0x29, 0x9c, 0x09, 0x11, 0x38, 0x45, 0xdf, 0xf7, 0x49, 0xc7, 0xf0, 0x0e, 0xd5, 0xb6, 0x65, 0x6a,
-	0x86, 0xa8, 0xc1, 0xc2, 0x0f, 0xd7, 0x8e, 0x91, 0x55, 0x97, 0x9c, 0x4b, 0x01, 0x23, 0x46, 0x74,
-	0x98, 0xe4, 0x22, 0x0c, 0x05, 0x79, 0x74, 0x04, 0xd1, 0x17, 0x37, 0xcd, 0xff, 0x3f, 0x46, 0xba,
-	0xb8, 0xef, 0xc9, 0x84, 0xc8, 0x0b, 0x11, 0x4b, 0x32, 0x2d, 0x86, 0xa3, 0x9b, 0x1c, 0x8d, 0xee,
-	0x68, 0x14, 0x26, 0x22, 0xa2, 0xd0, 0x85, 0xe9, 0x11, 0x2b, 0xd0, 0x15, 0x98, 0xee, 0xd0, 0xfd,
-	0x40, 0x5f, 0x11, 0x0e, 0x79, 0x77, 0x9c, 0x62, 0x13, 0x4b, 0xfd, 0x80, 0xa0, 0x17, 0x01, 0x39,
-	0x86, 0x7e, 0x6f, 0x08, 0x1c, 0xe7, 0xe0, 0x22, 0x9f, 0x09, 0xa1, 0x4b, 0x2d, 0xc8, 0x85, 0xcd,
-	0x62, 0x76, 0x88, 0xbb, 0xee, 0xc0, 0x22, 0x59, 0x41, 0x13, 0x0b, 0xf4, 0x4d, 0x0d, 0x8b, 0xce,
-	0x86, 0x92, 0xa2, 0xf2, 0x32, 0xa4, 0x83, 0xb0, 0xa2, 0x0c, 0x4c, 0x34, 0xb6, 0xb6, 0xea, 0xb8,
-	0x18, 0x43, 0x05, 0x80, 0x8d, 0xfa, 0x4a, 0x4b, 0x6d, 0xee, 0xb6, 0xea, 0xb8, 0xa8, 0xb0, 0xf1,
-	0xca, 0xee, 0xc6, 0x86, 0x1c, 0x27, 0x2a, 0xfb, 0x80, 0x46, 0x9b, 0xf5, 0xc8, 0xe6, 0xeb, 0x2e,
-	0x00, 0x71, 0x74, 0x55, 0xd6, 0xe2, 0xf8, 0xb8, 0xeb, 0xbe, 0xa8, 0x2c, 0xb2, 0xab, 0x24, 0x8e,
-	0xce, 0x9f, 0xdc, 0x8a, 0x05, 0xa7, 0x22, 0xba, 0xf8, 0x93, 0xec, 0xd0, 0x6f, 0x77, 0x10, 0x57,
-	0x3e, 0x4e, 0x42, 0x9a, 0x77, 0xf3, 0x36, 0x61, 0x2e, 0xce, 0x32, 0xf9, 0xaa, 0xeb, 0x39, 0xac,
-	0x07, 0xe5, 0x66, 0xb1, 0x06, 0x9f, 0x11, 0x77, 0x38, 0x0d, 0xbd, 0x08, 0xd3, 0x1c, 0x32, 0xe2,
-	0xe7, 0xc4, 0x5a, 0x0c, 0x4f, 0xb1, 0xa9, 0x70, 0xc4, 0x5f, 0x07, 0x20, 0x9e, 0xe7, 0x18, 0x7b,
-	0xbe, 0xd7, 0x7b, 0x6b, 0x32, 0x17, 0x7d, 0xd5, 0xa8, 0x05, 0x38, 0x1c, 0x62, 0x41, 0xcb, 0x30,
-	0xe3, 0x39, 0x84, 0xf7, 0x5f, 0x83, 0x4b, 0xf2, 0x57, 0x7b, 0x8b, 0xd3, 0x47, 0x8f, 0xe6, 0xf2,
-	0x2d, 0x06, 0x68, 0x2c, 0xcb, 0xec, 0x47, 0x1c, 0xdf, 0xd0, 0xc2, 0x6a, 0xd4, 0xe0, 0xb4, 0x6b,
-	0x13, 0x73, 0x44, 0xc8, 0x04, 0x17, 0xc2, 0x3b, 0x3a, 0x66, 0x7f, 0x4f, 0xc6, 0x34, 0x43, 0x0f,
-	0x8a, 0x68, 0xc1, 0x39, 0x99, 0x7d, 0x91, 0x92, 0x52, 0x5c, 0xd2, 0x99, 0xa3, 0x47, 0x73, 0x48,
-	0x24, 0xed, 0x80, 0xbc, 0x67, 0xec, 0x3e, 0x6d, 0x40, 0xea, 0xcb, 0xf0, 0x4c, 0xff, 0x02, 0x32,
-	0x28, 0x71, 0x92, 0x1f, 0x07, 0xa7, 0x7b, 0x17, 0x8e, 0x30, 0xdb, 0x75, 0x98, 0xa1, 0xa6, 0x16,
-	0xc1, 0x94, 0xe6, 0x4c, 0x88, 0x9a, 0xda, 0x30, 0xcb, 0x05, 0x80, 0xfb, 0x86, 0xa9, 0x89, 0xbc,
-	0xe4, 0xb7, 0xf0, 0x04, 0xce, 0x30, 0x0a, 0x4f, 0xbc, 0xc5, 0x94, 0xc8, 0xe4, 0xca, 0x8f, 0x61,
-	0x8a, 0x05, 0x63, 0x93, 0x7a, 0x8e, 0xd1, 0x5e, 0x25, 0xbe, 0x4e, 0x51, 0x15, 0xd0, 0x7e, 0xc7,
-	0x22, 0x11, 0x5b, 0x9c, 0x85, 0xbc, 0xc8, 0xe7, 0xc2, 0x2b, 0x5d, 0x81, 0xa2, 0x61, 0x7a, 0xd1,
-	0x09, 0x52, 0x30, 0xcc, 0x30, 0x76, 0xb1, 0x00, 0x39, 0xd1, 0x22, 0x08, 0x74, 0xe5, 0x77, 0x71,
-	0x98, 0xee, 0xaf, 0xbf, 0xe3, 0x77, 0xbb, 0xc4, 0x39, 0x64, 0x75, 0xa3, 0x6d, 0xf9, 0x66, 0x94,
-	0x06, 0xb8, 0xc8, 0x67, 0xc2, 0xeb, 0xcf, 0x43, 0xd1, 0xf5, 0xbb, 0x11, 0xeb, 0xe3, 0x82, 0xeb,
-	0x77, 0xc3, 0xc8, 0x77, 0x61, 0xea, 0x7d, 0x9f, 0x75, 0x89, 0x1d, 0x1a, 0xec, 0x57, 0x91, 0xa2,
-	0x37, 0xa2, 0x53, 0x74, 0x40, 0xab, 0x2a, 0x77, 0x5c, 0xcd, 0xfb, 0x9e, 0x94, 0x80, 0x0b, 0x81,
-	0x2c, 0xb1, 0x95, 0x4b, 0x3f, 0x84, 0xa9, 0x21, 0x08, 0x6b, 0x78, 0x02, 0x10, 0x57, 0x5f, 0xc1,
-	0xbd, 0x31, 0x33, 0x32, 0xec, 0x8a, 0x01, 0xc5, 0x8b, 0x7c, 0x26, 0xa4, 0x7a, 0xe5, 0xd3, 0x38,
-	0xe4, 0x07, 0x76, 0x4d, 0x64, 0x2d, 0x7a, 0x03, 0x52, 0x42, 0xda, 0xf8, 0x17, 0x68, 0x03, 0x42,
-	0xe4, 0x61, 0xbd, 0x16, 0xc3, 0x92, 0x0f, 0x3d, 0x07, 0x39, 0x51, 0x0c, 0x64, 0xe2, 0x24, 0x64,
-	0x49, 0xc8, 0x0a, 0x2a, 0x37, 0xb0, 0xf4, 0x1b, 0x05, 0x52, 0xb2, 0x48, 0xdf, 0xe8, 0x5d, 0xe6,
-	0x43, 0xe7, 0x6c, 0x54, 0x11, 0x82, 0x7e, 0x11, 0x8a, 0x2c, 0xdb, 0x89, 0x81, 0xb2, 0x8d, 0x6e,
-	0xc3, 0xd9, 0x36, 0x31, 0xd5, 0x3d, 0xaa, 0xbe, 0xe7, 0x5a, 0xa6, 0x4a, 0xcd, 0xb6, 0xa5, 0x51,
-	0x4d, 0x25, 0x8e, 0x43, 0x0e, 0xe5, 0x27, 0x81, 0x99, 0x36, 0x31, 0x17, 0xe9, 0xba, 0x6b, 0x99,
-	0x75, 0x31, 0x5b, 0x63, 0x93, 0x8b, 0x93, 0x30, 0xc1, 0x55, 0xaf, 0x7c, 0x16, 0x07, 0xe8, 0x47,
-	0x31, 0xd2, 0x5f, 0x17, 0x79, 0x9b, 0xdf, 0x76, 0x0c, 0x7e, 0x3b, 0x90, 0xaf, 0x94, 0xc3, 0x24,
-	0xc6, 0xe5, 0x9b, 0x86, 0x27, 0xfc, 0x80, 0xf9, 0xf3, 0x50, 0x91, 0x4b, 0x7e, 0xf3, 0x22, 0x77,
-	0x05, 0xa6, 0x47, 0xb7, 0x32, 0xaf, 0x4d, 0x78, 0xca, 0x1b, 0xda, 0xc7, 0xaf, 0xc0, 0x84, 0xce,
-	0xb6, 0xe5, 0x2c, 0xe5, 0x11, 0x7d, 0xf6, 0x69, 0x99, 0xca, 0xf7, 0xef, 0x5a, 0x0c, 0x0b, 0x0e,
-	0xf4, 0x3a, 0x4c, 0xba, 0x22, 0x77, 0x67, 0xf7, 0xc7, 0xbd, 0xd0, 0x1c, 0x49, 0xf3, 0xb5, 0x18,
-	0x0e, 0xb8, 0x58, 0x91, 0xd0, 0x88, 0x47, 0x2a, 0xff, 0x50, 0x00, 0xf1, 0xb7, 0x43, 0xa6, 0x66,
-	0x5b, 0x7c, 0x47, 0x9b, 0xfb, 0x86, 0x8e, 0xce, 0x42, 0xc2, 0x77, 0x3a, 0xc2, 0xa1, 0x8b, 0x93,
-	0x47, 0x8f, 0xe6, 0x12, 0xbb, 0x78, 0x03, 0x33, 0x1a, 0x7a, 0x13, 0x26, 0xef, 0x51, 0xa2, 0x51,
-	0x27, 0x38, 0x11, 0xaf, 0x8f, 0x79, 0xdf, 0x34, 0x20, 0xb1, 0xba, 0x26, 0x78, 0xea, 0xa6, 0xe7,
-	0x1c, 0xe2, 0x40, 0x02, 0xdb, 0x45, 0x86, 0xe9, 0xd2, 0xb6, 0xef, 0x04, 0x5f, 0x83, 0x7a, 0xe3,
-	0xd2, 0x1d, 0xc8, 0x85, 0x99, 0x50, 0x11, 0x12, 0xf7, 0xe9, 0xa1, 0x0c, 0x32, 0x7b, 0x64, 0xfd,
-	0xb6, 0x48, 0x65, 0x11, 0x5d, 0x31, 0xb8, 0x13, 0xbf, 0xad, 0x54, 0x9a, 0x90, 0x63, 0x3a, 0x60,
-	0x2a, 0xae, 0xfc, 0x43, 0x71, 0x55, 0xbe, 0x71, 0x5c, 0x2b, 0xbf, 0x88, 0xc3, 0x99, 0xe8, 0xb7,
-	0x68, 0x68, 0x13, 0xa6, 0xa8, 0xb4, 0x95, 0xf5, 0x92, 0xfb, 0x46, 0xf0, 0xe5, 0xe9, 0xd2, 0x49,
-	0x1c, 0x83, 0x0b, 0x74, 0xd0, 0xf5, 0x77, 0x20, 0xed, 0x48, 0xb5, 0xe5, 0x56, 0x2f, 0x47, 0xcb,
-	0x09, 0x8c, 0xc3, 0x3d, 0x3c, 0xba, 0x05, 0x93, 0x5d, 0x1e, 0xf1, 0xa0, 0xfa, 0x9d, 0x7f, 0x5a,
-	0x5a, 0xe0, 0x00, 0x8c, 0xae, 0xc1, 0x04, 0x3b, 0x0a, 0x83, 0x8c, 0x2f, 0x45, 0x73, 0xb1, 0x33,
-	0x0f, 0x0b, 0x60, 0xe5, 0x8f, 0x0a, 0x14, 0x87, 0x6f, 0x54, 0xe8, 0x55, 0x48, 0xb7, 0x2d, 0xd3,
-	0xf5, 0x88, 0xe9, 0x49, 0x17, 0x3c, 0xbd, 0x5b, 0x5a, 0x8b, 0xe1, 0x1e, 0x03, 0x5a, 0x18, 0x2a,
-	0x70, 0x63, 0x6f, 0x49, 0xa1, 0x92, 0xb6, 0x00, 0xc9, 0x7d, 0xdf, 0x6c, 0xcb, 0x8f, 0x01, 0xe7,
-	0xc7, 0x2d, 0xb6, 0xe2, 0x9b, 0xed, 0xb5, 0x18, 0xe6, 0xd8, 0x7e, 0x11, 0xf9, 0x53, 0x1c, 0xb2,
-	0x21, 0x65, 0xd0, 0x55, 0xc8, 0xb0, 0x2d, 0x71, 0x5c, 0xb5, 0x4b, 0x6b, 0xf2, 0x09, 0xcd, 0x01,
-	0xec, 0x59, 0x56, 0x47, 0xed, 0xe7, 0x60, 0x7a, 0x2d, 0x86, 0x33, 0x8c, 0x26, 0x24, 0x3e, 0x0b,
-	0x59, 0xc3, 0xf4, 0x6e, 0xdd, 0x0c, 0x15, 0x5c, 0x76, 0x72, 0x82, 0xd1, 0x7b, 0x95, 0x88, 0x2e,
-	0x43, 0x9e, 0x9f, 0xba, 0x3d, 0x10, 0x6b, 0x86, 0x94, 0xb5, 0x18, 0xce, 0x49, 0xb2, 0x80, 0x0d,
-	0xd7, 0xee, 0x89, 0x88, 0xda, 0x8d, 0xe6, 0x81, 0x97, 0x98, 0x5b, 0x37, 0x55, 0xd3, 0x95, 0xb8,
-	0x94, 0x5c, 0x32, 0x2f, 0x26, 0xb6, 0x5c, 0x81, 0xbc, 0x0d, 0x79, 0xdf, 0x30, 0xbd, 0xeb, 0x0b,
-	0xb7, 0x25, 0x4e, 0xbc, 0x6b, 0x9f, 0xee, 0x9b, 0xbb, 0xdb, 0xe0, 0xd3, 0xfc, 0x1d, 0xb6, 0x40,
-	0x8a, 0xe6, 0x22, 0xf0, 0xde, 0x7a, 0x32, 0x9d, 0x2e, 0x66, 0x2a, 0x5f, 0x2a, 0x00, 0x7d, 0x1f,
-	0x47, 0x16, 0xe2, 0x3b, 0x90, 0x31, 0x4c, 0xc3, 0x53, 0x89, 0xa3, 0x9f, 0xb0, 0x87, 0x4e, 0x33,
-	0x7c, 0xcd, 0xd1, 0x5d, 0x74, 0x0b, 0x92, 0x9c, 0x2d, 0x71, 0xe2, 0x17, 0x30, 0x1c, 0x2f, 0x3f,
-	0x7b, 0x89, 0x4f, 0xc6, 0x71, 0x43, 0x43, 0x77, 0x60, 0x8a, 0xd1, 0xd5, 0x5e, 0x7c, 0xc5, 0xc7,
-	0xd6, 0xe8, 0x00, 0xe7, 0x19, 0x34, 0x18, 0xb9, 0x95, 0x7f, 0xc5, 0xe1, 0x54, 0xc4, 0xdb, 0x96,
-	0x9e, 0xad, 0x89, 0x71, 0xb6, 0x26, 0xbf, 0x99, 0xad, 0xaf, 0x49, 0x5b, 0xc5, 0x57, 0xe0, 0x17,
-	0x4e, 0xf4, 0xca, 0xa7, 0x5a, 0x73, 0xf4, 0x01, 0x93, 0x53, 0x4f, 0x33, 0x79, 0xf2, 0x84, 0x26,
-	0x97, 0x7e, 0x02, 0x89, 0x9a, 0xa3, 0xff, 0xd7, 0xb7, 0x73, 0x7f, 0x6b, 0x2e, 0xf4, 0x9a, 0x10,
-	0xe6, 0x65, 0x4b, 0xa3, 0xf2, 0x86, 0xc8, 0x9f, 0x59, 0xd9, 0x0f, 0xdf, 0x09, 0xc5, 0xe0, 0xca,
-	0x3f, 0xe3, 0x90, 0x0b, 0x7f, 0x81, 0x44, 0x67, 0x61, 0xa6, 0xb9, 0x5d, 0xc7, 0xb5, 0x56, 0x13,
-	0xab, 0xad, 0x77, 0xb6, 0xeb, 0xea, 0xee, 0xd6, 0x9b, 0x5b, 0xcd, 0xb7, 0xb7, 0x8a, 0x31, 0x74,
-	0x0e, 0xce, 0x6c, 0xd6, 0x37, 0x9b, 0xf8, 0x1d, 0x75, 0xa7, 0xb9, 0x8b, 0x97, 0xea, 0x6a, 0x00,
-	0x2c, 0x3e, 0x99, 0x44, 0x67, 0xe1, 0xf4, 0x2a, 0xde, 0x5e, 0x1a, 0x99, 0xfa, 0x6b, 0x9a, 0x4d,
-	0xb1, 0xab, 0xe3, 0xc8, 0xd4, 0xa7, 0x19, 0x54, 0x82, 0x99, 0xfa, 0xe6, 0x76, 0x6b, 0x54, 0xe2,
-	0xaf, 0x00, 0x4d, 0x43, 0x6e, 0xb3, 0xb6, 0xdd, 0x27, 0x3d, 0x9c, 0x42, 0xcf, 0x00, 0xaa, 0xad,
-	0xae, 0xe2, 0xfa, 0x6a, 0xad, 0x15, 0xc2, 0xfe, 0xa1, 0x88, 0x4e, 0xc3, 0xd4, 0x4a, 0x63, 0xa3,
-	0x55, 0xc7, 0x7d, 0xea, 0xaf, 0xa7, 0xd1, 0x29, 0x28, 0x6c, 0x34, 0x36, 0x1b, 0xad, 0x3e, 0xf1,
-	0xdf, 0x9c, 0xb8, 0xbb, 0xd5, 0x68, 0x6e, 0xf5, 0x89, 0x5f, 0x22, 0x84, 0x20, 0xbf, 0xde, 0x6c,
-	0x84, 0x68, 0x7f, 0x3e, 0xc5, 0xd4, 0x0e, 0xcc, 0x6d, 0x6c, 0xbd, 0xd9, 0x9f, 0xfa, 0x64, 0x85,
-	0xe9, 0x21, 0x8c, 0x1d, 0x98, 0xf8, 0x78, 0x15, 0x95, 0xe1, 0x6c, 0xb3, 0x55, 0xdf, 0x50, 0xeb,
-	0xdf, 0xdf, 0x6e, 0xe2, 0xd6, 0xd0, 0xfc, 0xd7, 0xab, 0x8b, 0x77, 0x1f, 0x3e, 0x2e, 0xc7, 0xbe,
-	0x78, 0x5c, 0x8e, 0x7d, 0xfd, 0xb8, 0xac, 0x7c, 0x74, 0x54, 0x56, 0x3e, 0x39, 0x2a, 0x2b, 0x7f,
-	0x39, 0x2a, 0x2b, 0x0f, 0x8f, 0xca, 0xca, 0x97, 0x47, 0x65, 0xe5, 0xc9, 0x51, 0x39, 0xf6, 0xf5,
-	0x51, 0x59, 0xf9, 0xe5, 0x57, 0xe5, 0xd8, 0xc3, 0xaf, 0xca, 0xb1, 0x2f, 0xbe, 0x2a, 0xc7, 0x7e,
-	0x90, 0x12, 0xa1, 0xdf, 0x4b, 0xf1, 0xcf, 0x2a, 0x37, 0xfe, 0x13, 0x00, 0x00, 0xff, 0xff, 0x06,
-	0x51, 0xe8, 0x55, 0xfd, 0x22, 0x00, 0x00,
+	// 3419 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd5, 0x5a, 0x4d, 0x8c, 0x23, 0x47,
+	0x15, 0x8e, 0x7f, 0xc6, 0xf6, 0x3c, 0xff, 0x4e, 0xed, 0xce, 0x66, 0xd6, 0xfb, 0x9b, 0xce, 0x6e,
+	0x7e, 0x16, 0xe2, 0xcd, 0xce, 0x26, 0xcb, 0x66, 0x93, 0x90, 0x78, 0x66, 0x3c, 0x13, 0xcf, 0xce,
+	0xd8, 0x93, 0xb6, 0x27, 0x61, 0x21, 0xa2, 0xd5, 0x63, 0xf7, 0x78, 0x3b, 0xb1, 0xbb, 0x4d, 0x77,
+	0x3b, 0xbb, 0x13, 0x09, 0xc1, 0x81, 0x03, 0x87, 0x70, 0x43, 0x08, 0x71, 0x07, 0x71, 0xcc, 0x81,
+	0x2b, 0x08, 0x24, 0x24, 0x2e, 0x28, 0x02, 0xc4, 0x19, 0x05, 0x4e, 0x41, 0xe2, 0x00, 0x77, 0x24,
+	0x78, 0xaf, 0xaa, 0xda, 0x6e, 0xbb, 0xdb, 0x3b, 0x93, 0x3d, 0x20, 0x71, 0x48, 0xd6, 0xf5, 0xea,
+	0x7b, 0xaf, 0xea, 0xfd, 0xd4, 0xab, 0xf7, 0xaa, 0x07, 0xce, 0xbb, 0x4e, 0xe7, 0x7a, 0x47, 0x77,
+	0x2c, 0xdb, 0xbb, 0x3e, 0xec, 0xeb, 0xd6, 0xf0, 0x80, 0xff, 0x53, 0x19, 0x3a, 0xb6, 0x67, 0xb3,
+	0xd2, 0xf0, 0x61, 0x45, 0x4c, 0x56, 0xc4, 0x64, 0xf9, 0x85, 0x9e, 0xe9, 0xdd, 0x1f, 0x1d, 0x54,
+	0x3a, 0xf6, 0xe0, 0x7a, 0xcf, 0xee, 0xd9, 0xd7, 0x39, 0xf0, 0x60, 0x74, 0xc8, 0x47, 0x7c, 0xc0,
+	0x7f, 0x09, 0x01, 0xe5, 0x8b, 0x3d, 0xdb, 0xee, 0xf5, 0x8d, 0x09, 0xea, 0x81, 0xa3, 0x0f, 0x87,
+	0x86, 0xe3, 0xca, 0xf9, 0x4b, 0xb4, 0xbc, 0x3e, 0x34, 0x05, 0xe0, 0xfa, 0x68, 0x64, 0x76, 0x71,
+	0x07, 0xf4, 0x8f, 0x04, 0x5c, 0x21, 0x80, 0x7b, 0x5f, 0x77, 0x8c, 0xee, 0x75, 0xef, 0x68, 0x68,
+	0xb8, 0xe2, 0xff, 0x08, 0xe2, 0xff, 0x0a, 0x94, 0xf2, 0xab, 0x18, 0x64, 0xf7, 0x70, 0x83, 0xcd,
+	0xa1, 0x67, 0xda, 0x96, 0xcb, 0x56, 0x20, 0x6d, 0x3c, 0xc4, 0x1d, 0x9b, 0xd6, 0x4a, 0xfc, 0x72,
+	0xec, 0xb9, 0x8c, 0xea, 0x0f, 0x69, 0x46, 0xb7, 0xf4, 0xfe, 0xd1, 0x47, 0xc6, 0x4a, 0x42, 0xcc,
+	0xc8, 0x21, 0xbb, 0x0d, 0x67, 0x07, 0xfa, 0x43, 0xcd, 0x1e, 0x79, 0xc3, 0x91, 0xa7, 0x39, 0xf6,
+	0x03, 0x57, 0xc3, 0x8d, 0x6a, 0x9e, 0x7e, 0xd0, 0x37, 0x56, 0x92, 0x88, 0x4d, 0xa8, 0xcb, 0x08,
+	0x68, 0xf2, 0x79, 0x15, 0xa7, 0xf7, 0x0c, 0xa7, 0x4d, 0x93, 0xec, 0x55, 0xc8, 0x0c, 0x1d, 0xd3,
+	0x76, 0x4c, 0xef, 0x68, 0x65, 0x01, 0x81, 0x85, 0xd5, 0x4b, 0x95, 0x59, 0xc3, 0x55, 0xde, 0x1e,
+	0x19, 0xce, 0xd1, 0x9e, 0x84, 0xa9, 0x63, 0x86, 0xed, 0x64, 0x26, 0x56, 0x8a, 0x2b, 0x7f, 0x4d,
+	0x40, 0x92, 0x14, 0x60, 0xcf, 0x42, 0xa2, 0xab, 0xf7, 0x56, 0x62, 0x28, 0x26, 0xbb, 0xba, 0x1c,
+	0x16, 0xb3, 0x51, 0xdd, 0x52, 0x09, 0xc1, 0x5e, 0x82, 0x05, 0xcb, 0xee, 0x1a, 0x2e, 0x2a, 0x98,
+	0x40, 0xe8, 0xc5, 0x30, 0x94, 0xe4, 0x6d, 0x3a, 0x7a, 0x6f, 0x60, 0x58, 0x9e, 0x2a, 0xc0, 0xec,
+	0x4d, 0xc8, 0xd1, 0xac, 0x66, 0x0b, 0x43, 0x71, 0xbd, 0xb2, 0xab, 0x17, 0xa2, 0x99, 0xa5, 0x35,
+	0xd5, 0xec, 0x30, 0x60, 0xda, 0x16, 0x30, 0xd3, 0x42, 0xef, 0x9b, 0x56, 0x4f, 0xd3, 0x7b, 0x28,
+	0x5a, 0x33, 0xbb, 0x2e, 0xaa, 0x4d, 0x9b, 0x28, 0x92, 0x1c, 0xe1, 0xc3, 0xca, 0xfe, 0x7e, 0x7d,
+	0x63, 0xed, 0xf4, 0xdf, 0xfe, 0x72, 0xa9, 0x54, 0x97, 0xf0, 0x2a, 0xa1, 0xeb, 0x1b, 0xae, 0x5a,
+	0x32, 0xa7, 0x28, 0x5d, 0x97, 0x8d, 0xe0, 0x82, 0xf1, 0xd0, 0xe8, 0x8c, 0x68, 0x09, 0xcd, 0xf5,
+	0x74, 0x6f, 0xe4, 0x6a, 0xb8, 0x5d, 0xcf, 0xb4, 0x74, 0xb1, 0xcf, 0x14, 0x97, 0x7f, 0x23, 0x7a,
+	0x9f, 0x95, 0x9a, 0xcf, 0xdb, 0xe2, 0xac, 0x1b, 0x13, 0x4e, 0xf5, 0x9c, 0x31, 0x77, 0xce, 0x2d,
+	0x1f, 0x42, 0x79, 0x3e, 0x2b, 0x7b, 0x0a, 0x72, 0x3d, 0x67, 0xd8, 0xd1, 0xf4, 0x6e, 0xd7, 0x31,
+	0x5c, 0x97, 0xfb, 0x64, 0x51, 0xcd, 0x12, 0xad, 0x2a, 0x48, 0xec, 0x2a, 0x14, 0x5c, 0xb7, 0x8f,
+	0x31, 0xe2, 0xf4, 0x0c, 0xcf, 0xd2, 0x07, 0x06, 0x0f, 0xb7, 0x45, 0x35, 0x8f, 0xd4, 0xf6, 0x98,
+	0x88, 0x3e, 0x4e, 0x94, 0x92, 0xca, 0x11, 0xe4, 0x82, 0x2e, 0x61, 0x05, 0x88, 0x9b, 0x5d, 0x2e,
+	0x35, 0xa9, 0xe2, 0x2f, 0xdf, 0xf5, 0xf1, 0x63, 0x5d, 0xff, 0xa2, 0xef, 0xfa, 0x04, 0xb7, 0x4a,
+	0x39, 0xda, 0x2a, 0x0d, 0x84, 0x48, 0xb7, 0x2b, 0x3f, 0x8d, 0x41, 0x02, 0xd9, 0xd9, 0x4d, 0x9f,
+	0x33, 0xc6, 0x39, 0x2f, 0x44, 0x2e, 0x42, 0xff, 0x05, 0x98, 0xcb, 0x26, 0xa4, 0x25, 0x25, 0xb4,
+	0x65, 0xd2, 0xdf, 0x76, 0x3c, 0xa3, 0xab, 0x0d, 0xf1, 0x84, 0x5a, 0x1e, 0x05, 0x54, 0x02, 0xe7,
+	0xf2, 0x82, 0xba, 0x27, 0x88, 0xa8, 0x59, 0x51, 0xc2, 0x3a, 0xf7, 0xcd, 0x3e, 0x9a, 0xce, 0xe2,
+	0x5b, 0x4f, 0xaa, 0x92, 0x7b, 0x5d, 0x52, 0x95, 0x4d, 0xc8, 0xf8, 0x5b, 0x0f, 0xad, 0x75, 0x0d,
+	0xe2, 0xf6, 0x50, 0x5a, 0x27, 0x42, 0xe5, 0x26, 0x1e, 0x56, 0xdd, 0xb3, 0x1d, 0x15, 0x51, 0xca,
+	0x7f, 0x32, 0x90, 0xf1, 0x09, 0xec, 0x2b, 0x90, 0xb6, 0x87, 0x1a, 0xa5, 0x0b, 0x2e, 0xad, 0x10,
+	0x75, 0x56, 0x7c, 0x70, 0x1b, 0x51, 0x6a, 0xca, 0x1e, 0xd2, 0xbf, 0x6c, 0x07, 0xf2, 0x03, 0x63,
+	0xa0, 0xb9, 0xf6, 0xc8, 0xe9, 0x18, 0xda, 0x78, 0xf1, 0x67, 0xc2, 0xec, 0xbb, 0xc6, 0xc0, 0x76,
+	0x8e, 0x5a, 0x1c, 0xe8, 0x8b, 0x7a, 0xeb, 0x09, 0x35, 0x8b, 0xec, 0x3e, 0x91, 0xdd, 0x82, 0xd4,
+	0x40, 0x1f, 0x92, 0x98, 0xc4, 0xbc, 0x43, 0xb7, 0xab, 0x0f, 0x03, 0xdc, 0x0b, 0x03, 0x1a, 0xb2,
+	0xd7, 0x20, 0xa5, 0xf7, 0x7a, 0xc4, 0x27, 0x0e, 0xeb, 0xd3, 0x61, 0xbe, 0x6a, 0xaf, 0xe7, 0x18,
+	0x3d, 0xdd, 0x0b, 0xae, 0xbd, 0x80, 0x4c, 0xc8, 0xbd, 0x09, 0x59, 0xae, 0x83, 0x69, 0x7d, 0x40,
+	0x22, 0x16, 0xb8, 0x88, 0x2b, 0x73, 0x35, 0x40, 0x58, 0x40, 0xc6, 0x22, 0xed, 0x9f, 0x93, 0xd8,
+	0x1b, 0xb0, 0x78, 0x68, 0xf6, 0x3d, 0x4c, 0x88, 0x28, 0x25, 0xc5, 0xa5, 0x5c, 0x0e, 0x4b, 0xd9,
+	0xe4, 0x90, 0x80, 0x84, 0xcc, 0xa1, 0xa4, 0xa0, 0x1a, 0x99, 0xbe, 0x39, 0x30, 0x3d, 0xe2, 0x4f,
+	0x73, 0xfe, 0x88, 0x24, 0xb9, 0x43, 0x88, 0x00, 0x7b, 0xba, 0x2f, 0x08, 0xc4, 0x3d, 0xb2, 0x28,
+	0x39, 0x20, 0x77, 0x66, 0x1e, 0xf7, 0x3e, 0x21, 0x82, 0xdc, 0x23, 0x41, 0x60, 0xdf, 0x84, 0x02,
+	0x3f, 0xc9, 0x13, 0x4f, 0x2e, 0xce, 0xb3, 0xc3, 0x96, 0xba, 0xb7, 0x3e, 0xed, 0xc7, 0xb5, 0x12,
+	0x26, 0xb1, 0x5c, 0x90, 0x8e, 0xa2, 0x79, 0x66, 0x18, 0xbb, 0xf6, 0x5d, 0x99, 0x29, 0x7c, 0x2b,
+	0x7f, 0x2e, 0x14, 0x54, 0xe6, 0x88, 0x0f, 0x18, 0x79, 0xad, 0x80, 0xc2, 0x61, 0x42, 0x45, 0xd1,
+	0xc0, 0x45, 0x0b, 0xab, 0xbf, 0x02, 0xe9, 0xf7, 0x6d, 0x93, 0x6b, 0x9d, 0xe5, 0x22, 0x23, 0x42,
+	0x77, 0x1b, 0x01, 0x01, 0xa5, 0x53, 0xef, 0xf3, 0x31, 0x06, 0x6f, 0x61, 0xd4, 0xf5, 0x0e, 0x03,
+	0x3a, 0xe7, 0xe6, 0xe9, 0xbc, 0xbf, 0xd1, 0xde, 0x0c, 0xc5, 0x6e, 0x8e, 0xb8, 0xc7, 0x1a, 0x36,
+	0xa1, 0x68, 0x0c, 0x86, 0xde, 0x51, 0x40, 0x5c, 0x9e, 0x8b, 0xbb, 0x1a, 0x16, 0x57, 0x23, 0x60,
+	0x48, 0x5e, 0xde, 0x08, 0x92, 0xd9, 0x7b, 0x90, 0xb3, 0x3d, 0xa3, 0x3f, 0x36, 0x59, 0x81, 0x4b,
+	0x7b, 0x2e, 0xe2, 0x64, 0xb6, 0x8d, 0x7e, 0xed, 0xe1, 0x10, 0xf3, 0x44, 0xd8, 0x6e, 0x34, 0x37,
+	0xb1, 0x1b, 0xc9, 0x9b, 0xd8, 0xcd, 0xb3, 0x87, 0xdc, 0x6e, 0xc5, 0x79, 0x76, 0x6b, 0xdb, 0xc3,
+	0x46, 0xd0, 0x6e, 0xc4, 0x20, 0x02, 0xdd, 0xd5, 0x07, 0xc3, 0x3e, 0xd7, 0xb1, 0x34, 0x2f, 0xd0,
+	0x5b, 0x1c, 0x12, 0x0c, 0x74, 0x57, 0x52, 0xd6, 0x92, 0x94, 0xa7, 0x94, 0x3f, 0xc6, 0xe1, 0x74,
+	0x54, 0x56, 0x60, 0x0c, 0x92, 0xfc, 0xa2, 0x10, 0xb7, 0x09, 0xff, 0xcd, 0x2e, 0x41, 0xb6, 0x63,
+	0xf7, 0x47, 0x03, 0x0b, 0xef, 0xd2, 0x87, 0xe2, 0x46, 0x4f, 0xa8, 0x20, 0x48, 0x75, 0xa4, 0xd0,
+	0x55, 0x24, 0x01, 0x84, 0x17, 0x89, 0x1f, 0xaf, 0x22, 0x41, 0x6b, 0x10, 0x89, 0xbd, 0x3c, 0x86,
+	0xf0, 0xc2, 0x88, 0x27, 0xe2, 0xc2, 0x2a, 0xa3, 0xad, 0x8b, 0x4a, 0x69, 0x43, 0xf7, 0x74, 0x9e,
+	0xde, 0x24, 0x1b, 0xfd, 0x76, 0xd9, 0x1d, 0x00, 0xbc, 0x6f, 0x1d, 0x4f, 0xf3, 0x4c, 0xdc, 0x94,
+	0x48, 0x0f, 0xe7, 0x2a, 0xa2, 0x6a, 0xab, 0xf8, 0x55, 0x5b, 0xa5, 0x6e, 0x79, 0xb7, 0x5e, 0x7a,
+	0x47, 0xef, 0x8f, 0x0c, 0x75, 0x91, 0xc3, 0xdb, 0x88, 0xc6, 0x8a, 0x09, 0x07, 0x94, 0x5a, 0x89,
+	0x35, 0x75, 0x3c, 0x6b, 0x86, 0xd0, 0x9c, 0xf3, 0x0c, 0xa4, 0x78, 0x5d, 0xe5, 0xf1, 0x54, 0xb0,
+	0xa8, 0xca, 0x11, 0x3b, 0x4f, 0x12, 0x1d, 0x43, 0xa7, 0xe2, 0x80, 0x9f, 0xf3, 0x8c, 0x3a, 0x21,
+	0x28, 0x9f, 0xc6, 0x80, 0x85, 0xf3, 0x54, 0xa4, 0x45, 0x67, 0xad, 0x11, 0x3f, 0x99, 0x35, 0x4e,
+	0x60, 0xe7, 0x6d, 0x58, 0x96, 0x10, 0xd7, 0x18, 0xe8, 0x96, 0x67, 0x76, 0xa6, 0x0c, 0x7e, 0x66,
+	0xb2, 0x44, 0x4b, 0xce, 0xf3, 0x65, 0x4e, 0x09, 0xa6, 0x20, 0xcd, 0x55, 0x2c, 0x60, 0xe1, 0x7c,
+	0x13, 0xda, 0x7b, 0xec, 0xf1, 0xf6, 0x1e, 0x0f, 0xed, 0x5d, 0xf9, 0x34, 0x09, 0xa5, 0xd9, 0x0c,
+	0xc4, 0x2b, 0xe2, 0xa9, 0x0a, 0xc7, 0x1f, 0xa2, 0x7f, 0xa7, 0xd2, 0x26, 0xde, 0xc6, 0x74, 0x73,
+	0x25, 0x67, 0x13, 0x62, 0x7d, 0x63, 0x3a, 0x21, 0xd6, 0xbb, 0x58, 0x24, 0xe6, 0x64, 0x1d, 0x3d,
+	0x29, 0x9f, 0xb3, 0xab, 0x95, 0xe3, 0xf3, 0x61, 0x45, 0x35, 0xdc, 0x51, 0xdf, 0xe3, 0x75, 0x35,
+	0x5d, 0xa0, 0x42, 0x8a, 0x28, 0xb3, 0x7b, 0xc0, 0x3a, 0xb6, 0x65, 0x19, 0x1d, 0x4f, 0x5c, 0x04,
+	0xa2, 0x32, 0x14, 0x21, 0x7b, 0xfb, 0x04, 0xa2, 0x89, 0xb0, 0x3e, 0x16, 0xe0, 0x17, 0xb7, 0x4b,
+	0x9d, 0x59, 0x52, 0xf9, 0x4f, 0xd8, 0x4d, 0x04, 0xf6, 0xc1, 0x2e, 0x00, 0x70, 0x35, 0xb4, 0x40,
+	0x98, 0x2d, 0x72, 0x4a, 0xe3, 0xff, 0x26, 0xd6, 0xca, 0x5f, 0x85, 0xe5, 0x48, 0x03, 0x44, 0xd4,
+	0xb0, 0xb1, 0x88, 0x1a, 0x76, 0x2d, 0x0f, 0xd9, 0x40, 0x45, 0x8e, 0x25, 0x6d, 0xbc, 0x94, 0x50,
+	0x3e, 0x84, 0x6c, 0xa0, 0x66, 0x61, 0x1b, 0x90, 0xc5, 0x3e, 0x8b, 0x62, 0x87, 0xbb, 0x46, 0x14,
+	0x99, 0x11, 0xb7, 0x60, 0xab, 0xa3, 0xf7, 0x75, 0xa7, 0x36, 0x86, 0xaa, 0x41, 0xb6, 0x93, 0x04,
+	0xf2, 0x2f, 0x13, 0xb0, 0x14, 0x2a, 0x7a, 0xd8, 0xeb, 0x90, 0xfa, 0x90, 0x12, 0x8d, 0xbf, 0xf2,
+	0xd5, 0x47, 0x54, 0x4a, 0x81, 0xc5, 0x25, 0x13, 0x96, 0xd5, 0xa9, 0x9e, 0x63, 0x8f, 0x86, 0x7e,
+	0x4b, 0xb5, 0x12, 0x66, 0x5f, 0xe7, 0x7b, 0x50, 0x25, 0x8e, 0xf2, 0x36, 0xff, 0x35, 0xe5, 0x41,
+	0xe0, 0x24, 0xe1, 0x40, 0x04, 0x70, 0xe1, 0x12, 0x90, 0x14, 0x00, 0x4e, 0x12, 0x80, 0x32, 0x64,
+	0x1e, 0x98, 0x56, 0xd7, 0x7e, 0x60, 0x74, 0x79, 0x24, 0x67, 0xd4, 0xf1, 0x98, 0x98, 0xb1, 0xaa,
+	0xf6, 0x4c, 0xbd, 0x8f, 0x8d, 0x56, 0x8f, 0x27, 0xd8, 0x8c, 0x0a, 0x92, 0x84, 0x8a, 0xb0, 0xe7,
+	0xa1, 0x74, 0x88, 0xfe, 0xe8, 0x9b, 0x1f, 0x19, 0x9a, 0xc3, 0xe3, 0xd5, 0xe5, 0xf9, 0x34, 0xa3,
+	0x16, 0x7d, 0xba, 0x08, 0x63, 0x97, 0x5d, 0x81, 0x82, 0x90, 0x8b, 0x17, 0x2e, 0xa2, 0xd1, 0x39,
+	0x19, 0xde, 0xd1, 0xe6, 0x04, 0xb5, 0x85, 0xc4, 0x86, 0x8b, 0x95, 0xf2, 0x8a, 0x44, 0x51, 0x4a,
+	0xd7, 0xfc, 0x3b, 0xc9, 0xea, 0x1a, 0x0f, 0x79, 0xc5, 0x84, 0x1d, 0xb0, 0x98, 0xa7, 0x24, 0x2e,
+	0x6c, 0x51, 0xa7, 0x49, 0x56, 0x81, 0x53, 0x7a, 0xbf, 0x4f, 0xbb, 0xd6, 0xfa, 0x68, 0x5c, 0x0b,
+	0x2d, 0x4b, 0x6b, 0x00, 0xe7, 0x59, 0x92, 0x53, 0x3b, 0x72, 0xa6, 0xe1, 0x2a, 0xdf, 0x8f, 0x41,
+	0x61, 0xba, 0x56, 0x64, 0x6b, 0x00, 0x93, 0x20, 0x90, 0xfd, 0xef, 0x49, 0x42, 0x27, 0xc0, 0xc5,
+	0x56, 0x21, 0x2d, 0xf6, 0x7c, 0xbc, 0x0b, 0x7d, 0xa0, 0xf2, 0xdd, 0x18, 0xe4, 0xa7, 0xca, 0x4e,
+	0x76, 0x1a, 0x16, 0x78, 0xd9, 0xc9, 0x37, 0x91, 0x50, 0xc5, 0xe0, 0x71, 0x64, 0xd3, 0xd1, 0xd2,
+	0x0f, 0xb0, 0x72, 0xe1, 0xc9, 0xc3, 0x75, 0x3a, 0xae, 0x6c, 0x7b, 0xf2, 0x63, 0x6a, 0x0b, 0x89,
+	0xca, 0xdf, 0x63, 0x90, 0x0b, 0x56, 0x23, 0x6c, 0x1d, 0xaf, 0x41, 0x04, 0x68, 0x1f, 0x18, 0x47,
+	0x7e, 0x2c, 0x3f, 0xf3, 0xe8, 0x02, 0xa6, 0xd2, 0x42, 0xfc, 0x5d, 0xe3, 0x08, 0xef, 0x58, 0xf1,
+	0xc3, 0x9d, 0xa8, 0x11, 0x9f, 0xa3, 0x46, 0xe2, 0x84, 0x6a, 0x94, 0xb7, 0x21, 0x2d, 0xc5, 0x07,
+	0xce, 0xa6, 0x88, 0x0a, 0x61, 0x22, 0x79, 0x36, 0x45, 0x2c, 0xe0, 0x1d, 0xae, 0xbb, 0x1d, 0xc3,
+	0xea, 0xd2, 0x1d, 0x2e, 0x5e, 0x5f, 0x26, 0x04, 0xe5, 0x7b, 0xe8, 0xf9, 0xe9, 0xe2, 0x89, 0x9d,
+	0x85, 0x8c, 0x35, 0x1a, 0xf0, 0x17, 0x17, 0x29, 0x2f, 0x8d, 0x63, 0x7a, 0x61, 0x61, 0x4f, 0x43,
+	0x5e, 0x1c, 0x30, 0x5c, 0xcd, 0xec, 0x18, 0x7e, 0x69, 0x94, 0xe3, 0xc4, 0xba, 0xa0, 0x3d, 0x8e,
+	0x4a, 0xca, 0xe7, 0xe8, 0xf5, 0xa9, 0x76, 0x21, 0x94, 0x75, 0x62, 0xe1, 0x74, 0xfc, 0x0e, 0x14,
+	0x25, 0x04, 0x3b, 0xb3, 0x21, 0x6a, 0xe3, 0x87, 0xc2, 0x0b, 0xc7, 0xf4, 0x22, 0x72, 0xf9, 0x5d,
+	0xc1, 0xa5, 0x16, 0x3a, 0xc1, 0x21, 0x3f, 0x9c, 0xe3, 0xe7, 0xa6, 0x03, 0xdd, 0xeb, 0xdc, 0x17,
+	0xf7, 0xac, 0x9a, 0x73, 0xc4, 0x2b, 0xd3, 0x1a, 0xd1, 0xca, 0xb7, 0x20, 0x3f, 0x25, 0x86, 0xa2,
+	0x2b, 0xe8, 0x0b, 0xb9, 0xe7, 0x84, 0x9a, 0x0f, 0x78, 0x03, 0x73, 0xe5, 0x3f, 0x92, 0x90, 0x0b,
+	0xf6, 0x08, 0xec, 0x55, 0x48, 0x06, 0x9a, 0xe1, 0x67, 0x1f, 0xdd, 0x51, 0xf0, 0x01, 0xbf, 0x55,
+	0x38, 0x13, 0xd3, 0xe1, 0x94, 0xf1, 0xad, 0x11, 0xe6, 0x16, 0xec, 0x05, 0xf0, 0xe6, 0xec, 0x9a,
+	0xe2, 0x16, 0x16, 0x76, 0x78, 0xf1, 0x18, 0x59, 0x35, 0xc9, 0xb9, 0xee, 0x33, 0xaa, 0xcc, 0x98,
+	0x25, 0xb9, 0x4c, 0x85, 0x82, 0x2c, 0x1e, 0xa6, 0xdd, 0xfa, 0xa5, 0x63, 0xa4, 0x8b, 0xd7, 0x06,
+	0xe9, 0xe9, 0xbc, 0x10, 0xb1, 0x2e, 0x4f, 0xe2, 0xac, 0x77, 0x93, 0x61, 0xef, 0x86, 0xbd, 0xb0,
+	0x10, 0xf6, 0x02, 0x45, 0xa4, 0x7c, 0xca, 0x30, 0x2d, 0x94, 0xef, 0xca, 0xb4, 0x9c, 0x13, 0xc4,
+	0x3a, 0xa7, 0x95, 0x07, 0xb0, 0x14, 0x52, 0x95, 0x5d, 0x83, 0xa5, 0xbe, 0x71, 0xe8, 0x69, 0xa1,
+	0xf3, 0x93, 0x54, 0x8b, 0x34, 0x11, 0xcc, 0xa7, 0x5f, 0x06, 0xe6, 0x98, 0xbd, 0xfb, 0x33, 0xe0,
+	0x38, 0x07, 0x97, 0xf8, 0x4c, 0x00, 0x5d, 0x6e, 0x43, 0x2e, 0xa8, 0x3b, 0x29, 0x2b, 0x9e, 0x63,
+	0xa6, 0x16, 0xc9, 0x0a, 0x9a, 0x58, 0x60, 0xf6, 0x1c, 0x0b, 0xd1, 0xc1, 0x73, 0xac, 0xbc, 0x0c,
+	0x19, 0xdf, 0xf7, 0x6c, 0x11, 0x16, 0xea, 0x8d, 0x46, 0x4d, 0x2d, 0x3d, 0xc1, 0x0a, 0x00, 0x3b,
+	0xb5, 0xcd, 0xb6, 0xd6, 0xdc, 0x6f, 0xe3, 0x38, 0x46, 0xe3, 0xcd, 0xfd, 0x9d, 0x1d, 0x39, 0x4e,
+	0x28, 0x87, 0xc0, 0xc2, 0xfd, 0x64, 0x64, 0x8d, 0xfe, 0x1a, 0x00, 0x96, 0x17, 0x9a, 0xbc, 0xb2,
+	0xe3, 0xf3, 0x5e, 0xa4, 0x44, 0xc6, 0x97, 0xcd, 0x07, 0x32, 0xf0, 0x5f, 0xae, 0x62, 0xc3, 0xa9,
+	0x88, 0x46, 0xf3, 0x24, 0xc7, 0xf8, 0xf1, 0xea, 0x35, 0xe5, 0xe3, 0x24, 0x64, 0x78, 0xc3, 0x39,
+	0xd4, 0xc9, 0xc4, 0x59, 0x92, 0xaf, 0x61, 0x73, 0x42, 0x69, 0x8e, 0xab, 0x45, 0x3d, 0x28, 0x11,
+	0x5b, 0x9c, 0x86, 0x3e, 0x5c, 0xe2, 0x90, 0x90, 0x9d, 0x13, 0x08, 0x2c, 0xd2, 0x54, 0xd0, 0xe3,
+	0x6f, 0xa0, 0x31, 0x3c, 0x64, 0x3c, 0x18, 0x79, 0xe3, 0x87, 0xbd, 0x4b, 0xd1, 0xdd, 0x70, 0xd5,
+	0xc7, 0xa9, 0x01, 0x16, 0xac, 0xbd, 0x96, 0x3d, 0x47, 0xe7, 0x65, 0xfa, 0xf4, 0x92, 0xfc, 0xe9,
+	0x7a, 0x6d, 0x09, 0x6b, 0xf6, 0x7c, 0x9b, 0x00, 0xf5, 0x0d, 0x79, 0x44, 0x18, 0xc7, 0xd7, 0xbb,
+	0xc1, 0x6d, 0x54, 0xe1, 0xb4, 0x8b, 0xfa, 0x85, 0x84, 0x2c, 0x70, 0x21, 0xbc, 0xf0, 0x27, 0xfd,
+	0xc7, 0x32, 0x96, 0x08, 0x3d, 0x2d, 0xa2, 0x0d, 0xe7, 0x64, 0xf4, 0x45, 0x4a, 0x4a, 0x71, 0x49,
+	0x67, 0x50, 0x12, 0x13, 0x41, 0x3b, 0x25, 0xef, 0xc9, 0xe1, 0x84, 0x36, 0x25, 0xf5, 0x65, 0x78,
+	0x72, 0xd2, 0xa7, 0x4e, 0x4b, 0x4c, 0xf3, 0x3b, 0xe3, 0xf4, 0xb8, 0x2f, 0x0d, 0xb2, 0xdd, 0x80,
+	0x65, 0xbc, 0x78, 0x22, 0x98, 0x44, 0xf9, 0xc3, 0x70, 0x72, 0x96, 0x05, 0xab, 0xfd, 0x0f, 0x10,
+	0x23, 0xe2, 0x52, 0x96, 0x3d, 0x8b, 0x44, 0xe1, 0x81, 0xb7, 0x96, 0x12, 0x91, 0xac, 0x7c, 0x1b,
+	0x8a, 0xe4, 0x8c, 0x5d, 0x03, 0x3d, 0xd0, 0xd9, 0xd2, 0x47, 0x3d, 0x03, 0xab, 0x20, 0x76, 0xd8,
+	0xb7, 0xf5, 0x88, 0x23, 0x4e, 0x2e, 0x2f, 0xf1, 0xb9, 0xe0, 0x4a, 0xd7, 0xa0, 0x64, 0x5a, 0x5e,
+	0x74, 0x80, 0x14, 0x4c, 0x2b, 0x88, 0x5d, 0x2b, 0x40, 0x4e, 0x54, 0x92, 0x02, 0xad, 0xfc, 0x2c,
+	0x0e, 0x4b, 0x93, 0xf5, 0x5b, 0xa3, 0xc1, 0x40, 0x77, 0x8e, 0x28, 0x6f, 0x74, 0xec, 0x91, 0x15,
+	0xb5, 0x03, 0xb5, 0xc4, 0x67, 0x82, 0xeb, 0x3f, 0x07, 0x25, 0x17, 0x2f, 0xde, 0xf0, 0xfa, 0x6a,
+	0x01, 0xe9, 0x41, 0xe4, 0x7b, 0x50, 0xc4, 0x7c, 0x86, 0xcd, 0x04, 0xd6, 0x31, 0xf2, 0xbc, 0x8a,
+	0x10, 0xbd, 0x19, 0x1d, 0xa2, 0x53, 0xbb, 0xaa, 0x70, 0xc3, 0x55, 0xbd, 0xb7, 0xa5, 0x04, 0xb5,
+	0xe0, 0xcb, 0x12, 0x47, 0xb9, 0xfc, 0x0d, 0x28, 0xce, 0x40, 0xa8, 0x2e, 0xf6, 0x41, 0x7c, 0xfb,
+	0x31, 0x75, 0x3c, 0x26, 0x25, 0x83, 0xa6, 0x98, 0xda, 0x78, 0x89, 0xcf, 0x04, 0xb6, 0xae, 0x7c,
+	0x12, 0x87, 0xfc, 0xd4, 0xa9, 0x89, 0xcc, 0x45, 0x6f, 0x42, 0x4a, 0x48, 0x9b, 0xff, 0xc6, 0x3b,
+	0x25, 0x44, 0xde, 0xe8, 0xf4, 0x6e, 0x24, 0xf8, 0xf0, 0x62, 0xc8, 0x89, 0x64, 0x20, 0x03, 0x27,
+	0x21, 0x53, 0x42, 0x56, 0x50, 0xb9, 0x82, 0xe5, 0x9f, 0xc4, 0x20, 0x25, 0x93, 0xf4, 0xcd, 0xf1,
+	0x9b, 0x4f, 0xe0, 0x32, 0x8e, 0x4a, 0x42, 0x30, 0x49, 0x42, 0x91, 0x69, 0x7b, 0xa6, 0xfc, 0xba,
+	0x0d, 0x67, 0x3b, 0x78, 0xec, 0x0e, 0x0c, 0xed, 0x7d, 0x17, 0xdb, 0x64, 0xc3, 0xea, 0xd8, 0x5d,
+	0xbc, 0xad, 0x74, 0xc7, 0xd1, 0x8f, 0xe4, 0x27, 0xaf, 0x65, 0x04, 0xac, 0x19, 0xdb, 0x38, 0x5d,
+	0x13, 0xb3, 0x55, 0x9a, 0x5c, 0x4b, 0xc3, 0x02, 0xdf, 0xba, 0xf2, 0xbb, 0x38, 0xc0, 0xc4, 0x8b,
+	0x91, 0xf6, 0xba, 0xcc, 0xbb, 0xc1, 0x8e, 0x63, 0xf2, 0x26, 0x52, 0x7e, 0xf5, 0x08, 0x92, 0x88,
+	0x6b, 0x64, 0x61, 0xf5, 0x99, 0x10, 0x5c, 0xf4, 0x7b, 0x26, 0xc9, 0x25, 0xbf, 0x78, 0x92, 0xc3,
+	0x3b, 0x34, 0x7c, 0x94, 0x79, 0x6e, 0x52, 0x8b, 0xde, 0xcc, 0x39, 0x7e, 0x05, 0x16, 0x7a, 0x74,
+	0x2c, 0x57, 0x0c, 0xee, 0xd1, 0xa7, 0x1e, 0x15, 0xa9, 0xfc, 0xfc, 0xd2, 0xa3, 0x39, 0xe7, 0xc0,
+	0x7d, 0xa6, 0x5d, 0x11, 0xbb, 0x2b, 0x87, 0xf3, 0xde, 0xdc, 0x43, 0x61, 0x4e, 0x0f, 0xce, 0x92,
+	0x8b, 0x92, 0x44, 0x17, 0xfd, 0xa7, 0xfc, 0x39, 0x06, 0x8c, 0x3f, 0x60, 0x5a, 0xdd, 0xa1, 0xcd,
+	0x4f, 0xb4, 0x75, 0x68, 0xf6, 0xb0, 0xe2, 0x4d, 0x8c, 0x9c, 0xbe, 0x30, 0xe8, 0x5a, 0x1a, 0x53,
+	0x61, 0x62, 0x5f, 0xdd, 0x51, 0x89, 0xc6, 0xee, 0x42, 0xfa, 0xbe, 0xa1, 0x77, 0x0d, 0xc7, 0xbf,
+	0x11, 0x6f, 0xcc, 0x79, 0x12, 0x9d, 0x92, 0x58, 0x79, 0x4b, 0xf0, 0xd4, 0x2c, 0xcf, 0x39, 0x52,
+	0x7d, 0x09, 0x74, 0x8a, 0x4c, 0xcb, 0x35, 0x3a, 0x23, 0xc7, 0xff, 0xda, 0x39, 0x1e, 0x97, 0xef,
+	0x40, 0x2e, 0xc8, 0xc4, 0x4a, 0x90, 0xc0, 0x76, 0x43, 0x3a, 0x99, 0x7e, 0x52, 0x03, 0x21, 0x42,
+	0x59, 0x78, 0x57, 0x0c, 0xee, 0xc4, 0x6f, 0xc7, 0x94, 0x26, 0xe4, 0x68, 0x0f, 0xd8, 0x5c, 0xf2,
+	0xcb, 0x77, 0xc6, 0xaf, 0xb1, 0x2f, 0xec, 0x57, 0xe5, 0x07, 0x71, 0x38, 0x13, 0xfd, 0xd0, 0xcb,
+	0x76, 0xa1, 0x68, 0x48, 0x5d, 0xa9, 0xe0, 0x44, 0x65, 0x65, 0x73, 0x78, 0xe5, 0x24, 0x86, 0x51,
+	0x0b, 0xc6, 0xb4, 0xe9, 0xef, 0x40, 0xc6, 0x91, 0xdb, 0x96, 0x47, 0xfd, 0x62, 0xb4, 0x1c, 0x5f,
+	0x39, 0x75, 0x8c, 0x67, 0xb7, 0x20, 0x3d, 0xe0, 0x1e, 0xf7, 0xb3, 0xdf, 0xf9, 0x47, 0x85, 0x85,
+	0xea, 0x83, 0xe9, 0x7b, 0x1d, 0x5d, 0x85, 0x7e, 0xc4, 0x97, 0xa3, 0xb9, 0xe8, 0xce, 0x53, 0x05,
+	0x50, 0xf9, 0x75, 0x0c, 0x4a, 0xb3, 0x9d, 0x2e, 0x7d, 0x66, 0x46, 0x03, 0xe0, 0x35, 0x67, 0x79,
+	0xd2, 0x04, 0x8f, 0xae, 0x96, 0xe8, 0x55, 0xda, 0x67, 0xc0, 0x26, 0x69, 0x3a, 0xc1, 0xcd, 0xed,
+	0x91, 0x02, 0x29, 0x6d, 0x15, 0x92, 0x87, 0x23, 0xab, 0x23, 0xbf, 0x57, 0x9d, 0x9f, 0xb7, 0xd8,
+	0x26, 0x62, 0x90, 0x8b, 0x63, 0x27, 0x49, 0xe4, 0x37, 0x71, 0xc8, 0x06, 0x36, 0xc3, 0xae, 0xc3,
+	0x22, 0x1d, 0x89, 0xe3, 0xb2, 0x5d, 0xa6, 0x2b, 0x7f, 0xb1, 0x4b, 0x00, 0x07, 0xb6, 0xdd, 0xd7,
+	0x26, 0x31, 0x98, 0xa1, 0x4f, 0x52, 0x44, 0x13, 0x12, 0xb1, 0x06, 0x33, 0xe9, 0x71, 0x39, 0x90,
+	0x70, 0xe9, 0xe6, 0x04, 0x73, 0xfc, 0xe2, 0x8c, 0x2d, 0x52, 0x9e, 0xdf, 0xba, 0x63, 0x10, 0x15,
+	0x43, 0x31, 0x7a, 0xae, 0x94, 0x64, 0x01, 0x9b, 0xcd, 0xdd, 0x0b, 0x11, 0xb9, 0x1b, 0x6f, 0x4b,
+	0x9e, 0x62, 0x50, 0x94, 0xe5, 0x4a, 0x5c, 0x4a, 0x2e, 0x99, 0x17, 0x13, 0x0d, 0x57, 0x20, 0x6f,
+	0x43, 0x7e, 0x84, 0x9b, 0xb8, 0xb1, 0x7a, 0x5b, 0xe2, 0xc4, 0xe7, 0xa0, 0xa5, 0x89, 0xba, 0xfb,
+	0x75, 0x3e, 0xcd, 0x3f, 0xb3, 0x08, 0xa4, 0x28, 0x2e, 0x7c, 0xeb, 0x6d, 0x27, 0x33, 0x99, 0xd2,
+	0xa2, 0xf2, 0x59, 0x0c, 0x60, 0x62, 0xe3, 0xc8, 0x44, 0x7c, 0x07, 0x16, 0x4d, 0x4c, 0xad, 0x98,
+	0xdf, 0x7b, 0x27, 0xac, 0xa1, 0x33, 0x84, 0xaf, 0x22, 0x1c, 0xe3, 0x39, 0xc9, 0xd9, 0x12, 0x27,
+	0x7e, 0xa7, 0xe3, 0x78, 0xf9, 0x65, 0x56, 0xfc, 0x49, 0x04, 0x7d, 0x99, 0xbd, 0x03, 0x45, 0xa2,
+	0x6b, 0x63, 0xff, 0x8a, 0xbf, 0x07, 0x88, 0x76, 0x70, 0x9e, 0xa0, 0xfe, 0xc8, 0x55, 0xfe, 0x15,
+	0x87, 0x53, 0x11, 0x8f, 0x72, 0x63, 0x5d, 0x13, 0xf3, 0x74, 0x4d, 0x7e, 0x31, 0x5d, 0x5f, 0x97,
+	0xba, 0x8a, 0x3f, 0x54, 0x78, 0xfe, 0x44, 0x2f, 0x83, 0x15, 0xe4, 0x9c, 0x52, 0x39, 0xf5, 0x28,
+	0x95, 0xd3, 0x27, 0x54, 0xb9, 0xfc, 0x1d, 0x48, 0xa0, 0xe0, 0xff, 0xf9, 0x71, 0x9e, 0x1c, 0xcd,
+	0xd5, 0x71, 0x11, 0x42, 0x56, 0xc6, 0x02, 0x40, 0x76, 0x88, 0xfc, 0x37, 0xa5, 0xfd, 0x60, 0x4f,
+	0x28, 0x06, 0xd7, 0xfa, 0x90, 0x9f, 0xfa, 0x0b, 0x16, 0xbc, 0x5b, 0xce, 0xbc, 0xbd, 0x5f, 0x53,
+	0xef, 0x69, 0x7b, 0x6a, 0xbd, 0xa9, 0xd6, 0xdb, 0xf7, 0xb4, 0xfd, 0xc6, 0xdd, 0x46, 0xf3, 0xdd,
+	0x06, 0xf6, 0x88, 0x57, 0xe0, 0xf2, 0xcc, 0xdc, 0x4e, 0xb5, 0x5d, 0x6b, 0xac, 0xdf, 0xd3, 0x5a,
+	0xb5, 0x46, 0xab, 0xde, 0xae, 0xbf, 0x53, 0xc3, 0xce, 0xf1, 0x2c, 0x2c, 0xcf, 0xa0, 0xaa, 0x1b,
+	0xda, 0x5b, 0xcd, 0xf5, 0x52, 0xfc, 0xda, 0x8f, 0x12, 0x78, 0xc3, 0x04, 0x3e, 0xc9, 0x13, 0xb6,
+	0xb9, 0x57, 0x53, 0xab, 0xed, 0xa6, 0xaa, 0xb5, 0xef, 0xed, 0xd5, 0x02, 0x8b, 0x9d, 0x83, 0x33,
+	0xbb, 0xb5, 0xdd, 0x26, 0xca, 0x69, 0x35, 0xf7, 0xd5, 0xf5, 0x9a, 0xe6, 0x03, 0x4b, 0x9f, 0xa7,
+	0x91, 0xef, 0x34, 0xbd, 0x7a, 0x87, 0xa6, 0x7e, 0x9f, 0xa1, 0x29, 0x6a, 0x54, 0x43, 0x53, 0x9f,
+	0x2c, 0xa2, 0x6e, 0xcb, 0xb5, 0xdd, 0xbd, 0x76, 0x58, 0xe2, 0x0f, 0x81, 0x2d, 0x41, 0x6e, 0xb7,
+	0xba, 0x37, 0x21, 0xfd, 0xa1, 0xc8, 0x9e, 0x04, 0x56, 0xdd, 0xda, 0x52, 0x6b, 0x5b, 0xa8, 0xe4,
+	0x64, 0xe2, 0x17, 0x25, 0x34, 0x65, 0x71, 0xb3, 0xbe, 0x83, 0x7d, 0xf1, 0x84, 0xfa, 0xe3, 0x25,
+	0x76, 0x0a, 0x0a, 0x3b, 0xf5, 0xdd, 0x7a, 0x7b, 0x42, 0xfc, 0x37, 0x27, 0xee, 0x37, 0xea, 0xcd,
+	0xc6, 0x84, 0xf8, 0x19, 0x43, 0xf7, 0xe4, 0xb7, 0x9b, 0xf5, 0x00, 0xed, 0xb7, 0xa7, 0x88, 0xd6,
+	0x6e, 0xee, 0x05, 0x68, 0x3f, 0x3f, 0x4d, 0xeb, 0xb4, 0xaa, 0xbb, 0x7b, 0x3b, 0x81, 0xd5, 0x3f,
+	0x5e, 0x26, 0x05, 0x7d, 0xc3, 0xd4, 0x1b, 0x77, 0x03, 0x0c, 0x9b, 0xb4, 0x63, 0x61, 0x96, 0xa9,
+	0x89, 0x8f, 0xb7, 0xd8, 0x45, 0x38, 0xdb, 0x6c, 0xd7, 0x76, 0xb4, 0xda, 0xd7, 0xf6, 0x9a, 0x6a,
+	0x7b, 0x66, 0xfe, 0x9f, 0x5b, 0x6b, 0x99, 0xaf, 0xa7, 0x44, 0x78, 0x1d, 0xa4, 0xf8, 0x17, 0xbe,
+	0x9b, 0xff, 0x05, 0x87, 0x1b, 0x9b, 0x1e, 0x41, 0x26, 0x00, 0x00,
+}
+
+func (x QueryPriority) String() string {
+	s, ok := QueryPriority_name[int32(x)]
+	if ok {
+		return s
+	}
+	return strconv.Itoa(int(x))
 }
-
 func (x OperatorType) String() string {
 	s, ok := OperatorType_name[int32(x)]
 	if ok {
@@ -3414,6 +3704,9 @@ func (this *PlanOptions) Equal(that interface{}) bool {
 	if this.MaxOutputRowsPerTable != that1.MaxOutputRowsPerTable {
 		return false
 	}
+	if this.Priority != that1.Priority {
+		return false
+	}
 	return true
 }
 func (this *Plan) Equal(that interface{}) bool {
@@ -3970,6 +4263,54 @@ func (this *Operator_OTelSinkOp) Equal(that interface{}) bool {
 	}
 	return true
 }
+func (this *Operator_TopnOp) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*Operator_TopnOp)
+	if !ok {
+		that2, ok := that.(Operator_TopnOp)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if !this.TopnOp.Equal(that1.TopnOp) {
+		return false
+	}
+	return true
+}
+func (this *Operator_SampleOp) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*Operator_SampleOp)
+	if !ok {
+		that2, ok := that.(Operator_SampleOp)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if !this.SampleOp.Equal(that1.SampleOp) {
+		return false
+	}
+	return true
+}
 func (this *MemorySourceOperator) Equal(that interface{}) bool {
 	if that == nil {
 		return this == nil
@@ -4368,6 +4709,15 @@ func (this *AggregateOperator) Equal(that interface{}) bool {
 	if this.FinalizeResults != that1.FinalizeResults {
 		return false
 	}
+	if this.WindowSizeNs != that1.WindowSizeNs {
+		return false
+	}
+	if this.WindowTimeColumnIndex != that1.WindowTimeColumnIndex {
+		return false
+	}
+	if this.AllowedLatenessNs != that1.AllowedLatenessNs {
+		return false
+	}
 	return true
 }
 func (this *FilterOperator) Equal(that interface{}) bool {
@@ -4442,14 +4792,14 @@ func (this *LimitOperator) Equal(that interface{}) bool {
 	}
 	return true
 }
-func (this *UnionOperator) Equal(that interface{}) bool {
+func (this *TopNOperator) Equal(that interface{}) bool {
 	if that == nil {
 		return this == nil
 	}
 
-	that1, ok := that.(*UnionOperator)
+	that1, ok := that.(*TopNOperator)
 	if !ok {
-		that2, ok := that.(UnionOperator)
+		that2, ok := that.(TopNOperator)
 		if ok {
 			that1 = &that2
 		} else {
@@ -4461,22 +4811,129 @@ func (this *UnionOperator) Equal(that interface{}) bool {
 	} else if this == nil {
 		return false
 	}
-	if len(this.ColumnNames) != len(that1.ColumnNames) {
+	if len(this.SortKeys) != len(that1.SortKeys) {
 		return false
 	}
-	for i := range this.ColumnNames {
-		if this.ColumnNames[i] != that1.ColumnNames[i] {
+	for i := range this.SortKeys {
+		if !this.SortKeys[i].Equal(that1.SortKeys[i]) {
 			return false
 		}
 	}
-	if len(this.ColumnMappings) != len(that1.ColumnMappings) {
+	if this.Limit != that1.Limit {
 		return false
 	}
-	for i := range this.ColumnMappings {
-		if !this.ColumnMappings[i].Equal(that1.ColumnMappings[i]) {
-			return false
-		}
-	}
+	if len(this.Columns) != len(that1.Columns) {
+		return false
+	}
+	for i := range this.Columns {
+		if !this.Columns[i].Equal(that1.Columns[i]) {
+			return false
+		}
+	}
+	return true
+}
+func (this *TopNOperator_SortKey) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*TopNOperator_SortKey)
+	if !ok {
+		that2, ok := that.(TopNOperator_SortKey)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if this.ColumnIndex != that1.ColumnIndex {
+		return false
+	}
+	if this.Ascending != that1.Ascending {
+		return false
+	}
+	return true
+}
+func (this *SampleOperator) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*SampleOperator)
+	if !ok {
+		that2, ok := that.(SampleOperator)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if this.NumRows != that1.NumRows {
+		return false
+	}
+	if len(this.GroupIndices) != len(that1.GroupIndices) {
+		return false
+	}
+	for i := range this.GroupIndices {
+		if this.GroupIndices[i] != that1.GroupIndices[i] {
+			return false
+		}
+	}
+	if len(this.Columns) != len(that1.Columns) {
+		return false
+	}
+	for i := range this.Columns {
+		if !this.Columns[i].Equal(that1.Columns[i]) {
+			return false
+		}
+	}
+	return true
+}
+func (this *UnionOperator) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*UnionOperator)
+	if !ok {
+		that2, ok := that.(UnionOperator)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if len(this.ColumnNames) != len(that1.ColumnNames) {
+		return false
+	}
+	for i := range this.ColumnNames {
+		if this.ColumnNames[i] != that1.ColumnNames[i] {
+			return false
+		}
+	}
+	if len(this.ColumnMappings) != len(that1.ColumnMappings) {
+		return false
+	}
+	for i := range this.ColumnMappings {
+		if !this.ColumnMappings[i].Equal(that1.ColumnMappings[i]) {
+			return false
+		}
+	}
 	if this.RowsPerBatch != that1.RowsPerBatch {
 		return false
 	}
@@ -4560,6 +5017,9 @@ func (this *JoinOperator) Equal(that interface{}) bool {
 	if this.RowsPerBatch != that1.RowsPerBatch {
 		return false
 	}
+	if this.SortedInputs != that1.SortedInputs {
+		return false
+	}
 	return true
 }
 func (this *JoinOperator_EqualityCondition) Equal(that interface{}) bool {
@@ -5735,11 +6195,12 @@ func (this *PlanOptions) GoString() string {
 	if this == nil {
 		return "nil"
 	}
-	s := make([]string, 0, 7)
+	s := make([]string, 0, 8)
 	s = append(s, "&planpb.PlanOptions{")
 	s = append(s, "Explain: "+fmt.Sprintf("%#v", this.Explain)+",\n")
 	s = append(s, "Analyze: "+fmt.Sprintf("%#v", this.Analyze)+",\n")
 	s = append(s, "MaxOutputRowsPerTable: "+fmt.Sprintf("%#v", this.MaxOutputRowsPerTable)+",\n")
+	s = append(s, "Priority: "+fmt.Sprintf("%#v", this.Priority)+",\n")
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
@@ -5835,7 +6296,7 @@ func (this *Operator) GoString() string {
 	if this == nil {
 		return "nil"
 	}
-	s := make([]string, 0, 18)
+	s := make([]string, 0, 20)
 	s = append(s, "&planpb.Operator{")
 	s = append(s, "OpType: "+fmt.Sprintf("%#v", this.OpType)+",\n")
 	if this.Op != nil {
@@ -5948,6 +6409,22 @@ func (this *Operator_OTelSinkOp) GoString() string {
 		`OTelSinkOp:` + fmt.Sprintf("%#v", this.OTelSinkOp) + `}`}, ", ")
 	return s
 }
+func (this *Operator_TopnOp) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&planpb.Operator_TopnOp{` +
+		`TopnOp:` + fmt.Sprintf("%#v", this.TopnOp) + `}`}, ", ")
+	return s
+}
+func (this *Operator_SampleOp) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&planpb.Operator_SampleOp{` +
+		`SampleOp:` + fmt.Sprintf("%#v", this.SampleOp) + `}`}, ", ")
+	return s
+}
 func (this *MemorySourceOperator) GoString() string {
 	if this == nil {
 		return "nil"
@@ -6065,7 +6542,7 @@ func (this *AggregateOperator) GoString() string {
 	if this == nil {
 		return "nil"
 	}
-	s := make([]string, 0, 11)
+	s := make([]string, 0, 14)
 	s = append(s, "&planpb.AggregateOperator{")
 	if this.Values != nil {
 		s = append(s, "Values: "+fmt.Sprintf("%#v", this.Values)+",\n")
@@ -6078,6 +6555,9 @@ func (this *AggregateOperator) GoString() string {
 	s = append(s, "Windowed: "+fmt.Sprintf("%#v", this.Windowed)+",\n")
 	s = append(s, "PartialAgg: "+fmt.Sprintf("%#v", this.PartialAgg)+",\n")
 	s = append(s, "FinalizeResults: "+fmt.Sprintf("%#v", this.FinalizeResults)+",\n")
+	s = append(s, "WindowSizeNs: "+fmt.Sprintf("%#v", this.WindowSizeNs)+",\n")
+	s = append(s, "WindowTimeColumnIndex: "+fmt.Sprintf("%#v", this.WindowTimeColumnIndex)+",\n")
+	s = append(s, "AllowedLatenessNs: "+fmt.Sprintf("%#v", this.AllowedLatenessNs)+",\n")
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
@@ -6110,6 +6590,47 @@ func (this *LimitOperator) GoString() string {
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
+func (this *TopNOperator) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := make([]string, 0, 7)
+	s = append(s, "&planpb.TopNOperator{")
+	if this.SortKeys != nil {
+		s = append(s, "SortKeys: "+fmt.Sprintf("%#v", this.SortKeys)+",\n")
+	}
+	s = append(s, "Limit: "+fmt.Sprintf("%#v", this.Limit)+",\n")
+	if this.Columns != nil {
+		s = append(s, "Columns: "+fmt.Sprintf("%#v", this.Columns)+",\n")
+	}
+	s = append(s, "}")
+	return strings.Join(s, "")
+}
+func (this *TopNOperator_SortKey) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := make([]string, 0, 6)
+	s = append(s, "&planpb.TopNOperator_SortKey{")
+	s = append(s, "ColumnIndex: "+fmt.Sprintf("%#v", this.ColumnIndex)+",\n")
+	s = append(s, "Ascending: "+fmt.Sprintf("%#v", this.Ascending)+",\n")
+	s = append(s, "}")
+	return strings.Join(s, "")
+}
+func (this *SampleOperator) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := make([]string, 0, 7)
+	s = append(s, "&planpb.SampleOperator{")
+	s = append(s, "NumRows: "+fmt.Sprintf("%#v", this.NumRows)+",\n")
+	s = append(s, "GroupIndices: "+fmt.Sprintf("%#v", this.GroupIndices)+",\n")
+	if this.Columns != nil {
+		s = append(s, "Columns: "+fmt.Sprintf("%#v", this.Columns)+",\n")
+	}
+	s = append(s, "}")
+	return strings.Join(s, "")
+}
 func (this *UnionOperator) GoString() string {
 	if this == nil {
 		return "nil"
@@ -6138,7 +6659,7 @@ func (this *JoinOperator) GoString() string {
 	if this == nil {
 		return "nil"
 	}
-	s := make([]string, 0, 9)
+	s := make([]string, 0, 10)
 	s = append(s, "&planpb.JoinOperator{")
 	s = append(s, "Type: "+fmt.Sprintf("%#v", this.Type)+",\n")
 	if this.EqualityConditions != nil {
@@ -6149,6 +6670,7 @@ func (this *JoinOperator) GoString() string {
 	}
 	s = append(s, "ColumnNames: "+fmt.Sprintf("%#v", this.ColumnNames)+",\n")
 	s = append(s, "RowsPerBatch: "+fmt.Sprintf("%#v", this.RowsPerBatch)+",\n")
+	s = append(s, "SortedInputs: "+fmt.Sprintf("%#v", this.SortedInputs)+",\n")
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
@@ -6621,6 +7143,11 @@ func (m *PlanOptions) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	_ = i
 	var l int
 	_ = l
+	if m.Priority != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.Priority))
+		i--
+		dAtA[i] = 0x28
+	}
 	if m.MaxOutputRowsPerTable != 0 {
 		i = encodeVarintPlan(dAtA, i, uint64(m.MaxOutputRowsPerTable))
 		i--
@@ -7259,6 +7786,50 @@ func (m *Operator_OTelSinkOp) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	}
 	return len(dAtA) - i, nil
 }
+func (m *Operator_TopnOp) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *Operator_TopnOp) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	if m.TopnOp != nil {
+		{
+			size, err := m.TopnOp.MarshalToSizedBuffer(dAtA[:i])
+			if err != nil {
+				return 0, err
+			}
+			i -= size
+			i = encodeVarintPlan(dAtA, i, uint64(size))
+		}
+		i--
+		dAtA[i] = 0x7a
+	}
+	return len(dAtA) - i, nil
+}
+func (m *Operator_SampleOp) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *Operator_SampleOp) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	if m.SampleOp != nil {
+		{
+			size, err := m.SampleOp.MarshalToSizedBuffer(dAtA[:i])
+			if err != nil {
+				return 0, err
+			}
+			i -= size
+			i = encodeVarintPlan(dAtA, i, uint64(size))
+		}
+		i--
+		dAtA[i] = 0x1
+		i--
+		dAtA[i] = 0x82
+	}
+	return len(dAtA) - i, nil
+}
 func (m *Operator_GRPCSinkOp) MarshalTo(dAtA []byte) (int, error) {
 	size := m.Size()
 	return m.MarshalToSizedBuffer(dAtA[:size])
@@ -7779,6 +8350,21 @@ func (m *AggregateOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	_ = i
 	var l int
 	_ = l
+	if m.AllowedLatenessNs != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.AllowedLatenessNs))
+		i--
+		dAtA[i] = 0x50
+	}
+	if m.WindowTimeColumnIndex != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.WindowTimeColumnIndex))
+		i--
+		dAtA[i] = 0x48
+	}
+	if m.WindowSizeNs != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.WindowSizeNs))
+		i--
+		dAtA[i] = 0x40
+	}
 	if m.FinalizeResults {
 		i--
 		if m.FinalizeResults {
@@ -7967,7 +8553,7 @@ func (m *LimitOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	return len(dAtA) - i, nil
 }
 
-func (m *UnionOperator) Marshal() (dAtA []byte, err error) {
+func (m *TopNOperator) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalToSizedBuffer(dAtA[:size])
@@ -7977,25 +8563,20 @@ func (m *UnionOperator) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *UnionOperator) MarshalTo(dAtA []byte) (int, error) {
+func (m *TopNOperator) MarshalTo(dAtA []byte) (int, error) {
 	size := m.Size()
 	return m.MarshalToSizedBuffer(dAtA[:size])
 }
 
-func (m *UnionOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+func (m *TopNOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	i := len(dAtA)
 	_ = i
 	var l int
 	_ = l
-	if m.RowsPerBatch != 0 {
-		i = encodeVarintPlan(dAtA, i, uint64(m.RowsPerBatch))
-		i--
-		dAtA[i] = 0x18
-	}
-	if len(m.ColumnMappings) > 0 {
-		for iNdEx := len(m.ColumnMappings) - 1; iNdEx >= 0; iNdEx-- {
+	if len(m.Columns) > 0 {
+		for iNdEx := len(m.Columns) - 1; iNdEx >= 0; iNdEx-- {
 			{
-				size, err := m.ColumnMappings[iNdEx].MarshalToSizedBuffer(dAtA[:i])
+				size, err := m.Columns[iNdEx].MarshalToSizedBuffer(dAtA[:i])
 				if err != nil {
 					return 0, err
 				}
@@ -8003,14 +8584,24 @@ func (m *UnionOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 				i = encodeVarintPlan(dAtA, i, uint64(size))
 			}
 			i--
-			dAtA[i] = 0x12
+			dAtA[i] = 0x1a
 		}
 	}
-	if len(m.ColumnNames) > 0 {
-		for iNdEx := len(m.ColumnNames) - 1; iNdEx >= 0; iNdEx-- {
-			i -= len(m.ColumnNames[iNdEx])
-			copy(dAtA[i:], m.ColumnNames[iNdEx])
-			i = encodeVarintPlan(dAtA, i, uint64(len(m.ColumnNames[iNdEx])))
+	if m.Limit != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.Limit))
+		i--
+		dAtA[i] = 0x10
+	}
+	if len(m.SortKeys) > 0 {
+		for iNdEx := len(m.SortKeys) - 1; iNdEx >= 0; iNdEx-- {
+			{
+				size, err := m.SortKeys[iNdEx].MarshalToSizedBuffer(dAtA[:i])
+				if err != nil {
+					return 0, err
+				}
+				i -= size
+				i = encodeVarintPlan(dAtA, i, uint64(size))
+			}
 			i--
 			dAtA[i] = 0xa
 		}
@@ -8018,7 +8609,7 @@ func (m *UnionOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	return len(dAtA) - i, nil
 }
 
-func (m *UnionOperator_ColumnMapping) Marshal() (dAtA []byte, err error) {
+func (m *TopNOperator_SortKey) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalToSizedBuffer(dAtA[:size])
@@ -8028,39 +8619,35 @@ func (m *UnionOperator_ColumnMapping) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *UnionOperator_ColumnMapping) MarshalTo(dAtA []byte) (int, error) {
+func (m *TopNOperator_SortKey) MarshalTo(dAtA []byte) (int, error) {
 	size := m.Size()
 	return m.MarshalToSizedBuffer(dAtA[:size])
 }
 
-func (m *UnionOperator_ColumnMapping) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+func (m *TopNOperator_SortKey) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	i := len(dAtA)
 	_ = i
 	var l int
 	_ = l
-	if len(m.ColumnIndexes) > 0 {
-		dAtA44 := make([]byte, len(m.ColumnIndexes)*10)
-		var j43 int
-		for _, num1 := range m.ColumnIndexes {
-			num := uint64(num1)
-			for num >= 1<<7 {
-				dAtA44[j43] = uint8(uint64(num)&0x7f | 0x80)
-				num >>= 7
-				j43++
-			}
-			dAtA44[j43] = uint8(num)
-			j43++
+	if m.Ascending {
+		i--
+		if m.Ascending {
+			dAtA[i] = 1
+		} else {
+			dAtA[i] = 0
 		}
-		i -= j43
-		copy(dAtA[i:], dAtA44[:j43])
-		i = encodeVarintPlan(dAtA, i, uint64(j43))
 		i--
-		dAtA[i] = 0xa
+		dAtA[i] = 0x10
+	}
+	if m.ColumnIndex != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.ColumnIndex))
+		i--
+		dAtA[i] = 0x8
 	}
 	return len(dAtA) - i, nil
 }
 
-func (m *JoinOperator) Marshal() (dAtA []byte, err error) {
+func (m *SampleOperator) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
 	n, err := m.MarshalToSizedBuffer(dAtA[:size])
@@ -8070,17 +8657,181 @@ func (m *JoinOperator) Marshal() (dAtA []byte, err error) {
 	return dAtA[:n], nil
 }
 
-func (m *JoinOperator) MarshalTo(dAtA []byte) (int, error) {
+func (m *SampleOperator) MarshalTo(dAtA []byte) (int, error) {
 	size := m.Size()
 	return m.MarshalToSizedBuffer(dAtA[:size])
 }
 
-func (m *JoinOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+func (m *SampleOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	i := len(dAtA)
 	_ = i
 	var l int
 	_ = l
-	if m.RowsPerBatch != 0 {
+	if len(m.Columns) > 0 {
+		for iNdEx := len(m.Columns) - 1; iNdEx >= 0; iNdEx-- {
+			{
+				size, err := m.Columns[iNdEx].MarshalToSizedBuffer(dAtA[:i])
+				if err != nil {
+					return 0, err
+				}
+				i -= size
+				i = encodeVarintPlan(dAtA, i, uint64(size))
+			}
+			i--
+			dAtA[i] = 0x1a
+		}
+	}
+	if len(m.GroupIndices) > 0 {
+		dAtA44 := make([]byte, len(m.GroupIndices)*10)
+		var j43 int
+		for _, num1 := range m.GroupIndices {
+			num := uint64(num1)
+			for num >= 1<<7 {
+				dAtA44[j43] = uint8(uint64(num)&0x7f | 0x80)
+				num >>= 7
+				j43++
+			}
+			dAtA44[j43] = uint8(num)
+			j43++
+		}
+		i -= j43
+		copy(dAtA[i:], dAtA44[:j43])
+		i = encodeVarintPlan(dAtA, i, uint64(j43))
+		i--
+		dAtA[i] = 0x12
+	}
+	if m.NumRows != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.NumRows))
+		i--
+		dAtA[i] = 0x8
+	}
+	return len(dAtA) - i, nil
+}
+
+func (m *UnionOperator) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalToSizedBuffer(dAtA[:size])
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *UnionOperator) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *UnionOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	_ = i
+	var l int
+	_ = l
+	if m.RowsPerBatch != 0 {
+		i = encodeVarintPlan(dAtA, i, uint64(m.RowsPerBatch))
+		i--
+		dAtA[i] = 0x18
+	}
+	if len(m.ColumnMappings) > 0 {
+		for iNdEx := len(m.ColumnMappings) - 1; iNdEx >= 0; iNdEx-- {
+			{
+				size, err := m.ColumnMappings[iNdEx].MarshalToSizedBuffer(dAtA[:i])
+				if err != nil {
+					return 0, err
+				}
+				i -= size
+				i = encodeVarintPlan(dAtA, i, uint64(size))
+			}
+			i--
+			dAtA[i] = 0x12
+		}
+	}
+	if len(m.ColumnNames) > 0 {
+		for iNdEx := len(m.ColumnNames) - 1; iNdEx >= 0; iNdEx-- {
+			i -= len(m.ColumnNames[iNdEx])
+			copy(dAtA[i:], m.ColumnNames[iNdEx])
+			i = encodeVarintPlan(dAtA, i, uint64(len(m.ColumnNames[iNdEx])))
+			i--
+			dAtA[i] = 0xa
+		}
+	}
+	return len(dAtA) - i, nil
+}
+
+func (m *UnionOperator_ColumnMapping) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalToSizedBuffer(dAtA[:size])
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *UnionOperator_ColumnMapping) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *UnionOperator_ColumnMapping) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	_ = i
+	var l int
+	_ = l
+	if len(m.ColumnIndexes) > 0 {
+		dAtA46 := make([]byte, len(m.ColumnIndexes)*10)
+		var j45 int
+		for _, num1 := range m.ColumnIndexes {
+			num := uint64(num1)
+			for num >= 1<<7 {
+				dAtA46[j45] = uint8(uint64(num)&0x7f | 0x80)
+				num >>= 7
+				j45++
+			}
+			dAtA46[j45] = uint8(num)
+			j45++
+		}
+		i -= j45
+		copy(dAtA[i:], dAtA46[:j45])
+		i = encodeVarintPlan(dAtA, i, uint64(j45))
+		i--
+		dAtA[i] = 0xa
+	}
+	return len(dAtA) - i, nil
+}
+
+func (m *JoinOperator) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalToSizedBuffer(dAtA[:size])
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *JoinOperator) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *JoinOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	_ = i
+	var l int
+	_ = l
+	if m.SortedInputs {
+		i--
+		if m.SortedInputs {
+			dAtA[i] = 1
+		} else {
+			dAtA[i] = 0
+		}
+		i--
+		dAtA[i] = 0x30
+	}
+	if m.RowsPerBatch != 0 {
 		i = encodeVarintPlan(dAtA, i, uint64(m.RowsPerBatch))
 		i--
 		dAtA[i] = 0x28
@@ -8261,20 +9012,20 @@ func (m *EmptySourceOperator) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	var l int
 	_ = l
 	if len(m.ColumnTypes) > 0 {
-		dAtA46 := make([]byte, len(m.ColumnTypes)*10)
-		var j45 int
+		dAtA48 := make([]byte, len(m.ColumnTypes)*10)
+		var j47 int
 		for _, num := range m.ColumnTypes {
 			for num >= 1<<7 {
-				dAtA46[j45] = uint8(uint64(num)&0x7f | 0x80)
+				dAtA48[j47] = uint8(uint64(num)&0x7f | 0x80)
 				num >>= 7
-				j45++
+				j47++
 			}
-			dAtA46[j45] = uint8(num)
-			j45++
+			dAtA48[j47] = uint8(num)
+			j47++
 		}
-		i -= j45
-		copy(dAtA[i:], dAtA46[:j45])
-		i = encodeVarintPlan(dAtA, i, uint64(j45))
+		i -= j47
+		copy(dAtA[i:], dAtA48[:j47])
+		i = encodeVarintPlan(dAtA, i, uint64(j47))
 		i--
 		dAtA[i] = 0x12
 	}
@@ -9177,20 +9928,20 @@ func (m *ScalarFunc) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	var l int
 	_ = l
 	if len(m.ArgsDataTypes) > 0 {
-		dAtA57 := make([]byte, len(m.ArgsDataTypes)*10)
-		var j56 int
+		dAtA59 := make([]byte, len(m.ArgsDataTypes)*10)
+		var j58 int
 		for _, num := range m.ArgsDataTypes {
 			for num >= 1<<7 {
-				dAtA57[j56] = uint8(uint64(num)&0x7f | 0x80)
+				dAtA59[j58] = uint8(uint64(num)&0x7f | 0x80)
 				num >>= 7
-				j56++
+				j58++
 			}
-			dAtA57[j56] = uint8(num)
-			j56++
+			dAtA59[j58] = uint8(num)
+			j58++
 		}
-		i -= j56
-		copy(dAtA[i:], dAtA57[:j56])
-		i = encodeVarintPlan(dAtA, i, uint64(j56))
+		i -= j58
+		copy(dAtA[i:], dAtA59[:j58])
+		i = encodeVarintPlan(dAtA, i, uint64(j58))
 		i--
 		dAtA[i] = 0x2a
 	}
@@ -9258,20 +10009,20 @@ func (m *AggregateExpression) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	var l int
 	_ = l
 	if len(m.ArgsDataTypes) > 0 {
-		dAtA59 := make([]byte, len(m.ArgsDataTypes)*10)
-		var j58 int
+		dAtA61 := make([]byte, len(m.ArgsDataTypes)*10)
+		var j60 int
 		for _, num := range m.ArgsDataTypes {
 			for num >= 1<<7 {
-				dAtA59[j58] = uint8(uint64(num)&0x7f | 0x80)
+				dAtA61[j60] = uint8(uint64(num)&0x7f | 0x80)
 				num >>= 7
-				j58++
+				j60++
 			}
-			dAtA59[j58] = uint8(num)
-			j58++
+			dAtA61[j60] = uint8(num)
+			j60++
 		}
-		i -= j58
-		copy(dAtA[i:], dAtA59[:j58])
-		i = encodeVarintPlan(dAtA, i, uint64(j58))
+		i -= j60
+		copy(dAtA[i:], dAtA61[:j60])
+		i = encodeVarintPlan(dAtA, i, uint64(j60))
 		i--
 		dAtA[i] = 0x3a
 	}
@@ -9451,6 +10202,9 @@ func (m *PlanOptions) Size() (n int) {
 	if m.MaxOutputRowsPerTable != 0 {
 		n += 1 + sovPlan(uint64(m.MaxOutputRowsPerTable))
 	}
+	if m.Priority != 0 {
+		n += 1 + sovPlan(uint64(m.Priority))
+	}
 	return n
 }
 
@@ -9744,6 +10498,30 @@ func (m *Operator_OTelSinkOp) Size() (n int) {
 	}
 	return n
 }
+func (m *Operator_TopnOp) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	if m.TopnOp != nil {
+		l = m.TopnOp.Size()
+		n += 1 + l + sovPlan(uint64(l))
+	}
+	return n
+}
+func (m *Operator_SampleOp) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	if m.SampleOp != nil {
+		l = m.SampleOp.Size()
+		n += 2 + l + sovPlan(uint64(l))
+	}
+	return n
+}
 func (m *Operator_GRPCSinkOp) Size() (n int) {
 	if m == nil {
 		return 0
@@ -10006,6 +10784,15 @@ func (m *AggregateOperator) Size() (n int) {
 	if m.FinalizeResults {
 		n += 2
 	}
+	if m.WindowSizeNs != 0 {
+		n += 1 + sovPlan(uint64(m.WindowSizeNs))
+	}
+	if m.WindowTimeColumnIndex != 0 {
+		n += 1 + sovPlan(uint64(m.WindowTimeColumnIndex))
+	}
+	if m.AllowedLatenessNs != 0 {
+		n += 1 + sovPlan(uint64(m.AllowedLatenessNs))
+	}
 	return n
 }
 
@@ -10053,80 +10840,147 @@ func (m *LimitOperator) Size() (n int) {
 	return n
 }
 
-func (m *UnionOperator) Size() (n int) {
+func (m *TopNOperator) Size() (n int) {
 	if m == nil {
 		return 0
 	}
 	var l int
 	_ = l
-	if len(m.ColumnNames) > 0 {
-		for _, s := range m.ColumnNames {
-			l = len(s)
+	if len(m.SortKeys) > 0 {
+		for _, e := range m.SortKeys {
+			l = e.Size()
 			n += 1 + l + sovPlan(uint64(l))
 		}
 	}
-	if len(m.ColumnMappings) > 0 {
-		for _, e := range m.ColumnMappings {
+	if m.Limit != 0 {
+		n += 1 + sovPlan(uint64(m.Limit))
+	}
+	if len(m.Columns) > 0 {
+		for _, e := range m.Columns {
 			l = e.Size()
 			n += 1 + l + sovPlan(uint64(l))
 		}
 	}
-	if m.RowsPerBatch != 0 {
-		n += 1 + sovPlan(uint64(m.RowsPerBatch))
-	}
 	return n
 }
 
-func (m *UnionOperator_ColumnMapping) Size() (n int) {
+func (m *TopNOperator_SortKey) Size() (n int) {
 	if m == nil {
 		return 0
 	}
 	var l int
 	_ = l
-	if len(m.ColumnIndexes) > 0 {
-		l = 0
-		for _, e := range m.ColumnIndexes {
-			l += sovPlan(uint64(e))
-		}
-		n += 1 + sovPlan(uint64(l)) + l
+	if m.ColumnIndex != 0 {
+		n += 1 + sovPlan(uint64(m.ColumnIndex))
+	}
+	if m.Ascending {
+		n += 2
 	}
 	return n
 }
 
-func (m *JoinOperator) Size() (n int) {
+func (m *SampleOperator) Size() (n int) {
 	if m == nil {
 		return 0
 	}
 	var l int
 	_ = l
-	if m.Type != 0 {
-		n += 1 + sovPlan(uint64(m.Type))
+	if m.NumRows != 0 {
+		n += 1 + sovPlan(uint64(m.NumRows))
 	}
-	if len(m.EqualityConditions) > 0 {
-		for _, e := range m.EqualityConditions {
-			l = e.Size()
-			n += 1 + l + sovPlan(uint64(l))
+	if len(m.GroupIndices) > 0 {
+		l = 0
+		for _, e := range m.GroupIndices {
+			l += sovPlan(uint64(e))
 		}
+		n += 1 + sovPlan(uint64(l)) + l
 	}
-	if len(m.OutputColumns) > 0 {
-		for _, e := range m.OutputColumns {
+	if len(m.Columns) > 0 {
+		for _, e := range m.Columns {
 			l = e.Size()
 			n += 1 + l + sovPlan(uint64(l))
 		}
 	}
-	if len(m.ColumnNames) > 0 {
-		for _, s := range m.ColumnNames {
-			l = len(s)
-			n += 1 + l + sovPlan(uint64(l))
-		}
-	}
-	if m.RowsPerBatch != 0 {
-		n += 1 + sovPlan(uint64(m.RowsPerBatch))
-	}
 	return n
 }
 
-func (m *JoinOperator_EqualityCondition) Size() (n int) {
+func (m *UnionOperator) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	if len(m.ColumnNames) > 0 {
+		for _, s := range m.ColumnNames {
+			l = len(s)
+			n += 1 + l + sovPlan(uint64(l))
+		}
+	}
+	if len(m.ColumnMappings) > 0 {
+		for _, e := range m.ColumnMappings {
+			l = e.Size()
+			n += 1 + l + sovPlan(uint64(l))
+		}
+	}
+	if m.RowsPerBatch != 0 {
+		n += 1 + sovPlan(uint64(m.RowsPerBatch))
+	}
+	return n
+}
+
+func (m *UnionOperator_ColumnMapping) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	if len(m.ColumnIndexes) > 0 {
+		l = 0
+		for _, e := range m.ColumnIndexes {
+			l += sovPlan(uint64(e))
+		}
+		n += 1 + sovPlan(uint64(l)) + l
+	}
+	return n
+}
+
+func (m *JoinOperator) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	if m.Type != 0 {
+		n += 1 + sovPlan(uint64(m.Type))
+	}
+	if len(m.EqualityConditions) > 0 {
+		for _, e := range m.EqualityConditions {
+			l = e.Size()
+			n += 1 + l + sovPlan(uint64(l))
+		}
+	}
+	if len(m.OutputColumns) > 0 {
+		for _, e := range m.OutputColumns {
+			l = e.Size()
+			n += 1 + l + sovPlan(uint64(l))
+		}
+	}
+	if len(m.ColumnNames) > 0 {
+		for _, s := range m.ColumnNames {
+			l = len(s)
+			n += 1 + l + sovPlan(uint64(l))
+		}
+	}
+	if m.RowsPerBatch != 0 {
+		n += 1 + sovPlan(uint64(m.RowsPerBatch))
+	}
+	if m.SortedInputs {
+		n += 2
+	}
+	return n
+}
+
+func (m *JoinOperator_EqualityCondition) Size() (n int) {
 	if m == nil {
 		return 0
 	}
@@ -10755,6 +11609,7 @@ func (this *PlanOptions) String() string {
 		`Explain:` + fmt.Sprintf("%v", this.Explain) + `,`,
 		`Analyze:` + fmt.Sprintf("%v", this.Analyze) + `,`,
 		`MaxOutputRowsPerTable:` + fmt.Sprintf("%v", this.MaxOutputRowsPerTable) + `,`,
+		`Priority:` + fmt.Sprintf("%v", this.Priority) + `,`,
 		`}`,
 	}, "")
 	return s
@@ -10985,6 +11840,26 @@ func (this *Operator_OTelSinkOp) String() string {
 	}, "")
 	return s
 }
+func (this *Operator_TopnOp) String() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&Operator_TopnOp{`,
+		`TopnOp:` + strings.Replace(fmt.Sprintf("%v", this.TopnOp), "TopNOperator", "TopNOperator", 1) + `,`,
+		`}`,
+	}, "")
+	return s
+}
+func (this *Operator_SampleOp) String() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&Operator_SampleOp{`,
+		`SampleOp:` + strings.Replace(fmt.Sprintf("%v", this.SampleOp), "SampleOperator", "SampleOperator", 1) + `,`,
+		`}`,
+	}, "")
+	return s
+}
 func (this *Operator_GRPCSinkOp) String() string {
 	if this == nil {
 		return "nil"
@@ -11129,6 +12004,9 @@ func (this *AggregateOperator) String() string {
 		`Windowed:` + fmt.Sprintf("%v", this.Windowed) + `,`,
 		`PartialAgg:` + fmt.Sprintf("%v", this.PartialAgg) + `,`,
 		`FinalizeResults:` + fmt.Sprintf("%v", this.FinalizeResults) + `,`,
+		`WindowSizeNs:` + fmt.Sprintf("%v", this.WindowSizeNs) + `,`,
+		`WindowTimeColumnIndex:` + fmt.Sprintf("%v", this.WindowTimeColumnIndex) + `,`,
+		`AllowedLatenessNs:` + fmt.Sprintf("%v", this.AllowedLatenessNs) + `,`,
 		`}`,
 	}, "")
 	return s
@@ -11166,6 +12044,56 @@ func (this *LimitOperator) String() string {
 	}, "")
 	return s
 }
+func (this *TopNOperator) String() string {
+	if this == nil {
+		return "nil"
+	}
+	repeatedStringForSortKeys := "[]*TopNOperator_SortKey{"
+	for _, f := range this.SortKeys {
+		repeatedStringForSortKeys += strings.Replace(fmt.Sprintf("%v", f), "TopNOperator_SortKey", "TopNOperator_SortKey", 1) + ","
+	}
+	repeatedStringForSortKeys += "}"
+	repeatedStringForColumns := "[]*Column{"
+	for _, f := range this.Columns {
+		repeatedStringForColumns += strings.Replace(f.String(), "Column", "Column", 1) + ","
+	}
+	repeatedStringForColumns += "}"
+	s := strings.Join([]string{`&TopNOperator{`,
+		`SortKeys:` + repeatedStringForSortKeys + `,`,
+		`Limit:` + fmt.Sprintf("%v", this.Limit) + `,`,
+		`Columns:` + repeatedStringForColumns + `,`,
+		`}`,
+	}, "")
+	return s
+}
+func (this *TopNOperator_SortKey) String() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&TopNOperator_SortKey{`,
+		`ColumnIndex:` + fmt.Sprintf("%v", this.ColumnIndex) + `,`,
+		`Ascending:` + fmt.Sprintf("%v", this.Ascending) + `,`,
+		`}`,
+	}, "")
+	return s
+}
+func (this *SampleOperator) String() string {
+	if this == nil {
+		return "nil"
+	}
+	repeatedStringForColumns := "[]*Column{"
+	for _, f := range this.Columns {
+		repeatedStringForColumns += strings.Replace(f.String(), "Column", "Column", 1) + ","
+	}
+	repeatedStringForColumns += "}"
+	s := strings.Join([]string{`&SampleOperator{`,
+		`NumRows:` + fmt.Sprintf("%v", this.NumRows) + `,`,
+		`GroupIndices:` + fmt.Sprintf("%v", this.GroupIndices) + `,`,
+		`Columns:` + repeatedStringForColumns + `,`,
+		`}`,
+	}, "")
+	return s
+}
 func (this *UnionOperator) String() string {
 	if this == nil {
 		return "nil"
@@ -11213,6 +12141,7 @@ func (this *JoinOperator) String() string {
 		`OutputColumns:` + repeatedStringForOutputColumns + `,`,
 		`ColumnNames:` + fmt.Sprintf("%v", this.ColumnNames) + `,`,
 		`RowsPerBatch:` + fmt.Sprintf("%v", this.RowsPerBatch) + `,`,
+		`SortedInputs:` + fmt.Sprintf("%v", this.SortedInputs) + `,`,
 		`}`,
 	}, "")
 	return s
@@ -11805,6 +12734,25 @@ func (m *PlanOptions) Unmarshal(dAtA []byte) error {
 					break
 				}
 			}
+		case 5:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Priority", wireType)
+			}
+			m.Priority = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Priority |= QueryPriority(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipPlan(dAtA[iNdEx:])
@@ -13181,6 +14129,76 @@ func (m *Operator) Unmarshal(dAtA []byte) error {
 			}
 			m.Op = &Operator_OTelSinkOp{v}
 			iNdEx = postIndex
+		case 15:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field TopnOp", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + msglen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			v := &TopNOperator{}
+			if err := v.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			m.Op = &Operator_TopnOp{v}
+			iNdEx = postIndex
+		case 16:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field SampleOp", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + msglen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			v := &SampleOperator{}
+			if err := v.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			m.Op = &Operator_SampleOp{v}
+			iNdEx = postIndex
 		case 1000:
 			if wireType != 2 {
 				return fmt.Errorf("proto: wrong wireType = %d for field GRPCSinkOp", wireType)
@@ -14867,6 +15885,63 @@ func (m *AggregateOperator) Unmarshal(dAtA []byte) error {
 				}
 			}
 			m.FinalizeResults = bool(v != 0)
+		case 8:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field WindowSizeNs", wireType)
+			}
+			m.WindowSizeNs = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.WindowSizeNs |= int64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 9:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field WindowTimeColumnIndex", wireType)
+			}
+			m.WindowTimeColumnIndex = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.WindowTimeColumnIndex |= int64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 10:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field AllowedLatenessNs", wireType)
+			}
+			m.AllowedLatenessNs = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.AllowedLatenessNs |= int64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
 		default:
 			iNdEx = preIndex
 			skippy, err := skipPlan(dAtA[iNdEx:])
@@ -15187,7 +16262,7 @@ func (m *LimitOperator) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
-func (m *UnionOperator) Unmarshal(dAtA []byte) error {
+func (m *TopNOperator) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
 	for iNdEx < l {
@@ -15210,17 +16285,422 @@ func (m *UnionOperator) Unmarshal(dAtA []byte) error {
 		fieldNum := int32(wire >> 3)
 		wireType := int(wire & 0x7)
 		if wireType == 4 {
-			return fmt.Errorf("proto: UnionOperator: wiretype end group for non-group")
+			return fmt.Errorf("proto: TopNOperator: wiretype end group for non-group")
 		}
 		if fieldNum <= 0 {
-			return fmt.Errorf("proto: UnionOperator: illegal tag %d (wire type %d)", fieldNum, wire)
+			return fmt.Errorf("proto: TopNOperator: illegal tag %d (wire type %d)", fieldNum, wire)
 		}
 		switch fieldNum {
 		case 1:
 			if wireType != 2 {
-				return fmt.Errorf("proto: wrong wireType = %d for field ColumnNames", wireType)
+				return fmt.Errorf("proto: wrong wireType = %d for field SortKeys", wireType)
 			}
-			var stringLen uint64
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + msglen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.SortKeys = append(m.SortKeys, &TopNOperator_SortKey{})
+			if err := m.SortKeys[len(m.SortKeys)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Limit", wireType)
+			}
+			m.Limit = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.Limit |= int64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 3:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Columns", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + msglen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Columns = append(m.Columns, &Column{})
+			if err := m.Columns[len(m.Columns)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipPlan(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if (skippy < 0) || (iNdEx+skippy) < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *TopNOperator_SortKey) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowPlan
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= uint64(b&0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: SortKey: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: SortKey: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field ColumnIndex", wireType)
+			}
+			m.ColumnIndex = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.ColumnIndex |= int64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Ascending", wireType)
+			}
+			var v int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				v |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			m.Ascending = bool(v != 0)
+		default:
+			iNdEx = preIndex
+			skippy, err := skipPlan(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if (skippy < 0) || (iNdEx+skippy) < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *SampleOperator) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowPlan
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= uint64(b&0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: SampleOperator: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: SampleOperator: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field NumRows", wireType)
+			}
+			m.NumRows = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.NumRows |= int64(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
+			if wireType == 0 {
+				var v int64
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowPlan
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					v |= int64(b&0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				m.GroupIndices = append(m.GroupIndices, v)
+			} else if wireType == 2 {
+				var packedLen int
+				for shift := uint(0); ; shift += 7 {
+					if shift >= 64 {
+						return ErrIntOverflowPlan
+					}
+					if iNdEx >= l {
+						return io.ErrUnexpectedEOF
+					}
+					b := dAtA[iNdEx]
+					iNdEx++
+					packedLen |= int(b&0x7F) << shift
+					if b < 0x80 {
+						break
+					}
+				}
+				if packedLen < 0 {
+					return ErrInvalidLengthPlan
+				}
+				postIndex := iNdEx + packedLen
+				if postIndex < 0 {
+					return ErrInvalidLengthPlan
+				}
+				if postIndex > l {
+					return io.ErrUnexpectedEOF
+				}
+				var elementCount int
+				var count int
+				for _, integer := range dAtA[iNdEx:postIndex] {
+					if integer < 128 {
+						count++
+					}
+				}
+				elementCount = count
+				if elementCount != 0 && len(m.GroupIndices) == 0 {
+					m.GroupIndices = make([]int64, 0, elementCount)
+				}
+				for iNdEx < postIndex {
+					var v int64
+					for shift := uint(0); ; shift += 7 {
+						if shift >= 64 {
+							return ErrIntOverflowPlan
+						}
+						if iNdEx >= l {
+							return io.ErrUnexpectedEOF
+						}
+						b := dAtA[iNdEx]
+						iNdEx++
+						v |= int64(b&0x7F) << shift
+						if b < 0x80 {
+							break
+						}
+					}
+					m.GroupIndices = append(m.GroupIndices, v)
+				}
+			} else {
+				return fmt.Errorf("proto: wrong wireType = %d for field GroupIndices", wireType)
+			}
+		case 3:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Columns", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthPlan
+			}
+			postIndex := iNdEx + msglen
+			if postIndex < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Columns = append(m.Columns, &Column{})
+			if err := m.Columns[len(m.Columns)-1].Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipPlan(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if (skippy < 0) || (iNdEx+skippy) < 0 {
+				return ErrInvalidLengthPlan
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
+func (m *UnionOperator) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowPlan
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= uint64(b&0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: UnionOperator: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: UnionOperator: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field ColumnNames", wireType)
+			}
+			var stringLen uint64
 			for shift := uint(0); ; shift += 7 {
 				if shift >= 64 {
 					return ErrIntOverflowPlan
@@ -15615,6 +17095,26 @@ func (m *JoinOperator) Unmarshal(dAtA []byte) error {
 					break
 				}
 			}
+		case 6:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field SortedInputs", wireType)
+			}
+			var v int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowPlan
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				v |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			m.SortedInputs = bool(v != 0)
 		default:
 			iNdEx = preIndex
 			skippy, err := skipPlan(dAtA[iNdEx:])
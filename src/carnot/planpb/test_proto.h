@@ -335,6 +335,47 @@ columns {
   index: 2
 }
 )";
+
+constexpr char kTopNOperator1[] = R"(
+limit: 3
+sort_keys {
+  column_index: 1
+  ascending: false
+}
+columns {
+  node: 1
+  index: 0
+}
+columns {
+  node: 1
+  index: 1
+}
+)";
+
+constexpr char kSampleOperator1[] = R"(
+num_rows: 3
+columns {
+  node: 1
+  index: 0
+}
+columns {
+  node: 1
+  index: 1
+}
+)";
+
+constexpr char kSampleOperator2[] = R"(
+num_rows: 2
+group_indices: 0
+columns {
+  node: 1
+  index: 0
+}
+columns {
+  node: 1
+  index: 1
+}
+)";
 // relation 1: [abc, time_]
 // relation 2: [time_, abc]
 // maps to output relation:
@@ -1478,6 +1519,30 @@ planpb::Operator CreateTestDropLimit1PB() {
   return op;
 }
 
+planpb::Operator CreateTestTopN1PB() {
+  planpb::Operator op;
+  auto op_proto =
+      absl::Substitute(kOperatorProtoTmpl, "TOPN_OPERATOR", "topn_op", kTopNOperator1);
+  CHECK(google::protobuf::TextFormat::MergeFromString(op_proto, &op)) << "Failed to parse proto";
+  return op;
+}
+
+planpb::Operator CreateTestSample1PB() {
+  planpb::Operator op;
+  auto op_proto =
+      absl::Substitute(kOperatorProtoTmpl, "SAMPLE_OPERATOR", "sample_op", kSampleOperator1);
+  CHECK(google::protobuf::TextFormat::MergeFromString(op_proto, &op)) << "Failed to parse proto";
+  return op;
+}
+
+planpb::Operator CreateTestSample2PB() {
+  planpb::Operator op;
+  auto op_proto =
+      absl::Substitute(kOperatorProtoTmpl, "SAMPLE_OPERATOR", "sample_op", kSampleOperator2);
+  CHECK(google::protobuf::TextFormat::MergeFromString(op_proto, &op)) << "Failed to parse proto";
+  return op;
+}
+
 planpb::Operator CreateTestJoinWithTimePB() {
   planpb::Operator op;
   auto op_proto = absl::Substitute(kOperatorProtoTmpl, "JOIN_OPERATOR", "join_op", kJoinOperator1);
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/query_scheduler.h"
+
+#include <string>
+
+#include "src/common/metrics/metrics.h"
+
+DEFINE_int32(carnot_max_latency_sensitive_queries, 0,
+             "Maximum number of latency-sensitive queries executing concurrently on this Carnot "
+             "instance. 0 (the default) disables the limit.");
+DEFINE_int32(carnot_max_ad_hoc_queries, 0,
+             "Maximum number of ad-hoc queries executing concurrently on this Carnot instance. "
+             "0 (the default) disables the limit.");
+DEFINE_int64(carnot_latency_sensitive_memory_quota_bytes, 0,
+             "Total memory quota for concurrently running latency-sensitive queries. Each "
+             "admitted query's memory pool is limited to the quota divided by "
+             "--carnot_max_latency_sensitive_queries. 0 (the default) disables the quota.");
+DEFINE_int64(carnot_ad_hoc_memory_quota_bytes, 0,
+             "Total memory quota for concurrently running ad-hoc queries. Each admitted query's "
+             "memory pool is limited to the quota divided by --carnot_max_ad_hoc_queries. "
+             "0 (the default) disables the quota.");
+DEFINE_int32(carnot_query_admission_timeout_ms, 5000,
+             "How long a query waits for a free slot in its priority class before failing with "
+             "ResourceUnavailable. <= 0 waits indefinitely.");
+
+namespace px {
+namespace carnot {
+
+std::array<QueryScheduler::ClassMetrics, QueryScheduler::kNumClasses>
+QueryScheduler::BuildMetrics() {
+  auto& queue_depth_family = prometheus::BuildGauge()
+                                 .Name("carnot_query_queue_depth")
+                                 .Help("Number of queries waiting for admission, per priority "
+                                       "class.")
+                                 .Register(GetMetricsRegistry());
+  auto& running_family = prometheus::BuildGauge()
+                             .Name("carnot_queries_running")
+                             .Help("Number of queries currently executing, per priority class.")
+                             .Register(GetMetricsRegistry());
+  auto& admitted_family = prometheus::BuildCounter()
+                              .Name("carnot_queries_admitted_total")
+                              .Help("Number of queries admitted for execution, per priority "
+                                    "class.")
+                              .Register(GetMetricsRegistry());
+  auto& timed_out_family =
+      prometheus::BuildCounter()
+          .Name("carnot_query_admission_timeouts_total")
+          .Help("Number of queries that timed out waiting for admission, per priority class.")
+          .Register(GetMetricsRegistry());
+
+  auto build_class = [&](const std::string& priority) {
+    return ClassMetrics{queue_depth_family.Add({{"priority", priority}}),
+                        running_family.Add({{"priority", priority}}),
+                        admitted_family.Add({{"priority", priority}}),
+                        timed_out_family.Add({{"priority", priority}})};
+  };
+  return {{build_class("latency_sensitive"), build_class("ad_hoc")}};
+}
+
+QueryScheduler::QueryScheduler()
+    : QueryScheduler(
+          ClassConfig{FLAGS_carnot_max_latency_sensitive_queries,
+                      FLAGS_carnot_latency_sensitive_memory_quota_bytes},
+          ClassConfig{FLAGS_carnot_max_ad_hoc_queries, FLAGS_carnot_ad_hoc_memory_quota_bytes},
+          std::chrono::milliseconds(FLAGS_carnot_query_admission_timeout_ms)) {}
+
+QueryScheduler::QueryScheduler(const ClassConfig& latency_sensitive, const ClassConfig& ad_hoc,
+                               std::chrono::milliseconds admission_timeout)
+    : admission_timeout_(admission_timeout),
+      configs_({{latency_sensitive, ad_hoc}}),
+      metrics_(BuildMetrics()) {}
+
+size_t QueryScheduler::ClassIndex(planpb::QueryPriority priority) {
+  // Unknown priorities (e.g. plans from older query brokers) are treated as ad-hoc;
+  // with the default flags, that class is unlimited.
+  return priority == planpb::QUERY_PRIORITY_LATENCY_SENSITIVE ? 0 : 1;
+}
+
+StatusOr<QueryScheduler::QuerySlot> QueryScheduler::Admit(planpb::QueryPriority priority) {
+  const size_t class_idx = ClassIndex(priority);
+  const ClassConfig& config = configs_[class_idx];
+  ClassMetrics& metrics = metrics_[class_idx];
+
+  absl::MutexLock lock(&mu_);
+  ClassState& cls = classes_[class_idx];
+
+  auto slot_free = [&config, &cls]() {
+    return config.max_concurrency == 0 || cls.running < config.max_concurrency;
+  };
+  if (!slot_free()) {
+    ++cls.waiting;
+    metrics.queue_depth.Increment();
+    bool admitted = true;
+    if (admission_timeout_.count() > 0) {
+      admitted = mu_.AwaitWithTimeout(absl::Condition(&slot_free),
+                                      absl::FromChrono(admission_timeout_));
+    } else {
+      mu_.Await(absl::Condition(&slot_free));
+    }
+    --cls.waiting;
+    metrics.queue_depth.Decrement();
+    if (!admitted) {
+      metrics.timed_out_total.Increment();
+      return error::ResourceUnavailable(
+          "Query admission timed out after $0 ms: $1 queries of the same priority class are "
+          "already running.",
+          admission_timeout_.count(), cls.running);
+    }
+  }
+
+  ++cls.running;
+  metrics.running.Increment();
+  metrics.admitted_total.Increment();
+  return QuerySlot(this, class_idx);
+}
+
+void QueryScheduler::Release(size_t class_idx) {
+  absl::MutexLock lock(&mu_);
+  --classes_[class_idx].running;
+  metrics_[class_idx].running.Decrement();
+}
+
+int64_t QueryScheduler::QuerySlot::query_memory_limit_bytes() const {
+  if (scheduler_ == nullptr) {
+    return 0;
+  }
+  const ClassConfig& config = scheduler_->configs_[class_idx_];
+  if (config.memory_quota_bytes == 0 || config.max_concurrency == 0) {
+    return 0;
+  }
+  return config.memory_quota_bytes / config.max_concurrency;
+}
+
+void QueryScheduler::QuerySlot::Release() {
+  if (scheduler_ != nullptr) {
+    scheduler_->Release(class_idx_);
+    scheduler_ = nullptr;
+  }
+}
+
+}  // namespace carnot
+}  // namespace px
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <utility>
+
+#include <absl/synchronization/mutex.h>
+#include <prometheus/counter.h>
+#include <prometheus/gauge.h>
+
+#include "src/carnot/planpb/plan.pb.h"
+#include "src/common/base/base.h"
+
+DECLARE_int32(carnot_max_latency_sensitive_queries);
+DECLARE_int32(carnot_max_ad_hoc_queries);
+DECLARE_int64(carnot_latency_sensitive_memory_quota_bytes);
+DECLARE_int64(carnot_ad_hoc_memory_quota_bytes);
+DECLARE_int32(carnot_query_admission_timeout_ms);
+
+namespace px {
+namespace carnot {
+
+/**
+ * QueryScheduler admits queries into execution by priority class, so latency-sensitive scripted
+ * queries (e.g. alerting) are isolated from bursts of ad-hoc exploration on shared Carnot
+ * instances.
+ *
+ * Each class has its own concurrency limit and memory quota (both from flags; 0 disables).
+ * Admit() blocks until a slot in the query's class frees up, or fails with ResourceUnavailable
+ * after the admission timeout, so a burst of one class queues against itself and never against
+ * the other class. The memory quota is drawn down through the per-query memory pools: each
+ * admitted query's QueryMemoryPool limit is its class quota divided by the class concurrency
+ * limit. Queue depth and admission outcomes are exported as metrics per class.
+ *
+ * Thread-safe; queries execute on their callers' threads and a slot is held for the duration of
+ * one query via the RAII QuerySlot.
+ */
+class QueryScheduler : public NotCopyable {
+ public:
+  // Per-class admission limits. Zero disables the corresponding limit.
+  struct ClassConfig {
+    int32_t max_concurrency = 0;
+    int64_t memory_quota_bytes = 0;
+  };
+
+  // RAII handle for an admitted query; releases the slot on destruction.
+  class QuerySlot {
+   public:
+    QuerySlot() = default;
+    QuerySlot(QuerySlot&& other) noexcept { *this = std::move(other); }
+    QuerySlot& operator=(QuerySlot&& other) noexcept {
+      Release();
+      scheduler_ = other.scheduler_;
+      class_idx_ = other.class_idx_;
+      other.scheduler_ = nullptr;
+      return *this;
+    }
+    ~QuerySlot() { Release(); }
+
+    // The memory limit for this query's QueryMemoryPool: the class quota divided by the class
+    // concurrency limit. 0 if the class has no quota (the per-query flag limit then applies).
+    int64_t query_memory_limit_bytes() const;
+
+   private:
+    friend class QueryScheduler;
+    QuerySlot(QueryScheduler* scheduler, size_t class_idx)
+        : scheduler_(scheduler), class_idx_(class_idx) {}
+
+    void Release();
+
+    QueryScheduler* scheduler_ = nullptr;
+    size_t class_idx_ = 0;
+  };
+
+  // Creates a scheduler configured from the carnot_* admission flags.
+  QueryScheduler();
+  QueryScheduler(const ClassConfig& latency_sensitive, const ClassConfig& ad_hoc,
+                 std::chrono::milliseconds admission_timeout);
+
+  /**
+   * Blocks until the query can be admitted under its class's concurrency limit, and returns a
+   * slot that must be held for the duration of the query. Fails with ResourceUnavailable if no
+   * slot frees up within the admission timeout. QUERY_PRIORITY_UNKNOWN is treated as ad-hoc.
+   */
+  StatusOr<QuerySlot> Admit(planpb::QueryPriority priority);
+
+ private:
+  static constexpr size_t kNumClasses = 2;
+  static size_t ClassIndex(planpb::QueryPriority priority);
+
+  struct ClassState {
+    int32_t running = 0;
+    int32_t waiting = 0;
+  };
+
+  // Per-class observability: queue depth, running count, and admission outcomes.
+  struct ClassMetrics {
+    prometheus::Gauge& queue_depth;
+    prometheus::Gauge& running;
+    prometheus::Counter& admitted_total;
+    prometheus::Counter& timed_out_total;
+  };
+  static std::array<ClassMetrics, kNumClasses> BuildMetrics();
+
+  void Release(size_t class_idx);
+
+  const std::chrono::milliseconds admission_timeout_;
+  const std::array<ClassConfig, kNumClasses> configs_;
+
+  absl::Mutex mu_;
+  std::array<ClassState, kNumClasses> classes_ ABSL_GUARDED_BY(mu_);
+  std::array<ClassMetrics, kNumClasses> metrics_;
+};
+
+}  // namespace carnot
+}  // namespace px
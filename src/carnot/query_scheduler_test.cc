@@ -0,0 +1,91 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/carnot/query_scheduler.h"
+
+#include <thread>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace carnot {
+
+using ::px::testing::status::StatusIs;
+
+constexpr auto kShortTimeout = std::chrono::milliseconds{50};
+constexpr auto kLongTimeout = std::chrono::milliseconds{30000};
+
+TEST(QueryScheduler, UnlimitedByDefault) {
+  QueryScheduler scheduler({}, {}, kShortTimeout);
+
+  std::vector<QueryScheduler::QuerySlot> slots;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto slot, scheduler.Admit(planpb::QUERY_PRIORITY_AD_HOC));
+    slots.push_back(std::move(slot));
+  }
+}
+
+TEST(QueryScheduler, TimesOutWhenClassIsFull) {
+  QueryScheduler scheduler(/*latency_sensitive*/ {}, /*ad_hoc*/ {/*max_concurrency*/ 1},
+                           kShortTimeout);
+
+  ASSERT_OK_AND_ASSIGN(auto slot, scheduler.Admit(planpb::QUERY_PRIORITY_AD_HOC));
+
+  // The ad-hoc class is full, but latency-sensitive queries are not affected.
+  ASSERT_OK(scheduler.Admit(planpb::QUERY_PRIORITY_LATENCY_SENSITIVE));
+  EXPECT_THAT(scheduler.Admit(planpb::QUERY_PRIORITY_AD_HOC).status(),
+              StatusIs(statuspb::RESOURCE_UNAVAILABLE));
+
+  // Unknown priorities queue in the ad-hoc class.
+  EXPECT_THAT(scheduler.Admit(planpb::QUERY_PRIORITY_UNKNOWN).status(),
+              StatusIs(statuspb::RESOURCE_UNAVAILABLE));
+}
+
+TEST(QueryScheduler, WaitsForAFreedSlot) {
+  QueryScheduler scheduler(/*latency_sensitive*/ {/*max_concurrency*/ 1}, /*ad_hoc*/ {},
+                           kLongTimeout);
+
+  QueryScheduler::QuerySlot slot =
+      scheduler.Admit(planpb::QUERY_PRIORITY_LATENCY_SENSITIVE).ConsumeValueOrDie();
+
+  std::thread releaser([&slot]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    // Dropping the slot frees the class for the waiting Admit below.
+    slot = QueryScheduler::QuerySlot();
+  });
+
+  ASSERT_OK(scheduler.Admit(planpb::QUERY_PRIORITY_LATENCY_SENSITIVE));
+  releaser.join();
+}
+
+TEST(QueryScheduler, MemoryQuotaIsSplitAcrossSlots) {
+  QueryScheduler scheduler(
+      /*latency_sensitive*/ {/*max_concurrency*/ 4, /*memory_quota_bytes*/ 1024},
+      /*ad_hoc*/ {/*max_concurrency*/ 2}, kShortTimeout);
+
+  ASSERT_OK_AND_ASSIGN(auto ls_slot, scheduler.Admit(planpb::QUERY_PRIORITY_LATENCY_SENSITIVE));
+  EXPECT_EQ(ls_slot.query_memory_limit_bytes(), 256);
+
+  // No quota configured for the ad-hoc class.
+  ASSERT_OK_AND_ASSIGN(auto ah_slot, scheduler.Admit(planpb::QUERY_PRIORITY_AD_HOC));
+  EXPECT_EQ(ah_slot.query_memory_limit_bytes(), 0);
+}
+
+}  // namespace carnot
+}  // namespace px
@@ -18,6 +18,8 @@
 
 #include "src/carnot/udf/registry.h"
 
+#include <algorithm>
+
 namespace px {
 namespace carnot {
 namespace udf {
@@ -189,6 +191,14 @@ StatusOr<ScalarUDFDefinition*> Registry::GetScalarUDFDefinition(
 
 StatusOr<UDFDefinition*> Registry::GetDefinition(
     const std::string& name, const std::vector<types::DataType>& registry_arg_types) const {
+  if (frozen_) {
+    const auto* entry = FindFlatEntry(name, registry_arg_types);
+    if (entry == nullptr) {
+      return error::NotFound("No UDF matching $0 found.",
+                             RegistryKey(name, registry_arg_types).DebugString());
+    }
+    return entry->def;
+  }
   auto key = RegistryKey(name, registry_arg_types);
   auto it = map_.find(key);
   if (it == map_.end()) {
@@ -197,6 +207,57 @@ StatusOr<UDFDefinition*> Registry::GetDefinition(
   return it->second.get();
 }
 
+void Registry::Freeze() {
+  flat_index_.clear();
+  flat_index_.reserve(map_.size());
+  // map_ is ordered by RegistryKey, so the flat index comes out sorted by (name, arg_types).
+  for (const auto& [key, def] : map_) {
+    flat_index_.push_back(FlatEntry{key.name(), key.registry_arg_types(), def.get()});
+  }
+  frozen_ = true;
+}
+
+const Registry::FlatEntry* Registry::FindFlatEntry(
+    const std::string& name, const std::vector<types::DataType>& registry_arg_types) const {
+  auto it = std::lower_bound(flat_index_.begin(), flat_index_.end(),
+                             std::make_pair(&name, &registry_arg_types),
+                             [](const FlatEntry& entry, const auto& target) {
+                               if (entry.name != *target.first) {
+                                 return entry.name < *target.first;
+                               }
+                               return entry.arg_types < *target.second;
+                             });
+  if (it == flat_index_.end() || it->name != name || it->arg_types != registry_arg_types) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+StatusOr<int64_t> Registry::GetDefinitionID(
+    const std::string& name, const std::vector<types::DataType>& registry_arg_types) const {
+  if (!frozen_) {
+    return error::FailedPrecondition("Registry '$0' must be frozen before ids are assigned.",
+                                     name_);
+  }
+  const auto* entry = FindFlatEntry(name, registry_arg_types);
+  if (entry == nullptr) {
+    return error::NotFound("No UDF matching $0 found.",
+                           RegistryKey(name, registry_arg_types).DebugString());
+  }
+  return static_cast<int64_t>(entry - flat_index_.data());
+}
+
+StatusOr<UDFDefinition*> Registry::GetDefinitionByID(int64_t id) const {
+  if (!frozen_) {
+    return error::FailedPrecondition("Registry '$0' must be frozen before ids are assigned.",
+                                     name_);
+  }
+  if (id < 0 || id >= static_cast<int64_t>(flat_index_.size())) {
+    return error::NotFound("No UDF with id $0.", id);
+  }
+  return flat_index_[id].def;
+}
+
 }  // namespace udf
 }  // namespace carnot
 }  // namespace px
@@ -60,7 +60,7 @@ class RegistryKey {
 
   std::string DebugString() const;
 
-  const std::vector<types::DataType> registry_arg_types() { return registry_arg_types_; }
+  const std::vector<types::DataType>& registry_arg_types() const { return registry_arg_types_; }
 
   /**
    * LessThan operator overload so we can use this in maps.
@@ -112,6 +112,10 @@ class Registry {
    */
   template <typename T>
   Status Register(const std::string& name) {
+    if (frozen_) {
+      return error::FailedPrecondition("Registry '$0' is frozen, cannot register '$1'.", name_,
+                                       name);
+    }
     auto udf_def = std::make_unique<typename RegistryTraits<T>::TUDFDef>(name);
     PL_RETURN_IF_ERROR(udf_def->template Init<T>());
 
@@ -182,6 +186,10 @@ class Registry {
     static_assert(std::is_base_of_v<UDTF<TUDTF>, TUDTF>,
                   "Register factory is only valid for UDTFs");
 
+    if (frozen_) {
+      return error::FailedPrecondition("Registry '$0' is frozen, cannot register '$1'.", name_,
+                                       name);
+    }
     auto factory = std::make_unique<TFactory>(std::forward<Args>(args)...);
     auto udf_def = std::make_unique<UDTFDefinition>(name);
     PL_RETURN_IF_ERROR(udf_def->template Init<TUDTF>(std::move(factory)));
@@ -214,6 +222,31 @@ class Registry {
   StatusOr<UDTFDefinition*> GetUDTFDefinition(
       const std::string& name, const std::vector<types::DataType>& registry_arg_types = {}) const;
 
+  /**
+   * Freezes the registry into a sorted flat index with dense integer ids.
+   *
+   * Registration happens once at startup, but definitions are resolved for every function of
+   * every plan we instantiate. Freezing copies the registration map into a contiguous sorted
+   * array so lookups binary search flat entries without materializing a RegistryKey (and its
+   * string/vector copies) per call, and assigns each definition a stable id that plans can carry
+   * in place of a name plus argument types. Registering into a frozen registry is an error.
+   */
+  void Freeze();
+
+  bool frozen() const { return frozen_; }
+
+  /**
+   * Returns the id assigned to the definition matching the name and arg types.
+   * Ids are only assigned once the registry is frozen.
+   */
+  StatusOr<int64_t> GetDefinitionID(
+      const std::string& name, const std::vector<types::DataType>& registry_arg_types = {}) const;
+
+  /**
+   * Returns the definition with the given frozen id.
+   */
+  StatusOr<UDFDefinition*> GetDefinitionByID(int64_t id) const;
+
   std::string DebugString() const;
   udfspb::UDFInfo ToProto();
 
@@ -237,10 +270,23 @@ class Registry {
   void ToProto(const UDADefinition& def, udfspb::UDASpec* spec);
   void ToProto(const UDTFDefinition& def, udfspb::UDTFSourceSpec* spec);
 
+  // One entry of the frozen lookup index. Entries are sorted by (name, arg_types), matching
+  // RegistryKey ordering, and an entry's position in flat_index_ is its id.
+  struct FlatEntry {
+    std::string name;
+    std::vector<types::DataType> arg_types;
+    UDFDefinition* def;
+  };
+
+  const FlatEntry* FindFlatEntry(const std::string& name,
+                                 const std::vector<types::DataType>& registry_arg_types) const;
+
   std::string name_;
   RegistryMap map_;
   std::map<std::string, ExplicitRuleSet> semantic_type_rules_;
   udfspb::Docs docs_pb_;
+  std::vector<FlatEntry> flat_index_;
+  bool frozen_ = false;
 };
 
 }  // namespace udf
@@ -162,6 +162,45 @@ TEST(Registry, no_such_udf) {
   EXPECT_NOT_OK(statusor);
 }
 
+TEST(Registry, frozen_lookup) {
+  auto registry = Registry("test registry");
+  registry.RegisterOrDie<AddUDF<types::Float64Value, types::Int64Value, types::Float64Value>>(
+      "add");
+  registry.RegisterOrDie<AddUDF<types::Float64Value, types::Float64Value, types::Float64Value>>(
+      "add");
+  registry.RegisterOrDie<ScalarUDF1>("scalar1");
+
+  // Ids are only assigned once the registry is frozen.
+  EXPECT_NOT_OK(registry.GetDefinitionID("scalar1"));
+
+  registry.Freeze();
+  EXPECT_TRUE(registry.frozen());
+
+  auto statusor = registry.GetScalarUDFDefinition(
+      "add", std::vector<types::DataType>({types::DataType::INT64, types::DataType::FLOAT64}));
+  ASSERT_OK(statusor);
+  EXPECT_EQ("add", statusor.ConsumeValueOrDie()->name());
+
+  statusor = registry.GetScalarUDFDefinition(
+      "add", std::vector<types::DataType>({types::DataType::INT64, types::DataType::INT64}));
+  ASSERT_FALSE(statusor.ok());
+  EXPECT_TRUE(error::IsNotFound(statusor.status()));
+
+  // The frozen id resolves back to the same definition.
+  auto id_or = registry.GetDefinitionID(
+      "add", std::vector<types::DataType>({types::DataType::FLOAT64, types::DataType::FLOAT64}));
+  ASSERT_OK(id_or);
+  auto def_or = registry.GetDefinitionByID(id_or.ConsumeValueOrDie());
+  ASSERT_OK(def_or);
+  EXPECT_EQ("add", def_or.ConsumeValueOrDie()->name());
+  EXPECT_NOT_OK(registry.GetDefinitionByID(1000));
+
+  // No new registrations once frozen.
+  auto status = registry.Register<ScalarUDF1>("scalar2");
+  EXPECT_NOT_OK(status);
+  EXPECT_TRUE(absl::StrContains(status.msg(), "frozen"));
+}
+
 TEST(RegistryDeathTest, double_register) {
   auto registry = Registry("test registry");
   registry.RegisterOrDie<ScalarUDF1>("scalar1");
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include "src/common/base/base.h"
+#include "src/shared/types/types.h"
+
+namespace px {
+namespace carnot {
+namespace udf {
+
+/**
+ * Helpers for UDA partial aggregate serialization.
+ *
+ * UDAs whose state is a trivially copyable struct can serialize through these instead of
+ * hand-rolling reinterpret_casts over the StringValue transport. The wire format is a one byte
+ * version tag followed by the raw state bytes. The tag lets a UDA evolve its state layout and
+ * reject (rather than silently misinterpret) partials produced by an incompatible sender, and
+ * deserialization validates the payload size so truncated or corrupt partials surface as errors
+ * instead of out-of-bounds reads.
+ */
+inline constexpr uint8_t kDefaultUDAStateVersion = 1;
+
+template <typename TState>
+types::StringValue SerializePodUDAState(const TState& state,
+                                        uint8_t version = kDefaultUDAStateVersion) {
+  static_assert(std::is_trivially_copyable_v<TState>,
+                "SerializePodUDAState requires a trivially copyable state type");
+  types::StringValue out;
+  out.resize(1 + sizeof(TState));
+  out[0] = static_cast<char>(version);
+  std::memcpy(out.data() + 1, &state, sizeof(TState));
+  return out;
+}
+
+template <typename TState>
+Status DeserializePodUDAState(const types::StringValue& data, TState* state,
+                              uint8_t version = kDefaultUDAStateVersion) {
+  static_assert(std::is_trivially_copyable_v<TState>,
+                "DeserializePodUDAState requires a trivially copyable state type");
+  if (data.size() != 1 + sizeof(TState)) {
+    return error::InvalidArgument("Serialized UDA state is $0 bytes, expected $1", data.size(),
+                                  1 + sizeof(TState));
+  }
+  if (static_cast<uint8_t>(data[0]) != version) {
+    return error::InvalidArgument("Serialized UDA state has version $0, expected $1",
+                                  static_cast<int>(static_cast<uint8_t>(data[0])),
+                                  static_cast<int>(version));
+  }
+  std::memcpy(state, data.data() + 1, sizeof(TState));
+  return Status::OK();
+}
+
+}  // namespace udf
+}  // namespace carnot
+}  // namespace px
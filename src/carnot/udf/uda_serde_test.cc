@@ -0,0 +1,61 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "src/carnot/udf/uda_serde.h"
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace carnot {
+namespace udf {
+
+struct TestAggState {
+  uint64_t size = 0;
+  double sum = 0;
+};
+
+TEST(UDASerde, pod_roundtrip) {
+  TestAggState state{42, 3.5};
+  auto serialized = SerializePodUDAState(state);
+  EXPECT_EQ(1 + sizeof(TestAggState), serialized.size());
+
+  TestAggState out;
+  EXPECT_OK(DeserializePodUDAState(serialized, &out));
+  EXPECT_EQ(42, out.size);
+  EXPECT_DOUBLE_EQ(3.5, out.sum);
+}
+
+TEST(UDASerde, rejects_wrong_size) {
+  TestAggState out;
+  EXPECT_NOT_OK(DeserializePodUDAState(types::StringValue("abc"), &out));
+}
+
+TEST(UDASerde, rejects_wrong_version) {
+  TestAggState state{1, 1.0};
+  auto serialized = SerializePodUDAState(state, /*version*/ 2);
+
+  TestAggState out;
+  EXPECT_NOT_OK(DeserializePodUDAState(serialized, &out));
+  EXPECT_OK(DeserializePodUDAState(serialized, &out, /*version*/ 2));
+  EXPECT_EQ(1, out.size);
+}
+
+}  // namespace udf
+}  // namespace carnot
+}  // namespace px
@@ -143,6 +143,33 @@ static constexpr bool IsValidExecFunc(ReturnType (TUDF::*)(FunctionContext*, Typ
   return true;
 }
 
+/**
+ * Checks to see if a valid looking ExecBatchArrow function exists.
+ */
+template <typename ReturnType, typename TUDF, typename... Types>
+static constexpr bool IsValidExecBatchArrowFn(ReturnType (TUDF::*)(Types...)) {
+  return false;
+}
+
+template <typename TUDF>
+static constexpr bool IsValidExecBatchArrowFn(Status (TUDF::*)(FunctionContext*,
+                                                               const std::vector<arrow::Array*>&,
+                                                               arrow::ArrayBuilder*, int)) {
+  return true;
+}
+
+// SFINAE test for an optional vectorized arrow batch exec fn.
+template <typename T, typename = void>
+struct has_udf_exec_batch_arrow_fn : std::false_type {};
+
+template <typename T>
+struct has_udf_exec_batch_arrow_fn<T, std::void_t<decltype(&T::ExecBatchArrow)>> : std::true_type {
+  static_assert(IsValidExecBatchArrowFn(&T::ExecBatchArrow),
+                "If an ExecBatchArrow function exists, it must have the form: Status "
+                "ExecBatchArrow(FunctionContext*, const std::vector<arrow::Array*>&, "
+                "arrow::ArrayBuilder*, int)");
+};
+
 /**
  * Checks to see if a valid looking Executor function exists.
  */
@@ -228,6 +255,14 @@ class ScalarUDFTraits {
    */
   static constexpr bool HasExecutor() { return has_udf_executor_fn<T>::value; }
 
+  /**
+   * Checks if the UDF implements a vectorized arrow batch kernel. When present it is preferred
+   * over row-wise expansion of Exec; the scalar Exec must still exist since it defines the
+   * UDF's type signature and serves the non-arrow path.
+   * @return true if it has an ExecBatchArrow function.
+   */
+  static constexpr bool HasExecBatchArrow() { return has_udf_exec_batch_arrow_fn<T>::value; }
+
   template <typename Q = T, std::enable_if_t<ScalarUDFTraits<Q>::HasInit(), void>* = nullptr>
   static constexpr auto InitArguments() {
     return GetArgumentTypesHelper(&Q::Init);
@@ -321,6 +356,32 @@ static constexpr bool IsValidDeserializeFn(Status (TUDA::*)(FunctionContext*,
   return true;
 }
 
+/**
+ * Checks to see if a valid looking UpdateBatchArrow function exists.
+ */
+template <typename ReturnType, typename TUDA, typename... Types>
+static constexpr bool IsValidUpdateBatchArrowFn(ReturnType (TUDA::*)(Types...)) {
+  return false;
+}
+
+template <typename TUDA>
+static constexpr bool IsValidUpdateBatchArrowFn(
+    Status (TUDA::*)(FunctionContext*, const std::vector<const arrow::Array*>&)) {
+  return true;
+}
+
+// SFINAE test for an optional vectorized arrow batch update fn.
+template <typename T, typename = void>
+struct has_uda_update_batch_arrow_fn : std::false_type {};
+
+template <typename T>
+struct has_uda_update_batch_arrow_fn<T, std::void_t<decltype(&T::UpdateBatchArrow)>>
+    : std::true_type {
+  static_assert(IsValidUpdateBatchArrowFn(&T::UpdateBatchArrow),
+                "If an UpdateBatchArrow function exists, it must have the form: Status "
+                "UpdateBatchArrow(FunctionContext*, const std::vector<const arrow::Array*>&)");
+};
+
 // SFINAE test for serialize fn.
 template <typename T, typename = void>
 struct has_uda_serialize_fn : std::false_type {};
@@ -368,6 +429,14 @@ class UDATraits {
     return has_uda_serialize_fn<T>() && has_uda_deserialize_fn<T>();
   }
 
+  /**
+   * Checks if the UDA has a vectorized arrow batch update function, which the wrapper prefers
+   * over row-wise expansion of Update on the arrow path; the scalar Update must still exist
+   * since it defines the UDA's type signature and serves the non-arrow path.
+   * @return true if it has an UpdateBatchArrow function.
+   */
+  static constexpr bool HasUpdateBatchArrow() { return has_uda_update_batch_arrow_fn<T>::value; }
+
   template <typename Q = T, std::enable_if_t<UDATraits<Q>::HasInit(), void>* = nullptr>
   static constexpr auto InitArguments() {
     return GetArgumentTypesHelper(&Q::Init);
@@ -308,6 +308,10 @@ class UDTFDefinition : public UDFDefinition {
 
     exec_init_ = UDTFWrapper<T>::Init;
     exec_batch_update_ = UDTFWrapper<T>::ExecBatchUpdate;
+    supports_partitioning_ = UDTFWrapper<T>::SupportsPartitioning();
+    set_partition_ = UDTFWrapper<T>::SetPartition;
+    has_deferred_init_ = UDTFWrapper<T>::HasDeferredInit();
+    wait_for_init_ = UDTFWrapper<T>::WaitForInit;
 
     auto init_args = UDTFTraits<T>::InitArguments();
     init_arguments_ = {init_args.begin(), init_args.end()};
@@ -339,6 +343,32 @@ class UDTFDefinition : public UDFDefinition {
     return exec_batch_update_(udtf, ctx, max_gen_records, outputs);
   }
 
+  /**
+   * Whether the UDTF implements the optional partitioning interface, allowing several instances
+   * to each produce one partition of the output concurrently.
+   */
+  bool supports_partitioning() const { return supports_partitioning_; }
+
+  /**
+   * Assigns the given instance its partition of the output. Must be called after ExecInit, and
+   * only when supports_partitioning() is true.
+   */
+  Status SetPartition(AnyUDTF* udtf, int64_t partition_idx, int64_t num_partitions) {
+    return set_partition_(udtf, partition_idx, num_partitions);
+  }
+
+  /**
+   * Whether the UDTF implements the optional deferred init interface, meaning Init starts
+   * asynchronous work that must be waited on before records are generated.
+   */
+  bool has_deferred_init() const { return has_deferred_init_; }
+
+  /**
+   * Blocks until asynchronous work started by ExecInit completes. Must be called before the first
+   * ExecBatchUpdate, and only when has_deferred_init() is true.
+   */
+  Status WaitForInit(AnyUDTF* udtf) { return wait_for_init_(udtf); }
+
   const std::vector<UDTFArg>& init_arguments() const { return init_arguments_; }
   const std::vector<ColInfo>& output_relation() const { return output_relation_; }
   udfspb::UDTFSourceExecutor executor() const { return executor_; }
@@ -350,6 +380,11 @@ class UDTFDefinition : public UDFDefinition {
   std::function<bool(AnyUDTF* udtf, FunctionContext* ctx, int max_gen_records,
                      std::vector<arrow::ArrayBuilder*>* outputs)>
       exec_batch_update_;
+  bool supports_partitioning_ = false;
+  std::function<Status(AnyUDTF* udtf, int64_t partition_idx, int64_t num_partitions)>
+      set_partition_;
+  bool has_deferred_init_ = false;
+  std::function<Status(AnyUDTF* udtf)> wait_for_init_;
   std::vector<UDTFArg> init_arguments_;
   std::vector<ColInfo> output_relation_;
   udfspb::UDTFSourceExecutor executor_;
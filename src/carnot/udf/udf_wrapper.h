@@ -189,21 +189,27 @@ struct ScalarUDFWrapper {
   static Status ExecBatchArrow(ScalarUDF* udf, FunctionContext* ctx,
                                const std::vector<arrow::Array*>& inputs,
                                arrow::ArrayBuilder* output, int count) {
-    constexpr types::DataType return_type = ScalarUDFTraits<TUDF>::ReturnType();
-    auto exec_argument_types = ScalarUDFTraits<TUDF>::ExecArguments();
-
     // Check that output is allocated.
     DCHECK(output != nullptr);
     // Check that the arity is correct.
     DCHECK(inputs.size() == ScalarUDFTraits<TUDF>::ExecArguments().size());
 
-    // The outer wrapper just casts the output type and UDF type. We then pass in
-    // the inputs with a sequence based on the number of arguments to iterate through and
-    // cast the inputs.
-    return ExecWrapperArrow<TUDF>(
-        static_cast<TUDF*>(udf), ctx, count,
-        static_cast<typename types::DataTypeTraits<return_type>::arrow_builder_type*>(output),
-        inputs, std::make_index_sequence<exec_argument_types.size()>{});
+    // If the UDF implements its own vectorized kernel, prefer it over expanding the scalar
+    // Exec once per row.
+    if constexpr (ScalarUDFTraits<TUDF>::HasExecBatchArrow()) {
+      return static_cast<TUDF*>(udf)->ExecBatchArrow(ctx, inputs, output, count);
+    } else {
+      constexpr types::DataType return_type = ScalarUDFTraits<TUDF>::ReturnType();
+      auto exec_argument_types = ScalarUDFTraits<TUDF>::ExecArguments();
+
+      // The outer wrapper just casts the output type and UDF type. We then pass in
+      // the inputs with a sequence based on the number of arguments to iterate through and
+      // cast the inputs.
+      return ExecWrapperArrow<TUDF>(
+          static_cast<TUDF*>(udf), ctx, count,
+          static_cast<typename types::DataTypeTraits<return_type>::arrow_builder_type*>(output),
+          inputs, std::make_index_sequence<exec_argument_types.size()>{});
+    }
   }
 
   /**
@@ -356,9 +362,13 @@ struct UDAWrapper {
     constexpr auto update_argument_types = UDATraits<TUDA>::UpdateArgumentTypes();
     DCHECK(inputs.size() == update_argument_types.size());
 
-    size_t num_records = inputs[0]->length();
-    return UpdateWrapperArrow<TUDA>(static_cast<TUDA*>(uda), ctx, num_records, inputs,
-                                    std::make_index_sequence<update_argument_types.size()>{});
+    if constexpr (UDATraits<TUDA>::HasUpdateBatchArrow()) {
+      return static_cast<TUDA*>(uda)->UpdateBatchArrow(ctx, inputs);
+    } else {
+      size_t num_records = inputs[0]->length();
+      return UpdateWrapperArrow<TUDA>(static_cast<TUDA*>(uda), ctx, num_records, inputs,
+                                      std::make_index_sequence<update_argument_types.size()>{});
+    }
   }
 
   /**
@@ -467,6 +477,44 @@ struct UDTFWrapper {
     return Status::OK();
   }
 
+  /**
+   * Returns whether the UDTF implements the optional partitioning interface.
+   */
+  static constexpr bool SupportsPartitioning() { return UDTFTraits<TUDTF>::HasSetPartitionFn(); }
+
+  /**
+   * Assigns this instance its partition of the output. Must be called after Init, and only for
+   * UDTFs where SupportsPartitioning() is true.
+   */
+  static Status SetPartition(AnyUDTF* udtf, int64_t partition_idx, int64_t num_partitions) {
+    if constexpr (UDTFTraits<TUDTF>::HasSetPartitionFn()) {
+      return static_cast<TUDTF*>(udtf)->SetPartition(partition_idx, num_partitions);
+    } else {
+      PL_UNUSED(udtf);
+      PL_UNUSED(partition_idx);
+      PL_UNUSED(num_partitions);
+      return error::Internal("UDTF '%s' does not support partitioning", typeid(TUDTF).name());
+    }
+  }
+
+  /**
+   * Returns whether the UDTF implements the optional deferred init interface.
+   */
+  static constexpr bool HasDeferredInit() { return UDTFTraits<TUDTF>::HasWaitForInitFn(); }
+
+  /**
+   * Blocks until asynchronous work started in Init completes. Must be called before the first
+   * ExecBatchUpdate, and only for UDTFs where HasDeferredInit() is true.
+   */
+  static Status WaitForInit(AnyUDTF* udtf) {
+    if constexpr (UDTFTraits<TUDTF>::HasWaitForInitFn()) {
+      return static_cast<TUDTF*>(udtf)->WaitForInit();
+    } else {
+      PL_UNUSED(udtf);
+      return error::Internal("UDTF '%s' does not support deferred init", typeid(TUDTF).name());
+    }
+  }
+
   static bool ExecBatchUpdate(AnyUDTF* udtf, FunctionContext* ctx, int max_gen_records,
                               std::vector<arrow::ArrayBuilder*>* outputs) {
     if (max_gen_records == 0) {
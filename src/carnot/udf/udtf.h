@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "src/carnot/udf/base.h"
@@ -254,6 +255,21 @@ class UDTFTraits {
    */
   static constexpr bool HasNextRecordFn() { return NextRecordFnHelper<TUDTF>::value; }
 
+  /**
+   * Checks to see if the optional SetPartition(partition_idx, num_partitions) function exists.
+   * UDTFs that implement it can be run as several concurrent instances: each instance gets a
+   * distinct partition index after Init() and must emit only that partition's records.
+   */
+  static constexpr bool HasSetPartitionFn() { return SetPartitionFnHelper<TUDTF>::value; }
+
+  /**
+   * Checks to see if the optional WaitForInit() function exists.
+   * UDTFs that start asynchronous work in Init() (e.g. RPCs to other services) implement it to
+   * block until that work completes. It is invoked right before the first batch of records is
+   * generated, so the async work overlaps the rest of query setup while errors still propagate.
+   */
+  static constexpr bool HasWaitForInitFn() { return WaitForInitFnHelper<TUDTF>::value; }
+
   template <typename Q = TUDTF, std::enable_if_t<UDTFTraits<Q>::HasInitArgsFn(), void>* = nullptr>
   static constexpr auto InitArguments() {
     return Q::InitArgs();
@@ -373,6 +389,27 @@ class UDTFTraits {
   struct NextRecordFnHelper<
       T, std::void_t<decltype (&T::NextRecord)(FunctionContext*, typename T::RecordWriter*)>>
       : std::true_type {};
+
+  /*************************************
+   * Templates to check optional SetPartition() func.
+   *************************************/
+  template <typename T, typename = void>
+  struct SetPartitionFnHelper : std::false_type {};
+
+  template <typename T>
+  struct SetPartitionFnHelper<
+      T, std::void_t<decltype(std::declval<T>().SetPartition(int64_t{}, int64_t{}))>>
+      : std::true_type {};
+
+  /*************************************
+   * Templates to check optional WaitForInit() func.
+   *************************************/
+  template <typename T, typename = void>
+  struct WaitForInitFnHelper : std::false_type {};
+
+  template <typename T>
+  struct WaitForInitFnHelper<T, std::void_t<decltype(std::declval<T>().WaitForInit())>>
+      : std::true_type {};
 };
 
 /**
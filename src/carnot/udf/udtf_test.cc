@@ -161,6 +161,12 @@ TEST(BasicUDTFOneCol, can_run) {
   EXPECT_TRUE(TR::HasExecutorFn());
   EXPECT_TRUE(TR::HasCorrectExectorFnReturnType());
   EXPECT_TRUE(TR::HasNextRecordFn());
+  // SetPartition is optional; this UDTF does not implement it.
+  EXPECT_FALSE(TR::HasSetPartitionFn());
+  EXPECT_FALSE(UDTFWrapper<BasicUDTFOneCol>::SupportsPartitioning());
+  // WaitForInit is optional; this UDTF does not implement it.
+  EXPECT_FALSE(TR::HasWaitForInitFn());
+  EXPECT_FALSE(UDTFWrapper<BasicUDTFOneCol>::HasDeferredInit());
 
   UDTFWrapper<BasicUDTFOneCol> wrapper;
   PL_UNUSED(wrapper);
@@ -261,6 +267,51 @@ TEST(ValidOneColUDTFEmptyInit, empty_init_is_valid) {
   EXPECT_EQ(init_args.size(), 0);
 }
 
+class DeferredInitUDTF : public UDTF<DeferredInitUDTF> {
+ public:
+  static constexpr auto Executor() { return udfspb::UDTFSourceExecutor::UDTF_ALL_AGENTS; }
+
+  static constexpr auto OutputRelation() {
+    return MakeArray(
+        ColInfo("out_str", types::DataType::STRING, types::PatternType::GENERAL, "string result"));
+  }
+
+  Status Init(FunctionContext*) {
+    init_called_ = true;
+    return Status::OK();
+  }
+
+  Status WaitForInit() {
+    waited_ = true;
+    return error::Internal("deferred init failed");
+  }
+
+  bool NextRecord(FunctionContext*, RecordWriter*) { return false; }
+
+  bool init_called_ = false;
+  bool waited_ = false;
+};
+
+TEST(DeferredInitUDTF, wait_for_init_is_detected_and_propagates_errors) {
+  using TR = UDTFTraits<DeferredInitUDTF>;
+  constexpr DeferredInitUDTF::Checker check;
+  PL_UNUSED(check);
+
+  EXPECT_TRUE(TR::HasWaitForInitFn());
+  EXPECT_TRUE(UDTFWrapper<DeferredInitUDTF>::HasDeferredInit());
+
+  UDTFWrapper<DeferredInitUDTF> wrapper;
+  auto u = wrapper.Make();
+  ASSERT_NE(u, nullptr);
+  EXPECT_OK(wrapper.Init(u.get(), nullptr, {}));
+  EXPECT_TRUE(static_cast<DeferredInitUDTF*>(u.get())->init_called_);
+
+  auto s = wrapper.WaitForInit(u.get());
+  EXPECT_TRUE(static_cast<DeferredInitUDTF*>(u.get())->waited_);
+  EXPECT_NOT_OK(s);
+  EXPECT_EQ(s.msg(), "deferred init failed");
+}
+
 }  // namespace udf
 }  // namespace carnot
 }  // namespace px
@@ -284,5 +284,67 @@ TEST(UtilsTest, MemCpy) {
   }
 }
 
+TEST(UtilsTest, TestDecimalStrToInt) {
+  int64_t val = 0;
+
+  // Short strings exercise the per-digit tail; long strings exercise the 8-digit SWAR path.
+  EXPECT_TRUE(DecimalStrToInt("0", &val));
+  EXPECT_EQ(0, val);
+  EXPECT_TRUE(DecimalStrToInt("42", &val));
+  EXPECT_EQ(42, val);
+  EXPECT_TRUE(DecimalStrToInt("12345678", &val));
+  EXPECT_EQ(12345678, val);
+  EXPECT_TRUE(DecimalStrToInt("1234567890123456789", &val));
+  EXPECT_EQ(1234567890123456789, val);
+
+  EXPECT_TRUE(DecimalStrToInt("-1", &val));
+  EXPECT_EQ(-1, val);
+  EXPECT_TRUE(DecimalStrToInt("-987654321", &val));
+  EXPECT_EQ(-987654321, val);
+
+  // Limits of the destination type.
+  EXPECT_TRUE(DecimalStrToInt("9223372036854775807", &val));
+  EXPECT_EQ(std::numeric_limits<int64_t>::max(), val);
+  EXPECT_TRUE(DecimalStrToInt("-9223372036854775808", &val));
+  EXPECT_EQ(std::numeric_limits<int64_t>::min(), val);
+  EXPECT_FALSE(DecimalStrToInt("9223372036854775808", &val));
+  EXPECT_FALSE(DecimalStrToInt("-9223372036854775809", &val));
+
+  int32_t val32 = 0;
+  EXPECT_TRUE(DecimalStrToInt("2147483647", &val32));
+  EXPECT_EQ(std::numeric_limits<int32_t>::max(), val32);
+  EXPECT_FALSE(DecimalStrToInt("2147483648", &val32));
+
+  // Malformed inputs.
+  EXPECT_FALSE(DecimalStrToInt("", &val));
+  EXPECT_FALSE(DecimalStrToInt("-", &val));
+  EXPECT_FALSE(DecimalStrToInt("12a4", &val));
+  EXPECT_FALSE(DecimalStrToInt("1234567x", &val));
+  EXPECT_FALSE(DecimalStrToInt(" 123", &val));
+  EXPECT_FALSE(DecimalStrToInt("123 ", &val));
+  EXPECT_FALSE(DecimalStrToInt("+123", &val));
+  EXPECT_FALSE(DecimalStrToInt("123456789012345678901", &val));
+
+  // Unsigned destinations reject the sign.
+  uint64_t uval = 0;
+  EXPECT_TRUE(DecimalStrToInt("18446744073709551615", &uval));
+  EXPECT_EQ(std::numeric_limits<uint64_t>::max(), uval);
+  EXPECT_FALSE(DecimalStrToInt("18446744073709551616", &uval));
+  EXPECT_FALSE(DecimalStrToInt("-1", &uval));
+}
+
+TEST(UtilsTest, TestDecimalStrToIntMatchesSimpleAtoi) {
+  std::default_random_engine rng(37);
+  std::uniform_int_distribution<int64_t> dist(std::numeric_limits<int64_t>::min(),
+                                              std::numeric_limits<int64_t>::max());
+  for (int i = 0; i < 1000; ++i) {
+    const int64_t x = dist(rng);
+    const std::string s = std::to_string(x);
+    int64_t val = 0;
+    ASSERT_TRUE(DecimalStrToInt(s, &val)) << s;
+    EXPECT_EQ(x, val);
+  }
+}
+
 }  // namespace utils
 }  // namespace px
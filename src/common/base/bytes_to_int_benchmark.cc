@@ -18,6 +18,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <absl/strings/numbers.h>
+
 #include "src/common/base/base.h"
 
 // This benchmark measures the performance of various ways of converting byte strings into
@@ -220,3 +222,31 @@ BENCHMARK_TEMPLATE(BM_ByteLoop, uint32_t);
 BENCHMARK_TEMPLATE(BM_ByteLoop, uint32_t, 3);
 BENCHMARK_TEMPLATE(BM_ByteLoop, uint16_t);
 BENCHMARK_TEMPLATE(BM_ByteLoop, uint8_t);
+
+// ASCII decimal conversion, comparing the SWAR parser against absl::SimpleAtoi on the string
+// lengths protocol parsers see (Redis bulk lengths, HTTP Content-Length).
+constexpr std::string_view kDecimalStrs[] = {"7", "512", "65536", "1073741824",
+                                             "123456789012345678"};
+
+// NOLINTNEXTLINE : runtime/references.
+static void BM_DecimalStrToInt(benchmark::State& state) {
+  const std::string_view s = kDecimalStrs[state.range(0)];
+  for (auto _ : state) {
+    int64_t result = 0;
+    benchmark::DoNotOptimize(px::utils::DecimalStrToInt(s, &result));
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+// NOLINTNEXTLINE : runtime/references.
+static void BM_SimpleAtoi(benchmark::State& state) {
+  const std::string_view s = kDecimalStrs[state.range(0)];
+  for (auto _ : state) {
+    int64_t result = 0;
+    benchmark::DoNotOptimize(absl::SimpleAtoi(s, &result));
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK(BM_DecimalStrToInt)->DenseRange(0, 4);
+BENCHMARK(BM_SimpleAtoi)->DenseRange(0, 4);
@@ -42,5 +42,28 @@ uint64_t DefaultMonoToRealtimeConverter::Convert(uint64_t monotonic_time) const
   return mono_to_realtime_.Get(monotonic_time);
 }
 
+void LinearMonoToRealtimeConverter::Update() {
+  struct timespec time, real_time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  clock_gettime(CLOCK_REALTIME, &real_time);
+
+  uint64_t mono_time_val = DefaultMonoToRealtimeConverter::kSecToNanosecFactor * time.tv_sec +
+                           time.tv_nsec;
+  uint64_t real_time_val = DefaultMonoToRealtimeConverter::kSecToNanosecFactor * real_time.tv_sec +
+                           real_time.tv_nsec;
+  int64_t new_offset = static_cast<int64_t>(real_time_val) - static_cast<int64_t>(mono_time_val);
+
+  int64_t drift = new_offset - offset_.exchange(new_offset, std::memory_order_relaxed);
+  last_drift_ns_.store(drift, std::memory_order_relaxed);
+  total_drift_ns_.fetch_add(drift < 0 ? -drift : drift, std::memory_order_relaxed);
+}
+
+LinearMonoToRealtimeConverter::LinearMonoToRealtimeConverter() {
+  Update();
+  // The offset assigned by the first Update() is a calibration, not drift.
+  last_drift_ns_.store(0, std::memory_order_relaxed);
+  total_drift_ns_.store(0, std::memory_order_relaxed);
+}
+
 }  // namespace clock
 }  // namespace px
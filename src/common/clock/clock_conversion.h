@@ -40,6 +40,16 @@ class ClockConverter {
   virtual uint64_t Convert(uint64_t monotonic_time) const = 0;
   virtual void Update() = 0;
   virtual std::chrono::milliseconds UpdatePeriod() const = 0;
+  /**
+   * Converts a batch of monotonic timestamps in place. Callers that drain many events at once
+   * (e.g. a perf buffer chunk) should prefer this over per-event Convert calls; implementations
+   * can amortize any per-conversion overhead across the batch.
+   */
+  virtual void ConvertBatch(uint64_t* monotonic_times, size_t count) const {
+    for (size_t i = 0; i < count; ++i) {
+      monotonic_times[i] = Convert(monotonic_times[i]);
+    }
+  }
   // The max history is chosen as an even multiple of the default polling period, and longer than 5
   // minutes. This was chosen based on a conservative estimate that Stirling will process all
   // incoming data within 5 minutes of it being given a timestamp by BPF. With the current polling
@@ -76,5 +86,48 @@ class DefaultMonoToRealtimeConverter : public ClockConverter {
   InterpolatingLookupTable<ClockConverter::BufferCapacity(kUpdatePeriod)> mono_to_realtime_;
 };
 
+/**
+ * LinearMonoToRealtimeConverter caches the mono-to-realtime offset from the most recent Update()
+ * and converts with a single atomic load and an add — no lock and no interpolation search on the
+ * hot path. This trades the history window of DefaultMonoToRealtimeConverter for per-event cost:
+ * it is the right choice when timestamps are converted promptly after being recorded, as in the
+ * socket tracer's perf buffer drain, where conversion runs millions of times per second.
+ *
+ * Offset jumps between resyncs (NTP adjustments) are tracked and exposed through drift accessors
+ * so callers can export them as metrics.
+ */
+class LinearMonoToRealtimeConverter : public ClockConverter {
+ public:
+  // Resync at the same cadence as the default converter; the offset only changes when NTP
+  // adjusts the realtime clock.
+  static constexpr std::chrono::seconds kUpdatePeriod =
+      DefaultMonoToRealtimeConverter::kUpdatePeriod;
+
+  LinearMonoToRealtimeConverter();
+
+  uint64_t Convert(uint64_t monotonic_time) const override {
+    return monotonic_time + offset_.load(std::memory_order_relaxed);
+  }
+  void ConvertBatch(uint64_t* monotonic_times, size_t count) const override {
+    // Load the offset once so the loop is a pure vectorizable add.
+    const int64_t offset = offset_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+      monotonic_times[i] += offset;
+    }
+  }
+  void Update() override;
+  std::chrono::milliseconds UpdatePeriod() const override { return kUpdatePeriod; }
+
+  // The offset change observed at the last resync, in nanoseconds.
+  int64_t last_drift_ns() const { return last_drift_ns_.load(std::memory_order_relaxed); }
+  // Sum of absolute offset changes across all resyncs, in nanoseconds.
+  uint64_t total_drift_ns() const { return total_drift_ns_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<int64_t> offset_ = 0;
+  std::atomic<int64_t> last_drift_ns_ = 0;
+  std::atomic<uint64_t> total_drift_ns_ = 0;
+};
+
 }  // namespace clock
 }  // namespace px
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/clock/clock_conversion.h"
+
+#include <vector>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace clock {
+
+TEST(LinearMonoToRealtimeConverter, convert_applies_current_offset) {
+  LinearMonoToRealtimeConverter converter;
+
+  struct timespec mono_time;
+  clock_gettime(CLOCK_MONOTONIC, &mono_time);
+  uint64_t mono_ns = DefaultMonoToRealtimeConverter::kSecToNanosecFactor * mono_time.tv_sec +
+                     mono_time.tv_nsec;
+
+  struct timespec real_time;
+  clock_gettime(CLOCK_REALTIME, &real_time);
+  uint64_t real_ns = DefaultMonoToRealtimeConverter::kSecToNanosecFactor * real_time.tv_sec +
+                     real_time.tv_nsec;
+
+  // The converted value should land near the realtime clock (within a generous 1s of slack for
+  // scheduling delays between the clock_gettime calls).
+  uint64_t converted = converter.Convert(mono_ns);
+  EXPECT_NEAR(static_cast<double>(converted), static_cast<double>(real_ns), 1e9);
+}
+
+TEST(LinearMonoToRealtimeConverter, batch_matches_per_event_conversion) {
+  LinearMonoToRealtimeConverter converter;
+
+  std::vector<uint64_t> times = {0, 1000, 123456789, 987654321000};
+  std::vector<uint64_t> expected;
+  expected.reserve(times.size());
+  for (uint64_t t : times) {
+    expected.push_back(converter.Convert(t));
+  }
+
+  converter.ConvertBatch(times.data(), times.size());
+  EXPECT_EQ(expected, times);
+}
+
+TEST(LinearMonoToRealtimeConverter, initial_calibration_is_not_drift) {
+  LinearMonoToRealtimeConverter converter;
+  EXPECT_EQ(0, converter.last_drift_ns());
+  EXPECT_EQ(0U, converter.total_drift_ns());
+
+  // Both clocks tick forward together between resyncs, so drift stays near zero.
+  converter.Update();
+  EXPECT_LT(converter.total_drift_ns(), uint64_t{1000 * 1000 * 1000});
+}
+
+TEST(ClockConverter, default_batch_conversion_matches_convert) {
+  DefaultMonoToRealtimeConverter converter;
+
+  std::vector<uint64_t> times = {1, 1000000, 5000000000};
+  std::vector<uint64_t> expected;
+  expected.reserve(times.size());
+  for (uint64_t t : times) {
+    expected.push_back(converter.Convert(t));
+  }
+
+  converter.ConvertBatch(times.data(), times.size());
+  EXPECT_EQ(expected, times);
+}
+
+}  // namespace clock
+}  // namespace px
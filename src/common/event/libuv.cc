@@ -184,7 +184,7 @@ void LibuvDispatcher::Post(PostCB cb) {
   {
     absl::MutexLock lock(&post_lock_);
     activate = post_callbacks_.empty();
-    post_callbacks_.emplace_back(cb);
+    post_callbacks_.emplace_back(std::move(cb));
   }
 
   if (activate) {
@@ -243,16 +243,21 @@ TimerUPtr LibuvDispatcher::CreateTimer(TimerCB cb) {
 
 void LibuvDispatcher::RunPostCallbacks() {
   while (true) {
-    PostCB cb;
+    std::list<PostCB> callbacks;
     {
       absl::MutexLock lock(&post_lock_);
       if (post_callbacks_.empty()) {
         return;
       }
-      cb = post_callbacks_.front();
-      post_callbacks_.pop_front();
+      // Drain the whole batch under one lock acquisition, so that posting threads contend
+      // with the loop thread once per wakeup rather than once per callback. Callbacks posted
+      // while this batch runs land in the (now empty) queue and are picked up by the outer
+      // loop.
+      callbacks.swap(post_callbacks_);
+    }
+    for (PostCB& cb : callbacks) {
+      cb();
     }
-    cb();
   }
 }
 
@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 #include <thread>
+#include <vector>
 #include "src/common/base/base.h"
 #include "src/common/event/api.h"
 #include "src/common/event/event.h"
@@ -129,6 +130,24 @@ TEST_F(LibuvDispatcherTest, test_timed_events) {
   EXPECT_EQ(3, timer2_call_count);
 }
 
+TEST_F(LibuvDispatcherTest, post_callbacks) {
+  // Posted callbacks run in order, including callbacks posted from within a callback
+  // (which land in a later batch of the drain loop).
+  std::vector<int> order;
+
+  dispatcher_->Post([&] { order.push_back(1); });
+  dispatcher_->Post([&] {
+    order.push_back(2);
+    dispatcher_->Post([&] { order.push_back(4); });
+  });
+  dispatcher_->Post([&] { order.push_back(3); });
+
+  dispatcher_->Run(Dispatcher::RunType::NonBlock);
+  dispatcher_->Exit();
+
+  EXPECT_EQ(order, (std::vector<int>{1, 2, 3, 4}));
+}
+
 TEST_F(LibuvDispatcherTest, threadpool) {
   auto task = std::make_unique<ComputePi>();
   // Store the pointer so that we can access the results later.
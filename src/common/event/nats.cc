@@ -32,6 +32,7 @@ Status NATSConnectorBase::ConnectBase(Dispatcher* base_dispatcher) {
   if (dispatcher == nullptr) {
     return error::InvalidArgument("Only libuv based dispatcher is allowed");
   }
+  dispatcher_ = base_dispatcher;
 
   natsLibuv_Init();
 
@@ -18,11 +18,14 @@
 
 #pragma once
 
+#include <google/protobuf/arena.h>
 #include <nats/nats.h>
 #include "src/common/event/libuv.h"
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace px {
 namespace event {
@@ -41,6 +44,7 @@ class NATSConnectorBase {
   Status ConnectBase(Dispatcher* base_dispatcher);
 
   natsConnection* nats_connection_ = nullptr;
+  Dispatcher* dispatcher_ = nullptr;
 
   std::string nats_server_;
   std::unique_ptr<NATSTLSConfig> tls_config_;
@@ -61,6 +65,8 @@ class NATSConnector : public NATSConnectorBase {
  public:
   using MsgType = std::unique_ptr<TMsg>;
   using MessageHandlerCB = std::function<void(MsgType)>;
+  // Batch handler: the messages are arena-allocated and only valid for the duration of the call.
+  using BatchMessageHandlerCB = std::function<void(const std::vector<TMsg*>&)>;
   NATSConnector(std::string_view nats_server, std::string_view pub_topic,
                 std::string_view sub_topic, std::unique_ptr<NATSTLSConfig> tls_config)
       : NATSConnectorBase(nats_server, std::move(tls_config)),
@@ -75,6 +81,9 @@ class NATSConnector : public NATSConnectorBase {
     if (nats_subscription_ != nullptr) {
       natsSubscription_Destroy(nats_subscription_);
     }
+    for (auto* msg : pending_msgs_) {
+      natsMsg_Destroy(msg);
+    }
     nats_Close();
   }
 
@@ -96,6 +105,17 @@ class NATSConnector : public NATSConnectorBase {
    * @param msg The natsMessage.
    */
   void NATSMessageHandler(natsConnection* /*nc*/, natsSubscription* /*sub*/, natsMsg* msg) {
+    if (batch_msg_handler_) {
+      // Defer parsing; all the messages that arrive in one event loop wakeup are drained in a
+      // single flush so that update storms pay one handler invocation instead of one per message.
+      pending_msgs_.push_back(msg);
+      if (!flush_scheduled_ && dispatcher_ != nullptr) {
+        flush_scheduled_ = true;
+        dispatcher_->Post([this] { FlushPendingMessages(); });
+      }
+      return;
+    }
+
     int len = natsMsg_GetDataLength(msg);
     const char* data = natsMsg_GetData(msg);
     auto parsed_msg = std::make_unique<TMsg>();
@@ -144,6 +164,21 @@ class NATSConnector : public NATSConnectorBase {
    */
   void RemoveMessageHandler() { msg_handler_ = nullptr; }
 
+  /**
+   * Register a batch message handler. When set, it takes precedence over the per-message handler:
+   * all messages pending at the time of a dispatcher wakeup are parsed into a per-connection
+   * protobuf arena and delivered in one call. The message pointers are owned by the arena and are
+   * only valid for the duration of the callback.
+   */
+  void RegisterBatchMessageHandler(BatchMessageHandlerCB handler) {
+    batch_msg_handler_ = std::move(handler);
+  }
+
+  /**
+   * Remove the batch message handler if attached.
+   */
+  void RemoveBatchMessageHandler() { batch_msg_handler_ = nullptr; }
+
  protected:
   static void NATSMessageCallbackHandler(natsConnection* nc, natsSubscription* sub, natsMsg* msg,
                                          void* closure) {
@@ -152,6 +187,32 @@ class NATSConnector : public NATSConnectorBase {
     connector->NATSMessageHandler(nc, sub, msg);
   }
 
+  void FlushPendingMessages() {
+    flush_scheduled_ = false;
+    std::vector<natsMsg*> msgs;
+    msgs.swap(pending_msgs_);
+
+    std::vector<TMsg*> parsed_msgs;
+    parsed_msgs.reserve(msgs.size());
+    for (auto* msg : msgs) {
+      auto* parsed_msg = google::protobuf::Arena::CreateMessage<TMsg>(&arena_);
+      if (!parsed_msg->ParseFromArray(natsMsg_GetData(msg), natsMsg_GetDataLength(msg))) {
+        LOG(ERROR) << "Failed to parse message";
+        continue;
+      }
+      parsed_msgs.push_back(parsed_msg);
+    }
+    for (auto* msg : msgs) {
+      natsMsg_Destroy(msg);
+    }
+
+    if (batch_msg_handler_ && !parsed_msgs.empty()) {
+      batch_msg_handler_(parsed_msgs);
+    }
+    // The arena is reused across batches; Reset reclaims the block allocations in bulk.
+    arena_.Reset();
+  }
+
   natsSubscription* nats_subscription_ = nullptr;
 
   std::string pub_topic_;
@@ -159,6 +220,11 @@ class NATSConnector : public NATSConnectorBase {
 
   // The registered message handler.
   MessageHandlerCB msg_handler_;
+  // The registered batch message handler, and the batching state it relies on.
+  BatchMessageHandlerCB batch_msg_handler_;
+  google::protobuf::Arena arena_;
+  std::vector<natsMsg*> pending_msgs_;
+  bool flush_scheduled_ = false;
 };
 
 }  // namespace event
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace fs {
+
+/**
+ * Enumerates the numeric (PID) entries of a /proc-style directory with raw getdents64 batches.
+ *
+ * std::filesystem::directory_iterator pays per-entry costs (readdir calls plus a path object per
+ * entry); getdents64 returns entries in bulk, so a full enumeration of a few thousand PIDs takes
+ * a handful of syscalls and no per-entry allocations. The read buffer is owned by the enumerator
+ * and reused across calls, so periodic pollers (process trackers, connectors that list /proc)
+ * can keep one instance around.
+ */
+class ProcPidEnumerator {
+ public:
+  explicit ProcPidEnumerator(std::filesystem::path proc_path = "/proc");
+
+  /**
+   * Returns the PIDs currently present, in directory order. Entries whose names are not pure
+   * digit strings (self, thread-self, non-process files) are skipped.
+   */
+  StatusOr<std::vector<uint32_t>> Pids();
+
+ private:
+  std::filesystem::path proc_path_;
+  // Reused across Pids() calls.
+  std::vector<char> buffer_;
+};
+
+}  // namespace fs
+}  // namespace px
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/fs/proc_enumerator.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace fs {
+
+using ::testing::UnorderedElementsAre;
+
+class ProcPidEnumeratorTest : public ::testing::Test {
+ protected:
+  px::testing::TempDir tmp_dir_;
+};
+
+TEST_F(ProcPidEnumeratorTest, returns_only_numeric_directories) {
+  // A fake /proc: PID directories plus the kind of non-PID entries the real one has.
+  for (const auto* name : {"1", "42", "31415", "self", "cpuinfo", "12abc"}) {
+    std::filesystem::create_directory(tmp_dir_.path() / name);
+  }
+
+  ProcPidEnumerator enumerator(tmp_dir_.path());
+  ASSERT_OK_AND_ASSIGN(auto pids, enumerator.Pids());
+  EXPECT_THAT(pids, UnorderedElementsAre(1, 42, 31415));
+
+  // The enumerator is reusable, and picks up changes between calls.
+  std::filesystem::create_directory(tmp_dir_.path() / "99");
+  ASSERT_OK_AND_ASSIGN(pids, enumerator.Pids());
+  EXPECT_THAT(pids, UnorderedElementsAre(1, 42, 31415, 99));
+}
+
+TEST_F(ProcPidEnumeratorTest, errors_on_missing_directory) {
+  ProcPidEnumerator enumerator(tmp_dir_.path() / "does_not_exist");
+  EXPECT_NOT_OK(enumerator.Pids());
+}
+
+TEST_F(ProcPidEnumeratorTest, works_on_real_proc) {
+  ProcPidEnumerator enumerator;
+  ASSERT_OK_AND_ASSIGN(auto pids, enumerator.Pids());
+  // At minimum, this test's own process is present.
+  EXPECT_NE(pids.end(), std::find(pids.begin(), pids.end(), static_cast<uint32_t>(getpid())));
+}
+
+}  // namespace fs
+}  // namespace px
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/grpcutils/channel_pool.h"
+
+#include <utility>
+
+#include <absl/strings/str_cat.h>
+
+namespace px {
+namespace grpcutils {
+
+ChannelPool& ChannelPool::GetInstance() {
+  static ChannelPool pool(std::chrono::minutes{5});
+  return pool;
+}
+
+std::string ChannelPool::PoolKey(std::string_view target, std::string_view config_key) {
+  // Targets and config keys are free of control characters, so 0x1f unambiguously separates them.
+  return absl::StrCat(target, "\x1f", config_key);
+}
+
+std::shared_ptr<::grpc::Channel> ChannelPool::GetOrCreateChannel(
+    const std::string& target, const std::shared_ptr<::grpc::ChannelCredentials>& creds,
+    const ::grpc::ChannelArguments& args, std::string_view config_key) {
+  auto key = PoolKey(target, config_key);
+  absl::base_internal::SpinLockHolder lock(&channels_lock_);
+  auto it = channels_.find(key);
+  if (it != channels_.end()) {
+    auto state = it->second.chan->GetState(/*try_to_connect*/ false);
+    if (state != grpc_connectivity_state::GRPC_CHANNEL_SHUTDOWN &&
+        state != grpc_connectivity_state::GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      return it->second.chan;
+    }
+    // The cached channel is unhealthy; fall through and replace it.
+  }
+  auto chan = ::grpc::CreateCustomChannel(target, creds, args);
+  channels_[std::move(key)] = {chan, std::chrono::system_clock::now()};
+  return chan;
+}
+
+void ChannelPool::WarmUp(const std::vector<std::string>& targets,
+                         const std::shared_ptr<::grpc::ChannelCredentials>& creds,
+                         const ::grpc::ChannelArguments& args, std::string_view config_key) {
+  for (const auto& target : targets) {
+    auto chan = GetOrCreateChannel(target, creds, args, config_key);
+    // Kick off connection establishment without blocking on the result.
+    chan->GetState(/*try_to_connect*/ true);
+  }
+}
+
+Status ChannelPool::CleanupChannels() {
+  absl::base_internal::SpinLockHolder lock(&channels_lock_);
+  std::vector<std::string> keys_to_delete;
+  auto time_now = std::chrono::system_clock::now();
+  for (const auto& [key, chan] : channels_) {
+    auto state = chan.chan->GetState(/*try_to_connect*/ false);
+    if (state == grpc_connectivity_state::GRPC_CHANNEL_SHUTDOWN ||
+        state == grpc_connectivity_state::GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      keys_to_delete.push_back(key);
+      continue;
+    }
+    std::chrono::nanoseconds age = time_now - chan.start_time;
+    // If the age of the channel is still warming up, we don't kill it for being idle.
+    if (age < warm_up_period_) {
+      continue;
+    }
+
+    if (state == grpc_connectivity_state::GRPC_CHANNEL_IDLE) {
+      keys_to_delete.push_back(key);
+    }
+  }
+
+  for (const std::string& key : keys_to_delete) {
+    channels_.erase(key);
+  }
+  return Status::OK();
+}
+
+}  // namespace grpcutils
+}  // namespace px
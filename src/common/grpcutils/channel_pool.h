@@ -0,0 +1,111 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <grpcpp/grpcpp.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <absl/base/internal/spinlock.h>
+#include <absl/container/flat_hash_map.h>
+#include "src/common/base/base.h"
+
+namespace px {
+namespace grpcutils {
+
+/**
+ * ChannelPool is a process-wide cache of GRPC channels.
+ *
+ * Each distinct (target, config_key) pair maps to a single channel that is shared by all callers,
+ * so subsystems that talk to the same endpoint multiplex over one HTTP2 connection instead of
+ * paying a TCP+TLS handshake each. Since ChannelCredentials and ChannelArguments cannot be
+ * fingerprinted through their public APIs, callers that use different credentials or channel
+ * arguments for the same target must pass distinct config_keys.
+ *
+ * Channels found in a failure state on lookup are dropped and recreated, and CleanupChannels()
+ * reaps dead or idle channels (mirroring the agent's ChanCache policy), so callers always get a
+ * usable channel back.
+ */
+class ChannelPool : public NotCopyable {
+ public:
+  /**
+   * @param warm_up_period the period to wait in a channel's lifetime before an idle channel is
+   * considered out of use by CleanupChannels(). Prevents reaping a freshly created channel before
+   * its first RPC.
+   */
+  explicit ChannelPool(std::chrono::nanoseconds warm_up_period) : warm_up_period_(warm_up_period) {}
+  // Template to handle other duration types.
+  template <typename T>
+  explicit ChannelPool(std::chrono::duration<int64_t, T> warm_up_period)
+      : ChannelPool(std::chrono::duration_cast<std::chrono::nanoseconds>(warm_up_period)) {}
+
+  /**
+   * @brief The process-wide instance. Use this instead of constructing a ChannelPool wherever the
+   * channels may be shared across subsystems.
+   */
+  static ChannelPool& GetInstance();
+
+  /**
+   * @brief Returns the pooled channel for (target, config_key), creating it with the given
+   * credentials and arguments if absent or if the cached channel has failed.
+   *
+   * @param target the remote address.
+   * @param creds the channel credentials; only used when a new channel must be created.
+   * @param args the channel arguments; only used when a new channel must be created.
+   * @param config_key distinguishes credential/argument configurations for the same target.
+   */
+  std::shared_ptr<::grpc::Channel> GetOrCreateChannel(
+      const std::string& target, const std::shared_ptr<::grpc::ChannelCredentials>& creds,
+      const ::grpc::ChannelArguments& args, std::string_view config_key);
+
+  /**
+   * @brief Pre-warms channels to the given targets: creates any that are missing and kicks off
+   * connection establishment so the first RPC skips handshake latency.
+   */
+  void WarmUp(const std::vector<std::string>& targets,
+              const std::shared_ptr<::grpc::ChannelCredentials>& creds,
+              const ::grpc::ChannelArguments& args, std::string_view config_key);
+
+  /**
+   * @brief Reaps channels that are shutdown, in transient failure, or idle past the warm up
+   * period. Callers should invoke this periodically (e.g. from a dispatcher timer).
+   *
+   * @return Status: whether an error occurred while cleaning up idle/dead channels.
+   */
+  Status CleanupChannels();
+
+ private:
+  struct Channel {
+    std::shared_ptr<::grpc::Channel> chan;
+    std::chrono::system_clock::time_point start_time;
+  };
+
+  static std::string PoolKey(std::string_view target, std::string_view config_key);
+
+  absl::flat_hash_map<std::string, Channel> channels_ GUARDED_BY(channels_lock_);
+  absl::base_internal::SpinLock channels_lock_;
+  // Connections that are alive for shorter than warm_up_period_ won't be cleared.
+  std::chrono::nanoseconds warm_up_period_;
+};
+
+}  // namespace grpcutils
+}  // namespace px
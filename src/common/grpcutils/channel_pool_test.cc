@@ -0,0 +1,71 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/grpcutils/channel_pool.h"
+
+#include <chrono>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace grpcutils {
+
+constexpr char kTestTarget[] = "localhost:59999";
+
+TEST(ChannelPoolTest, reuses_channel_for_same_key) {
+  ChannelPool pool(std::chrono::minutes{5});
+  ::grpc::ChannelArguments args;
+  auto creds = ::grpc::InsecureChannelCredentials();
+  auto chan1 = pool.GetOrCreateChannel(kTestTarget, creds, args, "insecure");
+  auto chan2 = pool.GetOrCreateChannel(kTestTarget, creds, args, "insecure");
+  EXPECT_EQ(chan1.get(), chan2.get());
+}
+
+TEST(ChannelPoolTest, distinct_config_keys_get_distinct_channels) {
+  ChannelPool pool(std::chrono::minutes{5});
+  ::grpc::ChannelArguments args;
+  auto creds = ::grpc::InsecureChannelCredentials();
+  auto chan1 = pool.GetOrCreateChannel(kTestTarget, creds, args, "insecure");
+  auto chan2 = pool.GetOrCreateChannel(kTestTarget, creds, args, "ssl");
+  EXPECT_NE(chan1.get(), chan2.get());
+}
+
+TEST(ChannelPoolTest, cleanup_reaps_idle_channels_past_warm_up) {
+  // Zero warm up period, so a never-connected (idle) channel is immediately reapable.
+  ChannelPool pool(std::chrono::nanoseconds{0});
+  ::grpc::ChannelArguments args;
+  auto creds = ::grpc::InsecureChannelCredentials();
+  auto chan1 = pool.GetOrCreateChannel(kTestTarget, creds, args, "insecure");
+  ASSERT_EQ(grpc_connectivity_state::GRPC_CHANNEL_IDLE, chan1->GetState(false));
+  EXPECT_OK(pool.CleanupChannels());
+  auto chan2 = pool.GetOrCreateChannel(kTestTarget, creds, args, "insecure");
+  EXPECT_NE(chan1.get(), chan2.get());
+}
+
+TEST(ChannelPoolTest, warm_up_populates_the_pool) {
+  ChannelPool pool(std::chrono::minutes{5});
+  ::grpc::ChannelArguments args;
+  auto creds = ::grpc::InsecureChannelCredentials();
+  pool.WarmUp({kTestTarget, "localhost:59998"}, creds, args, "insecure");
+  auto chan = pool.GetOrCreateChannel(kTestTarget, creds, args, "insecure");
+  // The warmed channel is reused rather than recreated, even though it has started connecting.
+  EXPECT_EQ(chan.get(), pool.GetOrCreateChannel(kTestTarget, creds, args, "insecure").get());
+}
+
+}  // namespace grpcutils
+}  // namespace px
@@ -100,8 +100,57 @@ rapidjson::Value JSONObj(const std::multimap<TKeyType, TValType, TComparator, TA
   return json_obj;
 }
 
+// Per-byte JSON escaping actions, indexed by the byte value.
+// 0 means the byte passes through verbatim, 'u' means it needs the \u00XX form (control
+// characters), and any other value is the second character of a two-character escape (\", \\,
+// \b, \f, \n, \r, \t). Table-driven so the common copy-through case is a single lookup.
+constexpr char kJSONEscapeTable[256] = {
+    // clang-format off
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+    0, 0, '"', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '\\', 0, 0, 0,
+    // All remaining bytes (0x60-0xFF) pass through verbatim.
+    // clang-format on
+};
+
 }  // namespace internal
 
+/**
+ * Appends s to *out as a JSON string, including the surrounding double quotes.
+ *
+ * This is the streaming alternative to building a rapidjson document: it writes directly into
+ * the caller-provided buffer, copying maximal runs of unescaped bytes in one shot and
+ * consulting a table only to classify each byte. Intended for hot paths that serialize records
+ * into a reusable buffer.
+ */
+inline void AppendEscapedJSONString(std::string_view s, std::string* out) {
+  out->push_back('"');
+  size_t run_start = 0;
+  for (size_t i = 0; i < s.size(); ++i) {
+    const char action = internal::kJSONEscapeTable[static_cast<uint8_t>(s[i])];
+    if (action == 0) {
+      continue;
+    }
+    out->append(s.data() + run_start, i - run_start);
+    if (action == 'u') {
+      constexpr char kHexDigits[] = "0123456789abcdef";
+      const uint8_t c = static_cast<uint8_t>(s[i]);
+      out->append("\\u00");
+      out->push_back(kHexDigits[c >> 4]);
+      out->push_back(kHexDigits[c & 0xF]);
+    } else {
+      out->push_back('\\');
+      out->push_back(action);
+    }
+    run_start = i + 1;
+  }
+  out->append(s.data() + run_start, s.size() - run_start);
+  out->push_back('"');
+}
+
 /**
  * Converts standard std types (e.g. std::string, std::vector, std::map) and their
  * compositions into a hierarchical JSON representation.
@@ -84,5 +84,30 @@ TEST(JSONBuilderTest, ResultsAreAsExpected) {
 
 // Note: if making a test using std::unordered_map, ensure that the test is robust to ordering.
 
+TEST(AppendEscapedJSONStringTest, PassThroughAndEscapes) {
+  std::string out;
+
+  AppendEscapedJSONString("hello world", &out);
+  EXPECT_THAT(out, StrEq(R"("hello world")"));
+
+  out.clear();
+  AppendEscapedJSONString("say \"hi\"\n\tc:\\path", &out);
+  EXPECT_THAT(out, StrEq(R"("say \"hi\"\n\tc:\\path")"));
+
+  out.clear();
+  AppendEscapedJSONString(std::string_view("\x01\x02\x1f", 3), &out);
+  EXPECT_THAT(out, StrEq(R"("\u0001\u0002\u001f")"));
+
+  // UTF-8 multi-byte sequences pass through verbatim.
+  out.clear();
+  AppendEscapedJSONString("π", &out);
+  EXPECT_THAT(out, StrEq("\"π\""));
+
+  // Appends to the existing buffer contents instead of replacing them.
+  out = "prefix:";
+  AppendEscapedJSONString("x", &out);
+  EXPECT_THAT(out, StrEq(R"(prefix:"x")"));
+}
+
 }  // namespace utils
 }  // namespace px
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "src/common/base/base.h"
+
+namespace px {
+/**
+ * Arena is a chunked bump allocator: each allocation is a pointer increment into a large
+ * chunk, and all memory is released at once when the arena is destroyed. This makes it cheap
+ * to build up many small, similarly-lived objects (e.g. the nodes of a planner IR graph)
+ * without a malloc/free per object.
+ *
+ * The arena never runs destructors. The owner of a non-trivially-destructible object must
+ * invoke its destructor itself; use ObjectPool instead when individual delete semantics are
+ * needed.
+ *
+ * Not thread safe.
+ */
+class Arena final : public px::NotCopyable {
+ public:
+  Arena() = default;
+
+  /**
+   * Returns a pointer to size bytes with the requested alignment (must be a power of two).
+   * The memory is valid for the lifetime of the arena.
+   */
+  void* Allocate(size_t size, size_t alignment) {
+    DCHECK_NE(alignment, 0U);
+    DCHECK_EQ(alignment & (alignment - 1), 0U) << "alignment must be a power of two";
+    uintptr_t ptr = (current_ + alignment - 1) & ~(alignment - 1);
+    if (ptr + size > chunk_end_) {
+      NewChunk(size + alignment);
+      ptr = (current_ + alignment - 1) & ~(alignment - 1);
+    }
+    current_ = ptr + size;
+    return reinterpret_cast<void*>(ptr);
+  }
+
+  /**
+   * Constructs a T inside the arena. The caller is responsible for running ~T() if it is
+   * non-trivial; the arena only reclaims the memory.
+   */
+  template <typename T, typename... Args>
+  T* Create(Args&&... args) {
+    return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+
+  /**
+   * Total bytes reserved from the system, including unused chunk tails.
+   */
+  size_t bytes_allocated() const { return bytes_allocated_; }
+
+ private:
+  void NewChunk(size_t min_size) {
+    size_t size = std::max(min_size, next_chunk_size_);
+    next_chunk_size_ = std::min<size_t>(2 * next_chunk_size_, kMaxChunkSize);
+    chunks_.emplace_back(new uint8_t[size]);
+    bytes_allocated_ += size;
+    current_ = reinterpret_cast<uintptr_t>(chunks_.back().get());
+    chunk_end_ = current_ + size;
+  }
+
+  static constexpr size_t kInitialChunkSize = 4096;
+  static constexpr size_t kMaxChunkSize = 64 * 1024;
+
+  std::vector<std::unique_ptr<uint8_t[]>> chunks_;
+  uintptr_t current_ = 0;
+  uintptr_t chunk_end_ = 0;
+  size_t next_chunk_size_ = kInitialChunkSize;
+  size_t bytes_allocated_ = 0;
+};
+
+}  // namespace px
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/memory/arena.h"
+#include <gtest/gtest.h>
+
+namespace px {
+
+TEST(arena_test, test_alignment) {
+  Arena arena;
+  for (size_t alignment : {1, 2, 4, 8, 16, 64}) {
+    void* ptr = arena.Allocate(3, alignment);
+    EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(ptr) % alignment);
+  }
+}
+
+TEST(arena_test, test_allocations_are_distinct_and_writable) {
+  Arena arena;
+  auto* a = reinterpret_cast<int64_t*>(arena.Allocate(sizeof(int64_t), alignof(int64_t)));
+  auto* b = reinterpret_cast<int64_t*>(arena.Allocate(sizeof(int64_t), alignof(int64_t)));
+  ASSERT_NE(a, b);
+  *a = 1;
+  *b = 2;
+  EXPECT_EQ(1, *a);
+  EXPECT_EQ(2, *b);
+}
+
+TEST(arena_test, test_small_allocations_share_chunks) {
+  Arena arena;
+  arena.Allocate(8, 8);
+  size_t bytes_after_first = arena.bytes_allocated();
+  for (int i = 0; i < 100; ++i) {
+    arena.Allocate(8, 8);
+  }
+  EXPECT_EQ(bytes_after_first, arena.bytes_allocated());
+}
+
+TEST(arena_test, test_oversized_allocation) {
+  Arena arena;
+  // Larger than any chunk the arena would grow to on its own.
+  constexpr size_t kSize = 1024 * 1024;
+  auto* ptr = reinterpret_cast<uint8_t*>(arena.Allocate(kSize, 8));
+  ptr[0] = 1;
+  ptr[kSize - 1] = 2;
+  EXPECT_EQ(1, ptr[0]);
+  EXPECT_EQ(2, ptr[kSize - 1]);
+  // A subsequent small allocation should still succeed.
+  EXPECT_NE(nullptr, arena.Allocate(8, 8));
+}
+
+TEST(arena_test, test_create) {
+  Arena arena;
+  struct Point {
+    Point(int64_t x, int64_t y) : x(x), y(y) {}
+    int64_t x;
+    int64_t y;
+  };
+  Point* p = arena.Create<Point>(1, 2);
+  ASSERT_NE(nullptr, p);
+  EXPECT_EQ(1, p->x);
+  EXPECT_EQ(2, p->y);
+}
+
+}  // namespace px
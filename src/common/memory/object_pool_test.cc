@@ -19,6 +19,10 @@
 #include "src/common/memory/object_pool.h"
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace px {
 
 class TestObject {
@@ -64,6 +68,30 @@ TEST(object_pool_test, test_clear) {
   EXPECT_EQ(3, count);
 }
 
+TEST(object_pool_test, test_concurrent_adds) {
+  constexpr int kNumThreads = 4;
+  constexpr int kObjectsPerThread = 1000;
+
+  // Destruction happens on a single thread (pool destruction), so a plain counter suffices.
+  int count = 0;
+  {
+    ObjectPool pool;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back([&pool, &count] {
+        for (int j = 0; j < kObjectsPerThread; ++j) {
+          pool.Add(new TestObject(&count));
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    EXPECT_EQ(0, count);
+  }
+  EXPECT_EQ(kNumThreads * kObjectsPerThread, count);
+}
+
 TEST(object_pool_test, test_different_objects) {
   int count = 0;
   int count2 = 0;
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/metrics/hdr_histogram.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace metrics {
+
+HdrHistogram::HdrHistogram(prometheus::Histogram* hist,
+                           prometheus::Histogram::BucketBoundaries boundaries)
+    : hist_(hist), boundaries_(std::move(boundaries)) {
+  DCHECK(hist_ != nullptr);
+  DCHECK(std::is_sorted(boundaries_.begin(), boundaries_.end()));
+
+  const size_t num_buckets = boundaries_.size() + 1;
+  for (Stripe& stripe : stripes_) {
+    stripe.counts = std::vector<std::atomic<uint64_t>>(num_buckets);
+  }
+  flushed_counts_.resize(num_buckets, 0);
+}
+
+prometheus::Histogram::BucketBoundaries HdrHistogram::ExponentialBoundaries(double start,
+                                                                            double factor,
+                                                                            int count) {
+  DCHECK_GT(start, 0);
+  DCHECK_GT(factor, 1.0);
+
+  prometheus::Histogram::BucketBoundaries boundaries;
+  boundaries.reserve(count);
+  double bound = start;
+  for (int i = 0; i < count; ++i) {
+    boundaries.push_back(bound);
+    bound *= factor;
+  }
+  return boundaries;
+}
+
+size_t HdrHistogram::StripeIdx() {
+  static thread_local const size_t idx =
+      std::hash<std::thread::id>{}(std::this_thread::get_id()) % kNumStripes;
+  return idx;
+}
+
+size_t HdrHistogram::BucketIdx(double value) const {
+  // Same bucket semantics as prometheus::Histogram: first boundary >= value, with the
+  // overflow bucket for values above the last boundary.
+  return std::distance(boundaries_.begin(),
+                       std::lower_bound(boundaries_.begin(), boundaries_.end(), value));
+}
+
+void HdrHistogram::Record(double value) {
+  Stripe& stripe = stripes_[StripeIdx()];
+  stripe.counts[BucketIdx(value)].fetch_add(1, std::memory_order_relaxed);
+
+  // fetch_add on atomic<double> is C++20, so add via CAS. The stripe is effectively
+  // single-writer, so the loop almost never retries.
+  double sum = stripe.sum.load(std::memory_order_relaxed);
+  while (!stripe.sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+  }
+}
+
+void HdrHistogram::Flush() {
+  absl::base_internal::SpinLockHolder lock(&flush_lock_);
+
+  const size_t num_buckets = boundaries_.size() + 1;
+  std::vector<uint64_t> totals(num_buckets, 0);
+  double total_sum = 0;
+  for (Stripe& stripe : stripes_) {
+    for (size_t i = 0; i < num_buckets; ++i) {
+      totals[i] += stripe.counts[i].load(std::memory_order_relaxed);
+    }
+    total_sum += stripe.sum.load(std::memory_order_relaxed);
+  }
+
+  std::vector<double> increments(num_buckets, 0.0);
+  bool any_increments = false;
+  for (size_t i = 0; i < num_buckets; ++i) {
+    increments[i] = static_cast<double>(totals[i] - flushed_counts_[i]);
+    any_increments |= totals[i] != flushed_counts_[i];
+  }
+  if (!any_increments) {
+    return;
+  }
+
+  hist_->ObserveMultiple(increments, total_sum - flushed_sum_);
+  flushed_counts_ = std::move(totals);
+  flushed_sum_ = total_sum;
+}
+
+}  // namespace metrics
+}  // namespace px
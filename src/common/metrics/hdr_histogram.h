@@ -0,0 +1,99 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <absl/base/internal/spinlock.h>
+#include <prometheus/histogram.h>
+
+#include "src/common/metrics/metrics.h"
+
+namespace px {
+namespace metrics {
+
+/**
+ * HdrHistogram is a fixed-memory histogram front-end for hot-path instrumentation.
+ *
+ * A prometheus::Histogram takes a mutex per Observe(), which is too expensive inside per-event
+ * loops like TransferStreams or per-batch exec paths. Record() here is a relaxed atomic add into
+ * a per-thread-indexed stripe: no locks, and threads on different stripes never share a cache
+ * line, so per-event recording does not distort what it measures. Flush() folds everything
+ * recorded since the previous flush into the backing prometheus histogram with one batched
+ * update, and is meant to be driven periodically from a metrics timer, off the hot path.
+ *
+ * Bucket boundaries are fixed at construction. ExponentialBoundaries() builds the log-spaced
+ * (HDR-style) layout typically used for latencies and sizes.
+ */
+class HdrHistogram {
+ public:
+  /**
+   * @param hist The backing prometheus histogram. Must have been built with the same boundaries
+   * and must outlive this object.
+   * @param boundaries The bucket boundaries, in increasing order.
+   */
+  HdrHistogram(prometheus::Histogram* hist, prometheus::Histogram::BucketBoundaries boundaries);
+
+  /**
+   * Returns `count` log-spaced boundaries: start, start*factor, start*factor^2, ...
+   */
+  static prometheus::Histogram::BucketBoundaries ExponentialBoundaries(double start, double factor,
+                                                                       int count);
+
+  /**
+   * Records one value. Wait-free in the common case; safe to call from any thread.
+   */
+  void Record(double value);
+
+  /**
+   * Pushes all values recorded since the previous Flush() into the backing prometheus
+   * histogram. Safe to run concurrently with Record(); concurrent flushes serialize.
+   */
+  void Flush();
+
+ private:
+  static constexpr size_t kNumStripes = 8;
+  static constexpr size_t kCacheLineSize = 64;
+
+  // Each stripe sits on its own cache line so threads on different stripes don't false-share.
+  struct alignas(kCacheLineSize) Stripe {
+    // One counter per boundary, plus one for values above the last boundary.
+    std::vector<std::atomic<uint64_t>> counts;
+    std::atomic<double> sum{0.0};
+  };
+
+  // Maps the calling thread to a stripe. The hash is computed once per thread.
+  static size_t StripeIdx();
+
+  size_t BucketIdx(double value) const;
+
+  prometheus::Histogram* hist_;
+  const prometheus::Histogram::BucketBoundaries boundaries_;
+  std::array<Stripe, kNumStripes> stripes_;
+
+  // Totals already pushed to the backing histogram, so Flush() can emit deltas.
+  absl::base_internal::SpinLock flush_lock_;
+  std::vector<uint64_t> flushed_counts_;
+  double flushed_sum_ = 0;
+};
+
+}  // namespace metrics
+}  // namespace px
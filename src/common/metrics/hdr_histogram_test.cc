@@ -0,0 +1,109 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/metrics/hdr_histogram.h"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <prometheus/registry.h>
+
+namespace px {
+namespace metrics {
+
+class HdrHistogramTest : public ::testing::Test {
+ protected:
+  HdrHistogramTest()
+      : boundaries_({1.0, 10.0, 100.0}),
+        hist_(prometheus::BuildHistogram()
+                  .Name("test_histogram")
+                  .Help("Histogram for testing.")
+                  .Register(registry_)
+                  .Add({}, boundaries_)),
+        hdr_(&hist_, boundaries_) {}
+
+  prometheus::Registry registry_;
+  prometheus::Histogram::BucketBoundaries boundaries_;
+  prometheus::Histogram& hist_;
+  HdrHistogram hdr_;
+};
+
+TEST_F(HdrHistogramTest, flush_pushes_recorded_values) {
+  hdr_.Record(0.5);
+  hdr_.Record(5.0);
+  hdr_.Record(50.0);
+  hdr_.Record(500.0);
+  hdr_.Flush();
+
+  auto metric = hist_.Collect();
+  EXPECT_EQ(4, metric.histogram.sample_count);
+  EXPECT_DOUBLE_EQ(555.5, metric.histogram.sample_sum);
+  ASSERT_EQ(4, metric.histogram.bucket.size());
+  EXPECT_EQ(1, metric.histogram.bucket[0].cumulative_count);
+  EXPECT_EQ(2, metric.histogram.bucket[1].cumulative_count);
+  EXPECT_EQ(3, metric.histogram.bucket[2].cumulative_count);
+  EXPECT_EQ(4, metric.histogram.bucket[3].cumulative_count);
+}
+
+TEST_F(HdrHistogramTest, flush_emits_deltas_only) {
+  hdr_.Record(5.0);
+  hdr_.Flush();
+  hdr_.Record(5.0);
+  hdr_.Flush();
+  // A flush with nothing new must not change the backing histogram.
+  hdr_.Flush();
+
+  auto metric = hist_.Collect();
+  EXPECT_EQ(2, metric.histogram.sample_count);
+  EXPECT_DOUBLE_EQ(10.0, metric.histogram.sample_sum);
+}
+
+TEST_F(HdrHistogramTest, concurrent_records) {
+  constexpr int kNumThreads = 4;
+  constexpr int kRecordsPerThread = 10000;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([this] {
+      for (int j = 0; j < kRecordsPerThread; ++j) {
+        hdr_.Record(5.0);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  hdr_.Flush();
+
+  auto metric = hist_.Collect();
+  EXPECT_EQ(kNumThreads * kRecordsPerThread, metric.histogram.sample_count);
+  EXPECT_DOUBLE_EQ(kNumThreads * kRecordsPerThread * 5.0, metric.histogram.sample_sum);
+}
+
+TEST_F(HdrHistogramTest, exponential_boundaries) {
+  auto boundaries = HdrHistogram::ExponentialBoundaries(0.001, 10.0, 4);
+  ASSERT_EQ(4, boundaries.size());
+  EXPECT_DOUBLE_EQ(0.001, boundaries[0]);
+  EXPECT_DOUBLE_EQ(0.01, boundaries[1]);
+  EXPECT_DOUBLE_EQ(0.1, boundaries[2]);
+  EXPECT_DOUBLE_EQ(1.0, boundaries[3]);
+}
+
+}  // namespace metrics
+}  // namespace px
@@ -29,6 +29,38 @@
 
 namespace px {
 namespace metrics {
+
+MemoryAttributionRegistry& MemoryAttributionRegistry::GetInstance() {
+  static MemoryAttributionRegistry* registry = new MemoryAttributionRegistry();
+  return *registry;
+}
+
+void MemoryAttributionRegistry::RegisterSource(const std::string& subsystem, UsageFn fn) {
+  absl::base_internal::SpinLockHolder lock(&lock_);
+  sources_[subsystem] = std::move(fn);
+}
+
+void MemoryAttributionRegistry::DeregisterSource(const std::string& subsystem) {
+  absl::base_internal::SpinLockHolder lock(&lock_);
+  sources_.erase(subsystem);
+}
+
+std::map<std::string, int64_t> MemoryAttributionRegistry::Sample() const {
+  // Copy the callbacks out first, so the lock is not held across callback invocations
+  // (callbacks may take their subsystem's own locks).
+  std::map<std::string, UsageFn> sources;
+  {
+    absl::base_internal::SpinLockHolder lock(&lock_);
+    sources = sources_;
+  }
+
+  std::map<std::string, int64_t> out;
+  for (const auto& [name, fn] : sources) {
+    out[name] = fn();
+  }
+  return out;
+}
+
 MemoryMetrics::MemoryMetrics(prometheus::Registry* registry, std::string tag_key,
                              std::string tag_value)
     : heap_size_bytes(prometheus::BuildGauge()
@@ -47,7 +79,12 @@ MemoryMetrics::MemoryMetrics(prometheus::Registry* registry, std::string tag_key
                           .Help("Number of bytes of the heap that have been freed to tcmalloc but "
                                 "not released to the OS.")
                           .Register(*registry)
-                          .Add({{tag_key, tag_value}})) {}
+                          .Add({{tag_key, tag_value}})),
+      subsystem_bytes_family(prometheus::BuildGauge()
+                                 .Name("memory_subsystem_bytes")
+                                 .Help("Self-accounted memory usage of a subsystem, in bytes.")
+                                 .Register(*registry)),
+      base_labels({{tag_key, tag_value}}) {}
 
 void MemoryMetrics::MeasureMemory() {
 #ifdef TCMALLOC
@@ -66,6 +103,13 @@ void MemoryMetrics::MeasureMemory() {
   heap_free_bytes.Set(static_cast<double>(pageheap_free_bytes + central_cache_free_bytes +
                                           transfer_cache_free_bytes + thread_cache_free_bytes));
 #endif
+
+  // Subsystem attribution is allocator-agnostic, so it is sampled regardless of tcmalloc.
+  for (const auto& [subsystem, bytes] : MemoryAttributionRegistry::GetInstance().Sample()) {
+    auto labels = base_labels;
+    labels["subsystem"] = subsystem;
+    subsystem_bytes_family.Add(labels).Set(static_cast<double>(bytes));
+  }
 }
 
 }  // namespace metrics
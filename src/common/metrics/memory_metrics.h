@@ -17,8 +17,11 @@
  */
 #pragma once
 
+#include <functional>
+#include <map>
 #include <string>
 
+#include <absl/base/internal/spinlock.h>
 #include <prometheus/gauge.h>
 #include <prometheus/registry.h>
 
@@ -27,6 +30,40 @@
 namespace px {
 namespace metrics {
 
+/**
+ * MemoryAttributionRegistry is a process-wide registry of named memory-usage sources.
+ *
+ * Subsystems that self-account their usage (table store, conn trackers, symbol caches, query
+ * pools) register a callback reporting their current byte count. MemoryMetrics samples every
+ * registered source into the memory_subsystem_bytes gauge on its normal collection period, so
+ * memory growth in production can be attributed to an owner without attaching a profiler.
+ */
+class MemoryAttributionRegistry {
+ public:
+  using UsageFn = std::function<int64_t()>;
+
+  static MemoryAttributionRegistry& GetInstance();
+
+  /**
+   * Registers (or replaces) the usage callback for a subsystem. The callback must remain valid
+   * until DeregisterSource is called with the same name.
+   */
+  void RegisterSource(const std::string& subsystem, UsageFn fn);
+
+  void DeregisterSource(const std::string& subsystem);
+
+  /**
+   * Invokes every registered callback, returning subsystem name -> current bytes.
+   */
+  std::map<std::string, int64_t> Sample() const;
+
+ private:
+  MemoryAttributionRegistry() = default;
+
+  mutable absl::base_internal::SpinLock lock_;
+  std::map<std::string, UsageFn> sources_;
+};
+
 struct MemoryMetrics {
   MemoryMetrics(prometheus::Registry* registry, std::string tag_key, std::string tag_value);
 
@@ -35,6 +72,11 @@ struct MemoryMetrics {
   prometheus::Gauge& heap_size_bytes;
   prometheus::Gauge& heap_inuse_bytes;
   prometheus::Gauge& heap_free_bytes;
+
+  // Per-subsystem attribution gauges, labeled by subsystem name. Sources come from the
+  // process-wide MemoryAttributionRegistry.
+  prometheus::Family<prometheus::Gauge>& subsystem_bytes_family;
+  const std::map<std::string, std::string> base_labels;
 };
 
 }  // namespace metrics
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "src/common/perf/elapsed_timer.h"
+
+namespace px {
+
+TEST(ThreadCpuTimer, accumulates_cpu_time) {
+  ThreadCpuTimer timer;
+  timer.Start();
+  // Burn some CPU; the volatile accumulator keeps the loop from being optimized away.
+  volatile uint64_t acc = 0;
+  for (uint64_t i = 0; i < 10000000; i++) {
+    acc += i;
+  }
+  timer.Stop();
+  EXPECT_GT(timer.ElapsedTime_us(), 0);
+
+  // CPU burned while the timer is stopped should not be counted.
+  uint64_t after_stop = timer.ElapsedTime_us();
+  for (uint64_t i = 0; i < 10000000; i++) {
+    acc += i;
+  }
+  EXPECT_EQ(after_stop, timer.ElapsedTime_us());
+}
+
+}  // namespace px
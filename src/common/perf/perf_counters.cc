@@ -0,0 +1,113 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/common/perf/perf_counters.h"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "src/common/base/base.h"
+
+namespace px {
+
+namespace {
+
+constexpr uint64_t kEventConfigs[] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+int OpenHardwareCounter(uint64_t config, int group_fd) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  // The group is enabled explicitly in Start().
+  attr.disabled = (group_fd == -1) ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // Measure the calling thread on any CPU.
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+uint64_t ReadCounter(int fd) {
+  uint64_t value = 0;
+  if (read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) {
+    return 0;
+  }
+  return value;
+}
+
+}  // namespace
+
+PerfCounters::PerfCounters() {
+  fds_.fill(-1);
+  for (size_t i = 0; i < kNumEvents; ++i) {
+    fds_[i] = OpenHardwareCounter(kEventConfigs[i], fds_[0]);
+    if (fds_[i] == -1) {
+      LOG_FIRST_N(WARNING, 1) << "Failed to open perf_event hardware counters ("
+                              << std::strerror(errno)
+                              << "); microarchitectural stats will not be reported.";
+      for (size_t j = 0; j < i; ++j) {
+        close(fds_[j]);
+        fds_[j] = -1;
+      }
+      return;
+    }
+  }
+  available_ = true;
+}
+
+PerfCounters::~PerfCounters() {
+  for (int fd : fds_) {
+    if (fd != -1) {
+      close(fd);
+    }
+  }
+}
+
+void PerfCounters::Start() {
+  if (!available_) {
+    return;
+  }
+  ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounterStats PerfCounters::End() {
+  PerfCounterStats stats;
+  if (!available_) {
+    return stats;
+  }
+  ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  stats.cycles = ReadCounter(fds_[0]);
+  stats.instructions = ReadCounter(fds_[1]);
+  stats.cache_misses = ReadCounter(fds_[2]);
+  stats.branch_misses = ReadCounter(fds_[3]);
+  return stats;
+}
+
+}  // namespace px
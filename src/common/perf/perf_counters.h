@@ -0,0 +1,63 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+namespace px {
+
+struct PerfCounterStats {
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t cache_misses = 0;
+  uint64_t branch_misses = 0;
+};
+
+// PerfCounters reads the CPU's performance monitoring counters for the calling thread through
+// perf_event(2). It counts cycles, retired instructions, last-level cache misses and branch
+// misses between Start() and End(), user space only. Opening the counters can fail (perf_event
+// access is often restricted in containers, see perf_event_paranoid); in that case available()
+// returns false and End() returns all-zero stats, mirroring how MemoryTracker degrades without
+// tcmalloc.
+class PerfCounters {
+ public:
+  PerfCounters();
+  ~PerfCounters();
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  // Whether the counters could be opened on this system.
+  bool available() const { return available_; }
+
+  // Reset and enable the counters.
+  void Start();
+  // Disable the counters and return the counts accumulated since Start().
+  PerfCounterStats End();
+
+ private:
+  static constexpr size_t kNumEvents = 4;
+
+  bool available_ = false;
+  // Event group: fds_[0] is the group leader (cycles); all events are enabled and disabled
+  // together so the counts cover the same window.
+  std::array<int, kNumEvents> fds_;
+};
+
+}  // namespace px
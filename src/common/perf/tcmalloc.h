@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <string>
+
 #ifdef TCMALLOC
 #include <gperftools/malloc_extension.h>
 #endif
@@ -31,4 +33,15 @@ void ReleaseFreeMemory() {
 #endif
 }
 
+// Returns tcmalloc's sampled heap profile, which attributes live allocations to call stacks.
+// Intended for on-demand dumps from debug handlers, so an owner can be named in production
+// without attaching a profiler. Returns an empty string if the allocator is not tcmalloc.
+inline std::string GetHeapSample() {
+  std::string result;
+#ifdef TCMALLOC
+  MallocExtension::instance()->GetHeapSample(&result);
+#endif
+  return result;
+}
+
 }  // namespace px
@@ -16,6 +16,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <fstream>
 #include <limits>
 #include <string>
@@ -273,6 +276,25 @@ Status ProcParser::ParseProcPIDStat(int32_t pid, int64_t page_size_bytes,
   return Status::OK();
 }
 
+namespace {
+
+// Field offsets for /proc/<pid>/io. Shared by ParseProcPIDStatIO and ProcessStatsScanner,
+// which parse the same file through different I/O paths.
+const absl::flat_hash_map<std::string_view, size_t>& ProcIOFieldOffsetMap() {
+  // Just to be safe when using offsetof, make sure object is standard layout.
+  static_assert(std::is_standard_layout<ProcParser::ProcessStats>::value);
+
+  static const absl::flat_hash_map<std::string_view, size_t> kFieldOffsetMap{
+      {"rchar", offsetof(ProcParser::ProcessStats, rchar_bytes)},
+      {"wchar", offsetof(ProcParser::ProcessStats, wchar_bytes)},
+      {"read_bytes", offsetof(ProcParser::ProcessStats, read_bytes)},
+      {"write_bytes", offsetof(ProcParser::ProcessStats, write_bytes)},
+  };
+  return kFieldOffsetMap;
+}
+
+}  // namespace
+
 Status ProcParser::ParseProcPIDStatIO(int32_t pid, ProcessStats* out) const {
   /**
    * Sample file:
@@ -287,17 +309,7 @@ Status ProcParser::ParseProcPIDStatIO(int32_t pid, ProcessStats* out) const {
   DCHECK(out != nullptr);
   std::string fpath = absl::Substitute("$0/$1/io", proc_base_path_, pid);
 
-  // Just to be safe when using offsetof, make sure object is standard layout.
-  static_assert(std::is_standard_layout<ProcessStats>::value);
-
-  static absl::flat_hash_map<std::string_view, size_t> field_name_to_offset_map{
-      {"rchar", offsetof(ProcessStats, rchar_bytes)},
-      {"wchar", offsetof(ProcessStats, wchar_bytes)},
-      {"read_bytes", offsetof(ProcessStats, read_bytes)},
-      {"write_bytes", offsetof(ProcessStats, write_bytes)},
-  };
-
-  return ParseFromKeyValueFile(fpath, field_name_to_offset_map, reinterpret_cast<uint8_t*>(out));
+  return ParseFromKeyValueFile(fpath, ProcIOFieldOffsetMap(), reinterpret_cast<uint8_t*>(out));
 }
 
 Status ProcParser::ParseProcStat(SystemStats* out) const {
@@ -856,5 +868,207 @@ StatusOr<ProcParser::ProcessSMaps> ProcParser::GetExecutableMapEntry(pid_t pid,
   return error::NotFound(absl::Substitute("Could not find maps entry for $0", libpath));
 }
 
+namespace {
+
+// In-place equivalent of ParseProcPIDStat, operating on already-read file contents.
+// The command is surrounded by () and may contain spaces, so it is extracted first and the
+// remaining fields are walked relative to the closing paren instead of re-splitting the line.
+Status ParseStatContents(std::string_view contents, int64_t page_size_bytes,
+                         int64_t kernel_tick_time_ns, ProcParser::ProcessStats* out) {
+  size_t open_paren_idx = contents.find_first_of('(');
+  size_t close_paren_idx = contents.find_last_of(')');
+  if (open_paren_idx == std::string_view::npos || close_paren_idx == std::string_view::npos ||
+      close_paren_idx < open_paren_idx) {
+    return error::Internal("Invalid command name in stat contents");
+  }
+  // Assign rather than construct so the string's capacity is reused across scans.
+  out->process_name.assign(contents.data() + open_paren_idx + 1,
+                           close_paren_idx - open_paren_idx - 1);
+
+  bool ok =
+      absl::SimpleAtoi(absl::StripAsciiWhitespace(contents.substr(0, open_paren_idx)), &out->pid);
+
+  // Walk the fields after the command in place. The command is field 1, so the first token
+  // after the ')' is field 2. Parsing stops at the last field we care about.
+  std::string_view rest = contents.substr(close_paren_idx + 1);
+  int field_idx = 1;
+  size_t pos = 0;
+  while (pos < rest.size() && field_idx < kProcStatRSSField) {
+    pos = rest.find_first_not_of(kFieldSeparators, pos);
+    if (pos == std::string_view::npos) {
+      break;
+    }
+    size_t end = rest.find_first_of(kFieldSeparators, pos);
+    std::string_view token = rest.substr(pos, end - pos);
+    pos = (end == std::string_view::npos) ? rest.size() : end;
+
+    switch (++field_idx) {
+      case kProcStatMinorFaultsField:
+        ok &= absl::SimpleAtoi(token, &out->minor_faults);
+        break;
+      case kProcStatMajorFaultsField:
+        ok &= absl::SimpleAtoi(token, &out->major_faults);
+        break;
+      case kProcStatUTimeField:
+        ok &= absl::SimpleAtoi(token, &out->utime_ns);
+        break;
+      case kProcStatKTimeField:
+        ok &= absl::SimpleAtoi(token, &out->ktime_ns);
+        break;
+      case kProcStatNumThreadsField:
+        ok &= absl::SimpleAtoi(token, &out->num_threads);
+        break;
+      case kProcStatVSizeField:
+        ok &= absl::SimpleAtoi(token, &out->vsize_bytes);
+        break;
+      case kProcStatRSSField:
+        ok &= absl::SimpleAtoi(token, &out->rss_bytes);
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (field_idx < kProcStatRSSField) {
+    return error::Unknown("Incorrect number of fields in stat contents");
+  }
+  if (!ok) {
+    // This should never happen since it requires the file to be ill-formed by the kernel.
+    return error::Internal("Failed to parse stat contents. ATOI failed.");
+  }
+
+  // The kernel tracks utime and ktime in kernel ticks, and RSS in pages.
+  out->utime_ns *= kernel_tick_time_ns;
+  out->ktime_ns *= kernel_tick_time_ns;
+  out->rss_bytes *= page_size_bytes;
+  return Status::OK();
+}
+
+// In-place equivalent of ParseProcPIDStatIO, with the same semantics as ParseFromKeyValueLine.
+Status ParseStatIOContents(std::string_view contents, ProcParser::ProcessStats* out) {
+  const auto& field_offset_map = ProcIOFieldOffsetMap();
+  auto* out_base = reinterpret_cast<uint8_t*>(out);
+
+  size_t read_count = 0;
+  for (std::string_view line : absl::StrSplit(contents, '\n', absl::SkipWhitespace())) {
+    size_t colon_idx = line.find(':');
+    if (colon_idx == std::string_view::npos) {
+      continue;
+    }
+    std::string_view key = absl::StripAsciiWhitespace(line.substr(0, colon_idx));
+    std::string_view val = absl::StripAsciiWhitespace(line.substr(colon_idx + 1));
+
+    const auto& it = field_offset_map.find(key);
+    if (it == field_offset_map.end()) {
+      continue;
+    }
+    auto* val_ptr = reinterpret_cast<int64_t*>(out_base + it->second);
+
+    bool ok = false;
+    if (absl::EndsWith(val, " kB")) {
+      // Convert kB to bytes. proc seems to only use kB as the unit if it's present
+      // else there are no units.
+      ok = absl::SimpleAtoi(absl::StripSuffix(val, " kB"), val_ptr);
+      *val_ptr *= 1024;
+    } else {
+      ok = absl::SimpleAtoi(val, val_ptr);
+    }
+    if (!ok) {
+      *val_ptr = -1;
+    }
+
+    // Check to see if we have read all the fields, if so we can skip the rest.
+    if (++read_count == field_offset_map.size()) {
+      break;
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+ProcessStatsScanner::ProcessStatsScanner(const system::Config& cfg)
+    : ProcessStatsScanner(cfg.proc_path()) {}
+
+ProcessStatsScanner::ProcessStatsScanner(std::string proc_path)
+    : proc_base_path_(std::move(proc_path)) {
+  // Large enough for typical stat and io files, so steady-state scans never resize.
+  buf_.resize(4096);
+}
+
+ProcessStatsScanner::~ProcessStatsScanner() {
+  for (const auto& [pid, fds] : fd_cache_) {
+    if (fds.stat_fd >= 0) {
+      close(fds.stat_fd);
+    }
+    if (fds.io_fd >= 0) {
+      close(fds.io_fd);
+    }
+  }
+}
+
+StatusOr<std::string_view> ProcessStatsScanner::ReadFile(int32_t pid, const char* file, int* fd) {
+  // Two attempts: if a cached fd fails to read, its process has exited, so reopen once in case
+  // the pid has been recycled.
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    if (*fd < 0) {
+      std::string fpath = absl::Substitute("$0/$1/$2", proc_base_path_, pid, file);
+      *fd = open(fpath.c_str(), O_RDONLY | O_CLOEXEC);
+      if (*fd < 0) {
+        return error::Internal("Failed to open file $0", fpath);
+      }
+    }
+
+    size_t total = 0;
+    ssize_t n;
+    while ((n = pread(*fd, buf_.data() + total, buf_.size() - total, total)) > 0) {
+      total += n;
+      if (total == buf_.size()) {
+        buf_.resize(buf_.size() * 2);
+      }
+    }
+    if (n == 0 && total > 0) {
+      return std::string_view(buf_.data(), total);
+    }
+
+    close(*fd);
+    *fd = -1;
+  }
+  return error::Internal("Failed to read /proc/$0/$1", pid, file);
+}
+
+Status ProcessStatsScanner::Scan(int32_t pid, int64_t page_size_bytes, int64_t kernel_tick_time_ns,
+                                 ProcParser::ProcessStats* out) {
+  DCHECK(out != nullptr);
+  PidFds& fds = fd_cache_[pid];
+  fds.last_used_cycle = cycle_;
+
+  PL_ASSIGN_OR_RETURN(std::string_view stat_contents, ReadFile(pid, "stat", &fds.stat_fd));
+  PL_RETURN_IF_ERROR(ParseStatContents(stat_contents, page_size_bytes, kernel_tick_time_ns, out));
+
+  PL_ASSIGN_OR_RETURN(std::string_view io_contents, ReadFile(pid, "io", &fds.io_fd));
+  return ParseStatIOContents(io_contents, out);
+}
+
+void ProcessStatsScanner::EndCycle() {
+  std::vector<int32_t> expired;
+  for (const auto& [pid, fds] : fd_cache_) {
+    if (fds.last_used_cycle != cycle_) {
+      expired.push_back(pid);
+    }
+  }
+  for (int32_t pid : expired) {
+    const PidFds& fds = fd_cache_[pid];
+    if (fds.stat_fd >= 0) {
+      close(fds.stat_fd);
+    }
+    if (fds.io_fd >= 0) {
+      close(fds.io_fd);
+    }
+    fd_cache_.erase(pid);
+  }
+  ++cycle_;
+}
+
 }  // namespace system
 }  // namespace px
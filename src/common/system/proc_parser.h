@@ -66,6 +66,14 @@ class ProcParser {
     int64_t tx_drops = 0;
 
     void Clear() { *this = NetworkStats(); }
+
+    bool operator==(const NetworkStats& other) const {
+      return rx_bytes == other.rx_bytes && rx_packets == other.rx_packets &&
+             rx_errs == other.rx_errs && rx_drops == other.rx_drops &&
+             tx_bytes == other.tx_bytes && tx_packets == other.tx_packets &&
+             tx_errs == other.tx_errs && tx_drops == other.tx_drops;
+    }
+    bool operator!=(const NetworkStats& other) const { return !(*this == other); }
   };
 
   // ProcessStats are basic stats about the process collected from /proc.
@@ -396,6 +404,58 @@ class ProcParser {
   std::string proc_base_path_;
 };
 
+/**
+ * ProcessStatsScanner samples /proc/<pid>/stat and /proc/<pid>/io across collection cycles.
+ *
+ * ProcParser opens fresh streams and allocates per call, which turns per-pid-per-sample
+ * collection (ProcessStatsConnector polls every pid every cycle) into a syscall and allocation
+ * storm on large nodes. The scanner instead keeps the per-pid fds open across cycles, re-reads
+ * them with pread into one reusable buffer, and tokenizes in place, so a steady-state sample
+ * costs two pread calls per pid.
+ *
+ * A /proc fd stays bound to the process it was opened for: once that process exits, reads on the
+ * fd fail even if the pid has been recycled, so a cached fd can never serve another process's
+ * data. The scanner reopens on read failure and relies on EndCycle() — called once per
+ * collection cycle, after the live pid set has been scanned — to drop fds of disappeared pids.
+ */
+class ProcessStatsScanner : public NotCopyable {
+ public:
+  explicit ProcessStatsScanner(const system::Config& cfg);
+  explicit ProcessStatsScanner(std::string proc_path);
+  ~ProcessStatsScanner();
+
+  /**
+   * Samples /proc/<pid>/stat and /proc/<pid>/io into *out, reusing cached fds when the pid has
+   * been scanned before. Mirrors ParseProcPIDStat + ParseProcPIDStatIO.
+   */
+  Status Scan(int32_t pid, int64_t page_size_bytes, int64_t kernel_tick_time_ns,
+              ProcParser::ProcessStats* out);
+
+  /**
+   * Closes the fds of pids that have not been scanned since the previous EndCycle() call.
+   */
+  void EndCycle();
+
+  size_t NumCachedPids() const { return fd_cache_.size(); }
+
+ private:
+  struct PidFds {
+    int stat_fd = -1;
+    int io_fd = -1;
+    uint64_t last_used_cycle = 0;
+  };
+
+  // Reads the full contents of /proc/<pid>/<file> into buf_, opening (or reopening, if the
+  // cached fd belongs to an exited process) the fd as needed. Returns a view into buf_.
+  StatusOr<std::string_view> ReadFile(int32_t pid, const char* file, int* fd);
+
+  std::string proc_base_path_;
+  absl::flat_hash_map<int32_t, PidFds> fd_cache_;
+  uint64_t cycle_ = 0;
+  // Reusable read buffer shared by all pids; grown on demand, never shrunk.
+  std::string buf_;
+};
+
 StatusOr<int64_t> GetPIDStartTimeTicks(const std::filesystem::path& proc_pid_path);
 
 }  // namespace system
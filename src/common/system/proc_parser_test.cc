@@ -369,6 +369,61 @@ TEST_F(ProcParserTest, GetExecutableMapEntry) {
   }
 }
 
+TEST_F(ProcParserTest, ScannerMatchesParsers) {
+  ProcessStatsScanner scanner(GetPathToTestDataFile("testdata/proc"));
+
+  ProcParser::ProcessStats stats;
+  ASSERT_OK(scanner.Scan(123, bytes_per_page_, kernel_tick_time_ns_, &stats));
+
+  // Same expectations as the ParsePidStat and ParseStatIO tests above.
+  EXPECT_EQ(4602, stats.pid);
+  EXPECT_EQ("npm (start)", stats.process_name);
+
+  EXPECT_EQ(800, stats.utime_ns);
+  EXPECT_EQ(2300, stats.ktime_ns);
+  EXPECT_EQ(13, stats.num_threads);
+
+  EXPECT_EQ(55, stats.major_faults);
+  EXPECT_EQ(1799, stats.minor_faults);
+
+  EXPECT_EQ(114384896, stats.vsize_bytes);
+  EXPECT_EQ(2577 * bytes_per_page_, stats.rss_bytes);
+
+  EXPECT_EQ(5405203, stats.rchar_bytes);
+  EXPECT_EQ(1239158, stats.wchar_bytes);
+  EXPECT_EQ(17838080, stats.read_bytes);
+  EXPECT_EQ(634880, stats.write_bytes);
+
+  // A second scan goes through the cached fds and must produce identical results.
+  ProcParser::ProcessStats stats2;
+  ASSERT_OK(scanner.Scan(123, bytes_per_page_, kernel_tick_time_ns_, &stats2));
+  EXPECT_EQ("npm (start)", stats2.process_name);
+  EXPECT_EQ(2577 * bytes_per_page_, stats2.rss_bytes);
+  EXPECT_EQ(5405203, stats2.rchar_bytes);
+}
+
+TEST_F(ProcParserTest, ScannerEvictsUnscannedPids) {
+  ProcessStatsScanner scanner(GetPathToTestDataFile("testdata/proc"));
+
+  ProcParser::ProcessStats stats;
+  ASSERT_OK(scanner.Scan(123, bytes_per_page_, kernel_tick_time_ns_, &stats));
+  scanner.EndCycle();
+
+  // The pid was scanned during the cycle that just ended, so its fds are retained.
+  EXPECT_EQ(1, scanner.NumCachedPids());
+
+  // Not scanned this cycle, so the next EndCycle drops it.
+  scanner.EndCycle();
+  EXPECT_EQ(0, scanner.NumCachedPids());
+}
+
+TEST_F(ProcParserTest, ScannerMissingPid) {
+  ProcessStatsScanner scanner(GetPathToTestDataFile("testdata/proc"));
+
+  ProcParser::ProcessStats stats;
+  EXPECT_NOT_OK(scanner.Scan(999999, bytes_per_page_, kernel_tick_time_ns_, &stats));
+}
+
 // Check ProcParser can detect itself.
 TEST(ProcParserGetExePathTest, CheckTestProcess) {
   // Since bazel prepares test files as symlinks, creating testdata/proc/123/exe symlink would
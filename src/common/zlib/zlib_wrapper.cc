@@ -60,5 +60,74 @@ StatusOr<std::string> Inflate(std::string_view in, size_t output_block_size) {
   return out;
 }
 
+StatusOr<std::string> InflateToCap(std::string_view in, size_t output_size_cap) {
+  z_stream zs = {};
+
+  // MAX_WBITS + 32 enables automatic gzip/zlib header detection,
+  // covering both Content-Encoding: gzip and Content-Encoding: deflate.
+  if (inflateInit2(&zs, MAX_WBITS + 32) != Z_OK) {
+    return error::Internal("inflateInit2 failed while decompressing.");
+  }
+
+  zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+  zs.avail_in = in.size();
+
+  std::string out;
+  out.resize(output_size_cap);
+  zs.next_out = reinterpret_cast<Bytef*>(out.data());
+  zs.avail_out = out.size();
+
+  int ret = Z_BUF_ERROR;
+  while (zs.avail_in > 0 && zs.avail_out > 0) {
+    ret = inflate(&zs, Z_NO_FLUSH);
+    if (ret != Z_OK) {
+      break;
+    }
+  }
+
+  out.resize(zs.total_out);
+  inflateEnd(&zs);
+
+  if (ret == Z_STREAM_END) {
+    return out;
+  }
+
+  // Input was truncated mid-stream, or the output cap was reached.
+  // Both are expected for bodies captured up to a size limit, so return the prefix.
+  if ((ret == Z_OK || ret == Z_BUF_ERROR) && (zs.avail_in == 0 || zs.avail_out == 0)) {
+    return out;
+  }
+
+  return error::Internal("Exception during zlib decompression: $0",
+                         zs.msg != nullptr ? zs.msg : "unknown error");
+}
+
+StatusOr<std::string> Deflate(std::string_view in, int level) {
+  z_stream zs = {};
+
+  if (deflateInit2(&zs, level, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+    return error::Internal("deflateInit2 failed while compressing.");
+  }
+
+  zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+  zs.avail_in = in.size();
+
+  std::string out;
+  out.resize(deflateBound(&zs, in.size()));
+  zs.next_out = reinterpret_cast<Bytef*>(out.data());
+  zs.avail_out = out.size();
+
+  int ret = deflate(&zs, Z_FINISH);
+  out.resize(zs.total_out);
+  deflateEnd(&zs);
+
+  if (ret != Z_STREAM_END) {
+    return error::Internal("Exception during zlib compression: $0",
+                           zs.msg != nullptr ? zs.msg : "unknown error");
+  }
+
+  return out;
+}
+
 }  // namespace zlib
 }  // namespace px
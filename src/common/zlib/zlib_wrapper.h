@@ -35,5 +35,31 @@ namespace zlib {
  */
 StatusOr<std::string> Inflate(std::string_view in, size_t output_block_size = 16384);
 
+/**
+ * @brief Inflates a source buffer with a bound on the output size, tolerating truncated input.
+ *
+ * Decompression proceeds incrementally and stops once the output cap is reached or the input is
+ * exhausted, so memory use is bounded even for highly-compressed payloads. Unlike Inflate(), a
+ * source buffer that was truncated mid-stream (e.g. a body captured up to a size limit) is not an
+ * error: the decompressed prefix is returned instead.
+ *
+ * Accepts both gzip and zlib (deflate) encoded streams, via automatic header detection.
+ *
+ * @param in A view into the source buffer, possibly a truncated stream.
+ * @param output_size_cap Maximum number of decompressed bytes to produce.
+ * @return Status or the decompressed content, up to the cap, as a string.
+ */
+StatusOr<std::string> InflateToCap(std::string_view in, size_t output_size_cap);
+
+/**
+ * @brief Deflates (gzip) a source buffer and returns the compressed content as a string. The
+ * output can be decompressed with Inflate.
+ *
+ * @param in A view into the source buffer.
+ * @param level The zlib compression level (1 = fastest, 9 = best compression).
+ * @return Status or the compressed content as a string.
+ */
+StatusOr<std::string> Deflate(std::string_view in, int level = 1);
+
 }  // namespace zlib
 }  // namespace px
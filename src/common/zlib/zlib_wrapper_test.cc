@@ -46,4 +46,36 @@ TEST_F(ZlibTest, inflate_test) {
   EXPECT_OK_AND_EQ(result, GetExpectedResult());
 }
 
+TEST_F(ZlibTest, deflate_inflate_round_trip) {
+  std::string input(4096, 'a');
+  input += "some less compressible content 1234567890";
+  ASSERT_OK_AND_ASSIGN(auto compressed, px::zlib::Deflate(input));
+  EXPECT_LT(compressed.size(), input.size());
+  EXPECT_OK_AND_EQ(px::zlib::Inflate(compressed), input);
+}
+
+TEST_F(ZlibTest, inflate_to_cap_full_stream) {
+  EXPECT_OK_AND_EQ(px::zlib::InflateToCap(GetCompressedString(), 16384), GetExpectedResult());
+}
+
+TEST_F(ZlibTest, inflate_to_cap_enforces_cap) {
+  std::string input(4096, 'a');
+  ASSERT_OK_AND_ASSIGN(auto compressed, px::zlib::Deflate(input));
+
+  ASSERT_OK_AND_ASSIGN(auto decompressed, px::zlib::InflateToCap(compressed, 100));
+  EXPECT_EQ(decompressed, input.substr(0, 100));
+}
+
+TEST_F(ZlibTest, inflate_to_cap_truncated_input_returns_prefix) {
+  std::string input(4096, 'a');
+  input += "some less compressible content 1234567890";
+  ASSERT_OK_AND_ASSIGN(auto compressed, px::zlib::Deflate(input));
+
+  // Chop off the tail of the compressed stream, as would happen with a capture size limit.
+  std::string_view truncated = std::string_view(compressed).substr(0, compressed.size() / 2);
+
+  ASSERT_OK_AND_ASSIGN(auto decompressed, px::zlib::InflateToCap(truncated, 16384));
+  EXPECT_EQ(decompressed, input.substr(0, decompressed.size()));
+}
+
 }  // namespace px
@@ -116,5 +116,107 @@ bool XXHash64BloomFilter::Contains(std::string_view item) const {
   return true;
 }
 
+StatusOr<std::unique_ptr<XXHash64CountingBloomFilter>> XXHash64CountingBloomFilter::Create(
+    int64_t max_entries, double error_rate) {
+  if (error_rate <= 0.0 || error_rate >= 1.0) {
+    return error::Internal(
+        "Bloom filter error rate must be greater than 0 and less than 1, received %e", error_rate);
+  }
+  if (max_entries <= 0) {
+    return error::Internal("Bloom filter must have a maximum of at least 1 entry, received %d",
+                           max_entries);
+  }
+
+  // Same sizing as XXHash64BloomFilter, with a counter per bit position.
+  double bpe = -(std::log(error_rate) / std::pow(std::log(2), 2));
+  int64_t num_bits = static_cast<int64_t>(std::ceil(max_entries * bpe));
+  // Round up to a multiple of 8 so positions match the bitset emitted by ToProto().
+  int64_t num_counters = ((num_bits + 7) / 8) * 8;
+
+  int32_t num_hashes = static_cast<int32_t>(std::ceil(std::log(2) * bpe));
+
+  return std::unique_ptr<XXHash64CountingBloomFilter>(
+      new XXHash64CountingBloomFilter(num_counters, num_hashes));
+}
+
+StatusOr<std::unique_ptr<XXHash64CountingBloomFilter>> XXHash64CountingBloomFilter::FromProto(
+    const XXHash64BloomFilterPB& pb) {
+  auto bytes_str = pb.data();
+
+  if (!bytes_str.size()) {
+    return error::Internal("Received 0 bytes in BloomFilter data field");
+  }
+  if (!pb.num_hashes()) {
+    return error::Internal("Received 0 hash functions in BloomFilter num_hashes field");
+  }
+
+  // The wire format only carries a bit per position, so counts are restored as 0/1. A filter
+  // restored from proto answers Contains() faithfully, but removals against it are best-effort.
+  auto filter = std::unique_ptr<XXHash64CountingBloomFilter>(
+      new XXHash64CountingBloomFilter(bytes_str.size() * 8, pb.num_hashes()));
+  for (size_t i = 0; i < filter->counters_.size(); ++i) {
+    if (static_cast<uint8_t>(bytes_str[i >> 3]) & (1 << (i % 8))) {
+      filter->counters_[i].store(1, std::memory_order_relaxed);
+    }
+  }
+  return filter;
+}
+
+XXHash64BloomFilterPB XXHash64CountingBloomFilter::ToProto() const {
+  XXHash64BloomFilterPB output;
+  output.set_num_hashes(num_hashes_);
+  std::string bytes_str(counters_.size() / 8, 0);
+  for (size_t i = 0; i < counters_.size(); ++i) {
+    if (counters_[i].load(std::memory_order_relaxed) != 0) {
+      bytes_str[i >> 3] |= (1 << (i % 8));
+    }
+  }
+  output.set_data(std::move(bytes_str));
+  return output;
+}
+
+void XXHash64CountingBloomFilter::Insert(std::string_view item) {
+  uint64_t a = XXH64(item.data(), item.size(), seed_);
+  uint64_t b = XXH64(item.data(), item.size(), a);
+
+  for (auto i = 0; i < num_hashes_; ++i) {
+    absl::uint128 x = a + i * b;
+    auto& counter = counters_[static_cast<size_t>(x % counters_.size())];
+    uint8_t val = counter.load(std::memory_order_relaxed);
+    // Saturated counters are pinned; see class comment.
+    while (val != kSaturatedCount &&
+           !counter.compare_exchange_weak(val, val + 1, std::memory_order_relaxed)) {
+    }
+  }
+}
+
+void XXHash64CountingBloomFilter::Remove(std::string_view item) {
+  uint64_t a = XXH64(item.data(), item.size(), seed_);
+  uint64_t b = XXH64(item.data(), item.size(), a);
+
+  for (auto i = 0; i < num_hashes_; ++i) {
+    absl::uint128 x = a + i * b;
+    auto& counter = counters_[static_cast<size_t>(x % counters_.size())];
+    uint8_t val = counter.load(std::memory_order_relaxed);
+    DCHECK_NE(static_cast<int>(val), 0) << "Removing an item that was not inserted";
+    while (val != 0 && val != kSaturatedCount &&
+           !counter.compare_exchange_weak(val, val - 1, std::memory_order_relaxed)) {
+    }
+  }
+}
+
+bool XXHash64CountingBloomFilter::Contains(std::string_view item) const {
+  uint64_t a = XXH64(item.data(), item.size(), seed_);
+  uint64_t b = XXH64(item.data(), item.size(), a);
+
+  for (auto i = 0; i < num_hashes_; ++i) {
+    absl::uint128 x = a + i * b;
+    if (counters_[static_cast<size_t>(x % counters_.size())].load(std::memory_order_relaxed) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace bloomfilter
 }  // namespace px
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <math.h>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -81,5 +82,75 @@ class XXHash64BloomFilter {
   const uint64_t seed_ = 3091990;
 };
 
+/**
+ * A counting variant of the XXHash64 bloom filter that also supports removal.
+ *
+ * Each position holds an 8-bit saturating counter instead of a single bit, so entries can be
+ * removed when the underlying object goes away and the false-positive rate no longer degrades
+ * monotonically with churn. Counters are atomic with relaxed ordering, which makes lookups safe
+ * to run concurrently with inserts and removals. A counter that saturates at 255 is pinned and
+ * never decremented again; this trades a permanently-set position for correctness, and is
+ * vanishingly rare at the sizing produced by Create().
+ *
+ * ToProto() collapses the counters to the bit-per-position XXHash64BloomFilterPB, so the
+ * serialized form stays wire-compatible with consumers of the plain bloom filter.
+ */
+class XXHash64CountingBloomFilter {
+ public:
+  /**
+   * Create creates a counting bloom filter sized for the given maximum number of entries and
+   * false positive error rate. The false negative error rate is always 0.
+   */
+  static StatusOr<std::unique_ptr<XXHash64CountingBloomFilter>> Create(int64_t max_entries,
+                                                                       double error_rate);
+  static StatusOr<std::unique_ptr<XXHash64CountingBloomFilter>> FromProto(
+      const XXHash64BloomFilterPB& pb);
+  XXHash64BloomFilterPB ToProto() const;
+
+  /**
+   * Insert inserts an item into the filter.
+   */
+  void Insert(std::string_view item);
+  void Insert(const std::string& item) { return Insert(std::string_view(item)); }
+
+  /**
+   * Remove removes one previously-inserted occurrence of an item from the filter.
+   * Removing an item that was never inserted can introduce false negatives and is a bug in the
+   * caller.
+   */
+  void Remove(std::string_view item);
+  void Remove(const std::string& item) { return Remove(std::string_view(item)); }
+
+  /**
+   * Contains checks for the presence of an item in the filter. May return a false positive,
+   * but will not return a false negative.
+   */
+  bool Contains(std::string_view item) const;
+  bool Contains(const std::string& item) const { return Contains(std::string_view(item)); }
+
+  /**
+   * Get the buffer size in bytes of the filter (one byte per counter).
+   */
+  size_t buffer_size_bytes() const { return counters_.size(); }
+
+  /**
+   * Get the number of hashes used in the filter.
+   */
+  int num_hashes() const { return num_hashes_; }
+
+ protected:
+  XXHash64CountingBloomFilter(int64_t num_counters, int32_t num_hashes)
+      : num_hashes_(num_hashes), counters_(num_counters) {}
+
+ private:
+  static constexpr uint8_t kSaturatedCount = 255;
+
+  const int num_hashes_;
+  // Value-initialized to zero. The counter count is kept a multiple of 8 so that the positions
+  // computed here match the ones computed against the bitset emitted by ToProto().
+  std::vector<std::atomic<uint8_t>> counters_;
+  const uint64_t seed_ = 3091990;
+};
+
 }  // namespace bloomfilter
 }  // namespace px
@@ -113,5 +113,65 @@ TEST(XXHash64BloomFilter, test_create_from_proto) {
   }
 }
 
+TEST(XXHash64CountingBloomFilter, test_insert_remove) {
+  auto bf = XXHash64CountingBloomFilter::Create(100, 0.01).ConsumeValueOrDie();
+  bf->Insert(std::string_view("foo"));
+  bf->Insert(std::string_view("bar"));
+  EXPECT_TRUE(bf->Contains(std::string_view("foo")));
+  EXPECT_TRUE(bf->Contains(std::string_view("bar")));
+
+  bf->Remove(std::string_view("foo"));
+  EXPECT_FALSE(bf->Contains(std::string_view("foo")));
+  EXPECT_TRUE(bf->Contains(std::string_view("bar")));
+
+  // An item inserted twice survives one removal.
+  bf->Insert(std::string("baz"));
+  bf->Insert(std::string("baz"));
+  bf->Remove(std::string("baz"));
+  EXPECT_TRUE(bf->Contains(std::string("baz")));
+  bf->Remove(std::string("baz"));
+  EXPECT_FALSE(bf->Contains(std::string("baz")));
+}
+
+TEST(XXHash64CountingBloomFilter, test_proto_wire_compatible) {
+  std::vector<std::string> matches{"foo", "bar", "abc"};
+  std::vector<std::string> non_matches{"123", "456", "789"};
+
+  auto bf = XXHash64CountingBloomFilter::Create(100000, 0.01).ConsumeValueOrDie();
+  for (const auto& match : matches) {
+    bf->Insert(match);
+  }
+  bf->Insert(std::string("removed"));
+  bf->Remove(std::string("removed"));
+
+  // The serialized form must be readable by the plain bloom filter with identical answers.
+  auto proto = bf->ToProto();
+  auto plain = XXHash64BloomFilter::FromProto(proto).ConsumeValueOrDie();
+  auto counting = XXHash64CountingBloomFilter::FromProto(proto).ConsumeValueOrDie();
+  EXPECT_EQ(plain->num_hashes(), bf->num_hashes());
+  for (const auto& match : matches) {
+    EXPECT_TRUE(plain->Contains(match));
+    EXPECT_TRUE(counting->Contains(match));
+  }
+  for (const auto& non_match : non_matches) {
+    EXPECT_FALSE(plain->Contains(non_match));
+    EXPECT_FALSE(counting->Contains(non_match));
+  }
+  EXPECT_FALSE(plain->Contains(std::string("removed")));
+}
+
+TEST(XXHash64CountingBloomFilter, test_saturation_pins_counter) {
+  auto bf = XXHash64CountingBloomFilter::Create(1000, 0.01).ConsumeValueOrDie();
+  // Push a counter past saturation; the item must never produce a false negative afterwards,
+  // even with more removals than the saturated counter can account for.
+  for (int i = 0; i < 300; ++i) {
+    bf->Insert(std::string_view("hot"));
+  }
+  for (int i = 0; i < 300; ++i) {
+    bf->Remove(std::string_view("hot"));
+  }
+  EXPECT_TRUE(bf->Contains(std::string_view("hot")));
+}
+
 }  // namespace bloomfilter
 }  // namespace px
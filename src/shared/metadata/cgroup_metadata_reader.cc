@@ -16,7 +16,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <sys/inotify.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -33,6 +38,14 @@ CGroupMetadataReader::CGroupMetadataReader(const system::Config& cfg)
     : CGroupMetadataReader(cfg.sysfs_path().string()) {}
 
 CGroupMetadataReader::CGroupMetadataReader(std::string sysfs_path) {
+  inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_fd_ == -1) {
+    LOG(WARNING) << absl::Substitute(
+        "Failed to initialize inotify; falling back to re-reading cgroup PID files every cycle "
+        "[error = $0]",
+        std::strerror(errno));
+  }
+
   // Create the new path resolver.
   auto path_resolver_or_status = CGroupPathResolver::Create(sysfs_path);
   path_resolver_ = path_resolver_or_status.ConsumeValueOr(nullptr);
@@ -72,16 +85,115 @@ StatusOr<std::string> CGroupMetadataReader::PodPath(PodQOSClass qos_class, std::
   return error::Internal("No valid cgroup path resolver.");
 }
 
+CGroupMetadataReader::~CGroupMetadataReader() {
+  if (inotify_fd_ != -1) {
+    // Closing the inotify fd also removes all associated watches.
+    close(inotify_fd_);
+  }
+}
+
 Status CGroupMetadataReader::ReadPIDs(PodQOSClass qos_class, std::string_view pod_id,
                                       std::string_view container_id, ContainerType container_type,
                                       absl::flat_hash_set<uint32_t>* pid_set) const {
   CHECK(pid_set != nullptr);
 
+  PL_ASSIGN_OR_RETURN(std::string fpath, PodPath(qos_class, pod_id, container_id, container_type));
+
+  if (inotify_fd_ == -1) {
+    return ReadPIDsFromFile(fpath, pid_set);
+  }
+
+  DrainInotifyEvents();
+
+  int64_t now = CurrentTimeNS();
+  auto it = pid_cache_.find(fpath);
+  if (it != pid_cache_.end() &&
+      now - it->second.last_read_ns < kPIDCacheReconciliationPeriodNS) {
+    pid_set->insert(it->second.pids.begin(), it->second.pids.end());
+    return Status::OK();
+  }
+
+  absl::flat_hash_set<uint32_t> pids;
+  Status s = ReadPIDsFromFile(fpath, &pids);
+  if (!s.ok()) {
+    EraseCacheEntry(fpath);
+    return s;
+  }
+  pid_set->insert(pids.begin(), pids.end());
+
+  // Watch the container's cgroup directory so pod/container churn (directory create/remove)
+  // invalidates the cached set immediately. Re-adding a watch on the same path is idempotent.
+  std::string dir = fpath.substr(0, fpath.rfind('/'));
+  int wd = inotify_add_watch(inotify_fd_, dir.c_str(),
+                             IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MOVE);
+  if (wd == -1) {
+    // Without a watch we cannot see churn, so don't serve this path from the cache.
+    EraseCacheEntry(fpath);
+    return Status::OK();
+  }
+
+  auto& entry = pid_cache_[fpath];
+  if (entry.wd != -1 && entry.wd != wd) {
+    // The directory was recreated under a new watch descriptor.
+    cache_keys_by_wd_.erase(entry.wd);
+  }
+  entry.pids = std::move(pids);
+  entry.wd = wd;
+  entry.last_read_ns = now;
+  cache_keys_by_wd_[wd] = fpath;
+  return Status::OK();
+}
+
+void CGroupMetadataReader::EraseCacheEntry(const std::string& fpath) const {
+  auto it = pid_cache_.find(fpath);
+  if (it == pid_cache_.end()) {
+    return;
+  }
+  if (it->second.wd != -1) {
+    cache_keys_by_wd_.erase(it->second.wd);
+    inotify_rm_watch(inotify_fd_, it->second.wd);
+  }
+  pid_cache_.erase(it);
+}
+
+void CGroupMetadataReader::DrainInotifyEvents() const {
+  alignas(struct inotify_event) char buf[4096];
+  while (true) {
+    ssize_t n = read(inotify_fd_, buf, sizeof(buf));
+    if (n <= 0) {
+      // EAGAIN: no pending events.
+      return;
+    }
+    ssize_t offset = 0;
+    while (offset < n) {
+      const auto* event = reinterpret_cast<const struct inotify_event*>(buf + offset);
+      auto it = cache_keys_by_wd_.find(event->wd);
+      if (it != cache_keys_by_wd_.end()) {
+        if (event->mask & (IN_DELETE_SELF | IN_IGNORED)) {
+          // The kernel has already dropped the watch; remove our bookkeeping with it.
+          auto cache_it = pid_cache_.find(it->second);
+          if (cache_it != pid_cache_.end()) {
+            pid_cache_.erase(cache_it);
+          }
+          cache_keys_by_wd_.erase(it);
+        } else {
+          // Mark stale; the next ReadPIDs for this container re-reads the file.
+          auto cache_it = pid_cache_.find(it->second);
+          if (cache_it != pid_cache_.end()) {
+            cache_it->second.last_read_ns = 0;
+          }
+        }
+      }
+      offset += sizeof(struct inotify_event) + event->len;
+    }
+  }
+}
+
+Status CGroupMetadataReader::ReadPIDsFromFile(const std::string& fpath,
+                                              absl::flat_hash_set<uint32_t>* pid_set) const {
   // The container files need to be recursively read and the PIDs needs be merge across all
   // containers.
 
-  PL_ASSIGN_OR_RETURN(std::string fpath, PodPath(qos_class, pod_id, container_id, container_type));
-
   std::ifstream ifs(fpath);
   if (!ifs) {
     // This might not be a real error since the pod could have disappeared.
@@ -25,6 +25,9 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
 #include "src/common/base/base.h"
 #include "src/common/system/system.h"
 #include "src/shared/metadata/cgroup_path_resolver.h"
@@ -36,11 +39,16 @@ namespace md {
 /**
  * CGroupMetadataReader is responsible for reading metadata such as process info from
  * sys/fs and proc.
+ *
+ * PID sets are cached per container and invalidated by inotify events on the container's cgroup
+ * directory, so steady-state metadata cycles avoid re-parsing every cgroup.procs file. Processes
+ * that come and go without touching the cgroup hierarchy (plain fork/exit inside a container)
+ * generate no events, so cached entries are also re-read after a reconciliation period.
  */
 class CGroupMetadataReader : public NotCopyable {
  public:
   CGroupMetadataReader() = delete;
-  virtual ~CGroupMetadataReader() = default;
+  virtual ~CGroupMetadataReader();
 
   explicit CGroupMetadataReader(const system::Config& cfg);
   explicit CGroupMetadataReader(std::string sysfs_path);
@@ -56,11 +64,33 @@ class CGroupMetadataReader : public NotCopyable {
                           absl::flat_hash_set<uint32_t>* pid_set) const;
 
  private:
+  // Upper bound on how stale a cached PID set may get before it is re-read, which also bounds
+  // how late a process forked inside an unchanged cgroup is discovered.
+  static constexpr int64_t kPIDCacheReconciliationPeriodNS = 5 * 1000 * 1000 * 1000LL;
+
+  struct PIDCacheEntry {
+    absl::flat_hash_set<uint32_t> pids;
+    int wd = -1;
+    int64_t last_read_ns = 0;
+  };
+
   StatusOr<std::string> PodPath(PodQOSClass qos_class, std::string_view pod_id,
                                 std::string_view container_id, ContainerType container_type) const;
 
+  Status ReadPIDsFromFile(const std::string& fpath, absl::flat_hash_set<uint32_t>* pid_set) const;
+
+  // Consumes pending inotify events and marks the affected cache entries for re-read.
+  void DrainInotifyEvents() const;
+  void EraseCacheEntry(const std::string& fpath) const;
+
   std::unique_ptr<LegacyCGroupPathResolver> legacy_path_resolver_;
   std::unique_ptr<CGroupPathResolver> path_resolver_;
+
+  // PID cache state. Mutated from the (single) metadata thread only; mutable because ReadPIDs is
+  // logically const.
+  int inotify_fd_ = -1;
+  mutable absl::flat_hash_map<std::string, PIDCacheEntry> pid_cache_;
+  mutable absl::flat_hash_map<int, std::string> cache_keys_by_wd_;
 };
 
 }  // namespace md
@@ -17,8 +17,11 @@
  */
 #include "src/shared/metadata/cgroup_metadata_reader.h"
 
+#include <filesystem>
+
 #include <absl/container/flat_hash_set.h>
 
+#include "src/common/base/file.h"
 #include "src/common/testing/testing.h"
 
 namespace px {
@@ -43,5 +46,35 @@ TEST_F(CGroupMetadataReaderTest, read_pid_list) {
   EXPECT_THAT(pid_set, ::testing::UnorderedElementsAre(123, 456, 789));
 }
 
+TEST(CGroupMetadataReaderPIDCacheTest, cache_serves_and_invalidates) {
+  ::px::testing::TempDir tmp_dir;
+  std::filesystem::path cgroup_dir =
+      tmp_dir.path() / "cgroup/cpu,cpuacct/kubepods/besteffort/podabcd/c123";
+  ASSERT_TRUE(std::filesystem::create_directories(cgroup_dir));
+  ASSERT_OK(WriteFileFromString(cgroup_dir / "cgroup.procs", "100\n200\n"));
+
+  CGroupMetadataReader md_reader(tmp_dir.path().string());
+
+  absl::flat_hash_set<uint32_t> pid_set;
+  ASSERT_OK(md_reader.ReadPIDs(PodQOSClass::kBestEffort, "abcd", "c123", ContainerType::kDocker,
+                               &pid_set));
+  EXPECT_THAT(pid_set, ::testing::UnorderedElementsAre(100, 200));
+
+  // Rewriting the PID file generates no watched cgroup event, so the cached set is served until
+  // the reconciliation period elapses.
+  ASSERT_OK(WriteFileFromString(cgroup_dir / "cgroup.procs", "100\n200\n300\n"));
+  pid_set.clear();
+  ASSERT_OK(md_reader.ReadPIDs(PodQOSClass::kBestEffort, "abcd", "c123", ContainerType::kDocker,
+                               &pid_set));
+  EXPECT_THAT(pid_set, ::testing::UnorderedElementsAre(100, 200));
+
+  // Creating an entry in the container's cgroup directory invalidates the cache.
+  ASSERT_OK(WriteFileFromString(cgroup_dir / "tasks", "100\n"));
+  pid_set.clear();
+  ASSERT_OK(md_reader.ReadPIDs(PodQOSClass::kBestEffort, "abcd", "c123", ContainerType::kDocker,
+                               &pid_set));
+  EXPECT_THAT(pid_set, ::testing::UnorderedElementsAre(100, 200, 300));
+}
+
 }  // namespace md
 }  // namespace px
@@ -28,6 +28,7 @@
 #include <absl/container/flat_hash_set.h>
 #include "src/common/base/base.h"
 #include "src/shared/k8s/metadatapb/metadata.pb.h"
+#include "src/shared/metadata/string_pool.h"
 #include "src/shared/upid/upid.h"
 
 namespace px {
@@ -65,8 +66,9 @@ class K8sMetadataObject {
                     int64_t start_time_ns = 0, int64_t stop_time_ns = 0)
       : type_(type),
         uid_(std::move(uid)),
-        ns_(ns),
-        name_(name),
+        ns_(&StringPool::GetInstance().Intern(ns)),
+        name_(&StringPool::GetInstance().Intern(name)),
+        ns_and_name_(&StringPool::GetInstance().Intern(absl::Substitute("$0/$1", ns, name))),
         start_time_ns_(start_time_ns),
         stop_time_ns_(stop_time_ns) {}
 
@@ -74,8 +76,12 @@ class K8sMetadataObject {
 
   const UID& uid() const { return uid_; }
 
-  const std::string& name() const { return name_; }
-  const std::string& ns() const { return ns_; }
+  const std::string& name() const { return *name_; }
+  const std::string& ns() const { return *ns_; }
+
+  // Pre-interned "<namespace>/<name>", so per-row consumers (e.g. metadata UDFs) can return the
+  // qualified name without re-formatting it each time.
+  const std::string& ns_and_name() const { return *ns_and_name_; }
 
   int64_t start_time_ns() const { return start_time_ns_; }
   void set_start_time_ns(int64_t start_time_ns) { start_time_ns_ = start_time_ns; }
@@ -108,15 +114,19 @@ class K8sMetadataObject {
   const UID uid_ = 0;
 
   /**
-   * The namespace for this object.
+   * The namespace for this object. Interned in the StringPool; the pointee outlives this object.
    */
+  const std::string* ns_;
 
-  std::string ns_;
+  /**
+   * The name which is unique in space but not time. Interned in the StringPool.
+   */
+  const std::string* name_;
 
   /**
-   * The name which is unique in space but not time.
+   * Pre-interned "<namespace>/<name>" of this object.
    */
-  std::string name_;
+  const std::string* ns_and_name_;
 
   /**
    * Start time of this K8s object.
@@ -283,11 +293,12 @@ class PodInfo : public K8sMetadataObject {
         qos_class_(qos_class),
         phase_(phase),
         conditions_(conditions),
-        phase_message_(phase_message),
-        phase_reason_(phase_reason),
-        node_name_(node_name),
-        hostname_(hostname),
-        pod_ip_(pod_ip) {}
+        phase_message_(&StringPool::GetInstance().Intern(phase_message)),
+        phase_reason_(&StringPool::GetInstance().Intern(phase_reason)),
+        node_name_(&StringPool::GetInstance().Intern(node_name)),
+        hostname_(&StringPool::GetInstance().Intern(hostname)),
+        pod_ip_(pod_ip),
+        labels_(&StringPool::GetInstance().Intern("")) {}
 
   explicit PodInfo(const px::shared::k8s::metadatapb::PodUpdate& pod_update_info)
       : PodInfo(pod_update_info.uid(), pod_update_info.namespace_(), pod_update_info.name(),
@@ -313,21 +324,30 @@ class PodInfo : public K8sMetadataObject {
   PodConditions conditions() const { return conditions_; }
   void set_conditions(PodConditions conditions) { conditions_ = conditions; }
 
-  const std::string& phase_message() const { return phase_message_; }
-  void set_phase_message(std::string_view phase_message) { phase_message_ = phase_message; }
+  const std::string& phase_message() const { return *phase_message_; }
+  void set_phase_message(std::string_view phase_message) {
+    phase_message_ = &StringPool::GetInstance().Intern(phase_message);
+  }
 
-  const std::string& phase_reason() const { return phase_reason_; }
-  void set_phase_reason(std::string_view phase_reason) { phase_reason_ = phase_reason; }
+  const std::string& phase_reason() const { return *phase_reason_; }
+  void set_phase_reason(std::string_view phase_reason) {
+    phase_reason_ = &StringPool::GetInstance().Intern(phase_reason);
+  }
 
-  void set_node_name(std::string_view node_name) { node_name_ = node_name; }
-  void set_hostname(std::string_view hostname) { hostname_ = hostname; }
+  void set_node_name(std::string_view node_name) {
+    node_name_ = &StringPool::GetInstance().Intern(node_name);
+  }
+  void set_hostname(std::string_view hostname) {
+    hostname_ = &StringPool::GetInstance().Intern(hostname);
+  }
   void set_pod_ip(std::string_view pod_ip) { pod_ip_ = pod_ip; }
-  void set_pod_labels(std::string labels) { labels_ = labels; }
+  // Label sets repeat across the replicas of a replica set, so they are interned as well.
+  void set_pod_labels(std::string labels) { labels_ = &StringPool::GetInstance().Intern(labels); }
 
-  const std::string& node_name() const { return node_name_; }
-  const std::string& hostname() const { return hostname_; }
+  const std::string& node_name() const { return *node_name_; }
+  const std::string& hostname() const { return *hostname_; }
   const std::string& pod_ip() const { return pod_ip_; }
-  const std::string& labels() const { return labels_; }
+  const std::string& labels() const { return *labels_; }
 
   const absl::flat_hash_set<std::string>& containers() const { return containers_; }
   const absl::flat_hash_set<std::string>& services() const { return services_; }
@@ -346,10 +366,11 @@ class PodInfo : public K8sMetadataObject {
   PodQOSClass qos_class_;
   PodPhase phase_;
   PodConditions conditions_;
-  // The message for why the pod is in its current status.
-  std::string phase_message_;
-  // A brief CamelCase message indicating details about why the pod is in this state.
-  std::string phase_reason_;
+  // The message for why the pod is in its current status. Interned in the StringPool, since
+  // these messages are low-cardinality and repeat across pods.
+  const std::string* phase_message_;
+  // A brief CamelCase message indicating details about why the pod is in this state. Interned.
+  const std::string* phase_reason_;
   /**
    * Set of containers that are running on this pod.
    *
@@ -364,10 +385,12 @@ class PodInfo : public K8sMetadataObject {
    */
   absl::flat_hash_set<UID> services_;
 
-  std::string node_name_;
-  std::string hostname_;
+  // Node name and hostname are shared by every pod on the node, and label sets repeat across
+  // replicas, so all three are interned. The pod IP is unique per pod and stays owned.
+  const std::string* node_name_;
+  const std::string* hostname_;
   std::string pod_ip_;
-  std::string labels_;
+  const std::string* labels_;
 };
 
 struct UPIDStartTSCompare {
@@ -397,11 +420,11 @@ class ContainerInfo {
                 std::string_view state_message, std::string_view state_reason,
                 int64_t start_time_ns, int64_t stop_time_ns = 0)
       : cid_(std::move(cid)),
-        name_(std::string(name)),
+        name_(&StringPool::GetInstance().Intern(name)),
         state_(state),
         type_(type),
-        state_message_(state_message),
-        state_reason_(state_reason),
+        state_message_(&StringPool::GetInstance().Intern(state_message)),
+        state_reason_(&StringPool::GetInstance().Intern(state_reason)),
         start_time_ns_(start_time_ns),
         stop_time_ns_(stop_time_ns) {}
 
@@ -414,7 +437,7 @@ class ContainerInfo {
                       container_update_info.stop_timestamp_ns()) {}
 
   const CID& cid() const { return cid_; }
-  const std::string& name() const { return name_; }
+  const std::string& name() const { return *name_; }
   ContainerType type() const { return type_; }
 
   void set_pod_id(std::string_view pod_id) { pod_id_ = pod_id; }
@@ -431,11 +454,15 @@ class ContainerInfo {
   ContainerState state() const { return state_; }
   void set_state(ContainerState state) { state_ = state; }
 
-  const std::string& state_message() const { return state_message_; }
-  void set_state_message(std::string_view state_message) { state_message_ = state_message; }
+  const std::string& state_message() const { return *state_message_; }
+  void set_state_message(std::string_view state_message) {
+    state_message_ = &StringPool::GetInstance().Intern(state_message);
+  }
 
-  const std::string& state_reason() const { return state_reason_; }
-  void set_state_reason(std::string_view state_reason) { state_reason_ = state_reason; }
+  const std::string& state_reason() const { return *state_reason_; }
+  void set_state_reason(std::string_view state_reason) {
+    state_reason_ = &StringPool::GetInstance().Intern(state_reason);
+  }
 
   std::unique_ptr<ContainerInfo> Clone() const {
     return std::unique_ptr<ContainerInfo>(new ContainerInfo(*this));
@@ -449,7 +476,8 @@ class ContainerInfo {
 
  private:
   const CID cid_;
-  const std::string name_;
+  // Interned in the StringPool; container names repeat heavily across pods.
+  const std::string* name_;
   UID pod_id_ = "";
 
   /**
@@ -465,10 +493,11 @@ class ContainerInfo {
    * Type of the container, such as DOCKER, CRIO.
    */
   ContainerType type_;
-  // The message for why the container is in its current state.
-  std::string state_message_;
-  // A more detailed message for why the container is in its current state.
-  std::string state_reason_;
+  // The message for why the container is in its current state. Interned in the StringPool,
+  // since these messages are low-cardinality and repeat across containers.
+  const std::string* state_message_;
+  // A more detailed message for why the container is in its current state. Interned.
+  const std::string* state_reason_;
 
   /**
    * Start time of this K8s object.
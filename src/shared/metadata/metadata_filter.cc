@@ -55,6 +55,15 @@ Status AgentMetadataFilter::InsertEntity(MetadataType key, std::string_view valu
   return Status::OK();
 }
 
+Status AgentMetadataFilter::RemoveEntity(MetadataType key, std::string_view value) {
+  epoch_id_++;
+  if (!metadata_types_.contains(key)) {
+    return error::Internal("Metadata type $0 is not registered in AgentMetadataFilter.", key);
+  }
+  Remove(ToEntityKeyPair(key, value));
+  return Status::OK();
+}
+
 bool AgentMetadataFilter::ContainsEntity(MetadataType key, std::string_view value) const {
   if (!metadata_types_.contains(key)) {
     return false;
@@ -72,6 +81,8 @@ MetadataInfo AgentMetadataFilter::ToProto() {
 
 void AgentMetadataFilterImpl::Insert(std::string_view val) { bloomfilter_->Insert(val); }
 
+void AgentMetadataFilterImpl::Remove(std::string_view val) { bloomfilter_->Remove(val); }
+
 bool AgentMetadataFilterImpl::Contains(std::string_view val) const {
   return bloomfilter_->Contains(val);
 }
@@ -85,7 +96,8 @@ MetadataInfo AgentMetadataFilterImpl::ToProtoImpl() const {
 StatusOr<std::unique_ptr<AgentMetadataFilter>> AgentMetadataFilterImpl::FromProto(
     const MetadataInfo& proto) {
   DCHECK_EQ(proto.filter_case(), MetadataInfo::FilterCase::kXxhash64BloomFilter);
-  PL_ASSIGN_OR_RETURN(auto bf, XXHash64BloomFilter::FromProto(proto.xxhash64_bloom_filter()));
+  PL_ASSIGN_OR_RETURN(auto bf,
+                      XXHash64CountingBloomFilter::FromProto(proto.xxhash64_bloom_filter()));
   absl::flat_hash_set<MetadataType> types;
   for (auto i = 0; i < proto.metadata_fields_size(); ++i) {
     types.insert(proto.metadata_fields(i));
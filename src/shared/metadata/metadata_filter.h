@@ -34,6 +34,7 @@ namespace px {
 namespace md {
 
 using bloomfilter::XXHash64BloomFilter;
+using bloomfilter::XXHash64CountingBloomFilter;
 using carnot::planner::distributedpb::MetadataInfo;
 using shared::metadatapb::MetadataType;
 using shared::metadatapb::MetadataType_Name;
@@ -74,6 +75,12 @@ class AgentMetadataFilter {
    */
   Status InsertEntity(MetadataType key, std::string_view value);
 
+  /**
+   * Remove a previously-inserted metadata entity by key and value from the filter.
+   * This keeps the false-positive rate from degrading with pod churn on long-lived agents.
+   */
+  Status RemoveEntity(MetadataType key, std::string_view value);
+
   /**
    * Check whether the filter contains a particular key/value pair.
    */
@@ -88,6 +95,7 @@ class AgentMetadataFilter {
 
  protected:
   virtual void Insert(std::string_view value) = 0;
+  virtual void Remove(std::string_view value) = 0;
   virtual bool Contains(std::string_view value) const = 0;
 
   /**
@@ -102,13 +110,15 @@ class AgentMetadataFilter {
 };
 
 /**
- * An implementation of AgentMetadataFilter backed by an XXHASH64-based bloom filter.
+ * An implementation of AgentMetadataFilter backed by an XXHASH64-based counting bloom filter.
+ * The counting filter supports removal, and still serializes to the plain bloom filter proto
+ * for the filter-update protocol.
  */
 class AgentMetadataFilterImpl : public AgentMetadataFilter {
  public:
   static StatusOr<std::unique_ptr<AgentMetadataFilter>> Create(
       int64_t max_entries, double error_rate, const absl::flat_hash_set<MetadataType>& types) {
-    PL_ASSIGN_OR_RETURN(auto bf, XXHash64BloomFilter::Create(max_entries, error_rate));
+    PL_ASSIGN_OR_RETURN(auto bf, XXHash64CountingBloomFilter::Create(max_entries, error_rate));
     return std::unique_ptr<AgentMetadataFilter>(new AgentMetadataFilterImpl(std::move(bf), types));
   }
 
@@ -116,15 +126,16 @@ class AgentMetadataFilterImpl : public AgentMetadataFilter {
 
  protected:
   void Insert(std::string_view entity) override;
+  void Remove(std::string_view entity) override;
   bool Contains(std::string_view entity) const override;
   MetadataInfo ToProtoImpl() const override;
 
  private:
-  AgentMetadataFilterImpl(std::unique_ptr<XXHash64BloomFilter> bloomfilter,
+  AgentMetadataFilterImpl(std::unique_ptr<XXHash64CountingBloomFilter> bloomfilter,
                           const absl::flat_hash_set<MetadataType>& types)
       : AgentMetadataFilter(types), bloomfilter_(std::move(bloomfilter)) {}
 
-  std::unique_ptr<XXHash64BloomFilter> bloomfilter_;
+  std::unique_ptr<XXHash64CountingBloomFilter> bloomfilter_;
 };
 
 }  // namespace md
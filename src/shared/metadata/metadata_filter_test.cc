@@ -43,6 +43,23 @@ TEST(AgentMetadataFilter, test_basic) {
   EXPECT_NOT_OK(filter->InsertEntity(MetadataType::SERVICE_NAME, "abc"));
 }
 
+TEST(AgentMetadataFilter, test_remove) {
+  auto filter =
+      AgentMetadataFilter::Create(100, 0.01, {MetadataType::POD_NAME, MetadataType::CONTAINER_ID})
+          .ConsumeValueOrDie();
+
+  EXPECT_OK(filter->InsertEntity(MetadataType::POD_NAME, "foo"));
+  EXPECT_OK(filter->InsertEntity(MetadataType::POD_NAME, "bar"));
+  int64_t epoch_before_remove = filter->epoch_id();
+
+  EXPECT_OK(filter->RemoveEntity(MetadataType::POD_NAME, "foo"));
+  EXPECT_FALSE(filter->ContainsEntity(MetadataType::POD_NAME, "foo"));
+  EXPECT_TRUE(filter->ContainsEntity(MetadataType::POD_NAME, "bar"));
+  EXPECT_GT(filter->epoch_id(), epoch_before_remove);
+
+  EXPECT_NOT_OK(filter->RemoveEntity(MetadataType::SERVICE_NAME, "abc"));
+}
+
 TEST(AgentMetadataFilter, test_proto) {
   auto filter =
       AgentMetadataFilter::Create(100, 0.01, {MetadataType::POD_NAME, MetadataType::CONTAINER_ID})
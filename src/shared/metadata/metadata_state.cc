@@ -22,6 +22,7 @@
 
 #include <absl/container/flat_hash_set.h>
 
+#include "src/shared/metadata/metadata_filter.h"
 #include "src/shared/metadata/metadata_state.h"
 
 namespace px {
@@ -93,6 +94,17 @@ UID K8sMetadataState::ServiceIDByClusterIP(std::string_view cluster_ip) const {
   return (it == services_by_cluster_ip_.end()) ? "" : it->second;
 }
 
+ContainerInfo* K8sMetadataState::MutableContainerInfoByID(CIDView id) {
+  auto it = containers_by_id_.find(id);
+
+  if (it == containers_by_id_.end()) {
+    return nullptr;
+  }
+
+  ++sequence_number_;
+  return internal::CopyForWrite(&it->second);
+}
+
 CID K8sMetadataState::ContainerIDByName(std::string_view container_name) const {
   auto it = containers_by_name_.find(container_name);
   return (it == containers_by_name_.end()) ? "" : it->second;
@@ -124,15 +136,11 @@ std::unique_ptr<K8sMetadataState> K8sMetadataState::Clone() const {
   other->pod_cidrs_ = pod_cidrs_;
   other->service_cidr_ = service_cidr_;
 
-  other->k8s_objects_by_id_.reserve(k8s_objects_by_id_.size());
-  for (const auto& [k, v] : k8s_objects_by_id_) {
-    other->k8s_objects_by_id_[k] = v->Clone();
-  }
-
-  other->containers_by_id_.reserve(containers_by_id_.size());
-  for (const auto& [k, v] : containers_by_id_) {
-    other->containers_by_id_[k] = v->Clone();
-  }
+  // The object maps are copy-on-write: only the map structure is copied here, and the stored
+  // objects are shared with this state. Mutators clone individual objects before modifying
+  // them, so update cost scales with churn rather than cluster size.
+  other->k8s_objects_by_id_ = k8s_objects_by_id_;
+  other->containers_by_id_ = containers_by_id_;
 
   other->pods_by_name_ = pods_by_name_;
   other->services_by_name_ = services_by_name_;
@@ -142,6 +150,7 @@ std::unique_ptr<K8sMetadataState> K8sMetadataState::Clone() const {
   other->containers_by_name_ = containers_by_name_;
   other->pods_by_ip_ = pods_by_ip_;
   other->services_by_cluster_ip_ = services_by_cluster_ip_;
+  other->sequence_number_ = sequence_number_;
 
   return other;
 }
@@ -178,6 +187,7 @@ std::string K8sMetadataState::DebugString(int indent_level) const {
 }
 
 Status K8sMetadataState::HandlePodUpdate(const PodUpdate& update) {
+  ++sequence_number_;
   const UID& object_uid = update.uid();
   const std::string& name = update.name();
   const std::string& ns = update.namespace_();
@@ -188,7 +198,7 @@ Status K8sMetadataState::HandlePodUpdate(const PodUpdate& update) {
     VLOG(1) << "Adding Pod: " << pod->DebugString();
     it = k8s_objects_by_id_.try_emplace(object_uid, std::move(pod)).first;
   }
-  auto pod_info = static_cast<PodInfo*>(it->second.get());
+  auto pod_info = static_cast<PodInfo*>(internal::CopyForWrite(&it->second));
 
   // We always just add to the container set even if the container is stopped.
   // We expect all cleanup to happen periodically to allow stale objects to be queried for some
@@ -197,7 +207,8 @@ Status K8sMetadataState::HandlePodUpdate(const PodUpdate& update) {
   // state might be periodically inconsistent.
 
   for (const auto& cid : update.container_ids()) {
-    if (containers_by_id_.find(cid) == containers_by_id_.end()) {
+    auto c_it = containers_by_id_.find(cid);
+    if (c_it == containers_by_id_.end()) {
       // We should be resilient to the case where we happened to miss a pod update
       // in the stream of events. If we did miss a pod update, just skip adding the
       // pod to this particular service to avoid dangling references.
@@ -206,7 +217,7 @@ Status K8sMetadataState::HandlePodUpdate(const PodUpdate& update) {
     }
 
     pod_info->AddContainer(cid);
-    containers_by_id_[cid]->set_pod_id(object_uid);
+    internal::CopyForWrite(&c_it->second)->set_pod_id(object_uid);
   }
 
   for (const auto& owner_ref : update.owner_references()) {
@@ -234,6 +245,7 @@ Status K8sMetadataState::HandlePodUpdate(const PodUpdate& update) {
 }
 
 Status K8sMetadataState::HandleContainerUpdate(const ContainerUpdate& update) {
+  ++sequence_number_;
   const CID& cid = update.cid();
 
   auto it = containers_by_id_.find(cid);
@@ -244,7 +256,7 @@ Status K8sMetadataState::HandleContainerUpdate(const ContainerUpdate& update) {
   }
   VLOG(1) << "container update: " << update.name();
 
-  auto* container_info = it->second.get();
+  auto* container_info = internal::CopyForWrite(&it->second);
   container_info->set_stop_time_ns(update.stop_timestamp_ns());
   container_info->set_state(ConvertToContainerState(update.container_state()));
   container_info->set_state_message(update.message());
@@ -256,6 +268,7 @@ Status K8sMetadataState::HandleContainerUpdate(const ContainerUpdate& update) {
 }
 
 Status K8sMetadataState::HandleServiceUpdate(const ServiceUpdate& update) {
+  ++sequence_number_;
   const UID& service_uid = update.uid();
   const std::string& name = update.name();
   const std::string& ns = update.namespace_();
@@ -266,19 +279,20 @@ Status K8sMetadataState::HandleServiceUpdate(const ServiceUpdate& update) {
     VLOG(1) << "Adding Service: " << service->DebugString();
     it = k8s_objects_by_id_.try_emplace(service_uid, std::move(service)).first;
   }
-  auto service_info = static_cast<ServiceInfo*>(it->second.get());
+  auto service_info = static_cast<ServiceInfo*>(internal::CopyForWrite(&it->second));
 
   for (const auto& uid : update.pod_ids()) {
-    if (k8s_objects_by_id_.find(uid) == k8s_objects_by_id_.end()) {
+    auto pod_it = k8s_objects_by_id_.find(uid);
+    if (pod_it == k8s_objects_by_id_.end()) {
       // We should be resilient to the case where we happened to miss a pod update
       // in the stream of events. If we did miss a pod update, just skip adding the
       // pod to this particular service to avoid dangling references.
       LOG(INFO) << absl::Substitute("Didn't find pod UID $0 for service $1/$2", uid, ns, name);
       continue;
     }
-    ECHECK(k8s_objects_by_id_[uid]->type() == K8sObjectType::kPod);
+    ECHECK(pod_it->second->type() == K8sObjectType::kPod);
     // We add the service uid to the pod. Lifetime of service still handled by the service object.
-    PodInfo* pod_info = static_cast<PodInfo*>(k8s_objects_by_id_[uid].get());
+    PodInfo* pod_info = static_cast<PodInfo*>(internal::CopyForWrite(&pod_it->second));
     pod_info->AddService(service_uid);
   }
   if (update.start_timestamp_ns() != 0) {
@@ -303,6 +317,7 @@ Status K8sMetadataState::HandleServiceUpdate(const ServiceUpdate& update) {
 }
 
 Status K8sMetadataState::HandleNamespaceUpdate(const NamespaceUpdate& update) {
+  ++sequence_number_;
   const UID& namespace_uid = update.uid();
   const std::string& name = update.name();
   const std::string& ns = update.name();
@@ -313,7 +328,7 @@ Status K8sMetadataState::HandleNamespaceUpdate(const NamespaceUpdate& update) {
     VLOG(1) << "Adding Namespace: " << ns_obj->DebugString();
     it = k8s_objects_by_id_.try_emplace(namespace_uid, std::move(ns_obj)).first;
   }
-  auto ns_info = static_cast<NamespaceInfo*>(it->second.get());
+  auto ns_info = static_cast<NamespaceInfo*>(internal::CopyForWrite(&it->second));
 
   ns_info->set_start_time_ns(update.start_timestamp_ns());
   ns_info->set_stop_time_ns(update.stop_timestamp_ns());
@@ -325,6 +340,7 @@ Status K8sMetadataState::HandleNamespaceUpdate(const NamespaceUpdate& update) {
 }
 
 Status K8sMetadataState::HandleNodeUpdate(const NodeUpdate& update) {
+  ++sequence_number_;
   // We currently do not use node updates in the PEM.
   VLOG(1) << "node update: " << update.name();
 
@@ -332,6 +348,7 @@ Status K8sMetadataState::HandleNodeUpdate(const NodeUpdate& update) {
 }
 
 Status K8sMetadataState::HandleReplicaSetUpdate(const ReplicaSetUpdate& update) {
+  ++sequence_number_;
   const UID& replica_set_uid = update.uid();
   const std::string& name = update.name();
   const std::string& ns = update.namespace_();
@@ -342,7 +359,7 @@ Status K8sMetadataState::HandleReplicaSetUpdate(const ReplicaSetUpdate& update)
     VLOG(1) << "Adding ReplicaSet: " << replica_set->DebugString();
     it = k8s_objects_by_id_.try_emplace(replica_set_uid, std::move(replica_set)).first;
   }
-  auto replica_set_info = static_cast<ReplicaSetInfo*>(it->second.get());
+  auto replica_set_info = static_cast<ReplicaSetInfo*>(internal::CopyForWrite(&it->second));
 
   for (const auto& owner_ref : update.owner_references()) {
     replica_set_info->AddOwnerReference(owner_ref.uid(), owner_ref.name(), owner_ref.kind());
@@ -365,6 +382,7 @@ Status K8sMetadataState::HandleReplicaSetUpdate(const ReplicaSetUpdate& update)
 }
 
 Status K8sMetadataState::HandleDeploymentUpdate(const DeploymentUpdate& update) {
+  ++sequence_number_;
   const UID& deployment_uid = update.uid();
   const std::string& name = update.name();
   const std::string& ns = update.namespace_();
@@ -375,7 +393,7 @@ Status K8sMetadataState::HandleDeploymentUpdate(const DeploymentUpdate& update)
     VLOG(1) << "Adding Deployment: " << deployment->DebugString();
     it = k8s_objects_by_id_.try_emplace(deployment_uid, std::move(deployment)).first;
   }
-  auto deployment_info = static_cast<DeploymentInfo*>(it->second.get());
+  auto deployment_info = static_cast<DeploymentInfo*>(internal::CopyForWrite(&it->second));
 
   deployment_info->set_start_time_ns(update.start_timestamp_ns());
   deployment_info->set_stop_time_ns(update.stop_timestamp_ns());
@@ -405,8 +423,10 @@ bool IsExpired(const T& obj, int64_t retention_time, int64_t now) {
   return now > expiry_time;
 }
 
-Status K8sMetadataState::CleanupExpiredMetadata(int64_t retention_time_ns) {
+Status K8sMetadataState::CleanupExpiredMetadata(int64_t retention_time_ns,
+                                                AgentMetadataFilter* md_filter) {
   int64_t now = CurrentTimeNS();
+  ++sequence_number_;
 
   for (auto iter = k8s_objects_by_id_.begin(); iter != k8s_objects_by_id_.end();) {
     const auto& k8s_object = iter->second;
@@ -428,6 +448,13 @@ Status K8sMetadataState::CleanupExpiredMetadata(int64_t retention_time_ns) {
                             // delete the IP from the map if it belongs to the terminated pod.
           pods_by_ip_.erase(static_cast<PodInfo*>(k8s_object.get())->pod_ip());
         }
+        // Mirror the entities inserted by HandlePodUpdate.
+        if (md_filter != nullptr) {
+          PL_RETURN_IF_ERROR(md_filter->RemoveEntity(MetadataType::POD_ID, k8s_object->uid()));
+          PL_RETURN_IF_ERROR(md_filter->RemoveEntity(MetadataType::POD_NAME, k8s_object->name()));
+          PL_RETURN_IF_ERROR(
+              md_filter->RemoveEntity(MetadataType::POD_NAME, k8s_object->ns_and_name()));
+        }
         break;
       case K8sObjectType::kNamespace:
         if (NamespaceIDByName(std::make_pair(k8s_object->ns(), k8s_object->name())) ==
@@ -440,6 +467,14 @@ Status K8sMetadataState::CleanupExpiredMetadata(int64_t retention_time_ns) {
             k8s_object->uid()) {
           services_by_name_.erase({k8s_object->ns(), k8s_object->name()});
         }
+        // Mirror the entities inserted by HandleServiceUpdate.
+        if (md_filter != nullptr) {
+          PL_RETURN_IF_ERROR(md_filter->RemoveEntity(MetadataType::SERVICE_ID, k8s_object->uid()));
+          PL_RETURN_IF_ERROR(
+              md_filter->RemoveEntity(MetadataType::SERVICE_NAME, k8s_object->name()));
+          PL_RETURN_IF_ERROR(
+              md_filter->RemoveEntity(MetadataType::SERVICE_NAME, k8s_object->ns_and_name()));
+        }
         break;
       default:
         LOG(DFATAL) << absl::Substitute("Unexpected object type: $0",
@@ -457,6 +492,9 @@ Status K8sMetadataState::CleanupExpiredMetadata(int64_t retention_time_ns) {
       continue;
     }
 
+    if (md_filter != nullptr) {
+      PL_RETURN_IF_ERROR(md_filter->RemoveEntity(MetadataType::CONTAINER_ID, cinfo->cid()));
+    }
     containers_by_name_.erase(cinfo->name());
     containers_by_id_.erase(iter++);
   }
@@ -470,11 +508,11 @@ std::shared_ptr<AgentMetadataState> AgentMetadataState::CloneToShared() const {
   state->last_update_ts_ns_ = last_update_ts_ns_;
   state->epoch_id_ = epoch_id_;
   state->k8s_metadata_state_ = k8s_metadata_state_->Clone();
-  state->pids_by_upid_.reserve(pids_by_upid_.size());
-  for (const auto& [k, v] : pids_by_upid_) {
-    state->pids_by_upid_[k] = v->Clone();
-  }
+  // Copy-on-write: only the map is copied; PIDInfo objects are shared with this state and are
+  // cloned individually if a mutation (e.g. MarkUPIDAsStopped) hits a shared object.
+  state->pids_by_upid_ = pids_by_upid_;
   state->upids_ = upids_;
+  state->sequence_number_ = sequence_number_;
   return state;
 }
 
@@ -36,11 +36,30 @@
 namespace px {
 namespace md {
 
-using K8sMetadataObjectUPtr = std::unique_ptr<K8sMetadataObject>;
-using ContainerInfoUPtr = std::unique_ptr<ContainerInfo>;
-using PIDInfoUPtr = std::unique_ptr<PIDInfo>;
+// Metadata objects are held by shared_ptr so that cloned state snapshots can share unmodified
+// objects (copy-on-write): Clone()/CloneToShared() copy only the maps, and mutators clone an
+// individual object before modifying it if any other snapshot still references it.
+using K8sMetadataObjectPtr = std::shared_ptr<K8sMetadataObject>;
+using ContainerInfoPtr = std::shared_ptr<ContainerInfo>;
+using PIDInfoPtr = std::shared_ptr<PIDInfo>;
 using AgentID = sole::uuid;
 
+class AgentMetadataFilter;
+
+namespace internal {
+
+// Copy-on-write accessor for shared object maps. Returns a mutable pointer to the stored
+// object, cloning it first if it is still shared with another state snapshot.
+template <typename TPtr>
+typename TPtr::element_type* CopyForWrite(TPtr* ptr) {
+  if (ptr->use_count() > 1) {
+    *ptr = (*ptr)->Clone();
+  }
+  return ptr->get();
+}
+
+}  // namespace internal
+
 /**
  * This class contains all kubernetes relate metadata.
  */
@@ -156,6 +175,14 @@ class K8sMetadataState : NotCopyable {
    */
   const ContainerInfo* ContainerInfoByID(CIDView id) const;
 
+  /**
+   * MutableContainerInfoByID returns a mutable pointer to the container info, cloning the
+   * object first if it is still shared with a previous state snapshot (copy-on-write).
+   * @param id The ID of the container.
+   * @return ContainerInfo or nullptr if not found.
+   */
+  ContainerInfo* MutableContainerInfoByID(CIDView id);
+
   /**
    * ContainerIDByName returns the ContainerID for the container of the given name.
    * @param container_name the container name
@@ -233,11 +260,23 @@ class K8sMetadataState : NotCopyable {
   Status HandleReplicaSetUpdate(const ReplicaSetUpdate& update);
   Status HandleDeploymentUpdate(const DeploymentUpdate& update);
 
-  Status CleanupExpiredMetadata(int64_t retention_time_ns);
+  /**
+   * Erases metadata objects that have been dead for longer than the retention time.
+   * If md_filter is non-null, the erased objects' entities are also removed from the filter so
+   * its false-positive rate does not degrade with churn.
+   */
+  Status CleanupExpiredMetadata(int64_t retention_time_ns, AgentMetadataFilter* md_filter);
 
-  absl::flat_hash_map<CID, ContainerInfoUPtr>& containers_by_id() { return containers_by_id_; }
+  absl::flat_hash_map<CID, ContainerInfoPtr>& containers_by_id() { return containers_by_id_; }
   std::string DebugString(int indent_level = 0) const;
 
+  /**
+   * A monotonically increasing count of mutations applied to this state instance. Published
+   * snapshots are immutable, so caches keyed on a snapshot can use this to detect in-place
+   * updates (e.g. in tests, which mutate a state directly).
+   */
+  uint64_t sequence_number() const { return sequence_number_; }
+
  private:
   const K8sMetadataObject* K8sMetadataObjectByID(UIDView id, K8sObjectType type) const;
 
@@ -248,10 +287,10 @@ class K8sMetadataState : NotCopyable {
   std::vector<CIDRBlock> pod_cidrs_;
 
   // This stores K8s native objects (services, pods, etc).
-  absl::flat_hash_map<UID, K8sMetadataObjectUPtr> k8s_objects_by_id_;
+  absl::flat_hash_map<UID, K8sMetadataObjectPtr> k8s_objects_by_id_;
 
   // This stores container objects, complementing k8s_objects_by_id_.
-  absl::flat_hash_map<CID, ContainerInfoUPtr> containers_by_id_;
+  absl::flat_hash_map<CID, ContainerInfoPtr> containers_by_id_;
 
   /**
    * Mapping of pods by name.
@@ -292,6 +331,8 @@ class K8sMetadataState : NotCopyable {
    * Mapping of Services by Cluster IP.
    */
   ServicesByServiceIpMap services_by_cluster_ip_;
+
+  uint64_t sequence_number_ = 0;
 };
 
 class AgentMetadataState : NotCopyable {
@@ -333,7 +374,7 @@ class AgentMetadataState : NotCopyable {
 
   std::shared_ptr<AgentMetadataState> CloneToShared() const;
 
-  PIDInfo* GetPIDByUPID(UPID upid) const {
+  const PIDInfo* GetPIDByUPID(UPID upid) const {
     auto it = pids_by_upid_.find(upid);
     if (it != pids_by_upid_.end()) {
       return it->second.get();
@@ -345,24 +386,34 @@ class AgentMetadataState : NotCopyable {
     DCHECK(pid_info != nullptr);
     DCHECK_EQ(pid_info->stop_time_ns(), 0);
 
+    ++sequence_number_;
     pids_by_upid_[upid] = std::move(pid_info);
     upids_.insert(upid);
   }
 
   void MarkUPIDAsStopped(UPID upid, int64_t ts) {
-    auto* pid_info = GetPIDByUPID(upid);
-    if (pid_info != nullptr) {
-      pid_info->set_stop_time_ns(ts);
+    auto it = pids_by_upid_.find(upid);
+    if (it != pids_by_upid_.end()) {
+      ++sequence_number_;
+      internal::CopyForWrite(&it->second)->set_stop_time_ns(ts);
       upids_.erase(upid);
     } else {
       DCHECK(!upids_.contains(upid));
     }
   }
 
-  const absl::flat_hash_map<UPID, PIDInfoUPtr>& pids_by_upid() const { return pids_by_upid_; }
+  const absl::flat_hash_map<UPID, PIDInfoPtr>& pids_by_upid() const { return pids_by_upid_; }
 
   const absl::flat_hash_set<md::UPID>& upids() const { return upids_; }
 
+  /**
+   * Counts mutations to this state instance, including the underlying K8s state; see
+   * K8sMetadataState::sequence_number().
+   */
+  uint64_t sequence_number() const {
+    return sequence_number_ + k8s_metadata_state_->sequence_number();
+  }
+
   std::string DebugString(int indent_level = 0) const;
 
  private:
@@ -393,7 +444,7 @@ class AgentMetadataState : NotCopyable {
   /**
    * Mapping of PIDs by UPID for active pods on the system.
    */
-  absl::flat_hash_map<UPID, PIDInfoUPtr> pids_by_upid_;
+  absl::flat_hash_map<UPID, PIDInfoPtr> pids_by_upid_;
 
   /**
    * All active UPIDs. Unlike pids_by_upid_, this does not contain stopped pids.
@@ -401,6 +452,8 @@ class AgentMetadataState : NotCopyable {
    * it is tracked separately as a performance optimization.
    */
   absl::flat_hash_set<md::UPID> upids_;
+
+  uint64_t sequence_number_ = 0;
 };
 
 }  // namespace md
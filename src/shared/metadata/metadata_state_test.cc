@@ -299,6 +299,28 @@ TEST(K8sMetadataStateTest, HandleContainerUpdate) {
   EXPECT_EQ("a container reason", info->state_reason());
 }
 
+TEST(K8sMetadataStateTest, CloneIsCopyOnWrite) {
+  K8sMetadataState state;
+
+  K8sMetadataState::ContainerUpdate update;
+  ASSERT_TRUE(TextFormat::MergeFromString(kContainer0UpdatePbTxt, &update))
+      << "Failed to parse proto";
+  ASSERT_OK(state.HandleContainerUpdate(update));
+
+  auto clone = state.Clone();
+
+  // Unmodified objects are shared between the clone and the original.
+  EXPECT_EQ(state.ContainerInfoByID("container0_uid"), clone->ContainerInfoByID("container0_uid"));
+
+  // Mutating through the clone must clone the object and leave the original untouched.
+  ContainerInfo* mutable_cinfo = clone->MutableContainerInfoByID("container0_uid");
+  ASSERT_NE(nullptr, mutable_cinfo);
+  EXPECT_NE(mutable_cinfo, state.ContainerInfoByID("container0_uid"));
+  mutable_cinfo->set_stop_time_ns(1234);
+  EXPECT_EQ(102, state.ContainerInfoByID("container0_uid")->stop_time_ns());
+  EXPECT_EQ(1234, clone->ContainerInfoByID("container0_uid")->stop_time_ns());
+}
+
 TEST(K8sMetadataStateTest, HandlePodUpdate) {
   // 1 missing ContainerUpdate (should be skipped).
   // 1 present ContainerUpdate (should be handled before PodUpdate).
@@ -583,7 +605,7 @@ TEST(K8sMetadataStateTest, CleanupExpiredMetadata) {
   // In this test, we give an expiry window that is large to make sure they live on.
   // Then we give them an expiry time that is short
   int64_t long_retention_time = 2 * current_time;
-  ASSERT_OK(state.CleanupExpiredMetadata(long_retention_time));
+  ASSERT_OK(state.CleanupExpiredMetadata(long_retention_time, /* md_filter */ nullptr));
 
   {
     const PodInfo* pod_info = state.PodInfoByID("pod0_uid");
@@ -609,7 +631,7 @@ TEST(K8sMetadataStateTest, CleanupExpiredMetadata) {
   }
 
   int64_t zero_retention_time = 0;
-  ASSERT_OK(state.CleanupExpiredMetadata(zero_retention_time));
+  ASSERT_OK(state.CleanupExpiredMetadata(zero_retention_time, /* md_filter */ nullptr));
 
   {
     const PodInfo* pod_info = state.PodInfoByID("pod0_uid");
@@ -108,8 +108,8 @@ Status AgentMetadataStateManagerImpl::PerformMetadataStateUpdate() {
   }
 
   if (epoch_id % kEpochsBetweenObjectDeletion == 0) {
-    PL_RETURN_IF_ERROR(
-        DeleteMetadataForDeadObjects(shadow_state.get(), kMinObjectRetentionAfterDeathNS));
+    PL_RETURN_IF_ERROR(DeleteMetadataForDeadObjects(shadow_state.get(), metadata_filter_,
+                                                    kMinObjectRetentionAfterDeathNS));
   }
 
   // Increment epoch and update ts.
@@ -128,42 +128,55 @@ Status AgentMetadataStateManagerImpl::PerformMetadataStateUpdate() {
   return Status::OK();
 }
 
+/**
+ * kK8sUpdateBatchSize is the number of updates drained from the incoming queue per bulk dequeue.
+ * During deploy storms thousands of updates queue up between state update cycles; draining them in
+ * batches amortizes the queue's synchronization cost instead of paying it once per update. All
+ * batches in a cycle are applied against the same shadow clone, so the per-cycle filter and epoch
+ * work is unaffected by the number of updates.
+ */
+constexpr size_t kK8sUpdateBatchSize = 256;
+
 Status ApplyK8sUpdates(
     int64_t ts, AgentMetadataState* state, AgentMetadataFilter* metadata_filter,
     moodycamel::BlockingConcurrentQueue<std::unique_ptr<ResourceUpdate>>* updates) {
-  std::unique_ptr<ResourceUpdate> update(nullptr);
+  std::vector<std::unique_ptr<ResourceUpdate>> batch(kK8sUpdateBatchSize);
   PL_UNUSED(ts);
 
-  // Returns false when no more items.
-  while (updates->try_dequeue(update)) {
-    switch (update->update_case()) {
-      case ResourceUpdate::kPodUpdate:
-        PL_RETURN_IF_ERROR(HandlePodUpdate(update->pod_update(), state, metadata_filter));
-        break;
-      case ResourceUpdate::kContainerUpdate:
-        PL_RETURN_IF_ERROR(
-            HandleContainerUpdate(update->container_update(), state, metadata_filter));
-        break;
-      case ResourceUpdate::kServiceUpdate:
-        PL_RETURN_IF_ERROR(HandleServiceUpdate(update->service_update(), state, metadata_filter));
-        break;
-      case ResourceUpdate::kNamespaceUpdate:
-        PL_RETURN_IF_ERROR(
-            HandleNamespaceUpdate(update->namespace_update(), state, metadata_filter));
-        break;
-      case ResourceUpdate::kNodeUpdate:
-        PL_RETURN_IF_ERROR(HandleNodeUpdate(update->node_update(), state, metadata_filter));
-        break;
-      case ResourceUpdate::kReplicaSetUpdate:
-        PL_RETURN_IF_ERROR(
-            HandleReplicaSetUpdate(update->replica_set_update(), state, metadata_filter));
-        break;
-      case ResourceUpdate::kDeploymentUpdate:
-        PL_RETURN_IF_ERROR(
-            HandleDeploymentUpdate(update->deployment_update(), state, metadata_filter));
-        break;
-      default:
-        LOG(ERROR) << "Unhandled Update Type: " << update->update_case() << " (ignoring)";
+  // Returns 0 when no more items.
+  size_t num_dequeued;
+  while ((num_dequeued = updates->try_dequeue_bulk(batch.begin(), kK8sUpdateBatchSize)) > 0) {
+    for (size_t i = 0; i < num_dequeued; ++i) {
+      std::unique_ptr<ResourceUpdate> update = std::move(batch[i]);
+      switch (update->update_case()) {
+        case ResourceUpdate::kPodUpdate:
+          PL_RETURN_IF_ERROR(HandlePodUpdate(update->pod_update(), state, metadata_filter));
+          break;
+        case ResourceUpdate::kContainerUpdate:
+          PL_RETURN_IF_ERROR(
+              HandleContainerUpdate(update->container_update(), state, metadata_filter));
+          break;
+        case ResourceUpdate::kServiceUpdate:
+          PL_RETURN_IF_ERROR(HandleServiceUpdate(update->service_update(), state, metadata_filter));
+          break;
+        case ResourceUpdate::kNamespaceUpdate:
+          PL_RETURN_IF_ERROR(
+              HandleNamespaceUpdate(update->namespace_update(), state, metadata_filter));
+          break;
+        case ResourceUpdate::kNodeUpdate:
+          PL_RETURN_IF_ERROR(HandleNodeUpdate(update->node_update(), state, metadata_filter));
+          break;
+        case ResourceUpdate::kReplicaSetUpdate:
+          PL_RETURN_IF_ERROR(
+              HandleReplicaSetUpdate(update->replica_set_update(), state, metadata_filter));
+          break;
+        case ResourceUpdate::kDeploymentUpdate:
+          PL_RETURN_IF_ERROR(
+              HandleDeploymentUpdate(update->deployment_update(), state, metadata_filter));
+          break;
+        default:
+          LOG(ERROR) << "Unhandled Update Type: " << update->update_case() << " (ignoring)";
+      }
     }
   }
 
@@ -181,31 +194,42 @@ StatusOr<UPID> InitUPID(const system::ProcParser& proc_parser, uint32_t asid, ui
 
 void ProcessContainerPIDUpdates(
     CIDView cid, int64_t ts, const system::ProcParser& proc_parser, AgentMetadataState* md,
-    StartTimeOrderedUPIDSet* upids, absl::flat_hash_set<uint32_t>* cgroups_pids,
+    K8sMetadataState* k8s_md_state, absl::flat_hash_set<uint32_t>* cgroups_pids,
     moodycamel::BlockingConcurrentQueue<std::unique_ptr<PIDStatusEvent>>* pid_updates) {
-  // Iterate through old list of UPIDs, looking for PIDs which have been deleted.
-  auto upids_iter = upids->begin();
-  while (upids_iter != upids->end()) {
-    const auto& prev_upid = *upids_iter;
+  const ContainerInfo* cinfo = k8s_md_state->ContainerInfoByID(cid);
+  DCHECK(cinfo != nullptr);
 
+  // Compute the deltas against the current UPID set before grabbing a mutable container, so
+  // containers without PID churn stay shared with previous state snapshots (copy-on-write).
+  std::vector<UPID> terminated_upids;
+  for (const auto& prev_upid : cinfo->active_upids()) {
     auto cgroups_pids_iter = cgroups_pids->find(prev_upid.pid());
     if (cgroups_pids_iter == cgroups_pids->end()) {
       // Deleted PID.
-      md->MarkUPIDAsStopped(prev_upid, ts);
-
-      // Push deletion events to the queue.
-      pid_updates->enqueue(std::make_unique<PIDTerminatedEvent>(prev_upid, ts));
-
-      // Must use this style instead of `upids->erase(upids_iter++)`,
-      // otherwise the iterator becomes invalid, causing potential seg-faults.
-      upids_iter = upids->erase(upids_iter);
+      terminated_upids.push_back(prev_upid);
       continue;
     }
 
     // We are already tracking this PID.
     // Consume it so cgroups_pids contains only new PIDs at the end of this loop.
     cgroups_pids->erase(cgroups_pids_iter);
-    ++upids_iter;
+  }
+
+  if (terminated_upids.empty() && cgroups_pids->empty()) {
+    // No PID churn in this container.
+    return;
+  }
+
+  StartTimeOrderedUPIDSet* upids =
+      k8s_md_state->MutableContainerInfoByID(cid)->mutable_active_upids();
+
+  for (const auto& prev_upid : terminated_upids) {
+    md->MarkUPIDAsStopped(prev_upid, ts);
+
+    // Push deletion events to the queue.
+    pid_updates->enqueue(std::make_unique<PIDTerminatedEvent>(prev_upid, ts));
+
+    upids->erase(prev_upid);
   }
 
   // Any PIDs left-over in groups_pids are new.
@@ -264,7 +288,7 @@ Status ProcessPIDUpdates(
     if (pod_info->stop_time_ns() != 0) {
       VLOG(1) << absl::Substitute("Found a running container in a deleted pod [cid=$0, pod_id=$1]",
                                   cid, pod_id);
-      cinfo->set_stop_time_ns(pod_info->stop_time_ns());
+      k8s_md_state->MutableContainerInfoByID(cid)->set_stop_time_ns(pod_info->stop_time_ns());
       continue;
     }
 
@@ -282,24 +306,27 @@ Status ProcessPIDUpdates(
       // NOTE: Currently, MDS sends pods that do no belong to this Agent, so this is actually
       // required to avoid repeatedly printing out the warning message above.
       if (error::IsNotFound(s)) {
-        cinfo->set_stop_time_ns(ts);
-        for (const auto& upid : cinfo->active_upids()) {
+        ContainerInfo* mutable_cinfo = k8s_md_state->MutableContainerInfoByID(cid);
+        mutable_cinfo->set_stop_time_ns(ts);
+        for (const auto& upid : mutable_cinfo->active_upids()) {
           md->MarkUPIDAsStopped(upid, ts);
         }
-        cinfo->mutable_active_upids()->clear();
+        mutable_cinfo->mutable_active_upids()->clear();
       }
       continue;
     }
 
-    ProcessContainerPIDUpdates(cid, ts, proc_parser, md, cinfo->mutable_active_upids(),
-                               &cgroups_active_pids, pid_updates);
+    ProcessContainerPIDUpdates(cid, ts, proc_parser, md, k8s_md_state, &cgroups_active_pids,
+                               pid_updates);
   }
 
   return Status::OK();
 }
 
-Status DeleteMetadataForDeadObjects(AgentMetadataState* state, int64_t retention_time) {
-  PL_RETURN_IF_ERROR(state->k8s_metadata_state()->CleanupExpiredMetadata(retention_time));
+Status DeleteMetadataForDeadObjects(AgentMetadataState* state, AgentMetadataFilter* md_filter,
+                                    int64_t retention_time) {
+  PL_RETURN_IF_ERROR(
+      state->k8s_metadata_state()->CleanupExpiredMetadata(retention_time, md_filter));
   return Status::OK();
 }
 
@@ -205,7 +205,8 @@ Status ProcessPIDUpdates(
 /**
  * Deletes metadata for dead objects.
  */
-Status DeleteMetadataForDeadObjects(AgentMetadataState*, int64_t ttl);
+Status DeleteMetadataForDeadObjects(AgentMetadataState*, AgentMetadataFilter* md_filter,
+                                    int64_t ttl);
 
 /**
  * Handlers for K8s update types.
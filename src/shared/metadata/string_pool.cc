@@ -0,0 +1,46 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/shared/metadata/string_pool.h"
+
+namespace px {
+namespace md {
+
+StringPool& StringPool::GetInstance() {
+  // Leaked so pooled references stay valid during static destruction.
+  static StringPool* pool = new StringPool();
+  return *pool;
+}
+
+const std::string& StringPool::Intern(std::string_view str) {
+  absl::base_internal::SpinLockHolder lock(&lock_);
+  // Heterogeneous lookup first, so repeat interning of an existing string does not allocate.
+  auto it = strings_.find(str);
+  if (it != strings_.end()) {
+    return *it;
+  }
+  return *strings_.emplace(str).first;
+}
+
+size_t StringPool::Size() const {
+  absl::base_internal::SpinLockHolder lock(&lock_);
+  return strings_.size();
+}
+
+}  // namespace md
+}  // namespace px
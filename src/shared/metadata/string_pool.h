@@ -0,0 +1,67 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <absl/base/internal/spinlock.h>
+#include <absl/container/node_hash_set.h>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace md {
+
+/**
+ * StringPool is a process-wide intern pool for K8s metadata names.
+ *
+ * Namespaces, node names, and label sets repeat across most of the objects on a node, and
+ * previously each metadata object (and each clone of it) carried its own copy. Interning stores
+ * one copy per distinct string and lets objects hold a pointer to it.
+ *
+ * Pooled strings are never evicted: the pool holds names whose cardinality is bounded by
+ * cluster contents rather than event rate, so the simplicity of stable, process-lifetime
+ * references outweighs the unbounded-growth concern.
+ */
+class StringPool : public NotCopyable {
+ public:
+  static StringPool& GetInstance();
+
+  /**
+   * Returns a reference to the pooled copy of str, inserting it on first use.
+   * The reference remains valid for the lifetime of the process.
+   */
+  const std::string& Intern(std::string_view str);
+
+  /**
+   * Number of distinct strings in the pool.
+   */
+  size_t Size() const;
+
+ private:
+  StringPool() = default;
+
+  mutable absl::base_internal::SpinLock lock_;
+  // node_hash_set is required for pointer stability of the stored strings.
+  absl::node_hash_set<std::string> strings_ ABSL_GUARDED_BY(lock_);
+};
+
+}  // namespace md
+}  // namespace px
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/shared/metadata/string_pool.h"
+
+#include "src/common/testing/testing.h"
+#include "src/shared/metadata/k8s_objects.h"
+
+namespace px {
+namespace md {
+
+TEST(StringPoolTest, InterningDeduplicates) {
+  auto& pool = StringPool::GetInstance();
+
+  const std::string& a = pool.Intern("px-string-pool-test");
+  EXPECT_EQ("px-string-pool-test", a);
+
+  // Interning the same contents again must return the same pooled instance.
+  const std::string& b = pool.Intern(std::string("px-string-pool-test"));
+  EXPECT_EQ(&a, &b);
+
+  // Different contents get a different instance.
+  const std::string& c = pool.Intern("px-string-pool-test-2");
+  EXPECT_NE(&a, &c);
+}
+
+TEST(StringPoolTest, K8sObjectsShareInternedNames) {
+  PodInfo pod1("pod1_uid", "ns0", "pod1", PodQOSClass::kGuaranteed, PodPhase::kRunning, {}, "", "",
+               "node0", "host0", "1.2.3.4");
+  PodInfo pod2("pod2_uid", "ns0", "pod2", PodQOSClass::kGuaranteed, PodPhase::kRunning, {}, "", "",
+               "node0", "host0", "1.2.3.5");
+
+  // Shared namespace and node name resolve to the same pooled strings.
+  EXPECT_EQ(&pod1.ns(), &pod2.ns());
+  EXPECT_EQ(&pod1.node_name(), &pod2.node_name());
+  EXPECT_NE(&pod1.name(), &pod2.name());
+
+  EXPECT_EQ("ns0/pod1", pod1.ns_and_name());
+}
+
+}  // namespace md
+}  // namespace px
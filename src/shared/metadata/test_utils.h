@@ -34,6 +34,12 @@ class TestAgentMetadataFilter : public AgentMetadataFilter {
 
  protected:
   void Insert(std::string_view value) override { inserted_entities_.push_back(std::string(value)); }
+  void Remove(std::string_view value) override {
+    auto it = std::find(inserted_entities_.begin(), inserted_entities_.end(), value);
+    if (it != inserted_entities_.end()) {
+      inserted_entities_.erase(it);
+    }
+  }
   bool Contains(std::string_view value) const override {
     return std::find(inserted_entities_.begin(), inserted_entities_.end(), value) !=
            inserted_entities_.end();
@@ -22,8 +22,11 @@
 #include <arrow/buffer.h>
 #include <arrow/builder.h>
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -72,11 +75,36 @@ class ColumnWrapper {
   virtual std::shared_ptr<arrow::Array> ConvertToArrow(arrow::MemoryPool* mem_pool) = 0;
   // GetView returns an empty string view for all non-string columns.
   virtual std::string_view GetView(size_t idx) const = 0;
+  // AppendString appends a value to a STRING column through the virtual interface, so it works
+  // for any string representation (ColumnWrapperTmpl<StringValue> or ArenaStringColumnWrapper).
+  // Invalid on non-string columns.
+  virtual void AppendString(std::string_view val) = 0;
+  // AppendFrom appends all values of other (which must have the same data type) to this wrapper.
+  // Used to merge record batches built independently.
+  virtual void AppendFrom(const ColumnWrapper& other) = 0;
+  // AppendFromArrow appends [offset, offset + length) of the given arrow array, which must match
+  // this wrapper's data type. Fixed-width types copy the slice with a single memcpy instead of one
+  // call per value.
+  virtual void AppendFromArrow(const arrow::Array& arr, int64_t offset, int64_t length) = 0;
 
   template <class TValueType>
   void Append(TValueType val);
 
+  // Appends count contiguous values in bulk. For fixed-width types this is a single insert
+  // (memcpy) rather than one virtual call per value.
   template <class TValueType>
+  void AppendSpan(const TValueType* vals, size_t count);
+
+  // Grows the column by count values and returns a pointer to the (uninitialized) new region, for
+  // reserve-then-fill producers. Not available for STRING columns.
+  template <class TValueType,
+            typename = std::enable_if_t<!std::is_same_v<TValueType, StringValue>>>
+  TValueType* AppendUninitialized(size_t count);
+
+  // The reference-returning Get is only available for value types stored directly in the wrapper;
+  // strings must use the by-value overload below, which works for any string representation.
+  template <class TValueType,
+            typename = std::enable_if_t<!std::is_same_v<TValueType, StringValue>>>
   TValueType& Get(size_t idx);
 
   template <class TValueType>
@@ -141,6 +169,50 @@ class ColumnWrapperTmpl : public ColumnWrapper {
 
   int64_t Bytes() const override;
 
+  void AppendString(std::string_view val) override {
+    if constexpr (std::is_same_v<T, StringValue>) {
+      data_.emplace_back(std::string(val));
+    } else {
+      DCHECK(false) << "AppendString() on a non-string column.";
+    }
+  }
+
+  void AppendFrom(const ColumnWrapper& other) override {
+    DCHECK_EQ(other.data_type(), data_type());
+    if constexpr (std::is_same_v<T, StringValue>) {
+      // Go through GetView, since other may use a different string representation.
+      for (size_t i = 0; i < other.Size(); ++i) {
+        data_.emplace_back(std::string(other.GetView(i)));
+      }
+    } else {
+      const auto& other_tmpl = static_cast<const ColumnWrapperTmpl<T>&>(other);
+      data_.insert(data_.end(), other_tmpl.data_.begin(), other_tmpl.data_.end());
+    }
+  }
+
+  void AppendFromArrow(const arrow::Array& arr, int64_t offset, int64_t length) override {
+    constexpr DataType DT = ValueTypeTraits<T>::data_type;
+    DCHECK_LE(offset + length, arr.length());
+    if constexpr (std::is_same_v<T, Int64Value> || std::is_same_v<T, Float64Value> ||
+                  std::is_same_v<T, Time64NSValue>) {
+      // Fixed-width native layout: copy the raw value buffer slice directly. GetValues already
+      // accounts for the array's own offset. Note that TIME64NS columns can be backed by either
+      // a Time64Array or an Int64Array; both store int64_t values, so this path handles both.
+      using NativeType = typename ValueTypeTraits<T>::native_type;
+      const auto* raw = arr.data()->template GetValues<NativeType>(1);
+      static_assert(sizeof(T) == sizeof(NativeType));
+      size_t old_size = data_.size();
+      data_.resize(old_size + length);
+      memcpy(data_.data() + old_size, raw + offset, length * sizeof(T));
+    } else {
+      DCHECK_EQ(arr.type_id(), DataTypeTraits<DT>::arrow_type_id);
+      data_.reserve(data_.size() + length);
+      for (int64_t i = 0; i < length; ++i) {
+        data_.push_back(GetValueFromArrowArray<DT>(&arr, offset + i));
+      }
+    }
+  }
+
   std::string_view GetView(size_t idx) const override {
     if constexpr (std::is_same_v<T, StringValue>) {
       return std::string_view(data_[idx]);
@@ -148,6 +220,16 @@ class ColumnWrapperTmpl : public ColumnWrapper {
     return {};
   }
 
+  void AppendSpan(const T* vals, size_t count) {
+    data_.insert(data_.end(), vals, vals + count);
+  }
+
+  T* AppendUninitialized(size_t count) {
+    size_t old_size = data_.size();
+    data_.resize(old_size + count);
+    return data_.data() + old_size;
+  }
+
   void AppendFromVector(const std::vector<T>& value_vector) {
     for (const auto& value : value_vector) {
       Append(value);
@@ -196,6 +278,137 @@ inline int64_t ColumnWrapperTmpl<StringValue>::Bytes() const {
   return bytes;
 }
 
+/**
+ * ArenaStringColumnWrapper is a STRING column representation backed by an arena. All string bytes
+ * live in large arena blocks owned by the wrapper, and the column itself holds string_views into
+ * those blocks. Producers that build record batches value-by-value (e.g. Stirling's transfer path)
+ * can use this wrapper to replace thousands of per-value std::string allocations per batch with a
+ * handful of block allocations.
+ *
+ * Unlike ColumnWrapperTmpl<StringValue>, this wrapper cannot be accessed through the type-casting
+ * ColumnWrapper::Get/Append/UnsafeRawData interfaces; consumers must use the virtual interface
+ * (GetView/ConvertToArrow/CopyIndexes/MoveIndexes), which all table store paths do.
+ */
+class ArenaStringColumnWrapper : public ColumnWrapper {
+ public:
+  static constexpr size_t kMinBlockSize = 16 * 1024;
+
+  ArenaStringColumnWrapper() = default;
+
+  /**
+   * Append copies the given value into the arena and appends a view of it to the column.
+   */
+  void Append(std::string_view val) {
+    views_.push_back(CopyIntoArena(val));
+    data_bytes_ += val.size();
+  }
+
+  void AppendString(std::string_view val) override { Append(val); }
+
+  void AppendFrom(const ColumnWrapper& other) override {
+    DCHECK_EQ(other.data_type(), DataType::STRING);
+    Reserve(views_.size() + other.Size());
+    for (size_t i = 0; i < other.Size(); ++i) {
+      Append(other.GetView(i));
+    }
+  }
+
+  void AppendFromArrow(const arrow::Array& arr, int64_t offset, int64_t length) override {
+    DCHECK_EQ(arr.type_id(), arrow::Type::STRING);
+    DCHECK_LE(offset + length, arr.length());
+    const auto& arr_casted = static_cast<const arrow::StringArray&>(arr);
+    Reserve(views_.size() + length);
+    for (int64_t i = 0; i < length; ++i) {
+      auto v = arr_casted.GetView(offset + i);
+      Append(std::string_view(v.data(), v.size()));
+    }
+  }
+
+  DataType data_type() const override { return DataType::STRING; }
+  size_t Size() const override { return views_.size(); }
+  bool Empty() const override { return views_.empty(); }
+  int64_t Bytes() const override { return data_bytes_ + views_.size() * sizeof(std::string_view); }
+
+  BaseValueType* UnsafeRawData() override {
+    DCHECK(false) << "ArenaStringColumnWrapper doesn't support raw data access.";
+    return nullptr;
+  }
+  const BaseValueType* UnsafeRawData() const override {
+    DCHECK(false) << "ArenaStringColumnWrapper doesn't support raw data access.";
+    return nullptr;
+  }
+
+  void Reserve(size_t size) override { views_.reserve(size); }
+  void ShrinkToFit() override { views_.shrink_to_fit(); }
+
+  void Clear() override {
+    views_.clear();
+    blocks_.clear();
+    block_used_ = 0;
+    data_bytes_ = 0;
+  }
+
+  std::string_view GetView(size_t idx) const override {
+    DCHECK_LT(idx, views_.size());
+    return views_[idx];
+  }
+
+  std::shared_ptr<arrow::Array> ConvertToArrow(arrow::MemoryPool* mem_pool) override {
+    arrow::StringBuilder builder(mem_pool);
+    PL_CHECK_OK(builder.Reserve(views_.size()));
+    PL_CHECK_OK(builder.ReserveData(data_bytes_));
+    for (const auto& view : views_) {
+      builder.UnsafeAppend(view.data(), view.size());
+    }
+    std::shared_ptr<arrow::Array> arr;
+    PL_CHECK_OK(builder.Finish(&arr));
+    return arr;
+  }
+
+  SharedColumnWrapper CopyIndexes(const std::vector<size_t>& indexes) const override {
+    DCHECK_LE(indexes.size(), views_.size());
+    auto copy = std::make_shared<ArenaStringColumnWrapper>();
+    copy->Reserve(indexes.size());
+    for (size_t idx : indexes) {
+      copy->Append(views_[idx]);
+    }
+    return copy;
+  }
+
+  // The arena doesn't support moving values out, so MoveIndexes is equivalent to CopyIndexes; the
+  // arena blocks are freed when "this" is discarded by the caller.
+  SharedColumnWrapper MoveIndexes(const std::vector<size_t>& indexes) override {
+    return CopyIndexes(indexes);
+  }
+
+ private:
+  std::string_view CopyIntoArena(std::string_view val) {
+    if (val.empty()) {
+      return {};
+    }
+    if (blocks_.empty() || block_used_ + val.size() > blocks_.back().size) {
+      // Double the block size as the column grows to amortize allocations for large batches.
+      size_t block_size = blocks_.empty() ? kMinBlockSize : blocks_.back().size * 2;
+      block_size = std::max(block_size, val.size());
+      blocks_.push_back(Block{std::make_unique<char[]>(block_size), block_size});
+      block_used_ = 0;
+    }
+    char* dest = blocks_.back().data.get() + block_used_;
+    memcpy(dest, val.data(), val.size());
+    block_used_ += val.size();
+    return std::string_view(dest, val.size());
+  }
+
+  struct Block {
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+  std::vector<std::string_view> views_;
+  std::vector<Block> blocks_;
+  size_t block_used_ = 0;
+  int64_t data_bytes_ = 0;
+};
+
 // PL_CARNOT_UPDATE_FOR_NEW_TYPES.
 using BoolValueColumnWrapper = ColumnWrapperTmpl<BoolValue>;
 using Int64ValueColumnWrapper = ColumnWrapperTmpl<Int64Value>;
@@ -207,28 +420,8 @@ using Time64NSValueColumnWrapper = ColumnWrapperTmpl<Time64NSValue>;
 template <typename TColumnWrapper, types::DataType DType>
 inline SharedColumnWrapper FromArrowImpl(const std::shared_ptr<arrow::Array>& arr) {
   CHECK_EQ(arr->type_id(), DataTypeTraits<DType>::arrow_type_id);
-  size_t size = arr->length();
-  auto wrapper = TColumnWrapper::Make(DType, size);
-  auto arr_casted = static_cast<typename DataTypeTraits<DType>::arrow_array_type*>(arr.get());
-  typename DataTypeTraits<DType>::value_type* out_data =
-      static_cast<TColumnWrapper*>(wrapper.get())->UnsafeRawData();
-  for (size_t i = 0; i < size; ++i) {
-    out_data[i] = arr_casted->Value(i);
-  }
-  return wrapper;
-}
-
-template <>
-inline SharedColumnWrapper FromArrowImpl<StringValueColumnWrapper, DataType::STRING>(
-    const std::shared_ptr<arrow::Array>& arr) {
-  CHECK_EQ(arr->type_id(), DataTypeTraits<types::STRING>::arrow_type_id);
-  size_t size = arr->length();
-  auto wrapper = StringValueColumnWrapper::Make(types::STRING, size);
-  auto arr_casted = static_cast<arrow::StringArray*>(arr.get());
-  StringValue* out_data = static_cast<StringValueColumnWrapper*>(wrapper.get())->UnsafeRawData();
-  for (size_t i = 0; i < size; ++i) {
-    out_data[i] = arr_casted->GetString(i);
-  }
+  auto wrapper = TColumnWrapper::Make(DType, 0);
+  wrapper->AppendFromArrow(*arr, 0, arr->length());
   return wrapper;
 }
 
@@ -275,10 +468,16 @@ inline void ColumnWrapper::Append(TValueType val) {
   CHECK_EQ(data_type(), ValueTypeTraits<TValueType>::data_type)
       << "Expect " << ToString(data_type()) << " got "
       << ToString(ValueTypeTraits<TValueType>::data_type);
-  static_cast<ColumnWrapperTmpl<TValueType>*>(this)->Append(val);
+  if constexpr (std::is_same_v<TValueType, StringValue>) {
+    // Strings go through the virtual interface, since the wrapper may not store StringValue's
+    // directly (e.g. ArenaStringColumnWrapper).
+    AppendString(val);
+  } else {
+    static_cast<ColumnWrapperTmpl<TValueType>*>(this)->Append(val);
+  }
 }
 
-template <class TValueType>
+template <class TValueType, typename>
 inline TValueType& ColumnWrapper::Get(size_t idx) {
   CHECK_EQ(data_type(), ValueTypeTraits<TValueType>::data_type);
   return static_cast<ColumnWrapperTmpl<TValueType>*>(this)->operator[](idx);
@@ -287,7 +486,36 @@ inline TValueType& ColumnWrapper::Get(size_t idx) {
 template <class TValueType>
 inline TValueType ColumnWrapper::Get(size_t idx) const {
   CHECK_EQ(data_type(), ValueTypeTraits<TValueType>::data_type);
-  return static_cast<const ColumnWrapperTmpl<TValueType>*>(this)->operator[](idx);
+  if constexpr (std::is_same_v<TValueType, StringValue>) {
+    return StringValue(std::string(GetView(idx)));
+  } else {
+    return static_cast<const ColumnWrapperTmpl<TValueType>*>(this)->operator[](idx);
+  }
+}
+
+template <class TValueType>
+inline void ColumnWrapper::AppendSpan(const TValueType* vals, size_t count) {
+  CHECK_EQ(data_type(), ValueTypeTraits<TValueType>::data_type)
+      << "Expect " << ToString(data_type()) << " got "
+      << ToString(ValueTypeTraits<TValueType>::data_type);
+  if constexpr (std::is_same_v<TValueType, StringValue>) {
+    // Strings go through the virtual interface, since the wrapper may not store StringValue's
+    // directly (e.g. ArenaStringColumnWrapper).
+    Reserve(Size() + count);
+    for (size_t i = 0; i < count; ++i) {
+      AppendString(vals[i]);
+    }
+  } else {
+    static_cast<ColumnWrapperTmpl<TValueType>*>(this)->AppendSpan(vals, count);
+  }
+}
+
+template <class TValueType, typename>
+inline TValueType* ColumnWrapper::AppendUninitialized(size_t count) {
+  CHECK_EQ(data_type(), ValueTypeTraits<TValueType>::data_type)
+      << "Expect " << ToString(data_type()) << " got "
+      << ToString(ValueTypeTraits<TValueType>::data_type);
+  return static_cast<ColumnWrapperTmpl<TValueType>*>(this)->AppendUninitialized(count);
 }
 
 template <class TValueType>
@@ -375,7 +603,9 @@ class ColumnWrapperIterator : public std::iterator<std::bidirectional_iterator_t
 
   ReturnType operator*() const {
     if constexpr (std::is_same_v<ValueType, StringValue>) {
-      return column_->Get<ValueType>(curr_idx_);
+      // Use the virtual GetView interface so that this also works for column wrappers that don't
+      // store StringValue's directly (e.g. ArenaStringColumnWrapper).
+      return std::string(column_->GetView(curr_idx_));
     } else {
       return column_->Get<ValueType>(curr_idx_).val;
     }
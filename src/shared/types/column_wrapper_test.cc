@@ -283,5 +283,121 @@ TEST(ColumnWrapperTest, MoveIndexes) {
   }
 }
 
+TEST(ArenaStringColumnWrapperTest, AppendAndRead) {
+  ArenaStringColumnWrapper wrapper;
+  wrapper.Append("hello");
+  wrapper.Append("");
+  wrapper.Append("world");
+
+  EXPECT_EQ(3, wrapper.Size());
+  EXPECT_EQ(DataType::STRING, wrapper.data_type());
+  EXPECT_EQ("hello", wrapper.GetView(0));
+  EXPECT_EQ("", wrapper.GetView(1));
+  EXPECT_EQ("world", wrapper.GetView(2));
+}
+
+TEST(ArenaStringColumnWrapperTest, ConvertToArrow) {
+  ArenaStringColumnWrapper wrapper;
+  wrapper.Append("abc");
+  wrapper.Append("d");
+  auto arr = wrapper.ConvertToArrow(arrow::default_memory_pool());
+  ASSERT_EQ(DataTypeTraits<DataType::STRING>::arrow_type_id, arr->type_id());
+  auto str_arr = static_cast<arrow::StringArray*>(arr.get());
+  EXPECT_EQ("abc", str_arr->GetString(0));
+  EXPECT_EQ("d", str_arr->GetString(1));
+}
+
+TEST(ArenaStringColumnWrapperTest, GrowsPastBlockSize) {
+  ArenaStringColumnWrapper wrapper;
+  std::string big(ArenaStringColumnWrapper::kMinBlockSize * 2, 'x');
+  for (int i = 0; i < 100; ++i) {
+    wrapper.Append("small");
+    wrapper.Append(big);
+  }
+  ASSERT_EQ(200, wrapper.Size());
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ("small", wrapper.GetView(2 * i));
+    EXPECT_EQ(big, wrapper.GetView(2 * i + 1));
+  }
+}
+
+TEST(ArenaStringColumnWrapperTest, CopyAndMoveIndexes) {
+  ArenaStringColumnWrapper wrapper;
+  wrapper.Append("a");
+  wrapper.Append("bb");
+  wrapper.Append("ccc");
+
+  auto copied = wrapper.CopyIndexes({2, 0});
+  ASSERT_EQ(2, copied->Size());
+  EXPECT_EQ("ccc", copied->GetView(0));
+  EXPECT_EQ("a", copied->GetView(1));
+
+  auto moved = wrapper.MoveIndexes({1});
+  ASSERT_EQ(1, moved->Size());
+  EXPECT_EQ("bb", moved->GetView(0));
+}
+
+TEST(ColumnWrapperBulkTest, AppendSpanInt64) {
+  auto wrapper = ColumnWrapper::Make(DataType::INT64, 0);
+  std::vector<Int64Value> vals({1, 2, 3, 4, 5});
+  wrapper->AppendSpan(vals.data(), vals.size());
+  ASSERT_EQ(5, wrapper->Size());
+  EXPECT_EQ(1, wrapper->Get<Int64Value>(0).val);
+  EXPECT_EQ(5, wrapper->Get<Int64Value>(4).val);
+}
+
+TEST(ColumnWrapperBulkTest, AppendSpanStringOnArenaWrapper) {
+  auto wrapper = std::make_shared<ArenaStringColumnWrapper>();
+  std::vector<StringValue> vals({"abc", "", "defg"});
+  wrapper->AppendSpan(vals.data(), vals.size());
+  ASSERT_EQ(3, wrapper->Size());
+  EXPECT_EQ("abc", wrapper->GetView(0));
+  EXPECT_EQ("", wrapper->GetView(1));
+  EXPECT_EQ("defg", wrapper->GetView(2));
+}
+
+TEST(ColumnWrapperBulkTest, AppendUninitializedThenFill) {
+  auto wrapper = ColumnWrapper::Make(DataType::FLOAT64, 0);
+  Float64Value* region = wrapper->AppendUninitialized<Float64Value>(3);
+  region[0] = 1.5;
+  region[1] = 2.5;
+  region[2] = 3.5;
+  ASSERT_EQ(3, wrapper->Size());
+  EXPECT_DOUBLE_EQ(2.5, wrapper->Get<Float64Value>(1).val);
+}
+
+TEST(ColumnWrapperBulkTest, AppendFromArrowSlice) {
+  arrow::Int64Builder builder;
+  PL_CHECK_OK(builder.AppendValues({10, 20, 30, 40, 50}));
+  std::shared_ptr<arrow::Array> arr;
+  PL_CHECK_OK(builder.Finish(&arr));
+
+  auto wrapper = ColumnWrapper::Make(DataType::INT64, 0);
+  wrapper->AppendFromArrow(*arr, /*offset*/ 1, /*length*/ 3);
+  ASSERT_EQ(3, wrapper->Size());
+  EXPECT_EQ(20, wrapper->Get<Int64Value>(0).val);
+  EXPECT_EQ(40, wrapper->Get<Int64Value>(2).val);
+}
+
+TEST(ColumnWrapperBulkTest, AppendFromArrowStringSlice) {
+  arrow::StringBuilder builder;
+  PL_CHECK_OK(builder.Append("abc"));
+  PL_CHECK_OK(builder.Append("def"));
+  PL_CHECK_OK(builder.Append("ghi"));
+  std::shared_ptr<arrow::Array> arr;
+  PL_CHECK_OK(builder.Finish(&arr));
+
+  auto wrapper = ColumnWrapper::Make(DataType::STRING, 0);
+  wrapper->AppendFromArrow(*arr, /*offset*/ 1, /*length*/ 2);
+  ASSERT_EQ(2, wrapper->Size());
+  EXPECT_EQ("def", wrapper->GetView(0));
+  EXPECT_EQ("ghi", wrapper->GetView(1));
+
+  ArenaStringColumnWrapper arena_wrapper;
+  arena_wrapper.AppendFromArrow(*arr, /*offset*/ 0, /*length*/ 3);
+  ASSERT_EQ(3, arena_wrapper.Size());
+  EXPECT_EQ("abc", arena_wrapper.GetView(0));
+}
+
 }  // namespace types
 }  // namespace px
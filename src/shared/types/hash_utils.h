@@ -63,6 +63,13 @@ struct hash<Time64NSValue> {
   }
 };
 
+template <>
+struct hash<UInt128Value> {
+  uint64_t operator()(const UInt128Value& val) {
+    return ::util::Hash64(reinterpret_cast<const char*>(&(val.val)), sizeof(absl::uint128));
+  }
+};
+
 }  // namespace utils
 }  // namespace types
 }  // namespace px
@@ -60,6 +60,13 @@ TEST(HashUtils, Time64NSValue) {
   EXPECT_NE(hash<Time64NSValue>{}(v1), hash<Time64NSValue>{}(v2));
 }
 
+TEST(HashUtils, UInt128Value) {
+  UInt128Value v1(0, 1);
+  UInt128Value v2(1, 0);
+
+  EXPECT_NE(hash<UInt128Value>{}(v1), hash<UInt128Value>{}(v2));
+}
+
 }  // namespace utils
 }  // namespace types
 }  // namespace px
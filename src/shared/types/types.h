@@ -23,9 +23,11 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -198,6 +200,91 @@ struct StringValue : BaseValueType, public std::string {
   const std::string& string() { return *this; }
 };
 
+/**
+ * SmallStringValue stores short strings inline, without a heap allocation.
+ *
+ * std::string (and therefore StringValue) only keeps ~15 bytes inline; typical tracing fields
+ * (HTTP methods, status codes, pod and service names) are short but often exceed that, so
+ * row-wise containers that materialize them pay one allocation per value. SmallStringValue keeps
+ * up to kInlineCapacity bytes in place within the same 32-byte footprint as std::string, and
+ * falls back to a heap block only for longer values.
+ *
+ * This is a storage type for row-wise containers (e.g. RowTuple group/join keys), not a
+ * UDF-facing value type: UDFs continue to take and return StringValue.
+ */
+class SmallStringValue {
+ public:
+  static constexpr size_t kInlineCapacity = 22;
+
+  SmallStringValue() = default;
+  explicit SmallStringValue(std::string_view val) { Assign(val); }
+  SmallStringValue(const SmallStringValue& other) { Assign(other.view()); }
+  SmallStringValue(SmallStringValue&& other) noexcept { MoveFrom(&other); }
+  SmallStringValue& operator=(const SmallStringValue& other) {
+    if (this != &other) {
+      Release();
+      Assign(other.view());
+    }
+    return *this;
+  }
+  SmallStringValue& operator=(SmallStringValue&& other) noexcept {
+    if (this != &other) {
+      Release();
+      MoveFrom(&other);
+    }
+    return *this;
+  }
+  ~SmallStringValue() { Release(); }
+
+  std::string_view view() const {
+    return std::string_view(size_ <= kInlineCapacity ? data_.inlined : data_.heap, size_);
+  }
+  // NOLINTNEXTLINE: implicit conversion, to make comparisons/hashing natural.
+  operator std::string_view() const { return view(); }
+  size_t size() const { return size_; }
+
+  bool operator==(const SmallStringValue& other) const { return view() == other.view(); }
+  bool operator!=(const SmallStringValue& other) const { return view() != other.view(); }
+
+ private:
+  void Assign(std::string_view val) {
+    size_ = val.size();
+    char* dst = data_.inlined;
+    if (size_ > kInlineCapacity) {
+      data_.heap = new char[size_];
+      dst = data_.heap;
+    }
+    if (size_ != 0) {
+      memcpy(dst, val.data(), size_);
+    }
+  }
+  void MoveFrom(SmallStringValue* other) {
+    size_ = other->size_;
+    if (size_ <= kInlineCapacity) {
+      memcpy(data_.inlined, other->data_.inlined, size_);
+    } else {
+      data_.heap = other->data_.heap;
+      // The moved-from value must no longer own the heap block.
+      other->size_ = 0;
+    }
+  }
+  void Release() {
+    if (size_ > kInlineCapacity) {
+      delete[] data_.heap;
+    }
+    size_ = 0;
+  }
+
+  size_t size_ = 0;
+  union {
+    char inlined[kInlineCapacity];
+    char* heap;
+  } data_ = {};
+};
+
+static_assert(sizeof(SmallStringValue) <= 32,
+              "SmallStringValue should not be larger than std::string");
+
 /**
  * Get the value out of the fixed sized union (by type).
  * @tparam T The type to pull out.
@@ -322,7 +409,7 @@ struct ValueTypeTraits<UInt128Value> {
   static constexpr DataType data_type = types::UINT128;
   using arrow_type = arrow::UInt128Type;
   using arrow_builder_type = arrow::UInt128Builder;
-  using arrow_array_type = arrow::UInt128Type;
+  using arrow_array_type = arrow::UInt128Array;
   using native_type = absl::uint128;
 };
 
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <absl/hash/hash.h>
@@ -106,6 +107,12 @@ class UPID {
   absl::uint128 value_ = 0;
 };
 
+// UPIDs are hashed and compared on every join, group-by, and tracker lookup, so the
+// representation must stay a single packed 128-bit value: equality is one 128-bit compare and
+// hashing mixes the two 64-bit halves directly, with no serialization in between.
+static_assert(sizeof(UPID) == 16, "UPID must remain a packed 16-byte value");
+static_assert(std::is_trivially_copyable_v<UPID>, "UPID must remain trivially copyable");
+
 // Needed for gtest to print UPID.
 inline std::ostream& operator<<(std::ostream& os, const md::UPID& upid) {
   os << upid.String();
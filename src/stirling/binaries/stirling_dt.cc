@@ -64,7 +64,12 @@ Status StirlingWrapperCallback(uint64_t table_id, TabletID /* tablet_id */,
   }
   const InfoClass& table_info = iter->second;
 
-  std::cout << ToString(table_info.schema().name(), table_info.schema(), *record_batch);
+  // Reused across callbacks (guarded by g_callback_state_lock), so printing a batch performs a
+  // single buffered write instead of per-record string constructions and stream insertions.
+  static std::string print_buffer;
+  print_buffer.clear();
+  ToString(table_info.schema().name(), table_info.schema(), *record_batch, &print_buffer);
+  std::cout.write(print_buffer.data(), print_buffer.size());
 
   return Status::OK();
 }
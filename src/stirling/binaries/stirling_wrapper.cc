@@ -49,6 +49,7 @@ using ::px::stirling::IndexPublication;
 using ::px::stirling::SourceConnectorGroup;
 using ::px::stirling::SourceRegistry;
 using ::px::stirling::Stirling;
+using ::px::stirling::ToJSON;
 using ::px::stirling::ToString;
 using ::px::stirling::stirlingpb::InfoClass;
 using ::px::stirling::stirlingpb::Publish;
@@ -68,6 +69,8 @@ DEFINE_bool(init_only, false, "If true, only runs the init phase and exits. For
 DEFINE_int32(timeout_secs, -1,
              "If non-negative, only runs for the specified amount of time and exits.");
 DEFINE_bool(color_output, true, "If true, output logs will use colors.");
+DEFINE_bool(json_output, false,
+            "If true, prints records as newline-delimited JSON instead of the debug text format.");
 DEFINE_bool(enable_heap_profiler, false, "If true, heap profiling is enabled.");
 
 // Put this in global space, so we can kill it in the signal handler.
@@ -83,6 +86,10 @@ absl::flat_hash_set<std::string> g_table_print_enables;
 absl::flat_hash_map<uint64_t, InfoClass> g_table_info_map;
 absl::base_internal::SpinLock g_callback_state_lock;
 
+// Reused across callbacks (guarded by g_callback_state_lock), so printing a batch performs a
+// single buffered write instead of per-record string constructions and stream insertions.
+std::string g_print_buffer;
+
 Status StirlingWrapperCallback(uint64_t table_id, TabletID /* tablet_id */,
                                std::unique_ptr<ColumnWrapperRecordBatch> record_batch) {
   absl::base_internal::SpinLockHolder lock(&g_callback_state_lock);
@@ -96,7 +103,13 @@ Status StirlingWrapperCallback(uint64_t table_id, TabletID /* tablet_id */,
 
   if (g_table_print_enables.contains(table_info.schema().name())) {
     // Only output enabled tables (lookup by name).
-    std::cout << ToString(table_info.schema().name(), table_info.schema(), *record_batch);
+    g_print_buffer.clear();
+    if (FLAGS_json_output) {
+      ToJSON(table_info.schema(), *record_batch, &g_print_buffer);
+    } else {
+      ToString(table_info.schema().name(), table_info.schema(), *record_batch, &g_print_buffer);
+    }
+    std::cout.write(g_print_buffer.data(), g_print_buffer.size());
   }
 
   return Status::OK();
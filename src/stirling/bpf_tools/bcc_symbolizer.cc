@@ -18,6 +18,9 @@
 
 #include <linux/elf.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "src/common/base/base.h"
 #include "src/stirling/bpf_tools/bcc_symbolizer.h"
 
@@ -40,18 +43,14 @@ void* BCCSymbolizer::GetBCCSymbolCache(const int pid) {
   return iter->second;
 }
 
-std::string_view BCCSymbolizer::SymbolOrAddrIfUnknown(const int pid, const uintptr_t addr) {
-  DCHECK(pid >= 0 || pid == -1);
-
-  void* bcc_symbol_cache = GetBCCSymbolCache(pid);
+void BCCSymbolizer::ResolveSymbol(void* bcc_symbol_cache, const uintptr_t addr, std::string* out) {
   const bool resolved = 0 == bcc_symcache_resolve(bcc_symbol_cache, addr, &bcc_symbol_struct_);
 
   if (resolved) {
     // Symbol was resolved. Our work is done here.
-    symbol_ = bcc_symbol_struct_.demangle_name;
+    *out = bcc_symbol_struct_.demangle_name;
     bcc_symbol_free_demangle_name(&bcc_symbol_struct_);
-
-    return symbol_;
+    return;
   }
 
   if (bcc_symbol_struct_.module != nullptr && strlen(bcc_symbol_struct_.module) > 0) {
@@ -59,17 +58,53 @@ std::string_view BCCSymbolizer::SymbolOrAddrIfUnknown(const int pid, const uintp
     // We will create a string like this:
     // [m] /lib/ld-musl-x86_64.so.1 + 0x0000abcd
     // This is better than nothing, but not as nice as a symbol.
-    FormatModuleName(bcc_symbol_struct_.module, bcc_symbol_struct_.offset);
-    return symbol_;
+    *out = absl::StrFormat("[m] %s + 0x%08llx", bcc_symbol_struct_.module,
+                           bcc_symbol_struct_.offset);
+    return;
   }
 
   // If we fall through to here, we have truly come up empty handed.
   // Maybe it is a JIT'd or interpreted program? Maybe stack traces are broken (no frame pointers)?
   // We return just the virtual address, as a string, formatted in 64b hex.
-  FormatAddress(addr);
+  *out = absl::StrFormat("0x%016llx", addr);
+}
+
+std::string_view BCCSymbolizer::SymbolOrAddrIfUnknown(const int pid, const uintptr_t addr) {
+  DCHECK(pid >= 0 || pid == kKernelPID);
+
+  ResolveSymbol(GetBCCSymbolCache(pid), addr, &symbol_);
   return symbol_;
 }
 
+std::vector<std::string_view> BCCSymbolizer::SymbolsOrAddrsIfUnknown(
+    const int pid, absl::Span<const uintptr_t> addrs) {
+  DCHECK(pid >= 0 || pid == kKernelPID);
+
+  void* bcc_symbol_cache = GetBCCSymbolCache(pid);
+
+  // Resolve each distinct address only once, in ascending order: stacks commonly repeat
+  // addresses (e.g. recursion), and sorted resolution gives the module map lookups locality.
+  std::vector<uintptr_t> unique_addrs(addrs.begin(), addrs.end());
+  std::sort(unique_addrs.begin(), unique_addrs.end());
+  unique_addrs.erase(std::unique(unique_addrs.begin(), unique_addrs.end()), unique_addrs.end());
+
+  batch_symbol_table_.clear();
+  absl::flat_hash_map<uintptr_t, std::string_view> symbols_by_addr;
+  symbols_by_addr.reserve(unique_addrs.size());
+  for (const uintptr_t addr : unique_addrs) {
+    std::string& symbol = batch_symbol_table_.emplace_back();
+    ResolveSymbol(bcc_symbol_cache, addr, &symbol);
+    symbols_by_addr.emplace(addr, symbol);
+  }
+
+  std::vector<std::string_view> result;
+  result.reserve(addrs.size());
+  for (const uintptr_t addr : addrs) {
+    result.push_back(symbols_by_addr[addr]);
+  }
+  return result;
+}
+
 void BCCSymbolizer::ReleasePIDSymCache(uint32_t pid) {
   auto iter = bcc_symbol_caches_by_pid_.find(pid);
   if (iter != bcc_symbol_caches_by_pid_.end()) {
@@ -28,7 +28,11 @@
 #undef DECLARE_ERROR
 #endif
 
+#include <deque>
 #include <string>
+#include <vector>
+
+#include <absl/types/span.h>
 
 namespace px {
 namespace stirling {
@@ -51,6 +55,16 @@ class BCCSymbolizer {
    */
   std::string_view SymbolOrAddrIfUnknown(int pid, uintptr_t addr);
 
+  /**
+   * Batch version of SymbolOrAddrIfUnknown(): symbolizes all addresses of one PID
+   * (e.g. the frames of one stack trace) in a single call. Each distinct address is
+   * resolved only once, in sorted order. The returned views are parallel to the input,
+   * point into a string table owned by this class, and remain valid until the next call
+   * to this function.
+   */
+  std::vector<std::string_view> SymbolsOrAddrsIfUnknown(int pid,
+                                                        absl::Span<const uintptr_t> addrs);
+
   /**
    * Release any cached resources, such as loaded symbol tables, for the given PID.
    * If the PID is accessed again, the required data will be loaded again.
@@ -59,17 +73,11 @@ class BCCSymbolizer {
 
  private:
   /**
-   * FormatModuleName(): populates symbol_ when the memory region is known, but symbol is not.
-   */
-  void FormatModuleName(char const* const module, const uintptr_t offset) {
-    symbol_ = absl::StrFormat("[m] %s + 0x%08llx", module, offset);
-  }
-
-  /**
-   * FormatAddress(): populates symbol_ with a stringified addr. (64b hex).
-   * used when no memory region or symbol known is known.
+   * ResolveSymbol(): resolves one address into out, falling back to the module name plus
+   * offset when only the memory region is known, and to the stringified address (64b hex)
+   * when neither is known.
    */
-  void FormatAddress(const uintptr_t addr) { symbol_ = absl::StrFormat("0x%016llx", addr); }
+  void ResolveSymbol(void* bcc_symbol_cache, uintptr_t addr, std::string* out);
 
   /**
    * GetBCCSymbolCache() returns a pointer to a BCC symbol cache. Use of void* is inherited
@@ -104,6 +112,13 @@ class BCCSymbolizer {
    * the main public API of this class.
    */
   std::string symbol_;
+
+  /**
+   * batch_symbol_table_ owns the strings behind the views returned by
+   * SymbolsOrAddrsIfUnknown(), one entry per distinct address in the batch. A deque keeps
+   * the strings stable while the table grows; the table is cleared at the start of each batch.
+   */
+  std::deque<std::string> batch_symbol_table_;
 };
 
 }  // namespace bpf_tools
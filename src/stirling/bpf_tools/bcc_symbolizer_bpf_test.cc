@@ -48,6 +48,25 @@ TEST(BCCSymbolizer, SymbolOrAddrIfUnknown) {
   EXPECT_EQ(symbolizer.SymbolOrAddrIfUnknown(pid, 123), "0x000000000000007b");
 }
 
+TEST(BCCSymbolizer, SymbolsOrAddrsIfUnknown) {
+  BCCSymbolizer symbolizer;
+
+  const pid_t pid = getpid();
+
+  // Duplicates and an unresolvable address, deliberately out of order.
+  const std::vector<uintptr_t> addrs = {kBarAddr, kFooAddr, 123, kFooAddr};
+  const std::vector<std::string_view> symbols = symbolizer.SymbolsOrAddrsIfUnknown(pid, addrs);
+
+  ASSERT_EQ(symbols.size(), addrs.size());
+  EXPECT_EQ(symbols[0], "test::Bar()");
+  EXPECT_EQ(symbols[1], "test::Foo()");
+  EXPECT_EQ(symbols[2], "0x000000000000007b");
+  EXPECT_EQ(symbols[3], "test::Foo()");
+
+  // Duplicate addresses resolve to views of the same underlying string.
+  EXPECT_EQ(symbols[1].data(), symbols[3].data());
+}
+
 TEST(BCCSymbolizer, KernelSymbol) {
   std::string_view kSymbolName = "cpu_detect";
   ASSERT_OK_AND_ASSIGN(uint64_t sym_addr, GetKernelSymAddr(kSymbolName));
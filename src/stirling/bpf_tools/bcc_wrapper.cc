@@ -22,6 +22,7 @@
 #include <sys/mount.h>
 
 #include <iostream>
+#include <mutex>
 #include <string>
 
 #include <magic_enum.hpp>
@@ -30,8 +31,15 @@
 #include "src/common/fs/fs_wrapper.h"
 #include "src/common/system/config.h"
 #include "src/stirling/bpf_tools/task_struct_resolver.h"
+#include "src/stirling/bpf_tools/utils.h"
 #include "src/stirling/utils/linux_headers.h"
 
+DEFINE_bool(stirling_enable_ringbuf_output,
+            gflags::BoolFromEnv("PL_STIRLING_ENABLE_RINGBUF_OUTPUT", false),
+            "If true, BPF-based connectors export their events through BPF ring buffers "
+            "(one shared buffer per output) instead of per-CPU perf buffers. "
+            "Requires kernel 5.8+; on older kernels it silently falls back to perf buffers.");
+
 namespace px {
 namespace stirling {
 namespace bpf_tools {
@@ -105,6 +113,18 @@ Status BCCWrapper::InitBPFProgram(std::string_view bpf_program, std::vector<std:
     return error::PermissionDenied("BCC currently only supported as the root user.");
   }
 
+  LOG_FIRST_N(INFO, 1) << absl::Substitute(
+      "Kernel BTF support: $0. BPF programs are compiled at runtime via BCC.",
+      IsHostBTFSupported() ? "available" : "not available");
+
+  // Environment setup (Linux header installation, task_struct offset resolution and debugfs
+  // mounting) touches shared system state, so it is serialized across BCCWrapper instances.
+  // The compile in bpf_.init() below is deliberately outside the critical section: each BPF
+  // instance owns its own LLVM context, so compiles of different instances may run concurrently
+  // (e.g. when source connectors are initialized in parallel at startup).
+  static std::mutex env_setup_mu;
+  std::unique_lock<std::mutex> env_setup_lock(env_setup_mu);
+
   if (requires_linux_headers) {
     auto kernel_version = utils::GetCachedKernelVersion();
 
@@ -165,6 +185,8 @@ Status BCCWrapper::InitBPFProgram(std::string_view bpf_program, std::vector<std:
 
   PL_RETURN_IF_ERROR(MountDebugFS());
 
+  env_setup_lock.unlock();
+
   auto init_res = bpf_.init(std::string(bpf_program), cflags);
   if (!init_res.ok()) {
     return error::Internal("Unable to initialize BCC BPF program: $0", init_res.msg());
@@ -231,6 +253,24 @@ Status BCCWrapper::AttachSamplingProbe(const SamplingProbeSpec& probe) {
   return AttachPerfEvent(perf_event_spec);
 }
 
+Status BCCWrapper::ResetSamplingProbePeriod(const SamplingProbeSpec& probe) {
+  // Sampling probes are perf events on the software CPU clock (see AttachSamplingProbe),
+  // so find the corresponding perf event by its type and config.
+  auto iter = perf_events_.begin();
+  while (iter != perf_events_.end() &&
+         !(iter->type == PERF_TYPE_SOFTWARE && iter->config == PERF_COUNT_SW_CPU_CLOCK)) {
+    ++iter;
+  }
+  if (iter == perf_events_.end()) {
+    return error::NotFound("No attached sampling probe found.");
+  }
+
+  PL_RETURN_IF_ERROR(DetachPerfEvent(*iter));
+  perf_events_.erase(iter);
+
+  return AttachSamplingProbe(probe);
+}
+
 Status BCCWrapper::AttachKProbes(const ArrayView<KProbeSpec>& probes) {
   for (const KProbeSpec& p : probes) {
     PL_RETURN_IF_ERROR(AttachKProbe(p));
@@ -360,6 +400,47 @@ Status BCCWrapper::OpenPerfBuffers(const ArrayView<PerfBufferSpec>& perf_buffers
   return Status::OK();
 }
 
+bool BCCWrapper::UseRingBufOutput() {
+  if (!FLAGS_stirling_enable_ringbuf_output) {
+    return false;
+  }
+  // BPF ring buffers require the bpf_ringbuf_* helpers, which landed in Linux 5.8.
+  constexpr uint32_t kLinux5p8VersionCode = 329728;
+  if (utils::GetCachedKernelVersion().code() < kLinux5p8VersionCode) {
+    LOG_FIRST_N(WARNING, 1) << "--stirling_enable_ringbuf_output requires kernel 5.8 or later. "
+                               "Falling back to perf buffer output.";
+    return false;
+  }
+  return true;
+}
+
+Status BCCWrapper::OpenRingBuffer(const RingBufferSpec& ring_buffer, void* cb_cookie) {
+  LOG(INFO) << absl::Substitute("Opening ring buffer: $0 (shared across cpus)", ring_buffer.name);
+  PL_RETURN_IF_ERROR(
+      bpf_.open_ring_buf(std::string(ring_buffer.name), ring_buffer.probe_output_fn, cb_cookie));
+  ring_buffers_.push_back(ring_buffer);
+  ++num_open_ring_buffers_;
+  return Status::OK();
+}
+
+Status BCCWrapper::OpenRingBuffers(const ArrayView<RingBufferSpec>& ring_buffers, void* cb_cookie) {
+  for (const RingBufferSpec& r : ring_buffers) {
+    PL_RETURN_IF_ERROR(OpenRingBuffer(r, cb_cookie));
+  }
+  return Status::OK();
+}
+
+void BCCWrapper::CloseRingBuffers() {
+  if (ring_buffers_.empty()) {
+    return;
+  }
+  VLOG(1) << "Closing ring buffers";
+  // All ring buffers are registered with a single shared manager, so they are closed together.
+  bpf_.close_ring_buf();
+  num_open_ring_buffers_ -= ring_buffers_.size();
+  ring_buffers_.clear();
+}
+
 Status BCCWrapper::ClosePerfBuffer(const PerfBufferSpec& perf_buffer) {
   VLOG(1) << "Closing perf buffer: " << perf_buffer.name;
   PL_RETURN_IF_ERROR(bpf_.close_perf_buffer(std::string(perf_buffer.name)));
@@ -430,9 +511,18 @@ void BCCWrapper::PollPerfBuffers(int timeout_ms) {
   }
 }
 
+void BCCWrapper::PollRingBuffers(int timeout_ms) {
+  if (ring_buffers_.empty()) {
+    return;
+  }
+  // A single epoll-backed manager drains all opened ring buffers.
+  bpf_.poll_ring_buf(timeout_ms);
+}
+
 void BCCWrapper::Close() {
   DetachPerfEvents();
   ClosePerfBuffers();
+  CloseRingBuffers();
   DetachKProbes();
   DetachUProbes();
   DetachTracepoints();
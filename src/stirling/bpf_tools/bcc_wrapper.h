@@ -47,6 +47,8 @@
 #include "src/stirling/bpf_tools/task_struct_resolver.h"
 #include "src/stirling/obj_tools/elf_reader.h"
 
+DECLARE_bool(stirling_enable_ringbuf_output);
+
 namespace px {
 /*
  * Status adapter for ebpf::StatusTuple.
@@ -196,6 +198,22 @@ struct PerfBufferSpec {
   PerfBufferSizeCategory size_category = PerfBufferSizeCategory::kUncategorized;
 };
 
+/**
+ * Describes a BPF ring buffer (BPF_RINGBUF_OUTPUT), through which data is returned to user-space.
+ * Unlike perf buffers, a ring buffer is shared across all CPUs and is drained through a single
+ * epoll-driven manager, avoiding the per-CPU wakeup-and-copy overhead. Requires kernel 5.8+.
+ */
+struct RingBufferSpec {
+  // Name of the ring buffer.
+  // Must be the same as the ring buffer name declared in the probe code with BPF_RINGBUF_OUTPUT.
+  std::string name;
+
+  // Function that will be called for every record in the ring buffer,
+  // when a ring buffer poll is triggered.
+  // Should return 0; a negative return value stops the current drain.
+  int (*probe_output_fn)(void* cb_cookie, void* data, size_t data_size);
+};
+
 /**
  * Describes a perf event to attach.
  * This can be run stand-alone and is not dependent on kProbes.
@@ -286,6 +304,14 @@ class BCCWrapper {
    */
   Status AttachSamplingProbe(const SamplingProbeSpec& probe);
 
+  /**
+   * Change the period of an already-attached sampling probe.
+   * The underlying perf event is detached and re-attached with the new period.
+   * @param probe Specifications of the probe, with the new sampling period.
+   * @return Error if no sampling probe is attached, or if the re-attach fails.
+   */
+  Status ResetSamplingProbePeriod(const SamplingProbeSpec& probe);
+
   /**
    * Open a perf buffer for reading events.
    * @param perf_buff Specifications of the perf buffer (name, callback function, etc.).
@@ -295,6 +321,24 @@ class BCCWrapper {
    */
   Status OpenPerfBuffer(const PerfBufferSpec& perf_buffer, void* cb_cookie = nullptr);
 
+  /**
+   * Open a BPF ring buffer for reading records. All opened ring buffers are registered with a
+   * single shared manager, so one PollRingBuffers() call drains all of them through one epoll fd.
+   * @param ring_buffer Specifications of the ring buffer (name, callback function).
+   * @param cb_cookie A pointer that is sent to the callback function when triggered by
+   * PollRingBuffers().
+   * @return Error if the ring buffer cannot be opened (e.g. kernel lacks ring buffer support).
+   */
+  Status OpenRingBuffer(const RingBufferSpec& ring_buffer, void* cb_cookie = nullptr);
+
+  /**
+   * Whether BPF outputs should use ring buffers instead of per-CPU perf buffers.
+   * Returns true when --stirling_enable_ringbuf_output is set and the kernel supports BPF ring
+   * buffers (5.8+). On older kernels a warning is logged once and false is returned, so callers
+   * fall back to perf buffers.
+   */
+  static bool UseRingBufOutput();
+
   /**
    * Attach a perf event, which runs a probe every time a perf counter reaches a threshold
    * condition.
@@ -344,6 +388,14 @@ class BCCWrapper {
    */
   Status OpenPerfBuffers(const ArrayView<PerfBufferSpec>& perf_buffers, void* cb_cookie);
 
+  /**
+   * Convenience function that opens multiple ring buffers.
+   * @param ring_buffers Vector of ring buffer descriptors.
+   * @param cb_cookie Raw pointer returned on callback, typically used for tracking context.
+   * @return Error of first failure (remaining ring buffer opens are not attempted).
+   */
+  Status OpenRingBuffers(const ArrayView<RingBufferSpec>& ring_buffers, void* cb_cookie);
+
   /**
    * Convenience function that opens multiple perf events.
    * @param probes Vector of perf event descriptors.
@@ -379,7 +431,17 @@ class BCCWrapper {
   void PollPerfBuffers(int timeout_ms = 0);
 
   /**
-   * Detaches all probes, and closes all perf buffers that are open.
+   * Drains all of the opened ring buffers, calling the handle function that was
+   * specified in the RingBufferSpec when OpenRingBuffer was called.
+   *
+   * @param timeout_ms Amount of time to wait for a record to arrive if none is ready.
+   *                   Default is 0, matching PollPerfBuffers(): consume what is available
+   *                   and return, rather than blocking the caller's sampling loop.
+   */
+  void PollRingBuffers(int timeout_ms = 0);
+
+  /**
+   * Detaches all probes, and closes all perf buffers and ring buffers that are open.
    */
   void Close();
 
@@ -415,6 +477,7 @@ class BCCWrapper {
   // It is meant for verification that we have cleaned-up all resources in tests.
   static size_t num_attached_probes() { return num_attached_kprobes_ + num_attached_uprobes_; }
   static size_t num_open_perf_buffers() { return num_open_perf_buffers_; }
+  static size_t num_open_ring_buffers() { return num_open_ring_buffers_; }
   static size_t num_attached_perf_events() { return num_attached_perf_events_; }
 
  private:
@@ -433,6 +496,7 @@ class BCCWrapper {
   void DetachUProbes();
   void DetachTracepoints();
   void ClosePerfBuffers();
+  void CloseRingBuffers();
   void DetachPerfEvents();
 
   // Returns the name that identifies the target to attach this k-probe.
@@ -442,6 +506,7 @@ class BCCWrapper {
   std::vector<UProbeSpec> uprobes_;
   std::vector<TracepointSpec> tracepoints_;
   std::vector<PerfBufferSpec> perf_buffers_;
+  std::vector<RingBufferSpec> ring_buffers_;
   std::vector<PerfEventSpec> perf_events_;
 
   std::string system_headers_include_dir_;
@@ -466,6 +531,7 @@ class BCCWrapper {
   inline static size_t num_attached_uprobes_;
   inline static size_t num_attached_tracepoints_;
   inline static size_t num_open_perf_buffers_;
+  inline static size_t num_open_ring_buffers_;
   inline static size_t num_attached_perf_events_;
 
  private:
@@ -120,7 +120,10 @@ class BPFTraceWrapper {
   // The compiled BPF bytecode.
   bpftrace::BpfBytecode bytecode_;
 
-  std::mutex compilation_mutex_;
+  // Shared across all instances: BPFTrace compilation relies on global state
+  // (e.g. TracepointFormatParser's struct list), so compiles of different wrappers
+  // must be serialized as well (see comment in Compile()).
+  inline static std::mutex compilation_mutex_;
 
   bool compiled_ = false;
   bool printf_to_table_ = false;
@@ -38,6 +38,11 @@
 // Creates a string_view to the BPF code loaded into memory.
 BPF_SRC_STRVIEW(bcc_script, task_struct_mem_read);
 
+DEFINE_string(stirling_task_struct_offsets_cache_file, "/tmp/px_task_struct_offsets",
+              "File in which resolved task_struct offsets are cached, keyed by the kernel build "
+              "signature, so that restarts on the same kernel skip the BPF-based resolution. "
+              "An empty value disables the cache.");
+
 // A function which we will uprobe on, to trigger our BPF code.
 // The function itself is irrelevant, but it must not be optimized away.
 // We declare this with C linkage (extern "C") so it has a simple symbol name.
@@ -360,12 +365,89 @@ StatusOr<uint64_t> ResolveTaskStructExitCodeOffset() {
   return error::Internal("Could not find the requested exit code in the task_struct buffer");
 }
 
+// The resolved offsets depend only on the kernel build, so they are cached on disk keyed by
+// the kernel's build signature. The signature from /proc/version includes the release string,
+// build toolchain and build timestamp, so it changes whenever a kernel that could lay out
+// task_struct differently boots.
+StatusOr<std::string> KernelBuildSignature() {
+  PL_ASSIGN_OR_RETURN(std::string version, ReadFileToString("/proc/version"));
+  return std::string(absl::StripAsciiWhitespace(version));
+}
+
+// Cheap structural validation of cached offsets: each offset must lie within the buffer that
+// the BPF probe scans, and be aligned like the member it locates.
+bool OffsetsAreValid(const TaskStructOffsets& offsets) {
+  constexpr uint64_t kBufSize = sizeof(struct buf);
+  return offsets.real_start_time_offset != 0 &&
+         offsets.real_start_time_offset % sizeof(uint64_t) == 0 &&
+         offsets.real_start_time_offset < kBufSize && offsets.group_leader_offset != 0 &&
+         offsets.group_leader_offset % sizeof(uint64_t) == 0 &&
+         offsets.group_leader_offset < kBufSize && offsets.exit_code_offset != 0 &&
+         offsets.exit_code_offset % sizeof(uint32_t) == 0 && offsets.exit_code_offset < kBufSize;
+}
+
+StatusOr<TaskStructOffsets> ReadOffsetsCache(const std::string& signature) {
+  PL_ASSIGN_OR_RETURN(std::string contents,
+                      ReadFileToString(FLAGS_stirling_task_struct_offsets_cache_file));
+
+  std::vector<std::string_view> lines = absl::StrSplit(contents, '\n');
+  if (lines.size() < 2) {
+    return error::Internal("Malformed task_struct offsets cache file.");
+  }
+  if (lines[0] != signature) {
+    return error::NotFound("Cached task_struct offsets are for a different kernel.");
+  }
+
+  std::vector<std::string_view> fields = absl::StrSplit(lines[1], ' ');
+  TaskStructOffsets offsets;
+  if (fields.size() != 3 || !absl::SimpleAtoi(fields[0], &offsets.real_start_time_offset) ||
+      !absl::SimpleAtoi(fields[1], &offsets.group_leader_offset) ||
+      !absl::SimpleAtoi(fields[2], &offsets.exit_code_offset)) {
+    return error::Internal("Malformed task_struct offsets cache file.");
+  }
+
+  if (!OffsetsAreValid(offsets)) {
+    return error::Internal("Cached task_struct offsets failed validation.");
+  }
+
+  return offsets;
+}
+
+void WriteOffsetsCache(const std::string& signature, const TaskStructOffsets& offsets) {
+  // A write failure only costs a re-resolution on the next startup, so log and move on.
+  Status s = WriteFileFromString(
+      FLAGS_stirling_task_struct_offsets_cache_file,
+      absl::Substitute("$0\n$1 $2 $3\n", signature, offsets.real_start_time_offset,
+                       offsets.group_leader_offset, offsets.exit_code_offset));
+  LOG_IF(WARNING, !s.ok()) << absl::Substitute(
+      "Failed to write task_struct offsets cache file $0 [msg=$1]",
+      FLAGS_stirling_task_struct_offsets_cache_file, s.msg());
+}
+
 }  // namespace
 
 StatusOr<TaskStructOffsets> ResolveTaskStructOffsets() {
+  std::string signature;
+  if (!FLAGS_stirling_task_struct_offsets_cache_file.empty()) {
+    StatusOr<std::string> signature_or = KernelBuildSignature();
+    if (signature_or.ok()) {
+      signature = signature_or.ConsumeValueOrDie();
+      StatusOr<TaskStructOffsets> cached = ReadOffsetsCache(signature);
+      if (cached.ok()) {
+        TaskStructOffsets offsets = cached.ConsumeValueOrDie();
+        LOG(INFO) << absl::Substitute("Using cached task_struct offsets: $0", offsets.ToString());
+        return offsets;
+      }
+    }
+  }
+
   PL_ASSIGN_OR_RETURN(TaskStructOffsets res, ResolveTaskStructStartTimeOffsets());
   PL_ASSIGN_OR_RETURN(uint64_t exit_code_offset, ResolveTaskStructExitCodeOffset());
   res.exit_code_offset = exit_code_offset;
+
+  if (!signature.empty()) {
+    WriteOffsetsCache(signature, res);
+  }
   return res;
 }
 
@@ -20,10 +20,19 @@
 
 #include <utility>
 
+#include "src/common/fs/fs_wrapper.h"
+
 namespace px {
 namespace stirling {
 namespace bpf_tools {
 
+bool IsHostBTFSupported() {
+  // The kernel publishes its own BTF here when built with CONFIG_DEBUG_INFO_BTF (common on
+  // distro kernels since ~5.4).
+  static constexpr char kVmlinuxBTFPath[] = "/sys/kernel/btf/vmlinux";
+  return fs::Exists(kVmlinuxBTFPath);
+}
+
 StatusOr<std::vector<UProbeSpec>> TransformGolangReturnProbe(
     const UProbeSpec& spec, const obj_tools::ElfReader::SymbolInfo& target,
     obj_tools::ElfReader* elf_reader) {
@@ -44,6 +44,17 @@ StatusOr<std::vector<UProbeSpec>> TransformGolangReturnProbe(
 StatusOr<std::vector<UProbeSpec>> TransformGolangReturnProbe(const UProbeSpec& spec,
                                                              obj_tools::ElfReader* elf_reader);
 
+/**
+ * Returns whether the host kernel exposes BTF type information for itself
+ * (i.e. /sys/kernel/btf/vmlinux exists).
+ *
+ * BTF availability is the prerequisite for loading CO-RE (compile once, run everywhere)
+ * BPF programs through libbpf, which would remove the runtime Clang dependency of the
+ * BCC path. All BPF programs in this repo currently still go through BCC or BPFTrace;
+ * this is the runtime selection point for a future libbpf-backed loader.
+ */
+bool IsHostBTFSupported();
+
 /**
  * Update BPF per-cpu array value at the specified index.
  * Note that the value is actually written onto all CPUs by BCC.
@@ -18,6 +18,8 @@
 
 #include "src/stirling/core/connector_context.h"
 
+#include "src/common/fs/proc_enumerator.h"
+
 namespace px {
 namespace stirling {
 
@@ -78,21 +80,25 @@ StandaloneContext::StandaloneContext(absl::flat_hash_set<md::UPID> upids,
 
 // Returns the list of processes from the proc filesystem. Used by StandaloneContext.
 absl::flat_hash_set<md::UPID> ListUPIDs(const std::filesystem::path& proc_path, uint32_t asid) {
-  absl::flat_hash_set<md::UPID> pids;
-  for (const auto& p : std::filesystem::directory_iterator(proc_path)) {
-    uint32_t pid = 0;
-    if (!absl::SimpleAtoi(p.path().filename().string(), &pid)) {
-      continue;
-    }
-    StatusOr<int64_t> pid_start_time = system::GetPIDStartTimeTicks(p.path());
+  absl::flat_hash_set<md::UPID> upids;
+  fs::ProcPidEnumerator enumerator(proc_path);
+  auto pids_or_s = enumerator.Pids();
+  if (!pids_or_s.ok()) {
+    LOG(ERROR) << absl::Substitute("Could not list PIDs from $0: $1", proc_path.string(),
+                                   pids_or_s.msg());
+    return upids;
+  }
+  for (uint32_t pid : pids_or_s.ValueOrDie()) {
+    const std::filesystem::path pid_path = proc_path / std::to_string(pid);
+    StatusOr<int64_t> pid_start_time = system::GetPIDStartTimeTicks(pid_path);
     if (!pid_start_time.ok()) {
       VLOG(1) << absl::Substitute("Could not get PID start time for pid $0. Likely already dead.",
-                                  p.path().string());
+                                  pid_path.string());
       continue;
     }
-    pids.emplace(asid, pid, pid_start_time.ValueOrDie());
+    upids.emplace(asid, pid, pid_start_time.ValueOrDie());
   }
-  return pids;
+  return upids;
 }
 
 SystemWideStandaloneContext::SystemWideStandaloneContext(const std::filesystem::path& proc_path)
@@ -17,7 +17,9 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -27,6 +29,11 @@
 #include "src/stirling/core/types.h"
 #include "src/stirling/utils/index_sorted_vector.h"
 
+DEFINE_uint32(stirling_data_table_flush_threads, 0,
+              "Number of threads used to convert tablets to record batches when flushing a "
+              "tabletized table. 0 or 1 flushes serially on the transfer thread. Only benefits "
+              "tables with many tablets per flush (e.g. tabletized by ASID/tenant).");
+
 namespace px {
 namespace stirling {
 
@@ -42,6 +49,15 @@ void DataTable::InitBuffers(types::ColumnWrapperRecordBatch* record_batch_ptr) {
   for (const auto& element : table_schema_.elements()) {
     px::types::DataType type = element.type();
 
+    // String columns are arena-backed, so RecordBuilder appends cost a bulk memcpy instead of one
+    // heap allocation per field. See ArenaStringColumnWrapper.
+    if (type == types::DataType::STRING) {
+      auto col = std::make_shared<types::ArenaStringColumnWrapper>();
+      col->Reserve(kTargetCapacity);
+      record_batch_ptr->push_back(col);
+      continue;
+    }
+
 #define TYPE_CASE(_dt_)                           \
   auto col = types::ColumnWrapper::Make(_dt_, 0); \
   col->Reserve(kTargetCapacity);                  \
@@ -59,71 +75,155 @@ Tablet* DataTable::GetTablet(types::TabletIDView tablet_id) {
   return &tablet;
 }
 
+DataTable::TabletFlushResult DataTable::FlushTablet(types::TabletID tablet_id, Tablet&& tablet,
+                                                    uint64_t end_time) const {
+  TabletFlushResult result;
+
+  // Fast path: the records are already in time order and all of them are pushable (the common
+  // case for well-behaved sources without a cutoff), so the columns--including any arena-backed
+  // string columns--are handed off wholesale instead of being copied through MoveIndexes().
+  if (!tablet.times.empty() && std::is_sorted(tablet.times.begin(), tablet.times.end()) &&
+      tablet.times.front() >= start_time_ && tablet.times.back() < end_time) {
+    result.last_pushed_time = tablet.times.back();
+    result.pushable = TaggedRecordBatch{tablet_id, std::move(tablet.records)};
+    return result;
+  }
+
+  // Sort based on times.
+  std::vector<size_t> sort_indexes = utils::SortedIndexes(tablet.times);
+
+  // Split the indexes into three groups:
+  // 1) Expired indexes: these are too old to return.
+  // 2) Pushable indexes: these are the ones that we return.
+  // 3) Carryover indexes: these are too new to return, so hold on to them until the next round.
+  auto positions =
+      utils::SplitSortedVector<2>(tablet.times, sort_indexes, {start_time_, end_time});
+  int num_expired = positions[0];
+  int num_pushable = positions[1] - positions[0];
+  int num_carryover = tablet.times.size() - positions[1];
+
+  // Case 1: Expired records. Just print a message.
+  VLOG_IF(1, num_expired > 0) << absl::Substitute(
+      "$0 records for table $1 dropped due to late arrival [cutoff time=$2, oldest event "
+      "time=$3].",
+      num_expired, table_schema_.name(), end_time, tablet.times[sort_indexes[0]]);
+
+  // Case 2: Pushable records. Copy to output.
+  if (num_pushable > 0) {
+    // TODO(oazizi): Consider VectorView to avoid copying.
+    std::vector<size_t> push_indexes(sort_indexes.begin() + num_expired,
+                                     sort_indexes.end() - num_carryover);
+    types::ColumnWrapperRecordBatch pushable_records;
+    for (auto& col : tablet.records) {
+      pushable_records.push_back(col->MoveIndexes(push_indexes));
+    }
+    result.last_pushed_time = tablet.times[push_indexes.back()];
+    result.pushable = TaggedRecordBatch{tablet_id, std::move(pushable_records)};
+  }
+
+  // Case 3: Carryover records.
+  if (num_carryover > 0) {
+    // TODO(oazizi): Consider VectorView to avoid copying.
+    std::vector<size_t> carryover_indexes(sort_indexes.begin() + num_pushable,
+                                          sort_indexes.end());
+    types::ColumnWrapperRecordBatch carryover_records;
+    for (auto& col : tablet.records) {
+      carryover_records.push_back(col->MoveIndexes(carryover_indexes));
+    }
+
+    std::vector<uint64_t> times(carryover_indexes.size());
+    for (size_t i = 0; i < times.size(); ++i) {
+      times[i] = tablet.times[carryover_indexes[i]];
+    }
+    result.carryover = Tablet{tablet_id, std::move(times), std::move(carryover_records)};
+  }
+
+  return result;
+}
+
 std::vector<TaggedRecordBatch> DataTable::ConsumeRecords() {
-  std::vector<TaggedRecordBatch> tablets_out;
-  absl::flat_hash_map<types::TabletID, Tablet> carryover_tablets;
-  uint64_t next_start_time = start_time_;
+  // Flip the active buffer out under the lock; all the sorting, splitting and copying below
+  // happens on the drained buffer, so writers keep appending to a fresh buffer in the meantime.
+  absl::flat_hash_map<types::TabletID, Tablet> tablets;
+  {
+    absl::base_internal::SpinLockHolder lock(&tablets_lock_);
+    tablets = std::move(tablets_);
+    tablets_.clear();
+  }
+
+  // End time is cutoff time + 1, so call to SplitSortedVector() produces the following
+  // classification: which classified according to:
+  //   expired < start_time
+  //   pushable <= end_time
+  uint64_t end_time =
+      cutoff_time_.has_value() ? (cutoff_time_.value() + 1) : std::numeric_limits<uint64_t>::max();
+
+  // Tablets are flushed independently, so a heavily tabletized table (e.g. keyed by ASID/tenant)
+  // can fan its tablets out across threads. Work items are indexed, so the output order--and thus
+  // start_time_ accounting--is deterministic regardless of which thread processes which tablet.
+  std::vector<std::pair<types::TabletID, Tablet>> work;
+  work.reserve(tablets.size());
+  for (auto& [tablet_id, tablet] : tablets) {
+    work.emplace_back(tablet_id, std::move(tablet));
+  }
+
+  std::vector<TabletFlushResult> results(work.size());
 
-  for (auto& [tablet_id, tablet] : tablets_) {
-    // Sort based on times.
-    std::vector<size_t> sort_indexes = utils::SortedIndexes(tablet.times);
-
-    // End time is cutoff time + 1, so call to SplitSortedVector() produces the following
-    // classification: which classified according to:
-    //   expired < start_time
-    //   pushable <= end_time
-    uint64_t end_time = cutoff_time_.has_value() ? (cutoff_time_.value() + 1)
-                                                 : std::numeric_limits<uint64_t>::max();
-
-    // Split the indexes into three groups:
-    // 1) Expired indexes: these are too old to return.
-    // 2) Pushable indexes: these are the ones that we return.
-    // 3) Carryover indexes: these are too new to return, so hold on to them until the next round.
-    auto positions =
-        utils::SplitSortedVector<2>(tablet.times, sort_indexes, {start_time_, end_time});
-    int num_expired = positions[0];
-    int num_pushable = positions[1] - positions[0];
-    int num_carryover = tablet.times.size() - positions[1];
-
-    // Case 1: Expired records. Just print a message.
-    VLOG_IF(1, num_expired > 0) << absl::Substitute(
-        "$0 records for table $1 dropped due to late arrival [cutoff time=$2, oldest event "
-        "time=$3].",
-        num_expired, table_schema_.name(), end_time, tablet.times[sort_indexes[0]]);
-
-    // Case 2: Pushable records. Copy to output.
-    if (num_pushable > 0) {
-      // TODO(oazizi): Consider VectorView to avoid copying.
-      std::vector<size_t> push_indexes(sort_indexes.begin() + num_expired,
-                                       sort_indexes.end() - num_carryover);
-      types::ColumnWrapperRecordBatch pushable_records;
-      for (auto& col : tablet.records) {
-        pushable_records.push_back(col->MoveIndexes(push_indexes));
+  const size_t num_threads =
+      std::min<size_t>(FLAGS_stirling_data_table_flush_threads, work.size());
+  if (num_threads >= 2) {
+    std::atomic<size_t> next_idx = 0;
+    auto worker = [&]() {
+      size_t i;
+      while ((i = next_idx.fetch_add(1)) < work.size()) {
+        results[i] = FlushTablet(work[i].first, std::move(work[i].second), end_time);
       }
-      uint64_t last_time = tablet.times[push_indexes.back()];
-      next_start_time = std::max(next_start_time, last_time);
-      tablets_out.push_back(TaggedRecordBatch{tablet_id, std::move(pushable_records)});
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (size_t t = 0; t < num_threads; ++t) {
+      threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  } else {
+    for (size_t i = 0; i < work.size(); ++i) {
+      results[i] = FlushTablet(work[i].first, std::move(work[i].second), end_time);
     }
+  }
 
-    // Case 3: Carryover records.
-    if (num_carryover > 0) {
-      // TODO(oazizi): Consider VectorView to avoid copying.
-      std::vector<size_t> carryover_indexes(sort_indexes.begin() + num_pushable,
-                                            sort_indexes.end());
-      types::ColumnWrapperRecordBatch carryover_records;
-      for (auto& col : tablet.records) {
-        carryover_records.push_back(col->MoveIndexes(carryover_indexes));
-      }
+  std::vector<TaggedRecordBatch> tablets_out;
+  absl::flat_hash_map<types::TabletID, Tablet> carryover_tablets;
+  uint64_t next_start_time = start_time_;
 
-      std::vector<uint64_t> times(carryover_indexes.size());
-      for (size_t i = 0; i < times.size(); ++i) {
-        times[i] = tablet.times[carryover_indexes[i]];
+  for (auto& result : results) {
+    next_start_time = std::max(next_start_time, result.last_pushed_time);
+    if (result.pushable.has_value()) {
+      tablets_out.push_back(std::move(result.pushable.value()));
+    }
+    if (result.carryover.has_value()) {
+      carryover_tablets[result.carryover.value().tablet_id] = std::move(result.carryover.value());
+    }
+  }
+  // Merge carryover records back into the active buffer. Writers may have created fresh tablets
+  // while we were draining; in that case their records are folded into the carryover tablet, and
+  // time order is restored by the sort on the next consume.
+  if (!carryover_tablets.empty()) {
+    absl::base_internal::SpinLockHolder lock(&tablets_lock_);
+    for (auto& [tablet_id, tablet] : carryover_tablets) {
+      auto it = tablets_.find(tablet_id);
+      if (it != tablets_.end()) {
+        Tablet& fresh = it->second;
+        DCHECK_EQ(fresh.records.size(), tablet.records.size());
+        for (size_t i = 0; i < fresh.records.size(); ++i) {
+          tablet.records[i]->AppendFrom(*fresh.records[i]);
+        }
+        tablet.times.insert(tablet.times.end(), fresh.times.begin(), fresh.times.end());
       }
-      carryover_tablets[tablet_id] =
-          Tablet{tablet_id, std::move(times), std::move(carryover_records)};
+      tablets_.insert_or_assign(tablet_id, std::move(tablet));
     }
   }
-  tablets_ = std::move(carryover_tablets);
 
   start_time_ = next_start_time;
 
@@ -21,15 +21,19 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include <absl/base/internal/spinlock.h>
 #include <absl/container/flat_hash_map.h>
 
 #include "src/common/base/base.h"
 #include "src/common/base/mixins.h"
 #include "src/stirling/core/types.h"
 
+DECLARE_uint32(stirling_data_table_flush_threads);
+
 namespace px {
 namespace stirling {
 
@@ -48,6 +52,12 @@ struct Tablet {
   types::ColumnWrapperRecordBatch records;
 };
 
+// DataTable is double-buffered: record builders append to the active tablet buffer, while
+// ConsumeRecords() flips the active buffer out under tablets_lock_ and does all of its sorting,
+// splitting and copying on the drained buffer outside the lock. This allows a transfer thread to
+// push data concurrently with a source connector that keeps appending; writers are blocked for at
+// most the O(1) buffer flip, and the flip waits for at most one in-flight record (builders hold
+// the lock for the few appends of a single record).
 class DataTable : public NotCopyable {
  public:
   // Global unique ID identifies the table store to which this DataTable's data should be pushed.
@@ -89,6 +99,7 @@ class DataTable : public NotCopyable {
    * @return size_t occupancy
    */
   size_t Occupancy() const {
+    absl::base_internal::SpinLockHolder lock(&tablets_lock_);
     size_t occupancy = 0;
     for (auto& [tablet_id, tablet] : tablets_) {
       if (!tablet.records.empty()) {
@@ -129,14 +140,14 @@ class DataTable : public NotCopyable {
   class RecordBuilder {
    public:
     RecordBuilder(DataTable* data_table, types::TabletIDView tablet_id, uint64_t time = 0)
-        : tablet_(*data_table->GetTablet(tablet_id)) {
+        : buffer_lock_(&data_table->tablets_lock_), tablet_(*data_table->GetTablet(tablet_id)) {
       static_assert(schema->tabletized());
       tablet_id_ = tablet_id;
       Init(time);
     }
 
     explicit RecordBuilder(DataTable* data_table, uint64_t time = 0)
-        : tablet_(*data_table->GetTablet("")) {
+        : buffer_lock_(&data_table->tablets_lock_), tablet_(*data_table->GetTablet("")) {
       static_assert(!schema->tabletized());
       Init(time);
     }
@@ -162,10 +173,12 @@ class DataTable : public NotCopyable {
           val.resize(max_string_bytes);
           val.append(kTruncatedMsg);
         }
-        val.shrink_to_fit();
+        // String bytes are copied into the column's arena (see ArenaStringColumnWrapper), so no
+        // per-field allocation outlives the append.
+        tablet_.records[TIndex]->AppendString(val);
+      } else {
+        tablet_.records[TIndex]->Append(std::move(val));
       }
-
-      tablet_.records[TIndex]->Append(std::move(val));
       DCHECK(!signature_[TIndex]) << absl::Substitute(
           "Attempt to Append() to column $0 (name=$1) multiple times", TIndex,
           schema->ColName(TIndex));
@@ -194,6 +207,10 @@ class DataTable : public NotCopyable {
       tablet_.times.push_back(time);
     }
 
+    // Pins the active tablet buffer for the lifetime of the builder (i.e. one record), so a
+    // concurrent ConsumeRecords() can't flip the buffer mid-record. Declared first so the lock is
+    // held before tablet_ is looked up.
+    absl::base_internal::SpinLockHolder buffer_lock_;
     Tablet& tablet_;
     std::bitset<schema->elements().size()> signature_;
     types::TabletIDView tablet_id_ = "";
@@ -208,14 +225,18 @@ class DataTable : public NotCopyable {
   class DynamicRecordBuilder {
    public:
     DynamicRecordBuilder(DataTable* data_table, types::TabletIDView tablet_id, uint64_t time = 0)
-        : schema_(data_table->table_schema_), tablet_(*data_table->GetTablet(tablet_id)) {
+        : schema_(data_table->table_schema_),
+          buffer_lock_(&data_table->tablets_lock_),
+          tablet_(*data_table->GetTablet(tablet_id)) {
       DCHECK(schema_.tabletized());
       tablet_id_ = tablet_id;
       Init(time);
     }
 
     explicit DynamicRecordBuilder(DataTable* data_table, uint64_t time = 0)
-        : schema_(data_table->table_schema_), tablet_(*data_table->GetTablet("")) {
+        : schema_(data_table->table_schema_),
+          buffer_lock_(&data_table->tablets_lock_),
+          tablet_(*data_table->GetTablet("")) {
       DCHECK(!schema_.tabletized());
       Init(time);
     }
@@ -228,10 +249,11 @@ class DataTable : public NotCopyable {
           val.resize(max_string_bytes);
           val.append(kTruncatedMsg);
         }
+        tablet_.records[col_index]->AppendString(val);
+      } else {
+        tablet_.records[col_index]->Append(std::move(val));
       }
 
-      tablet_.records[col_index]->Append(std::move(val));
-
       DCHECK(!signature_[col_index])
           << absl::Substitute("Attempt to Append() to column $0 (name=$1) multiple times",
                               col_index, schema_.ColName(col_index));
@@ -254,11 +276,79 @@ class DataTable : public NotCopyable {
 
     static constexpr int kMaxSupportedColumns = 64;
     const DataTableSchema& schema_;
-    std::bitset<kMaxSupportedColumns> signature_ = 0;
+    // See RecordBuilder::buffer_lock_. Declared before tablet_ so the lock is held before the
+    // tablet is looked up.
+    absl::base_internal::SpinLockHolder buffer_lock_;
     Tablet& tablet_;
+    std::bitset<kMaxSupportedColumns> signature_ = 0;
     types::TabletIDView tablet_id_ = "";
   };
 
+  // DynamicRecordBatchBuilder appends multiple records under a single tablets_lock_ acquisition.
+  // In contrast to DynamicRecordBuilder, which locks and unlocks per record, this amortizes the
+  // locking across a whole batch, for callers that drain many pending events per poll.
+  // Note that the lock is held for the lifetime of the builder, so a batch should be appended in
+  // one tight loop. Only non-tabletized tables are supported.
+  class DynamicRecordBatchBuilder {
+   public:
+    explicit DynamicRecordBatchBuilder(DataTable* data_table)
+        : schema_(data_table->table_schema_),
+          buffer_lock_(&data_table->tablets_lock_),
+          tablet_(*data_table->GetTablet("")) {
+      DCHECK(!schema_.tabletized());
+      DCHECK_EQ(schema_.elements().size(), tablet_.records.size());
+      LOG_IF(DFATAL, schema_.elements().size() > kMaxSupportedColumns) << absl::Substitute(
+          "Tables with more than $0 columns are not supported.", kMaxSupportedColumns);
+    }
+
+    // Starts a new record. Every column must be appended before the next StartRecord() call.
+    void StartRecord(uint64_t time = 0) {
+      CheckRecordComplete();
+      record_open_ = true;
+      signature_.reset();
+      tablet_.times.push_back(time);
+    }
+
+    // Any string larger than max_string_bytes size will be truncated.
+    template <typename TValueType>
+    void Append(size_t col_index, TValueType val, size_t max_string_bytes = 1024) {
+      if constexpr (std::is_same_v<TValueType, types::StringValue>) {
+        if (val.size() > max_string_bytes) {
+          val.resize(max_string_bytes);
+          val.append(kTruncatedMsg);
+        }
+        tablet_.records[col_index]->AppendString(val);
+      } else {
+        tablet_.records[col_index]->Append(std::move(val));
+      }
+
+      DCHECK(!signature_[col_index])
+          << absl::Substitute("Attempt to Append() to column $0 (name=$1) multiple times",
+                              col_index, schema_.ColName(col_index));
+      signature_.set(col_index);
+    }
+
+    ~DynamicRecordBatchBuilder() { CheckRecordComplete(); }
+
+   private:
+    // Checks that every column of the record in progress (if any) was populated.
+    void CheckRecordComplete() {
+      if (record_open_) {
+        DCHECK_EQ(signature_.count(), schema_.elements().size());
+        DCHECK((signature_ >> schema_.elements().size()).none());
+      }
+    }
+
+    static constexpr int kMaxSupportedColumns = 64;
+    const DataTableSchema& schema_;
+    // See RecordBuilder::buffer_lock_. Declared before tablet_ so the lock is held before the
+    // tablet is looked up.
+    absl::base_internal::SpinLockHolder buffer_lock_;
+    Tablet& tablet_;
+    std::bitset<kMaxSupportedColumns> signature_ = 0;
+    bool record_open_ = false;
+  };
+
   uint64_t id() const { return id_; }
 
  protected:
@@ -271,13 +361,31 @@ class DataTable : public NotCopyable {
   // Initialize a new Active record batch.
   void InitBuffers(types::ColumnWrapperRecordBatch* record_batch_ptr);
 
-  // Get a pointer to the Tablet, for appending. Used by RecordBuilder.
+  // One tablet's share of a ConsumeRecords() drain: sort, split by time, and hand off or copy the
+  // columns. Reads only immutable table state, so tablets can be flushed concurrently
+  // (see --stirling_data_table_flush_threads).
+  struct TabletFlushResult {
+    std::optional<TaggedRecordBatch> pushable;
+    std::optional<Tablet> carryover;
+    // Latest pushed record time; 0 if nothing was pushed.
+    uint64_t last_pushed_time = 0;
+  };
+  TabletFlushResult FlushTablet(types::TabletID tablet_id, Tablet&& tablet,
+                                uint64_t end_time) const;
+
+  // Get a pointer to the Tablet, for appending. Used by RecordBuilder, which must already hold
+  // tablets_lock_ (see RecordBuilder::buffer_lock_).
   Tablet* GetTablet(types::TabletIDView tablet_id);
 
   // Table schema: a DataElement to describe each column.
   const DataTableSchema& table_schema_;
 
-  // Key is tablet id, value is tablet records.
+  // Guards the active tablet buffer below. Writers (record builders) hold it for the duration of
+  // one record; ConsumeRecords() holds it only to flip the buffer and to merge carryover back.
+  mutable absl::base_internal::SpinLock tablets_lock_;
+
+  // Key is tablet id, value is tablet records. This is the active write buffer; ConsumeRecords()
+  // periodically moves it out wholesale and drains it off to the side.
   absl::flat_hash_map<types::TabletID, Tablet> tablets_;
 
   uint64_t start_time_ = 0;
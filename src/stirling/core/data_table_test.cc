@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 #include <random>
 #include <string>
+#include <thread>
 
 #include "src/stirling/core/data_table.h"
 #include "src/stirling/source_connectors/seq_gen/sequence_generator.h"
@@ -122,6 +123,54 @@ TEST_F(DataTableTest, FixedTimeModeV2) {
   }
 }
 
+// Writer and consumer run concurrently: the consumer flips the buffer while the writer keeps
+// appending. All records must come out exactly once, in time order.
+TEST_F(DataTableTest, ConcurrentWriteAndConsume) {
+  constexpr int kNumRecords = 10000;
+
+  std::thread writer([this]() {
+    for (int i = 0; i < kNumRecords; ++i) {
+      DataTable::RecordBuilder<&kSchema> r(data_table_.get(), i + 1);
+      r.Append<r.ColIndex("time_")>(i + 1);
+      r.Append<r.ColIndex("x")>(i);
+      r.Append<r.ColIndex("s")>(types::StringValue(std::to_string(i)));
+    }
+  });
+
+  int expected_next = 0;
+  while (expected_next < kNumRecords) {
+    std::vector<TaggedRecordBatch> record_batches = data_table_->ConsumeRecords();
+    for (auto& record_batch : record_batches) {
+      types::ColumnWrapperRecordBatch& rb = record_batch.records;
+      for (size_t i = 0; i < rb[0]->Size(); ++i) {
+        ASSERT_EQ(rb[1]->Get<types::Int64Value>(i).val, expected_next);
+        ASSERT_EQ(rb[2]->Get<types::StringValue>(i), std::to_string(expected_next));
+        ++expected_next;
+      }
+    }
+  }
+  writer.join();
+  EXPECT_EQ(expected_next, kNumRecords);
+}
+
+TEST_F(DataTableTest, StringTruncation) {
+  std::string long_str(2048, 'x');
+  {
+    DataTable::RecordBuilder<&kSchema> r(data_table_.get());
+    r.Append<r.ColIndex("time_")>(0);
+    r.Append<r.ColIndex("x")>(0);
+    r.Append<r.ColIndex("s")>(types::StringValue(long_str), /* max_string_bytes */ 64);
+  }
+
+  std::vector<TaggedRecordBatch> record_batches = data_table_->ConsumeRecords();
+
+  ASSERT_EQ(record_batches.size(), 1);
+  types::ColumnWrapperRecordBatch& rb = record_batches[0].records;
+
+  EXPECT_EQ(rb[2]->Get<types::StringValue>(0),
+            long_str.substr(0, 64) + DataTable::kTruncatedMsg);
+}
+
 TEST_F(DataTableTest, Expiry) {
   std::vector<int> time_vals = {0, 10, 40, 20, 30, 50, 90, 70, 60, 80};
   std::vector<int> x_vals = {0, 1, 4, 2, 3, 5, 9, 7, 6, 8};
@@ -314,6 +363,52 @@ TEST_F(DataTableTest, Carryover) {
   }
 }
 
+// Same result as a serial flush, with tablet conversion fanned out across threads.
+TEST(DataTableTabletsTest, ParallelFlushMatchesSerial) {
+  static constexpr DataElement kTabletElements[] = {
+      {"time_", "time", types::DataType::TIME64NS, types::SemanticType::ST_NONE,
+       types::PatternType::METRIC_COUNTER},
+      {"tid", "tablet key", types::DataType::INT64, types::SemanticType::ST_NONE,
+       types::PatternType::GENERAL_ENUM},
+      {"x", "an int value", types::DataType::INT64, types::SemanticType::ST_NONE,
+       types::PatternType::GENERAL},
+  };
+  static constexpr std::string_view kTabletizationKey = "tid";
+  static constexpr auto kTabletSchema =
+      DataTableSchema("tabletized_test_table", "A tabletized table", kTabletElements,
+                      kTabletizationKey);
+
+  constexpr int kNumTablets = 8;
+  constexpr int kRecordsPerTablet = 100;
+
+  PL_SET_FOR_SCOPE(FLAGS_stirling_data_table_flush_threads, 4);
+
+  DataTable data_table(/*id*/ 0, kTabletSchema);
+  for (int tid = 0; tid < kNumTablets; ++tid) {
+    types::TabletID tablet_id = std::to_string(tid);
+    for (int i = 0; i < kRecordsPerTablet; ++i) {
+      // Reversed times, so the parallel path also exercises the sort.
+      uint64_t time = kRecordsPerTablet - i;
+      DataTable::RecordBuilder<&kTabletSchema> r(&data_table, tablet_id, time);
+      r.Append<r.ColIndex("time_")>(time);
+      r.Append<r.ColIndex("tid")>(tid);
+      r.Append<r.ColIndex("x")>(i);
+    }
+  }
+
+  std::vector<TaggedRecordBatch> tablets = data_table.ConsumeRecords();
+
+  ASSERT_EQ(tablets.size(), kNumTablets);
+  for (const auto& tablet : tablets) {
+    const types::ColumnWrapperRecordBatch& rb = tablet.records;
+    ASSERT_EQ(rb[0]->Size(), kRecordsPerTablet);
+    for (int i = 0; i < kRecordsPerTablet; ++i) {
+      EXPECT_EQ(rb[0]->Get<types::Time64NSValue>(i), i + 1);
+      EXPECT_EQ(rb[1]->Get<types::Int64Value>(i).val, std::stoi(tablet.tablet_id));
+    }
+  }
+}
+
 class DataTableStressTest : public ::testing::Test {
  private:
   std::default_random_engine rng_;
@@ -18,6 +18,10 @@
 
 #include "src/stirling/core/frequency_manager.h"
 
+#include <algorithm>
+
+#include "src/common/base/base.h"
+
 namespace px {
 namespace stirling {
 
@@ -26,5 +30,27 @@ void FrequencyManager::Reset() {
   ++count_;
 }
 
+void FrequencyManager::SetAdaptiveBounds(std::chrono::milliseconds min_period,
+                                         std::chrono::milliseconds max_period) {
+  DCHECK_LE(min_period.count(), max_period.count());
+  adaptive_ = true;
+  min_period_ = min_period;
+  max_period_ = max_period;
+  period_ = std::clamp(period_, min_period_, max_period_);
+}
+
+void FrequencyManager::RecordDataProduced(size_t num_records) {
+  if (!adaptive_) {
+    return;
+  }
+  if (num_records == 0) {
+    // Idle cycle: back off exponentially, so quiet tables stop paying the full sampling cost.
+    period_ = std::min(period_ * 2, max_period_);
+  } else {
+    // Data showed up: snap back to full rate, so a burst is sampled and drained promptly.
+    period_ = min_period_;
+  }
+}
+
 }  // namespace stirling
 }  // namespace px
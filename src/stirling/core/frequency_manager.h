@@ -40,10 +40,23 @@ class FrequencyManager {
    */
   void Reset();
 
+  /**
+   * Enables adaptive mode: the period stretches toward max_period while the managed action
+   * produces no data, and snaps back to min_period as soon as data shows up again.
+   */
+  void SetAdaptiveBounds(std::chrono::milliseconds min_period, std::chrono::milliseconds max_period);
+
+  /**
+   * Feeds back how much data the last cycle produced, so the period can adapt.
+   * No-op unless adaptive mode has been enabled via SetAdaptiveBounds().
+   */
+  void RecordDataProduced(size_t num_records);
+
   void set_period(std::chrono::milliseconds period) { period_ = period; }
   const auto& period() const { return period_; }
   const auto& next() const { return next_; }
   uint32_t count() const { return count_; }
+  bool adaptive() const { return adaptive_; }
 
  private:
   // The cycle's period.
@@ -54,6 +67,12 @@ class FrequencyManager {
 
   // The count of expired cycle so far.
   uint32_t count_ = 0;
+
+  // Adaptive mode state. When enabled, period_ floats between the bounds based on the
+  // RecordDataProduced() feedback.
+  bool adaptive_ = false;
+  std::chrono::milliseconds min_period_ = {};
+  std::chrono::milliseconds max_period_ = {};
 };
 
 }  // namespace stirling
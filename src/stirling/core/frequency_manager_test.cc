@@ -49,5 +49,36 @@ TEST(FrequencyManagerTest, SetPeriodEndAndCheck) {
   EXPECT_GE(computed_period, std::chrono::milliseconds{9990});
 }
 
+// Tests that adaptive mode stretches the period on idle cycles and snaps back on data.
+TEST(FrequencyManagerTest, AdaptivePeriod) {
+  FrequencyManager mgr;
+  mgr.set_period(std::chrono::milliseconds{100});
+  EXPECT_FALSE(mgr.adaptive());
+
+  mgr.SetAdaptiveBounds(std::chrono::milliseconds{100}, std::chrono::milliseconds{400});
+  EXPECT_TRUE(mgr.adaptive());
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{100});
+
+  // Idle cycles stretch the period exponentially, up to the max bound.
+  mgr.RecordDataProduced(0);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{200});
+  mgr.RecordDataProduced(0);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{400});
+  mgr.RecordDataProduced(0);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{400});
+
+  // Any produced data snaps the period back to the min bound.
+  mgr.RecordDataProduced(1);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{100});
+}
+
+// Tests that feedback is ignored unless adaptive mode has been enabled.
+TEST(FrequencyManagerTest, NonAdaptiveIgnoresFeedback) {
+  FrequencyManager mgr;
+  mgr.set_period(std::chrono::milliseconds{100});
+  mgr.RecordDataProduced(0);
+  EXPECT_EQ(mgr.period(), std::chrono::milliseconds{100});
+}
+
 }  // namespace stirling
 }  // namespace px
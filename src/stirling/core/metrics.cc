@@ -0,0 +1,84 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "src/stirling/core/metrics.h"
+
+namespace px {
+namespace stirling {
+
+namespace {
+
+const prometheus::Histogram::BucketBoundaries kSecondsBuckets = {0.0001, 0.001, 0.01,
+                                                                 0.1,    1.0,   10.0};
+
+const prometheus::Histogram::BucketBoundaries kBytesBuckets = {
+    1024.0, 16.0 * 1024, 256.0 * 1024, 4.0 * 1024 * 1024, 64.0 * 1024 * 1024, 1024.0 * 1024 * 1024};
+
+}  // namespace
+
+SourceConnectorMetrics::SourceConnectorMetrics(prometheus::Registry* registry,
+                                               std::string_view source_name)
+    : transfer_data_seconds(
+          prometheus::BuildHistogram()
+              .Name("transfer_data_seconds")
+              .Help("Wall time of each TransferData cycle for this connector.")
+              .Register(*registry)
+              .Add({{"source_connector", std::string(source_name)}}, kSecondsBuckets)),
+      transfer_data_cpu_seconds(
+          prometheus::BuildHistogram()
+              .Name("transfer_data_cpu_seconds")
+              .Help("Thread CPU time of each TransferData cycle for this connector.")
+              .Register(*registry)
+              .Add({{"source_connector", std::string(source_name)}}, kSecondsBuckets)),
+      transfer_data_allocated_bytes(
+          prometheus::BuildHistogram()
+              .Name("transfer_data_allocated_bytes")
+              .Help("Bytes allocated during each TransferData cycle for this connector. "
+                    "Only populated when --stirling_transfer_memory_metrics is enabled.")
+              .Register(*registry)
+              .Add({{"source_connector", std::string(source_name)}}, kBytesBuckets)) {}
+
+namespace {
+std::unordered_map<std::string, std::unique_ptr<SourceConnectorMetrics>> g_connector_metrics;
+
+void ResetConnectorMetrics(std::string_view source_name) {
+  g_connector_metrics.insert_or_assign(
+      std::string(source_name),
+      std::make_unique<SourceConnectorMetrics>(&GetMetricsRegistry(), source_name));
+}
+}  // namespace
+
+SourceConnectorMetrics& SourceConnectorMetrics::GetConnectorMetrics(std::string_view source_name) {
+  auto iter = g_connector_metrics.find(std::string(source_name));
+  if (iter == g_connector_metrics.end()) {
+    ResetConnectorMetrics(source_name);
+    iter = g_connector_metrics.find(std::string(source_name));
+  }
+  return *iter->second;
+}
+
+void SourceConnectorMetrics::TestOnlyResetConnectorMetrics(std::string_view source_name) {
+  ResetConnectorMetrics(source_name);
+}
+
+}  // namespace stirling
+}  // namespace px
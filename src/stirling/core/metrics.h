@@ -0,0 +1,50 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <string>
+
+#include <prometheus/histogram.h>
+#include <prometheus/registry.h>
+
+#include "src/common/metrics/metrics.h"
+
+namespace px {
+namespace stirling {
+
+/**
+ * Per-connector instrumentation of the data collection hot path.
+ * Each TransferData() cycle records its wall time, thread CPU time, and (optionally) its
+ * allocation delta, labeled by connector, so per-connector CPU/memory budgets can be set
+ * and regressions alerted on from the live metrics endpoint.
+ */
+struct SourceConnectorMetrics {
+  SourceConnectorMetrics(prometheus::Registry* registry, std::string_view source_name);
+
+  prometheus::Histogram& transfer_data_seconds;
+  prometheus::Histogram& transfer_data_cpu_seconds;
+  prometheus::Histogram& transfer_data_allocated_bytes;
+
+  static SourceConnectorMetrics& GetConnectorMetrics(std::string_view source_name);
+
+  static void TestOnlyResetConnectorMetrics(std::string_view source_name);
+};
+
+}  // namespace stirling
+}  // namespace px
@@ -20,6 +20,7 @@
 
 #include <utility>
 
+#include "src/common/json/json.h"
 #include "src/shared/upid/upid.h"
 
 namespace px {
@@ -40,68 +41,78 @@ const absl::TimeZone kLocalTimeZone;
 
 namespace {
 
-std::string ToString(const stirlingpb::TableSchema& schema,
-                     const ColumnWrapperRecordBatch& record_batch, size_t index) {
+// absl::FormatTime is comparatively expensive, and consecutive records in a batch usually fall
+// within the same wall-clock second. Cache the last formatted second, so high-rate printing
+// formats each distinct second once rather than once per record.
+void AppendFormattedTime(uint64_t time_ns, std::string* out) {
+  const std::time_t secs = time_ns / 1000000000UL;
+  thread_local std::time_t last_secs = -1;
+  thread_local std::string last_formatted;
+  if (secs != last_secs) {
+    last_formatted = absl::FormatTime(kTimeFormat, absl::FromTimeT(secs), kLocalTimeZone);
+    last_secs = secs;
+  }
+  out->append(last_formatted);
+}
+
+}  // namespace
+
+void ToStringRecord(const stirlingpb::TableSchema& schema,
+                    const ColumnWrapperRecordBatch& record_batch, size_t index, std::string* out) {
   DCHECK(!record_batch.empty());
   DCHECK_EQ(schema.elements_size(), record_batch.size());
   DCHECK_LT(index, record_batch[0]->Size());
 
-  std::string out;
   for (int j = 0; j < schema.elements_size(); ++j) {
     const auto& col = record_batch[j];
     const auto& col_schema = schema.elements(j);
 
-    absl::StrAppend(&out, " ", col_schema.name(), ":[");
+    absl::StrAppend(out, " ", col_schema.name(), ":[");
 
     switch (col_schema.type()) {
       case DataType::TIME64NS: {
         const auto val = col->Get<Time64NSValue>(index).val;
-        std::time_t time = val / 1000000000UL;
-        absl::Time t = absl::FromTimeT(time);
-        absl::StrAppend(&out, absl::FormatTime(kTimeFormat, t, kLocalTimeZone));
+        AppendFormattedTime(val, out);
       } break;
       case DataType::INT64: {
         const auto val = col->Get<Int64Value>(index).val;
         if (col_schema.stype() == SemanticType::ST_DURATION_NS) {
           const auto secs = std::chrono::duration_cast<std::chrono::duration<double>>(
               std::chrono::nanoseconds(val));
-          absl::StrAppend(&out, absl::Substitute("$0 seconds", secs.count()));
+          absl::StrAppend(out, secs.count(), " seconds");
         } else {
-          absl::StrAppend(&out, val);
+          absl::StrAppend(out, val);
         }
       } break;
       case DataType::FLOAT64: {
         const auto val = col->Get<Float64Value>(index).val;
-        absl::StrAppend(&out, val);
+        absl::StrAppend(out, val);
       } break;
       case DataType::BOOLEAN: {
         const auto val = col->Get<BoolValue>(index).val;
-        absl::StrAppend(&out, val);
+        absl::StrAppend(out, val);
       } break;
       case DataType::STRING: {
         const auto& val = col->Get<StringValue>(index);
-        absl::StrAppend(&out, val);
+        absl::StrAppend(out, val);
       } break;
       case DataType::UINT128: {
         const auto& val = col->Get<UInt128Value>(index);
         if (col_schema.stype() == SemanticType::ST_UPID) {
           md::UPID upid(val.val);
-          absl::StrAppend(&out, absl::Substitute("{$0}", upid.String()));
+          absl::StrAppend(out, "{", upid.String(), "}");
         } else {
-          absl::StrAppend(&out, absl::Substitute("{$0,$1}", val.High64(), val.Low64()));
+          absl::StrAppend(out, "{", val.High64(), ",", val.Low64(), "}");
         }
       } break;
       default:
         LOG(DFATAL) << absl::Substitute("Unrecognized type: $0", ToString(col_schema.type()));
     }
 
-    absl::StrAppend(&out, "]");
+    out->push_back(']');
   }
-  return out;
 }
 
-}  // namespace
-
 std::vector<std::string> ToString(const stirlingpb::TableSchema& schema,
                                   const types::ColumnWrapperRecordBatch& record_batch) {
   DCHECK_EQ(schema.elements_size(), record_batch.size());
@@ -114,25 +125,113 @@ std::vector<std::string> ToString(const stirlingpb::TableSchema& schema,
 
   std::vector<std::string> out;
   for (size_t i = 0; i < num_records; ++i) {
-    out.push_back(ToString(schema, record_batch, i));
+    std::string record;
+    ToStringRecord(schema, record_batch, i, &record);
+    out.push_back(std::move(record));
   }
   return out;
 }
 
+void ToString(std::string_view prefix, const stirlingpb::TableSchema& schema,
+              const types::ColumnWrapperRecordBatch& record_batch, std::string* out) {
+  DCHECK_EQ(schema.elements_size(), record_batch.size());
+
+  const size_t num_records = record_batch.front()->Size();
+  for (size_t i = 0; i < num_records; ++i) {
+    absl::StrAppend(out, "[", prefix, "]");
+    ToStringRecord(schema, record_batch, i, out);
+    out->push_back('\n');
+  }
+}
+
 std::string ToString(std::string_view prefix, const stirlingpb::TableSchema& schema,
                      const types::ColumnWrapperRecordBatch& record_batch) {
   std::string out;
-  for (auto& record : ToString(schema, record_batch)) {
-    absl::StrAppend(&out, "[", prefix, "]", std::move(record), "\n");
+  ToString(prefix, schema, record_batch, &out);
+  return out;
+}
+
+void ToJSONRecord(const stirlingpb::TableSchema& schema,
+                  const types::ColumnWrapperRecordBatch& record_batch, size_t index,
+                  std::string* out) {
+  DCHECK(!record_batch.empty());
+  DCHECK_EQ(schema.elements_size(), record_batch.size());
+  DCHECK_LT(index, record_batch[0]->Size());
+
+  out->push_back('{');
+  for (int j = 0; j < schema.elements_size(); ++j) {
+    const auto& col = record_batch[j];
+    const auto& col_schema = schema.elements(j);
+
+    if (j != 0) {
+      out->push_back(',');
+    }
+    // Column names come from our table schemas and never require escaping.
+    out->push_back('"');
+    out->append(col_schema.name());
+    out->append("\":");
+
+    switch (col_schema.type()) {
+      case DataType::TIME64NS:
+        // Raw nanoseconds since epoch; formatting is left to the consumer.
+        absl::StrAppend(out, col->Get<Time64NSValue>(index).val);
+        break;
+      case DataType::INT64:
+        absl::StrAppend(out, col->Get<Int64Value>(index).val);
+        break;
+      case DataType::FLOAT64:
+        absl::StrAppend(out, col->Get<Float64Value>(index).val);
+        break;
+      case DataType::BOOLEAN:
+        out->append(col->Get<BoolValue>(index).val ? "true" : "false");
+        break;
+      case DataType::STRING:
+        utils::AppendEscapedJSONString(col->Get<StringValue>(index), out);
+        break;
+      case DataType::UINT128: {
+        const auto& val = col->Get<UInt128Value>(index);
+        if (col_schema.stype() == SemanticType::ST_UPID) {
+          md::UPID upid(val.val);
+          utils::AppendEscapedJSONString(upid.String(), out);
+        } else {
+          utils::AppendEscapedJSONString(absl::Substitute("$0,$1", val.High64(), val.Low64()),
+                                         out);
+        }
+      } break;
+      default:
+        LOG(DFATAL) << absl::Substitute("Unrecognized type: $0", ToString(col_schema.type()));
+    }
   }
+  out->push_back('}');
+}
+
+void ToJSON(const stirlingpb::TableSchema& schema,
+            const types::ColumnWrapperRecordBatch& record_batch, std::string* out) {
+  DCHECK_EQ(schema.elements_size(), record_batch.size());
+
+  const size_t num_records = record_batch.front()->Size();
+  for (size_t i = 0; i < num_records; ++i) {
+    ToJSONRecord(schema, record_batch, i, out);
+    out->push_back('\n');
+  }
+}
+
+std::string ToJSON(const stirlingpb::TableSchema& schema,
+                   const types::ColumnWrapperRecordBatch& record_batch) {
+  std::string out;
+  ToJSON(schema, record_batch, &out);
   return out;
 }
 
 std::string PrintRecords(const DataTableSchema& data_table_schema,
                          const types::ColumnWrapperRecordBatch& record_batch) {
+  const stirlingpb::TableSchema schema = data_table_schema.ToProto();
+  const size_t num_records = record_batch.front()->Size();
+
   std::string out;
-  for (auto& record : ToString(data_table_schema.ToProto(), record_batch)) {
-    absl::StrAppend(&out, std::move(record), "\n");
+  for (size_t i = 0; i < num_records; ++i) {
+    ToStringRecord(schema, record_batch, i, &out);
+    out.push_back('\n');
   }
   return out;
 }
@@ -31,10 +31,22 @@
 namespace px {
 namespace stirling {
 
+// Appends the debug text representation of one record to the caller-provided buffer.
+// Formats straight into *out (no per-field strings), so callers can reuse the buffer across
+// records and batches to keep high-rate printing allocation-free at steady-state.
+void ToStringRecord(const stirlingpb::TableSchema& schema,
+                    const types::ColumnWrapperRecordBatch& record_batch, size_t index,
+                    std::string* out);
+
 // Returns a list of string representations of all of the records in the record batch.
 std::vector<std::string> ToString(const stirlingpb::TableSchema& schema,
                                   const types::ColumnWrapperRecordBatch& record_batch);
 
+// Appends a string representation of all of the records in the record batch to the
+// caller-provided buffer. Each line of record is prepended with the prefix.
+void ToString(std::string_view prefix, const stirlingpb::TableSchema& schema,
+              const types::ColumnWrapperRecordBatch& record_batch, std::string* out);
+
 // Returns a string representation of all of the records in the record batch.
 // Each line of record is prepended with the prefix.
 std::string ToString(std::string_view prefix, const stirlingpb::TableSchema& schema,
@@ -43,6 +55,23 @@ std::string ToString(std::string_view prefix, const stirlingpb::TableSchema& sch
 std::string PrintRecords(const DataTableSchema& data_table_schema,
                          const types::ColumnWrapperRecordBatch& record_batch);
 
+// Appends one record as a single-line JSON object to the caller-provided buffer.
+// Serializes straight into *out (no intermediate documents or per-field strings), so callers
+// can reuse the buffer across records and rows to keep JSON output allocation-free at
+// steady-state. Timestamps and durations are emitted as raw nanosecond integers.
+void ToJSONRecord(const stirlingpb::TableSchema& schema,
+                  const types::ColumnWrapperRecordBatch& record_batch, size_t index,
+                  std::string* out);
+
+// Appends a newline-delimited JSON representation of all of the records in the record batch to
+// the caller-provided buffer.
+void ToJSON(const stirlingpb::TableSchema& schema,
+            const types::ColumnWrapperRecordBatch& record_batch, std::string* out);
+
+// Returns a newline-delimited JSON representation of all of the records in the record batch.
+std::string ToJSON(const stirlingpb::TableSchema& schema,
+                   const types::ColumnWrapperRecordBatch& record_batch);
+
 #define DEFINE_PRINT_TABLE(protocol_name)                       \
   inline std::string Print##protocol_name##Table(               \
       const types::ColumnWrapperRecordBatch& record_batch) {    \
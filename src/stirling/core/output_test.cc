@@ -59,5 +59,27 @@ TEST(PrintRecordBatchTest, AllRecordsToStringNonPrefixWrapper) {
               ElementsAre(StrEq(" int64:[0] string:[test]"), StrEq(" int64:[0] string:[test]")));
 }
 
+TEST(PrintRecordBatchTest, AllRecordsToJSON) {
+  auto fixture = GetTestTableFixture();
+  EXPECT_EQ(
+      "{\"int64\":0,\"string\":\"test\"}\n"
+      "{\"int64\":0,\"string\":\"test\"}\n",
+      ToJSON(fixture->SchemaProto(), fixture->record_batch()));
+}
+
+TEST(PrintRecordBatchTest, ToStringRecordAppendsToBuffer) {
+  auto fixture = GetTestTableFixture();
+  std::string out = "prefix:";
+  ToStringRecord(fixture->SchemaProto(), fixture->record_batch(), /*index*/ 1, &out);
+  EXPECT_EQ("prefix: int64:[0] string:[test]", out);
+}
+
+TEST(PrintRecordBatchTest, ToJSONRecordAppendsToBuffer) {
+  auto fixture = GetTestTableFixture();
+  std::string out = "prefix:";
+  ToJSONRecord(fixture->SchemaProto(), fixture->record_batch(), /*index*/ 1, &out);
+  EXPECT_EQ("prefix:{\"int64\":0,\"string\":\"test\"}", out);
+}
+
 }  // namespace stirling
 }  // namespace px
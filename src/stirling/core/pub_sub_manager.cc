@@ -39,5 +39,45 @@ void PopulatePublishProto(Publish* publish_pb, const InfoClassManagerVec& info_c
   }
 }
 
+void ComputePublishDiff(const Publish& prev, const InfoClassManagerVec& info_class_mgrs,
+                        stirlingpb::PublishDiff* diff_pb) {
+  ECHECK(diff_pb != nullptr);
+
+  absl::flat_hash_set<uint64_t> prev_ids;
+  for (const auto& info_class : prev.published_info_classes()) {
+    prev_ids.insert(info_class.id());
+  }
+
+  absl::flat_hash_set<uint64_t> current_ids;
+  for (const auto& schema : info_class_mgrs) {
+    current_ids.insert(schema->id());
+    if (!prev_ids.contains(schema->id())) {
+      diff_pb->add_added_info_classes()->MergeFrom(schema->ToProto());
+    }
+  }
+
+  for (const auto& info_class : prev.published_info_classes()) {
+    if (!current_ids.contains(info_class.id())) {
+      diff_pb->add_removed_info_class_ids(info_class.id());
+    }
+  }
+}
+
+void ApplyPublishDiff(const stirlingpb::PublishDiff& diff, Publish* publish_pb) {
+  ECHECK(publish_pb != nullptr);
+
+  absl::flat_hash_set<uint64_t> removed_ids(diff.removed_info_class_ids().begin(),
+                                            diff.removed_info_class_ids().end());
+  auto* info_classes = publish_pb->mutable_published_info_classes();
+  info_classes->erase(
+      std::remove_if(info_classes->begin(), info_classes->end(),
+                     [&removed_ids](const InfoClass& ic) { return removed_ids.contains(ic.id()); }),
+      info_classes->end());
+
+  for (const auto& info_class : diff.added_info_classes()) {
+    publish_pb->add_published_info_classes()->MergeFrom(info_class);
+  }
+}
+
 }  // namespace stirling
 }  // namespace px
@@ -41,6 +41,25 @@ void PopulatePublishProto(stirlingpb::Publish* publish_pb,
                           const InfoClassManagerVec& info_class_mgrs,
                           std::optional<std::string_view> filter = {});
 
+/**
+ * Computes the incremental diff between a previously published proto and the current set of
+ * info class managers. Only info classes added or removed since the previous publication
+ * appear in the diff, so subscribers can update incrementally instead of re-consuming a
+ * full Publish message.
+ *
+ * @param prev The Publish proto the subscriber last received.
+ * @param info_class_mgrs Reference to a vector of info class manager unique pointers.
+ * @param diff_pb pointer to a PublishDiff proto message to populate.
+ */
+void ComputePublishDiff(const stirlingpb::Publish& prev, const InfoClassManagerVec& info_class_mgrs,
+                        stirlingpb::PublishDiff* diff_pb);
+
+/**
+ * Applies a PublishDiff to a Publish message in place. After application, the Publish
+ * message matches what a full republish would have produced.
+ */
+void ApplyPublishDiff(const stirlingpb::PublishDiff& diff, stirlingpb::Publish* publish_pb);
+
 /**
  * Utility function to index a publish message by ID, for quick access.
  */
@@ -213,5 +213,51 @@ TEST_F(PubSubManagerTest, partial_publish_test) {
   EXPECT_TRUE(MessageDifferencer::Equals(actual_publish_pb, expected_publish_pb));
 }
 
+// Tests that only newly added info classes appear in the diff, and that applying the diff
+// to the subscriber's copy reproduces what a full republish would have produced.
+TEST_F(PubSubManagerTest, publish_diff_addition_test) {
+  // Subscriber state: only the first info class has been published.
+  InfoClassManagerVec initial_mgrs;
+  initial_mgrs.push_back(std::move(info_class_mgrs_[0]));
+
+  stirlingpb::Publish subscriber_pb;
+  PopulatePublishProto(&subscriber_pb, initial_mgrs);
+
+  info_class_mgrs_[0] = std::move(initial_mgrs[0]);
+
+  // Diff against the current full set: only the second info class was added.
+  stirlingpb::PublishDiff diff_pb;
+  ComputePublishDiff(subscriber_pb, info_class_mgrs_, &diff_pb);
+  ASSERT_EQ(diff_pb.added_info_classes_size(), 1);
+  EXPECT_EQ(diff_pb.added_info_classes(0).schema().name(), "my_table");
+  EXPECT_EQ(diff_pb.removed_info_class_ids_size(), 0);
+
+  // Applying the diff brings the subscriber in sync with a full republish.
+  ApplyPublishDiff(diff_pb, &subscriber_pb);
+  stirlingpb::Publish full_pb;
+  PopulatePublishProto(&full_pb, info_class_mgrs_);
+  EXPECT_TRUE(MessageDifferencer::Equals(subscriber_pb, full_pb));
+}
+
+// Tests the removal side of the diff (e.g. a dynamic tracepoint was torn down).
+TEST_F(PubSubManagerTest, publish_diff_removal_test) {
+  stirlingpb::Publish subscriber_pb;
+  PopulatePublishProto(&subscriber_pb, info_class_mgrs_);
+
+  uint64_t removed_id = info_class_mgrs_[1]->id();
+  info_class_mgrs_.pop_back();
+
+  stirlingpb::PublishDiff diff_pb;
+  ComputePublishDiff(subscriber_pb, info_class_mgrs_, &diff_pb);
+  EXPECT_EQ(diff_pb.added_info_classes_size(), 0);
+  ASSERT_EQ(diff_pb.removed_info_class_ids_size(), 1);
+  EXPECT_EQ(diff_pb.removed_info_class_ids(0), removed_id);
+
+  ApplyPublishDiff(diff_pb, &subscriber_pb);
+  stirlingpb::Publish full_pb;
+  PopulatePublishProto(&full_pb, info_class_mgrs_);
+  EXPECT_TRUE(MessageDifferencer::Equals(subscriber_pb, full_pb));
+}
+
 }  // namespace stirling
 }  // namespace px
@@ -152,5 +152,37 @@ TEST(DynamicRecordBuilder, Duplicate) {
   EXPECT_DEBUG_DEATH(r_ptr->Append(0, types::Int64Value(1)), "");
 }
 
+TEST(DynamicRecordBatchBuilder, MultipleRecordsOneLock) {
+  DataTable data_table(/*id*/ 0, kTableSchema);
+
+  constexpr int kNumRecords = 3;
+  {
+    DataTable::DynamicRecordBatchBuilder builder(&data_table);
+    for (int i = 0; i < kNumRecords; ++i) {
+      builder.StartRecord();
+      builder.Append(0, types::Int64Value(i));
+      builder.Append(1, types::StringValue("foo"));
+      builder.Append(2, types::StringValue("bar"));
+    }
+  }
+
+  std::vector<TaggedRecordBatch> tablets = data_table.ConsumeRecords();
+  ASSERT_EQ(tablets.size(), 1);
+  types::ColumnWrapperRecordBatch& record_batch = tablets[0].records;
+
+  ASSERT_THAT(record_batch, RecordBatchSizeIs(kNumRecords));
+  for (int i = 0; i < kNumRecords; ++i) {
+    EXPECT_EQ(record_batch[0]->Get<types::Int64Value>(i).val, i);
+  }
+}
+
+TEST(DynamicRecordBatchBuilder, EmptyBatchIsANoop) {
+  DataTable data_table(/*id*/ 0, kTableSchema);
+
+  { DataTable::DynamicRecordBatchBuilder builder(&data_table); }
+
+  EXPECT_THAT(data_table.ConsumeRecords(), IsEmpty());
+}
+
 }  // namespace stirling
 }  // namespace px
@@ -16,6 +16,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <chrono>
 #include <cstring>
 #include <ctime>
 #include <memory>
@@ -23,11 +24,27 @@
 
 #include <magic_enum.hpp>
 
+#include "src/common/perf/memory_tracker.h"
+#include "src/stirling/core/metrics.h"
 #include "src/stirling/core/source_connector.h"
 
+DEFINE_bool(stirling_transfer_memory_metrics, false,
+            "If true, track the allocation delta of each TransferData cycle in the "
+            "per-connector metrics. Requires tcmalloc, and polls the allocator during each "
+            "cycle, so leave disabled unless chasing a memory regression.");
+
+DEFINE_bool(stirling_enable_adaptive_frequency, false,
+            "If true, each connector's sampling and push periods stretch while its tables are "
+            "idle and snap back to the configured periods as soon as data is produced.");
+
 namespace px {
 namespace stirling {
 
+namespace {
+// Maximum factor by which adaptive mode may stretch a connector's configured periods.
+constexpr int kAdaptiveMaxStretch = 8;
+}  // namespace
+
 Status SourceConnector::Init() {
   if (state_ != State::kUninitialized) {
     return error::Internal("Cannot re-initialize a connector [current state = $0].",
@@ -40,6 +57,15 @@ Status SourceConnector::Init() {
   DCHECK_NE(sampling_freq_mgr_.period().count(), 0) << "Sampling period has not been initialized";
   DCHECK_NE(push_freq_mgr_.period().count(), 0) << "Push period has not been initialized";
 
+  // Adaptive mode never tightens below the configured periods, since connectors derive
+  // internal cadences (e.g. logging and cleanup ratios) from their nominal sampling period.
+  if (FLAGS_stirling_enable_adaptive_frequency) {
+    sampling_freq_mgr_.SetAdaptiveBounds(sampling_freq_mgr_.period(),
+                                         kAdaptiveMaxStretch * sampling_freq_mgr_.period());
+    push_freq_mgr_.SetAdaptiveBounds(push_freq_mgr_.period(),
+                                     kAdaptiveMaxStretch * push_freq_mgr_.period());
+  }
+
   return s;
 }
 
@@ -50,24 +76,88 @@ void SourceConnector::TransferData(ConnectorContext* ctx,
   DCHECK(ctx != nullptr);
   DCHECK_EQ(data_tables.size(), table_schemas().size())
       << "DataTable objects must all be specified.";
+
+  SourceConnectorMetrics& metrics = SourceConnectorMetrics::GetConnectorMetrics(name());
+
+  MemoryTracker mem_tracker(FLAGS_stirling_transfer_memory_metrics);
+  mem_tracker.Start();
+
+  struct timespec cpu_start;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start);
+  const auto wall_start = std::chrono::steady_clock::now();
+
   TransferDataImpl(ctx, data_tables);
+
+  const double wall_seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+  struct timespec cpu_end;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_end);
+  const double cpu_seconds =
+      (cpu_end.tv_sec - cpu_start.tv_sec) + 1e-9 * (cpu_end.tv_nsec - cpu_start.tv_nsec);
+
+  metrics.transfer_data_seconds.Observe(wall_seconds);
+  metrics.transfer_data_cpu_seconds.Observe(cpu_seconds);
+
+  MemoryStats mem_stats = mem_tracker.End();
+  if (FLAGS_stirling_transfer_memory_metrics &&
+      mem_stats.end.allocated >= mem_stats.start.allocated) {
+    metrics.transfer_data_allocated_bytes.Observe(mem_stats.end.allocated -
+                                                  mem_stats.start.allocated);
+  }
+
+  if (sampling_freq_mgr_.adaptive()) {
+    // Buffered occupancy after a transfer approximates the records this cycle produced; any
+    // over-count from not-yet-pushed records just keeps the sampling rate high while data flows.
+    size_t num_records = 0;
+    for (const DataTable* data_table : data_tables) {
+      num_records += data_table->Occupancy();
+    }
+    sampling_freq_mgr_.RecordDataProduced(num_records);
+  }
   sampling_freq_mgr_.Reset();
 }
 
 void SourceConnector::PushData(DataPushCallback agent_callback,
                                const std::vector<DataTable*>& data_tables) {
+  size_t num_records_pushed = 0;
   for (auto* data_table : data_tables) {
     auto record_batches = data_table->ConsumeRecords();
     for (auto& record_batch : record_batches) {
       if (record_batch.records.empty()) {
         continue;
       }
+      num_records_pushed += record_batch.records.front()->Size();
       Status s = agent_callback(
           data_table->id(), record_batch.tablet_id,
           std::make_unique<types::ColumnWrapperRecordBatch>(std::move(record_batch.records)));
       LOG_IF(DFATAL, !s.ok()) << absl::Substitute("Failed to push data. Message = $0", s.msg());
     }
   }
+  push_freq_mgr_.RecordDataProduced(num_records_pushed);
+  push_freq_mgr_.Reset();
+}
+
+void SourceConnector::PushData(const BatchDataPushCallback& agent_callback,
+                               const std::vector<DataTable*>& data_tables) {
+  std::vector<PushedRecordBatch> batches;
+  size_t num_records_pushed = 0;
+  for (auto* data_table : data_tables) {
+    auto record_batches = data_table->ConsumeRecords();
+    for (auto& record_batch : record_batches) {
+      if (record_batch.records.empty()) {
+        continue;
+      }
+      num_records_pushed += record_batch.records.front()->Size();
+      batches.push_back(PushedRecordBatch{
+          data_table->id(), std::move(record_batch.tablet_id),
+          std::make_unique<types::ColumnWrapperRecordBatch>(std::move(record_batch.records))});
+    }
+  }
+  if (!batches.empty()) {
+    Status s = agent_callback(std::move(batches));
+    LOG_IF(DFATAL, !s.ok()) << absl::Substitute("Failed to push data. Message = $0", s.msg());
+  }
+  push_freq_mgr_.RecordDataProduced(num_records_pushed);
   push_freq_mgr_.Reset();
 }
 
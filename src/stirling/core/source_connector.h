@@ -69,6 +69,13 @@ class SourceConnector : public NotCopyable {
    */
   void PushData(DataPushCallback agent_callback, const std::vector<DataTable*>& data_tables);
 
+  /**
+   * Batched variant: collects the records of all input tables and delivers them through a
+   * single callback invocation.
+   */
+  void PushData(const BatchDataPushCallback& agent_callback,
+                const std::vector<DataTable*>& data_tables);
+
   /**
    * Stops the source connector and releases any acquired resources.
    * May only be called after a successful Init().
@@ -224,6 +224,13 @@ class StirlingTest : public ::testing::Test {
     return Status::OK();
   }
 
+  Status AppendDataBatched(std::vector<PushedRecordBatch> batches) {
+    for (auto& batch : batches) {
+      PL_RETURN_IF_ERROR(AppendData(batch.table_id, batch.tablet_id, std::move(batch.records)));
+    }
+    return Status::OK();
+  }
+
   void CheckRecordBatch(const uint64_t table_id, TabletID tablet_id, size_t num_records,
                         const ColumnWrapperRecordBatch& record_batch) {
     auto schema_elements = schemas_.at(table_id).elements();
@@ -315,6 +322,32 @@ TEST_F(StirlingTest, hammer_time_on_stirling_on_the_fly_subs) {
   EXPECT_GT(NumProcessed(), 0);
 }
 
+// Same sequences and reference model as above, but delivered through the batched push
+// callback, which hands over all of a connector's tables in one invocation.
+TEST_F(StirlingTest, hammer_time_on_stirling_batched_push) {
+  stirling_->RegisterDataPushCallback(nullptr);
+  stirling_->RegisterBatchDataPushCallback(
+      absl::bind_front(&StirlingTest::AppendDataBatched, this));
+
+  ASSERT_OK(stirling_->RunAsThread());
+
+  uint32_t i = 0;
+  while (NumProcessed() < kNumProcessedRequirement || i < kNumIterMin) {
+    std::this_thread::sleep_for(kDurationPerIter);
+
+    i++;
+
+    // In case we have a slow environment, break out of the test after some time.
+    if (i > kNumIterMax) {
+      break;
+    }
+  }
+
+  stirling_->Stop();
+
+  EXPECT_GT(NumProcessed(), 0);
+}
+
 TEST_F(StirlingTest, no_data_callback_defined) {
   stirling_->RegisterDataPushCallback(nullptr);
 
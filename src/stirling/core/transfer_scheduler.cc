@@ -0,0 +1,102 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/core/transfer_scheduler.h"
+
+#include <utility>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace stirling {
+
+TransferScheduler::TransferScheduler(size_t num_threads) {
+  DCHECK_GT(num_threads, 0U);
+  workers_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    workers_.emplace_back(&TransferScheduler::WorkerLoop, this);
+  }
+}
+
+TransferScheduler::~TransferScheduler() { Stop(); }
+
+bool TransferScheduler::Submit(SourceConnector* source, std::function<void()> work,
+                               bool high_priority) {
+  std::lock_guard<std::mutex> lock(mu_);
+  if (stop_ || inflight_.contains(source)) {
+    return false;
+  }
+  inflight_.insert(source);
+  if (high_priority) {
+    queue_.push_front(Task{source, std::move(work)});
+  } else {
+    queue_.push_back(Task{source, std::move(work)});
+  }
+  work_available_cv_.notify_one();
+  return true;
+}
+
+void TransferScheduler::Drain() {
+  std::unique_lock<std::mutex> lock(mu_);
+  idle_cv_.wait(lock, [this] { return inflight_.empty(); });
+}
+
+void TransferScheduler::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (stop_) {
+      return;
+    }
+    stop_ = true;
+    // Discard queued work, but leave in-flight entries for the workers to clear.
+    for (const Task& task : queue_) {
+      inflight_.erase(task.source);
+    }
+    queue_.clear();
+    work_available_cv_.notify_all();
+    idle_cv_.notify_all();
+  }
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void TransferScheduler::WorkerLoop() {
+  std::unique_lock<std::mutex> lock(mu_);
+  while (true) {
+    work_available_cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+    if (stop_) {
+      return;
+    }
+
+    Task task = std::move(queue_.front());
+    queue_.pop_front();
+
+    lock.unlock();
+    task.work();
+    lock.lock();
+
+    inflight_.erase(task.source);
+    if (inflight_.empty()) {
+      idle_cv_.notify_all();
+    }
+  }
+}
+
+}  // namespace stirling
+}  // namespace px
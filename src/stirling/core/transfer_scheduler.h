@@ -0,0 +1,92 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <absl/container/flat_hash_set.h>
+
+namespace px {
+namespace stirling {
+
+class SourceConnector;
+
+/**
+ * Runs source connectors' transfer and push work on a small pool of worker threads,
+ * so that one heavy connector (e.g. a slow perf profiler symbolization cycle) cannot
+ * delay draining of the other connectors' BPF buffers.
+ *
+ * Work for the same connector is serialized: a submission for a connector that still has
+ * work queued or running is dropped, and the run loop simply resubmits on its next tick.
+ * This keeps each connector effectively single-threaded, so connectors need no additional
+ * internal locking, and it also means a connector's FrequencyManagers are only ever
+ * mutated by the one task servicing it.
+ */
+class TransferScheduler {
+ public:
+  explicit TransferScheduler(size_t num_threads);
+  ~TransferScheduler();
+
+  /**
+   * Enqueues work for the given connector, unless that connector already has work
+   * queued or in flight. High-priority work jumps to the front of the queue; use it
+   * for connectors whose tables are filling up.
+   *
+   * Returns true if the work was accepted.
+   */
+  bool Submit(SourceConnector* source, std::function<void()> work, bool high_priority = false);
+
+  /**
+   * Blocks until all queued and in-flight work has finished.
+   * Call before stopping or removing a connector that may have work scheduled.
+   */
+  void Drain();
+
+  /**
+   * Stops accepting work and joins the worker threads. Queued work is discarded;
+   * in-flight work runs to completion.
+   */
+  void Stop();
+
+ private:
+  struct Task {
+    SourceConnector* source;
+    std::function<void()> work;
+  };
+
+  void WorkerLoop();
+
+  std::mutex mu_;
+  std::condition_variable work_available_cv_;
+  std::condition_variable idle_cv_;
+  std::deque<Task> queue_;
+  // Connectors with work queued or running; used to serialize per-connector work.
+  absl::flat_hash_set<SourceConnector*> inflight_;
+  bool stop_ = false;
+
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace stirling
+}  // namespace px
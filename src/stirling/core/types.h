@@ -36,6 +36,22 @@ namespace stirling {
 using DataPushCallback = std::function<Status(uint32_t, types::TabletID,
                                               std::unique_ptr<types::ColumnWrapperRecordBatch>)>;
 
+/**
+ * A single table's records, as delivered through BatchDataPushCallback.
+ */
+struct PushedRecordBatch {
+  uint64_t table_id;
+  types::TabletID tablet_id;
+  std::unique_ptr<types::ColumnWrapperRecordBatch> records;
+};
+
+/**
+ * Like DataPushCallback, but receives all tables that crossed their push thresholds in a
+ * cycle through a single invocation, so the agent pays the callback and locking overhead
+ * once per push period instead of once per table.
+ */
+using BatchDataPushCallback = std::function<Status(std::vector<PushedRecordBatch>)>;
+
 using AgentMetadataType = std::shared_ptr<const px::md::AgentMetadataState>;
 
 /**
@@ -93,7 +93,7 @@ TEST_P(BPFMapLeakTest, UnclosedConnection) {
   // And because it was killed, it should have leaked a BPF map entry.
 
   // For testing, make sure Stirling cleans up conn trackers right away.
-  FLAGS_stirling_conn_tracker_cleanup_threshold = 0.0;
+  FLAGS_stirling_conn_tracker_cleanup_budget_us = 0;
 
   // For testing, make sure Stirling cleans up BPF entries right away.
   // Without this flag, Stirling delays clean-up to accumulate a clean-up batch.
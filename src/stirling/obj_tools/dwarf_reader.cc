@@ -23,6 +23,8 @@
 
 #include <absl/container/flat_hash_set.h>
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 #include <llvm/DebugInfo/DIContext.h>
 #include <llvm/Object/ObjectFile.h>
@@ -150,6 +152,47 @@ bool IsIndexedType(llvm::dwarf::Tag tag) {
 
 bool IsNamespace(llvm::dwarf::Tag tag) { return tag == llvm::dwarf::DW_TAG_namespace; }
 
+// Extracts the DIEs of all normal units in parallel. DIE extraction dominates indexing time
+// on large (particularly Go) binaries, and each unit extracts into its own storage, so the
+// work parallelizes cleanly once the lazily initialized shared context state is primed.
+// This follows the same pattern llvm-gsymutil uses for its parallel DWARF conversion.
+void ParallelExtractDIEs(llvm::DWARFContext* dwarf_context) {
+  // Materialize the unit vector and parse the abbreviation declarations up front, on this
+  // thread: both are lazily initialized shared state that the workers would otherwise race on.
+  std::vector<llvm::DWARFUnit*> units;
+  for (const std::unique_ptr<llvm::DWARFUnit>& unit : dwarf_context->normal_units()) {
+    units.push_back(unit.get());
+  }
+  const llvm::DWARFDebugAbbrev* abbrev = dwarf_context->getDebugAbbrev();
+  if (abbrev != nullptr) {
+    abbrev->parse();
+  }
+
+  const size_t num_workers =
+      std::min<size_t>(units.size(), std::thread::hardware_concurrency());
+  if (num_workers <= 1) {
+    for (llvm::DWARFUnit* unit : units) {
+      unit->getUnitDIE(/* ExtractUnitDIEOnly */ false);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next_unit = 0;
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers.emplace_back([&units, &next_unit]() {
+      size_t idx;
+      while ((idx = next_unit.fetch_add(1)) < units.size()) {
+        units[idx]->getUnitDIE(/* ExtractUnitDIEOnly */ false);
+      }
+    });
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+}
+
 }  // namespace
 
 Status DwarfReader::DetectSourceLanguage() {
@@ -192,6 +235,10 @@ void DwarfReader::IndexDIEs(
   // Also only applies to CPP binaries.
   absl::flat_hash_map<uint64_t, DWARFDie> fn_spec_offsets;
 
+  // Extract the DIEs of all units across a thread pool; the sequential walk below then
+  // operates on pre-extracted DIEs and is comparatively cheap (name assembly & map inserts).
+  ParallelExtractDIEs(dwarf_context_.get());
+
   DWARFContext::unit_iterator_range units = dwarf_context_->normal_units();
   for (const std::unique_ptr<llvm::DWARFUnit>& unit : units) {
     for (const llvm::DWARFDebugInfoEntry& entry : unit->dies()) {
@@ -999,6 +1046,91 @@ StatusOr<RetValInfo> DwarfReader::GetFunctionRetValInfo(std::string_view functio
   return ret_val_info;
 }
 
+namespace {
+
+// x86-64 DWARF register numbers, per the System V ABI (Figure 3.36).
+// Note: .eh_frame on x86-64 uses the same register numbering as .debug_frame.
+constexpr uint32_t kDwarfX86RegFP = 6;   // rbp
+constexpr uint32_t kDwarfX86RegSP = 7;   // rsp
+constexpr uint32_t kDwarfX86RegRA = 16;  // Return address pseudo-register.
+
+}  // namespace
+
+StatusOr<std::vector<CFIUnwindRow>> DwarfReader::GetCFIUnwindTable() {
+  using llvm::dwarf::UnwindLocation;
+
+  llvm::Expected<const llvm::DWARFDebugFrame*> eh_frame_or = dwarf_context_->getEHFrame();
+  if (!eh_frame_or) {
+    return error::Internal("Failed to parse .eh_frame: $0",
+                           llvm::toString(eh_frame_or.takeError()));
+  }
+
+  std::vector<CFIUnwindRow> table;
+
+  for (const llvm::dwarf::FrameEntry& frame_entry : (*eh_frame_or)->entries()) {
+    const auto* fde = llvm::dyn_cast<llvm::dwarf::FDE>(&frame_entry);
+    if (fde == nullptr) {
+      continue;
+    }
+
+    llvm::Expected<llvm::dwarf::UnwindTable> rows_or = llvm::dwarf::UnwindTable::create(fde);
+    if (!rows_or) {
+      // The CFI program of this FDE could not be evaluated.
+      // Record a fallback row over its range, so lookups don't hit the previous FDE's rules.
+      llvm::consumeError(rows_or.takeError());
+      CFIUnwindRow row;
+      row.pc = fde->getInitialLocation();
+      table.push_back(row);
+      continue;
+    }
+
+    for (const llvm::dwarf::UnwindRow& unwind_row : *rows_or) {
+      if (!unwind_row.hasAddress()) {
+        continue;
+      }
+
+      CFIUnwindRow row;
+      row.pc = unwind_row.getAddress();
+
+      const UnwindLocation& cfa = unwind_row.getCFAValue();
+      const bool cfa_supported = cfa.getLocation() == UnwindLocation::RegPlusOffset &&
+                                 (cfa.getRegister() == kDwarfX86RegSP ||
+                                  cfa.getRegister() == kDwarfX86RegFP);
+      if (cfa_supported) {
+        row.cfa_is_fp_based = (cfa.getRegister() == kDwarfX86RegFP);
+        row.cfa_offset = cfa.getOffset();
+
+        const llvm::dwarf::RegisterLocations& regs = unwind_row.getRegisterLocations();
+
+        llvm::Optional<UnwindLocation> ra = regs.getRegisterLocation(kDwarfX86RegRA);
+        if (ra.hasValue() && ra->getLocation() == UnwindLocation::CFAPlusOffset) {
+          row.ra_cfa_offset = ra->getOffset();
+        } else {
+          // Without a recoverable return address, this row cannot be used for unwinding.
+          row.cfa_offset = CFIUnwindRow::kOffsetUnused;
+        }
+
+        llvm::Optional<UnwindLocation> fp = regs.getRegisterLocation(kDwarfX86RegFP);
+        if (fp.hasValue() && fp->getLocation() == UnwindLocation::CFAPlusOffset) {
+          row.fp_cfa_offset = fp->getOffset();
+        }
+      }
+
+      // Rows with unsupported rules are recorded as fallback rows (see header comment).
+      table.push_back(row);
+    }
+  }
+
+  if (table.empty()) {
+    return error::NotFound("No usable CFI found in .eh_frame.");
+  }
+
+  std::sort(table.begin(), table.end(),
+            [](const CFIUnwindRow& a, const CFIUnwindRow& b) { return a.pc < b.pc; });
+
+  return table;
+}
+
 }  // namespace obj_tools
 }  // namespace stirling
 }  // namespace px
@@ -117,6 +117,37 @@ struct StructSpecEntry {
   }
 };
 
+// A single row of a precomputed call-frame-information (CFI) unwind table.
+// Each row describes, for the PC range starting at pc (and ending at the next row's pc),
+// how to recover the canonical frame address (CFA), the return address, and the caller's
+// frame pointer. The representation is deliberately compact and expression-free, so rows
+// can be loaded into a BPF map for stack walking of binaries compiled without frame pointers.
+struct CFIUnwindRow {
+  // Marks an offset rule as absent (e.g. the frame pointer is not saved in this range).
+  static constexpr int32_t kOffsetUnused = std::numeric_limits<int32_t>::min();
+
+  // First address covered by this row.
+  uint64_t pc = 0;
+
+  // If true, CFA = FP + cfa_offset; otherwise CFA = SP + cfa_offset.
+  // Rows whose CFA rule cannot be expressed this way (e.g. defined by a DWARF expression)
+  // have cfa_offset == kOffsetUnused; an unwinder must fall back to frame pointers there.
+  bool cfa_is_fp_based = false;
+  int32_t cfa_offset = kOffsetUnused;
+
+  // The return address is stored at CFA + ra_cfa_offset.
+  int32_t ra_cfa_offset = kOffsetUnused;
+
+  // The caller's frame pointer is stored at CFA + fp_cfa_offset (kOffsetUnused if not saved).
+  int32_t fp_cfa_offset = kOffsetUnused;
+
+  std::string ToString() const {
+    return absl::Substitute("pc=$0 cfa=$1$2 ra_cfa_offset=$3 fp_cfa_offset=$4",
+                            absl::Hex(pc, absl::kZeroPad8), cfa_is_fp_based ? "FP+" : "SP+",
+                            cfa_offset, ra_cfa_offset, fp_cfa_offset);
+  }
+};
+
 inline bool operator==(const TypeInfo& a, const TypeInfo& b) {
   return a.type == b.type && a.type_name == b.type_name;
 }
@@ -289,6 +320,17 @@ class DwarfReader {
    */
   StatusOr<RetValInfo> GetFunctionRetValInfo(std::string_view function_symbol_name);
 
+  /**
+   * Returns the CFI unwind table of the binary, extracted from its .eh_frame section.
+   * Rows are sorted by PC, so the applicable row for an address can be found by binary search.
+   * Note that .eh_frame is present even in binaries without DWARF debug info,
+   * so this works on stripped distro binaries.
+   * Rows with rules that cannot be represented compactly (e.g. DWARF expressions) are
+   * retained as fallback rows (cfa_offset == kOffsetUnused), so lookups never attribute a
+   * neighboring row's rules to their PC range.
+   */
+  StatusOr<std::vector<CFIUnwindRow>> GetCFIUnwindTable();
+
   bool IsValid() const { return dwarf_context_->getNumCompileUnits() != 0; }
 
   const llvm::dwarf::SourceLanguage& source_language() const { return source_language_; }
@@ -18,6 +18,8 @@
 
 #include "src/stirling/obj_tools/dwarf_reader.h"
 
+#include <algorithm>
+
 #include "src/common/testing/test_environment.h"
 #include "src/common/testing/testing.h"
 
@@ -43,6 +45,7 @@ using ::llvm::DWARFDie;
 using ::px::stirling::obj_tools::DwarfReader;
 using ::testing::ElementsAre;
 using ::testing::IsEmpty;
+using ::testing::Not;
 using ::testing::Pair;
 using ::testing::SizeIs;
 using ::testing::UnorderedElementsAre;
@@ -929,6 +932,33 @@ TEST_P(DwarfReaderTest, GoFunctionVarLocationConsistency) {
   }
 }
 
+TEST_P(DwarfReaderTest, GetCFIUnwindTable) {
+  DwarfReaderTestParam p = GetParam();
+
+  ASSERT_OK_AND_ASSIGN(std::unique_ptr<DwarfReader> dwarf_reader,
+                       CreateDwarfReader(kCppBinaryPath, p.index));
+
+  ASSERT_OK_AND_ASSIGN(std::vector<CFIUnwindRow> unwind_table, dwarf_reader->GetCFIUnwindTable());
+  ASSERT_THAT(unwind_table, Not(IsEmpty()));
+
+  // Rows must be sorted by PC so the applicable row can be found via binary search.
+  EXPECT_TRUE(std::is_sorted(
+      unwind_table.begin(), unwind_table.end(),
+      [](const CFIUnwindRow& a, const CFIUnwindRow& b) { return a.pc < b.pc; }));
+
+  // Function entry points start with an SP-based CFA and the return address just below it
+  // (pushed by the call instruction), so such rows must be present in any x86-64 binary.
+  bool found_entry_row = false;
+  for (const CFIUnwindRow& row : unwind_table) {
+    if (!row.cfa_is_fp_based && row.cfa_offset == 8 &&
+        row.ra_cfa_offset == -8) {
+      found_entry_row = true;
+      break;
+    }
+  }
+  EXPECT_TRUE(found_entry_row);
+}
+
 INSTANTIATE_TEST_SUITE_P(DwarfReaderParameterizedTest, DwarfReaderTest,
                          ::testing::Values(DwarfReaderTestParam{true},
                                            DwarfReaderTestParam{false}));
@@ -32,6 +32,11 @@
 #include "src/common/fs/fs_wrapper.h"
 #include "src/stirling/obj_tools/init.h"
 
+DEFINE_string(stirling_elf_index_cache_path, "/tmp/px_elf_index_cache",
+              "Directory in which ElfReader persists per-binary symbol indexes, keyed by "
+              "build-id, so that repeat agent restarts skip ELF symbol table parsing. "
+              "An empty value disables the on-disk cache.");
+
 namespace px {
 namespace stirling {
 namespace obj_tools {
@@ -158,6 +163,29 @@ Status ElfReader::LocateDebugSymbols(const std::filesystem::path& debug_file_dir
   return error::Internal("Could not find debug symbols for $0", binary_path_);
 }
 
+StatusOr<std::string> ElfReader::BuildID() {
+  PL_ASSIGN_OR_RETURN(ELFIO::section * psec, SectionWithName(".note.gnu.build-id"));
+
+  // Structure of this section:
+  //    namesz :   32-bit, size of "name" field
+  //    descsz :   32-bit, size of "desc" field
+  //    type   :   32-bit, vendor specific "type"
+  //    name   :   "namesz" bytes, null-terminated string
+  //    desc   :   "descsz" bytes, binary data
+  int32_t name_size =
+      utils::LEndianBytesToInt<int32_t>(std::string_view(psec->get_data(), sizeof(int32_t)));
+  int32_t desc_size = utils::LEndianBytesToInt<int32_t>(
+      std::string_view(psec->get_data() + sizeof(int32_t), sizeof(int32_t)));
+
+  int32_t desc_pos = 3 * sizeof(int32_t) + name_size;
+  if (desc_size <= 0 || desc_pos + desc_size > static_cast<int32_t>(psec->get_size())) {
+    return error::Internal("Malformed .note.gnu.build-id section in binary=$0", binary_path_);
+  }
+  std::string_view desc = std::string_view(psec->get_data() + desc_pos, desc_size);
+
+  return BytesToString<LowercaseHex>(desc);
+}
+
 // TODO(oazizi): Consider changing binary_path to std::filesystem::path.
 StatusOr<std::unique_ptr<ElfReader>> ElfReader::Create(
     const std::string& binary_path, const std::filesystem::path& debug_file_dir) {
@@ -214,6 +242,66 @@ StatusOr<ELFIO::section*> ElfReader::SymtabSection() {
   return symtab_section;
 }
 
+StatusOr<ElfSymbolIndex*> ElfReader::SymbolIndex() {
+  if (symbol_index_ != nullptr) {
+    return symbol_index_.get();
+  }
+
+  // Try the on-disk cache first: an index keyed by build-id survives agent restarts,
+  // and a hit means we can skip walking the ELF symbol table entirely.
+  std::filesystem::path cache_file;
+  if (!FLAGS_stirling_elf_index_cache_path.empty()) {
+    StatusOr<std::string> build_id_or = BuildID();
+    if (build_id_or.ok()) {
+      cache_file = std::filesystem::path(FLAGS_stirling_elf_index_cache_path) /
+                   absl::StrCat(build_id_or.ValueOrDie(), ".symidx");
+      auto index_or = ElfSymbolIndex::LoadFromFile(cache_file);
+      if (index_or.ok()) {
+        VLOG(1) << absl::Substitute("ElfReader [binary=$0]: using cached symbol index $1",
+                                    binary_path_, cache_file.string());
+        symbol_index_ = index_or.ConsumeValueOrDie();
+        return symbol_index_.get();
+      }
+    }
+  }
+
+  PL_ASSIGN_OR_RETURN(ELFIO::section * symtab_section, SymtabSection());
+
+  const ELFIO::symbol_section_accessor symbols(elf_reader_, symtab_section);
+  const unsigned int num_symbols = symbols.get_symbols_num();
+
+  // The names vector provides stable storage for the string_views handed to Build().
+  std::vector<std::string> names(num_symbols);
+  std::vector<ElfSymbolIndex::Symbol> index_symbols;
+  index_symbols.reserve(num_symbols);
+
+  for (unsigned int j = 0; j < num_symbols; ++j) {
+    std::string& name = names[j];
+    ELFIO::Elf64_Addr addr = 0;
+    ELFIO::Elf_Xword size = 0;
+    unsigned char bind = 0;
+    unsigned char type = ELFIO::STT_NOTYPE;
+    ELFIO::Elf_Half section_index;
+    unsigned char other;
+    symbols.get_symbol(j, name, addr, size, bind, type, section_index, other);
+
+    index_symbols.push_back({addr, size, type, name});
+  }
+
+  symbol_index_ = ElfSymbolIndex::Build(std::move(index_symbols));
+
+  if (!cache_file.empty()) {
+    Status s = fs::CreateDirectories(cache_file.parent_path());
+    if (s.ok()) {
+      s = symbol_index_->WriteToFile(cache_file);
+    }
+    LOG_IF(WARNING, !s.ok()) << absl::Substitute("Could not write symbol index cache $0: $1",
+                                                 cache_file.string(), s.msg());
+  }
+
+  return symbol_index_.get();
+}
+
 // TODO(ddelnano): This function only works with sections that exist in LOAD segments.
 // This function should be able to handle any section, but for the time being its is limited
 // in scope.
@@ -244,31 +332,24 @@ StatusOr<int32_t> ElfReader::FindSegmentOffsetOfSection(std::string_view section
 StatusOr<std::vector<ElfReader::SymbolInfo>> ElfReader::SearchSymbols(
     std::string_view search_symbol, SymbolMatchType match_type, std::optional<int> symbol_type,
     bool stop_at_first_match) {
-  PL_ASSIGN_OR_RETURN(ELFIO::section * symtab_section, SymtabSection());
+  PL_ASSIGN_OR_RETURN(ElfSymbolIndex* index, SymbolIndex());
 
   std::vector<SymbolInfo> symbol_infos;
 
-  // Scan all symbols inside the symbol table.
-  const ELFIO::symbol_section_accessor symbols(elf_reader_, symtab_section);
-  for (unsigned int j = 0; j < symbols.get_symbols_num(); ++j) {
-    std::string name;
-    ELFIO::Elf64_Addr addr = 0;
-    ELFIO::Elf_Xword size = 0;
-    unsigned char bind = 0;
-    unsigned char type = ELFIO::STT_NOTYPE;
-    ELFIO::Elf_Half section_index;
-    unsigned char other;
-    symbols.get_symbol(j, name, addr, size, bind, type, section_index, other);
+  // Scan all symbols in the index. Name matching is still linear, but operates on the
+  // pre-extracted index; results are in ascending address order.
+  for (size_t j = 0; j < index->NumSymbols(); ++j) {
+    const ElfSymbolIndex::Symbol symbol = index->GetSymbol(j);
 
-    if (symbol_type.has_value() && type != symbol_type.value()) {
+    if (symbol_type.has_value() && symbol.type != symbol_type.value()) {
       continue;
     }
 
-    if (!MatchesSymbol(name, {match_type, search_symbol})) {
+    if (!MatchesSymbol(symbol.name, {match_type, search_symbol})) {
       continue;
     }
 
-    symbol_infos.push_back({std::move(name), type, addr, size});
+    symbol_infos.push_back({std::string(symbol.name), symbol.type, symbol.addr, symbol.size});
 
     if (stop_at_first_match) {
       break;
@@ -321,77 +402,37 @@ std::optional<int64_t> ElfReader::SymbolAddress(std::string_view symbol) {
 }
 
 StatusOr<std::optional<std::string>> ElfReader::AddrToSymbol(size_t sym_addr) {
-  PL_ASSIGN_OR_RETURN(ELFIO::section * symtab_section, SymtabSection());
+  PL_ASSIGN_OR_RETURN(ElfSymbolIndex* index, SymbolIndex());
 
-  const ELFIO::symbol_section_accessor symbols(elf_reader_, symtab_section);
-
-  // Call ELFIO to get symbol by address.
-  // ELFIO looks up the symbol and then populates name, size, type, etc.
-  // We only care about the name, but need to declare the other variables as well.
-  const ELFIO::Elf64_Addr addr = sym_addr;
-  std::string name;
-  ELFIO::Elf_Xword size = 0;
-  unsigned char bind = 0;
-  unsigned char type = ELFIO::STT_NOTYPE;
-  ELFIO::Elf_Half section_index;
-  unsigned char other;
-  bool found = symbols.get_symbol(addr, name, size, bind, type, section_index, other);
-
-  if (!found) {
+  const std::optional<ElfSymbolIndex::Symbol> symbol = index->FindByAddr(sym_addr);
+  if (!symbol.has_value()) {
     return std::optional<std::string>();
   }
 
-  return std::optional<std::string>(std::move(name));
+  return std::optional<std::string>(std::string(symbol->name));
 }
 
-// TODO(oazizi): Optimize by indexing or switching to binary search if we can guarantee addresses
-//               are ordered.
 StatusOr<std::optional<std::string>> ElfReader::InstrAddrToSymbol(size_t sym_addr) {
-  PL_ASSIGN_OR_RETURN(ELFIO::section * symtab_section, SymtabSection());
+  PL_ASSIGN_OR_RETURN(ElfSymbolIndex* index, SymbolIndex());
 
-  const ELFIO::symbol_section_accessor symbols(elf_reader_, symtab_section);
-  for (unsigned int j = 0; j < symbols.get_symbols_num(); ++j) {
-    // Call ELFIO to get symbol by index.
-    // ELFIO looks up the index and then populates name, addr, size, type, etc.
-    // We only care about the name and addr, but need to declare the other variables as well.
-    std::string name;
-    ELFIO::Elf64_Addr addr = 0;
-    ELFIO::Elf_Xword size = 0;
-    unsigned char bind = 0;
-    unsigned char type = ELFIO::STT_NOTYPE;
-    ELFIO::Elf_Half section_index;
-    unsigned char other;
-    symbols.get_symbol(j, name, addr, size, bind, type, section_index, other);
-
-    if (sym_addr >= addr && sym_addr < addr + size) {
-      return std::optional<std::string>(llvm::demangle(name));
-    }
+  // The index is sorted by address, so the covering function is found by binary search.
+  const std::optional<ElfSymbolIndex::Symbol> symbol = index->FindContaining(sym_addr);
+  if (!symbol.has_value()) {
+    return std::optional<std::string>();
   }
 
-  return std::optional<std::string>();
+  return std::optional<std::string>(llvm::demangle(std::string(symbol->name)));
 }
 
 StatusOr<std::unique_ptr<ElfReader::Symbolizer>> ElfReader::GetSymbolizer() {
-  PL_ASSIGN_OR_RETURN(ELFIO::section * symtab_section, SymtabSection());
+  PL_ASSIGN_OR_RETURN(ElfSymbolIndex* index, SymbolIndex());
 
   auto symbolizer = std::make_unique<ElfReader::Symbolizer>();
 
-  const ELFIO::symbol_section_accessor symbols(elf_reader_, symtab_section);
-  for (unsigned int j = 0; j < symbols.get_symbols_num(); ++j) {
-    // Call ELFIO to get symbol by index.
-    // ELFIO looks up the index and then populates name, addr, size, type, etc.
-    // We only care about the name and addr, but need to declare the other variables as well.
-    std::string name;
-    ELFIO::Elf64_Addr addr = 0;
-    ELFIO::Elf_Xword size = 0;
-    unsigned char bind = 0;
-    unsigned char type = ELFIO::STT_NOTYPE;
-    ELFIO::Elf_Half section_index;
-    unsigned char other;
-    symbols.get_symbol(j, name, addr, size, bind, type, section_index, other);
-
-    if (type == ELFIO::STT_FUNC) {
-      symbolizer->AddEntry(addr, size, llvm::demangle(name));
+  for (size_t j = 0; j < index->NumSymbols(); ++j) {
+    const ElfSymbolIndex::Symbol symbol = index->GetSymbol(j);
+    if (symbol.type == ELFIO::STT_FUNC) {
+      symbolizer->AddEntry(symbol.addr, symbol.size, llvm::demangle(std::string(symbol.name)));
     }
   }
 
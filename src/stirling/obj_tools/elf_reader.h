@@ -29,6 +29,7 @@
 #include <elfio/elfio.hpp>
 
 #include "src/common/base/base.h"
+#include "src/stirling/obj_tools/elf_symbol_index.h"
 #include "src/stirling/obj_tools/utils.h"
 
 namespace px {
@@ -64,6 +65,12 @@ class ElfReader {
 
   StatusOr<int32_t> FindSegmentOffsetOfSection(std::string_view section_name);
 
+  /**
+   * Returns the GNU build-id of the loaded binary as a lowercase hex string.
+   * Returns error::NotFound if the binary has no .note.gnu.build-id section.
+   */
+  StatusOr<std::string> BuildID();
+
   /**
    * Returns a list of symbol names that meets the search criteria.
    *
@@ -158,6 +165,14 @@ class ElfReader {
 
   StatusOr<ELFIO::section*> SymtabSection();
 
+  /**
+   * Returns the sorted address+name symbol index for the loaded binary, building it lazily.
+   * When the binary has a build-id and --stirling_elf_index_cache_path is set, the index is
+   * mmap'd from the disk cache when present, and persisted after a fresh build otherwise, so
+   * repeat agent restarts skip the ELF symbol table walk.
+   */
+  StatusOr<ElfSymbolIndex*> SymbolIndex();
+
   /**
    * Returns the ELF section with the corresponding name
    */
@@ -181,6 +196,9 @@ class ElfReader {
 
   std::filesystem::path debug_symbols_path_;
 
+  // Lazily built by SymbolIndex(); serves all symbol queries once populated.
+  std::unique_ptr<ElfSymbolIndex> symbol_index_;
+
   // Set up an elf reader, so we can extract debug symbols.
   ELFIO::elfio elf_reader_;
 };
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/obj_tools/elf_symbol_index.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+namespace px {
+namespace stirling {
+namespace obj_tools {
+
+namespace {
+constexpr uint32_t kIndexVersion = 1;
+}  // namespace
+
+std::unique_ptr<ElfSymbolIndex> ElfSymbolIndex::Build(std::vector<Symbol> symbols) {
+  std::sort(symbols.begin(), symbols.end(), [](const Symbol& a, const Symbol& b) {
+    return std::tie(a.addr, a.name) < std::tie(b.addr, b.name);
+  });
+
+  uint64_t names_size = 0;
+  for (const Symbol& symbol : symbols) {
+    names_size += symbol.name.size();
+  }
+
+  Header header;
+  header.version = kIndexVersion;
+  header.num_symbols = symbols.size();
+  header.names_size = names_size;
+
+  std::string data;
+  data.resize(sizeof(Header) + symbols.size() * sizeof(Entry) + names_size);
+  std::memcpy(data.data(), &header, sizeof(Header));
+
+  Entry* entries = reinterpret_cast<Entry*>(data.data() + sizeof(Header));
+  char* names = data.data() + sizeof(Header) + symbols.size() * sizeof(Entry);
+
+  uint32_t name_offset = 0;
+  for (size_t i = 0; i < symbols.size(); ++i) {
+    const Symbol& symbol = symbols[i];
+    entries[i] = {symbol.addr, symbol.size, name_offset,
+                  static_cast<uint32_t>(symbol.name.size()), symbol.type, 0};
+    std::memcpy(names + name_offset, symbol.name.data(), symbol.name.size());
+    name_offset += symbol.name.size();
+  }
+
+  auto index = std::unique_ptr<ElfSymbolIndex>(new ElfSymbolIndex());
+  index->owned_data_ = std::move(data);
+  // Init() cannot fail here: the data was serialized directly above.
+  PL_CHECK_OK(index->Init(index->owned_data_.data(), index->owned_data_.size()));
+  return index;
+}
+
+StatusOr<std::unique_ptr<ElfSymbolIndex>> ElfSymbolIndex::LoadFromFile(
+    const std::filesystem::path& path) {
+  const int fd = open(path.string().c_str(), O_RDONLY);
+  if (fd == -1) {
+    return error::NotFound("Could not open symbol index $0: $1.", path.string(),
+                           std::strerror(errno));
+  }
+
+  struct stat statbuf;
+  if (fstat(fd, &statbuf) != 0) {
+    close(fd);
+    return error::Internal("Could not stat symbol index $0: $1.", path.string(),
+                           std::strerror(errno));
+  }
+  const size_t file_size = statbuf.st_size;
+
+  if (file_size < sizeof(Header)) {
+    close(fd);
+    return error::Internal("Symbol index $0 is truncated.", path.string());
+  }
+
+  void* addr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping remains valid after the fd is closed.
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return error::Internal("Could not mmap symbol index $0: $1.", path.string(),
+                           std::strerror(errno));
+  }
+
+  auto index = std::unique_ptr<ElfSymbolIndex>(new ElfSymbolIndex());
+  index->mmap_data_ = static_cast<char*>(addr);
+  index->mmap_size_ = file_size;
+  PL_RETURN_IF_ERROR(index->Init(index->mmap_data_, index->mmap_size_));
+  return index;
+}
+
+ElfSymbolIndex::~ElfSymbolIndex() {
+  if (mmap_data_ != nullptr) {
+    munmap(mmap_data_, mmap_size_);
+  }
+}
+
+Status ElfSymbolIndex::Init(const char* data, const size_t size) {
+  Header header;
+  std::memcpy(&header, data, sizeof(Header));
+
+  if (header.version != kIndexVersion) {
+    return error::Internal("Symbol index version mismatch: expected $0, got $1.", kIndexVersion,
+                           header.version);
+  }
+
+  const size_t expected_size =
+      sizeof(Header) + header.num_symbols * sizeof(Entry) + header.names_size;
+  if (size != expected_size) {
+    return error::Internal("Symbol index size mismatch: expected $0, got $1.", expected_size, size);
+  }
+
+  num_symbols_ = header.num_symbols;
+  entries_ = reinterpret_cast<const Entry*>(data + sizeof(Header));
+  names_ = data + sizeof(Header) + num_symbols_ * sizeof(Entry);
+  return Status::OK();
+}
+
+Status ElfSymbolIndex::WriteToFile(const std::filesystem::path& path) const {
+  const char* data = mmap_data_ != nullptr ? mmap_data_ : owned_data_.data();
+  const size_t size = mmap_data_ != nullptr ? mmap_size_ : owned_data_.size();
+  return WriteFileFromString(path.string(), std::string_view(data, size), std::ios_base::binary);
+}
+
+ElfSymbolIndex::Symbol ElfSymbolIndex::GetSymbol(const size_t idx) const {
+  DCHECK_LT(idx, num_symbols_);
+  const Entry& entry = entries_[idx];
+  return {entry.addr, entry.size, entry.type,
+          std::string_view(names_ + entry.name_offset, entry.name_size)};
+}
+
+std::optional<ElfSymbolIndex::Symbol> ElfSymbolIndex::FindByAddr(const uint64_t addr) const {
+  const Entry* iter =
+      std::lower_bound(entries_, entries_ + num_symbols_, addr,
+                       [](const Entry& entry, const uint64_t a) { return entry.addr < a; });
+  if (iter == entries_ + num_symbols_ || iter->addr != addr) {
+    return std::nullopt;
+  }
+  return GetSymbol(iter - entries_);
+}
+
+std::optional<ElfSymbolIndex::Symbol> ElfSymbolIndex::FindContaining(const uint64_t addr) const {
+  const Entry* iter =
+      std::upper_bound(entries_, entries_ + num_symbols_, addr,
+                       [](const uint64_t a, const Entry& entry) { return a < entry.addr; });
+  if (iter == entries_) {
+    return std::nullopt;
+  }
+  --iter;
+
+  // Several symbols may share the greatest address <= addr; check each of them for a
+  // size that covers the query.
+  const uint64_t candidate_addr = iter->addr;
+  while (true) {
+    if (addr < iter->addr + iter->size) {
+      return GetSymbol(iter - entries_);
+    }
+    if (iter == entries_ || (iter - 1)->addr != candidate_addr) {
+      return std::nullopt;
+    }
+    --iter;
+  }
+}
+
+}  // namespace obj_tools
+}  // namespace stirling
+}  // namespace px
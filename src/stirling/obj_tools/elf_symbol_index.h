@@ -0,0 +1,115 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "src/common/base/base.h"
+
+namespace px {
+namespace stirling {
+namespace obj_tools {
+
+/**
+ * A symbol index for a single binary: fixed-size entries sorted by address, plus a blob of
+ * symbol names. The index has a single flat serialized representation, so it can be written
+ * to disk and later mmap'd straight back in; lookups binary-search the (possibly mmap'd)
+ * entry array directly, with no deserialization step. ElfReader uses this, keyed by build-id,
+ * so that repeat agent restarts skip ELF symbol table parsing entirely.
+ */
+class ElfSymbolIndex : public NotCopyable {
+ public:
+  struct Symbol {
+    uint64_t addr = 0;
+    uint64_t size = 0;
+    int32_t type = -1;
+    // Points into the index storage; valid for the lifetime of the index.
+    std::string_view name;
+  };
+
+  /**
+   * Builds an index from the given symbols (in any order; names are copied in).
+   */
+  static std::unique_ptr<ElfSymbolIndex> Build(std::vector<Symbol> symbols);
+
+  /**
+   * Maps an index file previously produced by WriteToFile().
+   * Returns an error if the file is missing, truncated, or of a different format version.
+   */
+  static StatusOr<std::unique_ptr<ElfSymbolIndex>> LoadFromFile(const std::filesystem::path& path);
+
+  ~ElfSymbolIndex();
+
+  Status WriteToFile(const std::filesystem::path& path) const;
+
+  size_t NumSymbols() const { return num_symbols_; }
+
+  /**
+   * Returns the idx'th symbol, in ascending address order.
+   */
+  Symbol GetSymbol(size_t idx) const;
+
+  /**
+   * Returns the first symbol located at exactly the given address, if any.
+   */
+  std::optional<Symbol> FindByAddr(uint64_t addr) const;
+
+  /**
+   * Returns a symbol whose [addr, addr + size) range contains the given address, if any.
+   */
+  std::optional<Symbol> FindContaining(uint64_t addr) const;
+
+ private:
+  ElfSymbolIndex() = default;
+
+  // Serialized layout: Header | num_symbols x Entry (sorted by addr) | name bytes.
+  struct Header {
+    uint32_t version = 0;
+    uint32_t num_symbols = 0;
+    uint64_t names_size = 0;
+  };
+  struct Entry {
+    uint64_t addr;
+    uint64_t size;
+    uint32_t name_offset;
+    uint32_t name_size;
+    int32_t type;
+    int32_t reserved;
+  };
+
+  // Validates the serialized data and points entries_/names_ into it.
+  Status Init(const char* data, size_t size);
+
+  // Backing storage: exactly one of these is populated.
+  std::string owned_data_;     // Freshly built index.
+  char* mmap_data_ = nullptr;  // Index mapped from the disk cache.
+  size_t mmap_size_ = 0;
+
+  const Entry* entries_ = nullptr;
+  const char* names_ = nullptr;
+  uint32_t num_symbols_ = 0;
+};
+
+}  // namespace obj_tools
+}  // namespace stirling
+}  // namespace px
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/obj_tools/elf_symbol_index.h"
+
+#include <vector>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace stirling {
+namespace obj_tools {
+
+namespace {
+
+constexpr int32_t kFuncType = 2;  // STT_FUNC.
+
+std::unique_ptr<ElfSymbolIndex> TestIndex() {
+  // Deliberately unsorted; Build() sorts by address.
+  std::vector<ElfSymbolIndex::Symbol> symbols = {
+      {0x3000, 0x80, kFuncType, "baz"},
+      {0x1000, 0x100, kFuncType, "foo"},
+      {0x2000, 0x40, kFuncType, "bar"},
+  };
+  return ElfSymbolIndex::Build(std::move(symbols));
+}
+
+}  // namespace
+
+TEST(ElfSymbolIndexTest, SortedByAddress) {
+  auto index = TestIndex();
+  ASSERT_EQ(index->NumSymbols(), 3);
+  EXPECT_EQ(index->GetSymbol(0).name, "foo");
+  EXPECT_EQ(index->GetSymbol(1).name, "bar");
+  EXPECT_EQ(index->GetSymbol(2).name, "baz");
+}
+
+TEST(ElfSymbolIndexTest, FindByAddr) {
+  auto index = TestIndex();
+
+  auto symbol = index->FindByAddr(0x2000);
+  ASSERT_TRUE(symbol.has_value());
+  EXPECT_EQ(symbol->name, "bar");
+  EXPECT_EQ(symbol->size, 0x40);
+
+  // Only exact address matches are returned.
+  EXPECT_FALSE(index->FindByAddr(0x2004).has_value());
+  EXPECT_FALSE(index->FindByAddr(0x4000).has_value());
+}
+
+TEST(ElfSymbolIndexTest, FindContaining) {
+  auto index = TestIndex();
+
+  auto symbol = index->FindContaining(0x1050);
+  ASSERT_TRUE(symbol.has_value());
+  EXPECT_EQ(symbol->name, "foo");
+
+  // Within the gap between bar and baz.
+  EXPECT_FALSE(index->FindContaining(0x2050).has_value());
+
+  // Before the first symbol.
+  EXPECT_FALSE(index->FindContaining(0x500).has_value());
+}
+
+TEST(ElfSymbolIndexTest, FileRoundTrip) {
+  testing::TempDir tmp_dir;
+  const std::filesystem::path path = tmp_dir.path() / "abcd1234.symidx";
+
+  ASSERT_OK(TestIndex()->WriteToFile(path));
+  ASSERT_OK_AND_ASSIGN(auto index, ElfSymbolIndex::LoadFromFile(path));
+
+  ASSERT_EQ(index->NumSymbols(), 3);
+  EXPECT_EQ(index->GetSymbol(0).name, "foo");
+  EXPECT_EQ(index->GetSymbol(0).type, kFuncType);
+
+  auto symbol = index->FindContaining(0x3010);
+  ASSERT_TRUE(symbol.has_value());
+  EXPECT_EQ(symbol->name, "baz");
+}
+
+TEST(ElfSymbolIndexTest, RejectsCorruptedFiles) {
+  testing::TempDir tmp_dir;
+
+  const std::filesystem::path missing = tmp_dir.path() / "missing.symidx";
+  EXPECT_NOT_OK(ElfSymbolIndex::LoadFromFile(missing));
+
+  const std::filesystem::path truncated = tmp_dir.path() / "truncated.symidx";
+  ASSERT_OK(WriteFileFromString(truncated.string(), "bogus"));
+  EXPECT_NOT_OK(ElfSymbolIndex::LoadFromFile(truncated));
+}
+
+}  // namespace obj_tools
+}  // namespace stirling
+}  // namespace px
@@ -20,6 +20,7 @@
 
 #include <ast/async_event_types.h>
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -224,6 +225,12 @@ Status DynamicBPFTraceConnector::InitImpl() {
   auto callback_fn = absl::bind_front(&DynamicBPFTraceConnector::HandleEvent, this);
   output_fields_ = bpftrace_->OutputFields();
   PL_RETURN_IF_ERROR(CheckOutputFields(output_fields_, table_schema_->Get().elements()));
+
+  // The printf payload is fixed-size, with each field at a fixed offset.
+  for (const auto& field : output_fields_) {
+    event_size_ = std::max(event_size_, static_cast<size_t>(field.offset) + field.type.size());
+  }
+
   PL_RETURN_IF_ERROR(bpftrace_->Deploy(callback_fn));
   return Status::OK();
 }
@@ -236,14 +243,25 @@ Status DynamicBPFTraceConnector::StopImpl() {
 void DynamicBPFTraceConnector::TransferDataImpl(ConnectorContext* /* ctx */,
                                                 const std::vector<DataTable*>& data_tables) {
   DCHECK_EQ(data_tables.size(), 1) << "Only one table is allowed per DynamicBPFTraceConnector.";
-  data_table_ = data_tables[0];
-  if (data_table_ == nullptr) {
+  DataTable* data_table = data_tables[0];
+  if (data_table == nullptr) {
     return;
   }
-  // This trigger a callbacks for each BPFTrace printf event in the perf buffers.
-  // Store data_table_ so the Handle function has the appropriate context.
+
+  // This triggers a callback for each BPFTrace printf event in the perf buffers, each of which
+  // copies its payload into event_buffer_. The payloads are converted into records afterwards as
+  // one batch, so the data table lock is taken once per poll instead of once per event.
+  event_buffer_.clear();
   bpftrace_->PollPerfBuffers();
-  data_table_ = nullptr;
+
+  if (event_buffer_.empty()) {
+    return;
+  }
+
+  DataTable::DynamicRecordBatchBuilder builder(data_table);
+  for (size_t offset = 0; offset < event_buffer_.size(); offset += event_size_) {
+    AppendRecord(&builder, event_buffer_.data() + offset);
+  }
 }
 
 namespace {
@@ -266,7 +284,13 @@ std::string ResolveInet(int af, const uint8_t* inet) {
 }  // namespace
 
 void DynamicBPFTraceConnector::HandleEvent(uint8_t* data) {
-  DataTable::DynamicRecordBuilder r(data_table_);
+  event_buffer_.insert(event_buffer_.end(), data, data + event_size_);
+}
+
+void DynamicBPFTraceConnector::AppendRecord(DataTable::DynamicRecordBatchBuilder* builder,
+                                            uint8_t* data) {
+  DataTable::DynamicRecordBatchBuilder& r = *builder;
+  r.StartRecord();
 
   const auto& columns = table_schema_->Get().elements();
 
@@ -50,8 +50,12 @@ class DynamicBPFTraceConnector : public SourceConnector {
   void TransferDataImpl(ConnectorContext* ctx, const std::vector<DataTable*>& data_tables) override;
 
  private:
+  // Callback from BPFTrace during a poll: copies the fixed-size event payload into event_buffer_.
   void HandleEvent(uint8_t* data);
 
+  // Converts one buffered event payload into a table record.
+  void AppendRecord(DataTable::DynamicRecordBatchBuilder* builder, uint8_t* data);
+
   std::string name_;
   std::unique_ptr<DynamicDataTableSchema> table_schema_;
   std::unique_ptr<bpf_tools::BPFTraceWrapper> bpftrace_;
@@ -59,8 +63,12 @@ class DynamicBPFTraceConnector : public SourceConnector {
   // The types according to the BPFTrace printf format.
   std::vector<bpftrace::Field> output_fields_;
 
-  // Used by HandleEvent so that when a callback is triggered, HandleEvent knows the context.
-  DataTable* data_table_ = nullptr;
+  // Size of one printf event payload, computed from the output fields.
+  size_t event_size_ = 0;
+
+  // Pending event payloads drained from the perf buffers during the current poll, appended to the
+  // data table as one batch. Reused across polls, so steady state does not allocate.
+  std::vector<uint8_t> event_buffer_;
 };
 
 }  // namespace stirling
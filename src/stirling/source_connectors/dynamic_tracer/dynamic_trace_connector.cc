@@ -360,6 +360,57 @@ class StructDecoder {
   std::string_view buf_;
 };
 
+// Returns the size in bytes of the BPF output struct described by st.
+// Must be kept consistent with the C types emitted by code_gen.cc (the struct is packed).
+size_t StructByteSize(const Struct& st) {
+  // clang-format off
+  static const std::map<ScalarType, size_t> kTypeSizes = {
+          {ScalarType::BOOL, 1},
+
+          {ScalarType::SHORT, sizeof(short)},               // NOLINT(runtime/int)
+          {ScalarType::USHORT, sizeof(unsigned short)},     // NOLINT(runtime/int)
+          {ScalarType::INT, sizeof(int)},
+          {ScalarType::UINT, sizeof(unsigned int)},
+          {ScalarType::LONG, sizeof(long)},                 // NOLINT(runtime/int)
+          {ScalarType::ULONG, sizeof(unsigned long)},       // NOLINT(runtime/int)
+          {ScalarType::LONGLONG, sizeof(long long)},        // NOLINT(runtime/int)
+          {ScalarType::ULONGLONG, sizeof(unsigned long long)},  // NOLINT(runtime/int)
+
+          {ScalarType::INT8, 1},
+          {ScalarType::INT16, 2},
+          {ScalarType::INT32, 4},
+          {ScalarType::INT64, 8},
+          {ScalarType::UINT8, 1},
+          {ScalarType::UINT16, 2},
+          {ScalarType::UINT32, 4},
+          {ScalarType::UINT64, 8},
+
+          {ScalarType::CHAR, 1},
+          {ScalarType::UCHAR, 1},
+
+          {ScalarType::FLOAT, sizeof(float)},
+          {ScalarType::DOUBLE, sizeof(double)},
+
+          {ScalarType::VOID_POINTER, 8},
+
+          {ScalarType::STRING, dynamic_tracing::kStructStringSize},
+          {ScalarType::BYTE_ARRAY, dynamic_tracing::kStructByteArraySize},
+          {ScalarType::STRUCT_BLOB, dynamic_tracing::kStructBlobSize},
+  };
+  // clang-format on
+
+  size_t size = 0;
+  for (const auto& field : st.fields()) {
+    auto iter = kTypeSizes.find(field.type());
+    if (iter == kTypeSizes.end()) {
+      LOG(DFATAL) << absl::Substitute("Unrecognized base type: $0", field.type());
+      continue;
+    }
+    size += iter->second;
+  }
+  return size;
+}
+
 Status FillColumn(StructDecoder* struct_decoder, DataTable::DynamicRecordBuilder* r, size_t col_idx,
                   ScalarType type, const RepeatedPtrField<StructSpec>& col_decoder) {
 #define WRITE_COLUMN(field_type, column_type)                                        \
@@ -455,6 +506,19 @@ Status FillColumn(StructDecoder* struct_decoder, DataTable::DynamicRecordBuilder
 
 Status DynamicTraceConnector::AppendRecord(const Struct& st, uint32_t asid, std::string_view buf,
                                            DataTable* data_table) {
+  // Events whose output struct ends in a blob container are submitted with the unused
+  // container capacity trimmed off (see GenPerfBufferOutputAction()). The trimmed tail is
+  // zero-initialized on the BPF side, so zero-extending the event back to the full struct
+  // size reconstructs the original struct for decoding.
+  std::string extended_buf;
+  const size_t struct_size = StructByteSize(st);
+  if (buf.size() < struct_size) {
+    extended_buf.reserve(struct_size);
+    extended_buf.assign(buf);
+    extended_buf.resize(struct_size, '\0');
+    buf = extended_buf;
+  }
+
   StructDecoder struct_decoder(buf);
   DataTable::DynamicRecordBuilder r(data_table);
 
@@ -584,6 +584,11 @@ std::string GenPerfBufferOutput(const PerfBufferOutput& output) {
 
 namespace {
 
+bool IsBlobType(ScalarType type) {
+  return type == ScalarType::STRING || type == ScalarType::BYTE_ARRAY ||
+         type == ScalarType::STRUCT_BLOB;
+}
+
 StatusOr<std::vector<std::string>> GenPerfBufferOutputAction(
     const ir::physical::Struct& output_struct, const PerfBufferOutputAction& action) {
   std::string output_var_name = absl::StrCat(action.perf_buffer_name(), "_value");
@@ -604,8 +609,30 @@ StatusOr<std::vector<std::string>> GenPerfBufferOutputAction(
                                           output_struct.fields(struct_field_index++).name(), f));
   }
 
-  code_lines.push_back(absl::Substitute("$0.perf_submit(ctx, $1, sizeof(*$1));",
-                                        action.perf_buffer_name(), output_var_name));
+  // When the output struct ends in a blob container (string, byte array or struct blob),
+  // the container is usually mostly empty, yet a fixed-size perf_submit transmits all of it.
+  // Trim the unused capacity off the submission instead. Trimming is done in multiples of
+  // 8 bytes so that the perf ring's 8-byte padding can never alias a transmitted field;
+  // the userspace decoder zero-extends the event back to the full struct size, which
+  // faithfully reconstructs the (zero-initialized) trimmed tail.
+  if (!output_struct.fields().empty() &&
+      IsBlobType(output_struct.fields(output_struct.fields_size() - 1).type())) {
+    const std::string& last_field_name =
+        output_struct.fields(output_struct.fields_size() - 1).name();
+    std::string size_var_name = absl::StrCat(output_var_name, "_size");
+    code_lines.push_back(absl::Substitute(
+        "uint64_t $0 = sizeof(*$1) - ((sizeof($1->$2.buf) - $1->$2.len) & ~(uint64_t)7);",
+        size_var_name, output_var_name, last_field_name));
+    code_lines.push_back(
+        absl::Substitute("if ($0 > sizeof(*$1)) { $0 = sizeof(*$1); }", size_var_name,
+                         output_var_name));
+    code_lines.push_back(absl::Substitute("$0.perf_submit(ctx, $1, $2);",
+                                          action.perf_buffer_name(), output_var_name,
+                                          size_var_name));
+  } else {
+    code_lines.push_back(absl::Substitute("$0.perf_submit(ctx, $1, sizeof(*$1));",
+                                          action.perf_buffer_name(), output_var_name));
+  }
 
   return code_lines;
 }
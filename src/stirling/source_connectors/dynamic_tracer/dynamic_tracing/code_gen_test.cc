@@ -475,6 +475,97 @@ TEST(GenProgramTest, SpecsAndCode) {
   EXPECT_THAT(bcc_code_lines, ElementsAreArray(expected_code_lines));
 }
 
+// When the output struct ends in a blob container, the perf_submit size is trimmed down to
+// the used portion of the container (in multiples of 8 bytes).
+TEST(GenProgramTest, TrailingBlobOutputTrimsSubmission) {
+  const std::string program_protobuf = R"proto(
+                                       deployment_spec {
+                                         path: "target_binary_path"
+                                       }
+                                       structs {
+                                         name: "out_event_t"
+                                         fields {
+                                           name: "i32"
+                                           type: INT32
+                                         }
+                                         fields {
+                                           name: "msg"
+                                           type: STRING
+                                         }
+                                       }
+                                       outputs {
+                                         name: "out_events"
+                                         struct_type: "out_event_t"
+                                       }
+                                       arrays {
+                                         name: "out_events_value_array"
+                                         type { struct_type: "out_event_t" }
+                                         capacity: 1
+                                       }
+                                       probes {
+                                         name: "probe_entry"
+                                         tracepoint {
+                                           symbol: "target_symbol"
+                                           type: ENTRY
+                                         }
+                                         vars {
+                                           scalar_var {
+                                             name: "val"
+                                             type: INT32
+                                             reg: SP
+                                           }
+                                         }
+                                         vars {
+                                           scalar_var {
+                                             name: "msg_ptr"
+                                             type: VOID_POINTER
+                                             reg: SP
+                                           }
+                                         }
+                                         vars {
+                                           scalar_var {
+                                             name: "msg_len"
+                                             type: INT
+                                             reg: SP
+                                           }
+                                         }
+                                         vars {
+                                           ptr_len_var {
+                                             name: "msg"
+                                             type: STRING
+                                             ptr_var_name: "msg_ptr"
+                                             len_var_name: "msg_len"
+                                           }
+                                         }
+                                         output_actions {
+                                           perf_buffer_name: "out_events"
+                                           data_buffer_array_name: "out_events_value_array"
+                                           output_struct_name: "out_event_t"
+                                           variable_names: "val"
+                                           variable_names: "msg"
+                                         }
+                                       }
+                                       )proto";
+
+  ir::physical::Program program;
+
+  ASSERT_TRUE(TextFormat::ParseFromString(program_protobuf, &program));
+
+  ASSERT_OK_AND_ASSIGN(const std::string bcc_code, GenBCCProgram(program));
+
+  EXPECT_THAT(
+      bcc_code,
+      ::testing::HasSubstr(
+          "uint64_t out_events_value_size = sizeof(*out_events_value) - "
+          "((sizeof(out_events_value->msg.buf) - out_events_value->msg.len) & ~(uint64_t)7);"));
+  EXPECT_THAT(bcc_code,
+              ::testing::HasSubstr("if (out_events_value_size > sizeof(*out_events_value)) { "
+                                   "out_events_value_size = sizeof(*out_events_value); }"));
+  EXPECT_THAT(
+      bcc_code,
+      ::testing::HasSubstr("out_events.perf_submit(ctx, out_events_value, out_events_value_size);"));
+}
+
 }  // namespace dynamic_tracing
 }  // namespace stirling
 }  // namespace px
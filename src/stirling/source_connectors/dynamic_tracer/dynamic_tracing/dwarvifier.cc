@@ -150,6 +150,14 @@ class Dwarvifier {
   std::map<std::string, obj_tools::ArgInfo> args_map_;
   obj_tools::RetValInfo retval_info_;
 
+  // Memoized DWARF function queries, keyed by symbol. The entry and return probes generated
+  // from one logical probe both query the same function, so each symbol is resolved only once.
+  struct FunctionInfo {
+    std::map<std::string, obj_tools::ArgInfo> args_map;
+    obj_tools::RetValInfo retval_info;
+  };
+  absl::flat_hash_map<std::string, FunctionInfo> function_info_cache_;
+
   // All defined variables.
   absl::flat_hash_map<std::string, ir::physical::Field> variables_;
 
@@ -455,10 +463,18 @@ Status Dwarvifier::GenerateProbe(const ir::logical::Probe& input_probe,
   // Some initial setup.
   variables_.clear();
   if (dwarf_reader_ != nullptr) {
-    PL_ASSIGN_OR_RETURN(args_map_,
-                        dwarf_reader_->GetFunctionArgInfo(input_probe.tracepoint().symbol()));
-    PL_ASSIGN_OR_RETURN(retval_info_,
-                        dwarf_reader_->GetFunctionRetValInfo(input_probe.tracepoint().symbol()));
+    // The entry and return probes generated from one logical probe target the same symbol,
+    // so memoize the DWARF function queries to avoid resolving each function twice.
+    const std::string& symbol = input_probe.tracepoint().symbol();
+    auto iter = function_info_cache_.find(symbol);
+    if (iter == function_info_cache_.end()) {
+      FunctionInfo info;
+      PL_ASSIGN_OR_RETURN(info.args_map, dwarf_reader_->GetFunctionArgInfo(symbol));
+      PL_ASSIGN_OR_RETURN(info.retval_info, dwarf_reader_->GetFunctionRetValInfo(symbol));
+      iter = function_info_cache_.emplace(symbol, std::move(info)).first;
+    }
+    args_map_ = iter->second.args_map;
+    retval_info_ = iter->second.retval_info;
   }
 
   auto* p = output_program->add_probes();
@@ -104,20 +104,40 @@ struct ObjInfo {
 // Prepares the input program for compilation by:
 // 1) Resolving the tracepoint target specification into an object path (e.g. UPID->path).
 // 2) Preparing the Elf and Dwarf info for the binary.
-StatusOr<ObjInfo> Prepare(const ir::logical::TracepointDeployment& input_program) {
-  ObjInfo obj_info;
+//
+// The readers (in particular the fully-indexed DwarfReader) dominate the compilation cost on
+// large binaries, and repeated deployments typically target the same binaries, so the readers
+// are cached per (path, mtime) and reused across deployments. The number of distinct traced
+// binaries is expected to be small, so the cache is not bounded.
+StatusOr<ObjInfo*> Prepare(const ir::logical::TracepointDeployment& input_program) {
+  static absl::flat_hash_map<std::string, std::unique_ptr<ObjInfo>>* obj_info_cache =
+      new absl::flat_hash_map<std::string, std::unique_ptr<ObjInfo>>();
 
   const auto& binary_path = input_program.deployment_spec().path();
   LOG(INFO) << absl::Substitute("Tracepoint binary: $0", binary_path);
 
-  PL_ASSIGN_OR_RETURN(obj_info.elf_reader, ElfReader::Create(binary_path));
+  // Include the modification time in the key, so that a binary that gets replaced in-place
+  // (e.g. a redeployed executable at the same path) does not hit stale readers.
+  std::error_code ec;
+  const auto mtime = std::filesystem::last_write_time(binary_path, ec).time_since_epoch().count();
+  const std::string cache_key = absl::Substitute("$0:$1", binary_path, ec ? 0 : mtime);
 
-  const auto& debug_symbols_path = obj_info.elf_reader->debug_symbols_path().string();
+  auto iter = obj_info_cache->find(cache_key);
+  if (iter != obj_info_cache->end()) {
+    return iter->second.get();
+  }
+
+  auto obj_info = std::make_unique<ObjInfo>();
+
+  PL_ASSIGN_OR_RETURN(obj_info->elf_reader, ElfReader::Create(binary_path));
+
+  const auto& debug_symbols_path = obj_info->elf_reader->debug_symbols_path().string();
 
-  obj_info.dwarf_reader =
+  obj_info->dwarf_reader =
       DwarfReader::CreateIndexingAll(debug_symbols_path).ConsumeValueOr(nullptr);
 
-  return obj_info;
+  iter = obj_info_cache->emplace(cache_key, std::move(obj_info)).first;
+  return iter->second.get();
 }
 
 }  // namespace
@@ -133,22 +153,22 @@ StatusOr<BCCProgram> CompileProgram(ir::logical::TracepointDeployment* input_pro
   }
 
   // Get the ELF and DWARF readers for the program.
-  PL_ASSIGN_OR_RETURN(ObjInfo obj_info, Prepare(*input_program));
+  PL_ASSIGN_OR_RETURN(ObjInfo* obj_info, Prepare(*input_program));
 
   // --------------------------
   // Pre-processing pipeline
   // --------------------------
 
   // Populate source language.
-  DetectSourceLanguage(obj_info.elf_reader.get(), obj_info.dwarf_reader.get(), input_program);
+  DetectSourceLanguage(obj_info->elf_reader.get(), obj_info->dwarf_reader.get(), input_program);
 
   // Expand symbol.
-  PL_RETURN_IF_ERROR(ResolveProbeSymbol(obj_info.elf_reader.get(), input_program));
+  PL_RETURN_IF_ERROR(ResolveProbeSymbol(obj_info->elf_reader.get(), input_program));
 
   LOG_IF(INFO, FLAGS_debug_dt_pipeline) << input_program->DebugString();
 
   // Auto-gen probe variables
-  PL_RETURN_IF_ERROR(AutoTraceExpansion(obj_info.dwarf_reader.get(), input_program));
+  PL_RETURN_IF_ERROR(AutoTraceExpansion(obj_info->dwarf_reader.get(), input_program));
 
   LOG_IF(INFO, FLAGS_debug_dt_pipeline) << input_program->DebugString();
 
@@ -162,8 +182,8 @@ StatusOr<BCCProgram> CompileProgram(ir::logical::TracepointDeployment* input_pro
   LOG_IF(INFO, FLAGS_debug_dt_pipeline) << input_program->DebugString();
 
   PL_ASSIGN_OR_RETURN(ir::physical::Program physical_program,
-                      GeneratePhysicalProgram(intermediate_program, obj_info.dwarf_reader.get(),
-                                              obj_info.elf_reader.get()));
+                      GeneratePhysicalProgram(intermediate_program, obj_info->dwarf_reader.get(),
+                                              obj_info->elf_reader.get()));
 
   LOG_IF(INFO, FLAGS_debug_dt_pipeline) << physical_program.DebugString();
 
@@ -186,7 +206,7 @@ StatusOr<BCCProgram> CompileProgram(ir::logical::TracepointDeployment* input_pro
 
   for (const auto& probe : physical_program.probes()) {
     PL_ASSIGN_OR_RETURN(std::vector<UProbeSpec> specs,
-                        GetUProbeSpec(binary_path, language, probe, obj_info.elf_reader.get()));
+                        GetUProbeSpec(binary_path, language, probe, obj_info->elf_reader.get()));
     for (auto& spec : specs) {
       bcc_program.uprobe_specs.push_back(std::move(spec));
     }
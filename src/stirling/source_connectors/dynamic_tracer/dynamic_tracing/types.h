@@ -37,7 +37,8 @@ namespace dynamic_tracing {
 //       This is currently to accommodate two limitations:
 //         1) These structures are on the stack, and we want to tune for BPF stack usage.
 //         2) Our perf_submit is of a fixed sized equal to the size of the struct (instead of
-//            actual usage).
+//            actual usage). The exception is a blob at the tail of the output struct, whose
+//            unused capacity is trimmed off the submission (see GenPerfBufferOutputAction()).
 //
 // When both these limitations are fixed, these sizes can be converged into a single size.
 
@@ -46,6 +46,12 @@ void JVMStatsConnector::FindJavaUPIDs(const ConnectorContext& ctx) {
   proc_tracker_.Update(ctx.GetUPIDs());
   const auto& upid_pidinfo_map = ctx.GetPIDInfoMap();
 
+  // Drop exited processes promptly. Their mmap'd hsperfdata stays readable after the JVM exits,
+  // so without this the frozen final counters would keep being exported.
+  for (const auto& upid : proc_tracker_.deleted_upids()) {
+    java_procs_.erase(upid);
+  }
+
   for (const auto& upid : proc_tracker_.new_upids()) {
     // The host PID 1 is not a Java app. However, when later invoking HsperfdataPath(), it could be
     // confused to conclude that there is a hsperfdata file for PID 1, because of the limitations
@@ -69,21 +75,20 @@ void JVMStatsConnector::FindJavaUPIDs(const ConnectorContext& ctx) {
   }
 }
 
-Status JVMStatsConnector::ExportStats(const md::UPID& upid,
-                                      const std::filesystem::path& hsperf_data_path,
+Status JVMStatsConnector::ExportStats(const md::UPID& upid, JavaProcInfo* java_proc,
                                       DataTable* data_table) const {
-  PL_ASSIGN_OR_RETURN(std::string hsperf_data_str, ReadFileToString(hsperf_data_path));
-
-  if (hsperf_data_str.empty()) {
-    // Assume this is a transient failure.
-    return Status::OK();
+  if (java_proc->stats_reader == nullptr) {
+    PL_ASSIGN_OR_RETURN(java_proc->stats_reader,
+                        java::StatsReader::Create(java_proc->hsperf_data_path));
   }
 
-  java::Stats stats(std::move(hsperf_data_str));
-  if (!stats.Parse().ok()) {
-    // Assumes this is a transient failure.
+  auto stats_or = java_proc->stats_reader->ReadStats();
+  if (!stats_or.ok()) {
+    // Assume this is a transient failure (e.g. the JVM has not finished writing the counter
+    // directory yet).
     return Status::OK();
   }
+  java::Stats stats = stats_or.ConsumeValueOrDie();
 
   uint64_t time = AdjustedSteadyClockNowNS();
 
@@ -115,7 +120,7 @@ void JVMStatsConnector::TransferDataImpl(ConnectorContext* ctx,
     JavaProcInfo& java_proc = iter->second;
 
     md::UPID upid_with_asid(ctx->GetASID(), upid.pid(), upid.start_ts());
-    auto status = ExportStats(upid_with_asid, java_proc.hsperf_data_path, data_table);
+    auto status = ExportStats(upid_with_asid, &java_proc, data_table);
     if (!status.ok()) {
       ++java_proc.export_failure_count;
     }
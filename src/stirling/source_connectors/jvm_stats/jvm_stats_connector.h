@@ -64,9 +64,10 @@ class JVMStatsConnector : public SourceConnector {
   // Finds the UPIDs of newly-created processes as monitoring targets.
   void FindJavaUPIDs(const ConnectorContext& ctx);
 
+  struct JavaProcInfo;
+
   // Exports JVM performance metrics to data table.
-  Status ExportStats(const md::UPID& upid, const std::filesystem::path& hsperf_data_path,
-                     DataTable* data_table) const;
+  Status ExportStats(const md::UPID& upid, JavaProcInfo* java_proc, DataTable* data_table) const;
 
   // Keeps track of the currently-running processes. Used to find the newly-created processes.
   ProcTracker proc_tracker_;
@@ -77,6 +78,9 @@ class JVMStatsConnector : public SourceConnector {
     // the process will no longer be monitored.
     int export_failure_count = 0;
     std::filesystem::path hsperf_data_path;
+    // Keeps the hsperfdata file mmap'd across samples, so a sample is a handful of direct memory
+    // reads. Created lazily on the first export.
+    std::unique_ptr<java::StatsReader> stats_reader;
   };
   absl::flat_hash_map<md::UPID, JavaProcInfo> java_procs_;
 };
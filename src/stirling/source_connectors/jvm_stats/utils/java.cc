@@ -18,11 +18,17 @@
 
 #include "src/stirling/source_connectors/jvm_stats/utils/java.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <absl/strings/match.h>
 
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "src/common/base/byte_utils.h"
@@ -104,6 +110,71 @@ uint64_t Stats::SumStatsForSuffixes(const std::vector<std::string_view>& suffixe
   return sum;
 }
 
+StatsReader::StatsReader(int fd, const uint8_t* data, size_t size)
+    : fd_(fd), data_(data), size_(size) {}
+
+StatsReader::~StatsReader() {
+  munmap(const_cast<uint8_t*>(data_), size_);
+  close(fd_);
+}
+
+StatusOr<std::unique_ptr<StatsReader>> StatsReader::Create(
+    const std::filesystem::path& hsperf_data_path) {
+  int fd = open(hsperf_data_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return error::NotFound("Failed to open hsperfdata file $0", hsperf_data_path.string());
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(hsperf::Prologue)) {
+    close(fd);
+    return error::Internal("hsperfdata file $0 is missing or too small",
+                           hsperf_data_path.string());
+  }
+
+  void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, /*offset*/ 0);
+  if (addr == MAP_FAILED) {
+    close(fd);
+    return error::Internal("Failed to mmap hsperfdata file $0", hsperf_data_path.string());
+  }
+
+  return std::unique_ptr<StatsReader>(
+      new StatsReader(fd, static_cast<const uint8_t*>(addr), st.st_size));
+}
+
+Status StatsReader::BuildIndex() {
+  std::string_view buf_view(reinterpret_cast<const char*>(data_), size_);
+
+  hsperf::HsperfData hsperf_data = {};
+  PL_RETURN_IF_ERROR(ParseHsperfData(buf_view, &hsperf_data));
+
+  counters_.clear();
+  for (const auto& entry : hsperf_data.data_entries) {
+    if (entry.header->data_type != static_cast<uint8_t>(hsperf::DataType::kLong)) {
+      continue;
+    }
+    counters_.push_back({entry.name, entry.data});
+  }
+  indexed_entries_ = hsperf_data.prologue->num_entries;
+  return Status::OK();
+}
+
+StatusOr<Stats> StatsReader::ReadStats() {
+  // The JVM may register counters after our first read; re-parse the directory when the entry
+  // count has moved. In the steady state this branch is never taken.
+  const auto* prologue = reinterpret_cast<const hsperf::Prologue*>(data_);
+  if (counters_.empty() || prologue->num_entries != indexed_entries_) {
+    PL_RETURN_IF_ERROR(BuildIndex());
+  }
+
+  std::vector<Stats::Stat> stat_vec;
+  stat_vec.reserve(counters_.size());
+  for (const auto& counter : counters_) {
+    stat_vec.push_back({counter.name, LEndianBytesToInt<uint64_t>(counter.data)});
+  }
+  return Stats(std::move(stat_vec));
+}
+
 StatusOr<std::filesystem::path> HsperfdataPath(pid_t pid) {
   const system::Config& sysconfig = system::Config::GetInstance();
   const std::filesystem::path& host_path = sysconfig.host_path();
@@ -19,11 +19,13 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include "src/common/base/base.h"
 #include "src/common/base/statusor.h"
 
 namespace px {
@@ -64,6 +66,48 @@ class Stats {
   std::vector<Stat> stats_;
 };
 
+/**
+ * StatsReader keeps a JVM's hsperfdata file mmap'd across samples.
+ *
+ * Hsperfdata is itself a memory-mapped file on the JVM side, so the mapping always reflects the
+ * live counter values. The counter directory is parsed once to build an index of the long-valued
+ * counters; each subsequent sample is then just a direct read of 8 bytes per counter from the
+ * mapping, with no file open or directory re-parse. The index is rebuilt if the JVM registers
+ * additional counters after the first read.
+ *
+ * The mapping outlives the JVM process, so the owner must drop the reader when the process exits;
+ * otherwise frozen final values would keep being exported.
+ */
+class StatsReader : public NotCopyMoveable {
+ public:
+  static StatusOr<std::unique_ptr<StatsReader>> Create(
+      const std::filesystem::path& hsperf_data_path);
+  ~StatsReader();
+
+  /**
+   * Reads the current values of all indexed long-valued counters from the mapping.
+   */
+  StatusOr<Stats> ReadStats();
+
+ private:
+  StatsReader(int fd, const uint8_t* data, size_t size);
+
+  Status BuildIndex();
+
+  struct CounterRef {
+    // Name and data point into the mapping; names are constant for the lifetime of the file.
+    std::string_view name;
+    std::string_view data;
+  };
+
+  int fd_ = -1;
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  // Number of directory entries covered by counters_; used to detect late-registered counters.
+  uint32_t indexed_entries_ = 0;
+  std::vector<CounterRef> counters_;
+};
+
 /**
  * Returns the path of the hsperfdata for a JVM process.
  */
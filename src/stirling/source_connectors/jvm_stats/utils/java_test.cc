@@ -59,6 +59,28 @@ TEST(StatsTest, CommonValues) {
   EXPECT_EQ(2, stats.MaxHeapSizeBytes());
 }
 
+// Tests that StatsReader reads the same values through its cached index as a full parse does.
+TEST(StatsReaderTest, MatchesFullParse) {
+  const std::string hsperfdata_path = testing::BazelRunfilePath(
+      "src/stirling/source_connectors/jvm_stats/utils/test_hsperfdata");
+
+  ASSERT_OK_AND_ASSIGN(std::string hsperf_data_str, ReadFileToString(hsperfdata_path));
+  Stats parsed_stats(std::move(hsperf_data_str));
+  ASSERT_OK(parsed_stats.Parse());
+
+  ASSERT_OK_AND_ASSIGN(auto reader, StatsReader::Create(hsperfdata_path));
+
+  // Read twice: the first read builds the counter index, the second exercises the cached path.
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(Stats stats, reader->ReadStats());
+    EXPECT_EQ(parsed_stats.YoungGCTimeNanos(), stats.YoungGCTimeNanos());
+    EXPECT_EQ(parsed_stats.FullGCTimeNanos(), stats.FullGCTimeNanos());
+    EXPECT_EQ(parsed_stats.UsedHeapSizeBytes(), stats.UsedHeapSizeBytes());
+    EXPECT_EQ(parsed_stats.TotalHeapSizeBytes(), stats.TotalHeapSizeBytes());
+    EXPECT_EQ(parsed_stats.MaxHeapSizeBytes(), stats.MaxHeapSizeBytes());
+  }
+}
+
 TEST(HsperfdataPathTest, ResultIsAsExpected) {
   const char kClassPath[] = "src/stirling/source_connectors/jvm_stats/testing/HelloWorld.jar";
   const std::string class_path = testing::BazelRunfilePath(kClassPath);
@@ -23,6 +23,8 @@
 #include <iostream>
 #include <string>
 
+#include <absl/container/flat_hash_set.h>
+
 #include "src/common/base/base.h"
 #include "src/common/system/proc_parser.h"
 #include "src/shared/metadata/metadata.h"
@@ -55,6 +57,8 @@ void NetworkStatsConnector::TransferNetworkStatsTable(ConnectorContext* ctx,
 
   int64_t timestamp = AdjustedSteadyClockNowNS();
 
+  absl::flat_hash_set<std::string> pods_seen;
+
   for (const auto& [pod_name, pod_id] : k8s_md.pods_by_name()) {
     PL_UNUSED(pod_name);
 
@@ -72,6 +76,18 @@ void NetworkStatsConnector::TransferNetworkStatsTable(ConnectorContext* ctx,
       continue;
     }
 
+    pods_seen.insert(std::string(pod_id));
+
+    // The counters are cumulative, so an unchanged sample would emit a row identical to the
+    // previous one (except the timestamp). Skip those; emit only rows whose counters moved.
+    auto [prev_it, inserted] = prev_stats_.try_emplace(std::string(pod_id), stats);
+    if (!inserted) {
+      if (prev_it->second == stats) {
+        continue;
+      }
+      prev_it->second = stats;
+    }
+
     DataTable::RecordBuilder<&kNetworkStatsTable> r(data_table, timestamp);
 
     r.Append<r.ColIndex("time_")>(timestamp);
@@ -85,6 +101,10 @@ void NetworkStatsConnector::TransferNetworkStatsTable(ConnectorContext* ctx,
     r.Append<r.ColIndex("tx_errors")>(stats.tx_errs);
     r.Append<r.ColIndex("tx_drops")>(stats.tx_drops);
   }
+
+  // Prune cached samples for pods that are gone, so the cache stays bounded by live pods.
+  absl::erase_if(prev_stats_,
+                 [&pods_seen](const auto& entry) { return !pods_seen.contains(entry.first); });
 }
 
 Status NetworkStatsConnector::GetNetworkStatsForPod(const system::ProcParser& proc_parser,
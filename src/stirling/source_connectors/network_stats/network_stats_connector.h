@@ -24,6 +24,8 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+
 #include "src/common/base/base.h"
 #include "src/common/system/system.h"
 #include "src/shared/metadata/metadata.h"
@@ -70,6 +72,11 @@ class NetworkStatsConnector : public SourceConnector {
                                       system::ProcParser::NetworkStats* stats);
 
   std::unique_ptr<system::ProcParser> proc_parser_;
+
+  // Previous sample per pod. Network counters are cumulative, so a pod whose stats are unchanged
+  // since the last emitted row carries no new information and is skipped. Entries for pods that
+  // disappear are pruned each cycle.
+  absl::flat_hash_map<std::string, system::ProcParser::NetworkStats> prev_stats_;
 };
 
 }  // namespace stirling
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/source_connectors/perf_profiler/java/symbol_file_tail_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+namespace px {
+namespace stirling {
+namespace java {
+
+namespace {
+// The mapping is grown in multiples of this chunk size, so that a steadily growing symbol
+// file does not force a remap on every consume cycle. Mapping beyond EOF is benign: pages
+// past the end of the file are never touched until the file has grown into them.
+constexpr size_t kMappingChunkSize = 1ULL << 20;
+}  // namespace
+
+StatusOr<std::unique_ptr<SymbolFileTailReader>> SymbolFileTailReader::Create(
+    const std::filesystem::path& path) {
+  const int fd = open(path.string().c_str(), O_RDONLY);
+  if (fd == -1) {
+    return error::Internal("Could not open symbol file $0: $1.", path.string(),
+                           std::strerror(errno));
+  }
+  return std::unique_ptr<SymbolFileTailReader>(new SymbolFileTailReader(fd));
+}
+
+SymbolFileTailReader::~SymbolFileTailReader() {
+  if (data_ != nullptr) {
+    munmap(data_, mapped_size_);
+  }
+  close(fd_);
+}
+
+Status SymbolFileTailReader::EnsureMapped(const size_t required_size) {
+  if (required_size <= mapped_size_) {
+    return Status::OK();
+  }
+
+  const size_t new_size = SnapUpToMultiple(required_size, kMappingChunkSize);
+
+  // Rather than mremap() (non-portable) we drop the old mapping and create a larger one.
+  // This happens at most once per kMappingChunkSize of symbol file growth; the pages
+  // themselves stay resident in the page cache.
+  if (data_ != nullptr) {
+    munmap(data_, mapped_size_);
+    data_ = nullptr;
+    mapped_size_ = 0;
+  }
+
+  void* addr = mmap(nullptr, new_size, PROT_READ, MAP_SHARED, fd_, 0);
+  if (addr == MAP_FAILED) {
+    return error::Internal("Could not mmap symbol file: $0.", std::strerror(errno));
+  }
+
+  data_ = static_cast<char*>(addr);
+  mapped_size_ = new_size;
+  return Status::OK();
+}
+
+Status SymbolFileTailReader::ConsumeRecords(const RecordFn& fn) {
+  struct stat statbuf;
+  if (fstat(fd_, &statbuf) != 0) {
+    return error::Internal("Could not stat symbol file: $0.", std::strerror(errno));
+  }
+  const size_t file_size = statbuf.st_size;
+
+  // The symbol file is append-only, so anything before parse_offset_ has been consumed.
+  if (file_size <= parse_offset_) {
+    return Status::OK();
+  }
+
+  PL_RETURN_IF_ERROR(EnsureMapped(file_size));
+
+  while (parse_offset_ + sizeof(RawSymbolUpdate) <= file_size) {
+    // Records in the file are packed, i.e. not aligned; copy the header out.
+    RawSymbolUpdate update;
+    std::memcpy(&update, data_ + parse_offset_, sizeof(RawSymbolUpdate));
+
+    const size_t record_size = sizeof(RawSymbolUpdate) + update.TotalNumSymbolBytes();
+    if (parse_offset_ + record_size > file_size) {
+      // The agent is mid-append; this record will be complete on a subsequent call.
+      break;
+    }
+
+    fn(update, data_ + parse_offset_ + sizeof(RawSymbolUpdate));
+    parse_offset_ += record_size;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace java
+}  // namespace stirling
+}  // namespace px
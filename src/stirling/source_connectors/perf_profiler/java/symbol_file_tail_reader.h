@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+
+#include "src/common/base/base.h"
+#include "src/stirling/source_connectors/perf_profiler/java/agent/raw_symbol_update.h"
+
+namespace px {
+namespace stirling {
+namespace java {
+
+/**
+ * Follows a symbol file that the JVMTI symbolization agent appends to as the JVM JITs
+ * (or unloads) methods. The file is kept mmap'd read-only for the lifetime of the reader,
+ * and a persistent parse offset tracks how far we have consumed, so each call to
+ * ConsumeRecords() indexes only the records appended since the previous call. For
+ * long-running JVMs with heavy JIT churn this avoids both a re-parse of the full file and
+ * the per-record read() syscalls of a streaming reader.
+ *
+ * The agent may be mid-append when we read: a record is consumed only once it is fully
+ * within the current file size, so a partially written tail is simply picked up on the
+ * next call.
+ */
+class SymbolFileTailReader : public NotCopyable {
+ public:
+  static StatusOr<std::unique_ptr<SymbolFileTailReader>> Create(const std::filesystem::path& path);
+  ~SymbolFileTailReader();
+
+  // Invoked once per newly appended symbol record. The symbol data pointer refers into the
+  // underlying mapping (use update.SymbolOffset() etc. to locate the individual strings);
+  // it is valid only for the duration of the callback.
+  using RecordFn = std::function<void(const RawSymbolUpdate& update, const char* symbol_data)>;
+
+  // Consumes all complete records appended since the previous call, invoking fn for each.
+  Status ConsumeRecords(const RecordFn& fn);
+
+ private:
+  explicit SymbolFileTailReader(int fd) : fd_(fd) {}
+
+  // Grows (remaps) the mapping so that at least required_size bytes are addressable.
+  Status EnsureMapped(size_t required_size);
+
+  const int fd_;
+  char* data_ = nullptr;
+  size_t mapped_size_ = 0;
+
+  // File offset of the first not-yet-consumed byte.
+  size_t parse_offset_ = 0;
+};
+
+}  // namespace java
+}  // namespace stirling
+}  // namespace px
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/stirling/source_connectors/perf_profiler/java/symbol_file_tail_reader.h"
+
+namespace px {
+namespace stirling {
+namespace java {
+
+namespace {
+
+// Appends one symbol record in the format written by the JVMTI agent:
+// a RawSymbolUpdate header followed by the three null-terminated strings.
+void AppendUpdate(std::ofstream* ofs, const uint64_t addr, const std::string& symbol,
+                  const std::string& fn_sig, const std::string& class_sig,
+                  const bool method_unload = false) {
+  RawSymbolUpdate update = {};
+  update.addr = addr;
+  update.code_size = 4;
+  update.symbol_size = symbol.size() + 1;
+  update.fn_sig_size = fn_sig.size() + 1;
+  update.class_sig_size = class_sig.size() + 1;
+  update.method_unload = method_unload;
+
+  ofs->write(reinterpret_cast<const char*>(&update), sizeof(update));
+  ofs->write(symbol.c_str(), symbol.size() + 1);
+  ofs->write(fn_sig.c_str(), fn_sig.size() + 1);
+  ofs->write(class_sig.c_str(), class_sig.size() + 1);
+  ofs->flush();
+}
+
+struct ObservedRecord {
+  uint64_t addr;
+  std::string symbol;
+  bool method_unload;
+};
+
+SymbolFileTailReader::RecordFn Observer(std::vector<ObservedRecord>* records) {
+  return [records](const RawSymbolUpdate& update, const char* symbol_data) {
+    records->push_back({update.addr,
+                        std::string(symbol_data + update.SymbolOffset(), update.symbol_size - 1),
+                        update.method_unload});
+  };
+}
+
+}  // namespace
+
+TEST(SymbolFileTailReaderTest, ConsumesOnlyNewlyAppendedRecords) {
+  testing::TempDir tmp_dir;
+  const std::filesystem::path path = tmp_dir.path() / "java-symbols.bin";
+  std::ofstream ofs(path, std::ios::binary);
+
+  AppendUpdate(&ofs, 0x1000, "foo", "()V", "Lcom/example/Foo;");
+
+  ASSERT_OK_AND_ASSIGN(auto reader, SymbolFileTailReader::Create(path));
+
+  std::vector<ObservedRecord> records;
+  ASSERT_OK(reader->ConsumeRecords(Observer(&records)));
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].addr, 0x1000);
+  EXPECT_EQ(records[0].symbol, "foo");
+
+  // No growth, no new records.
+  records.clear();
+  ASSERT_OK(reader->ConsumeRecords(Observer(&records)));
+  EXPECT_EQ(records.size(), 0);
+
+  // Append two more records; only those are surfaced.
+  AppendUpdate(&ofs, 0x2000, "bar", "()V", "Lcom/example/Bar;");
+  AppendUpdate(&ofs, 0x1000, "foo", "()V", "Lcom/example/Foo;", /* method_unload */ true);
+  ASSERT_OK(reader->ConsumeRecords(Observer(&records)));
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].addr, 0x2000);
+  EXPECT_EQ(records[0].symbol, "bar");
+  EXPECT_FALSE(records[0].method_unload);
+  EXPECT_EQ(records[1].addr, 0x1000);
+  EXPECT_TRUE(records[1].method_unload);
+}
+
+TEST(SymbolFileTailReaderTest, DefersPartiallyWrittenTailRecord) {
+  testing::TempDir tmp_dir;
+  const std::filesystem::path path = tmp_dir.path() / "java-symbols.bin";
+  std::ofstream ofs(path, std::ios::binary);
+
+  AppendUpdate(&ofs, 0x1000, "foo", "()V", "Lcom/example/Foo;");
+
+  // Simulate the agent mid-append: a header whose payload has not landed yet.
+  RawSymbolUpdate partial = {};
+  partial.addr = 0x2000;
+  partial.symbol_size = 4;
+  partial.fn_sig_size = 4;
+  partial.class_sig_size = 18;
+  ofs.write(reinterpret_cast<const char*>(&partial), sizeof(partial));
+  ofs.flush();
+
+  ASSERT_OK_AND_ASSIGN(auto reader, SymbolFileTailReader::Create(path));
+
+  std::vector<ObservedRecord> records;
+  ASSERT_OK(reader->ConsumeRecords(Observer(&records)));
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].addr, 0x1000);
+
+  // Complete the record; it is picked up on the next consume.
+  ofs.write("bar", 4);
+  ofs.write("()V", 4);
+  ofs.write("Lcom/example/Bar;", 18);
+  ofs.flush();
+
+  records.clear();
+  ASSERT_OK(reader->ConsumeRecords(Observer(&records)));
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].addr, 0x2000);
+  EXPECT_EQ(records[0].symbol, "bar");
+}
+
+}  // namespace java
+}  // namespace stirling
+}  // namespace px
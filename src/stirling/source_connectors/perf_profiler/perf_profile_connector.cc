@@ -22,7 +22,9 @@
 #include <sys/sysinfo.h>
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -40,6 +42,14 @@ DEFINE_uint32(stirling_profiler_table_update_period_seconds,
               "Number of seconds between profiler table updates.");
 DEFINE_uint32(stirling_profiler_stack_trace_sample_period_ms, 11,
               "Number of milliseconds between stack trace samples.");
+DEFINE_uint32(stirling_profiler_cpu_high_watermark_percent, 0,
+              "Node-wide CPU usage percentage above which the profiler doubles its stack trace "
+              "sample period (halving its overhead), up to the configured maximum. The period is "
+              "restored step-wise once usage drops below half the watermark. 0 disables adaptive "
+              "sampling.");
+DEFINE_uint32(stirling_profiler_max_stack_trace_sample_period_ms, 88,
+              "Upper bound on the stack trace sample period when backing off under CPU pressure. "
+              "Only used when adaptive sampling is enabled.");
 
 // Scaling factor is sized to avoid hash table collisions and timing variations.
 DEFINE_double(stirling_profiler_stack_trace_size_factor, 3.0,
@@ -56,11 +66,14 @@ namespace stirling {
 
 PerfProfileConnector::PerfProfileConnector(std::string_view source_name)
     : SourceConnector(source_name, kTables),
-      stack_trace_sampling_period_(
+      base_stack_trace_sampling_period_(
           std::chrono::milliseconds{FLAGS_stirling_profiler_stack_trace_sample_period_ms}),
+      stack_trace_sampling_period_(base_stack_trace_sampling_period_),
       sampling_period_(
           std::chrono::milliseconds{1000 * FLAGS_stirling_profiler_table_update_period_seconds}),
       push_period_(sampling_period_ / 2),
+      proc_parser_(system::Config::GetInstance()),
+      ncpus_(get_nprocs_conf()),
       stats_log_interval_(std::chrono::minutes(FLAGS_stirling_profiler_log_period_minutes) /
                           sampling_period_) {
   constexpr auto kMaxSamplingPeriod = std::chrono::milliseconds{30000};
@@ -170,13 +183,23 @@ Status PerfProfileConnector::InitImpl() {
     PL_ASSIGN_OR_RETURN(k_symbolizer_, CachingSymbolizer::Create(std::move(k_symbolizer_)));
   }
 
+  drain_thread_ = std::thread(&PerfProfileConnector::DrainLoop, this);
+
   return Status::OK();
 }
 
 Status PerfProfileConnector::StopImpl() {
-  // Must call Close() after attach_uprobes_thread_ has joined,
+  // Must call Close() after drain_thread_ has joined,
   // otherwise the two threads will cause concurrent accesses to BCC,
   // that will cause races and undefined behavior.
+  if (drain_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(drain_mu_);
+      stop_drain_thread_ = true;
+    }
+    drain_ready_cv_.notify_one();
+    drain_thread_.join();
+  }
   Close();
   return Status::OK();
 }
@@ -220,15 +243,16 @@ void PerfProfileConnector::CleanupSymbolizers(const absl::flat_hash_set<md::UPID
 }
 
 PerfProfileConnector::StackTraceHisto PerfProfileConnector::AggregateStackTraces(
-    ConnectorContext* ctx, ebpf::BPFStackTable* stack_traces) {
+    DrainTask* task) {
   // TODO(jps): switch from using get_table_offline() to directly stepping through
   // the histogram data structure. Inline populating our own data structures with this.
   // Avoid an unnecessary copy of the information in local stack_trace_keys_and_counts.
   StackTraceHisto symbolic_histogram;
   uint64_t cum_sum_count = 0;
 
-  const uint32_t asid = ctx->GetASID();
-  const absl::flat_hash_set<md::UPID>& upids_for_symbolization = ctx->GetUPIDs();
+  ebpf::BPFStackTable* stack_traces = task->stack_traces;
+  const uint32_t asid = task->asid;
+  const absl::flat_hash_set<md::UPID>& upids_for_symbolization = task->upids_for_symbolization;
 
   // Cause symbolizers to perform any necessary updates before we put them to work.
   u_symbolizer_->IterationPreTick();
@@ -239,7 +263,7 @@ PerfProfileConnector::StackTraceHisto PerfProfileConnector::AggregateStackTraces
 
   absl::flat_hash_set<int> k_stack_ids_to_remove;
 
-  for (const auto& stack_trace_key : raw_histo_data_) {
+  for (const auto& stack_trace_key : task->raw_histo_data) {
     std::string stack_trace_str;
 
     const md::UPID upid(asid, stack_trace_key.upid.pid, stack_trace_key.upid.start_time_ticks);
@@ -290,15 +314,12 @@ PerfProfileConnector::StackTraceHisto PerfProfileConnector::AggregateStackTraces
     stack_traces->clear_stack_id(k_stack_id);
   }
 
-  raw_histo_data_.clear();
-
   VLOG(1) << "PerfProfileConnector::AggregateStackTraces(): cum_sum_count: " << cum_sum_count;
   stats_.Increment(StatKey::kCumulativeSumOfAllStackTraces, cum_sum_count);
   return symbolic_histogram;
 }
 
-void PerfProfileConnector::CreateRecords(ebpf::BPFStackTable* stack_traces, ConnectorContext* ctx,
-                                         DataTable* data_table) {
+void PerfProfileConnector::CreateRecords(DrainTask* task) {
   constexpr size_t kMaxSymbolSize = 512;
   constexpr size_t kMaxStackDepth = 64;
   constexpr size_t kMaxStackTraceSize = kMaxStackDepth * kMaxSymbolSize;
@@ -311,21 +332,26 @@ void PerfProfileConnector::CreateRecords(ebpf::BPFStackTable* stack_traces, Conn
   // p0, p1, p2 => main;qux;baz   # both p2 & p3 point into baz.
   // p0, p1, p3 => main;qux;baz
 
-  StackTraceHisto stack_trace_histogram = AggregateStackTraces(ctx, stack_traces);
+  StackTraceHisto stack_trace_histogram = AggregateStackTraces(task);
 
   constexpr auto age_tick_period = std::chrono::minutes(5);
-  if (sampling_freq_mgr_.count() % (age_tick_period / sampling_period_) == 0) {
+  if (task->transfer_count % (age_tick_period / sampling_period_) == 0) {
     stack_trace_ids_.AgeTick();
   }
 
+  // When adaptive sampling has backed off the sampling rate, each observed sample stands in
+  // for several samples at the base rate. Scale counts accordingly (the factor is a power of
+  // two, so no rounding occurs), so flamegraph weights remain comparable across rate changes.
+  const uint64_t count_scale_factor = task->count_scale_factor;
+
   for (const auto& [key, count] : stack_trace_histogram) {
-    DataTable::RecordBuilder<&kStackTraceTable> r(data_table, timestamp_ns);
+    DataTable::RecordBuilder<&kStackTraceTable> r(task->data_table, timestamp_ns);
 
     r.Append<r.ColIndex("time_")>(timestamp_ns);
     r.Append<r.ColIndex("upid")>(key.upid.value());
     r.Append<r.ColIndex("stack_trace_id")>(stack_trace_ids_.Lookup(key));
     r.Append<r.ColIndex("stack_trace")>(key.stack_trace_str, kMaxStackTraceSize);
-    r.Append<r.ColIndex("count")>(count);
+    r.Append<r.ColIndex("count")>(count * count_scale_factor);
   }
 }
 
@@ -341,17 +367,81 @@ void PerfProfileConnector::ProcessBPFStackTraces(ConnectorContext* ctx, DataTabl
   constexpr int kPollTimeoutMS = 0;
   histo_perf_buf->poll(kPollTimeoutMS);
 
+  // The maps are double-buffered, so before BPF is switched back onto this map set,
+  // the drain of the other map set (queued on the previous iteration) must have finished.
+  // Normally the drain thread is long done and this does not block.
+  WaitForDrainCompletion();
+
   ++transfer_count_;
 
   // First, tell BPF to switch the maps it writes to.
   const ebpf::StatusTuple s = profiler_state_->update_value(kTransferCountIdx, transfer_count_);
   LOG_IF(ERROR, !s.ok()) << "Error writing transfer_count_";
 
+  proc_tracker_.Update(ctx->GetUPIDs());
+
+  // Hand the now-inactive map set off to the drain thread, which aggregates & symbolizes
+  // the stack traces and delivers the finished records to the data table, while BPF fills
+  // the other map set.
+  auto task = std::make_unique<DrainTask>();
+  task->stack_traces = stack_traces.get();
+  task->sample_count_idx = sample_count_idx;
+  task->raw_histo_data = std::move(raw_histo_data_);
+  raw_histo_data_.clear();
+  task->asid = ctx->GetASID();
+  task->upids_for_symbolization = ctx->GetUPIDs();
+  task->deleted_upids = proc_tracker_.deleted_upids();
+  task->data_table = data_table;
+  task->count_scale_factor = SamplingScaleFactor();
+  task->transfer_count = transfer_count_;
+
+  {
+    std::lock_guard<std::mutex> lock(drain_mu_);
+    pending_drain_task_ = std::move(task);
+  }
+  drain_ready_cv_.notify_one();
+}
+
+void PerfProfileConnector::WaitForDrainCompletion() {
+  std::unique_lock<std::mutex> lock(drain_mu_);
+  drain_done_cv_.wait(lock,
+                      [this] { return pending_drain_task_ == nullptr && !drain_in_progress_; });
+}
+
+void PerfProfileConnector::DrainLoop() {
+  while (true) {
+    std::unique_ptr<DrainTask> task;
+    {
+      std::unique_lock<std::mutex> lock(drain_mu_);
+      drain_ready_cv_.wait(
+          lock, [this] { return stop_drain_thread_ || pending_drain_task_ != nullptr; });
+      if (pending_drain_task_ == nullptr) {
+        // Stop was requested and there is no outstanding work.
+        return;
+      }
+      task = std::move(pending_drain_task_);
+      drain_in_progress_ = true;
+    }
+
+    ExecuteDrainTask(task.get());
+
+    {
+      std::lock_guard<std::mutex> lock(drain_mu_);
+      drain_in_progress_ = false;
+    }
+    drain_done_cv_.notify_one();
+  }
+}
+
+void PerfProfileConnector::ExecuteDrainTask(DrainTask* task) {
   // Read BPF stack traces & histogram, build records, incorporate records to data table.
-  CreateRecords(stack_traces.get(), ctx, data_table);
+  CreateRecords(task);
 
   // Now that we've consumed the data, reset the sample count in BPF.
-  profiler_state_->update_value(sample_count_idx, 0);
+  profiler_state_->update_value(task->sample_count_idx, 0);
+
+  // Cleanup the symbolizer so we don't leak memory.
+  CleanupSymbolizers(task->deleted_upids);
 }
 
 void PerfProfileConnector::TransferDataImpl(ConnectorContext* ctx,
@@ -366,9 +456,9 @@ void PerfProfileConnector::TransferDataImpl(ConnectorContext* ctx,
 
   ProcessBPFStackTraces(ctx, data_table);
 
-  // Cleanup the symbolizer so we don't leak memory.
-  proc_tracker_.Update(ctx->GetUPIDs());
-  CleanupSymbolizers(proc_tracker_.deleted_upids());
+  // Sampling rate changes take effect after the current window has been drained,
+  // so all the counts within one window share the same effective rate.
+  AdaptSamplingPeriod();
 
   stats_.Increment(StatKey::kBPFMapSwitchoverEvent, 1);
 
@@ -377,6 +467,65 @@ void PerfProfileConnector::TransferDataImpl(ConnectorContext* ctx,
   }
 }
 
+void PerfProfileConnector::AdaptSamplingPeriod() {
+  if (FLAGS_stirling_profiler_cpu_high_watermark_percent == 0) {
+    return;
+  }
+
+  system::ProcParser::SystemStats system_stats = {};
+  const Status s = proc_parser_.ParseProcStat(&system_stats);
+  if (!s.ok()) {
+    VLOG(1) << "AdaptSamplingPeriod(): could not read /proc/stat: " << s.msg();
+    return;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  // Note: despite the field names, the system-level CPU times from /proc/stat are in
+  // kernel ticks (they are not converted to nanoseconds by ParseProcStat).
+  const int64_t cpu_time_ticks = system_stats.cpu_utime_ns + system_stats.cpu_ktime_ns;
+
+  // The first call only primes the baseline for subsequent usage computations.
+  if (prev_cpu_time_ticks_ != 0) {
+    const double elapsed_secs = std::chrono::duration<double>(now - prev_cpu_sample_time_).count();
+    const double busy_secs =
+        static_cast<double>(cpu_time_ticks - prev_cpu_time_ticks_) /
+        static_cast<double>(system::Config::GetInstance().KernelTicksPerSecond());
+    const double usage_percent = 100.0 * busy_secs / (elapsed_secs * ncpus_);
+
+    const double high_watermark = FLAGS_stirling_profiler_cpu_high_watermark_percent;
+    const auto max_period =
+        std::chrono::milliseconds{FLAGS_stirling_profiler_max_stack_trace_sample_period_ms};
+
+    std::chrono::milliseconds new_period = stack_trace_sampling_period_;
+    if (usage_percent > high_watermark && stack_trace_sampling_period_ * 2 <= max_period) {
+      new_period = stack_trace_sampling_period_ * 2;
+    } else if (usage_percent < high_watermark / 2 &&
+               stack_trace_sampling_period_ > base_stack_trace_sampling_period_) {
+      new_period = stack_trace_sampling_period_ / 2;
+    }
+
+    if (new_period != stack_trace_sampling_period_) {
+      const bpf_tools::SamplingProbeSpec probe_spec{"sample_call_stack",
+                                                    static_cast<uint64_t>(new_period.count())};
+      const Status reset_status = ResetSamplingProbePeriod(probe_spec);
+      if (reset_status.ok()) {
+        LOG(INFO) << absl::Substitute(
+            "PerfProfiler: node CPU at $0%; changing stack trace sample period: $1 ms -> $2 ms.",
+            static_cast<int>(usage_percent), stack_trace_sampling_period_.count(),
+            new_period.count());
+        stack_trace_sampling_period_ = new_period;
+      } else {
+        LOG(WARNING) << absl::Substitute(
+            "PerfProfiler: failed to change stack trace sample period [msg=$0]",
+            reset_status.msg());
+      }
+    }
+  }
+
+  prev_cpu_time_ticks_ = cpu_time_ticks;
+  prev_cpu_sample_time_ = now;
+}
+
 void PerfProfileConnector::PrintStats() const {
   LOG(INFO) << "PerfProfileConnector statistics: " << stats_.Print();
   if (FLAGS_stirling_profiler_cache_symbols) {
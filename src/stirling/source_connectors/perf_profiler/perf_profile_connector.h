@@ -18,11 +18,15 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "src/common/system/proc_parser.h"
 #include "src/shared/types/types.h"
 #include "src/stirling/bpf_tools/bcc_bpf_intf/upid.h"
 #include "src/stirling/bpf_tools/bcc_wrapper.h"
@@ -59,6 +63,11 @@ class PerfProfileConnector : public SourceConnector, public bpf_tools::BCCWrappe
   Status StopImpl() override;
   void TransferDataImpl(ConnectorContext* ctx, const std::vector<DataTable*>& data_tables) override;
 
+  // Blocks until any queued or in-flight drain work has finished. Records are delivered to
+  // the data table asynchronously by the drain thread; call this before consuming the table
+  // when the records of the most recent TransferData() call must be visible (e.g. in tests).
+  void WaitForDrainCompletion();
+
   std::chrono::milliseconds SamplingPeriod() const { return sampling_period_; }
   std::chrono::milliseconds StackTraceSamplingPeriod() const {
     return stack_trace_sampling_period_;
@@ -73,8 +82,13 @@ class PerfProfileConnector : public SourceConnector, public bpf_tools::BCCWrappe
   utils::StatCounter<StatKey> stats() const { return stats_; }
 
  private:
-  // The time interval between stack trace samples, i.e. the sample rate used inside of BPF.
-  const std::chrono::milliseconds stack_trace_sampling_period_;
+  // The configured time interval between stack trace samples.
+  const std::chrono::milliseconds base_stack_trace_sampling_period_;
+
+  // The effective time interval between stack trace samples, i.e. the sample rate used inside of
+  // BPF. Normally equal to the base period; scaled up (in powers of two) under node CPU pressure
+  // when adaptive sampling is enabled. See AdaptSamplingPeriod().
+  std::chrono::milliseconds stack_trace_sampling_period_;
 
   // Push period is set to 1/2 of the sample period such that we push each new
   // sample when it becomes available. This is a UX decision so that the user
@@ -88,18 +102,51 @@ class PerfProfileConnector : public SourceConnector, public bpf_tools::BCCWrappe
   // RawHistoData: a list of stack trace keys that will need to be histogrammed.
   using RawHistoData = std::vector<stack_trace_key_t>;
 
+  // Everything the drain thread needs to aggregate, symbolize and publish one iteration's
+  // stack traces. The ConnectorContext is only valid for the duration of TransferDataImpl(),
+  // so the bits we need from it (ASID & UPID sets) are copied in here.
+  struct DrainTask {
+    ebpf::BPFStackTable* stack_traces;
+    uint32_t sample_count_idx;
+    RawHistoData raw_histo_data;
+    uint32_t asid;
+    absl::flat_hash_set<md::UPID> upids_for_symbolization;
+    absl::flat_hash_set<md::UPID> deleted_upids;
+    DataTable* data_table;
+    uint64_t count_scale_factor;
+    uint64_t transfer_count;
+  };
+
   explicit PerfProfileConnector(std::string_view source_name);
 
   void ProcessBPFStackTraces(ConnectorContext* ctx, DataTable* data_table);
 
+  // Run loop of drain_thread_: waits for a DrainTask and executes it.
+  void DrainLoop();
+
+  // Consumes one iteration's inactive map set: aggregates & symbolizes the stack traces,
+  // appends the records to the data table and resets the BPF sample count.
+  void ExecuteDrainTask(DrainTask* task);
+
   // Read BPF data structures, build & incorporate records to the table.
-  void CreateRecords(ebpf::BPFStackTable* stack_traces, ConnectorContext* ctx,
-                     DataTable* data_table);
+  void CreateRecords(DrainTask* task);
 
-  StackTraceHisto AggregateStackTraces(ConnectorContext* ctx, ebpf::BPFStackTable* stack_traces);
+  StackTraceHisto AggregateStackTraces(DrainTask* task);
 
   void CleanupSymbolizers(const absl::flat_hash_set<md::UPID>& deleted_upids);
 
+  // Watches node-wide CPU usage and scales the stack trace sampling period (within
+  // [base period, max period], in powers of two) to bound profiler overhead under CPU
+  // pressure. No-op unless --stirling_profiler_cpu_high_watermark_percent is set.
+  void AdaptSamplingPeriod();
+
+  // Ratio of the effective sampling period to the configured base period (a power of two).
+  // Record counts are scaled by this factor, so flamegraph weights remain comparable
+  // across sampling rate changes.
+  uint64_t SamplingScaleFactor() const {
+    return stack_trace_sampling_period_ / base_stack_trace_sampling_period_;
+  }
+
   void PrintStats() const;
 
   // data structures shared with BPF:
@@ -125,6 +172,28 @@ class PerfProfileConnector : public SourceConnector, public bpf_tools::BCCWrappe
   // TODO(oazizi): Investigate ways of sharing across source_connectors.
   ProcTracker proc_tracker_;
 
+  // The drain thread consumes the inactive BPF map set (aggregation, symbolization and
+  // record building) while BPF fills the active one, so that a slow symbolization pass
+  // does not stall the transfer thread that also services the other source connectors.
+  // Records land in the data table asynchronously; DataTable supports concurrent appends.
+  // Because the maps are double-buffered, at most one drain may be outstanding:
+  // TransferDataImpl() waits for the previous drain to complete before switching BPF
+  // back onto that map set. The symbolizers, stringifier and stack-trace-id cache are
+  // only ever touched from the drain thread once it is running.
+  std::thread drain_thread_;
+  std::mutex drain_mu_;
+  std::condition_variable drain_ready_cv_;
+  std::condition_variable drain_done_cv_;
+  std::unique_ptr<DrainTask> pending_drain_task_;
+  bool drain_in_progress_ = false;
+  bool stop_drain_thread_ = false;
+
+  // For reading node-wide CPU usage from /proc/stat, used by AdaptSamplingPeriod().
+  system::ProcParser proc_parser_;
+  const int64_t ncpus_;
+  int64_t prev_cpu_time_ticks_ = 0;
+  std::chrono::steady_clock::time_point prev_cpu_sample_time_;
+
   static void HandleHistoEvent(void* cb_cookie, void* data, int /*data_size*/);
   static void HandleHistoLoss(void* cb_cookie, uint64_t lost);
 
@@ -352,6 +352,10 @@ class PerfProfileBPFTest : public ::testing::TestWithParam<std::filesystem::path
     transfer_enable_ = false;
     transfer_data_thread_.join();
     source_->TransferData(ctx_.get(), data_tables_);
+
+    // Records are delivered asynchronously by the profiler's drain thread;
+    // wait for the final iteration's records to land in the data table.
+    source_->WaitForDrainCompletion();
   }
 
   std::chrono::duration<double> RunTest() {
@@ -524,6 +528,9 @@ TEST_P(PerfProfileBPFTest, PerfProfilerJavaTest) {
   // The deleted upids list that is inferred will match our original upid list.
   source_->TransferData(ctx_.get(), data_tables_);
 
+  // Symbolizer cleanup happens on the profiler's drain thread; wait for it to finish.
+  source_->WaitForDrainCompletion();
+
   // Expect that that the artifacts paths have been removed.
   EXPECT_THAT(artifacts_paths, Each(Not(PathExists())));
 }
@@ -33,14 +33,15 @@ Stringifier::Stringifier(Symbolizer* u_symbolizer, Symbolizer* k_symbolizer,
                          ebpf::BPFStackTable* stack_traces)
     : u_symbolizer_(u_symbolizer), k_symbolizer_(k_symbolizer), stack_traces_(stack_traces) {}
 
-std::string Stringifier::BuildStackTraceString(const std::vector<uintptr_t>& addrs,
-                                               profiler::SymbolizerFn symbolize_fn,
-                                               const std::string_view& prefix) {
+void Stringifier::BuildStackTraceString(const std::vector<uintptr_t>& addrs,
+                                        profiler::SymbolizerFn symbolize_fn,
+                                        const std::string_view& prefix,
+                                        std::string* stack_trace_str_ptr) {
   using symbolization::kJavaInterpreter;
   using symbolization::kSeparator;
 
   // TODO(jps): re-evaluate the correct amount to reserve here.
-  std::string stack_trace_str;
+  std::string& stack_trace_str = *stack_trace_str_ptr;
   stack_trace_str.reserve(128);
 
   // Some stack-traces have the address 0xcccccccccccccccc where one might
@@ -62,28 +63,24 @@ std::string Stringifier::BuildStackTraceString(const std::vector<uintptr_t>& add
       ++num_collapsed;
       continue;
     } else if (num_collapsed > 0) {
-      stack_trace_str =
-          absl::StrCat(stack_trace_str, kJavaInterpreter, " [", num_collapsed, "x]", kSeparator);
+      absl::StrAppend(&stack_trace_str, kJavaInterpreter, " [", num_collapsed, "x]", kSeparator);
       num_collapsed = 0;
     }
-    stack_trace_str = absl::StrCat(stack_trace_str, prefix, symbol, kSeparator);
+    absl::StrAppend(&stack_trace_str, prefix, symbol, kSeparator);
   }
   if (num_collapsed) {
-    stack_trace_str =
-        absl::StrCat(stack_trace_str, kJavaInterpreter, " [", num_collapsed, "x]", kSeparator);
+    absl::StrAppend(&stack_trace_str, kJavaInterpreter, " [", num_collapsed, "x]", kSeparator);
   }
 
   if (!stack_trace_str.empty()) {
     // Remove trailing separator.
     stack_trace_str.pop_back();
   }
-
-  return stack_trace_str;
 }
 
-std::string Stringifier::FindOrBuildStackTraceString(const int stack_id,
-                                                     profiler::SymbolizerFn symbolize_fn,
-                                                     const std::string_view& prefix) {
+const std::string& Stringifier::FindOrBuildStackTraceString(const int stack_id,
+                                                            profiler::SymbolizerFn symbolize_fn,
+                                                            const std::string_view& prefix) {
   // First try to find the memoized result in the stack_trace_strs_ map,
   // if no memoized result is available, build the folded stack trace string.
   auto [iter, inserted] = stack_trace_strs_.try_emplace(stack_id, "");
@@ -96,7 +93,9 @@ std::string Stringifier::FindOrBuildStackTraceString(const int stack_id,
     const std::vector<uintptr_t> addrs = stack_traces_->get_stack_addr(stack_id, kClearStackId);
     VLOG_IF(1, addrs.empty()) << absl::Substitute("[empty_stack_trace] stack_id: $0", stack_id);
 
-    iter->second = BuildStackTraceString(addrs, symbolize_fn, prefix);
+    // Build directly into the memoized map slot, so the string is constructed exactly once
+    // and memoized hits hand out a reference to it rather than a copy.
+    BuildStackTraceString(addrs, symbolize_fn, prefix, &iter->second);
   }
   return iter->second;
 }
@@ -122,16 +121,19 @@ std::string Stringifier::FoldedStackTraceString(const stack_trace_key_t& key) {
   auto k_stack_str_fn = absl::bind_front(fn_addr, this, k_stack_id, k_symbolizer_fn, kKernelPrefix);
 
   std::string stack_trace_str;
-  stack_trace_str.reserve(128);
 
   // TODO(jps/oazizi): question... should we use the "drop message" for -EEXIST,
   // if only one of two stack-ids indicates a hash table collision?
   // vs. the current logic which shows the "drop message" only if both stack-ids are -EEXIST.
 
   if (u_stack_id >= 0 && k_stack_id >= 0) {
-    stack_trace_str = u_stack_str_fn();
+    const std::string& u_stack_str = u_stack_str_fn();
+    const std::string& k_stack_str = k_stack_str_fn();
+    stack_trace_str.reserve(u_stack_str.size() + symbolization::kSeparator.size() +
+                            k_stack_str.size());
+    stack_trace_str = u_stack_str;
     stack_trace_str += symbolization::kSeparator;
-    stack_trace_str += k_stack_str_fn();
+    stack_trace_str += k_stack_str;
   } else if (u_stack_id >= 0) {
     stack_trace_str = u_stack_str_fn();
     DCHECK(k_stack_id == -EEXIST || k_stack_id == -EFAULT) << "ustack_id: " << u_stack_id;
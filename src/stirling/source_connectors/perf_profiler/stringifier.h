@@ -67,11 +67,16 @@ class Stringifier {
   std::string FoldedStackTraceString(const stack_trace_key_t& key);
 
  private:
-  std::string BuildStackTraceString(const std::vector<uintptr_t>& addrs,
-                                    profiler::SymbolizerFn symbolize_fn,
-                                    const std::string_view& prefix);
-  std::string FindOrBuildStackTraceString(const int stack_id, profiler::SymbolizerFn symbolize_fn,
-                                          const std::string_view& prefix);
+  // Appends the folded stack trace string to *stack_trace_str_ptr (normally the memoized map
+  // slot), so that the string is built in place rather than copied into the map afterwards.
+  void BuildStackTraceString(const std::vector<uintptr_t>& addrs,
+                             profiler::SymbolizerFn symbolize_fn, const std::string_view& prefix,
+                             std::string* stack_trace_str_ptr);
+  // Returns a reference to the memoized string; valid for the lifetime of this stringifier
+  // (i.e. one profiler iteration).
+  const std::string& FindOrBuildStackTraceString(const int stack_id,
+                                                 profiler::SymbolizerFn symbolize_fn,
+                                                 const std::string_view& prefix);
 
   // Memoized results of previous calls to FindOrBuildStackTraceString():
   // a map from stack-trace-id to folded stack trace string.
@@ -23,8 +23,13 @@
 namespace px {
 namespace stirling {
 
-SymbolCache::Symbol::Symbol(profiler::SymbolizerFn symbolizer_fn, const uintptr_t addr)
-    : symbol_(symbolizer_fn(addr)) {}
+std::string_view SymbolStringPool::Intern(std::string&& symbol) {
+  return *pool_.insert(std::move(symbol)).first;
+}
+
+SymbolCache::Symbol::Symbol(profiler::SymbolizerFn symbolizer_fn, const uintptr_t addr,
+                            SymbolStringPool* pool)
+    : symbol_(pool->Intern(std::string(symbolizer_fn(addr)))) {}
 
 SymbolCache::LookupResult SymbolCache::Lookup(const uintptr_t addr) {
   // Check old cache first, and move result to new cache if we have a hit.
@@ -32,14 +37,14 @@ SymbolCache::LookupResult SymbolCache::Lookup(const uintptr_t addr) {
   if (prev_cache_iter != prev_cache_.end()) {
     // Move to new cache.
     auto [curr_cache_iter, inserted] =
-        cache_.try_emplace(addr, std::move(prev_cache_iter->second.symbol_));
+        cache_.try_emplace(addr, prev_cache_iter->second.symbol_);
     DCHECK(inserted);
     prev_cache_.erase(prev_cache_iter);
     return SymbolCache::LookupResult{curr_cache_iter->second.symbol_, true};
   }
 
   // If not in old cache, try the new cache (with automatic insertion if required).
-  const auto [iter, inserted] = cache_.try_emplace(addr, symbolizer_fn_, addr);
+  const auto [iter, inserted] = cache_.try_emplace(addr, symbolizer_fn_, addr, pool_);
   return SymbolCache::LookupResult{iter->second.symbol_, !inserted};
 }
 
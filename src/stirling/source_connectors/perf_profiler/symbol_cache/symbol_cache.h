@@ -19,6 +19,7 @@
 #pragma once
 
 #include <functional>
+#include <set>
 #include <string>
 #include <utility>
 
@@ -29,9 +30,34 @@
 namespace px {
 namespace stirling {
 
+/**
+ * SymbolStringPool interns symbol strings, so that each distinct symbol is stored exactly once
+ * no matter how many per-UPID caches reference it. Replicas of the same service symbolize the
+ * same libc/runtime/JVM frames, so sharing one pool across all caches keeps only a single copy
+ * of each such string on high-pod-density nodes.
+ *
+ * Interned strings are never freed. The set of distinct symbols on a node is bounded by the
+ * code deployed there, and keeping them pinned means the views handed out (and stored in the
+ * per-UPID caches) remain valid for the lifetime of the pool.
+ */
+class SymbolStringPool {
+ public:
+  std::string_view Intern(std::string&& symbol);
+
+  size_t size() const { return pool_.size(); }
+
+ private:
+  // A node-based std::set is used instead of flat_hash_set, because rehashing a flat container
+  // moves small (SSO) strings, which would invalidate the views handed out by Intern().
+  std::set<std::string, std::less<>> pool_;
+};
+
 class SymbolCache {
  public:
-  explicit SymbolCache(profiler::SymbolizerFn symbolizer_fn) : symbolizer_fn_(symbolizer_fn) {}
+  // If no pool is provided, the cache falls back to a private pool,
+  // i.e. symbols are not shared with other caches.
+  explicit SymbolCache(profiler::SymbolizerFn symbolizer_fn, SymbolStringPool* pool = nullptr)
+      : symbolizer_fn_(symbolizer_fn), pool_(pool != nullptr ? pool : &own_pool_) {}
 
   struct LookupResult {
     std::string_view symbol;
@@ -56,15 +82,19 @@ class SymbolCache {
    */
   class Symbol {
    public:
-    Symbol(profiler::SymbolizerFn symbolizer_fn, const uintptr_t addr);
+    Symbol(profiler::SymbolizerFn symbolizer_fn, const uintptr_t addr, SymbolStringPool* pool);
 
-    // A move constructor that takes consumes a string.
-    explicit Symbol(std::string&& symbol_str) : symbol_(std::move(symbol_str)) {}
+    // Used when moving an entry between cache generations; the view stays valid because the
+    // underlying string is owned by the pool.
+    explicit Symbol(std::string_view symbol_view) : symbol_(symbol_view) {}
 
-    std::string symbol_;
+    std::string_view symbol_;
   };
 
   profiler::SymbolizerFn symbolizer_fn_;
+  // Private fallback pool, used only when no shared pool is provided at construction.
+  SymbolStringPool own_pool_;
+  SymbolStringPool* pool_;
   absl::flat_hash_map<uintptr_t, Symbol> cache_;
   absl::flat_hash_map<uintptr_t, Symbol> prev_cache_;
 };
@@ -113,5 +113,24 @@ TEST_F(SymbolCacheTest, EvictOldEntries) {
   EXPECT_EQ(sym_cache_->active_entries(), 1);
 }
 
+TEST(SymbolStringPoolTest, SharedAcrossCaches) {
+  SymbolStringPool pool;
+  SymbolCache cache_a(&SymbolizationFn, &pool);
+  SymbolCache cache_b(&SymbolizationFn, &pool);
+
+  const auto result_a = cache_a.Lookup(kAddr1);
+  const auto result_b = cache_b.Lookup(kAddr1);
+
+  EXPECT_EQ(result_a.symbol, "123");
+  EXPECT_EQ(result_b.symbol, "123");
+
+  // Both caches reference the same interned string, and the pool holds only one copy.
+  EXPECT_EQ(result_a.symbol.data(), result_b.symbol.data());
+  EXPECT_EQ(pool.size(), 1);
+
+  cache_a.Lookup(kAddr2);
+  EXPECT_EQ(pool.size(), 2);
+}
+
 }  // namespace stirling
 }  // namespace px
@@ -53,7 +53,7 @@ profiler::SymbolizerFn CachingSymbolizer::GetSymbolizerFn(const struct upid_t& u
   auto symbolizer_fn = symbolizer_->GetSymbolizerFn(upid);
 
   if (inserted) {
-    iter->second = std::make_unique<SymbolCache>(symbolizer_fn);
+    iter->second = std::make_unique<SymbolCache>(symbolizer_fn, &symbol_pool_);
   }
   auto& cache = iter->second;
 
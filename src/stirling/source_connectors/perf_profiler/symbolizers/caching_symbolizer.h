@@ -44,6 +44,7 @@ class CachingSymbolizer : public Symbolizer {
   int64_t stat_accesses() const { return stat_accesses_; }
   int64_t stat_hits() const { return stat_hits_; }
   uint64_t GetNumberOfSymbolsCached() const;
+  size_t GetNumberOfDistinctSymbols() const { return symbol_pool_.size(); }
   bool Uncacheable(const struct upid_t& /*upid*/) override { return false; }
 
  private:
@@ -53,6 +54,11 @@ class CachingSymbolizer : public Symbolizer {
 
   std::unique_ptr<Symbolizer> symbolizer_;
 
+  // One pool of interned symbol strings shared by all per-UPID caches below,
+  // so that processes running the same code (e.g. replicas of a service) store
+  // each distinct symbol only once.
+  SymbolStringPool symbol_pool_;
+
   absl::flat_hash_map<struct upid_t, std::unique_ptr<SymbolCache>> symbol_caches_;
 
   int64_t stat_accesses_ = 0;
@@ -79,82 +79,49 @@ void JavaSymbolizationContext::RemoveArtifacts() const {
 }
 
 void JavaSymbolizationContext::UpdateSymbolMap() {
-  auto reset_symbol_file = [&](const auto pos) {
-    symbol_file_->seekg(pos);
-    symbol_file_->clear();
-    DCHECK(symbol_file_->good());
-  };
-
-  java::RawSymbolUpdate update;
-
-  std::string buffer;
   std::string symbol;
   std::string fn_sig;
   std::string class_sig;
 
-  buffer.reserve(300);
   symbol.reserve(100);
   fn_sig.reserve(100);
   class_sig.reserve(100);
 
-  while (true) {
-    const auto pos = symbol_file_->tellg();
-
-    symbol_file_->read(reinterpret_cast<char*>(&update), sizeof(java::RawSymbolUpdate));
-    if (!symbol_file_->good()) {
-      // No data to be read. Break from the loop. Pedantically reset file pos so that when we
-      // return here, we are in the correct state.
-      reset_symbol_file(pos);
-      break;
-    }
-
-    const uint64_t n = update.TotalNumSymbolBytes();
-
-    if (buffer.capacity() < n) {
-      buffer.resize(n);
-    }
-
-    symbol_file_->read(buffer.data(), n);
-    if (!symbol_file_->good()) {
-      // If the read fails, then the symbol file was left in a partially written state.
-      // Reset the file position back to the beginning of a symbol, and break out of this loop.
-      reset_symbol_file(pos);
-      break;
-    }
-
-    // At this point, we have consumed an entire udpate from the symbol file.
-    // We either put a new symbol into the symbol map (common case) or remove a symbol.
-
-    if (update.method_unload) {
-      // Handle remove symbol scenario.
-      // NB: if we go back to caching Java symbols, we will need to invalidate
-      // any cached instances of this symbol.
-      symbol_map_.erase(update.addr);
-      continue;
-    }
-
-    // TODO(jps): Make the interface to the demangler consume string_view only, then
-    // convert symbol, fn_sig, and class_sig to string_view (reduces copying).
-    // TODO(jps): Remove null terminating character from java::RawSymbolUpdate.
-    symbol.assign(buffer.data() + update.SymbolOffset(), update.symbol_size - 1);
-    fn_sig.assign(buffer.data() + update.FnSigOffset(), update.fn_sig_size - 1);
-    class_sig.assign(buffer.data() + update.ClassSigOffset(), update.class_sig_size - 1);
-
-    using symbolization::kJavaPrefix;
-    const auto demangled = absl::StrCat(kJavaPrefix, java::Demangle(symbol, class_sig, fn_sig));
-
-    // TODO(jps): Change to uint32_t in java::RawSymbolUpdate.
-    const uint32_t code_size = static_cast<uint32_t>(update.code_size);
-    symbol_map_.try_emplace(update.addr, demangled, code_size);
-  }
-  DCHECK(symbol_file_->good());
+  // The reader hands us only the records appended since the last update; a partially
+  // written record at the tail of the symbol file is deferred to the next update.
+  const Status s = symbol_file_reader_->ConsumeRecords(
+      [&](const java::RawSymbolUpdate& update, const char* symbol_data) {
+        // We either put a new symbol into the symbol map (common case) or remove a symbol.
+        if (update.method_unload) {
+          // Handle remove symbol scenario.
+          // NB: if we go back to caching Java symbols, we will need to invalidate
+          // any cached instances of this symbol.
+          symbol_map_.erase(update.addr);
+          return;
+        }
+
+        // TODO(jps): Make the interface to the demangler consume string_view only, then
+        // convert symbol, fn_sig, and class_sig to string_view (reduces copying).
+        // TODO(jps): Remove null terminating character from java::RawSymbolUpdate.
+        symbol.assign(symbol_data + update.SymbolOffset(), update.symbol_size - 1);
+        fn_sig.assign(symbol_data + update.FnSigOffset(), update.fn_sig_size - 1);
+        class_sig.assign(symbol_data + update.ClassSigOffset(), update.class_sig_size - 1);
+
+        using symbolization::kJavaPrefix;
+        const auto demangled = absl::StrCat(kJavaPrefix, java::Demangle(symbol, class_sig, fn_sig));
+
+        // TODO(jps): Change to uint32_t in java::RawSymbolUpdate.
+        const uint32_t code_size = static_cast<uint32_t>(update.code_size);
+        symbol_map_.try_emplace(update.addr, demangled, code_size);
+      });
+  LOG_IF(WARNING, !s.ok()) << absl::Substitute("Could not update Java symbol map: $0.", s.msg());
 }
 
-JavaSymbolizationContext::JavaSymbolizationContext(const struct upid_t& target_upid,
-                                                   profiler::SymbolizerFn native_symbolizer_fn,
-                                                   std::unique_ptr<std::ifstream> symbol_file)
-    : native_symbolizer_fn_(native_symbolizer_fn), symbol_file_(std::move(symbol_file)) {
-  DCHECK(symbol_file_->good());
+JavaSymbolizationContext::JavaSymbolizationContext(
+    const struct upid_t& target_upid, profiler::SymbolizerFn native_symbolizer_fn,
+    std::unique_ptr<java::SymbolFileTailReader> symbol_file_reader)
+    : native_symbolizer_fn_(native_symbolizer_fn),
+      symbol_file_reader_(std::move(symbol_file_reader)) {
   UpdateSymbolMap();
 
   auto status_or_host_artifacts_path = java::ResolveHostArtifactsPath(target_upid);
@@ -168,8 +135,6 @@ JavaSymbolizationContext::JavaSymbolizationContext(const struct upid_t& target_u
   host_artifacts_path_resolved_ = true;
 }
 
-JavaSymbolizationContext::~JavaSymbolizationContext() { symbol_file_->close(); }
-
 std::string_view JavaSymbolizationContext::Symbolize(const uintptr_t addr) {
   if (requires_refresh_) {
     // Member requires_refresh_ is set by IterationPreTick(), which is called "once per iteration,"
@@ -255,13 +220,12 @@ std::string_view JavaSymbolizer::Symbolize(JavaSymbolizationContext* ctx, const
 }
 
 Status JavaSymbolizer::CreateNewJavaSymbolizationContext(const struct upid_t& upid) {
-  constexpr auto kIOFlags = std::ios::in | std::ios::binary;
   const std::filesystem::path symbol_file_path = java::StirlingSymbolFilePath(upid);
-  auto symbol_file = std::make_unique<std::ifstream>(symbol_file_path, kIOFlags);
+  auto reader_or = java::SymbolFileTailReader::Create(symbol_file_path);
 
-  if (symbol_file->fail()) {
+  if (!reader_or.ok()) {
     char const* const fmt = "Java attacher [pid=$0]: Could not open symbol file: $1.";
-    return error::Internal(fmt, upid.pid, symbol_file_path.string());
+    return error::Internal(fmt, upid.pid, reader_or.msg());
   }
 
   DCHECK(symbolization_contexts_.find(upid) == symbolization_contexts_.end());
@@ -271,7 +235,7 @@ Status JavaSymbolizer::CreateNewJavaSymbolizationContext(const struct upid_t& up
   if (inserted) {
     auto native_symbolizer_fn = native_symbolizer_->GetSymbolizerFn(upid);
     iter->second = std::make_unique<JavaSymbolizationContext>(upid, native_symbolizer_fn,
-                                                              std::move(symbol_file));
+                                                              reader_or.ConsumeValueOrDie());
   }
   auto& ctx = iter->second;
 
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "src/stirling/source_connectors/perf_profiler/java/attach.h"
+#include "src/stirling/source_connectors/perf_profiler/java/symbol_file_tail_reader.h"
 #include "src/stirling/source_connectors/perf_profiler/symbolizers/symbolizer.h"
 #include "src/stirling/utils/monitor.h"
 
@@ -46,8 +47,7 @@ class JavaSymbolizationContext {
 
   JavaSymbolizationContext(const struct upid_t& target_upid,
                            profiler::SymbolizerFn native_symbolizer_fn,
-                           std::unique_ptr<std::ifstream> symbol_file);
-  ~JavaSymbolizationContext();
+                           std::unique_ptr<java::SymbolFileTailReader> symbol_file_reader);
 
   std::string_view Symbolize(const uintptr_t addr);
 
@@ -61,7 +61,7 @@ class JavaSymbolizationContext {
   bool requires_refresh_ = false;
   SymbolMapType symbol_map_;
   profiler::SymbolizerFn native_symbolizer_fn_;
-  std::unique_ptr<std::ifstream> symbol_file_;
+  std::unique_ptr<java::SymbolFileTailReader> symbol_file_reader_;
   bool host_artifacts_path_resolved_ = false;
   std::filesystem::path host_artifacts_path_;
 };
@@ -25,8 +25,29 @@
 #include "src/stirling/bpf_tools/bcc_bpf_intf/upid.h"
 #include "src/stirling/source_connectors/proc_exit/bcc_bpf_intf/proc_exit.h"
 
+#ifdef USE_RINGBUF
+
+// Ring buffer transport (kernels 5.8+): a single small buffer shared across all CPUs, instead of
+// per-CPU perf buffer pages, which is a better fit for this low-rate stream.
+BPF_RINGBUF_OUTPUT(proc_exit_events, PROC_EXIT_RINGBUF_PAGES);
+
+// Ring buffers have no lost-sample callback, so failed submissions are counted here and
+// periodically read back by user-space. This stream has a single output, so index 0 is used.
+BPF_PERCPU_ARRAY(ringbuf_drop_counters, uint64_t, 1);
+
+#define submit_proc_exit_event(ctx, event, size)              \
+  if (proc_exit_events.ringbuf_output(event, size, 0) != 0) { \
+    ringbuf_drop_counters.increment(0);                       \
+  }
+
+#else
+
 BPF_PERF_OUTPUT(proc_exit_events);
 
+#define submit_proc_exit_event(ctx, event, size) proc_exit_events.perf_submit(ctx, event, size)
+
+#endif
+
 // This array records singular values that are used by probes. We group them together to reduce the
 // number of arrays with only 1 element. Use of per-cpu array shall be the most efficient way,
 // compared to using hash table.
@@ -63,7 +84,7 @@ TRACEPOINT_PROBE(sched, sched_process_exit) {
     event.exit_code = read_exit_code(task);
     bpf_get_current_comm(&event.comm, sizeof(event.comm));
 
-    proc_exit_events.perf_submit(args, &event, sizeof(event));
+    submit_proc_exit_event(args, &event, sizeof(event));
   }
 
   return 0;
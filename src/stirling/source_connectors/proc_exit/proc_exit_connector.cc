@@ -20,7 +20,9 @@
 
 #include <signal.h>
 
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "src/common/base/base.h"
 #include "src/common/metrics/metrics.h"
@@ -58,6 +60,21 @@ const auto kPerfBufferSpecs = MakeArray<bpf_tools::PerfBufferSpec>({
      bpf_tools::PerfBufferSizeCategory::kControl},
 });
 
+// Ring buffer callback shim, adapting the ring buffer signature to the perf buffer handler so
+// both transports share one event-handling path.
+int HandleProcExitEventRingBuf(void* cb_cookie, void* data, size_t data_size) {
+  HandleProcExitEvent(cb_cookie, data, data_size);
+  return 0;
+}
+
+const auto kRingBufferSpecs = MakeArray<bpf_tools::RingBufferSpec>({
+    {"proc_exit_events", HandleProcExitEventRingBuf},
+});
+
+// Exit events are tiny and low-rate, so a fixed-size ring buffer is plenty: 16 pages holds on the
+// order of a thousand events between two polls, versus 5MiB per CPU for the perf buffer.
+constexpr int kRingBufPages = 16;
+
 // Use char array to meet the user's interface, which expects std::string.
 constexpr char kJavaProcCrashedCounter[] = "java_proc_crashed";
 constexpr char kJavaProcCrashedWithProfilerCounter[] = "java_proc_crashed_with_profiler";
@@ -82,7 +99,14 @@ Status ProcExitConnector::InitImpl() {
   sampling_freq_mgr_.set_period(kSamplingPeriod);
   push_freq_mgr_.set_period(kPushPeriod);
 
-  PL_RETURN_IF_ERROR(InitBPFProgram(proc_exit_trace_bcc_script));
+  use_ringbuf_ = UseRingBufOutput();
+
+  std::vector<std::string> defines;
+  if (use_ringbuf_) {
+    defines.push_back("-DUSE_RINGBUF");
+    defines.push_back(absl::StrCat("-DPROC_EXIT_RINGBUF_PAGES=", kRingBufPages));
+  }
+  PL_RETURN_IF_ERROR(InitBPFProgram(proc_exit_trace_bcc_script, defines));
 
   // Writes exit_code_offset to BPF array. Note that the other offsets are injected into BCC code
   // through macros.
@@ -100,7 +124,11 @@ Status ProcExitConnector::InitImpl() {
   }
 
   PL_RETURN_IF_ERROR(AttachTracepoints(kTracepointSpecs));
-  PL_RETURN_IF_ERROR(OpenPerfBuffers(kPerfBufferSpecs, this));
+  if (use_ringbuf_) {
+    PL_RETURN_IF_ERROR(OpenRingBuffers(kRingBufferSpecs, this));
+  } else {
+    PL_RETURN_IF_ERROR(OpenPerfBuffers(kPerfBufferSpecs, this));
+  }
 
   return Status::OK();
 }
@@ -115,7 +143,12 @@ void ProcExitConnector::TransferDataImpl(ConnectorContext* ctx,
                                          const std::vector<DataTable*>& data_tables) {
   DCHECK(data_tables.size() == 1) << "Expect only one data table for proc_exit tracer";
 
-  PollPerfBuffers();
+  if (use_ringbuf_) {
+    PollRingBuffers();
+    CheckRingBufferDrops();
+  } else {
+    PollPerfBuffers();
+  }
 
   DataTable* data_table = data_tables[0];
   for (auto& event : events_) {
@@ -136,9 +169,34 @@ void ProcExitConnector::TransferDataImpl(ConnectorContext* ctx,
   events_.clear();
 }
 
+void ProcExitConnector::CheckRingBufferDrops() {
+  auto drop_counters_handle = GetPerCPUArrayTable<uint64_t>("ringbuf_drop_counters");
+
+  std::vector<uint64_t> percpu_drops;
+  ebpf::StatusTuple s = drop_counters_handle.get_value(0, percpu_drops);
+  if (!s.ok()) {
+    VLOG(1) << absl::Substitute("Failed to read ringbuf_drop_counters msg=$0", s.msg());
+    return;
+  }
+
+  uint64_t total_drops = 0;
+  for (uint64_t cpu_drops : percpu_drops) {
+    total_drops += cpu_drops;
+  }
+
+  // The BPF-side counter is monotonic; report only the delta since the last poll, through the
+  // same path as the perf buffer loss callback.
+  DCHECK_GE(total_drops, ringbuf_drops_prev_);
+  uint64_t new_drops = total_drops - ringbuf_drops_prev_;
+  ringbuf_drops_prev_ = total_drops;
+  if (new_drops > 0) {
+    HandleProcExitEventLoss(this, new_drops);
+  }
+}
+
 void ProcExitConnector::UpdateCrashedJavaProcCounters(
     uint32_t asid, const proc_exit_event_t& event,
-    const absl::flat_hash_map<md::UPID, md::PIDInfoUPtr>& upid_pid_info_map) {
+    const absl::flat_hash_map<md::UPID, md::PIDInfoPtr>& upid_pid_info_map) {
   const uint8_t exit_signal = GetExitSignal(event.exit_code);
 
   const bool is_sig_abrt = exit_signal == SIGABRT;
@@ -64,10 +64,20 @@ class ProcExitConnector : public SourceConnector, public bpf_tools::BCCWrapper {
   std::vector<struct proc_exit_event_t> events_;
 
  private:
+  // Reads the BPF-side ring buffer drop counter, and reports any new drops since the last call
+  // through the same loss-handling path as the perf buffer loss callback.
+  void CheckRingBufferDrops();
+
+  // Set during InitImpl() based on --stirling_enable_ringbuf_output and the kernel version.
+  bool use_ringbuf_ = false;
+
+  // Total drops reported by BPF as of the previous poll; used to compute deltas.
+  uint64_t ringbuf_drops_prev_ = 0;
+
   // Update counters related to java process.
   void UpdateCrashedJavaProcCounters(
       uint32_t asid, const proc_exit_event_t& event,
-      const absl::flat_hash_map<md::UPID, md::PIDInfoUPtr>& upid_pid_info_map);
+      const absl::flat_hash_map<md::UPID, md::PIDInfoPtr>& upid_pid_info_map);
 
   prometheus::Counter& java_proc_crashed_counter_;
   prometheus::Counter& java_proc_crashed_with_profiler_counter_;
@@ -42,10 +42,14 @@ Status ProcessStatsConnector::StopImpl() { return Status::OK(); }
 
 void ProcessStatsConnector::TransferProcessStatsTable(ConnectorContext* ctx,
                                                       DataTable* data_table) {
-  const absl::flat_hash_map<md::UPID, md::PIDInfoUPtr>& pid_info_by_upid = ctx->GetPIDInfoMap();
+  const absl::flat_hash_map<md::UPID, md::PIDInfoPtr>& pid_info_by_upid = ctx->GetPIDInfoMap();
 
   int64_t timestamp = AdjustedSteadyClockNowNS();
 
+  // Invariant across the cycle; don't re-query the config singleton per pid.
+  const int64_t page_size_bytes = system::Config::GetInstance().PageSizeBytes();
+  const int64_t kernel_tick_time_ns = system::Config::GetInstance().KernelTickTimeNS();
+
   for (const auto& [upid, pid_info] : pid_info_by_upid) {
     // TODO(zasgar): Fix condition for dead pids after helper function is added.
     if (pid_info == nullptr || pid_info->stop_time_ns() > 0) {
@@ -57,19 +61,10 @@ void ProcessStatsConnector::TransferProcessStatsTable(ConnectorContext* ctx,
     int32_t pid = upid.pid();
     // TODO(zasgar): We should double check the process start time to make sure it still the same
     // PID.
-    auto s1 =
-        proc_parser_->ParseProcPIDStat(pid, system::Config::GetInstance().PageSizeBytes(),
-                                       system::Config::GetInstance().KernelTickTimeNS(), &stats);
-    if (!s1.ok()) {
-      VLOG(1) << absl::Substitute(
-          "Failed to fetch cpu stat info for PID ($0). Error=\"$1\" skipping.", pid, s1.msg());
-      continue;
-    }
-
-    auto s2 = proc_parser_->ParseProcPIDStatIO(pid, &stats);
-    if (!s2.ok()) {
-      VLOG(1) << absl::Substitute(
-          "Failed to fetch IO stat info for PID ($0). Error=\"$1\" skipping.", pid, s2.msg());
+    auto s = proc_scanner_->Scan(pid, page_size_bytes, kernel_tick_time_ns, &stats);
+    if (!s.ok()) {
+      VLOG(1) << absl::Substitute("Failed to fetch stat info for PID ($0). Error=\"$1\" skipping.",
+                                  pid, s.msg());
       continue;
     }
 
@@ -92,6 +87,9 @@ void ProcessStatsConnector::TransferProcessStatsTable(ConnectorContext* ctx,
     r.Append<r.ColIndex("read_bytes")>(stats.read_bytes);
     r.Append<r.ColIndex("write_bytes")>(stats.write_bytes);
   }
+
+  // Drops the cached fds of pids that disappeared since the last cycle.
+  proc_scanner_->EndCycle();
 }
 
 void ProcessStatsConnector::TransferDataImpl(ConnectorContext* ctx,
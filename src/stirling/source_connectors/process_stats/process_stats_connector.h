@@ -58,13 +58,13 @@ class ProcessStatsConnector : public SourceConnector {
  protected:
   explicit ProcessStatsConnector(std::string_view source_name)
       : SourceConnector(source_name, kTables) {
-    proc_parser_ = std::make_unique<system::ProcParser>(sysconfig_);
+    proc_scanner_ = std::make_unique<system::ProcessStatsScanner>(sysconfig_);
   }
 
  private:
   void TransferProcessStatsTable(ConnectorContext* ctx, DataTable* data_table);
 
-  std::unique_ptr<system::ProcParser> proc_parser_;
+  std::unique_ptr<system::ProcessStatsScanner> proc_scanner_;
 };
 
 }  // namespace stirling
@@ -18,6 +18,20 @@
 
 #include "src/stirling/source_connectors/seq_gen/seq_gen_connector.h"
 
+#include <string>
+
+DEFINE_uint32(stirling_seq_gen_load_rows_per_cycle, 0,
+              "Number of rows the seq_gen load table emits per sampling cycle. "
+              "0 (the default) disables the load table.");
+DEFINE_uint32(stirling_seq_gen_load_string_bytes, 64,
+              "Width of the seq_gen load table's string payload column, in bytes. "
+              "Set to 0 for a numeric-heavy row shape.");
+DEFINE_uint32(stirling_seq_gen_load_burst_period_cycles, 0,
+              "If non-zero, every Nth cycle the seq_gen load table emits a burst of "
+              "burst_multiplier times the configured row count.");
+DEFINE_uint32(stirling_seq_gen_load_burst_multiplier, 10,
+              "Row count multiplier applied on burst cycles of the seq_gen load table.");
+
 namespace px {
 namespace stirling {
 
@@ -29,7 +43,9 @@ Status SeqGenConnector::InitImpl() {
 
 void SeqGenConnector::TransferDataImpl(ConnectorContext* /* ctx */,
                                        const std::vector<DataTable*>& data_tables) {
-  DCHECK_EQ(data_tables.size(), 2);
+  DCHECK_EQ(data_tables.size(), 3);
+
+  ++cycle_;
 
   std::uniform_int_distribution<uint32_t> num_rows_dist(num_rows_min_, num_rows_max_);
 
@@ -42,6 +58,22 @@ void SeqGenConnector::TransferDataImpl(ConnectorContext* /* ctx */,
     uint32_t num_records = num_rows_dist(rng_);
     TransferDataTable1(num_records, data_tables[kSeq1TableNum]);
   }
+
+  if (data_tables[kLoadTableNum] != nullptr) {
+    uint32_t num_records = LoadRowsThisCycle();
+    if (num_records > 0) {
+      TransferDataLoadTable(num_records, data_tables[kLoadTableNum]);
+    }
+  }
+}
+
+uint32_t SeqGenConnector::LoadRowsThisCycle() {
+  uint32_t num_rows = FLAGS_stirling_seq_gen_load_rows_per_cycle;
+  const uint32_t burst_period = FLAGS_stirling_seq_gen_load_burst_period_cycles;
+  if (burst_period != 0 && cycle_ % burst_period == 0) {
+    num_rows *= FLAGS_stirling_seq_gen_load_burst_multiplier;
+  }
+  return num_rows;
 }
 
 void SeqGenConnector::TransferDataTable0(uint32_t num_records, DataTable* data_table) {
@@ -71,5 +103,24 @@ void SeqGenConnector::TransferDataTable1(uint32_t num_records, DataTable* data_t
   }
 }
 
+void SeqGenConnector::TransferDataLoadTable(uint32_t num_records, DataTable* data_table) {
+  const uint32_t payload_bytes = FLAGS_stirling_seq_gen_load_string_bytes;
+
+  for (uint32_t irecord = 0; irecord < num_records; ++irecord) {
+    int64_t x = load_lin_seq_();
+
+    DataTable::RecordBuilder<&kLoadTable> r(data_table);
+    r.Append<r.ColIndex("time_")>(load_time_seq_());
+    r.Append<r.ColIndex("x")>(x);
+    // Deterministic filler, so the payload stays checkable while exercising string columns at the
+    // configured width.
+    r.Append<r.ColIndex("payload")>(std::string(payload_bytes, static_cast<char>('a' + (x % 26))));
+    r.Append<r.ColIndex("xmod10")>(load_mod10_seq_());
+    r.Append<r.ColIndex("xsquared")>(load_square_seq_());
+    r.Append<r.ColIndex("fibonnaci")>(load_fib_seq_());
+    r.Append<r.ColIndex("PIx")>(load_pi_seq_());
+  }
+}
+
 }  // namespace stirling
 }  // namespace px
@@ -99,9 +99,56 @@ class SeqGenConnector : public SourceConnector {
       "sequence_generator1", "A tabletized table of predictable sequences for testing purposes",
       kElementsSeq1, kSeq1TabletizationKey);
 
-  static constexpr auto kTables = MakeArray(kSeq0Table, kSeq1Table);
+  // clang-format off
+  static constexpr DataElement kElementsLoad[] = {
+      {"time_",
+       "Timestamp when the data record was collected.",
+       types::DataType::TIME64NS,
+       types::SemanticType::ST_NONE,
+       types::PatternType::METRIC_COUNTER},
+      {"x",
+       "A sequence number.",
+       types::DataType::INT64,
+       types::SemanticType::ST_NONE,
+       types::PatternType::GENERAL},
+      {"payload",
+       "A string payload whose width is set by --stirling_seq_gen_load_string_bytes.",
+       types::DataType::STRING,
+       types::SemanticType::ST_NONE,
+       types::PatternType::GENERAL},
+      {"xmod10",
+       "The value of x % 10.",
+       types::DataType::INT64,
+       types::SemanticType::ST_NONE,
+       types::PatternType::GENERAL_ENUM},
+      {"xsquared",
+       "The value of x^2.",
+       types::DataType::INT64,
+       types::SemanticType::ST_NONE,
+       types::PatternType::GENERAL},
+      {"fibonnaci", "Fibonnaci number",
+       types::DataType::INT64,
+       types::SemanticType::ST_NONE,
+       types::PatternType::GENERAL},
+      {"PIx", "PI * x",
+       types::DataType::FLOAT64,
+       types::SemanticType::ST_NONE,
+       types::PatternType::GENERAL},
+  };
+  // clang-format on
+  // Load-generation table: emits nothing unless --stirling_seq_gen_load_rows_per_cycle is set.
+  // Used to soak-test DataTable, table ingestion, and push cycles at configurable rates before
+  // rollouts, without deploying probes. The row rate, string width, and burst pattern are
+  // controlled by the stirling_seq_gen_load_* flags (see seq_gen_connector.cc).
+  static constexpr auto kLoadTable =
+      DataTableSchema("sequence_generator_load",
+                      "A configurable-rate load generation table for stress testing the data path",
+                      kElementsLoad);
+
+  static constexpr auto kTables = MakeArray(kSeq0Table, kSeq1Table, kLoadTable);
   static constexpr uint32_t kSeq0TableNum = SourceConnector::TableNum(kTables, kSeq0Table);
   static constexpr uint32_t kSeq1TableNum = SourceConnector::TableNum(kTables, kSeq1Table);
+  static constexpr uint32_t kLoadTableNum = SourceConnector::TableNum(kTables, kLoadTable);
 
   static std::unique_ptr<SourceConnector> Create(std::string_view name) {
     return std::unique_ptr<SourceConnector>(new SeqGenConnector(name));
@@ -125,6 +172,10 @@ class SeqGenConnector : public SourceConnector {
         table0_pi_seq_(3.14159, 0),
         table1_lin_seq_(2, 2),
         table1_mod8_seq_(8),
+        load_lin_seq_(1, 0),
+        load_mod10_seq_(10),
+        load_square_seq_(1, 0, 0),
+        load_pi_seq_(3.14159, 0),
         rng_(37) {}
   ~SeqGenConnector() override = default;
 
@@ -137,6 +188,10 @@ class SeqGenConnector : public SourceConnector {
  private:
   void TransferDataTable0(uint32_t num_records, DataTable* data_table);
   void TransferDataTable1(uint32_t num_records, DataTable* data_table);
+  void TransferDataLoadTable(uint32_t num_records, DataTable* data_table);
+
+  // Returns the number of load-table rows to emit this cycle, applying the burst pattern.
+  uint32_t LoadRowsThisCycle();
 
   TimeSequence<int64_t> table0_time_seq_;
   LinearSequence<int64_t> table0_lin_seq_;
@@ -149,9 +204,19 @@ class SeqGenConnector : public SourceConnector {
   LinearSequence<int64_t> table1_lin_seq_;
   ModuloSequence<int64_t> table1_mod8_seq_;
 
+  TimeSequence<int64_t> load_time_seq_;
+  LinearSequence<int64_t> load_lin_seq_;
+  ModuloSequence<int64_t> load_mod10_seq_;
+  QuadraticSequence<int64_t> load_square_seq_;
+  LinearSequence<double> load_pi_seq_;
+  FibonacciSequence<int64_t> load_fib_seq_;
+
   std::default_random_engine rng_;
   uint32_t num_rows_min_ = 0;
   uint32_t num_rows_max_ = 10;
+
+  // Number of TransferDataImpl() calls so far; drives the load table's burst pattern.
+  uint64_t cycle_ = 0;
 };
 
 }  // namespace stirling
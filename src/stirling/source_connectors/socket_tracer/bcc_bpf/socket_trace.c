@@ -44,6 +44,43 @@ const int32_t kInvalidFD = -1;
 // is reported to user-space. It applies to read and write traffic combined.
 const int kConnStatsDataThreshold = 65536;
 
+#ifdef USE_RINGBUF
+
+// Ring buffer transport (kernels 5.8+): a single buffer shared across all CPUs per output.
+// Page counts are injected as defines by the user-space loader, based on the same bandwidth
+// flags that size the perf buffers.
+BPF_RINGBUF_OUTPUT(socket_data_events, DATA_EVENTS_RINGBUF_PAGES);
+BPF_RINGBUF_OUTPUT(socket_control_events, CONTROL_EVENTS_RINGBUF_PAGES);
+BPF_RINGBUF_OUTPUT(conn_stats_events, CONTROL_EVENTS_RINGBUF_PAGES);
+
+// This output is used to export notification of processes that have performed an mmap.
+BPF_RINGBUF_OUTPUT(mmap_events, CONTROL_EVENTS_RINGBUF_PAGES);
+
+// Ring buffers have no lost-sample callback, so failed submissions are counted here
+// and periodically read back by user-space. Indexed by enum ringbuf_output_t.
+BPF_PERCPU_ARRAY(ringbuf_drop_counters, uint64_t, kNumRingBufOutputs);
+
+// These wrappers hide the transport from the submission sites below. The ctx argument is
+// unused by ringbuf_output, but is kept so call sites are identical for both transports.
+#define submit_socket_data_event(ctx, event, size)                 \
+  if (socket_data_events.ringbuf_output(event, size, 0) != 0) {    \
+    ringbuf_drop_counters.increment(kRingBufOutputSocketData);     \
+  }
+#define submit_socket_control_event(ctx, event, size)              \
+  if (socket_control_events.ringbuf_output(event, size, 0) != 0) { \
+    ringbuf_drop_counters.increment(kRingBufOutputSocketControl);  \
+  }
+#define submit_conn_stats_event(ctx, event, size)                  \
+  if (conn_stats_events.ringbuf_output(event, size, 0) != 0) {     \
+    ringbuf_drop_counters.increment(kRingBufOutputConnStats);      \
+  }
+#define submit_mmap_event(ctx, event, size)                        \
+  if (mmap_events.ringbuf_output(event, size, 0) != 0) {           \
+    ringbuf_drop_counters.increment(kRingBufOutputMMap);           \
+  }
+
+#else
+
 // This is the perf buffer for BPF program to export data from kernel to user space.
 BPF_PERF_OUTPUT(socket_data_events);
 BPF_PERF_OUTPUT(socket_control_events);
@@ -52,16 +89,32 @@ BPF_PERF_OUTPUT(conn_stats_events);
 // This output is used to export notification of processes that have performed an mmap.
 BPF_PERF_OUTPUT(mmap_events);
 
+#define submit_socket_data_event(ctx, event, size) \
+  socket_data_events.perf_submit(ctx, event, size)
+#define submit_socket_control_event(ctx, event, size) \
+  socket_control_events.perf_submit(ctx, event, size)
+#define submit_conn_stats_event(ctx, event, size) conn_stats_events.perf_submit(ctx, event, size)
+#define submit_mmap_event(ctx, event, size) mmap_events.perf_submit(ctx, event, size)
+
+#endif
+
 // This control_map is a bit-mask that controls which endpoints are traced in a connection.
 // The bits are defined in endpoint_role_t enum, kRoleClient or kRoleServer. kRoleUnknown is not
 // really used, but is defined for completeness.
 // There is a control map element for each protocol.
 BPF_PERCPU_ARRAY(control_map, uint64_t, kNumProtocols);
 
+// Number of entries in conn_info_map.
+// The default is overridden at BPF compile time by user-space, which sizes the map based on
+// core count and expected connection volume (see --stirling_conn_map_entries).
+#ifndef CONN_MAP_SIZE
+#define CONN_MAP_SIZE 131072
+#endif
+
 // Map from user-space file descriptors to the connections obtained from accept() syscall.
 // Tracks connection from accept() -> close().
 // Key is {tgid, fd}.
-BPF_HASH(conn_info_map, uint64_t, struct conn_info_t, 131072);
+BPF_HASH(conn_info_map, uint64_t, struct conn_info_t, CONN_MAP_SIZE);
 
 // Map to indicate which connections (TGID+FD), user-space has disabled.
 // This is tracked separately from conn_info_map to avoid any read-write races.
@@ -71,6 +124,20 @@ BPF_HASH(conn_info_map, uint64_t, struct conn_info_t, 131072);
 // Key is {tgid, fd}; Value is TSID.
 BPF_HASH(conn_disabled_map, uint64_t, uint64_t);
 
+// Map of connections (TGID+FD) that user-space has switched to sampled data capture,
+// because they are high-volume. For these connections, only every Nth data event carries its
+// payload; the rest are submitted header-only. Entries are written from user-space;
+// the event counter is updated from BPF.
+// Key is {tgid, fd}.
+BPF_HASH(conn_sampling_map, uint64_t, struct conn_sampling_t);
+
+// Map of (tgid, remote port, protocol) endpoint deny rules installed by user-space when it
+// disables a connection. Unlike conn_disabled_map, a rule also suppresses data events of future
+// connections matching the same key (e.g. recurring health-check connections), so they cost no
+// perf-buffer bandwidth. Only written from user-space, and only read from BPF.
+// Key is struct endpoint_deny_key_t; the value is unused.
+BPF_HASH(endpoint_deny_map, struct endpoint_deny_key_t, uint64_t);
+
 // Map from thread to its ongoing accept() syscall's input argument.
 // Tracks accept() call from entry -> exit.
 // Key is {tgid, pid}.
@@ -351,7 +418,7 @@ static __inline void submit_new_conn(struct pt_regs* ctx, uint32_t tgid, int32_t
   control_event.open.addr = conn_info.addr;
   control_event.open.role = conn_info.role;
 
-  socket_control_events.perf_submit(ctx, &control_event, sizeof(struct socket_control_event_t));
+  submit_socket_control_event(ctx, &control_event, sizeof(struct socket_control_event_t));
 }
 
 static __inline void submit_close_event(struct pt_regs* ctx, struct conn_info_t* conn_info,
@@ -364,7 +431,7 @@ static __inline void submit_close_event(struct pt_regs* ctx, struct conn_info_t*
   control_event.close.rd_bytes = conn_info->rd_bytes;
   control_event.close.wr_bytes = conn_info->wr_bytes;
 
-  socket_control_events.perf_submit(ctx, &control_event, sizeof(struct socket_control_event_t));
+  submit_socket_control_event(ctx, &control_event, sizeof(struct socket_control_event_t));
 }
 
 // Writes the input buf to event, and submits the event to the corresponding perf buffer.
@@ -437,7 +504,7 @@ static __inline void perf_submit_buf(struct pt_regs* ctx, const enum traffic_dir
   // If-statement is redundant, but is required to keep the 4.14 verifier happy.
   if (amount_copied > 0) {
     event->attr.msg_buf_size = amount_copied;
-    socket_data_events.perf_submit(ctx, event, sizeof(event->attr) + amount_copied);
+    submit_socket_data_event(ctx, event, sizeof(event->attr) + amount_copied);
   }
 }
 
@@ -524,6 +591,11 @@ int conn_cleanup_uprobe(struct pt_regs* ctx) {
     if (tsid != NULL && *tsid == conn_id.tsid) {
       conn_disabled_map.delete(&tgid_fd);
     }
+
+    struct conn_sampling_t* sampling = conn_sampling_map.lookup(&tgid_fd);
+    if (sampling != NULL && sampling->tsid == conn_id.tsid) {
+      conn_sampling_map.delete(&tgid_fd);
+    }
   }
 
   return 0;
@@ -637,6 +709,23 @@ static __inline void process_implicit_conn(struct pt_regs* ctx, uint64_t id,
   submit_new_conn(ctx, tgid, args->fd, args->addr, /*socket*/ NULL, kRoleUnknown, source_fn);
 }
 
+// Returns true if user-space has installed an endpoint deny rule covering this connection's
+// process, remote port and protocol. See endpoint_deny_map.
+static __inline bool is_conn_denied(uint32_t tgid, const struct conn_info_t* conn_info) {
+  struct endpoint_deny_key_t key = {};
+  key.tgid = tgid;
+  key.protocol = conn_info->protocol;
+  if (conn_info->addr.sa.sa_family == AF_INET) {
+    key.port = conn_info->addr.in4.sin_port;
+  } else if (conn_info->addr.sa.sa_family == AF_INET6) {
+    key.port = conn_info->addr.in6.sin6_port;
+  } else {
+    // User-space only installs rules for connections with a known remote port.
+    return false;
+  }
+  return endpoint_deny_map.lookup(&key) != NULL;
+}
+
 static __inline bool should_send_data(uint32_t tgid, uint64_t conn_disabled_tsid,
                                       bool force_trace_tgid, struct conn_info_t* conn_info) {
   // Never trace stirling.
@@ -649,6 +738,11 @@ static __inline bool should_send_data(uint32_t tgid, uint64_t conn_disabled_tsid
     return false;
   }
 
+  // Never trace connections matching a user-space installed endpoint deny rule.
+  if (is_conn_denied(tgid, conn_info)) {
+    return false;
+  }
+
   // Only trace data for protocols of interest, or if forced on.
   return (force_trace_tgid || should_trace_protocol_data(conn_info));
 }
@@ -673,7 +767,7 @@ static __inline void update_conn_stats(struct pt_regs* ctx, struct conn_info_t*
   if (meets_activity_threshold) {
     struct conn_stats_event_t* event = fill_conn_stats_event(conn_info);
     if (event != NULL) {
-      conn_stats_events.perf_submit(ctx, event, sizeof(struct conn_stats_event_t));
+      submit_conn_stats_event(ctx, event, sizeof(struct conn_stats_event_t));
     }
 
     conn_info->last_reported_bytes = conn_info->rd_bytes + conn_info->wr_bytes;
@@ -746,6 +840,15 @@ static __inline void process_data(const bool vecs, struct pt_regs* ctx, uint64_t
     }
 
     if (should_send_data(tgid, conn_disabled_tsid, force_trace_tgid, conn_info)) {
+      // If user-space has switched this connection to sampled capture, only every Nth data
+      // event carries its payload.
+      bool submit_payload = true;
+      struct conn_sampling_t* sampling = conn_sampling_map.lookup(&tgid_fd);
+      if (sampling != NULL && sampling->tsid == conn_info->conn_id.tsid && sampling->period > 0) {
+        sampling->counter += 1;
+        submit_payload = (sampling->counter % sampling->period) == 0;
+      }
+
       struct socket_data_event_t* event =
           fill_socket_data_event(args->source_fn, direction, conn_info);
       if (event == NULL) {
@@ -753,8 +856,15 @@ static __inline void process_data(const bool vecs, struct pt_regs* ctx, uint64_t
         return;
       }
 
-      // TODO(yzhao): Same TODO for split the interface.
-      if (!vecs) {
+      if (!submit_payload) {
+        // Header-only capture: submit the attributes without the message buffer, mirroring the
+        // sendfile path. User-space generates a filler event, which keeps stream positions
+        // consistent for the sampled events that do carry payloads.
+        event->attr.msg_size = bytes_count;
+        event->attr.msg_buf_size = 0;
+        submit_socket_data_event(ctx, event, sizeof(event->attr));
+      } else if (!vecs) {
+        // TODO(yzhao): Same TODO for split the interface.
         perf_submit_wrapper(ctx, direction, args->buf, bytes_count, conn_info, event);
       } else {
         // TODO(yzhao): iov[0] is copied twice, once in calling update_traffic_class(), and here.
@@ -843,7 +953,7 @@ static __inline void process_syscall_sendfile(struct pt_regs* ctx, uint64_t id,
     event->attr.pos = conn_info->wr_bytes;
     event->attr.msg_size = bytes_count;
     event->attr.msg_buf_size = 0;
-    socket_data_events.perf_submit(ctx, event, sizeof(event->attr));
+    submit_socket_data_event(ctx, event, sizeof(event->attr));
   }
 
   update_conn_stats(ctx, conn_info, kEgress, bytes_count);
@@ -885,7 +995,7 @@ static __inline void process_syscall_close(struct pt_regs* ctx, uint64_t id,
     struct conn_stats_event_t* event = fill_conn_stats_event(conn_info);
     if (event != NULL) {
       event->conn_events = event->conn_events | CONN_CLOSE;
-      conn_stats_events.perf_submit(ctx, event, sizeof(struct conn_stats_event_t));
+      submit_conn_stats_event(ctx, event, sizeof(struct conn_stats_event_t));
     }
   }
 
@@ -1522,7 +1632,7 @@ int syscall__probe_entry_mmap(struct pt_regs* ctx) {
   upid.tgid = id >> 32;
   upid.start_time_ticks = get_tgid_start_time();
 
-  mmap_events.perf_submit(ctx, &upid, sizeof(upid));
+  submit_mmap_event(ctx, &upid, sizeof(upid));
 
   return 0;
 }
@@ -252,6 +252,52 @@ struct socket_control_event_t {
   };
 };
 
+// Describes sampled data capture for a connection, requested by user-space for high-volume
+// connections. Stored in the conn_sampling_map BPF map, keyed by {tgid, fd}.
+// While an entry is active, only every `period`-th data event carries its payload; the others
+// are submitted header-only (attributes without the message buffer).
+struct conn_sampling_t {
+  // TSID of the connection generation this entry applies to, so a stale entry is not
+  // accidentally applied to a new connection that reuses the same {tgid, fd}.
+  uint64_t tsid;
+
+  // Submit the payload of every Nth data event. A value of 0 is equivalent to no sampling.
+  uint64_t period;
+
+  // Running count of data events on the connection, updated from BPF.
+  uint64_t counter;
+};
+
+// Key of the endpoint_deny_map BPF map: identifies a class of connections that user-space
+// has disabled. Unlike conn_disabled_map, which is scoped to a single connection generation,
+// a deny rule also covers future connections of the same process to the same remote port and
+// protocol (e.g. recurring health checks), so those submit no data events at all.
+// All fields are exact-match; there are no wildcards.
+struct endpoint_deny_key_t {
+  uint32_t tgid;
+
+  // The protocol of traffic on the connection (enum traffic_protocol_t).
+  uint32_t protocol;
+
+  // Remote port, in network byte order, to match the sockaddr stored in conn_info_t.
+  uint16_t port;
+
+  // Explicit padding, so the key has no uninitialized bytes when used for map lookups.
+  uint16_t pad;
+};
+
+// Indexes into the ringbuf_drop_counters BPF array, one per ring buffer output.
+// Only used when the socket tracer runs with ring buffer transport (USE_RINGBUF).
+// Unlike perf buffers, ring buffers have no built-in lost-sample callback,
+// so reservation failures are counted explicitly and read back from user-space.
+enum ringbuf_output_t {
+  kRingBufOutputSocketData = 0,
+  kRingBufOutputSocketControl = 1,
+  kRingBufOutputConnStats = 2,
+  kRingBufOutputMMap = 3,
+  kNumRingBufOutputs = 4,
+};
+
 struct connect_args_t {
   const struct sockaddr* addr;
   int32_t fd;
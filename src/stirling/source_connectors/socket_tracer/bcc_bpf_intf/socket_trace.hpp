@@ -24,7 +24,9 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include <absl/base/internal/spinlock.h>
 #include <absl/hash/hash.h>
 
 #include "src/common/base/base.h"
@@ -167,8 +169,55 @@ struct SocketDataEvent {
                             BytesToString<bytes_format::HexAsciiMix>(msg));
   }
 
+  // SocketDataEvent objects are created and destroyed for every perf-buffer submission, but
+  // are consumed synchronously (DataStream::AddData copies the payload into the stream buffer),
+  // so only a handful are ever live at once. Class-level new/delete route them through a small
+  // fixed-size freelist, making the ingestion path allocation-free at steady state and immune
+  // to malloc spikes during event bursts. Overflow beyond the freelist falls back to the heap.
+  static void* operator new(size_t size) {
+    DCHECK_EQ(size, sizeof(SocketDataEvent));
+    Pool& pool = EventPool();
+    {
+      absl::base_internal::SpinLockHolder lock(&pool.lock);
+      if (!pool.free_list.empty()) {
+        void* ptr = pool.free_list.back();
+        pool.free_list.pop_back();
+        return ptr;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  static void operator delete(void* ptr) {
+    Pool& pool = EventPool();
+    {
+      absl::base_internal::SpinLockHolder lock(&pool.lock);
+      if (pool.free_list.size() < kEventPoolCapacity) {
+        pool.free_list.push_back(ptr);
+        return;
+      }
+    }
+    ::operator delete(ptr);
+  }
+
   socket_data_event_t::attr_t attr;
   std::string_view msg;
+
+ private:
+  // At most 3 events are live per perf-buffer submission (data + header + filler), so this
+  // comfortably covers bursts while bounding the retained memory.
+  static constexpr size_t kEventPoolCapacity = 64;
+
+  struct Pool {
+    absl::base_internal::SpinLock lock;
+    std::vector<void*> free_list;
+  };
+
+  static Pool& EventPool() {
+    // Leaked intentionally: events may still be freed during static destruction.
+    static Pool* pool = new Pool();
+    return *pool;
+  }
 };
 
 }  // namespace stirling
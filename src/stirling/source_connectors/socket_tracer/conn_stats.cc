@@ -22,6 +22,11 @@
 
 #include "src/common/base/base.h"
 
+DEFINE_bool(stirling_conn_stats_export_changed_only, true,
+            "If true, conn_stats records are exported only when their counters or connection "
+            "attributes have changed since the last export. If false, records for all live "
+            "connections are exported on every push.");
+
 namespace px {
 namespace stirling {
 
@@ -68,6 +73,13 @@ absl::flat_hash_map<ConnStats::AggKey, ConnStats::Stats>& ConnStats::UpdateStats
     AggKey key = BuildAggKey(tracker->conn_id().upid, tracker->role(), tracker->remote_endpoint());
     auto& stats = agg_stats_[key];
 
+    // Mostly-idle connections produce no deltas, so their records need not be re-exported.
+    // Attribute changes (e.g. protocol inferred after some traffic) also warrant an export.
+    bool changed = conn_open != 0 || conn_close != 0 || bytes_recv != 0 || bytes_sent != 0 ||
+                   stats.addr_family != tracker->remote_endpoint().family ||
+                   stats.role != tracker->role() || stats.protocol != tracker->protocol() ||
+                   stats.ssl != tracker->ssl();
+
     stats.addr_family = tracker->remote_endpoint().family;
     stats.role = tracker->role();
     stats.protocol = tracker->protocol();
@@ -77,7 +89,9 @@ absl::flat_hash_map<ConnStats::AggKey, ConnStats::Stats>& ConnStats::UpdateStats
     stats.bytes_recv += bytes_recv;
     stats.bytes_sent += bytes_sent;
 
-    stats.last_update = update_counter_;
+    if (changed || !FLAGS_stirling_conn_stats_export_changed_only) {
+      stats.last_update = update_counter_;
+    }
   }
 
   return agg_stats_;
@@ -29,6 +29,8 @@
 #include "src/stirling/bpf_tools/bcc_bpf_intf/upid.h"
 #include "src/stirling/source_connectors/socket_tracer/conn_trackers_manager.h"
 
+DECLARE_bool(stirling_conn_stats_export_changed_only);
+
 namespace px {
 namespace stirling {
 
@@ -81,8 +83,10 @@ class ConnStats {
     // has closed.
     bool reported = false;
 
-    // Last time this stats object was updated.
+    // Last update in which this stats object changed (counters or connection attributes).
     // Used to indicate whether or not to skip exporting the current record.
+    // When --stirling_conn_stats_export_changed_only is false, this is refreshed for every
+    // live connection, whether or not anything changed.
     int last_update = 0;
 
     std::string ToString() const {
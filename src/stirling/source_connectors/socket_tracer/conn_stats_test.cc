@@ -338,6 +338,53 @@ TEST_F(ConnStatsTest, ClientSide) {
                                    Pair(AggKeyIs(11111, "1.1.1.1", 21), StatsIs(1, 0, 800, 400))));
 }
 
+// Tests that a mostly-idle connection is marked active only on pushes where its counters
+// actually changed, so unchanged records can be skipped on export.
+TEST_F(ConnStatsTest, IdleConnectionNotActive) {
+  FLAGS_stirling_conn_stats_export_changed_only = true;
+
+  constexpr struct conn_id_t kConnID0 = {
+      .upid = {.pid = 12345, .start_time_ticks = 1000},
+      .fd = 3,
+      .tsid = 111110,
+  };
+
+  struct conn_stats_event_t conn_stats_event;
+  conn_stats_event.timestamp_ns = 0;
+  conn_stats_event.conn_id = kConnID0;
+  conn_stats_event.role = kRoleClient;
+  conn_stats_event.addr.in4.sin_family = AF_INET;
+  conn_stats_event.addr.in4.sin_port = htons(80);
+  conn_stats_event.addr.in4.sin_addr.s_addr = 0x01010101;  // 1.1.1.1
+  conn_stats_event.conn_events = 0;
+  conn_stats_event.rd_bytes = 0;
+  conn_stats_event.wr_bytes = 0;
+
+  ConnTracker& tracker = conn_trackers_mgr_.GetOrCreateConnTracker(conn_stats_event.conn_id);
+
+  // Event: conn_open with some traffic.
+  conn_stats_event.timestamp_ns += 1;
+  conn_stats_event.conn_events |= CONN_OPEN;
+  conn_stats_event.wr_bytes += 3;
+  tracker.AddConnStats(conn_stats_event);
+
+  auto& agg_stats = conn_stats_.UpdateStats();
+  ASSERT_THAT(agg_stats, SizeIs(1));
+  EXPECT_TRUE(conn_stats_.Active(agg_stats.begin()->second));
+
+  // No new events: the connection is idle, so the record should not be considered active.
+  conn_stats_.UpdateStats();
+  EXPECT_FALSE(conn_stats_.Active(agg_stats.begin()->second));
+
+  // Some new traffic makes the record active again.
+  conn_stats_event.timestamp_ns += 1;
+  conn_stats_event.wr_bytes += 5;
+  tracker.AddConnStats(conn_stats_event);
+
+  conn_stats_.UpdateStats();
+  EXPECT_TRUE(conn_stats_.Active(agg_stats.begin()->second));
+}
+
 // Tests that any connection trackers with no remote endpoint do not report conn stats events.
 TEST_F(ConnStatsTest, NoEventsIfNoRemoteAddr) {
   constexpr struct conn_id_t kConnID0 = {
@@ -51,9 +51,26 @@ DEFINE_int64(stirling_conn_trace_fd, kUnsetPIDFD, "Trace activity on this fd.");
 DEFINE_bool(
     stirling_conn_disable_to_bpf, true,
     "Send information about connection tracking disablement to BPF, so it can stop sending data.");
+DEFINE_bool(stirling_endpoint_deny_to_bpf, true,
+            "When disabling a connection, also install a (pid, remote port, protocol) deny rule "
+            "in BPF, so future connections of the same process to the same endpoint (e.g. "
+            "recurring health checks) submit no data events at all.");
 DEFINE_int64(
     stirling_check_proc_for_conn_close, true,
     "If enabled, Stirling will check Linux /proc on idle connections to see if they are closed.");
+DEFINE_uint64(stirling_conn_sampling_threshold_bytes, 0,
+              "If non-zero, connections that transfer more than this many bytes between iterations "
+              "are adaptively switched to sampled data capture, where BPF submits only every Nth "
+              "data event with its payload (the rest header-only). A value of 0 disables adaptive "
+              "sampling.");
+DEFINE_uint64(stirling_conn_sampling_period, 10,
+              "When sampled data capture is engaged on a connection, submit the payload of every "
+              "Nth data event, as specified by this flag.");
+DEFINE_uint32(messages_unmatched_limit, 4096,
+              "The limit on the number of frames left unmatched by stitching, per direction of "
+              "each connection tracker. The oldest frames beyond the limit are evicted, "
+              "ring-buffer style, so a one-sided stream cannot grow without bound. "
+              "A value of 0 disables the cap.");
 DEFINE_int64(stirling_untracked_upid_threshold_seconds, 0,
              "If non-zero, Stirling will disable data tracking of processes that are outside the "
              "list of PIDs tracked by the context after the specified time period.");
@@ -74,6 +91,9 @@ constexpr double kStitchFailureRateThreshold = 0.5;
 ConnTracker::~ConnTracker() {
   CONN_TRACE(2) << "Being destroyed";
   if (conn_info_map_mgr_ != nullptr) {
+    if (sampling_active_) {
+      conn_info_map_mgr_->SetSamplingPeriod(conn_id_, 0);
+    }
     conn_info_map_mgr_->ReleaseResources(conn_id_);
   }
 }
@@ -133,6 +153,9 @@ void ConnTracker::AddConnCloseEvent(const socket_control_event_t& event) {
   send_data_.set_conn_closed();
   recv_data_.set_conn_closed();
 
+  // The FD is now free to be recycled, so any cached FD link for it is stale.
+  FDLinkCache::GetInstance().Invalidate(conn_id_.upid.pid, conn_id_.fd);
+
   CONN_TRACE(1) << absl::Substitute("conn_close: $0", ::ToString(event));
 
   MarkForDeath();
@@ -405,8 +428,19 @@ void ConnTracker::Reset() {
 
 void ConnTracker::Disable(std::string_view reason) {
   if (state_ != State::kDisabled) {
+    // A disabled connection submits no data events at all, so sampling is moot.
+    SetSamplingActive(false);
     if (conn_info_map_mgr_ != nullptr && FLAGS_stirling_conn_disable_to_bpf) {
       conn_info_map_mgr_->Disable(conn_id_);
+
+      // Also install an endpoint deny rule if the remote endpoint is known, so that future
+      // connections of this process to the same remote port and protocol are suppressed in
+      // BPF directly, rather than being re-disabled from user-space one connection at a time.
+      bool remote_port_known = open_info_.remote_addr.family == SockAddrFamily::kIPv4 ||
+                               open_info_.remote_addr.family == SockAddrFamily::kIPv6;
+      if (FLAGS_stirling_endpoint_deny_to_bpf && remote_port_known) {
+        conn_info_map_mgr_->DisableEndpoint(conn_id_, open_info_.remote_addr.port(), protocol());
+      }
     }
     CONN_TRACE(1) << absl::Substitute("Disabling connection dest=$0:$1 reason=$2",
                                       open_info_.remote_addr.AddrStr(),
@@ -601,6 +635,15 @@ void ConnTracker::MarkForDeath(int32_t countdown) {
   } else {
     death_countdown_ = countdown;
   }
+
+  MaybeEnqueueForDestruction();
+}
+
+void ConnTracker::MaybeEnqueueForDestruction() {
+  if (death_countdown_ == 0 && !on_death_row_ && manager_ != nullptr) {
+    on_death_row_ = true;
+    manager_->EnqueueForDestruction(this);
+  }
 }
 
 bool ConnTracker::IsZombie() const { return death_countdown_ >= 0; }
@@ -791,6 +834,7 @@ void ConnTracker::IterationPostTick() {
   if (death_countdown_ > 0) {
     --death_countdown_;
     CONN_TRACE(2) << absl::Substitute("Death countdown=$0", death_countdown_);
+    MaybeEnqueueForDestruction();
   }
 
   HandleInactivity();
@@ -823,6 +867,42 @@ void ConnTracker::IterationPostTick() {
     Disable(absl::Substitute("Connection does not appear to produce valid records of protocol $0",
                              magic_enum::enum_name(protocol())));
   }
+
+  UpdateDataSampling();
+}
+
+void ConnTracker::SetSamplingActive(bool active) {
+  if (active == sampling_active_) {
+    return;
+  }
+
+  sampling_active_ = active;
+  if (conn_info_map_mgr_ != nullptr) {
+    conn_info_map_mgr_->SetSamplingPeriod(conn_id_,
+                                          active ? FLAGS_stirling_conn_sampling_period : 0);
+  }
+  CONN_TRACE(1) << absl::Substitute("Sampled data capture $0 period=$1",
+                                    active ? "engaged" : "disengaged",
+                                    FLAGS_stirling_conn_sampling_period);
+}
+
+void ConnTracker::UpdateDataSampling() {
+  if (FLAGS_stirling_conn_sampling_threshold_bytes == 0 || state_ == State::kDisabled) {
+    return;
+  }
+
+  const int64_t total_bytes = conn_stats_.bytes_recv() + conn_stats_.bytes_sent();
+  const int64_t bytes_this_iteration = total_bytes - last_sampling_check_total_bytes_;
+  last_sampling_check_total_bytes_ = total_bytes;
+
+  const int64_t threshold = FLAGS_stirling_conn_sampling_threshold_bytes;
+  if (!sampling_active_ && bytes_this_iteration >= threshold) {
+    SetSamplingActive(true);
+  } else if (sampling_active_ && bytes_this_iteration < threshold / 2) {
+    // Disengage at half the engagement threshold, so a connection hovering around the
+    // threshold doesn't flap between modes.
+    SetSamplingActive(false);
+  }
 }
 
 void ConnTracker::CheckProcForConnClose() {
@@ -36,6 +36,7 @@
 #include "src/stirling/source_connectors/socket_tracer/bcc_bpf_intf/socket_trace.hpp"
 #include "src/stirling/source_connectors/socket_tracer/data_stream.h"
 #include "src/stirling/source_connectors/socket_tracer/fd_resolver.h"
+#include "src/stirling/source_connectors/socket_tracer/metrics.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/common/interface.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/http2/http2_streams_container.h"
 #include "src/stirling/source_connectors/socket_tracer/socket_trace_bpf_tables.h"
@@ -48,8 +49,12 @@ constexpr int64_t kUnsetPIDFD = -1;
 DECLARE_int64(stirling_conn_trace_pid);
 DECLARE_int64(stirling_conn_trace_fd);
 DECLARE_bool(stirling_conn_disable_to_bpf);
+DECLARE_bool(stirling_endpoint_deny_to_bpf);
 DECLARE_int64(stirling_check_proc_for_conn_close);
 DECLARE_int64(stirling_untracked_upid_threshold_seconds);
+DECLARE_uint64(stirling_conn_sampling_threshold_bytes);
+DECLARE_uint64(stirling_conn_sampling_period);
+DECLARE_uint32(messages_unmatched_limit);
 
 #define CONN_TRACE(level) LOG_IF(INFO, level <= debug_trace_level_) << ToString() << " "
 
@@ -103,6 +108,10 @@ class ConnTracker : NotCopyMoveable {
     // The number of valid/invalid records.
     kValidRecords,
     kInvalidRecords,
+
+    // The number of frames left unmatched by stitching that were evicted because of the
+    // --messages_unmatched_limit cap.
+    kUnmatchedFramesEvicted,
   };
 
   // State values change monotonically from lower to higher values.
@@ -271,10 +280,35 @@ class ConnTracker : NotCopyMoveable {
     CONN_TRACE(2) << absl::Substitute("req_frames=$0 resp_frames=$1", req_frames.size(),
                                       resp_frames.size());
 
+    // Stitching is deterministic on the buffered frames, so if no new frames have been parsed
+    // since the previous stitch, the leftover unmatched frames cannot produce new records.
+    // Skipping the re-walk keeps stitching cost proportional to new frames,
+    // not total buffered frames.
+    StitchCheckpoint checkpoint = MakeStitchCheckpoint<TFrameType>();
+    if (checkpoint == last_stitch_checkpoint_) {
+      return {};
+    }
+
+    const size_t num_frames_before_stitch = req_frames.size() + resp_frames.size();
+
     protocols::RecordsWithErrorCount<TRecordType> result =
         protocols::StitchFrames<TRecordType, TFrameType, TStateType>(&req_frames, &resp_frames,
                                                                      state_ptr);
 
+    // Stitchers erase the frames they consume, so the size delta is the number stitched.
+    auto& metrics = SocketTracerMetrics::GetProtocolMetrics(protocol_);
+    metrics.pipeline_frames_stitched.Increment(num_frames_before_stitch - req_frames.size() -
+                                               resp_frames.size());
+    metrics.pipeline_records_emitted.Increment(result.records.size());
+
+    // Enforce a hard cap on frames left unmatched by stitching, evicting the oldest first,
+    // so a one-sided stream cannot grow without bound between Cleanup() calls.
+    size_t num_evicted =
+        EnforceUnmatchedFrameCap(&req_frames) + EnforceUnmatchedFrameCap(&resp_frames);
+    stats_.Increment(StatKey::kUnmatchedFramesEvicted, num_evicted);
+
+    last_stitch_checkpoint_ = MakeStitchCheckpoint<TFrameType>();
+
     CONN_TRACE(2) << absl::Substitute("records=$0", result.records.size());
 
     UpdateResultStats(result);
@@ -398,6 +432,14 @@ class ConnTracker : NotCopyMoveable {
    */
   State state() const { return state_; }
 
+  /**
+   * Returns whether this connection is currently in sampled data capture mode,
+   * where BPF submits only every Nth data event with its payload (the rest header-only).
+   * High-volume connections are switched to this mode adaptively,
+   * controlled by --stirling_conn_sampling_threshold_bytes.
+   */
+  bool sampling_active() const { return sampling_active_; }
+
   /**
    * Check if all events have been received on this stream.
    * Implies that the Close() event has been received as well.
@@ -544,12 +586,14 @@ class ConnTracker : NotCopyMoveable {
 
     auto* state = protocol_state<TStateType>();
     if (send_data_.CleanupEvents(buffer_size_limit_bytes, buffer_expiry_timestamp)) {
+      SocketTracerMetrics::GetProtocolMetrics(protocol_).pipeline_buffer_evictions.Increment();
       if (state != nullptr) {
         state->global = {};
         state->send = {};
       }
     }
     if (recv_data_.CleanupEvents(buffer_size_limit_bytes, buffer_expiry_timestamp)) {
+      SocketTracerMetrics::GetProtocolMetrics(protocol_).pipeline_buffer_evictions.Increment();
       if (state != nullptr) {
         state->global = {};
         state->recv = {};
@@ -646,6 +690,11 @@ class ConnTracker : NotCopyMoveable {
   bool IsRemoteAddrInCluster(const std::vector<CIDRBlock>& cluster_cidrs);
   void UpdateState(const std::vector<CIDRBlock>& cluster_cidrs);
 
+  // Adaptively engages or disengages sampled data capture based on the connection's
+  // recent throughput, as observed through conn stats counters.
+  void UpdateDataSampling();
+  void SetSamplingActive(bool active);
+
   void UpdateDataStats(const SocketDataEvent& event);
 
   template <typename TFrameType, typename TStateType>
@@ -669,6 +718,47 @@ class ConnTracker : NotCopyMoveable {
     stats_.Increment(StatKey::kValidRecords, result.records.size());
   }
 
+  // Snapshot of the stitching inputs, used by ProcessToRecords() to detect that no new frames
+  // have been parsed since the previous stitch. The cumulative parse counts disambiguate the
+  // case where stitching consumed exactly as many frames as were newly parsed.
+  struct StitchCheckpoint {
+    size_t req_frames_size = 0;
+    size_t resp_frames_size = 0;
+    int req_frames_parsed = 0;
+    int resp_frames_parsed = 0;
+
+    bool operator==(const StitchCheckpoint& other) const {
+      return req_frames_size == other.req_frames_size &&
+             resp_frames_size == other.resp_frames_size &&
+             req_frames_parsed == other.req_frames_parsed &&
+             resp_frames_parsed == other.resp_frames_parsed;
+    }
+  };
+
+  template <typename TFrameType>
+  StitchCheckpoint MakeStitchCheckpoint() {
+    DataStream* req_data_ptr = req_data();
+    DataStream* resp_data_ptr = resp_data();
+    return StitchCheckpoint{
+        req_data_ptr->Frames<TFrameType>().size(), resp_data_ptr->Frames<TFrameType>().size(),
+        req_data_ptr->stat_valid_frames() + req_data_ptr->stat_invalid_frames(),
+        resp_data_ptr->stat_valid_frames() + resp_data_ptr->stat_invalid_frames()};
+  }
+
+  // Enforces --messages_unmatched_limit on frames left unmatched by stitching.
+  // The oldest frames are evicted first, ring-buffer style.
+  // Returns the number of frames evicted.
+  template <typename TFrameType>
+  size_t EnforceUnmatchedFrameCap(std::deque<TFrameType>* frames) {
+    const size_t limit = FLAGS_messages_unmatched_limit;
+    if (limit == 0 || frames->size() <= limit) {
+      return 0;
+    }
+    const size_t num_evicted = frames->size() - limit;
+    frames->erase(frames->begin(), frames->begin() + num_evicted);
+    return num_evicted;
+  }
+
   int debug_trace_level_ = 0;
 
   // Used to identify the remove endpoint in case the accept/connect was not traced.
@@ -734,6 +824,17 @@ class ConnTracker : NotCopyMoveable {
 
   std::string disable_reason_;
 
+  // Whether BPF-side sampled data capture is currently engaged for this connection.
+  bool sampling_active_ = false;
+
+  // Total conn stats bytes at the last sampling decision, used to compute per-iteration
+  // throughput. Tracked separately from the *SinceLastRead() counters, which belong to
+  // conn stats reporting.
+  int64_t last_sampling_check_total_bytes_ = 0;
+
+  // The stitching inputs at the end of the previous ProcessToRecords() call.
+  StitchCheckpoint last_stitch_checkpoint_;
+
   // Iterations before the tracker can be killed.
   int32_t death_countdown_ = -1;
 
@@ -758,9 +859,20 @@ class ConnTracker : NotCopyMoveable {
   template <typename TProtocolTraits>
   friend std::string DebugString(const ConnTracker& c, std::string_view prefix);
 
+  // Enqueues this tracker on the manager's death row the first time its death countdown reaches
+  // zero, so cleanup only has to visit dying trackers instead of sweeping the full population.
+  void MaybeEnqueueForDestruction();
+
   // A pointer to the conn trackers manager, used for notifying a protocol change.
   ConnTrackersManager* manager_ = nullptr;
 
+  // Whether this tracker has already been handed to the manager's death row.
+  bool on_death_row_ = false;
+
+  // This tracker's index within its manager shard, maintained by ConnTrackersManager so that
+  // removal is O(1) (swap with the shard's last element).
+  size_t shard_pos_ = 0;
+
   friend class ConnTrackersManager;
   // A subclass expose private member as public.
   friend class ConnTrackerTestDouble;
@@ -134,6 +134,26 @@ TEST_F(ConnTrackerTest, ReqRespMatchingSimple) {
   EXPECT_EQ(records[2].resp.body, "bar");
 }
 
+// Tests that frames left unmatched by stitching are capped, with the oldest evicted first.
+TEST_F(ConnTrackerTest, UnmatchedFrameCap) {
+  PL_SET_FOR_SCOPE(FLAGS_messages_unmatched_limit, 2);
+
+  ConnTracker tracker;
+  tracker.InitProtocolState<http::StateWrapper>();
+  tracker.AddControlEvent(event_gen_.InitConn());
+  // Requests with no responses: all three remain unmatched after stitching.
+  tracker.AddDataEvent(event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq0));
+  tracker.AddDataEvent(event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq1));
+  tracker.AddDataEvent(event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq2));
+
+  std::vector<http::Record> records = tracker.ProcessToRecords<http::ProtocolTraits>();
+
+  EXPECT_THAT(records, IsEmpty());
+  EXPECT_EQ(tracker.req_frames<http::Message>().size(), 2);
+  EXPECT_EQ(tracker.GetStat(ConnTracker::StatKey::kUnmatchedFramesEvicted), 1);
+  EXPECT_EQ(tracker.req_frames<http::Message>().front().req_path, "/foo.html");
+}
+
 TEST_F(ConnTrackerTest, ReqRespMatchingPipelinedIsNotSupported) {
   struct socket_control_event_t conn = event_gen_.InitConn();
   std::unique_ptr<SocketDataEvent> req0 = event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq0);
@@ -827,6 +847,61 @@ TEST_F(ConnTrackerTest, ConnStats) {
   }
 }
 
+// Tests that sampled data capture engages on high-volume connections and disengages
+// once the throughput subsides, with hysteresis in between.
+TEST_F(ConnTrackerTest, AdaptiveDataSampling) {
+  PL_SET_FOR_SCOPE(FLAGS_stirling_conn_sampling_threshold_bytes, 1000);
+
+  ConnTracker tracker;
+
+  constexpr struct conn_id_t kConnID0 = {
+      .upid = {.pid = 12345, .start_time_ticks = 1000},
+      .fd = 3,
+      .tsid = 111110,
+  };
+
+  struct conn_stats_event_t conn_stats_event;
+  conn_stats_event.timestamp_ns = 0;
+  conn_stats_event.conn_id = kConnID0;
+  conn_stats_event.role = kRoleClient;
+  reinterpret_cast<struct sockaddr_in*>(&conn_stats_event.addr)->sin_family = AF_INET;
+  reinterpret_cast<struct sockaddr_in*>(&conn_stats_event.addr)->sin_port = htons(80);
+  reinterpret_cast<struct sockaddr_in*>(&conn_stats_event.addr)->sin_addr.s_addr =
+      0x01010101;  // 1.1.1.1
+  conn_stats_event.conn_events = CONN_OPEN;
+  conn_stats_event.rd_bytes = 0;
+  conn_stats_event.wr_bytes = 0;
+
+  // Low-volume iteration: sampling stays off.
+  conn_stats_event.timestamp_ns += 1;
+  conn_stats_event.rd_bytes += 100;
+  tracker.AddConnStats(conn_stats_event);
+  tracker.IterationPostTick();
+  EXPECT_FALSE(tracker.sampling_active());
+
+  // High-volume iteration: sampling engages.
+  conn_stats_event.timestamp_ns += 1;
+  conn_stats_event.rd_bytes += 600;
+  conn_stats_event.wr_bytes += 600;
+  tracker.AddConnStats(conn_stats_event);
+  tracker.IterationPostTick();
+  EXPECT_TRUE(tracker.sampling_active());
+
+  // Above half the threshold: sampling stays engaged (hysteresis).
+  conn_stats_event.timestamp_ns += 1;
+  conn_stats_event.rd_bytes += 600;
+  tracker.AddConnStats(conn_stats_event);
+  tracker.IterationPostTick();
+  EXPECT_TRUE(tracker.sampling_active());
+
+  // Throughput drops below half the threshold: sampling disengages.
+  conn_stats_event.timestamp_ns += 1;
+  conn_stats_event.rd_bytes += 100;
+  tracker.AddConnStats(conn_stats_event);
+  tracker.IterationPostTick();
+  EXPECT_FALSE(tracker.sampling_active());
+}
+
 struct UpdateStateParam {
   traffic_protocol_t protocol;
   endpoint_role_t role;
@@ -18,9 +18,14 @@
 
 #include "src/stirling/source_connectors/socket_tracer/conn_trackers_manager.h"
 
-DEFINE_double(
-    stirling_conn_tracker_cleanup_threshold, 0.2,
-    "Percentage of trackers that are ready for destruction that will trigger a memory cleanup");
+#include <algorithm>
+#include <chrono>
+
+#include <absl/hash/hash.h>
+
+DEFINE_uint32(stirling_conn_tracker_cleanup_budget_us, 1000,
+              "Time budget for each tracker cleanup pass, in microseconds. Destruction candidates "
+              "not reached within the budget carry over to the next pass. 0 means unlimited.");
 
 namespace px {
 namespace stirling {
@@ -31,37 +36,41 @@ namespace stirling {
 
 std::pair<ConnTracker*, bool> ConnTrackerGenerations::GetOrCreate(conn_id_t conn_id,
                                                                   ConnTrackerPool* tracker_pool) {
-  std::unique_ptr<ConnTracker>& conn_tracker_ptr = generations_[conn_id.tsid];
-  bool created = false;
-
-  if (conn_tracker_ptr == nullptr) {
-    conn_tracker_ptr = tracker_pool->Pop();
-    created = true;
-    conn_tracker_ptr->SetConnID(conn_id);
-
-    // If there is a another generation for this conn map key,
-    // one of them needs to be marked for death.
-    if (oldest_generation_ != nullptr) {
-      // If the inserted conn_tracker is not the last generation, then mark it for death.
-      // This can happen because the events draining from the perf buffers are not ordered.
-      if (conn_id.tsid < oldest_generation_->conn_id().tsid) {
-        VLOG(1) << "Marking for death because not last generation.";
-        conn_tracker_ptr->MarkForDeath();
-      } else {
-        // New tracker was the last, so the previous last should be marked for death.
-        VLOG(1) << "Marking previous generation for death.";
-        oldest_generation_->MarkForDeath();
-        oldest_generation_ = conn_tracker_ptr.get();
-      }
+  auto iter = std::find_if(generations_.begin(), generations_.end(),
+                           [&conn_id](const auto& gen) { return gen.first == conn_id.tsid; });
+  if (iter != generations_.end()) {
+    return std::make_pair(iter->second.get(), /* created */ false);
+  }
+
+  generations_.emplace_back(conn_id.tsid, tracker_pool->Pop());
+  ConnTracker* conn_tracker_ptr = generations_.back().second.get();
+  conn_tracker_ptr->SetConnID(conn_id);
+
+  // If there is a another generation for this conn map key,
+  // one of them needs to be marked for death.
+  if (oldest_generation_ != nullptr) {
+    // If the inserted conn_tracker is not the last generation, then mark it for death.
+    // This can happen because the events draining from the perf buffers are not ordered.
+    if (conn_id.tsid < oldest_generation_->conn_id().tsid) {
+      VLOG(1) << "Marking for death because not last generation.";
+      conn_tracker_ptr->MarkForDeath();
     } else {
-      oldest_generation_ = conn_tracker_ptr.get();
+      // New tracker was the last, so the previous last should be marked for death.
+      VLOG(1) << "Marking previous generation for death.";
+      oldest_generation_->MarkForDeath();
+      oldest_generation_ = conn_tracker_ptr;
     }
+  } else {
+    oldest_generation_ = conn_tracker_ptr;
   }
 
-  return std::make_pair(conn_tracker_ptr.get(), created);
+  return std::make_pair(conn_tracker_ptr, /* created */ true);
 }
 
-bool ConnTrackerGenerations::Contains(uint64_t tsid) const { return generations_.contains(tsid); }
+bool ConnTrackerGenerations::Contains(uint64_t tsid) const {
+  return std::any_of(generations_.begin(), generations_.end(),
+                     [tsid](const auto& gen) { return gen.first == tsid; });
+}
 
 StatusOr<const ConnTracker*> ConnTrackerGenerations::GetActive() const {
   // Don't return trackers that are destroyed or about to be destroyed.
@@ -87,7 +96,7 @@ int ConnTrackerGenerations::CleanupGenerations(ConnTrackerPool* tracker_pool) {
 
       tracker_pool->Recycle(std::move(tracker));
 
-      generations_.erase(iter++);
+      iter = generations_.erase(iter);
       ++num_erased;
     } else {
       ++iter;
@@ -97,6 +106,22 @@ int ConnTrackerGenerations::CleanupGenerations(ConnTrackerPool* tracker_pool) {
   return num_erased;
 }
 
+bool ConnTrackerGenerations::Erase(ConnTracker* tracker, ConnTrackerPool* tracker_pool) {
+  auto iter = std::find_if(generations_.begin(), generations_.end(),
+                           [tracker](const auto& gen) { return gen.second.get() == tracker; });
+  if (iter == generations_.end()) {
+    return false;
+  }
+
+  if (tracker == oldest_generation_) {
+    oldest_generation_ = nullptr;
+  }
+
+  tracker_pool->Recycle(std::move(iter->second));
+  generations_.erase(iter);
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 // ConnTrackersManager
 //-----------------------------------------------------------------------------
@@ -107,6 +132,10 @@ constexpr size_t kMaxConnTrackerPoolSize = 2048;
 
 uint64_t GetConnMapKey(uint32_t pid, int32_t fd) { return (static_cast<uint64_t>(pid) << 32) | fd; }
 
+size_t TrackerShardIdx(uint64_t conn_map_key) {
+  return absl::Hash<uint64_t>()(conn_map_key) % ConnTrackersManager::kNumTrackerShards;
+}
+
 }  // namespace
 
 ConnTrackersManager::ConnTrackersManager() : trackers_pool_(kMaxConnTrackerPoolSize) {}
@@ -119,7 +148,9 @@ ConnTracker& ConnTrackersManager::GetOrCreateConnTracker(struct conn_id_t conn_i
   auto [conn_tracker_ptr, created] = conn_trackers.GetOrCreate(conn_id, &trackers_pool_);
 
   if (created) {
-    active_trackers_.push_back(conn_tracker_ptr);
+    auto& shard = tracker_shards_[TrackerShardIdx(conn_map_key)];
+    conn_tracker_ptr->shard_pos_ = shard.size();
+    shard.push_back(conn_tracker_ptr);
     conn_tracker_ptr->manager_ = this;
 
     stats_.Increment(StatKey::kTotal);
@@ -150,53 +181,87 @@ StatusOr<const ConnTracker*> ConnTrackersManager::GetConnTracker(uint32_t pid, i
   return tracker_generations.GetActive();
 }
 
+void ConnTrackersManager::EnqueueForDestruction(ConnTracker* tracker) {
+  death_row_.push_back(tracker);
+  stats_.Increment(StatKey::kReadyForDestruction);
+}
+
 void ConnTrackersManager::CleanupTrackers() {
-  {
-    auto iter = active_trackers_.begin();
-    while (iter != active_trackers_.end()) {
-      const auto& tracker = *iter;
-      if (tracker->ReadyForDestruction()) {
-        active_trackers_.erase(iter++);
-        stats_.Increment(StatKey::kReadyForDestruction);
-      } else {
-        ++iter;
-      }
-    }
+  // Only destruction candidates are visited; stable trackers cost nothing here.
+  // A time budget bounds the latency impact on the TransferData cycle when many connections die
+  // at once; candidates beyond the budget carry over to the next call.
+  std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+  if (FLAGS_stirling_conn_tracker_cleanup_budget_us > 0) {
+    deadline = std::chrono::steady_clock::now() +
+               std::chrono::microseconds(FLAGS_stirling_conn_tracker_cleanup_budget_us);
   }
+  // How often to check the clock, to keep the clock_gettime cost amortized.
+  constexpr size_t kDeadlineCheckInterval = 64;
 
-  // As a performance optimization, we only clean up trackers once we reach a certain threshold
-  // of trackers that are ready for destruction.
-  // Trade-off is just how quickly we release memory and BPF map entries.
-  double percent_destroyable =
-      1.0 * stats_.Get(StatKey::kReadyForDestruction) / stats_.Get(StatKey::kTotal);
-  if (percent_destroyable > FLAGS_stirling_conn_tracker_cleanup_threshold) {
-    // Outer loop iterates through tracker sets (keyed by PID+FD),
-    // while inner loop iterates through generations of trackers for that PID+FD pair.
-    auto iter = conn_id_tracker_generations_.begin();
-    while (iter != conn_id_tracker_generations_.end()) {
-      auto& tracker_generations = iter->second;
-
-      int num_erased = tracker_generations.CleanupGenerations(&trackers_pool_);
-
-      stats_.Decrement(StatKey::kTotal, num_erased);
-      stats_.Decrement(StatKey::kReadyForDestruction, num_erased);
-      stats_.Increment(StatKey::kDestroyed, num_erased);
-
-      if (tracker_generations.empty()) {
-        conn_id_tracker_generations_.erase(iter++);
-        stats_.Increment(StatKey::kDestroyedGens);
-      } else {
-        ++iter;
-      }
+  std::vector<ConnTracker*> candidates;
+  candidates.swap(death_row_);
+
+  size_t i = 0;
+  for (; i < candidates.size(); ++i) {
+    if (i % kDeadlineCheckInterval == 0 && i != 0 &&
+        std::chrono::steady_clock::now() >= deadline) {
+      break;
+    }
+
+    ConnTracker* tracker = candidates[i];
+    if (!tracker->ReadyForDestruction()) {
+      // Death countdown has expired, but the final conn stats have not been reported yet.
+      // Keep it on the death row, and re-examine next cycle.
+      death_row_.push_back(tracker);
+      continue;
     }
+
+    DestroyTracker(tracker);
   }
 
+  // Carry over the candidates that didn't fit in the time budget.
+  death_row_.insert(death_row_.end(), candidates.begin() + i, candidates.end());
+
   DebugChecks();
 }
 
+void ConnTrackersManager::DestroyTracker(ConnTracker* tracker) {
+  const struct conn_id_t conn_id = tracker->conn_id();
+  const uint64_t conn_map_key = GetConnMapKey(conn_id.upid.pid, conn_id.fd);
+
+  // O(1) removal from the shard: swap with the last tracker, which inherits the position.
+  auto& shard = tracker_shards_[TrackerShardIdx(conn_map_key)];
+  const size_t pos = tracker->shard_pos_;
+  DCHECK_LT(pos, shard.size());
+  DCHECK_EQ(shard[pos], tracker);
+  shard[pos] = shard.back();
+  shard[pos]->shard_pos_ = pos;
+  shard.pop_back();
+
+  // Targeted erase from the generations for this PID+FD; this recycles the tracker, so it must
+  // not be touched afterwards.
+  auto iter = conn_id_tracker_generations_.find(conn_map_key);
+  DCHECK(iter != conn_id_tracker_generations_.end());
+  bool erased = iter->second.Erase(tracker, &trackers_pool_);
+  DCHECK(erased);
+
+  stats_.Decrement(StatKey::kTotal);
+  stats_.Decrement(StatKey::kReadyForDestruction);
+  stats_.Increment(StatKey::kDestroyed);
+
+  if (iter->second.empty()) {
+    conn_id_tracker_generations_.erase(iter);
+    stats_.Increment(StatKey::kDestroyedGens);
+  }
+}
+
 void ConnTrackersManager::DebugChecks() const {
-  DCHECK_EQ(stats_.Get(StatKey::kTotal),
-            active_trackers_.size() + stats_.Get(StatKey::kReadyForDestruction));
+  size_t num_active_trackers = 0;
+  for (const auto& shard : tracker_shards_) {
+    num_active_trackers += shard.size();
+  }
+  // Trackers stay in their shard until destroyed, including while on the death row.
+  DCHECK_EQ(stats_.Get(StatKey::kTotal), num_active_trackers);
 }
 
 std::string ConnTrackersManager::DebugInfo() const {
@@ -205,7 +270,7 @@ std::string ConnTrackersManager::DebugInfo() const {
   absl::StrAppend(&out, "ConnTracker count statistics: ", StatsString(),
                   "\nDetailed statistics of individual ConnTracker:\n");
 
-  for (const auto& tracker : active_trackers_) {
+  for (const auto& tracker : active_trackers()) {
     absl::StrAppend(&out, absl::Substitute("  conn_tracker=$0 zombie=$1 ready_for_destruction=$2\n",
                                            tracker->ToString(), tracker->IsZombie(),
                                            tracker->ReadyForDestruction()));
@@ -220,7 +285,7 @@ std::string ConnTrackersManager::StatsString() const {
 
 void ConnTrackersManager::ComputeProtocolStats() {
   absl::flat_hash_map<traffic_protocol_t, int> protocol_count;
-  for (const auto* tracker : active_trackers_) {
+  for (const auto* tracker : active_trackers()) {
     ++protocol_count[tracker->protocol()];
   }
   for (auto protocol : magic_enum::enum_values<traffic_protocol_t>()) {
@@ -18,7 +18,7 @@
 
 #pragma once
 
-#include <list>
+#include <array>
 #include <map>
 #include <memory>
 #include <set>
@@ -26,11 +26,13 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/inlined_vector.h>
+
 #include "src/stirling/source_connectors/socket_tracer/conn_tracker.h"
 #include "src/stirling/utils/obj_pool.h"
 #include "src/stirling/utils/stat_counter.h"
 
-DECLARE_double(stirling_conn_tracker_cleanup_threshold);
+DECLARE_uint32(stirling_conn_tracker_cleanup_budget_us);
 
 namespace px {
 namespace stirling {
@@ -72,9 +74,18 @@ class ConnTrackerGenerations {
    */
   int CleanupGenerations(ConnTrackerPool* tracker_pool);
 
+  /**
+   * Removes the single given tracker, pushing it into the tracker pool for recycling.
+   * Returns false if the tracker is not in this generation set.
+   */
+  bool Erase(ConnTracker* tracker, ConnTrackerPool* tracker_pool);
+
  private:
-  // A map of TSID to ConnTrackers.
-  absl::flat_hash_map<uint64_t, std::unique_ptr<ConnTracker>> generations_;
+  // Generations of trackers, as (TSID, tracker) pairs.
+  // Nearly every connection has exactly one generation (two briefly, on FD reuse), so the
+  // entries are stored inline: no per-connection hash table is allocated, and lookup is a
+  // short linear scan. This matters for churn-heavy workloads with short-lived connections.
+  absl::InlinedVector<std::pair<uint64_t, std::unique_ptr<ConnTracker>>, 2> generations_;
 
   // Keep a pointer to the ConnTracker generation with the highest TSID.
   ConnTracker* oldest_generation_ = nullptr;
@@ -99,13 +110,66 @@ class ConnTrackersManager {
 
   ConnTrackersManager();
 
+  // Number of shards that active trackers are hashed into (by PID+FD).
+  // Each shard is a contiguous array that can be processed independently of the others.
+  static constexpr size_t kNumTrackerShards = 16;
+
+  using TrackerShards = std::array<std::vector<ConnTracker*>, kNumTrackerShards>;
+
   /**
    * Get a connection tracker for the specified conn_id. If a tracker does not exist,
    * one will be created and returned.
    */
   ConnTracker& GetOrCreateConnTracker(struct conn_id_t conn_id);
 
-  const std::list<ConnTracker*>& active_trackers() const { return active_trackers_; }
+  /**
+   * A lightweight view over all active trackers, iterating shard by shard.
+   * Provided so call sites that don't care about sharding can still use a simple range-for.
+   */
+  class ActiveTrackersView {
+   public:
+    class const_iterator {
+     public:
+      const_iterator(const TrackerShards* shards, size_t shard_idx, size_t pos)
+          : shards_(shards), shard_idx_(shard_idx), pos_(pos) {
+        AdvancePastEmptyShards();
+      }
+
+      ConnTracker* const& operator*() const { return (*shards_)[shard_idx_][pos_]; }
+      const_iterator& operator++() {
+        ++pos_;
+        AdvancePastEmptyShards();
+        return *this;
+      }
+      bool operator==(const const_iterator& other) const {
+        return shard_idx_ == other.shard_idx_ && pos_ == other.pos_;
+      }
+      bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+     private:
+      void AdvancePastEmptyShards() {
+        while (shard_idx_ < shards_->size() && pos_ >= (*shards_)[shard_idx_].size()) {
+          ++shard_idx_;
+          pos_ = 0;
+        }
+      }
+
+      const TrackerShards* shards_;
+      size_t shard_idx_;
+      size_t pos_;
+    };
+
+    explicit ActiveTrackersView(const TrackerShards* shards) : shards_(shards) {}
+    const_iterator begin() const { return const_iterator(shards_, 0, 0); }
+    const_iterator end() const { return const_iterator(shards_, shards_->size(), 0); }
+
+   private:
+    const TrackerShards* shards_;
+  };
+
+  ActiveTrackersView active_trackers() const { return ActiveTrackersView(&tracker_shards_); }
+
+  const TrackerShards& tracker_shards() const { return tracker_shards_; }
 
   /**
    * Returns the latest generation of a connection tracker for the given pid and fd.
@@ -115,11 +179,20 @@ class ConnTrackersManager {
 
   /**
    * Deletes trackers that are ReadyForDestruction().
-   * Call this only after accumulating enough trackers to clean-up, to avoid the performance
-   * impact of scanning through all trackers every iteration.
+   * Only trackers on the death row (see EnqueueForDestruction) are visited, so the cost scales
+   * with the number of dying trackers, not the total population. Cleanup stops when the per-call
+   * time budget (--stirling_conn_tracker_cleanup_budget_us) is exhausted; remaining candidates
+   * carry over to the next call.
    */
   void CleanupTrackers();
 
+  /**
+   * Called by a ConnTracker when its death countdown reaches zero, making it a candidate for
+   * destruction. The tracker stays on the death row until it is ReadyForDestruction() (i.e. its
+   * final conn stats have been reported) and a CleanupTrackers() call reaches it.
+   */
+  void EnqueueForDestruction(ConnTracker* tracker);
+
   /**
    * Returns extensive debug information about the connection trackers.
    */
@@ -139,12 +212,24 @@ class ConnTrackersManager {
   // Simple consistency DCHECKs meant for enforcing invariants.
   void DebugChecks() const;
 
+  // Destroys a single tracker: O(1) removal from its shard, targeted erase from its generation
+  // set, and recycling into the tracker pool.
+  void DestroyTracker(ConnTracker* tracker);
+
   // A map from conn_id (PID+FD+TSID) to tracker. This is for easy update on BPF events.
   // Structured as two nested maps to be explicit about "generations" of trackers per PID+FD.
   // Key is {PID, FD} for outer map, and tsid for inner map.
   absl::flat_hash_map<uint64_t, ConnTrackerGenerations> conn_id_tracker_generations_;
 
-  std::list<ConnTracker*> active_trackers_;
+  // Active trackers, sharded by a hash of {PID, FD} into contiguous arrays.
+  // Contiguity keeps the per-cycle transfer scan cache-friendly, and the shards are
+  // independent of each other so they can be drained in parallel if needed.
+  TrackerShards tracker_shards_;
+
+  // Destruction candidates, enqueued by trackers when their death countdown reaches zero.
+  // Trackers that are not yet ReadyForDestruction() when visited (final conn stats still
+  // pending), and trackers beyond the cleanup time budget, stay here for the next cycle.
+  std::vector<ConnTracker*> death_row_;
 
   // A pool of unused trackers that can be recycled.
   // This is useful for avoiding memory reallocations.
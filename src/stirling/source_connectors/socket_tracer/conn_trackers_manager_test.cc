@@ -96,6 +96,34 @@ TEST_F(ConnTrackersManagerTest, Fuzz) {
   }
 }
 
+// Tests that a tracker that completes its death countdown is destroyed through the death row,
+// and that destruction waits for the final conn stats to be reported.
+TEST_F(ConnTrackersManagerTest, DeathRowCleanup) {
+  FLAGS_stirling_check_proc_for_conn_close = false;
+
+  struct conn_id_t conn_id = {};
+  conn_id.upid.pid = 1;
+  conn_id.upid.start_time_ticks = 1;
+  conn_id.fd = 1;
+  conn_id.tsid = 1;
+
+  ConnTracker& tracker = trackers_mgr_.GetOrCreateConnTracker(conn_id);
+  tracker.MarkForDeath();
+  for (int i = 0; i < ConnTracker::kDeathCountdownIters; ++i) {
+    tracker.IterationPostTick();
+  }
+
+  // Final conn stats not reported yet: the tracker stays on the death row.
+  trackers_mgr_.CleanupTrackers();
+  EXPECT_THAT(trackers_mgr_.StatsString(), HasSubstr("kDestroyed=0"));
+
+  tracker.MarkFinalConnStatsReported();
+  trackers_mgr_.CleanupTrackers();
+  EXPECT_NOT_OK(trackers_mgr_.GetConnTracker(1, 1));
+  EXPECT_THAT(trackers_mgr_.StatsString(), HasSubstr("kTotal=0"));
+  EXPECT_THAT(trackers_mgr_.StatsString(), HasSubstr("kDestroyed=1"));
+}
+
 // Tests that the DebugInfo() returns expected text.
 TEST_F(ConnTrackersManagerTest, DebugInfo) {
   struct conn_id_t conn_id = {};
@@ -53,6 +53,7 @@ void DataStream::AddData(std::unique_ptr<SocketDataEvent> event) {
 
   data_buffer_.Add(event->attr.pos, event->msg, event->attr.timestamp_ns);
 
+  unreported_bytes_in_ += event->msg.size();
   has_new_events_ = true;
 }
 
@@ -108,9 +109,13 @@ void DataStream::ProcessBytesToFrames(message_type_t type, TStateType* state) {
   parse_result.end_position = 0;
 
   size_t frame_bytes = 0;
+  size_t cycle_valid_frames = 0;
+  size_t cycle_invalid_frames = 0;
 
   while (keep_processing && !data_buffer_.empty()) {
-    size_t contiguous_bytes = data_buffer_.Head().size();
+    // Note: ContiguousHeadSize() equals Head().size(), but doesn't force the buffer to
+    // materialize the head into one contiguous piece, which ParseFrames() may not need.
+    size_t contiguous_bytes = data_buffer_.ContiguousHeadSize();
 
     // Now parse the raw data.
     parse_result =
@@ -138,6 +143,8 @@ void DataStream::ProcessBytesToFrames(message_type_t type, TStateType* state) {
     stat_invalid_frames_ += parse_result.invalid_frames;
     stat_raw_data_gaps_ += keep_processing;
 
+    cycle_valid_frames += parse_result.frame_positions.size();
+    cycle_invalid_frames += parse_result.invalid_frames;
     frame_bytes += parse_result.frame_bytes;
   }
 
@@ -163,12 +170,25 @@ void DataStream::ProcessBytesToFrames(message_type_t type, TStateType* state) {
     UpdateLastProgressTime();
   }
 
+  // Per-protocol pipeline telemetry, batched to one counter update per stage per cycle.
+  auto& metrics = SocketTracerMetrics::GetProtocolMetrics(protocol_);
+  if (unreported_bytes_in_ > 0) {
+    metrics.pipeline_bytes_in.Increment(unreported_bytes_in_);
+    unreported_bytes_in_ = 0;
+  }
+  if (cycle_valid_frames > 0) {
+    metrics.pipeline_frames_parsed.Increment(cycle_valid_frames);
+  }
+  if (cycle_invalid_frames > 0) {
+    metrics.pipeline_parse_failures.Increment(cycle_invalid_frames);
+  }
+
   // Keep track of "lost" data in prometheus. "lost" data includes any gaps in the data stream as
   // well as data that wasn't able to be successfully parsed.
   ssize_t num_bytes_advanced = data_buffer_.position() - last_processed_pos_;
   if (num_bytes_advanced > 0 && static_cast<size_t>(num_bytes_advanced) > frame_bytes) {
     size_t bytes_lost = num_bytes_advanced - frame_bytes;
-    SocketTracerMetrics::GetProtocolMetrics(protocol_).data_loss_bytes.Increment(bytes_lost);
+    metrics.data_loss_bytes.Increment(bytes_lost);
   }
   last_processed_pos_ = data_buffer_.position();
 
@@ -313,6 +313,10 @@ class DataStream : NotCopyMoveable {
   // Keep track of the byte position after the last processed position, in order to measure data
   // loss.
   size_t last_processed_pos_ = 0;
+  // Bytes added by AddData() since the last ProcessBytesToFrames() call. Accumulated here and
+  // flushed to the per-protocol pipeline_bytes_in counter once per transfer cycle, to keep the
+  // counter update off the per-event path.
+  size_t unreported_bytes_in_ = 0;
   // Keep track of the protocol for this DataStream so that data loss can be reported per protocol.
   traffic_protocol_t protocol_ = traffic_protocol_t::kProtocolUnknown;
 
@@ -98,6 +98,26 @@ TEST_F(DataStreamTest, LostEvent) {
             SocketTracerMetrics::GetProtocolMetrics(kProtocolHTTP).data_loss_bytes.Value());
 }
 
+TEST_F(DataStreamTest, PipelineStageMetrics) {
+  std::unique_ptr<SocketDataEvent> req0 = event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq0);
+  std::unique_ptr<SocketDataEvent> req1 = event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq1);
+  protocols::http::StateWrapper state{};
+
+  const size_t total_bytes = req0->msg.size() + req1->msg.size();
+
+  DataStream stream;
+  stream.set_protocol(kProtocolHTTP);
+  stream.AddData(std::move(req0));
+  stream.AddData(std::move(req1));
+  stream.ProcessBytesToFrames<http::Message>(message_type_t::kRequest, &state);
+  ASSERT_THAT(stream.Frames<http::Message>(), SizeIs(2));
+
+  const auto& metrics = SocketTracerMetrics::GetProtocolMetrics(kProtocolHTTP);
+  EXPECT_EQ(total_bytes, metrics.pipeline_bytes_in.Value());
+  EXPECT_EQ(2, metrics.pipeline_frames_parsed.Value());
+  EXPECT_EQ(0, metrics.pipeline_parse_failures.Value());
+}
+
 TEST_F(DataStreamTest, StuckTemporarily) {
   std::unique_ptr<SocketDataEvent> req0a =
       event_gen_.InitSendEvent<kProtocolHTTP>(kHTTPReq0.substr(0, kHTTPReq0.length() - 10));
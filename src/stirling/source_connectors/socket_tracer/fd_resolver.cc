@@ -23,12 +23,67 @@
 #include "src/common/base/base.h"
 #include "src/common/fs/inode_utils.h"
 
+DEFINE_bool(stirling_enable_fd_link_cache, true,
+            "If true, /proc/<pid>/fd link reads for connection inference are served from a "
+            "process-wide cache for a few iterations, instead of issuing a readlink syscall per "
+            "tracker per iteration. BPF close events invalidate cache entries.");
+
 namespace px {
 namespace stirling {
 
+FDLinkCache& FDLinkCache::GetInstance() {
+  static FDLinkCache cache;
+  return cache;
+}
+
+Status FDLinkCache::ReadFDLink(system::ProcParser* proc_parser, int pid, int fd,
+                               std::string* out) {
+  uint64_t key = Key(pid, fd);
+
+  auto iter = cache_.find(key);
+  if (iter != cache_.end() && generation_ - iter->second.generation <= kMaxCachedGenerations) {
+    *out = iter->second.link;
+    return Status::OK();
+  }
+
+  Status s = proc_parser->ReadProcPIDFDLink(pid, fd, out);
+  if (!s.ok()) {
+    // The FD is gone; drop any stale entry so it is not revived by a later lookup.
+    if (iter != cache_.end()) {
+      cache_.erase(iter);
+    }
+    return s;
+  }
+
+  cache_[key] = Entry{*out, generation_};
+  return Status::OK();
+}
+
+void FDLinkCache::Invalidate(int pid, int fd) { cache_.erase(Key(pid, fd)); }
+
+void FDLinkCache::AdvanceGeneration() {
+  ++generation_;
+
+  // Prune entries that have aged out, to bound memory for FDs whose close events were missed.
+  for (auto iter = cache_.begin(); iter != cache_.end();) {
+    if (generation_ - iter->second.generation > kMaxCachedGenerations) {
+      cache_.erase(iter++);
+    } else {
+      ++iter;
+    }
+  }
+}
+
 FDResolver::FDResolver(system::ProcParser* proc_parser, int pid, int fd)
     : proc_parser_(proc_parser), pid_(pid), fd_(fd) {}
 
+Status FDResolver::ReadFDLink(std::string* fd_link) {
+  if (FLAGS_stirling_enable_fd_link_cache) {
+    return FDLinkCache::GetInstance().ReadFDLink(proc_parser_, pid_, fd_, fd_link);
+  }
+  return proc_parser_->ReadProcPIDFDLink(pid_, fd_, fd_link);
+}
+
 bool FDResolver::Setup() {
   // Record some information about the FD.
   // This marks the starting point at which we reliably know the connection.
@@ -36,7 +91,7 @@ bool FDResolver::Setup() {
   // the hope is that we can recover the socket information on the next iteration,
   // if the connection appears to be stable.
 
-  Status s = proc_parser_->ReadProcPIDFDLink(pid_, fd_, &fd_link_);
+  Status s = ReadFDLink(&fd_link_);
   if (!s.ok()) {
     VLOG(2) << absl::Substitute("Can't set-up connection inference [msg=$0].", s.msg());
     active_ = false;
@@ -62,7 +117,7 @@ bool FDResolver::Update() {
   std::chrono::time_point<std::chrono::steady_clock> timestamp = std::chrono::steady_clock::now();
 
   std::string current_fd_link;
-  Status s = proc_parser_->ReadProcPIDFDLink(pid_, fd_, &current_fd_link);
+  Status s = ReadFDLink(&current_fd_link);
   if (!s.ok()) {
     VLOG(2) << "Can't infer remote endpoint. FD is not accessible.";
     active_ = false;
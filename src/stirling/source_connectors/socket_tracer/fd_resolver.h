@@ -24,12 +24,69 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+
 #include "src/common/system/proc_parser.h"
 #include "src/common/system/socket_info.h"
 
+DECLARE_bool(stirling_enable_fd_link_cache);
+
 namespace px {
 namespace stirling {
 
+/**
+ * FDLinkCache is a process-wide cache of /proc/<pid>/fd link reads.
+ *
+ * Every unresolved connection tracker re-reads its FD link each iteration to confirm that the FD
+ * has not been reused. On FD-dense processes (e.g. proxies with tens of thousands of open
+ * sockets), these readlink syscalls can dominate the transfer cycle. This cache serves repeat
+ * reads of a {pid, fd} pair for a bounded number of iterations. BPF close events invalidate
+ * entries promptly (see ConnTracker::AddConnCloseEvent), so in the common case a stale entry is
+ * evicted before it can be served.
+ */
+class FDLinkCache {
+ public:
+  static FDLinkCache& GetInstance();
+
+  /**
+   * Returns the link contents of /proc/<pid>/fd/<fd>, reading from /proc only if no
+   * sufficiently fresh cached value exists.
+   */
+  Status ReadFDLink(system::ProcParser* proc_parser, int pid, int fd, std::string* out);
+
+  /**
+   * Removes the cached entry for {pid, fd}.
+   * Called when BPF reports that the FD has closed, so a subsequent read of a recycled FD
+   * goes back to /proc instead of being served a stale link.
+   */
+  void Invalidate(int pid, int fd);
+
+  /**
+   * Advances the cache's notion of time by one iteration, and prunes entries that have aged out
+   * of their freshness window. Called once per transfer cycle.
+   */
+  void AdvanceGeneration();
+
+  size_t size() const { return cache_.size(); }
+
+ private:
+  // Number of iterations for which a cached FD link may be served before being re-read.
+  // Bounds the staleness of an entry whose close event was missed (e.g. an untraced close).
+  static constexpr uint64_t kMaxCachedGenerations = 4;
+
+  struct Entry {
+    std::string link;
+    uint64_t generation;
+  };
+
+  static uint64_t Key(int pid, int fd) {
+    return (static_cast<uint64_t>(pid) << 32) | static_cast<uint32_t>(fd);
+  }
+
+  absl::flat_hash_map<uint64_t, Entry> cache_;
+  uint64_t generation_ = 0;
+};
+
 /**
  * SocketResolver tries to determine the socket inode number of a given a PID and FD.
  *
@@ -85,6 +142,9 @@ class FDResolver {
   }
 
  private:
+  // Reads the FD link, going through FDLinkCache when enabled.
+  Status ReadFDLink(std::string* fd_link);
+
   system::ProcParser* proc_parser_;
   int pid_;
   int fd_;
@@ -32,6 +32,10 @@ class FDResolverTest : public ::testing::Test {
  protected:
   void SetUp() {
     proc_parser_ = std::make_unique<system::ProcParser>(system::Config::GetInstance());
+
+    // Most tests below exercise the raw /proc sampling behavior of FDResolver,
+    // so bypass the FD link cache by default. Cache tests re-enable it explicitly.
+    FLAGS_stirling_enable_fd_link_cache = false;
   }
 
   std::unique_ptr<system::ProcParser> proc_parser_;
@@ -187,5 +191,47 @@ TEST_F(FDResolverTest, NewSocketSameFD) {
   EXPECT_FALSE(fd_link.has_value());
 }
 
+TEST_F(FDResolverTest, FDLinkCacheInvalidation) {
+  FLAGS_stirling_enable_fd_link_cache = true;
+
+  system::TCPSocket socket;
+  int pid = getpid();
+  int fd = socket.sockfd();
+
+  auto resolver = FDResolver(proc_parser_.get(), pid, fd);
+  ASSERT_TRUE(resolver.Setup());
+
+  socket.Close();
+
+  // The link cached by Setup() masks the close until the entry is invalidated.
+  // In production, the BPF close event triggers the invalidation.
+  EXPECT_TRUE(resolver.Update());
+
+  FDLinkCache::GetInstance().Invalidate(pid, fd);
+  EXPECT_FALSE(resolver.Update());
+}
+
+TEST_F(FDResolverTest, FDLinkCacheAging) {
+  FLAGS_stirling_enable_fd_link_cache = true;
+
+  system::TCPSocket socket;
+  int pid = getpid();
+  int fd = socket.sockfd();
+
+  auto resolver = FDResolver(proc_parser_.get(), pid, fd);
+  ASSERT_TRUE(resolver.Setup());
+
+  socket.Close();
+
+  // Even without an invalidation (e.g. a missed close event), the cached entry ages out
+  // after a bounded number of generations, after which the close is detected.
+  bool success = true;
+  for (int i = 0; i < 10 && success; ++i) {
+    FDLinkCache::GetInstance().AdvanceGeneration();
+    success = resolver.Update();
+  }
+  EXPECT_FALSE(success);
+}
+
 }  // namespace stirling
 }  // namespace px
@@ -40,10 +40,71 @@ SocketTracerMetrics::SocketTracerMetrics(prometheus::Registry* registry,
                            .Name("conn_stats_bytes")
                            .Help("Total bytes of data tracked by conn stats for this protocol.")
                            .Register(*registry)
-                           .Add({{"protocol", std::string(magic_enum::enum_name(protocol))}})) {}
+                           .Add({{"protocol", std::string(magic_enum::enum_name(protocol))}})),
+      pipeline_bytes_in(
+          prometheus::BuildCounter()
+              .Name("pipeline_bytes_in")
+              .Help("Total bytes of raw data entering the parsing pipeline for this protocol.")
+              .Register(*registry)
+              .Add({{"protocol", std::string(magic_enum::enum_name(protocol))}})),
+      pipeline_frames_parsed(
+          prometheus::BuildCounter()
+              .Name("pipeline_frames_parsed")
+              .Help("Total number of frames successfully parsed for this protocol.")
+              .Register(*registry)
+              .Add({{"protocol", std::string(magic_enum::enum_name(protocol))}})),
+      pipeline_parse_failures(
+          prometheus::BuildCounter()
+              .Name("pipeline_parse_failures")
+              .Help("Total number of frames that failed to parse for this protocol.")
+              .Register(*registry)
+              .Add({{"protocol", std::string(magic_enum::enum_name(protocol))}})),
+      pipeline_frames_stitched(
+          prometheus::BuildCounter()
+              .Name("pipeline_frames_stitched")
+              .Help("Total number of parsed frames consumed by request-response stitching for "
+                    "this protocol.")
+              .Register(*registry)
+              .Add({{"protocol", std::string(magic_enum::enum_name(protocol))}})),
+      pipeline_records_emitted(
+          prometheus::BuildCounter()
+              .Name("pipeline_records_emitted")
+              .Help("Total number of stitched records emitted to data tables for this protocol.")
+              .Register(*registry)
+              .Add({{"protocol", std::string(magic_enum::enum_name(protocol))}})),
+      pipeline_buffer_evictions(
+          prometheus::BuildCounter()
+              .Name("pipeline_buffer_evictions")
+              .Help("Total number of times a data stream buffer was purged before parsing, due "
+                    "to size limits or expiry, for this protocol.")
+              .Register(*registry)
+              .Add({{"protocol", std::string(magic_enum::enum_name(protocol))}})) {}
+
+PerfBufferMetrics::PerfBufferMetrics(prometheus::Registry* registry,
+                                     const std::string& buffer_name)
+    : lost_events(prometheus::BuildCounter()
+                      .Name("perf_buffer_lost_events")
+                      .Help("Total number of events dropped because this perf buffer was full.")
+                      .Register(*registry)
+                      .Add({{"buffer", buffer_name}})) {}
+
+BPFMapMetrics::BPFMapMetrics(prometheus::Registry* registry, const std::string& map_name)
+    : occupancy(prometheus::BuildGauge()
+                    .Name("bpf_map_occupancy")
+                    .Help("Number of entries currently in this BPF map, as of the last periodic "
+                          "scan.")
+                    .Register(*registry)
+                    .Add({{"map", map_name}})),
+      capacity(prometheus::BuildGauge()
+                   .Name("bpf_map_capacity")
+                   .Help("Maximum number of entries in this BPF map.")
+                   .Register(*registry)
+                   .Add({{"map", map_name}})) {}
 
 namespace {
 std::unordered_map<traffic_protocol_t, std::unique_ptr<SocketTracerMetrics>> g_protocol_metrics;
+std::unordered_map<std::string, std::unique_ptr<PerfBufferMetrics>> g_perf_buffer_metrics;
+std::unordered_map<std::string, std::unique_ptr<BPFMapMetrics>> g_bpf_map_metrics;
 
 void ResetProtocolMetrics(traffic_protocol_t protocol) {
   g_protocol_metrics.insert_or_assign(
@@ -62,5 +123,21 @@ void SocketTracerMetrics::TestOnlyResetProtocolMetrics(traffic_protocol_t protoc
   ResetProtocolMetrics(protocol);
 }
 
+PerfBufferMetrics& PerfBufferMetrics::GetPerfBufferMetrics(const std::string& buffer_name) {
+  if (g_perf_buffer_metrics.find(buffer_name) == g_perf_buffer_metrics.end()) {
+    g_perf_buffer_metrics.insert_or_assign(
+        buffer_name, std::make_unique<PerfBufferMetrics>(&GetMetricsRegistry(), buffer_name));
+  }
+  return *g_perf_buffer_metrics[buffer_name];
+}
+
+BPFMapMetrics& BPFMapMetrics::GetMapMetrics(const std::string& map_name) {
+  if (g_bpf_map_metrics.find(map_name) == g_bpf_map_metrics.end()) {
+    g_bpf_map_metrics.insert_or_assign(
+        map_name, std::make_unique<BPFMapMetrics>(&GetMetricsRegistry(), map_name));
+  }
+  return *g_bpf_map_metrics[map_name];
+}
+
 }  // namespace stirling
 }  // namespace px
@@ -18,7 +18,10 @@
 
 #pragma once
 
+#include <string>
+
 #include <prometheus/counter.h>
+#include <prometheus/gauge.h>
 #include <prometheus/registry.h>
 
 #include "src/common/metrics/metrics.h"
@@ -32,10 +35,42 @@ struct SocketTracerMetrics {
   prometheus::Counter& data_loss_bytes;
   prometheus::Counter& conn_stats_bytes;
 
+  // Per-stage pipeline telemetry. Together these make it possible to see where bytes die
+  // (ingest -> parse -> stitch -> emit) without a debug build:
+  //   pipeline_bytes_in >> frames parsed      => parser can't make sense of the data.
+  //   frames parsed >> frames stitched        => req/resp matching is failing.
+  //   buffer evictions > 0                    => data aged out or was truncated before parsing.
+  // All increments are batched per transfer cycle, so the cost stays off the per-event path.
+  prometheus::Counter& pipeline_bytes_in;
+  prometheus::Counter& pipeline_frames_parsed;
+  prometheus::Counter& pipeline_parse_failures;
+  prometheus::Counter& pipeline_frames_stitched;
+  prometheus::Counter& pipeline_records_emitted;
+  prometheus::Counter& pipeline_buffer_evictions;
+
   static SocketTracerMetrics& GetProtocolMetrics(traffic_protocol_t protocol);
 
   static void TestOnlyResetProtocolMetrics(traffic_protocol_t protocol);
 };
 
+// Per-perf-buffer drop telemetry, labeled by buffer name.
+struct PerfBufferMetrics {
+  PerfBufferMetrics(prometheus::Registry* registry, const std::string& buffer_name);
+  prometheus::Counter& lost_events;
+
+  static PerfBufferMetrics& GetPerfBufferMetrics(const std::string& buffer_name);
+};
+
+// Per-BPF-map occupancy telemetry, labeled by map name.
+// Occupancy approaching capacity is the leading indicator of data loss, and shows up
+// here before entries are dropped.
+struct BPFMapMetrics {
+  BPFMapMetrics(prometheus::Registry* registry, const std::string& map_name);
+  prometheus::Gauge& occupancy;
+  prometheus::Gauge& capacity;
+
+  static BPFMapMetrics& GetMapMetrics(const std::string& map_name);
+};
+
 }  // namespace stirling
 }  // namespace px
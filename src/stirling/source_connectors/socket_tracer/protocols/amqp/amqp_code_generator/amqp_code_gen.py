@@ -265,18 +265,12 @@ class AMQPMethod:
         """
         return f"k{self.c_struct_name} = {self.method_id}"
 
-    def gen_method_enum_select_case(self, constant_enum_name):
+    def gen_method_dispatch_entry(self, constant_enum_name, class_var):
         """
-        Case used to Select the correct method to extract. The generated form will be
-        switch (static_cast<AMQPChannelMethods>(method_id))
-            case AMQPChannelMethods::kAMQPChannelOpen:
-                return ExtractAMQPChannelOpen(decoder, req);
-            ...
-        """
-        return f"""
-            case {constant_enum_name}::k{self.c_struct_name}:
-                return Extract{self.c_struct_name}(decoder, req);
+        Registration of the extract method in the constexpr dispatch table. The generated form will be
+        channel[AMQPChannelMethods::kAMQPChannelOpen] = &ExtractAMQPChannelOpen;
         """
+        return f"{class_var}[{constant_enum_name}::k{self.c_struct_name}] = &Extract{self.c_struct_name};"
 
     def get_class_buffer_extract(self):
         """
@@ -367,41 +361,34 @@ class AMQPClass:
             }};
             """
 
-    def gen_content_header_enum_select(self):
-        """
-        This will be included to easily select the extraction methods given class_id
-        switch (method_id) {
-            case AMQPConnectionMethods::kAMQPConnectionStart:
-                return ExtractAMQPConnectionStart(decoder, req);
+    def gen_content_header_dispatch_entry(self):
         """
-        return f"""
-            case AMQPClasses::k{self.class_name}:
-                return Extract{self.content_header_method.c_struct_name}(decoder, req);
+        Registration of the content header extract method in the constexpr dispatch table.
+        The generated form will be
+        t[ClassSlot(AMQPClasses::kConnection)] = &ExtractAMQPConnectionContentHeader;
         """
+        return (
+            f"t[ClassSlot(AMQPClasses::k{self.class_name})] = "
+            f"&Extract{self.content_header_method.c_struct_name};"
+        )
 
-    def gen_method_select(self):
+    def gen_method_dispatch_entries(self):
         """
-        This will select the relevant method to extract from the buffer for a specific class.
-        switch (static_cast<AMQPChannelMethods>(method_id))
-            case AMQPChannelMethods::kAMQPChannelOpen:
-                return ExtractAMQPChannelOpen(decoder, req);
-            ...
+        Registers all extract methods of this class in the constexpr dispatch table.
+        auto channel = t[ClassSlot(AMQPClasses::kChannel)].data();
+        channel[AMQPChannelMethods::kAMQPChannelOpen] = &ExtractAMQPChannelOpen;
+        ...
         """
-        method_cases = "\n".join(
+        class_var = self.class_name.lower()
+        method_entries = "\n".join(
             [
-                method.gen_method_enum_select_case(self.constant_enum_name)
+                method.gen_method_dispatch_entry(self.constant_enum_name, class_var)
                 for method in self.methods
             ]
         )
         return f"""
-            Status Process{self.class_name}(BinaryDecoder *decoder, Frame *req, uint16_t  method_id) {{
-                switch(static_cast<{self.constant_enum_name}>(method_id)) {{
-                    {method_cases}
-                    default:
-                        VLOG(1) << absl::Substitute("Invalid {self.class_name} frame method $0", method_id);
-                }}
-                return Status::OK();
-            }}
+            auto {class_var} = t[ClassSlot(AMQPClasses::k{self.class_name})].data();
+            {method_entries}
         """
 
     def gen_class_enum_declr(self):
@@ -414,17 +401,6 @@ class AMQPClass:
         """
         return f"k{self.class_name} = {self.class_id}"
 
-    def gen_class_enum_select_case(self):
-        """
-        This will be included to easily select the extraction methods given class_id for Content Header Frame Type
-        switch (class_id) {
-            case AMQPConnectionMethods::kAMQPConnectionStart:
-                return ExtractAMQPConnectionStart(decoder, req);
-        """
-        return f"""
-            case AMQPClasses::k{self.class_name}:
-                return Process{self.class_name}(decoder, req, method_id);
-        """
 
 
 class CodeGenerator:
@@ -653,40 +629,84 @@ class CodeGenerator:
 
     def gen_method_select(self):
         """
-        Generates all the method selectors for the AMQPClasses
+        Generates the constexpr dispatch tables mapping (class_id, method_id) to extract methods.
+        Class ids are multiples of 10, so class_id / 10 indexes a dense array of class slots.
+        """
+        num_class_slots = (
+            max(int(amqp_class.class_id) for amqp_class in self.amqp_classes) // 10 + 1
+        )
+        max_method_id = max(
+            int(method.method_id)
+            for amqp_class in self.amqp_classes
+            for method in amqp_class.methods
+        )
+        method_dispatch_entries = "\n".join(
+            [
+                amqp_class.gen_method_dispatch_entries()
+                for amqp_class in self.amqp_classes
+            ]
+        )
+        content_header_dispatch_entries = "\n".join(
+            [
+                amqp_class.gen_content_header_dispatch_entry()
+                for amqp_class in self.amqp_classes
+            ]
+        )
+        return f"""
+        // All method decoders share this signature, so dispatch is a single indexed load from a
+        // compile-time table instead of nested switch statements over class_id/method_id.
+        using MethodExtractFn = Status (*)(BinaryDecoder*, Frame*);
+
+        // AMQP class ids are all multiples of 10, so class_id / 10 indexes
+        // a dense table of kNumClassSlots slots.
+        constexpr size_t kNumClassSlots = {num_class_slots};
+        constexpr size_t kMaxMethodId = {max_method_id};
+
+        constexpr size_t ClassSlot(AMQPClasses class_id) {{ return static_cast<size_t>(class_id) / 10; }}
+
+        using MethodDispatchTable =
+            std::array<std::array<MethodExtractFn, kMaxMethodId + 1>, kNumClassSlots>;
+
+        constexpr MethodDispatchTable BuildMethodDispatchTable() {{
+            MethodDispatchTable t{{}};
+            {method_dispatch_entries}
+            return t;
+        }}
+
+        constexpr MethodDispatchTable kMethodDispatchTable = BuildMethodDispatchTable();
+
+        constexpr std::array<MethodExtractFn, kNumClassSlots> BuildContentHeaderDispatchTable() {{
+            std::array<MethodExtractFn, kNumClassSlots> t{{}};
+            {content_header_dispatch_entries}
+            return t;
+        }}
+
+        constexpr std::array<MethodExtractFn, kNumClassSlots> kContentHeaderDispatchTable =
+            BuildContentHeaderDispatchTable();
         """
-        class_select_methods = []
-        for amqp_class in self.amqp_classes:
-            class_select_methods.append(amqp_class.gen_method_select())
-        return "\n".join(class_select_methods)
 
     def gen_class_select(self):
         """
-        Given a buffer, uses the class_id to find list of functions that can extract the buffer.
-        Given the class_id, a list of relevant methods to the AMQP class can be found via method_id.
+        Given a buffer, uses (class_id, method_id) to look up the extract method in the
+        constexpr dispatch table.
         """
-
-        amqp_extract_class_case = []
-        for amqp_class in self.amqp_classes:
-            amqp_extract_class_case.append(amqp_class.gen_class_enum_select_case())
-
-        amqp_extract_class_case_str = "\n".join(amqp_extract_class_case)
-        return f"""
-        Status ProcessFrameMethod(BinaryDecoder* decoder, Frame* req) {{
+        return """
+        Status ProcessFrameMethod(BinaryDecoder* decoder, Frame* req) {
             PL_ASSIGN_OR_RETURN(uint16_t class_id, decoder->ExtractInt<uint16_t>());
             PL_ASSIGN_OR_RETURN(uint16_t method_id, decoder->ExtractInt<uint16_t>());
 
             req->class_id = class_id;
             req->method_id = method_id;
 
-            switch(static_cast<AMQPClasses>(class_id)) {{
-                {amqp_extract_class_case_str}
-                default:
-                    VLOG(1) << absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
-            }}
-
+            if (class_id % 10 == 0 && class_id / 10 < kNumClassSlots && method_id <= kMaxMethodId) {
+                MethodExtractFn extract_fn = kMethodDispatchTable[class_id / 10][method_id];
+                if (extract_fn != nullptr) {
+                    return extract_fn(decoder, req);
+                }
+            }
+            VLOG(1) << absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
             return Status::OK();
-        }}
+        }
         """
 
     def gen_process_frame_type(self):
@@ -718,30 +738,27 @@ class CodeGenerator:
 
     def gen_process_content_header_select(self):
         """
-        Process the content header frame type by selecting the relevant content header extract method
+        Process the content header frame type by looking up the relevant content header extract
+        method in the constexpr dispatch table.
         """
-        amqp_extract_class_case = []
-        for amqp_class in self.amqp_classes:
-            amqp_class_case = amqp_class.gen_content_header_enum_select()
-            amqp_extract_class_case.append(amqp_class_case)
-
-        amqp_extract_class_case_str = "\n".join(amqp_extract_class_case)
-        return f"""
-        Status ProcessContentHeader(BinaryDecoder* decoder, Frame* req) {{
+        return """
+        Status ProcessContentHeader(BinaryDecoder* decoder, Frame* req) {
             PL_ASSIGN_OR_RETURN(uint16_t class_id, decoder->ExtractInt<uint16_t>());
             PL_ASSIGN_OR_RETURN(uint16_t weight, decoder->ExtractInt<uint16_t>());
             req->class_id = class_id;
 
-            if(weight != 0) {{
+            if(weight != 0) {
                 return error::Internal("AMQP content header weight should be 0");
-            }}
-            switch(static_cast<AMQPClasses>(class_id)) {{
-                {amqp_extract_class_case_str}
-                default:
-                    VLOG(1) << absl::Substitute("Unparsed content header class $0", class_id);
-            }}
+            }
+            if (class_id % 10 == 0 && class_id / 10 < kNumClassSlots) {
+                MethodExtractFn extract_fn = kContentHeaderDispatchTable[class_id / 10];
+                if (extract_fn != nullptr) {
+                    return extract_fn(decoder, req);
+                }
+            }
+            VLOG(1) << absl::Substitute("Unparsed frame method class $0", class_id);
             return Status::OK();
-        }}
+        }
         """
 
 
@@ -165,14 +165,11 @@ class TestAMQPMethod(BaseTestCase):
             self.amqp_method.gen_method_enum_declr(), "kAMQPSampleClassSampleMethod = 1"
         )
 
-    def test_gen_method_enum_select_case(self):
+    def test_gen_method_dispatch_entry(self):
         self.assertEqualGenStr(
-            self.amqp_method.gen_method_enum_select_case(
-                "Connection"
-            ),  # TODO PASS CLASS NAME HERE
+            self.amqp_method.gen_method_dispatch_entry("Connection", "connection"),
             """
-            case Connection::kAMQPSampleClassSampleMethod:
-                return ExtractAMQPSampleClassSampleMethod(decoder, req);
+            connection[Connection::kAMQPSampleClassSampleMethod] = &ExtractAMQPSampleClassSampleMethod;
             """,
         )
 
@@ -211,40 +208,23 @@ class TestAMQPClass(BaseTestCase):
             """,
         )
 
-    def test_gen_method_select(self):
+    def test_gen_method_dispatch_entries(self):
         self.assertEqualGenStr(
-            self.sample_class.gen_method_select(),
+            self.sample_class.gen_method_dispatch_entries(),
             """
-            Status ProcessSampleClass(BinaryDecoder *decoder, Frame *req, uint16_t  method_id) {
-                switch(static_cast<AMQPSampleClassMethods>(method_id)) {
-                    case AMQPSampleClassMethods::kAMQPSampleclassSampleMethod:
-                        return ExtractAMQPSampleclassSampleMethod(decoder, req);
-                    default:
-                        VLOG(1)<<absl::Substitute("Invalid Sample Class frame method $0", method_id);
-                }
-                return Status::OK();
-            }
+            auto sampleclass = t[ClassSlot(AMQPClasses::kSampleClass)].data();
+            sampleclass[AMQPSampleClassMethods::kAMQPSampleclassSampleMethod] = &ExtractAMQPSampleclassSampleMethod;
             """,
         )
 
     def test_gen_class_enum_declr(self):
         self.assertEqual(self.sample_class.gen_class_enum_declr(), "kSampleClass = 0")
 
-    def test_gen_content_header_enum_select(self):
-        self.assertEqualGenStr(
-            self.sample_class.gen_content_header_enum_select(),
-            """
-            case AMQPClasses::kSampleClass:
-                return ExtractAMQPSampleclassContentHeader(decoder, req);
-            """,
-        )
-
-    def test_gen_class_enum_select_case(self):
+    def test_gen_content_header_dispatch_entry(self):
         self.assertEqualGenStr(
-            self.sample_class.gen_class_enum_select_case(),
+            self.sample_class.gen_content_header_dispatch_entry(),
             """
-            case AMQPClasses::kSampleClass:
-                return ProcessSampleClass(decoder, req, method_id);
+            t[ClassSlot(AMQPClasses::kSampleClass)] = &ExtractAMQPSampleclassContentHeader;
             """,
         )
 
@@ -562,15 +542,37 @@ class TestAMQPCodeGeneratorGen(BaseTestCase):
         self.assertEqualGenStr(
             self.code_generator_single_class.gen_method_select(),
             """
-            Status ProcessConnection(BinaryDecoder *decoder, Frame *req, uint16_t  method_id) {
-                switch(static_cast<AMQPConnectionMethods>(method_id)) {
-                    case AMQPConnectionMethods::kAMQPConnectionStart:
-                        return ExtractAMQPConnectionStart(decoder, req);
-                    default:
-                        VLOG(1)<<absl::Substitute("Invalid Connection frame method $0", method_id);
-                }
-                returnStatus::OK();
+            // All method decoders share this signature, so dispatch is a single indexed load from a
+            // compile-time table instead of nested switch statements over class_id/method_id.
+            using MethodExtractFn = Status (*)(BinaryDecoder*, Frame*);
+
+            // AMQP class ids are all multiples of 10, so class_id / 10 indexes
+            // a dense table of kNumClassSlots slots.
+            constexpr size_t kNumClassSlots = 2;
+            constexpr size_t kMaxMethodId = 10;
+
+            constexpr size_t ClassSlot(AMQPClasses class_id) { return static_cast<size_t>(class_id) / 10; }
+
+            using MethodDispatchTable =
+                std::array<std::array<MethodExtractFn, kMaxMethodId + 1>, kNumClassSlots>;
+
+            constexpr MethodDispatchTable BuildMethodDispatchTable() {
+                MethodDispatchTable t{};
+                auto connection = t[ClassSlot(AMQPClasses::kConnection)].data();
+                connection[AMQPConnectionMethods::kAMQPConnectionStart] = &ExtractAMQPConnectionStart;
+                return t;
+            }
+
+            constexpr MethodDispatchTable kMethodDispatchTable = BuildMethodDispatchTable();
+
+            constexpr std::array<MethodExtractFn, kNumClassSlots> BuildContentHeaderDispatchTable() {
+                std::array<MethodExtractFn, kNumClassSlots> t{};
+                t[ClassSlot(AMQPClasses::kConnection)] = &ExtractAMQPConnectionContentHeader;
+                return t;
             }
+
+            constexpr std::array<MethodExtractFn, kNumClassSlots> kContentHeaderDispatchTable =
+                BuildContentHeaderDispatchTable();
             """,
         )
 
@@ -585,12 +587,13 @@ class TestAMQPCodeGeneratorGen(BaseTestCase):
                 req->class_id = class_id;
                 req->method_id = method_id;
 
-                switch(static_cast<AMQPClasses>(class_id)) {
-                    case AMQPClasses::kConnection:
-                        return ProcessConnection(decoder, req, method_id);
-                    default:
-                        VLOG(1)<<absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
+                if (class_id % 10 == 0 && class_id / 10 < kNumClassSlots && method_id <= kMaxMethodId) {
+                    MethodExtractFn extract_fn = kMethodDispatchTable[class_id / 10][method_id];
+                    if (extract_fn != nullptr) {
+                        return extract_fn(decoder, req);
+                    }
                 }
+                VLOG(1)<<absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
                 return Status::OK();
             }
             """,
@@ -608,12 +611,13 @@ class TestAMQPCodeGeneratorGen(BaseTestCase):
                 if(weight != 0) {
                     return error::Internal("AMQP content header weight should be 0");
                 }
-                switch(static_cast<AMQPClasses>(class_id)) {
-                    case AMQPClasses::kConnection:
-                        return ExtractAMQPConnectionContentHeader(decoder, req);
-                    default:
-                        VLOG(1)<<absl::Substitute("Unparsed content header class $0", class_id);
+                if (class_id % 10 == 0 && class_id / 10 < kNumClassSlots) {
+                    MethodExtractFn extract_fn = kContentHeaderDispatchTable[class_id / 10];
+                    if (extract_fn != nullptr) {
+                        return extract_fn(decoder, req);
+                    }
                 }
+                VLOG(1)<<absl::Substitute("Unparsed frame method class $0", class_id);
                 return Status::OK();
             }
             """,
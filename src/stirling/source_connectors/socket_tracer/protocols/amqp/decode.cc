@@ -18,6 +18,7 @@
 
 #include "src/stirling/source_connectors/socket_tracer/protocols/amqp/decode.h"
 
+#include <array>
 #include <map>
 #include <stack>
 #include <string>
@@ -698,6 +699,107 @@ Status ExtractAMQPTxContentHeader(BinaryDecoder* decoder, Frame* frame) {
   return Status::OK();
 }
 
+// All method decoders share this signature, so dispatch is a single indexed load from a
+// compile-time table instead of nested switch statements over class_id/method_id.
+using MethodExtractFn = Status (*)(BinaryDecoder*, Frame*);
+
+// AMQP 0-9-1 class ids are all multiples of 10 (Connection=10 ... Tx=90), so class_id / 10 indexes
+// a dense table of kNumClassSlots slots. The largest method id is Basic.RecoverOk (111).
+constexpr size_t kNumClassSlots = 10;
+constexpr size_t kMaxMethodId = 111;
+
+constexpr size_t ClassSlot(AMQPClasses class_id) { return static_cast<size_t>(class_id) / 10; }
+
+using MethodDispatchTable =
+    std::array<std::array<MethodExtractFn, kMaxMethodId + 1>, kNumClassSlots>;
+
+constexpr MethodDispatchTable BuildMethodDispatchTable() {
+  MethodDispatchTable t{};
+
+  auto connection = t[ClassSlot(AMQPClasses::kConnection)].data();
+  connection[AMQPConnectionMethods::kAMQPConnectionStart] = &ExtractAMQPConnectionStart;
+  connection[AMQPConnectionMethods::kAMQPConnectionStartOk] = &ExtractAMQPConnectionStartOk;
+  connection[AMQPConnectionMethods::kAMQPConnectionSecure] = &ExtractAMQPConnectionSecure;
+  connection[AMQPConnectionMethods::kAMQPConnectionSecureOk] = &ExtractAMQPConnectionSecureOk;
+  connection[AMQPConnectionMethods::kAMQPConnectionTune] = &ExtractAMQPConnectionTune;
+  connection[AMQPConnectionMethods::kAMQPConnectionTuneOk] = &ExtractAMQPConnectionTuneOk;
+  connection[AMQPConnectionMethods::kAMQPConnectionOpen] = &ExtractAMQPConnectionOpen;
+  connection[AMQPConnectionMethods::kAMQPConnectionOpenOk] = &ExtractAMQPConnectionOpenOk;
+  connection[AMQPConnectionMethods::kAMQPConnectionClose] = &ExtractAMQPConnectionClose;
+  connection[AMQPConnectionMethods::kAMQPConnectionCloseOk] = &ExtractAMQPConnectionCloseOk;
+
+  auto channel = t[ClassSlot(AMQPClasses::kChannel)].data();
+  channel[AMQPChannelMethods::kAMQPChannelOpen] = &ExtractAMQPChannelOpen;
+  channel[AMQPChannelMethods::kAMQPChannelOpenOk] = &ExtractAMQPChannelOpenOk;
+  channel[AMQPChannelMethods::kAMQPChannelFlow] = &ExtractAMQPChannelFlow;
+  channel[AMQPChannelMethods::kAMQPChannelFlowOk] = &ExtractAMQPChannelFlowOk;
+  channel[AMQPChannelMethods::kAMQPChannelClose] = &ExtractAMQPChannelClose;
+  channel[AMQPChannelMethods::kAMQPChannelCloseOk] = &ExtractAMQPChannelCloseOk;
+
+  auto exchange = t[ClassSlot(AMQPClasses::kExchange)].data();
+  exchange[AMQPExchangeMethods::kAMQPExchangeDeclare] = &ExtractAMQPExchangeDeclare;
+  exchange[AMQPExchangeMethods::kAMQPExchangeDeclareOk] = &ExtractAMQPExchangeDeclareOk;
+  exchange[AMQPExchangeMethods::kAMQPExchangeDelete] = &ExtractAMQPExchangeDelete;
+  exchange[AMQPExchangeMethods::kAMQPExchangeDeleteOk] = &ExtractAMQPExchangeDeleteOk;
+
+  auto queue = t[ClassSlot(AMQPClasses::kQueue)].data();
+  queue[AMQPQueueMethods::kAMQPQueueDeclare] = &ExtractAMQPQueueDeclare;
+  queue[AMQPQueueMethods::kAMQPQueueDeclareOk] = &ExtractAMQPQueueDeclareOk;
+  queue[AMQPQueueMethods::kAMQPQueueBind] = &ExtractAMQPQueueBind;
+  queue[AMQPQueueMethods::kAMQPQueueBindOk] = &ExtractAMQPQueueBindOk;
+  queue[AMQPQueueMethods::kAMQPQueueUnbind] = &ExtractAMQPQueueUnbind;
+  queue[AMQPQueueMethods::kAMQPQueueUnbindOk] = &ExtractAMQPQueueUnbindOk;
+  queue[AMQPQueueMethods::kAMQPQueuePurge] = &ExtractAMQPQueuePurge;
+  queue[AMQPQueueMethods::kAMQPQueuePurgeOk] = &ExtractAMQPQueuePurgeOk;
+  queue[AMQPQueueMethods::kAMQPQueueDelete] = &ExtractAMQPQueueDelete;
+  queue[AMQPQueueMethods::kAMQPQueueDeleteOk] = &ExtractAMQPQueueDeleteOk;
+
+  auto basic = t[ClassSlot(AMQPClasses::kBasic)].data();
+  basic[AMQPBasicMethods::kAMQPBasicQos] = &ExtractAMQPBasicQos;
+  basic[AMQPBasicMethods::kAMQPBasicQosOk] = &ExtractAMQPBasicQosOk;
+  basic[AMQPBasicMethods::kAMQPBasicConsume] = &ExtractAMQPBasicConsume;
+  basic[AMQPBasicMethods::kAMQPBasicConsumeOk] = &ExtractAMQPBasicConsumeOk;
+  basic[AMQPBasicMethods::kAMQPBasicCancel] = &ExtractAMQPBasicCancel;
+  basic[AMQPBasicMethods::kAMQPBasicCancelOk] = &ExtractAMQPBasicCancelOk;
+  basic[AMQPBasicMethods::kAMQPBasicPublish] = &ExtractAMQPBasicPublish;
+  basic[AMQPBasicMethods::kAMQPBasicReturn] = &ExtractAMQPBasicReturn;
+  basic[AMQPBasicMethods::kAMQPBasicDeliver] = &ExtractAMQPBasicDeliver;
+  basic[AMQPBasicMethods::kAMQPBasicGet] = &ExtractAMQPBasicGet;
+  basic[AMQPBasicMethods::kAMQPBasicGetOk] = &ExtractAMQPBasicGetOk;
+  basic[AMQPBasicMethods::kAMQPBasicGetEmpty] = &ExtractAMQPBasicGetEmpty;
+  basic[AMQPBasicMethods::kAMQPBasicAck] = &ExtractAMQPBasicAck;
+  basic[AMQPBasicMethods::kAMQPBasicReject] = &ExtractAMQPBasicReject;
+  basic[AMQPBasicMethods::kAMQPBasicRecoverAsync] = &ExtractAMQPBasicRecoverAsync;
+  basic[AMQPBasicMethods::kAMQPBasicRecover] = &ExtractAMQPBasicRecover;
+  basic[AMQPBasicMethods::kAMQPBasicRecoverOk] = &ExtractAMQPBasicRecoverOk;
+
+  auto tx = t[ClassSlot(AMQPClasses::kTx)].data();
+  tx[AMQPTxMethods::kAMQPTxSelect] = &ExtractAMQPTxSelect;
+  tx[AMQPTxMethods::kAMQPTxSelectOk] = &ExtractAMQPTxSelectOk;
+  tx[AMQPTxMethods::kAMQPTxCommit] = &ExtractAMQPTxCommit;
+  tx[AMQPTxMethods::kAMQPTxCommitOk] = &ExtractAMQPTxCommitOk;
+  tx[AMQPTxMethods::kAMQPTxRollback] = &ExtractAMQPTxRollback;
+  tx[AMQPTxMethods::kAMQPTxRollbackOk] = &ExtractAMQPTxRollbackOk;
+
+  return t;
+}
+
+constexpr MethodDispatchTable kMethodDispatchTable = BuildMethodDispatchTable();
+
+constexpr std::array<MethodExtractFn, kNumClassSlots> BuildContentHeaderDispatchTable() {
+  std::array<MethodExtractFn, kNumClassSlots> t{};
+  t[ClassSlot(AMQPClasses::kConnection)] = &ExtractAMQPConnectionContentHeader;
+  t[ClassSlot(AMQPClasses::kChannel)] = &ExtractAMQPChannelContentHeader;
+  t[ClassSlot(AMQPClasses::kExchange)] = &ExtractAMQPExchangeContentHeader;
+  t[ClassSlot(AMQPClasses::kQueue)] = &ExtractAMQPQueueContentHeader;
+  t[ClassSlot(AMQPClasses::kBasic)] = &ExtractAMQPBasicContentHeader;
+  t[ClassSlot(AMQPClasses::kTx)] = &ExtractAMQPTxContentHeader;
+  return t;
+}
+
+constexpr std::array<MethodExtractFn, kNumClassSlots> kContentHeaderDispatchTable =
+    BuildContentHeaderDispatchTable();
+
 Status ProcessContentHeader(BinaryDecoder* decoder, Frame* req) {
   PL_ASSIGN_OR_RETURN(uint16_t class_id, decoder->ExtractInt<uint16_t>());
   PL_ASSIGN_OR_RETURN(uint16_t weight, decoder->ExtractInt<uint16_t>());
@@ -706,235 +808,13 @@ Status ProcessContentHeader(BinaryDecoder* decoder, Frame* req) {
   if (weight != 0) {
     return error::Internal("AMQP content header weight should be 0");
   }
-  switch (static_cast<AMQPClasses>(class_id)) {
-    case AMQPClasses::kConnection:
-      return ExtractAMQPConnectionContentHeader(decoder, req);
-
-    case AMQPClasses::kChannel:
-      return ExtractAMQPChannelContentHeader(decoder, req);
-
-    case AMQPClasses::kExchange:
-      return ExtractAMQPExchangeContentHeader(decoder, req);
-
-    case AMQPClasses::kQueue:
-      return ExtractAMQPQueueContentHeader(decoder, req);
-
-    case AMQPClasses::kBasic:
-      return ExtractAMQPBasicContentHeader(decoder, req);
-
-    case AMQPClasses::kTx:
-      return ExtractAMQPTxContentHeader(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Unparsed frame method class $0", class_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessConnection(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPConnectionMethods>(method_id)) {
-    case AMQPConnectionMethods::kAMQPConnectionStart:
-      return ExtractAMQPConnectionStart(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionStartOk:
-      return ExtractAMQPConnectionStartOk(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionSecure:
-      return ExtractAMQPConnectionSecure(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionSecureOk:
-      return ExtractAMQPConnectionSecureOk(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionTune:
-      return ExtractAMQPConnectionTune(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionTuneOk:
-      return ExtractAMQPConnectionTuneOk(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionOpen:
-      return ExtractAMQPConnectionOpen(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionOpenOk:
-      return ExtractAMQPConnectionOpenOk(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionClose:
-      return ExtractAMQPConnectionClose(decoder, req);
-
-    case AMQPConnectionMethods::kAMQPConnectionCloseOk:
-      return ExtractAMQPConnectionCloseOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Connection frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessChannel(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPChannelMethods>(method_id)) {
-    case AMQPChannelMethods::kAMQPChannelOpen:
-      return ExtractAMQPChannelOpen(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelOpenOk:
-      return ExtractAMQPChannelOpenOk(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelFlow:
-      return ExtractAMQPChannelFlow(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelFlowOk:
-      return ExtractAMQPChannelFlowOk(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelClose:
-      return ExtractAMQPChannelClose(decoder, req);
-
-    case AMQPChannelMethods::kAMQPChannelCloseOk:
-      return ExtractAMQPChannelCloseOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Channel frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessExchange(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPExchangeMethods>(method_id)) {
-    case AMQPExchangeMethods::kAMQPExchangeDeclare:
-      return ExtractAMQPExchangeDeclare(decoder, req);
-
-    case AMQPExchangeMethods::kAMQPExchangeDeclareOk:
-      return ExtractAMQPExchangeDeclareOk(decoder, req);
-
-    case AMQPExchangeMethods::kAMQPExchangeDelete:
-      return ExtractAMQPExchangeDelete(decoder, req);
-
-    case AMQPExchangeMethods::kAMQPExchangeDeleteOk:
-      return ExtractAMQPExchangeDeleteOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Exchange frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessQueue(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPQueueMethods>(method_id)) {
-    case AMQPQueueMethods::kAMQPQueueDeclare:
-      return ExtractAMQPQueueDeclare(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueDeclareOk:
-      return ExtractAMQPQueueDeclareOk(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueBind:
-      return ExtractAMQPQueueBind(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueBindOk:
-      return ExtractAMQPQueueBindOk(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueUnbind:
-      return ExtractAMQPQueueUnbind(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueUnbindOk:
-      return ExtractAMQPQueueUnbindOk(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueuePurge:
-      return ExtractAMQPQueuePurge(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueuePurgeOk:
-      return ExtractAMQPQueuePurgeOk(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueDelete:
-      return ExtractAMQPQueueDelete(decoder, req);
-
-    case AMQPQueueMethods::kAMQPQueueDeleteOk:
-      return ExtractAMQPQueueDeleteOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Queue frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessBasic(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPBasicMethods>(method_id)) {
-    case AMQPBasicMethods::kAMQPBasicQos:
-      return ExtractAMQPBasicQos(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicQosOk:
-      return ExtractAMQPBasicQosOk(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicConsume:
-      return ExtractAMQPBasicConsume(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicConsumeOk:
-      return ExtractAMQPBasicConsumeOk(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicCancel:
-      return ExtractAMQPBasicCancel(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicCancelOk:
-      return ExtractAMQPBasicCancelOk(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicPublish:
-      return ExtractAMQPBasicPublish(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicReturn:
-      return ExtractAMQPBasicReturn(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicDeliver:
-      return ExtractAMQPBasicDeliver(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicGet:
-      return ExtractAMQPBasicGet(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicGetOk:
-      return ExtractAMQPBasicGetOk(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicGetEmpty:
-      return ExtractAMQPBasicGetEmpty(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicAck:
-      return ExtractAMQPBasicAck(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicReject:
-      return ExtractAMQPBasicReject(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicRecoverAsync:
-      return ExtractAMQPBasicRecoverAsync(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicRecover:
-      return ExtractAMQPBasicRecover(decoder, req);
-
-    case AMQPBasicMethods::kAMQPBasicRecoverOk:
-      return ExtractAMQPBasicRecoverOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Basic frame method $0", method_id);
-  }
-  return Status::OK();
-}
-
-Status ProcessTx(BinaryDecoder* decoder, Frame* req, uint16_t method_id) {
-  switch (static_cast<AMQPTxMethods>(method_id)) {
-    case AMQPTxMethods::kAMQPTxSelect:
-      return ExtractAMQPTxSelect(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxSelectOk:
-      return ExtractAMQPTxSelectOk(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxCommit:
-      return ExtractAMQPTxCommit(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxCommitOk:
-      return ExtractAMQPTxCommitOk(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxRollback:
-      return ExtractAMQPTxRollback(decoder, req);
-
-    case AMQPTxMethods::kAMQPTxRollbackOk:
-      return ExtractAMQPTxRollbackOk(decoder, req);
-
-    default:
-      VLOG(1) << absl::Substitute("Invalid Tx frame method $0", method_id);
+  if (class_id % 10 == 0 && class_id / 10 < kNumClassSlots) {
+    MethodExtractFn extract_fn = kContentHeaderDispatchTable[class_id / 10];
+    if (extract_fn != nullptr) {
+      return extract_fn(decoder, req);
+    }
   }
+  VLOG(1) << absl::Substitute("Unparsed frame method class $0", class_id);
   return Status::OK();
 }
 
@@ -945,28 +825,13 @@ Status ProcessFrameMethod(BinaryDecoder* decoder, Frame* req) {
   req->class_id = class_id;
   req->method_id = method_id;
 
-  switch (static_cast<AMQPClasses>(class_id)) {
-    case AMQPClasses::kConnection:
-      return ProcessConnection(decoder, req, method_id);
-
-    case AMQPClasses::kChannel:
-      return ProcessChannel(decoder, req, method_id);
-
-    case AMQPClasses::kExchange:
-      return ProcessExchange(decoder, req, method_id);
-
-    case AMQPClasses::kQueue:
-      return ProcessQueue(decoder, req, method_id);
-
-    case AMQPClasses::kBasic:
-      return ProcessBasic(decoder, req, method_id);
-
-    case AMQPClasses::kTx:
-      return ProcessTx(decoder, req, method_id);
-
-    default:
-      VLOG(1) << absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
+  if (class_id % 10 == 0 && class_id / 10 < kNumClassSlots && method_id <= kMaxMethodId) {
+    MethodExtractFn extract_fn = kMethodDispatchTable[class_id / 10][method_id];
+    if (extract_fn != nullptr) {
+      return extract_fn(decoder, req);
+    }
   }
+  VLOG(1) << absl::Substitute("Unparsed frame method class $0 method $1", class_id, method_id);
   return Status::OK();
 }
 
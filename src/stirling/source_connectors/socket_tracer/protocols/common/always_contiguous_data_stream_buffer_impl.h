@@ -20,6 +20,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "src/stirling/source_connectors/socket_tracer/protocols/common/data_stream_buffer.h"
 
@@ -39,6 +40,15 @@ class AlwaysContiguousDataStreamBufferImpl : public DataStreamBufferImpl {
 
   std::string_view Head() override { return Get(position_); }
 
+  // The head is always stored contiguously, so the chunk list is at most one chunk.
+  std::vector<DataChunk> Chunks() override {
+    std::string_view head = Head();
+    if (head.empty()) {
+      return {};
+    }
+    return {DataChunk{position_, head}};
+  }
+
   StatusOr<uint64_t> GetTimestamp(size_t pos) const override;
 
   void RemovePrefix(ssize_t n) override;
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "src/common/base/base.h"
+
+// Vectorized scanners for frame-boundary resynchronization.
+//
+// After missed BPF events, FindFrameBoundary() implementations have to hunt for the next frame
+// start in potentially megabytes of unparsable bytes. The hot primitives for that hunt are
+// "first occurrence of any byte from a small set" (e.g. the RESP type markers for Redis) and
+// "first occurrence of a short pattern" (e.g. "\r\n\r\n" for HTTP). The helpers here process
+// the buffer 16/32 bytes at a time with SSE2/AVX2 when available, and fall back to a portable
+// scalar loop otherwise.
+
+namespace px {
+namespace stirling {
+namespace protocols {
+
+/**
+ * Returns the position of the first byte in buf (at or after start_pos) that matches any of the
+ * bytes in markers, or npos if there is no match. Equivalent to buf.find_first_of(markers,
+ * start_pos), but vectorized for small marker sets.
+ */
+inline size_t FindFirstByteOf(std::string_view buf, std::string_view markers, size_t start_pos) {
+  constexpr size_t kMaxMarkers = 16;
+  DCHECK_LE(markers.size(), kMaxMarkers);
+
+  if (start_pos >= buf.size() || markers.empty()) {
+    return std::string_view::npos;
+  }
+
+  const char* data = buf.data();
+  const size_t size = buf.size();
+  size_t i = start_pos;
+
+#if defined(__AVX2__)
+  __m256i marker_vecs[kMaxMarkers];
+  for (size_t m = 0; m < markers.size(); ++m) {
+    marker_vecs[m] = _mm256_set1_epi8(markers[m]);
+  }
+  for (; i + 32 <= size; i += 32) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    __m256i eq = _mm256_setzero_si256();
+    for (size_t m = 0; m < markers.size(); ++m) {
+      eq = _mm256_or_si256(eq, _mm256_cmpeq_epi8(block, marker_vecs[m]));
+    }
+    uint32_t mask = _mm256_movemask_epi8(eq);
+    if (mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+#elif defined(__SSE2__)
+  __m128i marker_vecs[kMaxMarkers];
+  for (size_t m = 0; m < markers.size(); ++m) {
+    marker_vecs[m] = _mm_set1_epi8(markers[m]);
+  }
+  for (; i + 16 <= size; i += 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    __m128i eq = _mm_setzero_si128();
+    for (size_t m = 0; m < markers.size(); ++m) {
+      eq = _mm_or_si128(eq, _mm_cmpeq_epi8(block, marker_vecs[m]));
+    }
+    uint32_t mask = _mm_movemask_epi8(eq);
+    if (mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+#endif
+
+  for (; i < size; ++i) {
+    if (markers.find(data[i]) != std::string_view::npos) {
+      return i;
+    }
+  }
+  return std::string_view::npos;
+}
+
+/**
+ * Returns the position of the first occurrence of pattern in buf at or after start_pos, or npos
+ * if there is no occurrence. Equivalent to buf.find(pattern, start_pos), but scans for candidate
+ * positions of the pattern's first byte with SIMD before verifying the remainder.
+ */
+inline size_t FindSubstr(std::string_view buf, std::string_view pattern, size_t start_pos) {
+  if (pattern.empty()) {
+    return (start_pos <= buf.size()) ? start_pos : std::string_view::npos;
+  }
+  if (buf.size() < pattern.size() || start_pos > buf.size() - pattern.size()) {
+    return std::string_view::npos;
+  }
+
+  const char* data = buf.data();
+  // Last position at which the pattern could still fit.
+  const size_t last_pos = buf.size() - pattern.size();
+  size_t i = start_pos;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+  auto verify = [&](size_t pos) {
+    return pos <= last_pos && memcmp(data + pos, pattern.data(), pattern.size()) == 0;
+  };
+#endif
+
+#if defined(__AVX2__)
+  const __m256i first_vec = _mm256_set1_epi8(pattern.front());
+  for (; i + 32 <= buf.size(); i += 32) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    uint32_t mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, first_vec));
+    while (mask != 0) {
+      size_t pos = i + __builtin_ctz(mask);
+      if (verify(pos)) {
+        return pos;
+      }
+      mask &= mask - 1;
+    }
+  }
+#elif defined(__SSE2__)
+  const __m128i first_vec = _mm_set1_epi8(pattern.front());
+  for (; i + 16 <= buf.size(); i += 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, first_vec));
+    while (mask != 0) {
+      size_t pos = i + __builtin_ctz(mask);
+      if (verify(pos)) {
+        return pos;
+      }
+      mask &= mask - 1;
+    }
+  }
+#endif
+
+  // Scalar tail (and full scan when no SIMD is available).
+  size_t pos = buf.find(pattern, i);
+  return (pos == std::string_view::npos) ? std::string_view::npos : pos;
+}
+
+}  // namespace protocols
+}  // namespace stirling
+}  // namespace px
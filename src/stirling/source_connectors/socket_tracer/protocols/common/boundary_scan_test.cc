@@ -0,0 +1,95 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/source_connectors/socket_tracer/protocols/common/boundary_scan.h"
+
+#include <string>
+
+#include "src/common/testing/testing.h"
+
+namespace px {
+namespace stirling {
+namespace protocols {
+
+constexpr std::string_view kRespMarkers = "+-:$*";
+
+TEST(FindFirstByteOfTest, MatchesScalarSemantics) {
+  // Short buffers exercise the scalar tail; long buffers exercise the vectorized blocks.
+  std::string buf(100, 'x');
+  buf[0] = '*';
+  buf[37] = '$';
+  buf[99] = '+';
+
+  EXPECT_EQ(FindFirstByteOf(buf, kRespMarkers, 0), 0);
+  EXPECT_EQ(FindFirstByteOf(buf, kRespMarkers, 1), 37);
+  EXPECT_EQ(FindFirstByteOf(buf, kRespMarkers, 37), 37);
+  EXPECT_EQ(FindFirstByteOf(buf, kRespMarkers, 38), 99);
+  EXPECT_EQ(FindFirstByteOf(buf, kRespMarkers, 99), 99);
+  EXPECT_EQ(FindFirstByteOf(buf, kRespMarkers, 100), std::string_view::npos);
+
+  // Cross-check against the STL implementation at every start position.
+  for (size_t start_pos = 0; start_pos <= buf.size(); ++start_pos) {
+    EXPECT_EQ(FindFirstByteOf(buf, kRespMarkers, start_pos),
+              std::string_view(buf).find_first_of(kRespMarkers, start_pos))
+        << "start_pos=" << start_pos;
+  }
+}
+
+TEST(FindFirstByteOfTest, NoMatch) {
+  std::string buf(100, 'x');
+  EXPECT_EQ(FindFirstByteOf(buf, kRespMarkers, 0), std::string_view::npos);
+  EXPECT_EQ(FindFirstByteOf("", kRespMarkers, 0), std::string_view::npos);
+  EXPECT_EQ(FindFirstByteOf(buf, "", 0), std::string_view::npos);
+}
+
+TEST(FindSubstrTest, MatchesScalarSemantics) {
+  constexpr std::string_view kMarker = "\r\n\r\n";
+
+  std::string buf(200, 'x');
+  // Lone '\r' bytes that must not match.
+  buf[10] = '\r';
+  buf[50] = '\r';
+  buf.replace(70, kMarker.size(), kMarker);
+  buf.replace(196, kMarker.size(), kMarker);
+
+  EXPECT_EQ(FindSubstr(buf, kMarker, 0), 70);
+  EXPECT_EQ(FindSubstr(buf, kMarker, 70), 70);
+  EXPECT_EQ(FindSubstr(buf, kMarker, 71), 196);
+  EXPECT_EQ(FindSubstr(buf, kMarker, 197), std::string_view::npos);
+
+  for (size_t start_pos = 0; start_pos <= buf.size(); ++start_pos) {
+    EXPECT_EQ(FindSubstr(buf, kMarker, start_pos),
+              std::string_view(buf).find(kMarker, start_pos))
+        << "start_pos=" << start_pos;
+  }
+}
+
+TEST(FindSubstrTest, EdgeCases) {
+  EXPECT_EQ(FindSubstr("abc", "", 1), 1);
+  EXPECT_EQ(FindSubstr("abc", "abcd", 0), std::string_view::npos);
+  EXPECT_EQ(FindSubstr("abc", "c", 0), 2);
+  EXPECT_EQ(FindSubstr("abc", "abc", 0), 0);
+  // Pattern at the very end of a buffer larger than one SIMD block.
+  std::string buf(64, 'y');
+  buf.replace(62, 2, "ab");
+  EXPECT_EQ(FindSubstr(buf, "ab", 0), 62);
+}
+
+}  // namespace protocols
+}  // namespace stirling
+}  // namespace px
@@ -23,6 +23,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "src/common/base/base.h"
 
@@ -32,6 +33,13 @@ namespace px {
 namespace stirling {
 namespace protocols {
 
+// A contiguous run of bytes at a known logical position in the stream.
+// A chunk's data view is only valid until the buffer is next mutated.
+struct DataChunk {
+  size_t pos = 0;
+  std::string_view data;
+};
+
 // TODO(james): switch back to concrete DataStreamBuffer (or standard abstract class) once we've
 // settled on a DataStreamBuffer implementation.
 class DataStreamBufferImpl {
@@ -39,6 +47,7 @@ class DataStreamBufferImpl {
   virtual ~DataStreamBufferImpl() = default;
   virtual void Add(size_t pos, std::string_view data, uint64_t timestamp) = 0;
   virtual std::string_view Head() = 0;
+  virtual std::vector<DataChunk> Chunks() = 0;
   virtual StatusOr<uint64_t> GetTimestamp(size_t pos) const = 0;
   virtual void RemovePrefix(ssize_t n) = 0;
   virtual void Trim() = 0;
@@ -90,6 +99,27 @@ class DataStreamBuffer {
    */
   std::string_view Head() { return impl_->Head(); }
 
+  /**
+   * Get the same contiguous data as Head(), but as a list of chunks (iovec-style views),
+   * without requiring the implementation to materialize the data into one piece.
+   * For implementations that store events separately, this avoids the bulk copy that Head()
+   * performs, at the cost of the caller having to handle data that straddles chunk boundaries.
+   * @return The chunks, in stream order. Concatenated, they equal Head().
+   */
+  std::vector<DataChunk> Chunks() { return impl_->Chunks(); }
+
+  /**
+   * Size of the contiguous data at the head of the buffer.
+   * Equal to Head().size(), but does not force the data to be materialized contiguously.
+   */
+  size_t ContiguousHeadSize() {
+    size_t size = 0;
+    for (const auto& chunk : impl_->Chunks()) {
+      size += chunk.data.size();
+    }
+    return size;
+  }
+
   /**
    * Get timestamp recorded for the data at the specified position.
    * @param pos The logical position of the data.
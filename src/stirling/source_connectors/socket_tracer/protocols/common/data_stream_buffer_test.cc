@@ -180,6 +180,41 @@ TEST_P(DataStreamBufferTest, TimestampWithGap) {
   EXPECT_OK_AND_EQ(stream_buffer.GetTimestamp(13), 10);
 }
 
+TEST_P(DataStreamBufferTest, Chunks) {
+  DataStreamBuffer stream_buffer(15, 15, 15);
+
+  // Initially there are no chunks.
+  EXPECT_TRUE(stream_buffer.Chunks().empty());
+  EXPECT_EQ(stream_buffer.ContiguousHeadSize(), 0);
+
+  stream_buffer.Add(0, "0123", 0);
+  stream_buffer.Add(4, "45", 4);
+  // Leave a gap; the chunk list should only cover the contiguous head.
+  stream_buffer.Add(8, "89", 8);
+
+  std::vector<DataChunk> chunks = stream_buffer.Chunks();
+  ASSERT_FALSE(chunks.empty());
+  EXPECT_EQ(chunks.front().pos, 0);
+
+  // Concatenated, the chunks must equal the contiguous head.
+  std::string contents;
+  size_t expected_pos = 0;
+  for (const auto& chunk : chunks) {
+    EXPECT_EQ(chunk.pos, expected_pos);
+    contents.append(chunk.data);
+    expected_pos += chunk.data.size();
+  }
+  EXPECT_EQ(contents, "012345");
+  EXPECT_EQ(stream_buffer.ContiguousHeadSize(), 6);
+
+  // Timestamps must be resolvable for chunked data, without materializing the head.
+  EXPECT_OK_AND_EQ(stream_buffer.GetTimestamp(3), 0);
+  EXPECT_OK_AND_EQ(stream_buffer.GetTimestamp(5), 4);
+
+  // The chunk list matches what Head() materializes.
+  EXPECT_EQ(stream_buffer.Head(), "012345");
+}
+
 TEST_P(DataStreamBufferTest, SizeAndGetPos) {
   DataStreamBuffer stream_buffer(15, 15, 15);
 
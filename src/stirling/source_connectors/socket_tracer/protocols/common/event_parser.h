@@ -96,10 +96,108 @@ struct ParseResult {
  *
  * @return ParseResult with locations where parseable frames were found in the source buffer.
  */
+/**
+ * Parses frames directly out of a list of contiguous chunks (iovec-style views) of the
+ * data stream buffer, without requiring the buffer to materialize the data into one piece.
+ *
+ * Frames that fit entirely within a single chunk are parsed in place. Only when a frame
+ * straddles a chunk boundary are its bytes copied into a scratch buffer to provide the
+ * contiguity that ParseFrame() requires. For protocols whose frames typically fit within a
+ * single event (e.g. Redis, HTTP), this eliminates the bulk-copy performed by Head() on
+ * buffer implementations that store events separately.
+ *
+ * Note: This is a helper for ParseFrames(); positions in the returned ParseResult are relative
+ * to the position of the first chunk, matching the semantics of the contiguous version.
+ */
+template <typename TFrameType, typename TStateType = NoState>
+ParseResult ParseFramesFromChunks(message_type_t type, DataStreamBuffer* data_stream_buffer,
+                                  const std::vector<DataChunk>& chunks,
+                                  std::deque<TFrameType>* frames, TStateType* state = nullptr) {
+  DCHECK(!chunks.empty());
+  const size_t base_pos = chunks.front().pos;
+
+  // Grab size before we start, so we know where the new parsed frames are.
+  const size_t prev_size = frames->size();
+
+  ParseResult result;
+  result.end_position = 0;
+  result.invalid_frames = 0;
+  result.frame_bytes = 0;
+
+  // Materialization buffer for a frame that straddles chunk boundaries.
+  // It holds the unconsumed tail of previous chunks, and grows one chunk at a time until the
+  // frame completes (or the data runs out).
+  std::string scratch;
+
+  // Stream position of the first byte of the buffer currently being parsed.
+  size_t parse_start_pos = base_pos;
+
+  for (const auto& chunk : chunks) {
+    std::string_view buf;
+    if (scratch.empty()) {
+      buf = chunk.data;
+      parse_start_pos = chunk.pos;
+    } else {
+      scratch.append(chunk.data);
+      buf = scratch;
+    }
+
+    ParseResult chunk_result = ParseFramesLoop(type, buf, frames, state);
+
+    const size_t offset = parse_start_pos - base_pos;
+    for (auto& f : chunk_result.frame_positions) {
+      f.start += offset;
+      f.end += offset;
+      result.frame_positions.push_back(f);
+    }
+    result.end_position = offset + chunk_result.end_position;
+    result.state = chunk_result.state;
+    result.invalid_frames += chunk_result.invalid_frames;
+    result.frame_bytes += chunk_result.frame_bytes;
+
+    if (chunk_result.state == ParseState::kEOS) {
+      break;
+    }
+
+    // Carry any unconsumed bytes (a partial frame) into the next iteration.
+    const size_t leftover = buf.size() - chunk_result.end_position;
+    if (leftover > 0) {
+      if (scratch.empty()) {
+        scratch.assign(buf.substr(chunk_result.end_position));
+      } else {
+        scratch.erase(0, chunk_result.end_position);
+      }
+      parse_start_pos += chunk_result.end_position;
+    } else {
+      scratch.clear();
+    }
+  }
+
+  // Match timestamps with the parsed frames.
+  for (size_t i = 0; i < result.frame_positions.size(); ++i) {
+    auto& f = result.frame_positions[i];
+    auto& msg = (*frames)[prev_size + i];
+    StatusOr<uint64_t> timestamp_ns_status = data_stream_buffer->GetTimestamp(base_pos + f.end);
+    LOG_IF(ERROR, !timestamp_ns_status.ok()) << timestamp_ns_status.ToString();
+    msg.timestamp_ns = timestamp_ns_status.ValueOr(0);
+  }
+
+  return result;
+}
+
 template <typename TFrameType, typename TStateType = NoState>
 ParseResult ParseFrames(message_type_t type, DataStreamBuffer* data_stream_buffer,
                         std::deque<TFrameType>* frames, bool resync = false,
                         TStateType* state = nullptr) {
+  // Resynchronization scans for a frame boundary across the whole contiguous head, so it needs a
+  // materialized view. It is a rare recovery path, so the cost of Head() is acceptable there.
+  if (!resync) {
+    std::vector<DataChunk> chunks = data_stream_buffer->Chunks();
+    if (!chunks.empty()) {
+      return ParseFramesFromChunks(type, data_stream_buffer, chunks, frames, state);
+    }
+  }
+
   std::string_view buf = data_stream_buffer->Head();
 
   size_t start_pos = 0;
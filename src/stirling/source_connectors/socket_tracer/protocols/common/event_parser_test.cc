@@ -99,6 +99,51 @@ TEST_F(EventParserTest, BasicProtocolParsing) {
   EXPECT_THAT(timestamps, ElementsAre(0, 1, 1, 2, 3, 4));
 }
 
+// Runs the same parse as BasicProtocolParsing, but on the lazy buffer implementation, where
+// ParseFrames() consumes the individual events as a chunk list instead of merging them into a
+// contiguous head. Frames that straddle event boundaries (e.g. "satu" + "rn") are materialized
+// contiguously; all others are parsed in place.
+TEST_F(EventParserTest, ChunkedParsingOnLazyBuffer) {
+  bool old_flag_val = FLAGS_stirling_data_stream_buffer_always_contiguous_buffer;
+  FLAGS_stirling_data_stream_buffer_always_contiguous_buffer = false;
+
+  {
+    DataStreamBuffer data_buffer(kDataBufferSize, kMaxGapSize, kAllowBeforeGapSize);
+    std::deque<TestFrame> word_frames;
+
+    // clang-format off
+    std::vector<std::string> event_messages = {
+            "jupiter,satu",
+            "rn,neptune,uranus",
+            ",",
+            "pluto,",
+            "mercury,"
+    };
+    // clang-format on
+
+    std::vector<SocketDataEvent> events = CreateEvents(event_messages);
+    for (const auto& event : events) {
+      data_buffer.Add(event.attr.pos, event.msg, event.attr.timestamp_ns);
+    }
+
+    ParseResult res = ParseFrames(message_type_t::kRequest, &data_buffer, &word_frames);
+
+    EXPECT_EQ(ParseState::kSuccess, res.state);
+    EXPECT_THAT(res.frame_positions,
+                ElementsAre(StartEndPos{0, 7}, StartEndPos{8, 14}, StartEndPos{15, 22},
+                            StartEndPos{23, 29}, StartEndPos{30, 35}, StartEndPos{36, 43}));
+    EXPECT_EQ(res.end_position, 44);
+
+    std::vector<uint64_t> timestamps;
+    for (const auto& frame : word_frames) {
+      timestamps.push_back(frame.timestamp_ns);
+    }
+    EXPECT_THAT(timestamps, ElementsAre(0, 1, 1, 2, 3, 4));
+  }
+
+  FLAGS_stirling_data_stream_buffer_always_contiguous_buffer = old_flag_val;
+}
+
 // TODO(oazizi): Move any protocol specific tests that check for general EventParser behavior here.
 // Should help reduce duplication of tests.
 
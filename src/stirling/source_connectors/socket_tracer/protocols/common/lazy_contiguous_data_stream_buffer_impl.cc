@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "src/common/base/utils.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/common/lazy_contiguous_data_stream_buffer_impl.h"
@@ -174,21 +175,49 @@ std::string_view LazyContiguousDataStreamBufferImpl::Head() {
   return head_->StringView();
 }
 
+std::vector<DataChunk> LazyContiguousDataStreamBufferImpl::Chunks() {
+  std::vector<DataChunk> chunks;
+
+  size_t expected_pos;
+  if (head_ != nullptr) {
+    chunks.push_back(DataChunk{head_position_, head_->StringView()});
+    expected_pos = head_position_ + head_->Size();
+  } else {
+    if (events_.empty()) {
+      return chunks;
+    }
+    // Mirror Head()'s contract: advance the head position to the first event, so that position()
+    // is valid after this call.
+    head_position_ = FirstEventPos();
+    expected_pos = head_position_;
+  }
+
+  for (auto it = events_.begin(); it != events_.end() && it->first == expected_pos; ++it) {
+    chunks.push_back(DataChunk{it->first, std::string_view(it->second.data)});
+    expected_pos += it->second.data.size();
+  }
+
+  return chunks;
+}
+
 StatusOr<uint64_t> LazyContiguousDataStreamBufferImpl::GetTimestamp(size_t pos) const {
   // This slightly differs from the API of the AlwaysContiguousDataStreamBuffer, in that we only
-  // allow getting the timestamp from the contiguous region given by Head(). This will be fine based
-  // on current usage of GetTimestamp().
-  if (head_ == nullptr) {
-    return error::Internal("Specified position not found");
-  }
-  if (pos >= head_position_ + head_->Size() || pos < head_position_) {
-    return error::Internal("Specified position not found");
+  // allow getting the timestamp from the region covered by Head()/Chunks(). This will be fine
+  // based on current usage of GetTimestamp().
+  if (head_ != nullptr && pos >= head_position_ && pos < head_position_ + head_->Size()) {
+    auto it = Floor(head_pos_to_ts_, pos);
+    if (it == head_pos_to_ts_.end()) {
+      return error::Internal("Specified position not found");
+    }
+    return it->second;
   }
-  auto it = Floor(head_pos_to_ts_, pos);
-  if (it == head_pos_to_ts_.end()) {
-    return error::Internal("Specified position not found");
+  // Positions beyond the head may still be covered by events that have not been merged.
+  // This happens when data is consumed chunk-by-chunk via Chunks() instead of Head().
+  auto it = Floor(events_, pos);
+  if (it != events_.end() && pos < it->first + it->second.data.size()) {
+    return it->second.timestamp;
   }
-  return it->second;
+  return error::Internal("Specified position not found");
 }
 
 void LazyContiguousDataStreamBufferImpl::RemovePrefix(ssize_t n) {
@@ -23,6 +23,7 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "src/common/base/mixins.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/common/data_stream_buffer.h"
@@ -72,6 +73,10 @@ class LazyContiguousDataStreamBufferImpl : public DataStreamBufferImpl {
 
   std::string_view Head() override;
 
+  // Returns the contiguous run at the head of the buffer as a list of chunks, without merging
+  // the underlying events. This avoids the bulk memcpy performed by Head().
+  std::vector<DataChunk> Chunks() override;
+
   StatusOr<uint64_t> GetTimestamp(size_t pos) const override;
 
   void RemovePrefix(ssize_t n) override;
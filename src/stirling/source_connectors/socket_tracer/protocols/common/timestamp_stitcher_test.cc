@@ -32,7 +32,7 @@ Message HTTPReq0Message() {
   Message msg;
   msg.type = message_type_t::kRequest;
   msg.minor_version = 1;
-  msg.headers = {{"Host", "www.pixielabs.ai"},
+  *msg.mutable_headers() = {{"Host", "www.pixielabs.ai"},
                  {"Accept", "image/gif, image/jpeg, */*"},
                  {"User-Agent", "Mozilla/5.0 (X11; Linux x86_64)"}};
   msg.req_method = "GET";
@@ -46,7 +46,7 @@ Message HTTPReq1Message() {
   Message msg;
   msg.type = message_type_t::kRequest;
   msg.minor_version = 1;
-  msg.headers = {{"Host", "www.pixielabs.ai"},
+  *msg.mutable_headers() = {{"Host", "www.pixielabs.ai"},
                  {"Accept", "image/gif, image/jpeg, */*"},
                  {"User-Agent", "Mozilla/5.0 (X11; Linux x86_64)"}};
   msg.req_method = "GET";
@@ -60,7 +60,7 @@ Message HTTPReq2Message() {
   Message msg;
   msg.type = message_type_t::kRequest;
   msg.minor_version = 1;
-  msg.headers = {{"host", "pixielabs.ai"},
+  *msg.mutable_headers() = {{"host", "pixielabs.ai"},
                  {"content-type", "application/x-www-form-urlencoded"},
                  {"content-length", "27"}};
   msg.req_method = "POST";
@@ -74,7 +74,7 @@ Message HTTPResp0Message() {
   Message msg;
   msg.type = message_type_t::kResponse;
   msg.minor_version = 1;
-  msg.headers = {{"Content-Type", "foo"}, {"Content-Length", "9"}};
+  *msg.mutable_headers() = {{"Content-Type", "foo"}, {"Content-Length", "9"}};
   msg.resp_status = 200;
   msg.resp_message = "OK";
   msg.body = "msg0";
@@ -86,7 +86,7 @@ Message HTTPResp1Message() {
   Message msg;
   msg.type = message_type_t::kResponse;
   msg.minor_version = 1;
-  msg.headers = {{"Content-Type", "bar"}, {"Content-Length", "21"}};
+  *msg.mutable_headers() = {{"Content-Type", "bar"}, {"Content-Length", "21"}};
   msg.resp_status = 200;
   msg.resp_message = "OK";
   msg.body = "msg1";
@@ -98,7 +98,7 @@ Message HTTPResp2Message() {
   Message msg;
   msg.type = message_type_t::kResponse;
   msg.minor_version = 1;
-  msg.headers = {{"Transfer-Encoding", "chunked"}};
+  *msg.mutable_headers() = {{"Transfer-Encoding", "chunked"}};
   msg.resp_status = 200;
   msg.resp_message = "OK";
   msg.body = "msg2";
@@ -48,10 +48,10 @@ StatusOr<TFloatType> ExtractFloatCore(std::string_view* buf) {
 }
 
 template <typename TCharType>
-StatusOr<std::basic_string<TCharType>> FrameBodyDecoder::ExtractBytesCore(int64_t len) {
-  PL_ASSIGN_OR_RETURN(std::basic_string_view<TCharType> tbuf,
-                      binary_decoder_.ExtractString<TCharType>(len));
-  return std::basic_string<TCharType>(tbuf);
+StatusOr<std::basic_string_view<TCharType>> FrameBodyDecoder::ExtractBytesCore(int64_t len) {
+  // Return a view into the frame body rather than a copy. The frame outlives the decoded structs,
+  // so the view remains valid until the frame is released.
+  return binary_decoder_.ExtractString<TCharType>(len);
 }
 
 template <typename TCharType, size_t N>
@@ -81,13 +81,13 @@ StatusOr<float> ExtractFloat(std::string_view* buf) { return ExtractFloatCore<fl
 StatusOr<double> ExtractDouble(std::string_view* buf) { return ExtractFloatCore<double>(buf); }
 
 // [string] A [short] n, followed by n bytes representing an UTF-8 string.
-StatusOr<std::string> FrameBodyDecoder::ExtractString() {
+StatusOr<std::string_view> FrameBodyDecoder::ExtractString() {
   PL_ASSIGN_OR_RETURN(uint16_t len, ExtractShort());
   return ExtractBytesCore<char>(len);
 }
 
 // [long string] An [int] n, followed by n bytes representing an UTF-8 string.
-StatusOr<std::string> FrameBodyDecoder::ExtractLongString() {
+StatusOr<std::string_view> FrameBodyDecoder::ExtractLongString() {
   PL_ASSIGN_OR_RETURN(int32_t len, ExtractInt());
   len = std::max(len, 0);
   return ExtractBytesCore<char>(len);
@@ -134,9 +134,10 @@ StatusOr<StringList> FrameBodyDecoder::ExtractStringList() {
   PL_ASSIGN_OR_RETURN(uint16_t n, ExtractShort());
 
   StringList string_list;
+  string_list.reserve(n);
   for (int i = 0; i < n; ++i) {
-    PL_ASSIGN_OR_RETURN(std::string s, ExtractString());
-    string_list.push_back(std::move(s));
+    PL_ASSIGN_OR_RETURN(std::string_view s, ExtractString());
+    string_list.push_back(s);
   }
 
   return string_list;
@@ -144,7 +145,7 @@ StatusOr<StringList> FrameBodyDecoder::ExtractStringList() {
 
 // [bytes] A [int] n, followed by n bytes if n >= 0. If n < 0,
 //         no byte should follow and the value represented is `null`.
-StatusOr<std::basic_string<uint8_t>> FrameBodyDecoder::ExtractBytes() {
+StatusOr<std::basic_string_view<uint8_t>> FrameBodyDecoder::ExtractBytes() {
   PL_ASSIGN_OR_RETURN(int32_t len, ExtractInt());
   len = std::max(len, 0);
   return ExtractBytesCore<uint8_t>(len);
@@ -154,14 +155,14 @@ StatusOr<std::basic_string<uint8_t>> FrameBodyDecoder::ExtractBytes() {
 //         If n == -1 no byte should follow and the value represented is `null`.
 //         If n == -2 no byte should follow and the value represented is
 //         `not set` not resulting in any change to the existing value.
-StatusOr<std::basic_string<uint8_t>> FrameBodyDecoder::ExtractValue() {
+StatusOr<std::basic_string_view<uint8_t>> FrameBodyDecoder::ExtractValue() {
   PL_ASSIGN_OR_RETURN(int32_t len, ExtractInt());
   if (len == -1) {
-    return std::basic_string<uint8_t>();
+    return std::basic_string_view<uint8_t>();
   }
   if (len == -2) {
     // TODO(oazizi): Need to send back 'not set' instead.
-    return std::basic_string<uint8_t>();
+    return std::basic_string_view<uint8_t>();
   }
   if (len < 0) {
     return error::Internal("Invalid length for value.");
@@ -170,7 +171,7 @@ StatusOr<std::basic_string<uint8_t>> FrameBodyDecoder::ExtractValue() {
 }
 
 // [short bytes]  A [short] n, followed by n bytes if n >= 0.
-StatusOr<std::basic_string<uint8_t>> FrameBodyDecoder::ExtractShortBytes() {
+StatusOr<std::basic_string_view<uint8_t>> FrameBodyDecoder::ExtractShortBytes() {
   PL_ASSIGN_OR_RETURN(uint16_t len, ExtractShort());
   return ExtractBytesCore<uint8_t>(len);
 }
@@ -210,9 +211,9 @@ StatusOr<StringMap> FrameBodyDecoder::ExtractStringMap() {
 
   StringMap string_map;
   for (int i = 0; i < n; ++i) {
-    PL_ASSIGN_OR_RETURN(std::string key, ExtractString());
-    PL_ASSIGN_OR_RETURN(std::string val, ExtractString());
-    string_map.insert({std::move(key), std::move(val)});
+    PL_ASSIGN_OR_RETURN(std::string_view key, ExtractString());
+    PL_ASSIGN_OR_RETURN(std::string_view val, ExtractString());
+    string_map.insert({key, val});
   }
 
   return string_map;
@@ -225,9 +226,9 @@ StatusOr<StringMultiMap> FrameBodyDecoder::ExtractStringMultiMap() {
 
   StringMultiMap string_multimap;
   for (int i = 0; i < n; ++i) {
-    PL_ASSIGN_OR_RETURN(std::string key, ExtractString());
+    PL_ASSIGN_OR_RETURN(std::string_view key, ExtractString());
     PL_ASSIGN_OR_RETURN(StringList val, ExtractStringList());
-    string_multimap.insert({std::move(key), std::move(val)});
+    string_multimap.insert({key, std::move(val)});
   }
 
   return string_multimap;
@@ -272,6 +273,7 @@ StatusOr<std::vector<NameValuePair>> FrameBodyDecoder::ExtractNameValuePairList(
   std::vector<NameValuePair> values;
 
   PL_ASSIGN_OR_RETURN(uint16_t n, ExtractShort());
+  values.reserve(n);
   for (int i = 0; i < n; ++i) {
     PL_ASSIGN_OR_RETURN(NameValuePair v, ExtractNameValuePair(with_names));
     values.push_back(std::move(v));
@@ -138,10 +138,11 @@ Status ProcessBatchReq(Frame* req_frame, Request* req) {
   for (const auto& q : r.queries) {
     switch (q.kind) {
       case BatchQueryKind::kString:
-        tmp.push_back({"query", std::move(std::get<std::string>(q.query_or_id))});
+        tmp.push_back({"query", std::string(std::get<std::string_view>(q.query_or_id))});
         break;
       case BatchQueryKind::kID:
-        tmp.push_back({"id", BytesToString(std::get<std::basic_string<uint8_t>>(q.query_or_id))});
+        tmp.push_back(
+            {"id", BytesToString(std::get<std::basic_string_view<uint8_t>>(q.query_or_id))});
         break;
       default:
         LOG(DFATAL) << absl::Substitute("Unrecognized BatchQueryKind $0", static_cast<int>(q.kind));
@@ -183,7 +184,7 @@ Status ProcessAuthenticateResp(Frame* resp_frame, Response* resp) {
   PL_ASSIGN_OR_RETURN(AuthenticateResp r, ParseAuthenticateResp(resp_frame));
 
   DCHECK(resp->msg.empty());
-  resp->msg = std::move(r.authenticator_name);
+  resp->msg = r.authenticator_name;
 
   return Status::OK();
 }
@@ -226,9 +227,10 @@ Status ProcessResultResp(Frame* resp_frame, Response* resp) {
       // Copy to vector so we can use ToJSONString().
       // TODO(oazizi): Find a cleaner way. This is temporary anyways.
 
-      std::vector<std::string> names;
-      for (auto& c : r_resp.metadata.col_specs) {
-        names.push_back(std::move(c.name));
+      std::vector<std::string_view> names;
+      names.reserve(r_resp.metadata.col_specs.size());
+      for (const auto& c : r_resp.metadata.col_specs) {
+        names.push_back(c.name);
       }
 
       resp->msg = absl::StrCat("Response type = ROWS\n",
@@ -38,23 +38,34 @@ namespace dns {
 
 class PxDnsParserListener : public DnsParserListener {
  public:
+  // Names are interned in the frame's per-message pool, so repeated names across records
+  // (e.g. many answers for the same query name, or CNAME chains) share one copy.
+  explicit PxDnsParserListener(Frame* frame) : frame_(frame) {}
+
   void onDnsRec(std::string name, in_addr addr) override {
-    records_.emplace_back(DNSRecord{std::move(name), "", {InetAddrFamily::kIPv4, addr}});
+    records_.emplace_back(
+        DNSRecord{frame_->InternName(std::move(name)), "", {InetAddrFamily::kIPv4, addr}});
   }
   void onDnsRec(std::string name, in6_addr addr) override {
-    records_.emplace_back(DNSRecord{std::move(name), "", {InetAddrFamily::kIPv6, addr}});
+    records_.emplace_back(
+        DNSRecord{frame_->InternName(std::move(name)), "", {InetAddrFamily::kIPv6, addr}});
   }
   void onDnsRec(std::string name, std::string cname) override {
-    records_.emplace_back(DNSRecord{std::move(name), std::move(cname), {}});
+    records_.emplace_back(DNSRecord{frame_->InternName(std::move(name)),
+                                    frame_->InternName(std::move(cname)),
+                                    {}});
   }
 
   std::vector<DNSRecord> records_;
+
+ private:
+  Frame* frame_;
 };
 
 ParseState ParseFrame(message_type_t type, std::string_view* buf, Frame* result) {
   PL_UNUSED(type);
 
-  PxDnsParserListener response_handler;
+  PxDnsParserListener response_handler(result);
   std::unique_ptr<DnsParser> parser = DnsParserNew(&response_handler);
   int retval = parser->parse(buf->data(), buf->length());
   if (retval == -1) {
@@ -97,7 +97,7 @@ void ProcessReq(const Frame& req_frame, Request* req) {
 
   rapidjson::Value queries(rapidjson::kArrayType);
   for (const auto& r : req_frame.records()) {
-    const std::string& name = r.name;
+    std::string_view name = r.name;
     std::string_view type_name = DNSRecordTypeName(r.addr.family);
 
     rapidjson::Value query(rapidjson::kObjectType);
@@ -129,7 +129,7 @@ void ProcessResp(const Frame& resp_frame, Response* resp) {
 
   rapidjson::Value answers(rapidjson::kArrayType);
   for (const auto& r : resp_frame.records()) {
-    const std::string& name = r.name;
+    std::string_view name = r.name;
     std::string_view type_name;
 
     rapidjson::Value answer(rapidjson::kObjectType);
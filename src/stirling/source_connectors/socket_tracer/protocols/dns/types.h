@@ -20,7 +20,9 @@
 
 #include <chrono>
 #include <optional>
+#include <set>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -83,13 +85,15 @@ constexpr int kRcodeWidth = 4;
 // A DNSRecord represents a DNS resource record
 // Typically it is the answer to a query (e.g. from name->addr).
 // Spec: https://www.ietf.org/rfc/rfc1035.txt
+// The name and cname views point into the name pool of the Frame that owns the record
+// (see Frame::InternName), or into storage that outlives the record (e.g. literals in tests).
 struct DNSRecord {
-  std::string name;
+  std::string_view name;
 
   // cname and addr are mutually exclusive.
   // Either a record provdes a cname (an alias to another record), or it resolves the address.
   // TODO(oazizi): Consider using std::variant.
-  std::string cname;
+  std::string_view cname;
   InetAddr addr;
 };
 
@@ -98,6 +102,15 @@ struct Frame : public FrameBase {
   const std::vector<DNSRecord>& records() const { return records_; }
   bool consumed = false;
 
+  // Interns a name in the per-frame pool, returning a stable view of it.
+  // Names repeat heavily within a DNS message (e.g. all answers carrying the query name),
+  // so pooling makes name storage scale with the number of unique names in the message
+  // rather than the number of records.
+  std::string_view InternName(std::string name) {
+    auto iter = name_pool_.insert(std::move(name)).first;
+    return *iter;
+  }
+
   void AddRecords(std::vector<DNSRecord>&& records) {
     for (const auto& r : records) {
       records_size_ += r.name.size() + r.cname.size() + sizeof(r.addr);
@@ -109,6 +122,9 @@ struct Frame : public FrameBase {
 
  private:
   std::vector<DNSRecord> records_;
+  // Pool of deduplicated name strings referenced by records_.
+  // std::set is node-based, so views into pooled strings stay valid as the pool grows.
+  std::set<std::string> name_pool_;
   size_t records_size_ = 0;
 };
 
@@ -24,6 +24,8 @@
 #include <utility>
 #include <vector>
 
+#include "src/common/base/byte_utils.h"
+
 DEFINE_bool(use_pico_chunked_decoder, false,
             "If true, uses picohttpparser's chunked decoder; otherwise uses our custom decoder.");
 
@@ -247,8 +249,9 @@ ParseState ParseChunked(std::string_view* data, size_t body_size_limit_bytes, st
 
 ParseState ParseContent(std::string_view content_len_str, std::string_view* data,
                         size_t body_size_limit_bytes, std::string* result, size_t* body_size) {
+  // Converted with the SWAR decimal parser from byte_utils, since this runs per message.
   size_t len;
-  if (!absl::SimpleAtoi(content_len_str, &len)) {
+  if (!utils::DecimalStrToInt(content_len_str, &len)) {
     LOG(ERROR) << absl::Substitute("Unable to parse Content-Length: $0", content_len_str);
     return ParseState::kInvalid;
   }
@@ -22,9 +22,12 @@
 #include <picohttpparser.h>
 
 #include <algorithm>
+#include <optional>
 #include <string>
 #include <utility>
 
+#include "src/stirling/source_connectors/socket_tracer/protocols/common/boundary_scan.h"
+
 DEFINE_int32(http_body_limit_bytes, 1024,
              "The amount of an HTTP body that will be returned on a parse");
 
@@ -74,12 +77,25 @@ int ParseResponse(std::string_view buf, HTTPResponse* result) {
                             /*last_len*/ 0);
 }
 
-HeadersMap GetHTTPHeadersMap(const phr_header* headers, size_t num_headers) {
-  HeadersMap result;
+// Copies the headers into a single raw block of "Name: value" CRLF lines.
+// This is one allocation for the whole block, instead of two strings plus a map node per header;
+// the HeadersMap form is materialized lazily, only if needed (see Message::headers()).
+std::string GetRawHeaderBlock(const phr_header* headers, size_t num_headers) {
+  static constexpr std::string_view kSep = ": ";
+  static constexpr std::string_view kCRLF = "\r\n";
+
+  size_t size = 0;
+  for (size_t i = 0; i < num_headers; i++) {
+    size += headers[i].name_len + kSep.size() + headers[i].value_len + kCRLF.size();
+  }
+
+  std::string result;
+  result.reserve(size);
   for (size_t i = 0; i < num_headers; i++) {
-    std::string name(headers[i].name, headers[i].name_len);
-    std::string value(headers[i].value, headers[i].value_len);
-    result.emplace(std::move(name), std::move(value));
+    result.append(headers[i].name, headers[i].name_len);
+    result.append(kSep);
+    result.append(headers[i].value, headers[i].value_len);
+    result.append(kCRLF);
   }
   return result;
 }
@@ -101,19 +117,17 @@ ParseState ParseRequestBody(std::string_view* buf, Message* result) {
   //  body.
 
   // Case 1: Content-Length
-  const auto content_length_iter = result->headers.find(kContentLength);
-  if (content_length_iter != result->headers.end()) {
-    std::string_view content_len_str = content_length_iter->second;
-    auto r = ParseContent(content_len_str, buf, FLAGS_http_body_limit_bytes, &result->body,
+  const std::optional<std::string_view> content_length = result->GetHeader(kContentLength);
+  if (content_length.has_value()) {
+    auto r = ParseContent(*content_length, buf, FLAGS_http_body_limit_bytes, &result->body,
                           &result->body_size);
     DCHECK_LE(result->body.size(), FLAGS_http_body_limit_bytes);
     return r;
   }
 
   // Case 2: Chunked transfer.
-  const auto transfer_encoding_iter = result->headers.find(kTransferEncoding);
-  if (transfer_encoding_iter != result->headers.end() &&
-      transfer_encoding_iter->second == "chunked") {
+  const std::optional<std::string_view> transfer_encoding = result->GetHeader(kTransferEncoding);
+  if (transfer_encoding == "chunked") {
     auto s = ParseChunked(buf, FLAGS_http_body_limit_bytes, &result->body, &result->body_size);
     DCHECK_LE(result->body.size(), FLAGS_http_body_limit_bytes);
     return s;
@@ -151,19 +165,17 @@ ParseState ParseResponseBody(std::string_view* buf, Message* result, State* stat
   }
 
   // Case 1: Content-Length
-  const auto content_length_iter = result->headers.find(kContentLength);
-  if (content_length_iter != result->headers.end()) {
-    std::string_view content_len_str = content_length_iter->second;
-    auto s = ParseContent(content_len_str, buf, FLAGS_http_body_limit_bytes, &result->body,
+  const std::optional<std::string_view> content_length = result->GetHeader(kContentLength);
+  if (content_length.has_value()) {
+    auto s = ParseContent(*content_length, buf, FLAGS_http_body_limit_bytes, &result->body,
                           &result->body_size);
     DCHECK_LE(result->body.size(), FLAGS_http_body_limit_bytes);
     return s;
   }
 
   // Case 2: Chunked transfer.
-  const auto transfer_encoding_iter = result->headers.find(kTransferEncoding);
-  if (transfer_encoding_iter != result->headers.end() &&
-      transfer_encoding_iter->second == "chunked") {
+  const std::optional<std::string_view> transfer_encoding = result->GetHeader(kTransferEncoding);
+  if (transfer_encoding == "chunked") {
     auto s = ParseChunked(buf, FLAGS_http_body_limit_bytes, &result->body, &result->body_size);
     DCHECK_LE(result->body.size(), FLAGS_http_body_limit_bytes);
     return s;
@@ -178,8 +190,7 @@ ParseState ParseResponseBody(std::string_view* buf, Message* result, State* stat
 
     // Status 101 is an even more special case.
     if (result->resp_status == 101) {
-      const auto upgrade_iter = result->headers.find(kUpgrade);
-      if (upgrade_iter == result->headers.end()) {
+      if (!result->GetHeader(kUpgrade).has_value()) {
         LOG(WARNING) << "Expected an Upgrade header with HTTP status 101";
       }
 
@@ -219,7 +230,7 @@ ParseState ParseRequest(std::string_view* buf, Message* result) {
 
     result->type = message_type_t::kRequest;
     result->minor_version = req.minor_version;
-    result->headers = pico_wrapper::GetHTTPHeadersMap(req.headers, req.num_headers);
+    result->raw_headers = pico_wrapper::GetRawHeaderBlock(req.headers, req.num_headers);
     result->req_method = std::string(req.method, req.method_len);
     result->req_path = std::string(req.path, req.path_len);
     result->headers_byte_size = retval;
@@ -241,7 +252,7 @@ ParseState ParseResponse(std::string_view* buf, Message* result, State* state) {
 
     result->type = message_type_t::kResponse;
     result->minor_version = resp.minor_version;
-    result->headers = pico_wrapper::GetHTTPHeadersMap(resp.headers, resp.num_headers);
+    result->raw_headers = pico_wrapper::GetRawHeaderBlock(resp.headers, resp.num_headers);
     result->resp_status = resp.status;
     result->resp_message = std::string(resp.msg, resp.msg_len);
     result->headers_byte_size = retval;
@@ -323,7 +334,7 @@ size_t FindFrameBoundary(message_type_t type, std::string_view buf, size_t start
   // Note that we don't search forwards for HTTP/1.1 directly, because it could result in matches
   // inside the request/response body.
   while (true) {
-    size_t marker_pos = buf.find(kBoundaryMarker, start_pos);
+    size_t marker_pos = FindSubstr(buf, kBoundaryMarker, start_pos);
 
     if (marker_pos == std::string::npos) {
       return std::string::npos;
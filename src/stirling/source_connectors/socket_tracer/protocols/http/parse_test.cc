@@ -54,7 +54,7 @@ Message HTTPGetReq0ExpectedMessage() {
   Message expected_message;
   expected_message.type = message_type_t::kRequest;
   expected_message.minor_version = 1;
-  expected_message.headers = {{"Host", "www.pixielabs.ai"},
+  *expected_message.mutable_headers() = {{"Host", "www.pixielabs.ai"},
                               {"Accept", "image/gif, image/jpeg, */*"},
                               {"User-Agent", "Mozilla/5.0 (X11; Linux x86_64)"}};
   expected_message.req_method = "GET";
@@ -75,7 +75,7 @@ Message HTTPGetReq1ExpectedMessage() {
   Message expected_message;
   expected_message.type = message_type_t::kRequest;
   expected_message.minor_version = 1;
-  expected_message.headers = {{"Host", "www.pixielabs.ai"},
+  *expected_message.mutable_headers() = {{"Host", "www.pixielabs.ai"},
                               {"Accept", "image/gif, image/jpeg, */*"},
                               {"User-Agent", "Mozilla/5.0 (X11; Linux x86_64)"}};
   expected_message.req_method = "GET";
@@ -97,7 +97,7 @@ Message HTTPPostReq0ExpectedMessage() {
   Message expected_message;
   expected_message.type = message_type_t::kRequest;
   expected_message.minor_version = 1;
-  expected_message.headers = {{"host", "pixielabs.ai"},
+  *expected_message.mutable_headers() = {{"host", "pixielabs.ai"},
                               {"content-type", "application/x-www-form-urlencoded"},
                               {"content-length", "27"}};
   expected_message.req_method = "POST";
@@ -118,7 +118,7 @@ Message HTTPResp0ExpectedMessage() {
   Message expected_message;
   expected_message.type = message_type_t::kResponse;
   expected_message.minor_version = 1;
-  expected_message.headers = {{"Content-Type", "foo"}, {"Content-Length", "9"}};
+  *expected_message.mutable_headers() = {{"Content-Type", "foo"}, {"Content-Length", "9"}};
   expected_message.resp_status = 200;
   expected_message.resp_message = "OK";
   expected_message.body = "pixielabs";
@@ -137,7 +137,7 @@ Message HTTPResp1ExpectedMessage() {
   Message expected_message;
   expected_message.type = message_type_t::kResponse;
   expected_message.minor_version = 1;
-  expected_message.headers = {{"Content-Type", "bar"}, {"Content-Length", "21"}};
+  *expected_message.mutable_headers() = {{"Content-Type", "bar"}, {"Content-Length", "21"}};
   expected_message.resp_status = 200;
   expected_message.resp_message = "OK";
   expected_message.body = "pixielabs is awesome!";
@@ -160,7 +160,7 @@ Message HTTPResp2ExpectedMessage() {
   Message expected_message;
   expected_message.type = message_type_t::kResponse;
   expected_message.minor_version = 1;
-  expected_message.headers = {{"Transfer-Encoding", "chunked"}};
+  *expected_message.mutable_headers() = {{"Transfer-Encoding", "chunked"}};
   expected_message.resp_status = 200;
   expected_message.resp_message = "OK";
   expected_message.body = "pixielabs is awesome!";
@@ -180,7 +180,7 @@ Message EmptyHTTPResp() {
 // Leave body set by caller.
 Message EmptyChunkedHTTPResp() {
   Message result = EmptyHTTPResp();
-  result.headers = {{"Transfer-Encoding", "chunked"}};
+  *result.mutable_headers() = {{"Transfer-Encoding", "chunked"}};
   return result;
 }
 
@@ -230,11 +230,11 @@ bool operator==(const Message& lhs, const Message& rhs) {
   CMP(resp_message);
   CMP(body);
   CMP(body_size);
-  if (lhs.headers != rhs.headers) {
-    LOG(INFO) << absl::StrJoin(std::begin(lhs.headers), std::end(lhs.headers), " ",
+  if (lhs.headers() != rhs.headers()) {
+    LOG(INFO) << absl::StrJoin(std::begin(lhs.headers()), std::end(lhs.headers()), " ",
                                absl::PairFormatter(":"))
               << " vs. "
-              << absl::StrJoin(std::begin(rhs.headers), std::end(rhs.headers), " ",
+              << absl::StrJoin(std::begin(rhs.headers()), std::end(rhs.headers()), " ",
                                absl::PairFormatter(":"));
     return false;
   }
@@ -388,7 +388,7 @@ TEST_F(HTTPParserTest, ParseCompleteHTTPResponseWithContentLengthHeader) {
   Message expected_message1;
   expected_message1.type = message_type_t::kResponse;
   expected_message1.minor_version = 1;
-  expected_message1.headers = {{"Content-Type", "foo"}, {"Content-Length", "9"}};
+  *expected_message1.mutable_headers() = {{"Content-Type", "foo"}, {"Content-Length", "9"}};
   expected_message1.resp_status = 200;
   expected_message1.resp_message = "OK";
   expected_message1.body = "pixielabs";
@@ -397,7 +397,7 @@ TEST_F(HTTPParserTest, ParseCompleteHTTPResponseWithContentLengthHeader) {
   Message expected_message2;
   expected_message2.type = message_type_t::kResponse;
   expected_message2.minor_version = 1;
-  expected_message2.headers = {{"Content-Type", "bar"}, {"Content-Length", "10"}};
+  *expected_message2.mutable_headers() = {{"Content-Type", "bar"}, {"Content-Length", "10"}};
   expected_message2.resp_status = 200;
   expected_message2.resp_message = "OK";
   expected_message2.body = "pixielabs!";
@@ -425,7 +425,7 @@ TEST_F(HTTPParserTest, ParseIncompleteHTTPResponseWithContentLengthHeader) {
   Message expected_message1;
   expected_message1.type = message_type_t::kResponse;
   expected_message1.minor_version = 1;
-  expected_message1.headers = {{"Content-Type", "foo"}, {"Content-Length", "21"}};
+  *expected_message1.mutable_headers() = {{"Content-Type", "foo"}, {"Content-Length", "21"}};
   expected_message1.resp_status = 200;
   expected_message1.resp_message = "OK";
   expected_message1.body = "pixielabs is awesome!";
@@ -534,7 +534,7 @@ TEST_F(HTTPParserTest, LongContentLengthBodyTruncated) {
   Message expected_message;
   expected_message.type = message_type_t::kResponse;
   expected_message.minor_version = 1;
-  expected_message.headers = {{"Content-Length", "320"}};
+  *expected_message.mutable_headers() = {{"Content-Length", "320"}};
   expected_message.resp_status = 200;
   expected_message.resp_message = "OK";
   // Notice the truncation.
@@ -582,7 +582,7 @@ TEST_F(HTTPParserTest, ParseRequestWithoutLengthOrChunking) {
   Message expected_message;
   expected_message.type = message_type_t::kRequest;
   expected_message.minor_version = 1;
-  expected_message.headers = {{"Host", "www.pixielabs.ai"},
+  *expected_message.mutable_headers() = {{"Host", "www.pixielabs.ai"},
                               {"Accept", "image/gif, image/jpeg, */*"},
                               {"User-Agent", "Mozilla/5.0 (X11; Linux x86_64)"}};
   expected_message.req_method = "HEAD";
@@ -621,7 +621,7 @@ TEST_F(HTTPParserTest, ParseHeadAndGetResponse) {
   Message expected_message1 = EmptyHTTPResp();
   expected_message1.type = message_type_t::kResponse;
   expected_message1.minor_version = 1;
-  expected_message1.headers = {{"Content-Length", "5"},
+  *expected_message1.mutable_headers() = {{"Content-Length", "5"},
                                {"Content-Type", "text/plain; charset=utf-8"}};
   expected_message1.body = "";
   expected_message1.body_size = 0;
@@ -629,7 +629,7 @@ TEST_F(HTTPParserTest, ParseHeadAndGetResponse) {
   Message expected_message2 = EmptyHTTPResp();
   expected_message2.type = message_type_t::kResponse;
   expected_message2.minor_version = 1;
-  expected_message2.headers = {{"Content-Length", "5"},
+  *expected_message2.mutable_headers() = {{"Content-Length", "5"},
                                {"Content-Type", "text/plain; charset=utf-8"}};
   expected_message2.body = "pixie";
   expected_message2.body_size = 5;
@@ -680,7 +680,7 @@ TEST_F(HTTPParserTest, ParseHeadResponseWithConnClose) {
   Message expected_message1 = EmptyHTTPResp();
   expected_message1.type = message_type_t::kResponse;
   expected_message1.minor_version = 1;
-  expected_message1.headers = {{"Content-Length", "5"},
+  *expected_message1.mutable_headers() = {{"Content-Length", "5"},
                                {"Content-Type", "text/plain; charset=utf-8"}};
   expected_message1.body = "";
 
@@ -38,6 +38,10 @@ DEFINE_string(http_response_header_filters, "Content-Type:json,Content-Type:text
               "'Content-Type:json,Content-Type:text' will select a HTTP response "
               "with a Content-Type header whose value contains 'json' *or* 'text'.");
 
+DEFINE_uint64(http_body_decompression_size_limit_bytes, 64 * 1024,
+              "Maximum number of bytes to produce when decompressing an HTTP body. "
+              "Decompression stops at this cap, bounding memory for large compressed responses.");
+
 namespace px {
 namespace stirling {
 namespace protocols {
@@ -49,8 +53,7 @@ void PreProcessMessage(Message* message) {
       ParseHTTPHeaderFilters(FLAGS_http_response_header_filters);
 
   // Rule: Exclude anything that doesn't specify its Content-Type.
-  auto content_type_iter = message->headers.find(http::kContentType);
-  if (content_type_iter == message->headers.end()) {
+  if (!message->GetHeader(http::kContentType).has_value()) {
     if (message->body_size > 0) {
       // Don't rewrite if the body is empty.
       message->body = "<removed: unknown content-type>";
@@ -62,16 +65,20 @@ void PreProcessMessage(Message* message) {
   if (message->type == message_type_t::kResponse &&
       (!kHTTPResponseHeaderFilter.inclusions.empty() ||
        !kHTTPResponseHeaderFilter.exclusions.empty())) {
-    if (!MatchesHTTPHeaders(message->headers, kHTTPResponseHeaderFilter)) {
+    if (!MatchesHTTPHeaders(*message, kHTTPResponseHeaderFilter)) {
       message->body = "<removed: non-text content-type>";
       return;
     }
   }
 
-  auto content_encoding_iter = message->headers.find(kContentEncoding);
   // Replace body with decompressed version, if required.
-  if (content_encoding_iter != message->headers.end() && content_encoding_iter->second == "gzip") {
-    message->body = px::zlib::Inflate(message->body).ConsumeValueOr("<Failed to gunzip body>");
+  // The captured body may be truncated at the capture limit, so use the cap-bounded inflate,
+  // which returns the decompressed prefix for truncated streams instead of failing.
+  const std::optional<std::string_view> content_encoding = message->GetHeader(kContentEncoding);
+  if (content_encoding == "gzip" || content_encoding == "deflate") {
+    message->body =
+        px::zlib::InflateToCap(message->body, FLAGS_http_body_decompression_size_limit_bytes)
+            .ConsumeValueOr("<Failed to decompress body>");
   }
 }
 
@@ -28,6 +28,7 @@
 #include "src/stirling/source_connectors/socket_tracer/protocols/http/types.h"
 
 DECLARE_string(http_response_header_filters);
+DECLARE_uint64(http_body_decompression_size_limit_bytes);
 
 namespace px {
 namespace stirling {
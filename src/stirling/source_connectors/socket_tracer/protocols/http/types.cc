@@ -0,0 +1,88 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/stirling/source_connectors/socket_tracer/protocols/http/types.h"
+
+#include <absl/strings/ascii.h>
+#include <absl/strings/match.h>
+#include <absl/strings/str_split.h>
+
+namespace px {
+namespace stirling {
+namespace protocols {
+namespace http {
+
+namespace {
+
+// Splits a "Name: value" header line. Returns false if the line is not a valid header.
+bool SplitHeaderLine(std::string_view line, std::string_view* name, std::string_view* value) {
+  size_t pos = line.find(':');
+  if (pos == std::string_view::npos) {
+    return false;
+  }
+  *name = line.substr(0, pos);
+  *value = absl::StripLeadingAsciiWhitespace(line.substr(pos + 1));
+  return true;
+}
+
+}  // namespace
+
+std::optional<std::string_view> Message::GetHeader(std::string_view name) const {
+  // If the map has already been materialized (or was populated directly), it is authoritative.
+  if (headers_.has_value()) {
+    auto iter = headers_->find(std::string(name));
+    if (iter == headers_->end()) {
+      return std::nullopt;
+    }
+    return std::string_view(iter->second);
+  }
+
+  for (std::string_view line : absl::StrSplit(raw_headers, "\r\n", absl::SkipEmpty())) {
+    std::string_view line_name;
+    std::string_view line_value;
+    if (SplitHeaderLine(line, &line_name, &line_value) && absl::EqualsIgnoreCase(line_name, name)) {
+      return line_value;
+    }
+  }
+  return std::nullopt;
+}
+
+const HeadersMap& Message::headers() const {
+  if (!headers_.has_value()) {
+    headers_.emplace();
+    for (std::string_view line : absl::StrSplit(raw_headers, "\r\n", absl::SkipEmpty())) {
+      std::string_view name;
+      std::string_view value;
+      if (SplitHeaderLine(line, &name, &value)) {
+        headers_->emplace(name, value);
+      }
+    }
+  }
+  return *headers_;
+}
+
+HeadersMap* Message::mutable_headers() {
+  // Materialize first, so direct insertions and raw_headers contents are merged consistently.
+  headers();
+  return &*headers_;
+}
+
+}  // namespace http
+}  // namespace protocols
+}  // namespace stirling
+}  // namespace px
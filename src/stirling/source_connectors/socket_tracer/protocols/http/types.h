@@ -19,6 +19,7 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 #include <string>
 
 #include "src/common/base/utils.h"
@@ -50,7 +51,12 @@ struct Message : public FrameBase {
   message_type_t type = message_type_t::kUnknown;
 
   int minor_version = -1;
-  HeadersMap headers = {};
+
+  // The header block as received on the wire ("Name: value" CRLF lines), kept as a single copy.
+  // Most messages only ever have a handful of headers inspected (Content-Type, Content-Length,
+  // trace headers), so the HeadersMap is materialized lazily by headers(); use GetHeader() for
+  // lookups that should not trigger the materialization.
+  std::string raw_headers = {};
 
   std::string req_method = "-";
   std::string req_path = "-";
@@ -65,6 +71,23 @@ struct Message : public FrameBase {
   // as an approximation of the size of the non-body fields.
   size_t headers_byte_size = 0;
 
+  /**
+   * Returns the value of the named header (case-insensitive), or std::nullopt if absent.
+   * Scans raw_headers without allocating, and without materializing the HeadersMap.
+   * If the same header appears multiple times, the first occurrence is returned.
+   */
+  std::optional<std::string_view> GetHeader(std::string_view name) const;
+
+  /**
+   * Returns all headers as a map, materializing it from raw_headers on first use.
+   */
+  const HeadersMap& headers() const;
+
+  /**
+   * Returns a mutable headers map, for callers that construct messages directly (e.g. tests).
+   */
+  HeadersMap* mutable_headers();
+
   size_t ByteSize() const override {
     return sizeof(Message) + headers_byte_size + body.size() + resp_message.size();
   }
@@ -74,9 +97,13 @@ struct Message : public FrameBase {
         "[type=$0 minor_version=$1 headers=[$2] req_method=$3 "
         "req_path=$4 resp_status=$5 resp_message=$6 body=$7]",
         magic_enum::enum_name(type), minor_version,
-        absl::StrJoin(headers, ",", absl::PairFormatter(":")), req_method, req_path, resp_status,
+        absl::StrJoin(headers(), ",", absl::PairFormatter(":")), req_method, req_path, resp_status,
         resp_message, body);
   }
+
+ private:
+  // Lazily-materialized form of raw_headers. Cached so repeat calls to headers() don't re-parse.
+  mutable std::optional<HeadersMap> headers_;
 };
 
 //-----------------------------------------------------------------------------
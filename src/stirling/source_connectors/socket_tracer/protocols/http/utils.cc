@@ -59,6 +59,36 @@ bool MatchesHTTPHeaders(const HeadersMap& http_headers, const HTTPHeaderFilter&
   return true;
 }
 
+bool MatchesHTTPHeaders(const Message& message, const HTTPHeaderFilter& filter) {
+  if (!filter.inclusions.empty()) {
+    bool included = false;
+    for (auto [http_header, substr] : filter.inclusions) {
+      std::optional<std::string_view> value = message.GetHeader(http_header);
+      if (value.has_value() && absl::StrContains(*value, substr)) {
+        included = true;
+        break;
+      }
+    }
+    if (!included) {
+      return false;
+    }
+  }
+  if (!filter.exclusions.empty()) {
+    bool excluded = false;
+    for (auto [http_header, substr] : filter.exclusions) {
+      std::optional<std::string_view> value = message.GetHeader(http_header);
+      if (value.has_value() && absl::StrContains(*value, substr)) {
+        excluded = true;
+        break;
+      }
+    }
+    if (excluded) {
+      return false;
+    }
+  }
+  return true;
+}
+
 HTTPHeaderFilter ParseHTTPHeaderFilters(std::string_view filters) {
   HTTPHeaderFilter result;
   for (std::string_view header_filter : absl::StrSplit(filters, ",", absl::SkipEmpty())) {
@@ -75,11 +105,11 @@ HTTPHeaderFilter ParseHTTPHeaderFilters(std::string_view filters) {
 }
 
 bool IsJSONContent(const Message& message) {
-  auto content_type_iter = message.headers.find(kContentType);
-  if (content_type_iter == message.headers.end()) {
+  std::optional<std::string_view> content_type = message.GetHeader(kContentType);
+  if (!content_type.has_value()) {
     return false;
   }
-  if (absl::StrContains(content_type_iter->second, "json")) {
+  if (absl::StrContains(*content_type, "json")) {
     return true;
   }
   return false;
@@ -59,6 +59,12 @@ HTTPHeaderFilter ParseHTTPHeaderFilters(std::string_view filters);
  */
 bool MatchesHTTPHeaders(const HeadersMap& http_headers, const HTTPHeaderFilter& filter);
 
+/**
+ * @brief Same as above, but probes the message's headers via Message::GetHeader(),
+ * without materializing the full HeadersMap.
+ */
+bool MatchesHTTPHeaders(const Message& message, const HTTPHeaderFilter& filter);
+
 /**
  * Detects the content-type of an HTTP message. Currently only checks for JSON.
  */
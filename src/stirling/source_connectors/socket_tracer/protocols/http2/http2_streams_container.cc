@@ -20,28 +20,13 @@
 
 #include <algorithm>
 
+DEFINE_uint32(stirling_http2_streams_per_conn_limit, 1024,
+              "Maximum number of HTTP2 streams tracked per connection. When exceeded, the "
+              "least-recently-active stream is evicted. 0 means unlimited.");
+
 namespace px {
 namespace stirling {
 
-namespace {
-
-void EraseExpiredStreams(std::chrono::time_point<std::chrono::steady_clock> expiry_timestamp,
-                         absl::flat_hash_map<uint32_t, protocols::http2::Stream>* streams) {
-  auto iter = streams->begin();
-  while (iter != streams->end()) {
-    const auto& stream = iter->second;
-    uint64_t timestamp_ns = std::max(stream.send.timestamp_ns, stream.recv.timestamp_ns);
-    auto last_activity =
-        std::chrono::time_point<std::chrono::steady_clock>(std::chrono::nanoseconds(timestamp_ns));
-
-    if (expiry_timestamp < last_activity) {
-      break;
-    }
-    streams->erase(iter++);
-  }
-}
-}  // namespace
-
 size_t HTTP2StreamsContainer::StreamsSize() const {
   size_t size = 0;
   for (const auto& [id, stream] : streams_) {
@@ -50,20 +35,65 @@ size_t HTTP2StreamsContainer::StreamsSize() const {
   return size;
 }
 
+void HTTP2StreamsContainer::TouchStream(uint32_t stream_id) {
+  auto pos_iter = lru_pos_.find(stream_id);
+  if (pos_iter != lru_pos_.end()) {
+    lru_order_.splice(lru_order_.end(), lru_order_, pos_iter->second);
+    return;
+  }
+  lru_pos_[stream_id] = lru_order_.insert(lru_order_.end(), stream_id);
+}
+
+void HTTP2StreamsContainer::EraseStream(uint32_t stream_id) {
+  streams_.erase(stream_id);
+
+  auto pos_iter = lru_pos_.find(stream_id);
+  if (pos_iter != lru_pos_.end()) {
+    lru_order_.erase(pos_iter->second);
+    lru_pos_.erase(pos_iter);
+  }
+}
+
+void HTTP2StreamsContainer::EraseHead(size_t n) {
+  n = std::min(n, lru_order_.size());
+  for (size_t i = 0; i < n; ++i) {
+    EraseStream(lru_order_.front());
+  }
+}
+
 void HTTP2StreamsContainer::Cleanup(
     size_t size_limit_bytes, std::chrono::time_point<std::chrono::steady_clock> expiry_timestamp) {
+  // If over the size limit, evict streams in least-recently-active order until under the limit,
+  // rather than clearing everything and losing the active streams too.
   size_t size = StreamsSize();
   if (size > size_limit_bytes) {
-    VLOG(1) << absl::Substitute("HTTP2 streams cleared due to size limit ($0 > $1).", size,
+    VLOG(1) << absl::Substitute("HTTP2 streams evicted due to size limit ($0 > $1).", size,
                                 size_limit_bytes);
-    streams_.clear();
+    while (size > size_limit_bytes && !lru_order_.empty()) {
+      uint32_t stream_id = lru_order_.front();
+      size -= streams_[stream_id].ByteSize();
+      EraseStream(stream_id);
+    }
   }
 
-  EraseExpiredStreams(expiry_timestamp, &streams_);
+  // Erase expired streams, visiting them in least-recently-active order,
+  // so we can stop at the first stream that is still fresh.
+  while (!lru_order_.empty()) {
+    const protocols::http2::Stream& stream = streams_[lru_order_.front()];
+    uint64_t timestamp_ns = std::max(stream.send.timestamp_ns, stream.recv.timestamp_ns);
+    auto last_activity =
+        std::chrono::time_point<std::chrono::steady_clock>(std::chrono::nanoseconds(timestamp_ns));
+
+    if (expiry_timestamp < last_activity) {
+      break;
+    }
+    EraseStream(lru_order_.front());
+  }
 }
 
 protocols::http2::HalfStream* HTTP2StreamsContainer::HalfStreamPtr(uint32_t stream_id,
                                                                    bool write_event) {
+  TouchStream(stream_id);
   protocols::http2::Stream& stream = streams_[stream_id];
 
   if (stream.consumed) {
@@ -72,6 +102,15 @@ protocols::http2::HalfStream* HTTP2StreamsContainer::HalfStreamPtr(uint32_t stre
     VLOG(1) << "Trying to access a consumed stream.";
   }
 
+  // Cap the number of in-flight streams, evicting the least-recently-active one.
+  // The stream just touched is at the most-recently-active end, so it is never the victim.
+  if (FLAGS_stirling_http2_streams_per_conn_limit != 0 &&
+      streams_.size() > FLAGS_stirling_http2_streams_per_conn_limit) {
+    VLOG(1) << absl::Substitute("HTTP2 stream $0 evicted due to per-connection stream limit ($1).",
+                                lru_order_.front(), FLAGS_stirling_http2_streams_per_conn_limit);
+    EraseStream(lru_order_.front());
+  }
+
   protocols::http2::HalfStream* half_stream_ptr = write_event ? &stream.send : &stream.recv;
   return half_stream_ptr;
 }
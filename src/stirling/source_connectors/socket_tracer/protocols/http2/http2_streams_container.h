@@ -19,6 +19,7 @@
 #pragma once
 
 #include <deque>
+#include <list>
 #include <string>
 
 #include <absl/container/flat_hash_map.h>
@@ -26,6 +27,8 @@
 #include "src/common/base/mixins.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/http2/types.h"
 
+DECLARE_uint32(stirling_http2_streams_per_conn_limit);
+
 namespace px {
 namespace stirling {
 
@@ -34,6 +37,10 @@ namespace stirling {
  * This is managed differently from other protocols because it comes as UProbe data
  * and is already structured. This in contrast to other protocols which are captured via
  * KProbes and need to be parsed.
+ *
+ * Streams are tracked in least-recently-active order, so that on long-lived gRPC connections,
+ * inactive streams can be evicted in O(1) without scanning the whole map, and the number of
+ * in-flight streams is capped (see --stirling_http2_streams_per_conn_limit).
  */
 class HTTP2StreamsContainer : NotCopyMoveable {
  public:
@@ -44,10 +51,17 @@ class HTTP2StreamsContainer : NotCopyMoveable {
 
   /**
    * Get the HTTP2 stream for the given stream ID and the direction of traffic.
+   * Marks the stream as most-recently-active, and may evict the least-recently-active stream
+   * if the per-connection stream limit is exceeded.
    * @param write_event==true for send HalfStream, write_event==false for recv HalfStream.
    */
   protocols::http2::HalfStream* HalfStreamPtr(uint32_t stream_id, bool write_event);
 
+  /**
+   * Erases the stream with the given ID, in O(1). Called when a stream has been consumed.
+   */
+  void EraseStream(uint32_t stream_id);
+
   /**
    * Returns the approximate memory consumption of the HTTP2StreamsContainer.
    */
@@ -56,20 +70,29 @@ class HTTP2StreamsContainer : NotCopyMoveable {
   /**
    * Cleans up the HTTP2 events from BPF uprobes that are too old,
    * either because they are too far back in time, or too far back in bytes.
+   * Streams are released in least-recently-active order.
    */
   void Cleanup(size_t size_limit_bytes,
                std::chrono::time_point<std::chrono::steady_clock> expiry_timestamp);
 
   /**
-   * Erase n stream IDs from the head of the streams container.
+   * Erase n streams from the least-recently-active end of the container.
    */
   void EraseHead(size_t n);
 
   std::string DebugString(std::string_view prefix) const;
 
  private:
+  // Moves the stream to the most-recently-active position, inserting it if new.
+  void TouchStream(uint32_t stream_id);
+
   // Map of all HTTP2 streams. Key is stream ID.
   absl::flat_hash_map<uint32_t, protocols::http2::Stream> streams_;
+
+  // Stream IDs in activity order: least-recently-active at the front.
+  // Maintained alongside streams_ for O(1) touch and eviction.
+  std::list<uint32_t> lru_order_;
+  absl::flat_hash_map<uint32_t, std::list<uint32_t>::iterator> lru_pos_;
 };
 
 }  // namespace stirling
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "src/stirling/source_connectors/socket_tracer/protocols/http2/http2_streams_container.h"
+
+namespace px {
+namespace stirling {
+
+using ::testing::Key;
+using ::testing::UnorderedElementsAre;
+
+// An expiry timestamp in the distant past, so Cleanup() does not expire anything.
+constexpr auto kNoExpiry = std::chrono::time_point<std::chrono::steady_clock>::min();
+
+TEST(HTTP2StreamsContainerTest, StreamLimitEvictsLeastRecentlyActive) {
+  uint32_t orig_limit = FLAGS_stirling_http2_streams_per_conn_limit;
+  FLAGS_stirling_http2_streams_per_conn_limit = 2;
+
+  HTTP2StreamsContainer container;
+  container.HalfStreamPtr(1, /*write_event*/ true);
+  container.HalfStreamPtr(3, /*write_event*/ true);
+
+  // Touch stream 1, so stream 3 becomes the least-recently-active stream.
+  container.HalfStreamPtr(1, /*write_event*/ true);
+
+  // Exceeding the limit should evict stream 3.
+  container.HalfStreamPtr(5, /*write_event*/ true);
+  EXPECT_THAT(container.streams(), UnorderedElementsAre(Key(1), Key(5)));
+
+  FLAGS_stirling_http2_streams_per_conn_limit = orig_limit;
+}
+
+TEST(HTTP2StreamsContainerTest, CleanupEvictsOldestUntilUnderSizeLimit) {
+  HTTP2StreamsContainer container;
+  container.HalfStreamPtr(1, /*write_event*/ true)->AddData("0123456789");
+  container.HalfStreamPtr(3, /*write_event*/ true)->AddData("0123456789");
+  container.HalfStreamPtr(5, /*write_event*/ true)->AddData("0123456789");
+
+  // 30 bytes tracked with a 25 byte limit: only the oldest stream should be evicted.
+  container.Cleanup(/*size_limit_bytes*/ 25, kNoExpiry);
+  EXPECT_THAT(container.streams(), UnorderedElementsAre(Key(3), Key(5)));
+}
+
+TEST(HTTP2StreamsContainerTest, CleanupExpiresOldStreams) {
+  HTTP2StreamsContainer container;
+  container.HalfStreamPtr(1, /*write_event*/ true)->UpdateTimestamp(1000);
+  container.HalfStreamPtr(3, /*write_event*/ true)->UpdateTimestamp(2000);
+
+  auto expiry =
+      std::chrono::time_point<std::chrono::steady_clock>(std::chrono::nanoseconds(1500));
+  container.Cleanup(/*size_limit_bytes*/ 10000, expiry);
+  EXPECT_THAT(container.streams(), UnorderedElementsAre(Key(3)));
+}
+
+TEST(HTTP2StreamsContainerTest, EraseStream) {
+  HTTP2StreamsContainer container;
+  container.HalfStreamPtr(1, /*write_event*/ true);
+  container.HalfStreamPtr(3, /*write_event*/ true);
+
+  container.EraseStream(1);
+  EXPECT_THAT(container.streams(), UnorderedElementsAre(Key(3)));
+
+  // Erasing an unknown stream is a no-op.
+  container.EraseStream(7);
+  EXPECT_THAT(container.streams(), UnorderedElementsAre(Key(3)));
+}
+
+}  // namespace stirling
+}  // namespace px
@@ -19,6 +19,7 @@
 #include "src/stirling/source_connectors/socket_tracer/protocols/http2/stitcher.h"
 
 #include <utility>
+#include <vector>
 
 namespace px {
 namespace stirling {
@@ -27,10 +28,8 @@ namespace http2 {
 
 void ProcessHTTP2Streams(HTTP2StreamsContainer* http2_streams_container,
                          RecordsWithErrorCount<http2::Record>* result) {
-  auto& streams = *http2_streams_container->mutable_streams();
-  auto iter = streams.begin();
-  while (iter != streams.end()) {
-    auto& stream = iter->second;
+  std::vector<uint32_t> consumed_stream_ids;
+  for (auto& [stream_id, stream] : *http2_streams_container->mutable_streams()) {
     if (
         // This is true when the stream_end headers event were received from bpf. In practice,
         // this event can be received earlier than other headers events, even if they were
@@ -40,11 +39,14 @@ void ProcessHTTP2Streams(HTTP2StreamsContainer* http2_streams_container,
         // headers events. Also gives time for late-arriving response headers to be received.
         stream.HasHeaders()) {
       result->records.emplace_back(std::move(stream));
-      streams.erase(iter++);
-    } else {
-      ++iter;
+      consumed_stream_ids.push_back(stream_id);
     }
   }
+
+  // Erase through the container so its activity-order bookkeeping stays consistent.
+  for (uint32_t stream_id : consumed_stream_ids) {
+    http2_streams_container->EraseStream(stream_id);
+  }
 }
 
 }  // namespace http2
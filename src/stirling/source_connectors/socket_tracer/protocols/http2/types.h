@@ -131,6 +131,13 @@ struct HalfStream {
     }
 
     if (size_to_add > 0) {
+      if (data_.capacity() < kMaxBodyBytes) {
+        // Reserve the full cap up-front on the first DATA frame. Bodies never exceed
+        // kMaxBodyBytes, so this turns the per-frame geometric string growth (several
+        // reallocations plus copies per stream on long-lived gRPC connections) into a single
+        // fixed-size allocation per body.
+        data_.reserve(kMaxBodyBytes);
+      }
       byte_size_ += size_to_add;
       data_ += val.substr(0, size_to_add);
     }
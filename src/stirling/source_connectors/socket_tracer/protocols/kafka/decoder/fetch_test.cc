@@ -345,9 +345,12 @@ TEST(KafkaPacketDecoder, TestExtractFetchRespV11) {
       .topics = {topic},
   };
 
+  bool orig_flag = FLAGS_stirling_kafka_decode_record_payloads;
+  FLAGS_stirling_kafka_decode_record_payloads = true;
   PacketDecoder decoder(input);
   decoder.SetAPIInfo(APIKey::kFetch, 11);
   EXPECT_OK_AND_EQ(decoder.ExtractFetchResp(), expected_result);
+  FLAGS_stirling_kafka_decode_record_payloads = orig_flag;
 }
 
 TEST(KafkaPacketDecoder, TestExtractFetchRespV12) {
@@ -401,9 +404,12 @@ TEST(KafkaPacketDecoder, TestExtractFetchRespV12) {
       .topics = {topic},
   };
 
+  bool orig_flag = FLAGS_stirling_kafka_decode_record_payloads;
+  FLAGS_stirling_kafka_decode_record_payloads = true;
   PacketDecoder decoder(input);
   decoder.SetAPIInfo(APIKey::kFetch, 12);
   EXPECT_OK_AND_EQ(decoder.ExtractFetchResp(), expected_result);
+  FLAGS_stirling_kafka_decode_record_payloads = orig_flag;
 }
 
 TEST(KafkaPacketDecoder, TestExtractFetchRespV11MissingMessageSet) {
@@ -18,6 +18,11 @@
 
 #include "src/stirling/source_connectors/socket_tracer/protocols/kafka/decoder/packet_decoder.h"
 
+DEFINE_bool(stirling_kafka_decode_record_payloads, false,
+            "If true, decode the key and value of individual records inside Kafka record batches. "
+            "By default only batch-level metadata (e.g. record count) is decoded, since record "
+            "payloads are omitted from the exported record.");
+
 namespace px {
 namespace stirling {
 namespace protocols {
@@ -85,7 +90,22 @@ StatusOr<RecordBatch> PacketDecoder::ExtractRecordBatch(int32_t* offset) {
   PL_UNUSED(producer_epoch);
   PL_UNUSED(base_sequence);
 
-  PL_ASSIGN_OR_RETURN(r.records, ExtractRegularArray(&PacketDecoder::ExtractRecordMessage));
+  PL_ASSIGN_OR_RETURN(int32_t record_count, ExtractInt32());
+  if (record_count < -1) {
+    return error::Internal("Record count cannot be negative.");
+  }
+  // A record count of -1 denotes a null array.
+  r.record_count = (record_count == -1) ? 0 : record_count;
+
+  // Record payloads are not consumed by the exported record (MessageSet::ToJSON omits record
+  // batches by default), so they are only decoded on demand.
+  if (FLAGS_stirling_kafka_decode_record_payloads) {
+    for (int32_t i = 0; i < record_count; ++i) {
+      PL_ASSIGN_OR_RETURN(RecordMessage record, ExtractRecordMessage());
+      r.records.push_back(std::move(record));
+    }
+  }
+  // JumpToOffset() skips over any records that were not decoded.
   PL_RETURN_IF_ERROR(JumpToOffset());
 
   *offset += length + kBaseOffsetLength + kLengthLength;
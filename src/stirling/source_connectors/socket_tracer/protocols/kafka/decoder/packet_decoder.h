@@ -29,6 +29,8 @@
 #include "src/stirling/source_connectors/socket_tracer/protocols/kafka/opcodes/opcodes.h"
 #include "src/stirling/utils/binary_decoder.h"
 
+DECLARE_bool(stirling_kafka_decode_record_payloads);
+
 namespace px {
 namespace stirling {
 namespace protocols {
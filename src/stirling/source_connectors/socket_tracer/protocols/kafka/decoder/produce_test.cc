@@ -30,6 +30,7 @@ namespace kafka {
 
 using ::testing::ElementsAre;
 using ::testing::IsEmpty;
+using ::testing::SizeIs;
 using ::px::operator<<;
 
 bool operator==(const ProduceReqPartition& lhs, const ProduceReqPartition& rhs) {
@@ -166,9 +167,34 @@ TEST(KafkaPacketDecoderTest, ExtractProduceReqV7) {
   ProduceReqTopic topic{.name = "my-topic", .partitions = {partition}};
   ProduceReq expected_result{
       .transactional_id = "", .acks = 1, .timeout_ms = 30000, .topics = {topic}};
+  bool orig_flag = FLAGS_stirling_kafka_decode_record_payloads;
+  FLAGS_stirling_kafka_decode_record_payloads = true;
   PacketDecoder decoder(input);
   decoder.SetAPIInfo(APIKey::kProduce, 7);
   EXPECT_OK_AND_EQ(decoder.ExtractProduceReq(), expected_result);
+  FLAGS_stirling_kafka_decode_record_payloads = orig_flag;
+}
+
+// With record payload decoding disabled (the default), only the batch-level record count is
+// extracted, and the record key/values are skipped over.
+TEST(KafkaPacketDecoderTest, ExtractProduceReqV7LazyRecordBatch) {
+  const std::string_view input = CreateStringView<char>(
+      "\xFF\xFF\x00\x01\x00\x00\x75\x30\x00\x00\x00\x01\x00\x08\x6D\x79\x2D\x74\x6F\x70\x69\x63\x00"
+      "\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00\x5C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x50"
+      "\x00\x00\x00\x00\x02\x76\x7C\xA6\x2F\x00\x00\x00\x00\x00\x01\x00\x00\x01\x7C\x29\x89\x9A\xA2"
+      "\x00\x00\x01\x7C\x29\x89\x9A\xA2\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x00"
+      "\x00\x00\x02\x14\x00\x00\x00\x01\x08\x74\x65\x73\x74\x00\x26\x00\x00\x02\x01\x1A\xC2\x48\x6F"
+      "\x6C\x61\x2C\x20\x6D\x75\x6E\x64\x6F\x21\x00");
+  PacketDecoder decoder(input);
+  decoder.SetAPIInfo(APIKey::kProduce, 7);
+  ASSERT_OK_AND_ASSIGN(ProduceReq req, decoder.ExtractProduceReq());
+  ASSERT_THAT(req.topics, SizeIs(1));
+  ASSERT_THAT(req.topics[0].partitions, SizeIs(1));
+  const MessageSet& message_set = req.topics[0].partitions[0].message_set;
+  EXPECT_EQ(92, message_set.size);
+  ASSERT_THAT(message_set.record_batches, SizeIs(1));
+  EXPECT_EQ(2, message_set.record_batches[0].record_count);
+  EXPECT_THAT(message_set.record_batches[0].records, IsEmpty());
 }
 
 TEST(KafkaPacketDecoderTest, ExtractProduceReqV8) {
@@ -185,9 +211,12 @@ TEST(KafkaPacketDecoderTest, ExtractProduceReqV8) {
   ProduceReqTopic topic{.name = "quickstart-events", .partitions = {partition}};
   ProduceReq expected_result{
       .transactional_id = "", .acks = 1, .timeout_ms = 1500, .topics = {topic}};
+  bool orig_flag = FLAGS_stirling_kafka_decode_record_payloads;
+  FLAGS_stirling_kafka_decode_record_payloads = true;
   PacketDecoder decoder(input);
   decoder.SetAPIInfo(APIKey::kProduce, 8);
   EXPECT_OK_AND_EQ(decoder.ExtractProduceReq(), expected_result);
+  FLAGS_stirling_kafka_decode_record_payloads = orig_flag;
 }
 
 TEST(KafkaPacketDecoderTest, ExtractProduceReqV9) {
@@ -204,9 +233,12 @@ TEST(KafkaPacketDecoderTest, ExtractProduceReqV9) {
   ProduceReqTopic topic{.name = "quickstart-events", .partitions = {partition}};
   ProduceReq expected_result{
       .transactional_id = "", .acks = 1, .timeout_ms = 1500, .topics = {topic}};
+  bool orig_flag = FLAGS_stirling_kafka_decode_record_payloads;
+  FLAGS_stirling_kafka_decode_record_payloads = true;
   PacketDecoder decoder(input);
   decoder.SetAPIInfo(APIKey::kProduce, 9);
   EXPECT_OK_AND_EQ(decoder.ExtractProduceReq(), expected_result);
+  FLAGS_stirling_kafka_decode_record_payloads = orig_flag;
 }
 
 TEST(KafkaPacketDecoderTest, ExtractProduceRespV7) {
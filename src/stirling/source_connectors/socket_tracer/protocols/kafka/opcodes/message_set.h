@@ -42,9 +42,14 @@ struct RecordMessage {
 };
 
 struct RecordBatch {
+  // Individual record payloads are only decoded when
+  // FLAGS_stirling_kafka_decode_record_payloads is set. Otherwise records stays empty, and only
+  // the batch-level record_count below is populated.
   std::vector<RecordMessage> records;
+  int32_t record_count = 0;
 
   void ToJSON(utils::JSONObjectBuilder* builder) const {
+    builder->WriteKV("record_count", record_count);
     builder->WriteKVArrayRecursive<RecordMessage>("records", records);
   }
 };
@@ -190,7 +190,9 @@ StatusOr<ParseState> HandleResultsetResponse(DequeView<Packet> resp_packets, Rec
     resp_packets.pop_front();
   }
 
-  std::vector<ResultsetRow> results;
+  // Rows are only validated and counted; their contents are never decoded,
+  // since the exported record only reports the row count.
+  int num_rows = 0;
 
   auto isLastPacket = [](const Packet& p) {
     return (IsErrPacket(p) || IsOKPacket(p) || IsEOFPacket(p));
@@ -200,7 +202,6 @@ StatusOr<ParseState> HandleResultsetResponse(DequeView<Packet> resp_packets, Rec
     const Packet& row_packet = resp_packets.front();
 
     Status s;
-    // TODO(chengruizhe): Get actual results from the resultset row packets if needed.
     // Attempt to process it as a resultset row packet first. Process[Text/Binary]ResultRowPacket
     // functions, if returning ok, indicates with very high confidence that the packet is indeed a
     // resultset row packet. IsOKPacket, on the other hand, is not as robust.
@@ -212,8 +213,7 @@ StatusOr<ParseState> HandleResultsetResponse(DequeView<Packet> resp_packets, Rec
 
     if (s.ok()) {
       resp_packets.pop_front();
-      ResultsetRow row{row_packet.msg};
-      results.emplace_back(std::move(row));
+      ++num_rows;
     } else if (isLastPacket(row_packet)) {
       break;
     } else {
@@ -237,7 +237,7 @@ StatusOr<ParseState> HandleResultsetResponse(DequeView<Packet> resp_packets, Rec
   if (multi_resultset) {
     absl::StrAppend(&entry->resp.msg, ", ");
   }
-  absl::StrAppend(&entry->resp.msg, "Resultset rows = ", results.size());
+  absl::StrAppend(&entry->resp.msg, "Resultset rows = ", num_rows);
 
   // Check for another resultset in case this is a multi-resultset.
   if (MoreResultsExist(last_packet)) {
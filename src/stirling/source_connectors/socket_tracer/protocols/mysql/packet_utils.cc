@@ -101,10 +101,9 @@ Status ProcessTextResultsetRowPacket(const Packet& packet, size_t num_col) {
   if ((packet.msg.length() == 1) && (packet.msg.front() == kResultsetRowNullPrefix)) {
     return Status::OK();
   }
-  std::string result;
   size_t offset = 0;
   for (size_t i = 0; i < num_col; ++i) {
-    PL_RETURN_IF_ERROR(DissectStringParam(packet.msg, &offset, &result));
+    PL_RETURN_IF_ERROR(SkipStringParam(packet.msg, &offset));
   }
 
   // Shouldn't have anything after the length encoded string.
@@ -147,7 +146,8 @@ Status ProcessBinaryResultsetRowPacket(const Packet& packet,
       continue;
     }
 
-    std::string val;
+    // Values are only skipped over for validation; they are not decoded,
+    // since the exported record only reports the row count.
     switch (column_defs[i].column_type) {
       case ColType::kString:
       case ColType::kVarChar:
@@ -162,34 +162,33 @@ Status ProcessBinaryResultsetRowPacket(const Packet& packet,
       case ColType::kBit:
       case ColType::kDecimal:
       case ColType::kNewDecimal:
-        PL_RETURN_IF_ERROR(DissectStringParam(packet.msg, &offset, &val));
+        PL_RETURN_IF_ERROR(SkipStringParam(packet.msg, &offset));
         break;
       case ColType::kLongLong:
-        PL_RETURN_IF_ERROR(DissectIntParam<8>(packet.msg, &offset, &val));
+        PL_RETURN_IF_ERROR(SkipFixedLengthParam<8>(packet.msg, &offset));
         break;
       case ColType::kLong:
       case ColType::kInt24:
-        PL_RETURN_IF_ERROR(DissectIntParam<4>(packet.msg, &offset, &val));
+        PL_RETURN_IF_ERROR(SkipFixedLengthParam<4>(packet.msg, &offset));
         break;
       case ColType::kShort:
       case ColType::kYear:
-        PL_RETURN_IF_ERROR(DissectIntParam<2>(packet.msg, &offset, &val));
+        PL_RETURN_IF_ERROR(SkipFixedLengthParam<2>(packet.msg, &offset));
         break;
       case ColType::kTiny:
-        PL_RETURN_IF_ERROR(DissectIntParam<1>(packet.msg, &offset, &val));
+        PL_RETURN_IF_ERROR(SkipFixedLengthParam<1>(packet.msg, &offset));
         break;
       case ColType::kDouble:
-        PL_RETURN_IF_ERROR(DissectFloatParam<double>(packet.msg, &offset, &val));
+        PL_RETURN_IF_ERROR(SkipFixedLengthParam<sizeof(double)>(packet.msg, &offset));
         break;
       case ColType::kFloat:
-        PL_RETURN_IF_ERROR(DissectFloatParam<float>(packet.msg, &offset, &val));
+        PL_RETURN_IF_ERROR(SkipFixedLengthParam<sizeof(float)>(packet.msg, &offset));
         break;
       case ColType::kDate:
       case ColType::kDateTime:
       case ColType::kTimestamp:
       case ColType::kTime:
-        // TODO(chengruizhe): Implement DissectDateTime correctly.
-        PL_RETURN_IF_ERROR(DissectDateTimeParam(packet.msg, &offset, &val));
+        PL_RETURN_IF_ERROR(SkipDateTimeParam(packet.msg, &offset));
         break;
       default:
         return error::Internal("Unrecognized result column type.");
@@ -95,6 +95,30 @@ Status DissectStringParam(std::string_view msg, size_t* param_offset, std::strin
   return Status::OK();
 }
 
+Status SkipStringParam(std::string_view msg, size_t* offset) {
+  PL_ASSIGN_OR_RETURN(int param_length, ProcessLengthEncodedInt(msg, offset));
+  if (msg.size() < *offset + param_length) {
+    return error::Internal("Not enough bytes to dissect string param.");
+  }
+  *offset += param_length;
+  return Status::OK();
+}
+
+Status SkipDateTimeParam(std::string_view msg, size_t* offset) {
+  if (msg.size() < *offset + 1) {
+    return error::Internal("Not enough bytes to dissect date/time param.");
+  }
+
+  uint8_t length = static_cast<uint8_t>(msg[*offset]);
+  ++*offset;
+
+  if (msg.size() < *offset + length) {
+    return error::Internal("Not enough bytes to dissect date/time param.");
+  }
+  *offset += length;
+  return Status::OK();
+}
+
 template <size_t length>
 Status DissectIntParam(std::string_view msg, size_t* offset, std::string* param) {
   int64_t p;
@@ -58,6 +58,25 @@ Status DissectFloatParam(std::string_view msg, size_t* offset, std::string* pack
 
 Status DissectDateTimeParam(std::string_view msg, size_t* offset, std::string* packet);
 
+/**
+ * Skip variants of the dissectors above. They perform the same validation and advance the offset
+ * past the parameter, but do not materialize the value into a string. Used on hot paths
+ * (e.g. resultset row validation), where the values themselves are never consumed.
+ */
+
+Status SkipStringParam(std::string_view msg, size_t* offset);
+
+template <size_t length>
+Status SkipFixedLengthParam(std::string_view msg, size_t* offset) {
+  if (msg.size() < *offset + length) {
+    return error::Internal("Not enough bytes to skip fixed-length param.");
+  }
+  *offset += length;
+  return Status::OK();
+}
+
+Status SkipDateTimeParam(std::string_view msg, size_t* offset);
+
 // TODO(chengruizhe): infer length from int_type. Will require changes to DissectIntParam as well.
 template <size_t length, typename int_type>
 Status DissectInt(std::string_view msg, size_t* offset, int_type* result) {
@@ -147,6 +147,41 @@ TEST(ProcessStmtExecuteParams, Basics) {
   EXPECT_EQ(offset, 5);
 }
 
+TEST(SkipParams, Basics) {
+  size_t offset;
+
+  // Length-encoded strings:
+
+  offset = 0;
+  EXPECT_OK(SkipStringParam(ConstStringView("\x05"
+                                            "mysql"),
+                            &offset));
+  EXPECT_EQ(offset, 6);
+
+  offset = 0;
+  EXPECT_NOT_OK(SkipStringParam(ConstStringView("\x05"
+                                                "my"),
+                                &offset));
+
+  // Fixed-length values:
+
+  offset = 0;
+  EXPECT_OK(SkipFixedLengthParam<4>(ConstStringView("\x01\x23\x45\x67"), &offset));
+  EXPECT_EQ(offset, 4);
+
+  offset = 0;
+  EXPECT_NOT_OK(SkipFixedLengthParam<4>(ConstStringView("\x01\x23"), &offset));
+
+  // Dates and times (length byte prefix):
+
+  offset = 0;
+  EXPECT_OK(SkipDateTimeParam(ConstStringView("\x04\xda\x07\x0a\x11"), &offset));
+  EXPECT_EQ(offset, 5);
+
+  offset = 0;
+  EXPECT_NOT_OK(SkipDateTimeParam(ConstStringView("\x04\xda"), &offset));
+}
+
 }  // namespace mysql
 }  // namespace protocols
 }  // namespace stirling
@@ -28,6 +28,10 @@
 #include "src/stirling/source_connectors/socket_tracer/protocols/pgsql/parse.h"
 #include "src/stirling/utils/binary_decoder.h"
 
+DEFINE_uint64(stirling_pgsql_data_rows_capture_limit_bytes, 64 * 1024,
+              "The maximum number of DataRow bytes captured per query response. "
+              "Rows beyond the limit are skipped without decoding.");
+
 namespace px {
 namespace stirling {
 namespace protocols {
@@ -88,6 +92,8 @@ Status FillQueryResp(MsgDeqIter* resp_iter, const MsgDeqIter& end, QueryReqResp:
   bool found_cmd_cmpl = false;
   bool found_err_resp = false;
 
+  size_t data_row_bytes = 0;
+
   for (auto& iter = *resp_iter; iter != end; ++iter) {
     if (iter->tag == Tag::kCmdComplete) {
       found_cmd_cmpl = true;
@@ -122,8 +128,14 @@ Status FillQueryResp(MsgDeqIter* resp_iter, const MsgDeqIter& end, QueryReqResp:
     }
 
     if (iter->tag == Tag::kDataRow) {
+      // Rows beyond the capture limit are skipped without decoding; the response payload is
+      // truncated when the record is materialized anyway.
+      if (data_row_bytes >= FLAGS_stirling_pgsql_data_rows_capture_limit_bytes) {
+        continue;
+      }
       DataRow data_row;
       PL_RETURN_IF_ERROR(ParseDataRow(*iter, &data_row));
+      data_row_bytes += iter->payload.size();
       resp->data_rows.push_back(std::move(data_row));
     }
   }
@@ -153,6 +165,8 @@ Status HandleQuery(const RegularMessage& msg, MsgDeqIter* resp_iter, const MsgDe
 
   bool found_resp = false;
 
+  size_t data_row_bytes = 0;
+
   for (auto& iter = *resp_iter; iter != end; ++iter) {
     if (iter->tag == Tag::kEmptyQueryResponse) {
       found_resp = true;
@@ -183,10 +197,16 @@ Status HandleQuery(const RegularMessage& msg, MsgDeqIter* resp_iter, const MsgDe
     }
 
     if (iter->tag == Tag::kDataRow) {
+      req_resp->resp.timestamp_ns = iter->timestamp_ns;
+
+      // Rows beyond the capture limit are skipped without decoding; the response payload is
+      // truncated when the record is materialized anyway.
+      if (data_row_bytes >= FLAGS_stirling_pgsql_data_rows_capture_limit_bytes) {
+        continue;
+      }
       DataRow data_row;
       PL_RETURN_IF_ERROR(ParseDataRow(*iter, &data_row));
-
-      req_resp->resp.timestamp_ns = data_row.timestamp_ns;
+      data_row_bytes += iter->payload.size();
       req_resp->resp.data_rows.push_back(std::move(data_row));
     }
   }
@@ -25,6 +25,8 @@
 #include "src/stirling/source_connectors/socket_tracer/protocols/common/interface.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/pgsql/types.h"
 
+DECLARE_uint64(stirling_pgsql_data_rows_capture_limit_bytes);
+
 namespace px {
 namespace stirling {
 namespace protocols {
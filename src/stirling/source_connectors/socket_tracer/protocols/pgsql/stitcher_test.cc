@@ -68,6 +68,37 @@ TEST(PGSQLParseTest, FillQueryResp) {
   EXPECT_EQ(begin, resps.end());
 }
 
+TEST(PGSQLParseTest, FillQueryRespDataRowCaptureLimit) {
+  uint64_t orig_limit = FLAGS_stirling_pgsql_data_rows_capture_limit_bytes;
+  FLAGS_stirling_pgsql_data_rows_capture_limit_bytes = 1;
+
+  auto row_desc_data = kRowDescTestData;
+  auto data_row_data1 = kDataRowTestData;
+  auto data_row_data2 = kDataRowTestData;
+
+  RegularMessage m1 = {};
+  RegularMessage m2 = {};
+  RegularMessage m3 = {};
+  RegularMessage m4 = {};
+  m4.tag = Tag::kCmdComplete;
+  m4.payload = "SELECT 2";
+
+  EXPECT_EQ(ParseState::kSuccess, ParseRegularMessage(&row_desc_data, &m1));
+  EXPECT_EQ(ParseState::kSuccess, ParseRegularMessage(&data_row_data1, &m2));
+  EXPECT_EQ(ParseState::kSuccess, ParseRegularMessage(&data_row_data2, &m3));
+
+  std::deque<RegularMessage> resps = {m1, m2, m3, m4};
+
+  QueryReqResp::QueryResp query_resp;
+  auto begin = resps.begin();
+  ASSERT_OK(FillQueryResp(&begin, resps.end(), &query_resp));
+  // With a 1-byte limit, only the first data row is captured; the second is skipped.
+  EXPECT_THAT(query_resp.data_rows, SizeIs(1));
+  EXPECT_EQ(begin, resps.end());
+
+  FLAGS_stirling_pgsql_data_rows_capture_limit_bytes = orig_limit;
+}
+
 TEST(PGSQLParseTest, FillQueryRespFailures) {
   std::deque<RegularMessage> resps;
   auto begin = resps.begin();
@@ -233,8 +233,9 @@ struct BindRequest {
 
   // Portal is for maintaining cursored query:
   // https://www.postgresql.org/docs/9.2/plpgsql-cursors.html
-  std::string dest_portal_name;
-  std::string src_prepared_stat_name;
+  // These view into the source frame's payload, and are only valid for its lifetime.
+  std::string_view dest_portal_name;
+  std::string_view src_prepared_stat_name;
   std::vector<Param> params;
   std::vector<FmtCode> res_col_fmt_codes;
 
@@ -324,7 +325,8 @@ struct Desc {
   uint64_t timestamp_ns = 0;
 
   Type type = Type::kStatement;
-  std::string name;
+  // Views into the source frame's payload, and is only valid for its lifetime.
+  std::string_view name;
 
   std::string ToString() const {
     return absl::Substitute("type=$0 name=$1", magic_enum::enum_name(type), name);
@@ -19,6 +19,7 @@
 #include "src/stirling/source_connectors/socket_tracer/protocols/redis/parse.h"
 
 #include <initializer_list>
+#include <limits>
 #include <map>
 #include <optional>
 #include <string>
@@ -28,6 +29,8 @@
 #include <absl/container/flat_hash_map.h>
 
 #include "src/common/base/base.h"
+#include "src/common/base/byte_utils.h"
+#include "src/stirling/source_connectors/socket_tracer/protocols/common/boundary_scan.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/redis/formatting.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/redis/types.h"
 #include "src/stirling/utils/binary_decoder.h"
@@ -48,8 +51,21 @@ constexpr char kArrayMarker = '*';
 constexpr std::string_view kTerminalSequence = "\r\n";
 constexpr int kNullSize = -1;
 
+// Extracts the bytes up to the next terminal sequence, consuming the terminator as well.
+// Equivalent to decoder->ExtractStringUntil(kTerminalSequence), but uses the vectorized substring
+// scan from boundary_scan.h, since this runs for every RESP token.
+StatusOr<std::string_view> ExtractUntilTerminator(BinaryDecoder* decoder) {
+  std::string_view buf = decoder->Buf();
+  size_t pos = FindSubstr(buf, kTerminalSequence, 0);
+  if (pos == std::string_view::npos) {
+    return error::NotFound("Could not find terminal sequence");
+  }
+  decoder->SetBuf(buf.substr(pos + kTerminalSequence.size()));
+  return buf.substr(0, pos);
+}
+
 StatusOr<int> ParseSize(BinaryDecoder* decoder) {
-  PL_ASSIGN_OR_RETURN(std::string_view size_str, decoder->ExtractStringUntil(kTerminalSequence));
+  PL_ASSIGN_OR_RETURN(std::string_view size_str, ExtractUntilTerminator(decoder));
 
   constexpr size_t kSizeStrMaxLen = 16;
   if (size_str.size() > kSizeStrMaxLen) {
@@ -58,14 +74,14 @@ StatusOr<int> ParseSize(BinaryDecoder* decoder) {
         kSizeStrMaxLen);
   }
 
+  // Sizes are short decimal strings on the per-token hot path, so they are converted with the
+  // SWAR decimal parser from byte_utils rather than absl::SimpleAtoi.
   // Length could be -1, which stands for NULL, and means the value is not set.
   // That's different than an empty string, which length is 0.
-  // So here we initialize the value to -2.
-  int size = -2;
-  if (!absl::SimpleAtoi(size_str, &size)) {
+  int size;
+  if (!utils::DecimalStrToInt(size_str, &size)) {
     return error::InvalidArgument("String '$0' cannot be parsed as integer", size_str);
   }
-
   if (size < kNullSize) {
     return error::InvalidArgument("Size cannot be less than $0, got '$1'", kNullSize, size_str);
   }
@@ -122,7 +138,7 @@ Status ParseMessage(message_type_t type, BinaryDecoder* decoder, Message* msg) {
 
   switch (type_marker) {
     case kSimpleStringMarker: {
-      PL_ASSIGN_OR_RETURN(std::string_view str, decoder->ExtractStringUntil(kTerminalSequence));
+      PL_ASSIGN_OR_RETURN(std::string_view str, ExtractUntilTerminator(decoder));
       msg->payload = str;
       break;
     }
@@ -131,12 +147,12 @@ Status ParseMessage(message_type_t type, BinaryDecoder* decoder, Message* msg) {
       break;
     }
     case kErrorMarker: {
-      PL_ASSIGN_OR_RETURN(std::string_view str, decoder->ExtractStringUntil(kTerminalSequence));
+      PL_ASSIGN_OR_RETURN(std::string_view str, ExtractUntilTerminator(decoder));
       msg->payload = str;
       break;
     }
     case kIntegerMarker: {
-      PL_ASSIGN_OR_RETURN(msg->payload, decoder->ExtractStringUntil(kTerminalSequence));
+      PL_ASSIGN_OR_RETURN(msg->payload, ExtractUntilTerminator(decoder));
       break;
     }
     case kArrayMarker: {
@@ -180,15 +196,10 @@ Status ParseArray(message_type_t type, BinaryDecoder* decoder, Message* msg) {
 }  // namespace
 
 size_t FindMessageBoundary(std::string_view buf, size_t start_pos) {
-  for (; start_pos < buf.size(); ++start_pos) {
-    const char type_marker = buf[start_pos];
-    if (type_marker == kSimpleStringMarker || type_marker == kErrorMarker ||
-        type_marker == kIntegerMarker || type_marker == kBulkStringsMarker ||
-        type_marker == kArrayMarker) {
-      return start_pos;
-    }
-  }
-  return std::string_view::npos;
+  static constexpr char kTypeMarkersArray[] = {kSimpleStringMarker, kErrorMarker, kIntegerMarker,
+                                               kBulkStringsMarker, kArrayMarker};
+  static constexpr std::string_view kTypeMarkers(kTypeMarkersArray, sizeof(kTypeMarkersArray));
+  return FindFirstByteOf(buf, kTypeMarkers, start_pos);
 }
 
 // Redis protocol specification: https://redis.io/topics/protocol
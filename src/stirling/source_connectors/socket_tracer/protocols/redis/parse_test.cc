@@ -177,6 +177,10 @@ INSTANTIATE_TEST_SUITE_P(AllDataTypes, ParseInvalidInputTest,
                          ::testing::Values(
                              // Invalid markers
                              "a", "b", "c",
+                             // Size must have at least one digit
+                             "$\r\n",
+                             // Size must be all digits (no explicit '+' sign)
+                             "$+1\r\n", "$12a\r\n",
                              // Bulk string should end with \r\n
                              "$1\r\nabc"
                              // Length cannot be <-1
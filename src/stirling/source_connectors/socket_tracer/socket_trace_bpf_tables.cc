@@ -18,9 +18,12 @@
 
 #include "src/stirling/source_connectors/socket_tracer/socket_trace_bpf_tables.h"
 
+#include <arpa/inet.h>
+
 #include "src/common/fs/fs_wrapper.h"
 #include "src/stirling/bpf_tools/macros.h"
 #include "src/stirling/source_connectors/socket_tracer/conn_trackers_manager.h"
+#include "src/stirling/source_connectors/socket_tracer/metrics.h"
 #include "src/stirling/utils/proc_path_tools.h"
 
 DEFINE_uint32(stirling_conn_map_cleanup_threshold, kMaxConnMapCleanupItems,
@@ -44,7 +47,10 @@ namespace stirling {
 
 ConnInfoMapManager::ConnInfoMapManager(bpf_tools::BCCWrapper* bcc)
     : conn_info_map_(bcc->GetHashTable<uint64_t, struct conn_info_t>("conn_info_map")),
-      conn_disabled_map_(bcc->GetHashTable<uint64_t, uint64_t>("conn_disabled_map")) {
+      conn_disabled_map_(bcc->GetHashTable<uint64_t, uint64_t>("conn_disabled_map")),
+      conn_sampling_map_(bcc->GetHashTable<uint64_t, struct conn_sampling_t>("conn_sampling_map")),
+      endpoint_deny_map_(
+          bcc->GetHashTable<struct endpoint_deny_key_t, uint64_t>("endpoint_deny_map")) {
   // Use address instead of symbol to specify this probe,
   // so that even if debug symbols are stripped, the uprobe can still attach.
   uint64_t symbol_addr = reinterpret_cast<uint64_t>(&ConnInfoMapCleanupTrigger);
@@ -77,10 +83,49 @@ void ConnInfoMapManager::Disable(struct conn_id_t conn_id) {
   }
 }
 
+void ConnInfoMapManager::DisableEndpoint(struct conn_id_t conn_id, uint16_t port,
+                                         enum traffic_protocol_t protocol) {
+  struct endpoint_deny_key_t key = {};
+  key.tgid = conn_id.upid.tgid;
+  key.protocol = protocol;
+  // Ports in conn_info_t sockaddrs are in network byte order.
+  key.port = htons(port);
+
+  uint64_t val = 1;
+  if (!endpoint_deny_map_.update_value(key, val).ok()) {
+    VLOG(1) << absl::Substitute("$0 Updating endpoint_deny_map entry failed.", ToString(conn_id));
+  }
+}
+
+void ConnInfoMapManager::SetSamplingPeriod(struct conn_id_t conn_id, uint64_t period) {
+  uint64_t key = id(conn_id);
+
+  if (period == 0) {
+    conn_sampling_map_.remove_value(key);
+    return;
+  }
+
+  struct conn_sampling_t sampling = {};
+  sampling.tsid = conn_id.tsid;
+  sampling.period = period;
+
+  if (!conn_sampling_map_.update_value(key, sampling).ok()) {
+    VLOG(1) << absl::Substitute("$0 Updating conn_sampling_map entry failed.", ToString(conn_id));
+  }
+}
+
 void ConnInfoMapManager::CleanupBPFMapLeaks(ConnTrackersManager* conn_trackers_mgr) {
   const auto& sysconfig = system::Config::GetInstance();
 
-  for (const auto& [pid_fd, conn_info] : conn_info_map_.get_table_offline()) {
+  // This function already walks the maps, so piggy-back occupancy telemetry on the same scan.
+  const auto conn_info_entries = conn_info_map_.get_table_offline();
+  {
+    BPFMapMetrics& metrics = BPFMapMetrics::GetMapMetrics("conn_info_map");
+    metrics.occupancy.Set(conn_info_entries.size());
+    metrics.capacity.Set(conn_info_map_.capacity());
+  }
+
+  for (const auto& [pid_fd, conn_info] : conn_info_entries) {
     uint32_t pid = pid_fd >> 32;
     int32_t fd = pid_fd;
 
@@ -101,6 +146,26 @@ void ConnInfoMapManager::CleanupBPFMapLeaks(ConnTrackersManager* conn_trackers_m
     VLOG(1) << absl::Substitute("Found conn_info_map leak: pid=$0 fd=$1 af=$2", pid, fd,
                                 conn_info.addr.sa.sa_family);
   }
+
+  const auto endpoint_deny_entries = endpoint_deny_map_.get_table_offline();
+  {
+    BPFMapMetrics& metrics = BPFMapMetrics::GetMapMetrics("endpoint_deny_map");
+    metrics.occupancy.Set(endpoint_deny_entries.size());
+    metrics.capacity.Set(endpoint_deny_map_.capacity());
+  }
+
+  // Endpoint deny rules are scoped to a process, so remove rules whose process has exited.
+  for (const auto& [key, val] : endpoint_deny_entries) {
+    PL_UNUSED(val);
+
+    std::filesystem::path pid_dir = sysconfig.proc_path() / std::to_string(key.tgid);
+    if (fs::Exists(pid_dir)) {
+      continue;
+    }
+
+    endpoint_deny_map_.remove_value(key);
+    VLOG(1) << absl::Substitute("Removed endpoint deny rule of exited pid=$0", key.tgid);
+  }
 }
 
 }  // namespace stirling
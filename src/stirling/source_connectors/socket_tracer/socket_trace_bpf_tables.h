@@ -40,11 +40,22 @@ class ConnInfoMapManager {
 
   void Disable(struct conn_id_t conn_id);
 
+  // Installs an endpoint deny rule for the connection's (tgid, remote port, protocol),
+  // so BPF suppresses data events of future connections matching the same key
+  // (e.g. recurring health-check connections), not just the current connection generation.
+  void DisableEndpoint(struct conn_id_t conn_id, uint16_t port, enum traffic_protocol_t protocol);
+
+  // Switches a connection to sampled data capture, where only every `period`-th data event
+  // carries its payload. A period of 0 restores full capture.
+  void SetSamplingPeriod(struct conn_id_t conn_id, uint64_t period);
+
   void CleanupBPFMapLeaks(ConnTrackersManager* conn_trackers_mgr);
 
  private:
   ebpf::BPFHashTable<uint64_t, struct conn_info_t> conn_info_map_;
   ebpf::BPFHashTable<uint64_t, uint64_t> conn_disabled_map_;
+  ebpf::BPFHashTable<uint64_t, struct conn_sampling_t> conn_sampling_map_;
+  ebpf::BPFHashTable<struct endpoint_deny_key_t, uint64_t> endpoint_deny_map_;
 
   std::vector<struct conn_id_t> pending_release_queue_;
 
@@ -42,10 +42,11 @@
 #include "src/stirling/source_connectors/socket_tracer/bcc_bpf_intf/go_grpc_types.hpp"
 #include "src/stirling/source_connectors/socket_tracer/bcc_bpf_intf/socket_trace.hpp"
 #include "src/stirling/source_connectors/socket_tracer/conn_stats.h"
+#include "src/stirling/source_connectors/socket_tracer/fd_resolver.h"
+#include "src/stirling/source_connectors/socket_tracer/metrics.h"
 #include "src/stirling/source_connectors/socket_tracer/proto/sock_event.pb.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/http/utils.h"
 #include "src/stirling/source_connectors/socket_tracer/protocols/http2/grpc.h"
-#include "src/stirling/utils/linux_headers.h"
 #include "src/stirling/utils/proc_path_tools.h"
 
 // 50 X less often than the normal sampling frequency. Based on the conn_stats_table.h's
@@ -71,6 +72,11 @@ DEFINE_string(socket_trace_data_events_output_path, "",
               "If not empty, specifies the path & format to a file to which the socket tracer "
               "writes data events. If the filename ends with '.bin', the events are serialized in "
               "binary format; otherwise, text format.");
+DEFINE_string(stirling_socket_trace_capture_path, "",
+              "If not empty, specifies the path to a file to which the socket tracer writes all "
+              "data and control events, in arrival order, as delimited binary protobufs. The "
+              "resulting capture can be replayed through the userspace pipeline with "
+              "socket_trace_replay_driver, with no kernel involved.");
 
 // PROTOCOL_LIST: Requires update on new protocols.
 DEFINE_int32(stirling_enable_http_tracing, px::stirling::TraceMode::On,
@@ -126,6 +132,12 @@ DEFINE_double(stirling_socket_tracer_max_total_bw_overprovision_factor, 1,
               "Factor to overprovision maximum total bandwidth, to account for the fact that "
               "traffic won't be exactly evenly distributed over all cpus.");
 
+DEFINE_uint32(stirling_conn_map_entries, 0,
+              "Number of entries in the BPF conn_info_map. The default of 0 derives the size from "
+              "the core count, so small nodes don't waste memory and large nodes don't evict "
+              "active connections.");
+
+
 DEFINE_uint32(messages_expiry_duration_secs, 1 * 60,
               "The duration after which a parsed message is erased.");
 DEFINE_uint32(messages_size_limit_bytes, 1024 * 1024,
@@ -398,6 +410,47 @@ Status SocketTraceConnector::InitBPF() {
       absl::StrCat("-DENABLE_AMQP_TRACING=", FLAGS_stirling_enable_amqp_tracing),
       absl::StrCat("-DENABLE_MONGO_TRACING=", "true"),
   };
+
+  uint32_t conn_map_entries = FLAGS_stirling_conn_map_entries;
+  if (conn_map_entries == 0) {
+    // Scale with core count as a proxy for expected connection volume, within sane bounds.
+    constexpr uint32_t kConnMapEntriesPerCore = 8192;
+    constexpr uint32_t kMinConnMapEntries = 16384;
+    constexpr uint32_t kMaxConnMapEntries = 262144;
+    conn_map_entries = std::clamp<uint32_t>(get_nprocs_conf() * kConnMapEntriesPerCore,
+                                            kMinConnMapEntries, kMaxConnMapEntries);
+  }
+  LOG(INFO) << absl::Substitute("Sizing conn_info_map with $0 entries", conn_map_entries);
+  defines.push_back(absl::StrCat("-DCONN_MAP_SIZE=", conn_map_entries));
+
+  use_ringbuf_ = UseRingBufOutput();
+
+  if (use_ringbuf_) {
+    // Ring buffers are shared across CPUs, so they are sized to the max total bandwidth
+    // (the same cap that bounds the sum of the per-CPU perf buffers).
+    const double seconds_per_period =
+        std::chrono::duration_cast<std::chrono::milliseconds>(kSamplingPeriod).count() / 1000.0;
+    const int64_t data_size_bytes =
+        static_cast<int64_t>(FLAGS_stirling_socket_tracer_max_total_bw_overprovision_factor *
+                             FLAGS_stirling_socket_tracer_max_total_data_bw * seconds_per_period);
+    const int64_t control_size_bytes = static_cast<int64_t>(
+        FLAGS_stirling_socket_tracer_max_total_bw_overprovision_factor *
+        FLAGS_stirling_socket_tracer_max_total_control_bw * seconds_per_period);
+
+    // Ring buffers must be sized to a power of 2 pages.
+    const int64_t page_size_bytes = system::Config::GetInstance().PageSizeBytes();
+    const int64_t data_pages = IntRoundUpToPow2(IntRoundUpDivide(data_size_bytes, page_size_bytes));
+    const int64_t control_pages =
+        IntRoundUpToPow2(IntRoundUpDivide(control_size_bytes, page_size_bytes));
+
+    LOG(INFO) << absl::Substitute(
+        "Using BPF ring buffer output [data_pages=$0 control_pages=$1 page_size=$2]", data_pages,
+        control_pages, page_size_bytes);
+    defines.push_back("-DUSE_RINGBUF");
+    defines.push_back(absl::StrCat("-DDATA_EVENTS_RINGBUF_PAGES=", data_pages));
+    defines.push_back(absl::StrCat("-DCONTROL_EVENTS_RINGBUF_PAGES=", control_pages));
+  }
+
   PL_RETURN_IF_ERROR(InitBPFProgram(socket_trace_bcc_script, defines));
 
   PL_RETURN_IF_ERROR(AttachKProbes(kProbeSpecs));
@@ -405,8 +458,35 @@ Status SocketTraceConnector::InitBPF() {
   LOG(INFO) << "Probes successfully deployed.";
 
   const auto kPerfBufferSpecs = InitPerfBufferSpecs();
-  PL_RETURN_IF_ERROR(OpenPerfBuffers(kPerfBufferSpecs, this));
-  LOG(INFO) << absl::Substitute("Number of perf buffers opened = $0", kPerfBufferSpecs.size());
+  if (use_ringbuf_) {
+    const auto kRingBufferSpecs = MakeArray<bpf_tools::RingBufferSpec>({
+        {"socket_data_events", HandleDataEventRingBuf},
+        {"socket_control_events", HandleControlEventRingBuf},
+        {"conn_stats_events", HandleConnStatsEventRingBuf},
+        {"mmap_events", HandleMMapEventRingBuf},
+    });
+    PL_RETURN_IF_ERROR(OpenRingBuffers(kRingBufferSpecs, this));
+    LOG(INFO) << absl::Substitute("Number of ring buffers opened = $0", kRingBufferSpecs.size());
+
+    // The uprobe-based outputs (go_grpc_events, grpc_c_*) are declared in separate BPF source
+    // files and remain on perf buffers.
+    auto is_ringbuf_output = [&](std::string_view name) {
+      for (const auto& r : kRingBufferSpecs) {
+        if (r.name == name) {
+          return true;
+        }
+      }
+      return false;
+    };
+    for (const auto& spec : kPerfBufferSpecs) {
+      if (!is_ringbuf_output(spec.name)) {
+        PL_RETURN_IF_ERROR(OpenPerfBuffer(spec, this));
+      }
+    }
+  } else {
+    PL_RETURN_IF_ERROR(OpenPerfBuffers(kPerfBufferSpecs, this));
+    LOG(INFO) << absl::Substitute("Number of perf buffers opened = $0", kPerfBufferSpecs.size());
+  }
 
   // Set trace role to BPF probes.
   for (const auto& p : magic_enum::enum_values<traffic_protocol_t>()) {
@@ -426,6 +506,9 @@ Status SocketTraceConnector::InitBPF() {
   if (!FLAGS_socket_trace_data_events_output_path.empty()) {
     SetupOutput(FLAGS_socket_trace_data_events_output_path);
   }
+  if (!FLAGS_stirling_socket_trace_capture_path.empty()) {
+    SetupCapture(FLAGS_stirling_socket_trace_capture_path);
+  }
 
   return Status::OK();
 }
@@ -490,6 +573,9 @@ Status SocketTraceConnector::StopImpl() {
   if (perf_buffer_events_output_stream_ != nullptr) {
     perf_buffer_events_output_stream_->close();
   }
+  if (capture_stream_ != nullptr) {
+    capture_stream_->close();
+  }
 
   // Wait for all threads to finish.
   while (uprobe_mgr_.ThreadsRunning()) {
@@ -553,6 +639,7 @@ std::string BPFMapsInfo(bpf_tools::BCCWrapper* bcc) {
   out += BPFMapInfo<void*, struct go_grpc_event_attr_t>(bcc, "active_write_headers_frame_map");
   out += BPFMapInfo<uint64_t, struct conn_info_t>(bcc, "conn_info_map");
   out += BPFMapInfo<uint64_t, uint64_t>(bcc, "conn_disabled_map");
+  out += BPFMapInfo<struct endpoint_deny_key_t, uint64_t>(bcc, "endpoint_deny_map");
   out += BPFMapInfo<uint64_t, struct accept_args_t>(bcc, "active_accept_args_map");
   out += BPFMapInfo<uint64_t, struct connect_args_t>(bcc, "active_connect_args_map");
   out += BPFMapInfo<uint64_t, struct data_args_t>(bcc, "active_write_args_map");
@@ -578,10 +665,16 @@ void SocketTraceConnector::UpdateCommonState(ConnectorContext* ctx) {
   // It may be worth noting during debug.
   PollPerfBuffers();
 
+  if (use_ringbuf_) {
+    PollRingBuffers();
+    CheckRingBufferDrops();
+  }
+
   // Set-up current state for connection inference purposes.
   if (socket_info_mgr_ != nullptr) {
     socket_info_mgr_->Flush();
   }
+  FDLinkCache::GetInstance().AdvanceGeneration();
 
   // Deploy uprobes on newly discovered PIDs.
   std::thread thread = RunDeployUProbesThread(ctx->GetUPIDs());
@@ -757,6 +850,7 @@ void SocketTraceConnector::HandleDataEventLoss(void* cb_cookie, uint64_t lost) {
   DCHECK(cb_cookie != nullptr) << "Perf buffer callback not set-up properly. Missing cb_cookie.";
   static_cast<SocketTraceConnector*>(cb_cookie)->stats_.Increment(StatKey::kLossSocketDataEvent,
                                                                   lost);
+  PerfBufferMetrics::GetPerfBufferMetrics("socket_data_events").lost_events.Increment(lost);
 }
 
 void SocketTraceConnector::HandleControlEvent(void* cb_cookie, void* data, int /*data_size*/) {
@@ -769,6 +863,7 @@ void SocketTraceConnector::HandleControlEventLoss(void* cb_cookie, uint64_t lost
   DCHECK(cb_cookie != nullptr) << "Perf buffer callback not set-up properly. Missing cb_cookie.";
   static_cast<SocketTraceConnector*>(cb_cookie)->stats_.Increment(StatKey::kLossSocketControlEvent,
                                                                   lost);
+  PerfBufferMetrics::GetPerfBufferMetrics("socket_control_events").lost_events.Increment(lost);
 }
 
 void SocketTraceConnector::HandleConnStatsEvent(void* cb_cookie, void* data, int /*data_size*/) {
@@ -781,6 +876,7 @@ void SocketTraceConnector::HandleConnStatsEventLoss(void* cb_cookie, uint64_t lo
   DCHECK(cb_cookie != nullptr) << "Perf buffer callback not set-up properly. Missing cb_cookie.";
   static_cast<SocketTraceConnector*>(cb_cookie)->stats_.Increment(StatKey::kLossConnStatsEvent,
                                                                   lost);
+  PerfBufferMetrics::GetPerfBufferMetrics("conn_stats_events").lost_events.Increment(lost);
 }
 
 void SocketTraceConnector::HandleMMapEvent(void* cb_cookie, void* data, int /*data_size*/) {
@@ -792,6 +888,77 @@ void SocketTraceConnector::HandleMMapEvent(void* cb_cookie, void* data, int /*da
 void SocketTraceConnector::HandleMMapEventLoss(void* cb_cookie, uint64_t lost) {
   DCHECK(cb_cookie != nullptr) << "Perf buffer callback not set-up properly. Missing cb_cookie.";
   static_cast<SocketTraceConnector*>(cb_cookie)->stats_.Increment(StatKey::kLossMMapEvent, lost);
+  PerfBufferMetrics::GetPerfBufferMetrics("mmap_events").lost_events.Increment(lost);
+}
+
+//-----------------------------------------------------------------------------
+// Ring Buffer Callback functions.
+//-----------------------------------------------------------------------------
+
+// These shims adapt the ring buffer callback signature to the perf buffer handlers above,
+// so both transports share a single event-handling path.
+
+int SocketTraceConnector::HandleDataEventRingBuf(void* cb_cookie, void* data, size_t data_size) {
+  HandleDataEvent(cb_cookie, data, data_size);
+  return 0;
+}
+
+int SocketTraceConnector::HandleControlEventRingBuf(void* cb_cookie, void* data, size_t data_size) {
+  HandleControlEvent(cb_cookie, data, data_size);
+  return 0;
+}
+
+int SocketTraceConnector::HandleConnStatsEventRingBuf(void* cb_cookie, void* data,
+                                                      size_t data_size) {
+  HandleConnStatsEvent(cb_cookie, data, data_size);
+  return 0;
+}
+
+int SocketTraceConnector::HandleMMapEventRingBuf(void* cb_cookie, void* data, size_t data_size) {
+  HandleMMapEvent(cb_cookie, data, data_size);
+  return 0;
+}
+
+void SocketTraceConnector::CheckRingBufferDrops() {
+  auto drop_counters_handle = GetPerCPUArrayTable<uint64_t>("ringbuf_drop_counters");
+
+  for (int i = 0; i < kNumRingBufOutputs; ++i) {
+    std::vector<uint64_t> percpu_drops;
+    ebpf::StatusTuple s = drop_counters_handle.get_value(i, percpu_drops);
+    if (!s.ok()) {
+      VLOG(1) << absl::Substitute("Failed to read ringbuf_drop_counters[$0] msg=$1", i, s.msg());
+      continue;
+    }
+
+    uint64_t total_drops = 0;
+    for (uint64_t cpu_drops : percpu_drops) {
+      total_drops += cpu_drops;
+    }
+
+    // The BPF-side counters are monotonic; report only the delta since the last poll,
+    // through the same path as the perf buffer loss callbacks.
+    DCHECK_GE(total_drops, ringbuf_drops_prev_[i]);
+    uint64_t new_drops = total_drops - ringbuf_drops_prev_[i];
+    ringbuf_drops_prev_[i] = total_drops;
+    if (new_drops == 0) {
+      continue;
+    }
+
+    switch (i) {
+      case kRingBufOutputSocketData:
+        HandleDataEventLoss(this, new_drops);
+        break;
+      case kRingBufOutputSocketControl:
+        HandleControlEventLoss(this, new_drops);
+        break;
+      case kRingBufOutputConnStats:
+        HandleConnStatsEventLoss(this, new_drops);
+        break;
+      case kRingBufOutputMMap:
+        HandleMMapEventLoss(this, new_drops);
+        break;
+    }
+  }
 }
 
 void SocketTraceConnector::HandleHTTP2Event(void* cb_cookie, void* data, int /*data_size*/) {
@@ -837,6 +1004,7 @@ void SocketTraceConnector::HandleHTTP2Event(void* cb_cookie, void* data, int /*d
 void SocketTraceConnector::HandleHTTP2EventLoss(void* cb_cookie, uint64_t lost) {
   DCHECK(cb_cookie != nullptr) << "Perf buffer callback not set-up properly. Missing cb_cookie.";
   static_cast<SocketTraceConnector*>(cb_cookie)->stats_.Increment(StatKey::kLossHTTP2Event, lost);
+  PerfBufferMetrics::GetPerfBufferMetrics("go_grpc_events").lost_events.Increment(lost);
 }
 
 void SocketTraceConnector::HandleGrpcCHeaderEvent(void* cb_cookie, void* data, int /*data_size*/) {
@@ -879,18 +1047,21 @@ void SocketTraceConnector::HandleGrpcCCloseEvent(void* cb_cookie, void* data, in
 void SocketTraceConnector::HandleGrpcCDataLoss(void* cb_cookie, uint64_t lost) {
   DCHECK(cb_cookie != nullptr) << "Perf buffer callback not set-up properly. Missing cb_cookie.";
   static_cast<SocketTraceConnector*>(cb_cookie)->stats_.Increment(StatKey::kLossGrpcCEvent, lost);
+  PerfBufferMetrics::GetPerfBufferMetrics("grpc_c_events").lost_events.Increment(lost);
 }
 
 void SocketTraceConnector::HandleGrpcCHeaderDataLoss(void* cb_cookie, uint64_t lost) {
   DCHECK(cb_cookie != nullptr) << "Perf buffer callback not set-up properly. Missing cb_cookie.";
   static_cast<SocketTraceConnector*>(cb_cookie)->stats_.Increment(StatKey::kLossGrpcCHeaderEvent,
                                                                   lost);
+  PerfBufferMetrics::GetPerfBufferMetrics("grpc_c_header_events").lost_events.Increment(lost);
 }
 
 void SocketTraceConnector::HandleGrpcCCloseDataLoss(void* cb_cookie, uint64_t lost) {
   DCHECK(cb_cookie != nullptr) << "Perf buffer callback not set-up properly. Missing cb_cookie.";
   static_cast<SocketTraceConnector*>(cb_cookie)->stats_.Increment(StatKey::kLossGrpcCCloseEvent,
                                                                   lost);
+  PerfBufferMetrics::GetPerfBufferMetrics("grpc_c_close_events").lost_events.Increment(lost);
 }
 
 //-----------------------------------------------------------------------------
@@ -908,6 +1079,9 @@ void SocketTraceConnector::AcceptDataEvent(std::unique_ptr<SocketDataEvent> even
   if (perf_buffer_events_output_stream_ != nullptr) {
     WriteDataEvent(*event);
   }
+  if (capture_stream_ != nullptr) {
+    CaptureDataEvent(*event);
+  }
 
   stats_.Increment(StatKey::kPollSocketDataEventCount);
   stats_.Increment(StatKey::kPollSocketDataEventAttrSize, sizeof(event->attr));
@@ -918,6 +1092,10 @@ void SocketTraceConnector::AcceptDataEvent(std::unique_ptr<SocketDataEvent> even
 }
 
 void SocketTraceConnector::AcceptControlEvent(socket_control_event_t event) {
+  if (capture_stream_ != nullptr) {
+    CaptureControlEvent(event);
+  }
+
   ConnTracker& tracker = GetOrCreateConnTracker(event.conn_id);
   tracker.AddControlEvent(event);
 }
@@ -1122,12 +1300,12 @@ void SocketTraceConnector::AppendMessage(ConnectorContext* ctx, const ConnTracke
   r.Append<r.ColIndex("major_version")>(1);
   r.Append<r.ColIndex("minor_version")>(resp_message.minor_version);
   r.Append<r.ColIndex("content_type")>(static_cast<uint64_t>(content_type));
-  r.Append<r.ColIndex("req_headers")>(ToJSONString(req_message.headers), kMaxHTTPHeadersBytes);
+  r.Append<r.ColIndex("req_headers")>(ToJSONString(req_message.headers()), kMaxHTTPHeadersBytes);
   r.Append<r.ColIndex("req_method")>(std::move(req_message.req_method));
   r.Append<r.ColIndex("req_path")>(std::move(req_message.req_path));
   r.Append<r.ColIndex("req_body_size")>(req_message.body_size);
   r.Append<r.ColIndex("req_body")>(std::move(req_message.body), FLAGS_max_body_bytes);
-  r.Append<r.ColIndex("resp_headers")>(ToJSONString(resp_message.headers), kMaxHTTPHeadersBytes);
+  r.Append<r.ColIndex("resp_headers")>(ToJSONString(resp_message.headers()), kMaxHTTPHeadersBytes);
   r.Append<r.ColIndex("resp_status")>(resp_message.resp_status);
   r.Append<r.ColIndex("resp_message")>(std::move(resp_message.resp_message));
   r.Append<r.ColIndex("resp_body_size")>(resp_message.body_size);
@@ -1465,6 +1643,29 @@ void SocketDataEventToPB(const SocketDataEvent& event, sockeventpb::SocketDataEv
   pb->mutable_attr()->set_msg_size(event.attr.msg_size);
   pb->set_msg(std::string(event.msg));
 }
+
+void SocketControlEventToPB(const socket_control_event_t& event,
+                            sockeventpb::SocketControlEvent* pb) {
+  pb->set_type(event.type);
+  pb->set_timestamp_ns(event.timestamp_ns);
+  pb->mutable_conn_id()->set_pid(event.conn_id.upid.pid);
+  pb->mutable_conn_id()->set_start_time_ns(event.conn_id.upid.start_time_ticks);
+  pb->mutable_conn_id()->set_fd(event.conn_id.fd);
+  pb->mutable_conn_id()->set_generation(event.conn_id.tsid);
+  pb->set_source_fn(event.source_fn);
+  switch (event.type) {
+    case kConnOpen:
+      pb->set_role(event.open.role);
+      // The raw sockaddr bytes, exactly as BPF reported them.
+      pb->set_addr(std::string(reinterpret_cast<const char*>(&event.open.addr),
+                               sizeof(event.open.addr)));
+      break;
+    case kConnClose:
+      pb->set_wr_bytes(event.close.wr_bytes);
+      pb->set_rd_bytes(event.close.rd_bytes);
+      break;
+  }
+}
 }  // namespace
 
 void SocketTraceConnector::WriteDataEvent(const SocketDataEvent& event) {
@@ -1491,6 +1692,34 @@ void SocketTraceConnector::WriteDataEvent(const SocketDataEvent& event) {
   }
 }
 
+void SocketTraceConnector::SetupCapture(const std::filesystem::path& path) {
+  DCHECK(!path.empty());
+
+  std::filesystem::path abs_path = std::filesystem::absolute(path);
+  capture_stream_ = std::make_unique<std::ofstream>(abs_path, std::ios::binary);
+  LOG(INFO) << absl::Substitute("Capturing data & control events to: $0.", abs_path.string());
+}
+
+void SocketTraceConnector::CaptureDataEvent(const SocketDataEvent& event) {
+  using ::google::protobuf::util::SerializeDelimitedToOstream;
+
+  DCHECK(capture_stream_ != nullptr);
+
+  sockeventpb::CapturedEvent pb;
+  SocketDataEventToPB(event, pb.mutable_data_event());
+  SerializeDelimitedToOstream(pb, capture_stream_.get());
+}
+
+void SocketTraceConnector::CaptureControlEvent(const socket_control_event_t& event) {
+  using ::google::protobuf::util::SerializeDelimitedToOstream;
+
+  DCHECK(capture_stream_ != nullptr);
+
+  sockeventpb::CapturedEvent pb;
+  SocketControlEventToPB(event, pb.mutable_control_event());
+  SerializeDelimitedToOstream(pb, capture_stream_.get());
+}
+
 //-----------------------------------------------------------------------------
 // TransferData Helpers
 //-----------------------------------------------------------------------------
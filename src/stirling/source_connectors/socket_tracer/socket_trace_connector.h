@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <array>
 #include <fstream>
 #include <list>
 #include <map>
@@ -175,12 +176,24 @@ class SocketTraceConnector : public SourceConnector, public bpf_tools::BCCWrappe
   static void HandleGrpcCCloseEvent(void* cb_cookie, void* data, int data_size);
   static void HandleGrpcCCloseDataLoss(void* cb_cookie, uint64_t lost);
 
+  // Ring buffer poll callback functions (must be static).
+  // These are thin shims over the perf buffer handlers above, adapting the ring buffer
+  // callback signature (returns int, size_t data_size).
+  static int HandleDataEventRingBuf(void* cb_cookie, void* data, size_t data_size);
+  static int HandleControlEventRingBuf(void* cb_cookie, void* data, size_t data_size);
+  static int HandleConnStatsEventRingBuf(void* cb_cookie, void* data, size_t data_size);
+  static int HandleMMapEventRingBuf(void* cb_cookie, void* data, size_t data_size);
+
   explicit SocketTraceConnector(std::string_view source_name);
 
   Status InitBPF();
   auto InitPerfBufferSpecs();
   void InitProtocolTransferSpecs();
 
+  // Reads the BPF-side ring buffer drop counters, and reports any new drops since the last
+  // call through the same loss-handling path as the perf buffer loss callbacks.
+  void CheckRingBufferDrops();
+
   ConnTracker& GetOrCreateConnTracker(struct conn_id_t conn_id);
 
   // Events from BPF.
@@ -224,6 +237,14 @@ class SocketTraceConnector : public SourceConnector, public bpf_tools::BCCWrappe
   // Writes data event to the specified output file.
   void WriteDataEvent(const SocketDataEvent& event);
 
+  // Sets up the capture file stream writing to the input file path.
+  void SetupCapture(const std::filesystem::path& file);
+
+  // Write data/control events to the capture file, in arrival order,
+  // as delimited sockeventpb::CapturedEvent messages.
+  void CaptureDataEvent(const SocketDataEvent& event);
+  void CaptureControlEvent(const socket_control_event_t& event);
+
   ConnTrackersManager conn_trackers_mgr_;
 
   ConnStats conn_stats_;
@@ -265,6 +286,14 @@ class SocketTraceConnector : public SourceConnector, public bpf_tools::BCCWrappe
   //   Example: data_table->SetConsumeRecordsCutoffTime(perf_buffer_drain_time_);
   uint64_t perf_buffer_drain_time_ = 0;
 
+  // Whether the socket_trace.c outputs use BPF ring buffers instead of per-CPU perf buffers.
+  // Set during InitBPF() based on FLAGS_stirling_enable_ringbuf_output and the kernel version.
+  bool use_ringbuf_ = false;
+
+  // Previously observed values of the BPF-side ring buffer drop counters,
+  // used by CheckRingBufferDrops() to compute deltas.
+  std::array<uint64_t, kNumRingBufOutputs> ringbuf_drops_prev_ = {};
+
   // If not a nullptr, writes the events received from perf buffers to this stream.
   std::unique_ptr<std::ofstream> perf_buffer_events_output_stream_;
   enum class OutputFormat {
@@ -273,6 +302,10 @@ class SocketTraceConnector : public SourceConnector, public bpf_tools::BCCWrappe
   };
   OutputFormat perf_buffer_events_output_format_ = OutputFormat::kTxt;
 
+  // If not a nullptr, writes both data and control events to this stream, in arrival order,
+  // for offline replay. See --stirling_socket_trace_capture_path.
+  std::unique_ptr<std::ofstream> capture_stream_;
+
   // Portal to query for connections, by pid and inode.
   std::unique_ptr<system::SocketInfoManager> socket_info_mgr_;
 
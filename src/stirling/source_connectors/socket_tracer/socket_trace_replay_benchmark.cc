@@ -0,0 +1,189 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fcntl.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include <benchmark/benchmark.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/util/delimited_message_util.h>
+
+#include "src/stirling/core/connector_context.h"
+#include "src/stirling/source_connectors/socket_tracer/proto/sock_event.pb.h"
+#include "src/stirling/source_connectors/socket_tracer/socket_trace_connector.h"
+#include "src/stirling/source_connectors/socket_tracer/testing/socket_trace_connector_friend.h"
+#include "src/stirling/testing/common.h"
+
+DEFINE_string(replay_file, "",
+              "Path to a binary file of recorded SocketDataEvents, as written by "
+              "--socket_trace_data_events_output_path with a .bin suffix.");
+DEFINE_uint64(replay_events_per_poll, 1024,
+              "Number of replayed events pushed between emulated polling iterations. Each batch "
+              "is followed by a TransferData call, mimicking the production drain cadence.");
+
+using ::benchmark::Counter;
+using ::px::stirling::SocketTraceConnector;
+using ::px::stirling::SocketTraceConnectorFriend;
+using ::px::stirling::SystemWideStandaloneContext;
+using ::px::stirling::testing::DataTables;
+
+namespace {
+
+struct ReplayData {
+  std::vector<socket_data_event_t> events;
+  // Total size of all event payloads, excluding socket_data_event_t::attr.
+  uint64_t data_size_bytes = 0;
+};
+
+socket_data_event_t EventFromPB(const px::stirling::sockeventpb::SocketDataEvent& pb) {
+  socket_data_event_t event = {};
+  event.attr.timestamp_ns = pb.attr().timestamp_ns();
+  event.attr.conn_id.upid.pid = pb.attr().conn_id().pid();
+  event.attr.conn_id.upid.start_time_ticks = pb.attr().conn_id().start_time_ns();
+  event.attr.conn_id.fd = pb.attr().conn_id().fd();
+  event.attr.conn_id.tsid = pb.attr().conn_id().generation();
+  event.attr.protocol = static_cast<traffic_protocol_t>(pb.attr().protocol());
+  event.attr.role = static_cast<endpoint_role_t>(pb.attr().role());
+  event.attr.direction = static_cast<traffic_direction_t>(pb.attr().direction());
+  event.attr.pos = pb.attr().pos();
+  event.attr.msg_size = pb.attr().msg_size();
+
+  size_t copy_size = std::min(pb.msg().size(), sizeof(event.msg));
+  event.attr.msg_buf_size = copy_size;
+  std::memcpy(event.msg, pb.msg().data(), copy_size);
+
+  return event;
+}
+
+px::StatusOr<ReplayData> LoadRecordedEvents(const std::string& path) {
+  using ::google::protobuf::io::FileInputStream;
+  using ::google::protobuf::util::ParseDelimitedFromZeroCopyStream;
+
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return px::error::NotFound("Could not open replay file $0", path);
+  }
+  FileInputStream input(fd);
+
+  ReplayData replay;
+  px::stirling::sockeventpb::SocketDataEvent pb;
+  bool clean_eof = true;
+  while (ParseDelimitedFromZeroCopyStream(&pb, &input, &clean_eof)) {
+    replay.events.push_back(EventFromPB(pb));
+    replay.data_size_bytes += replay.events.back().attr.msg_buf_size;
+  }
+  close(fd);
+
+  if (!clean_eof) {
+    return px::error::Internal("Replay file $0 is truncated or corrupt", path);
+  }
+  if (replay.events.empty()) {
+    return px::error::Internal("Replay file $0 contains no events", path);
+  }
+
+  return replay;
+}
+
+void CountOutput(DataTables* tables, uint64_t* output_records, uint64_t* output_bytes) {
+  for (auto tbl : tables->tables()) {
+    auto tagged_records = tbl->ConsumeRecords();
+    for (auto tagged_record : tagged_records) {
+      if (tagged_record.records.size() > 0) {
+        *output_records += tagged_record.records[0]->Size();
+      }
+      for (auto column_wrapper : tagged_record.records) {
+        *output_bytes += column_wrapper->Bytes();
+      }
+    }
+  }
+}
+
+}  // namespace
+
+// Replays recorded SocketDataEvent streams through the full userspace pipeline
+// (protocol inference, DataStream buffering, ParseFrames and StitchFrames), reporting
+// MB/s of input traffic and records/s of output. Unlike socket_trace_connector_benchmark,
+// which uses synthetic generators, this measures parser throughput against real recorded
+// traffic shapes.
+//
+// To record traffic, run stirling_wrapper on a representative node with
+// --socket_trace_data_events_output_path=/path/to/events.bin, then point --replay_file at
+// the result.
+
+// NOLINTNEXTLINE: runtime/references.
+static void BM_ReplayRecordedEvents(benchmark::State& state) {
+  if (FLAGS_replay_file.empty()) {
+    state.SkipWithError("--replay_file is required. See the comment above this benchmark.");
+    return;
+  }
+  auto replay_or = LoadRecordedEvents(FLAGS_replay_file);
+  if (!replay_or.ok()) {
+    state.SkipWithError(std::string(replay_or.msg()).c_str());
+    return;
+  }
+  ReplayData replay = replay_or.ConsumeValueOrDie();
+
+  SystemWideStandaloneContext ctx;
+  uint64_t total_output_records = 0;
+  uint64_t total_output_bytes = 0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    {
+      auto source_connector = SocketTraceConnectorFriend::Create("socket_trace_connector");
+      auto* socket_trace_connector =
+          static_cast<SocketTraceConnectorFriend*>(source_connector.get());
+
+      DataTables tables(SocketTraceConnector::kTables);
+      // Run TransferData once so per-iteration setup costs aren't attributed to the replay.
+      source_connector->TransferData(&ctx, tables.tables());
+      state.ResumeTiming();
+
+      size_t i = 0;
+      while (i < replay.events.size()) {
+        size_t batch_end = std::min(i + FLAGS_replay_events_per_poll, replay.events.size());
+        for (; i < batch_end; ++i) {
+          auto& event = replay.events[i];
+          socket_trace_connector->HandleDataEvent(
+              &event, sizeof(socket_data_event_t::attr) + event.attr.msg_size);
+        }
+        source_connector->TransferData(&ctx, tables.tables());
+      }
+
+      state.PauseTiming();
+      CountOutput(&tables, &total_output_records, &total_output_bytes);
+    }
+    state.ResumeTiming();
+  }
+
+  // SetBytesProcessed() reports input throughput in bytes/s (i.e. MB/s at typical scales).
+  state.SetBytesProcessed(replay.data_size_bytes * state.iterations());
+  state.counters["EventsInput"] = Counter(replay.events.size());
+  state.counters["RecordsOutput"] = Counter(total_output_records / state.iterations());
+  state.counters["RecordsPerSec"] = Counter(total_output_records, Counter::kIsRate);
+  state.counters["BytesOutput"] =
+      Counter(total_output_bytes / state.iterations(), Counter::kDefaults, Counter::OneK::kIs1024);
+}
+
+BENCHMARK(BM_ReplayRecordedEvents)->Unit(benchmark::kMillisecond);
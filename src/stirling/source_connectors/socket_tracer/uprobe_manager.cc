@@ -22,8 +22,10 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <map>
+#include <thread>
 
 #include "src/common/base/base.h"
 #include "src/common/base/utils.h"
@@ -41,6 +43,9 @@ DEFINE_bool(stirling_rescan_for_dlopen, false,
 DEFINE_double(stirling_rescan_exp_backoff_factor, 2.0,
               "Exponential backoff factor used in decided how often to rescan binaries for "
               "dynamically loaded libraries");
+DEFINE_uint32(stirling_uprobe_deploy_threads, 4,
+              "Number of worker threads used to analyze binaries (ELF and DWARF reading) during "
+              "uprobe deployment. Probe attachment itself remains single-threaded.");
 
 namespace px {
 namespace stirling {
@@ -566,12 +571,106 @@ int UProbeManager::DeployOpenSSLUProbes(const absl::flat_hash_set<md::UPID>& pid
   return uprobe_count;
 }
 
+namespace {
+
+// Holds the per-binary analysis state produced by the parallel analysis phase of
+// DeployGoUProbes(). A null elf_reader means the binary was filtered out (not Go or
+// unreadable). A null dwarf_reader means DWARF analysis was skipped (symaddrs already
+// cached by build-id) or the binary has no debug info (known-version layouts and cached
+// entries may still allow deployment).
+struct GoBinaryAnalysis {
+  std::string binary;
+  std::vector<int32_t> pid_vec;
+  std::unique_ptr<ElfReader> elf_reader;
+  std::unique_ptr<DwarfReader> dwarf_reader;
+};
+
+void AnalyzeGoBinary(GoBinaryAnalysis* analysis, bool need_http2) {
+  const std::string& binary = analysis->binary;
+
+  // Read binary's symbols.
+  StatusOr<std::unique_ptr<ElfReader>> elf_reader_status = ElfReader::Create(binary);
+  if (!elf_reader_status.ok()) {
+    LOG(WARNING) << absl::Substitute(
+        "Cannot analyze binary $0 for uprobe deployment. "
+        "If file is under /var/lib, container may have terminated. "
+        "Message = $1",
+        binary, elf_reader_status.msg());
+    return;
+  }
+  std::unique_ptr<ElfReader> elf_reader = elf_reader_status.ConsumeValueOrDie();
+
+  // Avoid going past this point if not a golang program.
+  // The DwarfReader is memory intensive, and the remaining probes are Golang specific.
+  if (!IsGoExecutable(elf_reader.get())) {
+    return;
+  }
+
+  // If every symaddrs struct for this binary is already cached by build-id (same image seen
+  // before, possibly by another agent sharing the cache path), skip DWARF analysis entirely.
+  if (GoSymAddrsCached(elf_reader.get(), need_http2)) {
+    VLOG(1) << absl::Substitute("Binary $0 has fully cached symaddrs. Skipping DWARF analysis.",
+                                binary);
+    analysis->elf_reader = std::move(elf_reader);
+    return;
+  }
+
+  StatusOr<std::unique_ptr<DwarfReader>> dwarf_reader_status =
+      DwarfReader::CreateIndexingAll(binary);
+  if (!dwarf_reader_status.ok()) {
+    // Proceed without DWARF info: the common symaddrs can still come from the table of known
+    // toolchain layouts, which is enough for the Go runtime probes.
+    VLOG(1) << absl::Substitute(
+        "Failed to get binary $0 debug symbols. Falling back to known toolchain layouts. "
+        "Message = $1",
+        binary, dwarf_reader_status.msg());
+  } else {
+    analysis->dwarf_reader = dwarf_reader_status.ConsumeValueOrDie();
+  }
+
+  analysis->elf_reader = std::move(elf_reader);
+}
+
+// Runs AnalyzeGoBinary() on all candidates using a bounded pool of worker threads.
+// Each worker claims candidates through a shared atomic index, so large binaries don't
+// serialize behind each other the way static sharding would.
+void AnalyzeGoBinaries(std::vector<GoBinaryAnalysis>* analyses, bool need_http2) {
+  const size_t num_workers = std::min<size_t>(
+      std::max<uint32_t>(FLAGS_stirling_uprobe_deploy_threads, 1), analyses->size());
+
+  if (num_workers <= 1) {
+    for (auto& analysis : *analyses) {
+      AnalyzeGoBinary(&analysis, need_http2);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next_idx(0);
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers.emplace_back([analyses, &next_idx, need_http2]() {
+      for (size_t idx = next_idx.fetch_add(1); idx < analyses->size();
+           idx = next_idx.fetch_add(1)) {
+        AnalyzeGoBinary(&(*analyses)[idx], need_http2);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+}  // namespace
+
 int UProbeManager::DeployGoUProbes(const absl::flat_hash_set<md::UPID>& pids) {
   int uprobe_count = 0;
 
   static int32_t kPID = getpid();
 
-  for (const auto& [binary, pid_vec] : ConvertPIDsListToMap(pids, &fp_resolver_)) {
+  // Phase 1: Select the binaries that need analysis.
+  std::vector<GoBinaryAnalysis> candidates;
+  for (auto& [binary, pid_vec] : ConvertPIDsListToMap(pids, &fp_resolver_)) {
     // Don't bother rescanning binaries that have been scanned before to avoid unnecessary work.
     if (!scanned_binaries_.insert(binary).second) {
       continue;
@@ -585,36 +684,26 @@ int UProbeManager::DeployGoUProbes(const absl::flat_hash_set<md::UPID>& pids) {
       }
     }
 
-    // Read binary's symbols.
-    StatusOr<std::unique_ptr<ElfReader>> elf_reader_status = ElfReader::Create(binary);
-    if (!elf_reader_status.ok()) {
-      LOG(WARNING) << absl::Substitute(
-          "Cannot analyze binary $0 for uprobe deployment. "
-          "If file is under /var/lib, container may have terminated. "
-          "Message = $1",
-          binary, elf_reader_status.msg());
-      continue;
-    }
-    std::unique_ptr<ElfReader> elf_reader = elf_reader_status.ConsumeValueOrDie();
+    candidates.push_back(GoBinaryAnalysis{binary, std::move(pid_vec), nullptr, nullptr});
+  }
 
-    // Avoid going past this point if not a golang program.
-    // The DwarfReader is memory intensive, and the remaining probes are Golang specific.
-    if (!IsGoExecutable(elf_reader.get())) {
-      continue;
-    }
+  // Phase 2: Analyze binaries (ELF and DWARF reading) on a bounded worker pool.
+  // This is the expensive part of deployment, and is independent across binaries.
+  AnalyzeGoBinaries(&candidates, cfg_enable_http2_tracing_);
 
-    StatusOr<std::unique_ptr<DwarfReader>> dwarf_reader_status =
-        DwarfReader::CreateIndexingAll(binary);
-    if (!dwarf_reader_status.ok()) {
-      VLOG(1) << absl::Substitute(
-          "Failed to get binary $0 debug symbols. Cannot deploy uprobes. "
-          "Message = $1",
-          binary, dwarf_reader_status.msg());
+  // Phase 3: Update symaddrs maps and attach probes.
+  // BCCWrapper is not thread-safe, so attachment stays on this thread.
+  for (auto& analysis : candidates) {
+    if (analysis.elf_reader == nullptr) {
       continue;
     }
-    std::unique_ptr<DwarfReader> dwarf_reader = dwarf_reader_status.ConsumeValueOrDie();
 
-    Status s = UpdateGoCommonSymAddrs(elf_reader.get(), dwarf_reader.get(), pid_vec);
+    const std::string& binary = analysis.binary;
+    const std::vector<int32_t>& pid_vec = analysis.pid_vec;
+    ElfReader* elf_reader = analysis.elf_reader.get();
+    DwarfReader* dwarf_reader = analysis.dwarf_reader.get();
+
+    Status s = UpdateGoCommonSymAddrs(elf_reader, dwarf_reader, pid_vec);
     if (!s.ok()) {
       VLOG(1) << absl::Substitute(
           "Golang binary $0 does not have the mandatory symbols (e.g. TCPConn).", binary);
@@ -627,7 +716,7 @@ int UProbeManager::DeployGoUProbes(const absl::flat_hash_set<md::UPID>& pids) {
     // Go Runtime Probes.
     {
       StatusOr<int> attach_status =
-          AttachGoRuntimeUProbes(binary, elf_reader.get(), dwarf_reader.get(), pid_vec);
+          AttachGoRuntimeUProbes(binary, elf_reader, dwarf_reader, pid_vec);
       if (!attach_status.ok()) {
         monitor_.AppendSourceStatusRecord("socket_tracer", attach_status.status(),
                                           "AttachGoRuntimeUProbes");
@@ -641,7 +730,7 @@ int UProbeManager::DeployGoUProbes(const absl::flat_hash_set<md::UPID>& pids) {
     // GoTLS Probes.
     {
       StatusOr<int> attach_status =
-          AttachGoTLSUProbes(binary, elf_reader.get(), dwarf_reader.get(), pid_vec);
+          AttachGoTLSUProbes(binary, elf_reader, dwarf_reader, pid_vec);
       if (!attach_status.ok()) {
         monitor_.AppendSourceStatusRecord("socket_tracer", attach_status.status(),
                                           "AttachGoTLSUProbes");
@@ -655,7 +744,7 @@ int UProbeManager::DeployGoUProbes(const absl::flat_hash_set<md::UPID>& pids) {
     // Go HTTP2 Probes.
     if (cfg_enable_http2_tracing_) {
       StatusOr<int> attach_status =
-          AttachGoHTTP2Probes(binary, elf_reader.get(), dwarf_reader.get(), pid_vec);
+          AttachGoHTTP2Probes(binary, elf_reader, dwarf_reader, pid_vec);
       if (!attach_status.ok()) {
         monitor_.AppendSourceStatusRecord("socket_tracer", attach_status.status(),
                                           "AttachGoHTTP2Probes");
@@ -43,6 +43,7 @@
 
 DECLARE_bool(stirling_rescan_for_dlopen);
 DECLARE_double(stirling_rescan_exp_backoff_factor);
+DECLARE_uint32(stirling_uprobe_deploy_threads);
 
 namespace px {
 namespace stirling {
@@ -20,6 +20,7 @@
 #include <dlfcn.h>
 
 #include <algorithm>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <string>
@@ -47,6 +48,11 @@ DEFINE_bool(openssl_raw_fptrs_enabled, false,
             "If true, allows the openssl tracing implementation to fall back to function pointers "
             "if dlopen/dlsym is unable to find symbols");
 
+DEFINE_string(stirling_symaddrs_cache_path, "/tmp/px_symaddrs_cache",
+              "Directory in which to cache computed symbol addresses, keyed by ELF build-id, so "
+              "that identical binaries (e.g. replicas of the same container image) are only "
+              "analyzed once. An empty value disables the cache.");
+
 namespace px {
 namespace stirling {
 
@@ -508,24 +514,101 @@ Status PopulateGoTLSDebugSymbols(ElfReader* elf_reader, DwarfReader* dwarf_reade
   return Status::OK();
 }
 
-}  // namespace
+//-----------------------------------------------------------------------------
+// Known Go Toolchain Layouts
+//-----------------------------------------------------------------------------
 
-StatusOr<struct go_common_symaddrs_t> GoCommonSymAddrs(ElfReader* elf_reader,
-                                                       DwarfReader* dwarf_reader) {
+// The DWARF-derived fields of go_common_symaddrs_t depend only on the Go toolchain version,
+// not on the traced application, so they can be tabled for known toolchains. This serves as a
+// fallback for Go binaries shipped without DWARF info (e.g. stripped builds), for which the
+// itable addresses are still recoverable from ELF symbols.
+struct go_runtime_layout_t {
+  int32_t FD_Sysfd_offset;
+  int32_t tlsConn_conn_offset;
+  int32_t syscallConn_conn_offset;
+  int32_t g_goid_offset;
+  location_t casgstatus_gp_loc;
+  location_t casgstatus_newval_loc;
+};
+
+// Stack-based calling convention (up to Go 1.16).
+constexpr struct go_runtime_layout_t kGoRuntimeLayoutV1_16 = {
+    .FD_Sysfd_offset = 16,
+    .tlsConn_conn_offset = 0,
+    .syscallConn_conn_offset = 0,
+    .g_goid_offset = 152,
+    .casgstatus_gp_loc = {kLocationTypeStack, 8},
+    .casgstatus_newval_loc = {kLocationTypeStack, 20},
+};
+
+// Register-based calling convention (Go 1.17 and later): gp is the first argument register and
+// newval the third. The struct member offsets are unchanged.
+constexpr struct go_runtime_layout_t kGoRuntimeLayoutV1_17 = {
+    .FD_Sysfd_offset = 16,
+    .tlsConn_conn_offset = 0,
+    .syscallConn_conn_offset = 0,
+    .g_goid_offset = 152,
+    .casgstatus_gp_loc = {kLocationTypeRegisters, 0},
+    .casgstatus_newval_loc = {kLocationTypeRegisters, 16},
+};
+
+// Values were read via DwarfReader from unstripped builds of the corresponding toolchains.
+// Lookup uses the floor entry, so an entry covers all later versions until the next entry.
+Status PopulateCommonDebugSymbolsFromLayoutTable(ElfReader* elf_reader,
+                                                 struct go_common_symaddrs_t* symaddrs) {
+  static const std::map<SemVer, struct go_runtime_layout_t> kGoRuntimeLayouts = {
+      {SemVer{1, 16, 0}, kGoRuntimeLayoutV1_16},
+      {SemVer{1, 17, 0}, kGoRuntimeLayoutV1_17},
+  };
+
+  PL_ASSIGN_OR_RETURN(std::string build_version, ReadBuildVersion(elf_reader));
+  PL_ASSIGN_OR_RETURN(SemVer go_version, GetSemVer(build_version, false));
+
+  auto iter = Floor(kGoRuntimeLayouts, go_version);
+  if (iter == kGoRuntimeLayouts.end()) {
+    return error::NotFound("No known runtime layout for Go version '$0'", go_version.ToString());
+  }
+  const struct go_runtime_layout_t& layout = iter->second;
+
+  LOG_ASSIGN(symaddrs->FD_Sysfd_offset, layout.FD_Sysfd_offset);
+  LOG_ASSIGN(symaddrs->tlsConn_conn_offset, layout.tlsConn_conn_offset);
+  LOG_ASSIGN(symaddrs->syscallConn_conn_offset, layout.syscallConn_conn_offset);
+  LOG_ASSIGN(symaddrs->g_goid_offset, layout.g_goid_offset);
+  LOG_ASSIGN(symaddrs->casgstatus_gp_loc, layout.casgstatus_gp_loc);
+  LOG_ASSIGN(symaddrs->casgstatus_newval_loc, layout.casgstatus_newval_loc);
+
+  return Status::OK();
+}
+
+StatusOr<struct go_common_symaddrs_t> GoCommonSymAddrsFromDwarf(ElfReader* elf_reader,
+                                                                DwarfReader* dwarf_reader) {
   struct go_common_symaddrs_t symaddrs;
 
   PL_ASSIGN_OR_RETURN(std::string vendor_prefix, InferHTTP2SymAddrVendorPrefix(elf_reader));
 
   PL_RETURN_IF_ERROR(PopulateCommonTypeAddrs(elf_reader, vendor_prefix, &symaddrs));
-  PL_RETURN_IF_ERROR(PopulateCommonDebugSymbols(dwarf_reader, vendor_prefix, &symaddrs));
+
+  // Prefer DWARF info when available; fall back to the table of known toolchain layouts
+  // for binaries without debug info.
+  if (dwarf_reader != nullptr) {
+    Status s = PopulateCommonDebugSymbols(dwarf_reader, vendor_prefix, &symaddrs);
+    if (s.ok()) {
+      return symaddrs;
+    }
+  }
+  PL_RETURN_IF_ERROR(PopulateCommonDebugSymbolsFromLayoutTable(elf_reader, &symaddrs));
 
   return symaddrs;
 }
 
-StatusOr<struct go_http2_symaddrs_t> GoHTTP2SymAddrs(ElfReader* elf_reader,
-                                                     DwarfReader* dwarf_reader) {
+StatusOr<struct go_http2_symaddrs_t> GoHTTP2SymAddrsFromDwarf(ElfReader* elf_reader,
+                                                              DwarfReader* dwarf_reader) {
   struct go_http2_symaddrs_t symaddrs;
 
+  if (dwarf_reader == nullptr) {
+    return error::NotFound("Go HTTP2 symbol offsets require DWARF info.");
+  }
+
   PL_ASSIGN_OR_RETURN(std::string vendor_prefix, InferHTTP2SymAddrVendorPrefix(elf_reader));
 
   PL_RETURN_IF_ERROR(PopulateHTTP2TypeAddrs(elf_reader, vendor_prefix, &symaddrs));
@@ -534,14 +617,161 @@ StatusOr<struct go_http2_symaddrs_t> GoHTTP2SymAddrs(ElfReader* elf_reader,
   return symaddrs;
 }
 
-StatusOr<struct go_tls_symaddrs_t> GoTLSSymAddrs(ElfReader* elf_reader, DwarfReader* dwarf_reader) {
+StatusOr<struct go_tls_symaddrs_t> GoTLSSymAddrsFromDwarf(ElfReader* elf_reader,
+                                                          DwarfReader* dwarf_reader) {
   struct go_tls_symaddrs_t symaddrs;
 
+  if (dwarf_reader == nullptr) {
+    return error::NotFound("Go TLS symbol offsets require DWARF info.");
+  }
+
   PL_RETURN_IF_ERROR(PopulateGoTLSDebugSymbols(elf_reader, dwarf_reader, &symaddrs));
 
   return symaddrs;
 }
 
+//-----------------------------------------------------------------------------
+// On-Disk Symbol Address Cache
+//-----------------------------------------------------------------------------
+
+// The symaddrs computed above depend only on the binary's contents, so they are cached on disk
+// keyed by the binary's build-id. Two binaries with the same build-id (e.g. replicas of the same
+// container image, or the same binary seen again after a PEM restart) then only pay the
+// ELF/DWARF analysis cost once.
+
+// Version of the cache file format. Bump whenever the layout of any cached symaddrs struct
+// changes, so that files written by older agents are discarded instead of misinterpreted.
+constexpr uint32_t kSymAddrsCacheVersion = 1;
+
+// Cache file suffixes, one per cached symaddrs struct.
+constexpr std::string_view kGoCommonCacheKind = "go_common";
+constexpr std::string_view kGoHTTP2CacheKind = "go_http2";
+constexpr std::string_view kGoTLSCacheKind = "go_tls";
+constexpr std::string_view kOpenSSLCacheKind = "openssl";
+
+struct SymAddrsCacheHeader {
+  uint32_t version;
+  uint32_t size;
+};
+
+std::filesystem::path SymAddrsCacheFile(const std::string& build_id, std::string_view kind) {
+  return std::filesystem::path(FLAGS_stirling_symaddrs_cache_path) /
+         absl::StrCat(build_id, ".", kind);
+}
+
+template <typename TSymAddrs>
+StatusOr<TSymAddrs> ReadSymAddrsCache(const std::string& build_id, std::string_view kind) {
+  PL_ASSIGN_OR_RETURN(std::string contents, ReadFileToString(SymAddrsCacheFile(build_id, kind),
+                                                             std::ios_base::binary));
+
+  if (contents.size() != sizeof(SymAddrsCacheHeader) + sizeof(TSymAddrs)) {
+    return error::Internal("Unexpected symaddrs cache file size ($0 bytes).", contents.size());
+  }
+
+  SymAddrsCacheHeader header;
+  std::memcpy(&header, contents.data(), sizeof(header));
+  if (header.version != kSymAddrsCacheVersion || header.size != sizeof(TSymAddrs)) {
+    return error::Internal("Stale symaddrs cache entry (version=$0 size=$1).", header.version,
+                           header.size);
+  }
+
+  TSymAddrs symaddrs;
+  std::memcpy(&symaddrs, contents.data() + sizeof(header), sizeof(symaddrs));
+  return symaddrs;
+}
+
+template <typename TSymAddrs>
+void WriteSymAddrsCache(const std::string& build_id, std::string_view kind,
+                        const TSymAddrs& symaddrs) {
+  Status s = fs::CreateDirectories(FLAGS_stirling_symaddrs_cache_path);
+  if (!s.ok()) {
+    VLOG(1) << absl::Substitute("Failed to create symaddrs cache directory $0 [msg=$1]",
+                                FLAGS_stirling_symaddrs_cache_path, s.msg());
+    return;
+  }
+
+  SymAddrsCacheHeader header;
+  header.version = kSymAddrsCacheVersion;
+  header.size = sizeof(TSymAddrs);
+
+  std::string contents;
+  contents.resize(sizeof(header) + sizeof(symaddrs));
+  std::memcpy(contents.data(), &header, sizeof(header));
+  std::memcpy(contents.data() + sizeof(header), &symaddrs, sizeof(symaddrs));
+
+  // A write failure only costs a recomputation on the next encounter, so log and move on.
+  s = WriteFileFromString(SymAddrsCacheFile(build_id, kind), contents, std::ios_base::binary);
+  if (!s.ok()) {
+    VLOG(1) << absl::Substitute("Failed to write symaddrs cache entry for build-id $0 [msg=$1]",
+                                build_id, s.msg());
+  }
+}
+
+template <typename TSymAddrs, typename TComputeFn>
+StatusOr<TSymAddrs> CachedSymAddrs(ElfReader* elf_reader, std::string_view kind,
+                                   TComputeFn compute_fn) {
+  if (FLAGS_stirling_symaddrs_cache_path.empty()) {
+    return compute_fn();
+  }
+
+  StatusOr<std::string> build_id_or = elf_reader->BuildID();
+  if (!build_id_or.ok()) {
+    // Without a build-id there is no safe cache key, so always recompute.
+    return compute_fn();
+  }
+  const std::string& build_id = build_id_or.ValueOrDie();
+
+  StatusOr<TSymAddrs> cached = ReadSymAddrsCache<TSymAddrs>(build_id, kind);
+  if (cached.ok()) {
+    VLOG(1) << absl::Substitute("Loaded $0 symaddrs for build-id $1 from cache", kind, build_id);
+    return cached;
+  }
+
+  PL_ASSIGN_OR_RETURN(TSymAddrs symaddrs, compute_fn());
+  WriteSymAddrsCache(build_id, kind, symaddrs);
+  return symaddrs;
+}
+
+}  // namespace
+
+bool GoSymAddrsCached(ElfReader* elf_reader, bool include_http2) {
+  if (FLAGS_stirling_symaddrs_cache_path.empty()) {
+    return false;
+  }
+
+  StatusOr<std::string> build_id_or = elf_reader->BuildID();
+  if (!build_id_or.ok()) {
+    return false;
+  }
+  const std::string& build_id = build_id_or.ValueOrDie();
+
+  if (!fs::Exists(SymAddrsCacheFile(build_id, kGoCommonCacheKind)) ||
+      !fs::Exists(SymAddrsCacheFile(build_id, kGoTLSCacheKind))) {
+    return false;
+  }
+  return !include_http2 || fs::Exists(SymAddrsCacheFile(build_id, kGoHTTP2CacheKind));
+}
+
+StatusOr<struct go_common_symaddrs_t> GoCommonSymAddrs(ElfReader* elf_reader,
+                                                       DwarfReader* dwarf_reader) {
+  return CachedSymAddrs<struct go_common_symaddrs_t>(elf_reader, kGoCommonCacheKind, [&]() {
+    return GoCommonSymAddrsFromDwarf(elf_reader, dwarf_reader);
+  });
+}
+
+StatusOr<struct go_http2_symaddrs_t> GoHTTP2SymAddrs(ElfReader* elf_reader,
+                                                     DwarfReader* dwarf_reader) {
+  return CachedSymAddrs<struct go_http2_symaddrs_t>(elf_reader, kGoHTTP2CacheKind, [&]() {
+    return GoHTTP2SymAddrsFromDwarf(elf_reader, dwarf_reader);
+  });
+}
+
+StatusOr<struct go_tls_symaddrs_t> GoTLSSymAddrs(ElfReader* elf_reader, DwarfReader* dwarf_reader) {
+  return CachedSymAddrs<struct go_tls_symaddrs_t>(elf_reader, kGoTLSCacheKind, [&]() {
+    return GoTLSSymAddrsFromDwarf(elf_reader, dwarf_reader);
+  });
+}
+
 namespace {
 
 // Returns a function pointer from a dlopen handle.
@@ -653,11 +883,8 @@ StatusOr<uint32_t> OpenSSLFixSubversionNum(RawFptrManager* fptrManager,
   return fix;
 }
 
-}  // namespace
-
-StatusOr<struct openssl_symaddrs_t> OpenSSLSymAddrs(RawFptrManager* fptrManager,
-                                                    const std::filesystem::path& openssl_lib,
-                                                    uint32_t pid) {
+StatusOr<struct openssl_symaddrs_t> OpenSSLSymAddrsFromInspection(
+    RawFptrManager* fptrManager, const std::filesystem::path& openssl_lib, uint32_t pid) {
   // Some useful links, for different OpenSSL versions:
   // 1.1.0a:
   // https://github.com/openssl/openssl/blob/ac2c44c6289f9716de4c4beeb284a818eacde517/<filename>
@@ -723,6 +950,26 @@ StatusOr<struct openssl_symaddrs_t> OpenSSLSymAddrs(RawFptrManager* fptrManager,
   return symaddrs;
 }
 
+}  // namespace
+
+StatusOr<struct openssl_symaddrs_t> OpenSSLSymAddrs(RawFptrManager* fptrManager,
+                                                    const std::filesystem::path& openssl_lib,
+                                                    uint32_t pid) {
+  // The offsets depend only on the library's contents, so cache them keyed by the library's
+  // build-id. This avoids re-running version detection (dlopen or raw function pointers, both
+  // of which can be slow or unavailable) for every process sharing the same libssl build.
+  // The cache can also be pre-seeded: dropping a <build_id>.openssl entry for a known distro
+  // build into --stirling_symaddrs_cache_path makes attachment skip inspection entirely.
+  StatusOr<std::unique_ptr<ElfReader>> elf_reader_or = ElfReader::Create(openssl_lib.string());
+  if (!elf_reader_or.ok()) {
+    return OpenSSLSymAddrsFromInspection(fptrManager, openssl_lib, pid);
+  }
+
+  return CachedSymAddrs<struct openssl_symaddrs_t>(
+      elf_reader_or.ValueOrDie().get(), kOpenSSLCacheKind,
+      [&]() { return OpenSSLSymAddrsFromInspection(fptrManager, openssl_lib, pid); });
+}
+
 // Instructions of get symbol offsets for nodejs.
 //   git clone nodejs repo.
 //   git checkout v<version>  # Checkout the tagged release
@@ -29,13 +29,26 @@
 
 DECLARE_bool(openssl_force_raw_fptrs);
 DECLARE_bool(openssl_raw_fptrs_enabled);
+DECLARE_string(stirling_symaddrs_cache_path);
 
 namespace px {
 namespace stirling {
 
+// The Go functions below cache their results on disk, keyed by the binary's build-id,
+// so that identical binaries are only analyzed once (see --stirling_symaddrs_cache_path).
+
+/**
+ * Returns whether all Go symaddrs for the binary are already in the on-disk cache.
+ * When true, callers may skip DWARF analysis entirely and pass a null DwarfReader to the
+ * Go*SymAddrs() functions below; the results will be served from the cache.
+ */
+bool GoSymAddrsCached(obj_tools::ElfReader* elf_reader, bool include_http2);
+
 /**
  * Uses ELF and DWARF information to return the locations of all relevant symbols for general Go
  * uprobe deployment.
+ * If DWARF info is unavailable, falls back to a table of known Go toolchain layouts, selected by
+ * the build version embedded in the binary.
  */
 StatusOr<struct go_common_symaddrs_t> GoCommonSymAddrs(obj_tools::ElfReader* elf_reader,
                                                        obj_tools::DwarfReader* dwarf_reader);
@@ -57,6 +70,9 @@ StatusOr<struct go_tls_symaddrs_t> GoTLSSymAddrs(obj_tools::ElfReader* elf_reade
 /**
  * Detects the version of OpenSSL to return the locations of all relevant symbols for OpenSSL uprobe
  * deployment.
+ * Results are cached on disk keyed by the library's build-id (see --stirling_symaddrs_cache_path),
+ * so version detection only runs once per unique libssl build. Pre-populating the cache directory
+ * with entries for known distro builds skips detection entirely.
  */
 StatusOr<struct openssl_symaddrs_t> OpenSSLSymAddrs(obj_tools::RawFptrManager* fptrManager,
                                                     const std::filesystem::path& openssl_lib,
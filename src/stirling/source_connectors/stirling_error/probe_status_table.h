@@ -40,6 +40,8 @@ constexpr DataElement kProbeStatusElements[] = {
    types::DataType::STRING, types::SemanticType::ST_NONE, types::PatternType::GENERAL},
   {"info", "Optional extra info provided as a JSON",
    types::DataType::STRING, types::SemanticType::ST_NONE, types::PatternType::GENERAL},
+  {"count", "Number of occurrences of this status since the last report",
+   types::DataType::INT64, types::SemanticType::ST_NONE, types::PatternType::METRIC_COUNTER},
 };
 
 constexpr DataTableSchema kProbeStatusTable {
@@ -62,6 +62,7 @@ void StirlingErrorConnector::TransferStirlingErrorTable(ConnectorContext* ctx,
     r.Append<r.ColIndex("status")>(static_cast<uint64_t>(record.status));
     r.Append<r.ColIndex("error")>(std::move(record.error));
     r.Append<r.ColIndex("context")>(std::move(record.context));
+    r.Append<r.ColIndex("count")>(static_cast<int64_t>(record.count));
   }
 }
 
@@ -77,6 +78,7 @@ void StirlingErrorConnector::TransferProbeStatusTable(ConnectorContext* ctx,
     r.Append<r.ColIndex("status")>(static_cast<uint64_t>(record.status));
     r.Append<r.ColIndex("error")>(std::move(record.error));
     r.Append<r.ColIndex("info")>(std::move(record.info));
+    r.Append<r.ColIndex("count")>(static_cast<int64_t>(record.count));
   }
 }
 
@@ -38,6 +38,8 @@ constexpr DataElement kStirlingErrorElements[] = {
    types::DataType::STRING, types::SemanticType::ST_NONE, types::PatternType::GENERAL},
   {"context", "The context in which the error occurred",
    types::DataType::STRING, types::SemanticType::ST_NONE, types::PatternType::GENERAL},
+  {"count", "Number of occurrences of this status since the last report",
+   types::DataType::INT64, types::SemanticType::ST_NONE, types::PatternType::METRIC_COUNTER},
 };
 
 constexpr DataTableSchema kStirlingErrorTable {
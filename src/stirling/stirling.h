@@ -144,6 +144,14 @@ class Stirling : public NotCopyable {
    */
   virtual void RegisterDataPushCallback(DataPushCallback f) = 0;
 
+  /**
+   * Register a batched call-back from Agent. Like RegisterDataPushCallback(), but all tables
+   * that crossed their push thresholds in a cycle are delivered through a single invocation,
+   * so the agent-side ingestion loop does one pass per push period.
+   * If registered, this callback takes precedence over the per-table callback.
+   */
+  virtual void RegisterBatchDataPushCallback(BatchDataPushCallback f) = 0;
+
   /**
    * Register a callback from the agent to fetch the latest metadata state.
    * This state is returned is constant and valid for the duration of the shared_ptr
@@ -0,0 +1,275 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Replays a socket tracer capture file through the full userspace pipeline, with no kernel
+// involved: control and data events are fed back through AcceptControlEvent/AcceptDataEvent
+// in their recorded order, with TransferData called at the production cadence (scaled by
+// --replay_speedup), and the output records/s and CPU usage are reported.
+//
+// To record a capture, run stirling_wrapper on a representative node with
+// --stirling_socket_trace_capture_path=/path/to/capture.bin, then point --capture_file at the
+// result. Because the capture pins the exact event stream, before/after runs of this driver
+// measure a socket tracer optimization end-to-end and reproducibly.
+
+#include <fcntl.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/util/delimited_message_util.h>
+
+#include "src/common/base/base.h"
+#include "src/stirling/core/connector_context.h"
+#include "src/stirling/source_connectors/socket_tracer/proto/sock_event.pb.h"
+#include "src/stirling/source_connectors/socket_tracer/socket_trace_connector.h"
+#include "src/stirling/source_connectors/socket_tracer/testing/socket_trace_connector_friend.h"
+#include "src/stirling/testing/common.h"
+
+DEFINE_string(capture_file, "",
+              "Path to a capture of socket tracer events, as written by "
+              "--stirling_socket_trace_capture_path.");
+DEFINE_double(replay_speedup, 1.0,
+              "Speed-up factor applied to the recorded event timestamps. 1.0 replays in real "
+              "time; 10.0 replays 10x faster; 0 replays as fast as possible.");
+DEFINE_uint64(replay_transfer_period_ms, 200,
+              "Period, in capture time, between TransferData calls. Defaults to the socket "
+              "tracer's production sampling period.");
+
+using ::px::stirling::SocketTraceConnector;
+using ::px::stirling::SocketTraceConnectorFriend;
+using ::px::stirling::SystemWideStandaloneContext;
+using ::px::stirling::testing::DataTables;
+
+namespace {
+
+// One recorded event, in a form that is compact to hold in memory.
+// The full socket_data_event_t wire struct is rebuilt at replay time, since its fixed-size
+// message buffer would dominate memory for large captures.
+struct ReplayEvent {
+  uint64_t timestamp_ns = 0;
+
+  bool is_data = false;
+
+  // Valid iff is_data.
+  socket_data_event_t::attr_t data_attr = {};
+  std::string msg;
+
+  // Valid iff !is_data.
+  socket_control_event_t control = {};
+};
+
+ReplayEvent DataEventFromPB(const px::stirling::sockeventpb::SocketDataEvent& pb) {
+  ReplayEvent event;
+  event.is_data = true;
+  event.timestamp_ns = pb.attr().timestamp_ns();
+  event.data_attr.timestamp_ns = pb.attr().timestamp_ns();
+  event.data_attr.conn_id.upid.pid = pb.attr().conn_id().pid();
+  event.data_attr.conn_id.upid.start_time_ticks = pb.attr().conn_id().start_time_ns();
+  event.data_attr.conn_id.fd = pb.attr().conn_id().fd();
+  event.data_attr.conn_id.tsid = pb.attr().conn_id().generation();
+  event.data_attr.protocol = static_cast<traffic_protocol_t>(pb.attr().protocol());
+  event.data_attr.role = static_cast<endpoint_role_t>(pb.attr().role());
+  event.data_attr.direction = static_cast<traffic_direction_t>(pb.attr().direction());
+  event.data_attr.pos = pb.attr().pos();
+  event.data_attr.msg_size = pb.attr().msg_size();
+  event.msg = pb.msg().substr(0, MAX_MSG_SIZE);
+  event.data_attr.msg_buf_size = event.msg.size();
+  return event;
+}
+
+ReplayEvent ControlEventFromPB(const px::stirling::sockeventpb::SocketControlEvent& pb) {
+  ReplayEvent event;
+  event.timestamp_ns = pb.timestamp_ns();
+  event.control.type = static_cast<control_event_type_t>(pb.type());
+  event.control.timestamp_ns = pb.timestamp_ns();
+  event.control.conn_id.upid.pid = pb.conn_id().pid();
+  event.control.conn_id.upid.start_time_ticks = pb.conn_id().start_time_ns();
+  event.control.conn_id.fd = pb.conn_id().fd();
+  event.control.conn_id.tsid = pb.conn_id().generation();
+  event.control.source_fn = static_cast<source_function_t>(pb.source_fn());
+  switch (event.control.type) {
+    case kConnOpen:
+      event.control.open.role = static_cast<endpoint_role_t>(pb.role());
+      std::memcpy(&event.control.open.addr, pb.addr().data(),
+                  std::min(pb.addr().size(), sizeof(event.control.open.addr)));
+      break;
+    case kConnClose:
+      event.control.close.wr_bytes = pb.wr_bytes();
+      event.control.close.rd_bytes = pb.rd_bytes();
+      break;
+  }
+  return event;
+}
+
+px::StatusOr<std::vector<ReplayEvent>> LoadCapture(const std::string& path) {
+  using ::google::protobuf::io::FileInputStream;
+  using ::google::protobuf::util::ParseDelimitedFromZeroCopyStream;
+
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return px::error::NotFound("Could not open capture file $0", path);
+  }
+  FileInputStream input(fd);
+
+  std::vector<ReplayEvent> events;
+  px::stirling::sockeventpb::CapturedEvent pb;
+  bool clean_eof = true;
+  while (ParseDelimitedFromZeroCopyStream(&pb, &input, &clean_eof)) {
+    switch (pb.event_case()) {
+      case px::stirling::sockeventpb::CapturedEvent::kDataEvent:
+        events.push_back(DataEventFromPB(pb.data_event()));
+        break;
+      case px::stirling::sockeventpb::CapturedEvent::kControlEvent:
+        events.push_back(ControlEventFromPB(pb.control_event()));
+        break;
+      case px::stirling::sockeventpb::CapturedEvent::EVENT_NOT_SET:
+        break;
+    }
+  }
+  close(fd);
+
+  if (!clean_eof) {
+    return px::error::Internal("Capture file $0 is truncated or corrupt", path);
+  }
+  if (events.empty()) {
+    return px::error::Internal("Capture file $0 contains no events", path);
+  }
+
+  return events;
+}
+
+void CountOutput(DataTables* tables, uint64_t* output_records, uint64_t* output_bytes) {
+  for (auto* tbl : tables->tables()) {
+    auto tagged_records = tbl->ConsumeRecords();
+    for (const auto& tagged_record : tagged_records) {
+      if (tagged_record.records.size() > 0) {
+        *output_records += tagged_record.records[0]->Size();
+      }
+      for (const auto& column_wrapper : tagged_record.records) {
+        *output_bytes += column_wrapper->Bytes();
+      }
+    }
+  }
+}
+
+double CPUSeconds(const struct rusage& usage) {
+  auto to_seconds = [](const struct timeval& tv) { return tv.tv_sec + tv.tv_usec / 1e6; };
+  return to_seconds(usage.ru_utime) + to_seconds(usage.ru_stime);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  px::EnvironmentGuard env_guard(&argc, argv);
+
+  if (FLAGS_capture_file.empty()) {
+    LOG(FATAL) << "--capture_file is required. Record one with "
+                  "--stirling_socket_trace_capture_path.";
+  }
+
+  PL_ASSIGN_OR_EXIT(std::vector<ReplayEvent> events, LoadCapture(FLAGS_capture_file));
+
+  uint64_t input_bytes = 0;
+  for (const auto& event : events) {
+    input_bytes += event.msg.size();
+  }
+  LOG(INFO) << absl::Substitute("Loaded $0 events ($1 bytes of traffic) from $2.", events.size(),
+                                input_bytes, FLAGS_capture_file);
+
+  auto source_connector = SocketTraceConnectorFriend::Create("socket_trace_connector");
+  auto* connector = static_cast<SocketTraceConnectorFriend*>(source_connector.get());
+
+  SystemWideStandaloneContext ctx;
+  DataTables tables(SocketTraceConnector::kTables);
+
+  // Run TransferData once, so one-time setup costs are not attributed to the replay.
+  source_connector->TransferData(&ctx, tables.tables());
+
+  // The reconstructed wire struct, reused across events to avoid churning its large msg buffer.
+  auto data_event = std::make_unique<socket_data_event_t>();
+
+  const uint64_t transfer_period_ns =
+      FLAGS_replay_transfer_period_ms * 1000ULL * 1000ULL;
+  const uint64_t capture_start_ns = events.front().timestamp_ns;
+  uint64_t next_transfer_ns = capture_start_ns + transfer_period_ns;
+  uint64_t transfer_count = 0;
+  uint64_t output_records = 0;
+  uint64_t output_bytes = 0;
+
+  struct rusage usage_start;
+  getrusage(RUSAGE_SELF, &usage_start);
+  const auto wall_start = std::chrono::steady_clock::now();
+
+  for (const auto& event : events) {
+    if (FLAGS_replay_speedup > 0 && event.timestamp_ns > capture_start_ns) {
+      const auto target =
+          wall_start + std::chrono::nanoseconds(static_cast<uint64_t>(
+                           (event.timestamp_ns - capture_start_ns) / FLAGS_replay_speedup));
+      std::this_thread::sleep_until(target);
+    }
+
+    // Preserve the production cadence: drain-then-transfer every period of capture time.
+    while (event.timestamp_ns >= next_transfer_ns) {
+      source_connector->TransferData(&ctx, tables.tables());
+      ++transfer_count;
+      CountOutput(&tables, &output_records, &output_bytes);
+      next_transfer_ns += transfer_period_ns;
+    }
+
+    if (event.is_data) {
+      data_event->attr = event.data_attr;
+      std::memcpy(data_event->msg, event.msg.data(), event.msg.size());
+      connector->HandleDataEvent(data_event.get(),
+                                 sizeof(data_event->attr) + event.data_attr.msg_buf_size);
+    } else {
+      socket_control_event_t control = event.control;
+      connector->HandleControlEvent(&control, sizeof(control));
+    }
+  }
+
+  source_connector->TransferData(&ctx, tables.tables());
+  ++transfer_count;
+  CountOutput(&tables, &output_records, &output_bytes);
+
+  const auto wall_end = std::chrono::steady_clock::now();
+  struct rusage usage_end;
+  getrusage(RUSAGE_SELF, &usage_end);
+
+  const double wall_seconds = std::chrono::duration<double>(wall_end - wall_start).count();
+  const double cpu_seconds = CPUSeconds(usage_end) - CPUSeconds(usage_start);
+
+  std::cout << absl::Substitute("Replayed $0 events in $1 s ($2 TransferData calls).\n",
+                                events.size(), wall_seconds, transfer_count);
+  std::cout << absl::Substitute("Input: $0 bytes ($1 MB/s).\n", input_bytes,
+                                input_bytes / wall_seconds / (1024 * 1024));
+  std::cout << absl::Substitute("Output: $0 records ($1 records/s), $2 bytes.\n", output_records,
+                                output_records / wall_seconds, output_bytes);
+  std::cout << absl::Substitute("CPU: $0 s ($1% of one core).\n", cpu_seconds,
+                                100.0 * cpu_seconds / wall_seconds);
+
+  return 0;
+}
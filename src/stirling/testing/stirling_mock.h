@@ -42,6 +42,7 @@ class MockStirling : public Stirling {
   MOCK_METHOD(Status, RemoveTracepoint, (sole::uuid trace_id), (override));
   MOCK_METHOD(void, GetPublishProto, (stirlingpb::Publish * publish_pb), (override));
   MOCK_METHOD(void, RegisterDataPushCallback, (DataPushCallback f), (override));
+  MOCK_METHOD(void, RegisterBatchDataPushCallback, (BatchDataPushCallback f), (override));
   MOCK_METHOD(void, RegisterAgentMetadataCallback, (AgentMetadataCallback f), (override));
   MOCK_METHOD(void, Run, (), (override));
   MOCK_METHOD(Status, RunAsThread, (), (override));
@@ -62,25 +62,71 @@ void StirlingMonitor::NotifyJavaProcessCrashed(const struct upid_t& upid) {
 void StirlingMonitor::AppendSourceStatusRecord(const std::string& source_connector,
                                                const Status& status, const std::string& context) {
   absl::base_internal::SpinLockHolder lock(&source_status_lock_);
-  source_status_records_.push_back(
-      {CurrentTimeNS(), source_connector, status.code(), status.msg(), context});
+  SourceStatusKey key{source_connector, static_cast<int>(status.code())};
+  auto it = source_status_index_.find(key);
+  if (it != source_status_index_.end()) {
+    auto& record = source_status_records_[it->second];
+    record.timestamp_ns = CurrentTimeNS();
+    ++record.count;
+    return;
+  }
+  SourceStatusRecord record{CurrentTimeNS(), source_connector, status.code(), status.msg(),
+                            context};
+  if (source_status_records_.size() < kMaxStatusRecords) {
+    source_status_index_[std::move(key)] = source_status_records_.size();
+    source_status_records_.push_back(std::move(record));
+    return;
+  }
+  // Ring is full: overwrite the oldest distinct entry.
+  size_t slot = source_status_next_evict_;
+  source_status_next_evict_ = (source_status_next_evict_ + 1) % kMaxStatusRecords;
+  const auto& evicted = source_status_records_[slot];
+  source_status_index_.erase(
+      SourceStatusKey{evicted.source_connector, static_cast<int>(evicted.status)});
+  source_status_index_[std::move(key)] = slot;
+  source_status_records_[slot] = std::move(record);
 }
 
 void StirlingMonitor::AppendProbeStatusRecord(const std::string& source_connector,
                                               const std::string& tracepoint, const Status& status,
                                               const std::string& info) {
   absl::base_internal::SpinLockHolder lock(&probe_status_lock_);
-  probe_status_records_.push_back(
-      {CurrentTimeNS(), source_connector, tracepoint, status.code(), status.msg(), info});
+  ProbeStatusKey key{source_connector, tracepoint, static_cast<int>(status.code())};
+  auto it = probe_status_index_.find(key);
+  if (it != probe_status_index_.end()) {
+    auto& record = probe_status_records_[it->second];
+    record.timestamp_ns = CurrentTimeNS();
+    ++record.count;
+    return;
+  }
+  ProbeStatusRecord record{CurrentTimeNS(), source_connector, tracepoint,
+                           status.code(),   status.msg(),     info};
+  if (probe_status_records_.size() < kMaxStatusRecords) {
+    probe_status_index_[std::move(key)] = probe_status_records_.size();
+    probe_status_records_.push_back(std::move(record));
+    return;
+  }
+  // Ring is full: overwrite the oldest distinct entry.
+  size_t slot = probe_status_next_evict_;
+  probe_status_next_evict_ = (probe_status_next_evict_ + 1) % kMaxStatusRecords;
+  const auto& evicted = probe_status_records_[slot];
+  probe_status_index_.erase(ProbeStatusKey{evicted.source_connector, evicted.tracepoint,
+                                           static_cast<int>(evicted.status)});
+  probe_status_index_[std::move(key)] = slot;
+  probe_status_records_[slot] = std::move(record);
 }
 
 std::vector<SourceStatusRecord> StirlingMonitor::ConsumeSourceStatusRecords() {
   absl::base_internal::SpinLockHolder lock(&source_status_lock_);
+  source_status_index_.clear();
+  source_status_next_evict_ = 0;
   return std::move(source_status_records_);
 }
 
 std::vector<ProbeStatusRecord> StirlingMonitor::ConsumeProbeStatusRecords() {
   absl::base_internal::SpinLockHolder lock(&probe_status_lock_);
+  probe_status_index_.clear();
+  probe_status_next_evict_ = 0;
   return std::move(probe_status_records_);
 }
 
@@ -22,6 +22,7 @@
 
 #include <absl/container/flat_hash_map.h>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -39,6 +40,8 @@ struct SourceStatusRecord {
   px::statuspb::Code status;
   std::string error = "";
   std::string context = "";
+  // Number of occurrences folded into this record since the last consume.
+  uint64_t count = 1;
 };
 
 // Status of ebpf probes.
@@ -49,6 +52,8 @@ struct ProbeStatusRecord {
   px::statuspb::Code status;
   std::string error = "";
   std::string info = "";
+  // Number of occurrences folded into this record since the last consume.
+  uint64_t count = 1;
 };
 
 class StirlingMonitor : NotCopyMoveable {
@@ -64,6 +69,10 @@ class StirlingMonitor : NotCopyMoveable {
   void ResetJavaProcessAttachTrackers();
 
   // Stirling Error Reporting.
+  // Pending records are deduplicated: a repeat of an already-pending status bumps its occurrence
+  // count and refreshes its timestamp instead of appending, so error storms (e.g. a broken uprobe
+  // binary seen repeatedly) stay O(distinct errors). The pending set is additionally bounded at
+  // kMaxStatusRecords per table, evicting the oldest distinct entry when full.
   void AppendProbeStatusRecord(const std::string& source_connector, const std::string& tracepoint,
                                const Status& status, const std::string& info);
   void AppendSourceStatusRecord(const std::string& source_connector, const Status& status,
@@ -72,16 +81,29 @@ class StirlingMonitor : NotCopyMoveable {
   std::vector<SourceStatusRecord> ConsumeSourceStatusRecords();
 
   static constexpr auto kCrashWindow = std::chrono::seconds{5};
+  // Maximum number of distinct pending status records per table.
+  static constexpr size_t kMaxStatusRecords = 128;
 
  private:
   StirlingMonitor();
   using timestamp_t = std::chrono::time_point<std::chrono::steady_clock>;
   absl::flat_hash_map<struct upid_t, timestamp_t> java_proc_attach_times_;
 
-  // Records of probe deployment status.
+  // Deduplication keys: statuses with the same key are folded into one pending record.
+  using SourceStatusKey = std::pair<std::string, int>;               // (source_connector, code).
+  using ProbeStatusKey = std::tuple<std::string, std::string, int>;  // + tracepoint.
+
+  // Records of probe deployment status. Stored as a ring bounded by kMaxStatusRecords; the index
+  // maps each record's dedup key to its slot.
   std::vector<ProbeStatusRecord> probe_status_records_ ABSL_GUARDED_BY(probe_status_lock_);
-  // Records of Stirling Source Connector status.
+  absl::flat_hash_map<ProbeStatusKey, size_t> probe_status_index_
+      ABSL_GUARDED_BY(probe_status_lock_);
+  size_t probe_status_next_evict_ ABSL_GUARDED_BY(probe_status_lock_) = 0;
+  // Records of Stirling Source Connector status, with the same ring structure.
   std::vector<SourceStatusRecord> source_status_records_ ABSL_GUARDED_BY(source_status_lock_);
+  absl::flat_hash_map<SourceStatusKey, size_t> source_status_index_
+      ABSL_GUARDED_BY(source_status_lock_);
+  size_t source_status_next_evict_ ABSL_GUARDED_BY(source_status_lock_) = 0;
 
   // Lock to protect probe and source records.
   absl::base_internal::SpinLock probe_status_lock_;
@@ -66,5 +66,44 @@ TEST(MonitorTest, DoesNotDisableJavaIfNotInCrashInWindow) {
   EXPECT_TRUE(FLAGS_stirling_profiler_java_symbols);
 }
 
+TEST(MonitorTest, SourceStatusRecordsDedupAndCount) {
+  StirlingMonitor& monitor = *StirlingMonitor::GetInstance();
+  // Drain records left over from other tests.
+  monitor.ConsumeSourceStatusRecords();
+
+  const Status err(px::statuspb::Code::INTERNAL, "boom");
+  monitor.AppendSourceStatusRecord("my_source", err, "Init");
+  monitor.AppendSourceStatusRecord("my_source", err, "Init");
+  monitor.AppendSourceStatusRecord("my_source", Status::OK(), "Init");
+
+  auto records = monitor.ConsumeSourceStatusRecords();
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].error, "boom");
+  EXPECT_EQ(records[0].count, 2);
+  EXPECT_EQ(records[1].count, 1);
+
+  // Consuming resets the dedup state.
+  monitor.AppendSourceStatusRecord("my_source", err, "Init");
+  records = monitor.ConsumeSourceStatusRecords();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].count, 1);
+}
+
+TEST(MonitorTest, ProbeStatusRecordsBounded) {
+  StirlingMonitor& monitor = *StirlingMonitor::GetInstance();
+  monitor.ConsumeProbeStatusRecords();
+
+  const Status err(px::statuspb::Code::INTERNAL, "attach failed");
+  for (size_t i = 0; i < 2 * StirlingMonitor::kMaxStatusRecords; ++i) {
+    monitor.AppendProbeStatusRecord("my_source", "probe" + std::to_string(i), err, "");
+  }
+
+  auto records = monitor.ConsumeProbeStatusRecords();
+  ASSERT_EQ(records.size(), StirlingMonitor::kMaxStatusRecords);
+  // The oldest distinct entries were evicted to stay within the bound.
+  EXPECT_EQ(records[0].tracepoint,
+            "probe" + std::to_string(StirlingMonitor::kMaxStatusRecords));
+}
+
 }  // namespace stirling
 }  // namespace px
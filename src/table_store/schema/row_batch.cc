@@ -17,9 +17,12 @@
  */
 
 #include <arrow/array.h>
+#include <arrow/buffer.h>
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <absl/strings/str_format.h>
@@ -158,6 +161,125 @@ Status CopyFromInputPB(std::shared_ptr<arrow::Array>* output_column,
   return Status::OK();
 }
 
+namespace {
+
+Status CopyIntoEncodedPB(DataType dt, arrow::Array* input_column,
+                         table_store::schemapb::EncodedColumn* output_column) {
+  CHECK_NOTNULL(input_column);
+  CHECK_NOTNULL(output_column);
+
+  output_column->set_data_type(dt);
+  int64_t num_rows = input_column->length();
+
+  if (dt == DataType::STRING) {
+    auto* str_col = static_cast<arrow::StringArray*>(input_column);
+    auto* out_offsets = output_column->mutable_offsets();
+    out_offsets->resize((num_rows + 1) * sizeof(int32_t));
+    auto* offsets_data = reinterpret_cast<int32_t*>(out_offsets->data());
+    if (num_rows == 0) {
+      offsets_data[0] = 0;
+      return Status::OK();
+    }
+    // Sliced arrays have a non-zero starting offset; rebase so the decoded offsets start at 0.
+    const int32_t* offsets = str_col->raw_value_offsets();
+    int32_t base = offsets[0];
+    if (base == 0) {
+      memcpy(offsets_data, offsets, (num_rows + 1) * sizeof(int32_t));
+    } else {
+      for (int64_t i = 0; i <= num_rows; ++i) {
+        offsets_data[i] = offsets[i] - base;
+      }
+    }
+    output_column->set_values(str_col->value_data()->data() + base, offsets[num_rows] - base);
+    return Status::OK();
+  }
+
+  if (dt == DataType::BOOLEAN) {
+    // Booleans are bit-packed, so a sliced array is not byte-addressable. Callers pack them
+    // value-by-value instead.
+    return error::Internal("BOOLEAN columns must use the value-by-value encoding.");
+  }
+
+  const auto& data = *input_column->data();
+  int64_t width = types::ArrowTypeToBytes(types::ToArrowType(dt));
+  output_column->set_values(data.buffers[1]->data() + data.offset * width, num_rows * width);
+  return Status::OK();
+}
+
+// An arrow buffer that references memory owned by something else (e.g. a received proto),
+// keeping the owner alive for the lifetime of the buffer. Used by the zero-copy decode path so
+// arrays can point directly at the wire bytes.
+class ForeignOwnedBuffer : public arrow::Buffer {
+ public:
+  ForeignOwnedBuffer(std::shared_ptr<const void> owner, const uint8_t* data, int64_t size)
+      : arrow::Buffer(data, size), owner_(std::move(owner)) {}
+
+ private:
+  std::shared_ptr<const void> owner_;
+};
+
+// Makes an arrow buffer for `str`: a zero-copy wrapper when the proto holding `str` has a shared
+// owner, otherwise a pool-allocated copy. `alignment` is the element width the buffer will be
+// read at; wire bytes that happen to be misaligned for it are copied instead of wrapped.
+StatusOr<std::shared_ptr<arrow::Buffer>> BufferFromEncodedField(
+    arrow::MemoryPool* pool, const std::string& str, int64_t alignment,
+    const std::shared_ptr<const void>& owner) {
+  if (owner != nullptr && reinterpret_cast<uintptr_t>(str.data()) % alignment == 0) {
+    return std::static_pointer_cast<arrow::Buffer>(std::make_shared<ForeignOwnedBuffer>(
+        owner, reinterpret_cast<const uint8_t*>(str.data()), str.size()));
+  }
+  std::shared_ptr<arrow::Buffer> buffer;
+  PL_RETURN_IF_ERROR(arrow::AllocateBuffer(pool, str.size(), &buffer));
+  memcpy(buffer->mutable_data(), str.data(), str.size());
+  return buffer;
+}
+
+Status CopyFromEncodedPB(std::shared_ptr<arrow::Array>* output_column,
+                         const table_store::schemapb::EncodedColumn& input_column,
+                         const std::shared_ptr<const void>& owner) {
+  CHECK_NOTNULL(output_column);
+
+  auto* pool = arrow::default_memory_pool();
+  auto dt = input_column.data_type();
+  if (dt == DataType::BOOLEAN) {
+    return error::Internal("BOOLEAN columns must use the value-by-value encoding.");
+  }
+  auto arrow_type = types::MakeArrowBuilder(dt, pool)->type();
+
+  if (dt == DataType::STRING) {
+    const auto& offsets = input_column.offsets();
+    if (offsets.size() < sizeof(int32_t) || offsets.size() % sizeof(int32_t) != 0) {
+      return error::Internal("Encoded STRING column has malformed offsets (size $0)",
+                             offsets.size());
+    }
+    int64_t num_rows = offsets.size() / sizeof(int32_t) - 1;
+    PL_ASSIGN_OR_RETURN(auto offsets_buffer,
+                        BufferFromEncodedField(pool, offsets, sizeof(int32_t), owner));
+    PL_ASSIGN_OR_RETURN(auto values_buffer, BufferFromEncodedField(pool, input_column.values(),
+                                                                   /* alignment */ 1, owner));
+    auto data = arrow::ArrayData::Make(arrow_type, num_rows,
+                                       {nullptr, offsets_buffer, values_buffer},
+                                       /* null_count */ 0);
+    *output_column = arrow::MakeArray(data);
+    return Status::OK();
+  }
+
+  int64_t width = types::ArrowTypeToBytes(types::ToArrowType(dt));
+  if (input_column.values().size() % width != 0) {
+    return error::Internal("Encoded column of type $0 has malformed values (size $1)",
+                           magic_enum::enum_name(dt), input_column.values().size());
+  }
+  int64_t num_rows = input_column.values().size() / width;
+  PL_ASSIGN_OR_RETURN(auto values_buffer,
+                      BufferFromEncodedField(pool, input_column.values(), width, owner));
+  auto data = arrow::ArrayData::Make(arrow_type, num_rows, {nullptr, values_buffer},
+                                     /* null_count */ 0);
+  *output_column = arrow::MakeArray(data);
+  return Status::OK();
+}
+
+}  // namespace
+
 Status RowBatch::ToProto(table_store::schemapb::RowBatchData* proto) const {
   proto->set_num_rows(num_rows_);
   proto->set_eow(eow_);
@@ -176,6 +298,26 @@ Status RowBatch::ToProto(table_store::schemapb::RowBatchData* proto) const {
   return Status::OK();
 }
 
+Status RowBatch::ToEncodedProto(table_store::schemapb::RowBatchData* proto) const {
+  proto->set_num_rows(num_rows_);
+  proto->set_eow(eow_);
+  proto->set_eos(eos_);
+
+  for (auto col_idx = 0; col_idx < num_columns(); ++col_idx) {
+    auto input_col = ColumnAt(col_idx).get();
+    auto output_col_data = proto->add_cols();
+    auto dt = desc_.type(col_idx);
+
+    if (dt == DataType::BOOLEAN) {
+      CopyIntoOutputPB<DataType::BOOLEAN>(output_col_data, input_col);
+      continue;
+    }
+    PL_RETURN_IF_ERROR(CopyIntoEncodedPB(dt, input_col, output_col_data->mutable_encoded_data()));
+  }
+
+  return Status::OK();
+}
+
 // PL_CARNOT_UPDATE_FOR_NEW_TYPES
 StatusOr<DataType> ProtoDataType(const table_store::schemapb::Column& proto) {
   switch (proto.col_data_case()) {
@@ -191,6 +333,8 @@ StatusOr<DataType> ProtoDataType(const table_store::schemapb::Column& proto) {
       return DataType::FLOAT64;
     case table_store::schemapb::Column::kStringData:
       return DataType::STRING;
+    case table_store::schemapb::Column::kEncodedData:
+      return proto.encoded_data().data_type();
     default:
       return error::Internal("Received unknown column data type '$0' in ProtoDataType",
                              magic_enum::enum_name(proto.col_data_case()));
@@ -199,6 +343,11 @@ StatusOr<DataType> ProtoDataType(const table_store::schemapb::Column& proto) {
 
 StatusOr<std::unique_ptr<RowBatch>> RowBatch::FromProto(
     const table_store::schemapb::RowBatchData& proto) {
+  return FromProto(proto, /* owner */ nullptr);
+}
+
+StatusOr<std::unique_ptr<RowBatch>> RowBatch::FromProto(
+    const table_store::schemapb::RowBatchData& proto, std::shared_ptr<const void> owner) {
   std::vector<DataType> types(proto.cols_size());
   std::vector<std::shared_ptr<arrow::Array>> data_columns(proto.cols_size());
 
@@ -206,6 +355,11 @@ StatusOr<std::unique_ptr<RowBatch>> RowBatch::FromProto(
     PL_ASSIGN_OR_RETURN(types[i], ProtoDataType(proto.cols(i)));
     std::shared_ptr<arrow::Array> output_array;
 
+    if (proto.cols(i).col_data_case() == table_store::schemapb::Column::kEncodedData) {
+      PL_RETURN_IF_ERROR(CopyFromEncodedPB(&data_columns[i], proto.cols(i).encoded_data(), owner));
+      continue;
+    }
+
 #define TYPE_CASE(_dt_) PL_RETURN_IF_ERROR(CopyFromInputPB<_dt_>(&data_columns[i], proto.cols(i)));
     PL_SWITCH_FOREACH_DATATYPE(types[i], TYPE_CASE);
 #undef TYPE_CASE
@@ -50,9 +50,27 @@ class RowBatch {
   }
 
   Status ToProto(table_store::schemapb::RowBatchData* row_batch_proto) const;
+
+  /**
+   * Serializes the row batch using raw column buffers (one copy per buffer) instead of packing
+   * values one at a time. FromProto accepts both forms, but only other Carnot instances
+   * understand the encoded columns, so this must not be used for results sent to external
+   * services such as the query broker. BOOLEAN columns are bit-packed by arrow and fall back to
+   * the value-by-value form.
+   */
+  Status ToEncodedProto(table_store::schemapb::RowBatchData* row_batch_proto) const;
+
   static StatusOr<std::unique_ptr<RowBatch>> FromProto(
       const table_store::schemapb::RowBatchData& row_batch_proto);
 
+  /**
+   * Like FromProto, but adopts encoded column buffers zero-copy: the returned arrays reference
+   * the proto's wire bytes directly, and `owner` (typically the message holding the proto) is
+   * kept alive by the arrays. Value-by-value columns are still decoded with a copy.
+   */
+  static StatusOr<std::unique_ptr<RowBatch>> FromProto(
+      const table_store::schemapb::RowBatchData& row_batch_proto, std::shared_ptr<const void> owner);
+
   static StatusOr<std::unique_ptr<RowBatch>> FromColumnBuilders(
       const RowDescriptor& desc, bool eow, bool eos,
       std::vector<std::unique_ptr<arrow::ArrayBuilder>>* builders);
@@ -179,6 +179,109 @@ TEST_F(RowBatchTest, to_from_proto) {
   EXPECT_TRUE(differ.Compare(input_proto, output_proto));
 }
 
+TEST_F(RowBatchTest, to_from_encoded_proto) {
+  auto descriptor =
+      std::vector<types::DataType>({types::DataType::BOOLEAN, types::DataType::INT64,
+                                    types::DataType::FLOAT64, types::DataType::STRING});
+  RowDescriptor rd(descriptor);
+  auto rb = std::make_unique<RowBatch>(rd, 3);
+
+  std::vector<types::BoolValue> in1 = {true, false, true};
+  std::vector<types::Int64Value> in2 = {3, 4, 5};
+  std::vector<types::Float64Value> in3 = {3.3, 4.1, 5.6};
+  std::vector<types::StringValue> in4 = {"hello", "thisIs", "aString"};
+
+  EXPECT_OK(rb->AddColumn(types::ToArrow(in1, arrow::default_memory_pool())));
+  EXPECT_OK(rb->AddColumn(types::ToArrow(in2, arrow::default_memory_pool())));
+  EXPECT_OK(rb->AddColumn(types::ToArrow(in3, arrow::default_memory_pool())));
+  EXPECT_OK(rb->AddColumn(types::ToArrow(in4, arrow::default_memory_pool())));
+  rb->set_eow(true);
+
+  table_store::schemapb::RowBatchData proto;
+  EXPECT_OK(rb->ToEncodedProto(&proto));
+  // Booleans fall back to the value-by-value form; everything else is encoded.
+  EXPECT_TRUE(proto.cols(0).has_boolean_data());
+  EXPECT_TRUE(proto.cols(1).has_encoded_data());
+  EXPECT_TRUE(proto.cols(3).has_encoded_data());
+
+  auto out_rb = RowBatch::FromProto(proto).ConsumeValueOrDie();
+  EXPECT_TRUE(out_rb->eow());
+  EXPECT_FALSE(out_rb->eos());
+  ASSERT_EQ(3, out_rb->num_rows());
+  for (int64_t i = 0; i < rb->num_columns(); ++i) {
+    EXPECT_EQ(rd.type(i), out_rb->desc().type(i));
+    EXPECT_TRUE(rb->ColumnAt(i)->Equals(out_rb->ColumnAt(i)));
+  }
+}
+
+TEST_F(RowBatchTest, to_from_encoded_proto_sliced) {
+  auto descriptor = std::vector<types::DataType>({types::DataType::INT64, types::DataType::STRING});
+  RowDescriptor rd(descriptor);
+  auto rb = std::make_unique<RowBatch>(rd, 4);
+
+  std::vector<types::Int64Value> in1 = {1, 2, 3, 4};
+  std::vector<types::StringValue> in2 = {"a", "bb", "ccc", "dddd"};
+  EXPECT_OK(rb->AddColumn(types::ToArrow(in1, arrow::default_memory_pool())));
+  EXPECT_OK(rb->AddColumn(types::ToArrow(in2, arrow::default_memory_pool())));
+
+  // Slices have a non-zero array offset, so this exercises the offset rebasing.
+  ASSERT_OK_AND_ASSIGN(auto sliced_rb, rb->Slice(1, 2));
+  table_store::schemapb::RowBatchData proto;
+  EXPECT_OK(sliced_rb->ToEncodedProto(&proto));
+
+  auto out_rb = RowBatch::FromProto(proto).ConsumeValueOrDie();
+  ASSERT_EQ(2, out_rb->num_rows());
+  for (int64_t i = 0; i < sliced_rb->num_columns(); ++i) {
+    EXPECT_TRUE(sliced_rb->ColumnAt(i)->Equals(out_rb->ColumnAt(i)));
+  }
+}
+
+TEST_F(RowBatchTest, from_encoded_proto_zero_copy) {
+  auto descriptor = std::vector<types::DataType>({types::DataType::INT64, types::DataType::STRING});
+  RowDescriptor rd(descriptor);
+  auto rb = std::make_unique<RowBatch>(rd, 3);
+
+  std::vector<types::Int64Value> in1 = {1, 2, 3};
+  std::vector<types::StringValue> in2 = {"hello", "thisIs", "aString"};
+  EXPECT_OK(rb->AddColumn(types::ToArrow(in1, arrow::default_memory_pool())));
+  EXPECT_OK(rb->AddColumn(types::ToArrow(in2, arrow::default_memory_pool())));
+
+  auto proto = std::make_shared<table_store::schemapb::RowBatchData>();
+  EXPECT_OK(rb->ToEncodedProto(proto.get()));
+
+  std::unique_ptr<RowBatch> out_rb;
+  {
+    // The proto is only kept alive by the arrays after this scope, so reads below also verify the
+    // ownership handoff.
+    auto out_or_s = RowBatch::FromProto(*proto, proto);
+    ASSERT_OK(out_or_s);
+    out_rb = out_or_s.ConsumeValueOrDie();
+    // The INT64 column should reference the proto's wire bytes rather than a copy.
+    EXPECT_EQ(reinterpret_cast<const uint8_t*>(proto->cols(0).encoded_data().values().data()),
+              out_rb->ColumnAt(0)->data()->buffers[1]->data());
+    proto.reset();
+  }
+
+  ASSERT_EQ(3, out_rb->num_rows());
+  for (int64_t i = 0; i < rb->num_columns(); ++i) {
+    EXPECT_TRUE(rb->ColumnAt(i)->Equals(out_rb->ColumnAt(i)));
+  }
+}
+
+TEST_F(RowBatchTest, to_from_encoded_proto_zero_rows) {
+  auto descriptor = std::vector<types::DataType>({types::DataType::INT64, types::DataType::STRING});
+  RowDescriptor rd(descriptor);
+  auto rb = RowBatch::WithZeroRows(rd, /* eow */ false, /* eos */ false).ConsumeValueOrDie();
+
+  table_store::schemapb::RowBatchData proto;
+  EXPECT_OK(rb->ToEncodedProto(&proto));
+
+  auto out_rb = RowBatch::FromProto(proto).ConsumeValueOrDie();
+  EXPECT_EQ(0, out_rb->num_rows());
+  EXPECT_EQ(types::DataType::INT64, out_rb->desc().type(0));
+  EXPECT_EQ(types::DataType::STRING, out_rb->desc().type(1));
+}
+
 TEST_F(RowBatchTest, with_zero_rows) {
   bool eow = true;
   bool eos = false;
@@ -4,6 +4,7 @@
 package schemapb
 
 import (
+	bytes "bytes"
 	encoding_binary "encoding/binary"
 	fmt "fmt"
 	_ "github.com/gogo/protobuf/gogoproto"
@@ -280,6 +281,65 @@ func (m *StringColumn) XXX_DiscardUnknown() {
 
 var xxx_messageInfo_StringColumn proto.InternalMessageInfo
 
+type EncodedColumn struct {
+	DataType typespb.DataType `protobuf:"varint,1,opt,name=data_type,json=dataType,proto3,enum=px.types.DataType" json:"data_type,omitempty"`
+	Values   []byte           `protobuf:"bytes,2,opt,name=values,proto3" json:"values,omitempty"`
+	Offsets  []byte           `protobuf:"bytes,3,opt,name=offsets,proto3" json:"offsets,omitempty"`
+}
+
+func (m *EncodedColumn) Reset()      { *m = EncodedColumn{} }
+func (*EncodedColumn) ProtoMessage() {}
+func (*EncodedColumn) Descriptor() ([]byte, []int) {
+	return fileDescriptor_837edaf494876c32, []int{6}
+}
+func (m *EncodedColumn) XXX_Unmarshal(b []byte) error {
+	return m.Unmarshal(b)
+}
+func (m *EncodedColumn) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	if deterministic {
+		return xxx_messageInfo_EncodedColumn.Marshal(b, m, deterministic)
+	} else {
+		b = b[:cap(b)]
+		n, err := m.MarshalToSizedBuffer(b)
+		if err != nil {
+			return nil, err
+		}
+		return b[:n], nil
+	}
+}
+func (m *EncodedColumn) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_EncodedColumn.Merge(m, src)
+}
+func (m *EncodedColumn) XXX_Size() int {
+	return m.Size()
+}
+func (m *EncodedColumn) XXX_DiscardUnknown() {
+	xxx_messageInfo_EncodedColumn.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_EncodedColumn proto.InternalMessageInfo
+
+func (m *EncodedColumn) GetDataType() typespb.DataType {
+	if m != nil {
+		return m.DataType
+	}
+	return typespb.DATA_TYPE_UNKNOWN
+}
+
+func (m *EncodedColumn) GetValues() []byte {
+	if m != nil {
+		return m.Values
+	}
+	return nil
+}
+
+func (m *EncodedColumn) GetOffsets() []byte {
+	if m != nil {
+		return m.Offsets
+	}
+	return nil
+}
+
 type Column struct {
 	// Types that are valid to be assigned to ColData:
 	//	*Column_BooleanData
@@ -288,13 +348,14 @@ type Column struct {
 	//	*Column_Time64NsData
 	//	*Column_Float64Data
 	//	*Column_StringData
+	//	*Column_EncodedData
 	ColData isColumn_ColData `protobuf_oneof:"col_data"`
 }
 
 func (m *Column) Reset()      { *m = Column{} }
 func (*Column) ProtoMessage() {}
 func (*Column) Descriptor() ([]byte, []int) {
-	return fileDescriptor_837edaf494876c32, []int{6}
+	return fileDescriptor_837edaf494876c32, []int{7}
 }
 func (m *Column) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -348,6 +409,9 @@ type Column_Float64Data struct {
 type Column_StringData struct {
 	StringData *StringColumn `protobuf:"bytes,6,opt,name=string_data,json=stringData,proto3,oneof" json:"string_data,omitempty"`
 }
+type Column_EncodedData struct {
+	EncodedData *EncodedColumn `protobuf:"bytes,7,opt,name=encoded_data,json=encodedData,proto3,oneof" json:"encoded_data,omitempty"`
+}
 
 func (*Column_BooleanData) isColumn_ColData()  {}
 func (*Column_Int64Data) isColumn_ColData()    {}
@@ -355,6 +419,7 @@ func (*Column_Uint128Data) isColumn_ColData()  {}
 func (*Column_Time64NsData) isColumn_ColData() {}
 func (*Column_Float64Data) isColumn_ColData()  {}
 func (*Column_StringData) isColumn_ColData()   {}
+func (*Column_EncodedData) isColumn_ColData()  {}
 
 func (m *Column) GetColData() isColumn_ColData {
 	if m != nil {
@@ -405,6 +470,13 @@ func (m *Column) GetStringData() *StringColumn {
 	return nil
 }
 
+func (m *Column) GetEncodedData() *EncodedColumn {
+	if x, ok := m.GetColData().(*Column_EncodedData); ok {
+		return x.EncodedData
+	}
+	return nil
+}
+
 // XXX_OneofWrappers is for the internal use of the proto package.
 func (*Column) XXX_OneofWrappers() []interface{} {
 	return []interface{}{
@@ -414,6 +486,7 @@ func (*Column) XXX_OneofWrappers() []interface{} {
 		(*Column_Time64NsData)(nil),
 		(*Column_Float64Data)(nil),
 		(*Column_StringData)(nil),
+		(*Column_EncodedData)(nil),
 	}
 }
 
@@ -427,7 +500,7 @@ type RowBatchData struct {
 func (m *RowBatchData) Reset()      { *m = RowBatchData{} }
 func (*RowBatchData) ProtoMessage() {}
 func (*RowBatchData) Descriptor() ([]byte, []int) {
-	return fileDescriptor_837edaf494876c32, []int{7}
+	return fileDescriptor_837edaf494876c32, []int{8}
 }
 func (m *RowBatchData) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -492,7 +565,7 @@ type Relation struct {
 func (m *Relation) Reset()      { *m = Relation{} }
 func (*Relation) ProtoMessage() {}
 func (*Relation) Descriptor() ([]byte, []int) {
-	return fileDescriptor_837edaf494876c32, []int{8}
+	return fileDescriptor_837edaf494876c32, []int{9}
 }
 func (m *Relation) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -546,7 +619,7 @@ type Relation_ColumnInfo struct {
 func (m *Relation_ColumnInfo) Reset()      { *m = Relation_ColumnInfo{} }
 func (*Relation_ColumnInfo) ProtoMessage() {}
 func (*Relation_ColumnInfo) Descriptor() ([]byte, []int) {
-	return fileDescriptor_837edaf494876c32, []int{8, 0}
+	return fileDescriptor_837edaf494876c32, []int{9, 0}
 }
 func (m *Relation_ColumnInfo) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -619,7 +692,7 @@ type Table struct {
 func (m *Table) Reset()      { *m = Table{} }
 func (*Table) ProtoMessage() {}
 func (*Table) Descriptor() ([]byte, []int) {
-	return fileDescriptor_837edaf494876c32, []int{9}
+	return fileDescriptor_837edaf494876c32, []int{10}
 }
 func (m *Table) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -676,7 +749,7 @@ type Schema struct {
 func (m *Schema) Reset()      { *m = Schema{} }
 func (*Schema) ProtoMessage() {}
 func (*Schema) Descriptor() ([]byte, []int) {
-	return fileDescriptor_837edaf494876c32, []int{10}
+	return fileDescriptor_837edaf494876c32, []int{11}
 }
 func (m *Schema) XXX_Unmarshal(b []byte) error {
 	return m.Unmarshal(b)
@@ -719,6 +792,7 @@ func init() {
 	proto.RegisterType((*Float64Column)(nil), "px.table_store.schemapb.Float64Column")
 	proto.RegisterType((*Time64NSColumn)(nil), "px.table_store.schemapb.Time64NSColumn")
 	proto.RegisterType((*StringColumn)(nil), "px.table_store.schemapb.StringColumn")
+	proto.RegisterType((*EncodedColumn)(nil), "px.table_store.schemapb.EncodedColumn")
 	proto.RegisterType((*Column)(nil), "px.table_store.schemapb.Column")
 	proto.RegisterType((*RowBatchData)(nil), "px.table_store.schemapb.RowBatchData")
 	proto.RegisterType((*Relation)(nil), "px.table_store.schemapb.Relation")
@@ -733,59 +807,59 @@ func init() {
 }
 
 var fileDescriptor_837edaf494876c32 = []byte{
-	// 825 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8c, 0x95, 0xcf, 0x6f, 0xe3, 0x44,
-	0x14, 0xc7, 0xed, 0xa6, 0xc9, 0xa6, 0xcf, 0xee, 0x6a, 0x19, 0xf1, 0x63, 0xe9, 0xc1, 0x65, 0xb3,
-	0x2d, 0xec, 0x01, 0x1c, 0x68, 0x57, 0xa5, 0x5a, 0x09, 0x0e, 0x61, 0xb7, 0x4a, 0xb5, 0x22, 0x42,
-	0x93, 0x72, 0xe1, 0x40, 0x34, 0x76, 0xa7, 0x89, 0x85, 0xed, 0xb1, 0x3c, 0x93, 0x4d, 0x73, 0x43,
-	0x5c, 0xb8, 0xf2, 0x37, 0x70, 0xe2, 0xcf, 0xe0, 0xc8, 0xb1, 0xc7, 0x15, 0x42, 0x88, 0xa6, 0x17,
-	0x8e, 0xfd, 0x13, 0x90, 0xdf, 0x8c, 0x1b, 0x07, 0xd5, 0x94, 0x4b, 0xfb, 0x66, 0xfc, 0x7d, 0x9f,
-	0xf7, 0xfa, 0xbe, 0xcf, 0x35, 0xec, 0xca, 0x3c, 0xec, 0x2a, 0x16, 0xc4, 0x7c, 0x24, 0x95, 0xc8,
-	0x79, 0x57, 0x86, 0x13, 0x9e, 0xb0, 0x2c, 0x30, 0x81, 0x9f, 0xe5, 0x42, 0x09, 0xf2, 0x4e, 0x76,
-	0xee, 0x57, 0x54, 0x7e, 0xa9, 0xda, 0xfa, 0x68, 0x1c, 0xa9, 0xc9, 0x34, 0xf0, 0x43, 0x91, 0x74,
-	0xc7, 0x62, 0x2c, 0xba, 0xa8, 0x0f, 0xa6, 0x67, 0x78, 0xc2, 0x03, 0x46, 0x9a, 0xb3, 0xb5, 0x53,
-	0x94, 0x93, 0x13, 0x96, 0xf3, 0xd3, 0xae, 0x9a, 0x67, 0x5c, 0xea, 0x9f, 0x59, 0xa0, 0x7f, 0x6b,
-	0x55, 0xe7, 0x31, 0x6c, 0xf6, 0x84, 0x88, 0x39, 0x4b, 0xbf, 0x10, 0xf1, 0x34, 0x49, 0x09, 0x81,
-	0xf5, 0x53, 0xa6, 0xd8, 0x43, 0xfb, 0xbd, 0xc6, 0x93, 0x36, 0xc5, 0xb8, 0xf3, 0x08, 0x9c, 0xe3,
-	0x54, 0x1d, 0x3c, 0xbd, 0x45, 0xd2, 0x30, 0x92, 0x03, 0xd8, 0xfc, 0xfa, 0x38, 0x55, 0x9f, 0xec,
-	0x1d, 0x1a, 0xd1, 0x6e, 0x45, 0xe4, 0xec, 0xbd, 0xe1, 0x17, 0x7f, 0x15, 0xd6, 0x35, 0x32, 0x93,
-	0xf7, 0x18, 0x36, 0x8f, 0x62, 0xc1, 0x6e, 0x87, 0xdb, 0x46, 0xb4, 0x03, 0xf7, 0x4f, 0xa2, 0x84,
-	0x1f, 0x3c, 0x1d, 0x0c, 0xff, 0xa3, 0x85, 0x6f, 0xc1, 0x1d, 0xaa, 0x3c, 0x4a, 0xc7, 0x46, 0x33,
-	0xa8, 0x68, 0xdc, 0xde, 0xb3, 0xdf, 0xff, 0xdc, 0x3e, 0xc8, 0xce, 0xfd, 0x53, 0xfe, 0xaa, 0x9b,
-	0x45, 0xe7, 0x11, 0xef, 0xd6, 0xda, 0xa1, 0xfb, 0xd4, 0xac, 0xe7, 0x4c, 0x31, 0xc3, 0xff, 0xa3,
-	0x01, 0x2d, 0x83, 0x7e, 0x09, 0x6e, 0xa0, 0xa7, 0x36, 0x32, 0x25, 0xec, 0x27, 0xce, 0xde, 0xfb,
-	0x7e, 0x8d, 0x75, 0xfe, 0xca, 0x88, 0xfb, 0x16, 0x75, 0x4c, 0x76, 0x41, 0x27, 0x2f, 0x00, 0xa2,
-	0x62, 0xba, 0x1a, 0xb5, 0x86, 0xa8, 0x9d, 0x5a, 0x54, 0xc5, 0x88, 0xbe, 0x45, 0x37, 0x30, 0x13,
-	0x31, 0x2f, 0xc1, 0x9d, 0x46, 0x38, 0x5a, 0x0d, 0x6a, 0xdc, 0xd1, 0xd3, 0x8a, 0x5d, 0x45, 0x4f,
-	0x26, 0x1b, 0x61, 0x03, 0xd8, 0x54, 0x38, 0xf1, 0x54, 0x6a, 0xda, 0x3a, 0xd2, 0x3e, 0xa8, 0xa5,
-	0xad, 0xfa, 0xd3, 0xb7, 0xa8, 0x5b, 0xe6, 0x97, 0xcd, 0x9d, 0x69, 0x9b, 0x35, 0xae, 0x79, 0x47,
-	0x73, 0x2b, 0x3b, 0x51, 0x34, 0x67, 0xb2, 0x11, 0xd6, 0x07, 0x47, 0xa2, 0x39, 0x9a, 0xd5, 0x42,
-	0xd6, 0x6e, 0x2d, 0xab, 0xba, 0x14, 0x7d, 0x8b, 0x82, 0xbc, 0x31, 0xb6, 0x07, 0xd0, 0x0e, 0x45,
-	0x8c, 0x98, 0xce, 0x0f, 0x36, 0xb8, 0x54, 0xcc, 0x7a, 0x4c, 0x85, 0x13, 0x2c, 0xb3, 0x0f, 0xeb,
-	0xa1, 0x88, 0xa5, 0xd9, 0xe0, 0xed, 0x5a, 0xbe, 0x26, 0x53, 0x14, 0x93, 0x77, 0xa1, 0x9d, 0x4e,
-	0x93, 0x51, 0x2e, 0x66, 0x12, 0xad, 0x6c, 0xd0, 0x7b, 0xe9, 0x34, 0xa1, 0x62, 0x26, 0xc9, 0x03,
-	0x68, 0x70, 0x31, 0x43, 0x5f, 0xda, 0xb4, 0x08, 0xf5, 0x8d, 0xc4, 0xd9, 0xe2, 0x8d, 0xec, 0x5c,
-	0xaf, 0x41, 0x9b, 0xf2, 0x98, 0xa9, 0x48, 0xa4, 0xe4, 0x08, 0xee, 0x85, 0xc8, 0x2e, 0x7b, 0xf8,
-	0xb0, 0xb6, 0x87, 0x32, 0xc7, 0x34, 0x73, 0x9c, 0x9e, 0x09, 0x5a, 0x26, 0xe3, 0xcb, 0xc2, 0x65,
-	0x88, 0xfd, 0x6c, 0x50, 0x8c, 0xb7, 0x7e, 0x5c, 0x03, 0x58, 0x6a, 0xc9, 0x36, 0x38, 0x5a, 0x3d,
-	0x4a, 0x59, 0xc2, 0x71, 0x9f, 0x37, 0x28, 0xe8, 0xab, 0x01, 0x4b, 0x38, 0xd9, 0xbf, 0x11, 0x14,
-	0x6f, 0x07, 0xa2, 0xee, 0xef, 0x91, 0xe5, 0x5b, 0x5d, 0x4c, 0xec, 0x64, 0x9e, 0xf1, 0x32, 0xa9,
-	0x88, 0x2b, 0x54, 0xac, 0xdf, 0xa8, 0x52, 0x9f, 0x73, 0x19, 0x92, 0x3e, 0xbc, 0x69, 0x04, 0x92,
-	0x27, 0x2c, 0x55, 0x51, 0xa8, 0xf1, 0xeb, 0x88, 0x7f, 0x7b, 0x89, 0x1f, 0x9a, 0xc7, 0x58, 0x82,
-	0xe8, 0x9c, 0xea, 0x1d, 0x39, 0x04, 0x37, 0x63, 0x4a, 0xf1, 0xdc, 0x34, 0xd8, 0x44, 0xc2, 0x5b,
-	0x4b, 0xc2, 0x57, 0xfa, 0x29, 0x02, 0x9c, 0x6c, 0x79, 0xe8, 0xfc, 0x6c, 0x43, 0xf3, 0xa4, 0x98,
-	0x29, 0xf9, 0x0c, 0xda, 0xb9, 0x99, 0xa3, 0xd9, 0xf7, 0x47, 0x77, 0x0e, 0x9c, 0xde, 0xa4, 0x90,
-	0x23, 0x70, 0x72, 0x31, 0x1b, 0x05, 0xc5, 0x02, 0x71, 0xf9, 0xb0, 0x89, 0x96, 0xd5, 0xaf, 0x65,
-	0x75, 0xd7, 0x28, 0xe4, 0xe6, 0xc4, 0xd1, 0x2e, 0x34, 0xa1, 0xa5, 0xed, 0x2a, 0xe2, 0xce, 0xaf,
-	0x36, 0xb4, 0x86, 0x98, 0x49, 0x86, 0xe0, 0x96, 0x25, 0x47, 0x09, 0xcb, 0xcc, 0x6a, 0x7c, 0x5c,
-	0xbf, 0xfe, 0xfa, 0xe3, 0x52, 0x36, 0xfc, 0x25, 0xcb, 0x5e, 0xa4, 0x2a, 0x9f, 0x53, 0x27, 0x5f,
-	0xde, 0x6c, 0x31, 0x78, 0xf0, 0x6f, 0x41, 0xb1, 0x9d, 0xdf, 0xf1, 0xb9, 0xd9, 0x85, 0x22, 0x24,
-	0x9f, 0x42, 0xf3, 0x15, 0x8b, 0xa7, 0xdc, 0xfc, 0x93, 0xfa, 0x1f, 0xd3, 0xd1, 0xfa, 0x67, 0x6b,
-	0x87, 0x76, 0xef, 0xf3, 0x8b, 0x4b, 0xcf, 0x7a, 0x7d, 0xe9, 0x59, 0xd7, 0x97, 0x9e, 0xfd, 0xfd,
-	0xc2, 0xb3, 0x7f, 0x59, 0x78, 0xf6, 0x6f, 0x0b, 0xcf, 0xbe, 0x58, 0x78, 0xf6, 0x5f, 0x0b, 0xcf,
-	0xfe, 0x7b, 0xe1, 0x59, 0xd7, 0x0b, 0xcf, 0xfe, 0xe9, 0xca, 0xb3, 0x2e, 0xae, 0x3c, 0xeb, 0xf5,
-	0x95, 0x67, 0x7d, 0xd3, 0x2e, 0x99, 0x41, 0x0b, 0x3f, 0x58, 0xfb, 0xff, 0x04, 0x00, 0x00, 0xff,
-	0xff, 0xbd, 0x31, 0x06, 0x07, 0x47, 0x07, 0x00, 0x00,
+	// 817 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x8d, 0x95, 0xcb, 0x6e, 0xd3, 0x40,
+	0x14, 0x86, 0x71, 0xae, 0xce, 0xb1, 0x5b, 0x15, 0x0b, 0x4a, 0xc8, 0xa6, 0x34, 0xb4, 0xd0, 0x05,
+	0x24, 0xd0, 0x56, 0xa1, 0xaa, 0xc4, 0x26, 0xb4, 0x55, 0x2b, 0x44, 0x84, 0x9c, 0xb2, 0x61, 0x41,
+	0xe4, 0x38, 0x93, 0xc4, 0x22, 0xf1, 0x58, 0x9e, 0x49, 0x2f, 0x5b, 0x36, 0xbc, 0x07, 0x3b, 0xde,
+	0x82, 0xe7, 0x60, 0xc1, 0x33, 0xf0, 0x08, 0xcc, 0x9c, 0x19, 0x37, 0x0e, 0xaa, 0x09, 0x9b, 0x64,
+	0x2e, 0xff, 0xf9, 0xce, 0xef, 0x39, 0x67, 0x6c, 0xd8, 0x66, 0xb1, 0xdf, 0xe4, 0x5e, 0x7f, 0x42,
+	0x7a, 0x8c, 0xd3, 0x98, 0x34, 0x99, 0x3f, 0x26, 0x53, 0x2f, 0xea, 0xeb, 0x41, 0x23, 0x8a, 0x29,
+	0xa7, 0xce, 0x83, 0xe8, 0xaa, 0x91, 0x52, 0x35, 0x12, 0x55, 0xed, 0xf9, 0x28, 0xe0, 0xe3, 0x59,
+	0xbf, 0xe1, 0xd3, 0x69, 0x73, 0x44, 0x47, 0xb4, 0x89, 0xfa, 0xfe, 0x6c, 0x88, 0x33, 0x9c, 0xe0,
+	0x48, 0x71, 0x6a, 0x5b, 0x32, 0x1d, 0x1b, 0x7b, 0x31, 0x19, 0x34, 0xf9, 0x75, 0x44, 0x98, 0xfa,
+	0x15, 0xe9, 0xf0, 0x5f, 0xa9, 0xea, 0x8f, 0x61, 0xa5, 0x4d, 0xe9, 0x84, 0x78, 0xe1, 0x1b, 0x3a,
+	0x99, 0x4d, 0x43, 0xc7, 0x81, 0xc2, 0xc0, 0xe3, 0x5e, 0xd5, 0x78, 0x94, 0xdf, 0x31, 0x5d, 0x1c,
+	0xd7, 0x37, 0xc1, 0x3a, 0x0b, 0x79, 0x6b, 0xff, 0x16, 0x49, 0x5e, 0x4b, 0x5a, 0xb0, 0xf2, 0x41,
+	0x68, 0x5e, 0xee, 0x1e, 0x68, 0xd1, 0x76, 0x4a, 0x64, 0xed, 0xde, 0x6d, 0xc8, 0xa7, 0xc2, 0xbc,
+	0x5a, 0xa6, 0xe3, 0x44, 0xfe, 0x93, 0x09, 0xf5, 0x6e, 0x87, 0x1b, 0x5a, 0xb4, 0x05, 0xab, 0xe7,
+	0xc1, 0x94, 0xb4, 0xf6, 0x3b, 0xdd, 0x7f, 0x58, 0xf8, 0x04, 0x76, 0x97, 0xc7, 0x41, 0x38, 0xd2,
+	0x9a, 0x4e, 0x4a, 0x63, 0xb7, 0x0f, 0x7f, 0xfe, 0xda, 0x68, 0x09, 0x13, 0x03, 0x72, 0xd1, 0x8c,
+	0x82, 0xab, 0x40, 0x1c, 0x7f, 0x56, 0x39, 0x94, 0x4f, 0xc5, 0x3a, 0x12, 0x04, 0xcd, 0x8f, 0x61,
+	0xe5, 0x38, 0xf4, 0xe9, 0x80, 0x0c, 0x74, 0x82, 0x26, 0x54, 0xe4, 0x46, 0x4f, 0xea, 0x45, 0x16,
+	0x63, 0x67, 0x75, 0xd7, 0x99, 0x3f, 0xa7, 0x8c, 0x3c, 0x17, 0x23, 0xd7, 0x1c, 0xe8, 0x91, 0xb3,
+	0x0e, 0xa5, 0x0b, 0x6f, 0x32, 0x23, 0xac, 0x9a, 0x13, 0x6a, 0xdb, 0xd5, 0x33, 0xa7, 0x0a, 0x65,
+	0x3a, 0x1c, 0x32, 0xc2, 0x59, 0x35, 0x8f, 0x1b, 0xc9, 0xb4, 0xfe, 0xbd, 0x00, 0x25, 0x9d, 0xed,
+	0x2d, 0xd8, 0x7d, 0x55, 0xa9, 0x9e, 0x7e, 0x2c, 0x43, 0x1c, 0xec, 0x93, 0x46, 0x46, 0xbb, 0x34,
+	0x16, 0xca, 0x7a, 0x7a, 0xc7, 0xb5, 0x74, 0xb4, 0xf4, 0xe5, 0x1c, 0x03, 0x04, 0xb2, 0xa2, 0x0a,
+	0x95, 0x43, 0xd4, 0x56, 0x26, 0x2a, 0x55, 0x7c, 0x01, 0xaa, 0x60, 0x24, 0x62, 0x84, 0xa7, 0x59,
+	0x80, 0xe5, 0x54, 0xa0, 0xfc, 0x12, 0x4f, 0x0b, 0x2d, 0x22, 0x3d, 0xe9, 0x68, 0x84, 0x75, 0x60,
+	0x85, 0x63, 0x95, 0x43, 0xa6, 0x68, 0x05, 0xa4, 0x3d, 0xcd, 0xa4, 0x2d, 0xf6, 0x84, 0xc0, 0xd9,
+	0x49, 0x7c, 0x62, 0x6e, 0xa8, 0x5a, 0x4b, 0xe1, 0x8a, 0x4b, 0xcc, 0x2d, 0xf4, 0xa1, 0x34, 0xa7,
+	0xa3, 0x11, 0x76, 0x0a, 0x16, 0xc3, 0x86, 0x50, 0xac, 0x12, 0xb2, 0xb6, 0x33, 0x59, 0xe9, 0x46,
+	0x14, 0x28, 0x60, 0x37, 0xcd, 0x24, 0x6d, 0x11, 0xd5, 0x46, 0x0a, 0x55, 0x5e, 0x62, 0x6b, 0xa1,
+	0xe7, 0xa4, 0x2d, 0x1d, 0x2d, 0x61, 0x6d, 0x00, 0xd3, 0xa7, 0x13, 0x04, 0xd5, 0xbf, 0x18, 0x60,
+	0xbb, 0xf4, 0xb2, 0xed, 0x71, 0x7f, 0x8c, 0x99, 0xf6, 0xa0, 0x20, 0x36, 0x99, 0xbe, 0x82, 0x1b,
+	0x99, 0x19, 0x14, 0xda, 0x45, 0xb1, 0xf3, 0x10, 0xcc, 0x70, 0x36, 0xed, 0xc5, 0xf4, 0x52, 0x75,
+	0x69, 0xde, 0x2d, 0x8b, 0xb9, 0xe0, 0x32, 0x67, 0x0d, 0xf2, 0x84, 0x5e, 0x62, 0x91, 0x4d, 0x57,
+	0x0e, 0xd5, 0x0a, 0xc3, 0x42, 0xe1, 0x0a, 0xab, 0xff, 0xce, 0x81, 0xe9, 0x92, 0x89, 0xc7, 0x03,
+	0x1a, 0x3a, 0x27, 0x50, 0xf6, 0x91, 0x9d, 0x78, 0x78, 0x96, 0xe9, 0x21, 0x89, 0xd1, 0x66, 0xce,
+	0xc2, 0x21, 0x75, 0x93, 0x60, 0xbc, 0xed, 0x84, 0xf9, 0xe8, 0xa7, 0xe2, 0xe2, 0xb8, 0xf6, 0x35,
+	0x07, 0x30, 0xd7, 0x3a, 0x1b, 0x60, 0x29, 0x75, 0x2f, 0xf4, 0xa6, 0xea, 0x36, 0x56, 0x5c, 0x50,
+	0x4b, 0x1d, 0xb1, 0x22, 0x0e, 0x23, 0x11, 0xe0, 0x75, 0xcd, 0x65, 0x5e, 0x57, 0x1d, 0x84, 0x17,
+	0x76, 0x4e, 0xc5, 0xfc, 0xf9, 0x34, 0xf5, 0x48, 0xac, 0x88, 0xb6, 0xb8, 0xa7, 0x05, 0x4c, 0x3c,
+	0x47, 0xc8, 0x03, 0x5f, 0xe1, 0x0b, 0x88, 0x5f, 0x9f, 0xe3, 0xbb, 0x7a, 0x1b, 0x53, 0x38, 0x2a,
+	0x26, 0xbd, 0xe6, 0x1c, 0x80, 0x1d, 0x79, 0x9c, 0x93, 0x58, 0x1b, 0x2c, 0x22, 0xe1, 0xfe, 0x9c,
+	0xf0, 0x5e, 0xed, 0x22, 0xc0, 0x8a, 0xe6, 0x93, 0xfa, 0x37, 0x03, 0x8a, 0xe7, 0xf2, 0x4c, 0x9d,
+	0xd7, 0x60, 0xc6, 0xfa, 0x1c, 0xf5, 0xe5, 0xd9, 0x5c, 0x7a, 0xe0, 0xee, 0x4d, 0x88, 0x28, 0x97,
+	0x25, 0xca, 0xde, 0xeb, 0xcb, 0x06, 0x12, 0xef, 0xa8, 0x22, 0x96, 0x2c, 0xbb, 0xc7, 0xd3, 0xbd,
+	0xe6, 0x42, 0xac, 0x67, 0x04, 0xcb, 0x85, 0x45, 0x28, 0xa9, 0x72, 0xc9, 0x71, 0xfd, 0x87, 0x01,
+	0xa5, 0x2e, 0x46, 0x3a, 0x5d, 0xb0, 0x93, 0x94, 0x3d, 0x01, 0xd2, 0xad, 0xf1, 0x22, 0xfb, 0x2e,
+	0xa9, 0xaf, 0x63, 0x62, 0xf8, 0x9d, 0x17, 0x1d, 0x87, 0x3c, 0xbe, 0x76, 0xad, 0x78, 0xbe, 0x52,
+	0xf3, 0x60, 0xed, 0x6f, 0x81, 0xec, 0xce, 0xcf, 0xe4, 0x5a, 0xf7, 0x82, 0x1c, 0x3a, 0xaf, 0xa0,
+	0x88, 0xaf, 0x5c, 0xfd, 0xc6, 0xfb, 0x8f, 0xd3, 0x51, 0xfa, 0xc3, 0xdc, 0x81, 0xd1, 0x86, 0x8f,
+	0x66, 0xb2, 0xdf, 0x2f, 0xe1, 0xd7, 0x73, 0xef, 0x0f, 0x23, 0x12, 0x34, 0xcb, 0xd4, 0x07, 0x00,
+	0x00,
 }
 
 func (this *BooleanColumn) Equal(that interface{}) bool {
@@ -962,6 +1036,36 @@ func (this *StringColumn) Equal(that interface{}) bool {
 	}
 	return true
 }
+func (this *EncodedColumn) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*EncodedColumn)
+	if !ok {
+		that2, ok := that.(EncodedColumn)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if this.DataType != that1.DataType {
+		return false
+	}
+	if !bytes.Equal(this.Values, that1.Values) {
+		return false
+	}
+	if !bytes.Equal(this.Offsets, that1.Offsets) {
+		return false
+	}
+	return true
+}
 func (this *Column) Equal(that interface{}) bool {
 	if that == nil {
 		return this == nil
@@ -1136,6 +1240,30 @@ func (this *Column_StringData) Equal(that interface{}) bool {
 	}
 	return true
 }
+func (this *Column_EncodedData) Equal(that interface{}) bool {
+	if that == nil {
+		return this == nil
+	}
+
+	that1, ok := that.(*Column_EncodedData)
+	if !ok {
+		that2, ok := that.(Column_EncodedData)
+		if ok {
+			that1 = &that2
+		} else {
+			return false
+		}
+	}
+	if that1 == nil {
+		return this == nil
+	} else if this == nil {
+		return false
+	}
+	if !this.EncodedData.Equal(that1.EncodedData) {
+		return false
+	}
+	return true
+}
 func (this *RowBatchData) Equal(that interface{}) bool {
 	if that == nil {
 		return this == nil
@@ -1368,6 +1496,18 @@ func (this *StringColumn) GoString() string {
 	s = append(s, "}")
 	return strings.Join(s, "")
 }
+func (this *EncodedColumn) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := make([]string, 0, 7)
+	s = append(s, "&schemapb.EncodedColumn{")
+	s = append(s, "DataType: "+fmt.Sprintf("%#v", this.DataType)+",\n")
+	s = append(s, "Values: "+fmt.Sprintf("%#v", this.Values)+",\n")
+	s = append(s, "Offsets: "+fmt.Sprintf("%#v", this.Offsets)+",\n")
+	s = append(s, "}")
+	return strings.Join(s, "")
+}
 func (this *Column) GoString() string {
 	if this == nil {
 		return "nil"
@@ -1428,6 +1568,14 @@ func (this *Column_StringData) GoString() string {
 		`StringData:` + fmt.Sprintf("%#v", this.StringData) + `}`}, ", ")
 	return s
 }
+func (this *Column_EncodedData) GoString() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&schemapb.Column_EncodedData{` +
+		`EncodedData:` + fmt.Sprintf("%#v", this.EncodedData) + `}`}, ", ")
+	return s
+}
 func (this *RowBatchData) GoString() string {
 	if this == nil {
 		return "nil"
@@ -1743,6 +1891,48 @@ func (m *StringColumn) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	return len(dAtA) - i, nil
 }
 
+func (m *EncodedColumn) Marshal() (dAtA []byte, err error) {
+	size := m.Size()
+	dAtA = make([]byte, size)
+	n, err := m.MarshalToSizedBuffer(dAtA[:size])
+	if err != nil {
+		return nil, err
+	}
+	return dAtA[:n], nil
+}
+
+func (m *EncodedColumn) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *EncodedColumn) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	_ = i
+	var l int
+	_ = l
+	if len(m.Offsets) > 0 {
+		i -= len(m.Offsets)
+		copy(dAtA[i:], m.Offsets)
+		i = encodeVarintSchema(dAtA, i, uint64(len(m.Offsets)))
+		i--
+		dAtA[i] = 0x1a
+	}
+	if len(m.Values) > 0 {
+		i -= len(m.Values)
+		copy(dAtA[i:], m.Values)
+		i = encodeVarintSchema(dAtA, i, uint64(len(m.Values)))
+		i--
+		dAtA[i] = 0x12
+	}
+	if m.DataType != 0 {
+		i = encodeVarintSchema(dAtA, i, uint64(m.DataType))
+		i--
+		dAtA[i] = 0x8
+	}
+	return len(dAtA) - i, nil
+}
+
 func (m *Column) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
@@ -1901,6 +2091,27 @@ func (m *Column_StringData) MarshalToSizedBuffer(dAtA []byte) (int, error) {
 	}
 	return len(dAtA) - i, nil
 }
+func (m *Column_EncodedData) MarshalTo(dAtA []byte) (int, error) {
+	size := m.Size()
+	return m.MarshalToSizedBuffer(dAtA[:size])
+}
+
+func (m *Column_EncodedData) MarshalToSizedBuffer(dAtA []byte) (int, error) {
+	i := len(dAtA)
+	if m.EncodedData != nil {
+		{
+			size, err := m.EncodedData.MarshalToSizedBuffer(dAtA[:i])
+			if err != nil {
+				return 0, err
+			}
+			i -= size
+			i = encodeVarintSchema(dAtA, i, uint64(size))
+		}
+		i--
+		dAtA[i] = 0x3a
+	}
+	return len(dAtA) - i, nil
+}
 func (m *RowBatchData) Marshal() (dAtA []byte, err error) {
 	size := m.Size()
 	dAtA = make([]byte, size)
@@ -2261,6 +2472,26 @@ func (m *StringColumn) Size() (n int) {
 	return n
 }
 
+func (m *EncodedColumn) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	if m.DataType != 0 {
+		n += 1 + sovSchema(uint64(m.DataType))
+	}
+	l = len(m.Values)
+	if l > 0 {
+		n += 1 + l + sovSchema(uint64(l))
+	}
+	l = len(m.Offsets)
+	if l > 0 {
+		n += 1 + l + sovSchema(uint64(l))
+	}
+	return n
+}
+
 func (m *Column) Size() (n int) {
 	if m == nil {
 		return 0
@@ -2345,6 +2576,18 @@ func (m *Column_StringData) Size() (n int) {
 	}
 	return n
 }
+func (m *Column_EncodedData) Size() (n int) {
+	if m == nil {
+		return 0
+	}
+	var l int
+	_ = l
+	if m.EncodedData != nil {
+		l = m.EncodedData.Size()
+		n += 1 + l + sovSchema(uint64(l))
+	}
+	return n
+}
 func (m *RowBatchData) Size() (n int) {
 	if m == nil {
 		return 0
@@ -2530,6 +2773,18 @@ func (this *StringColumn) String() string {
 	}, "")
 	return s
 }
+func (this *EncodedColumn) String() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&EncodedColumn{`,
+		`DataType:` + fmt.Sprintf("%v", this.DataType) + `,`,
+		`Values:` + fmt.Sprintf("%v", this.Values) + `,`,
+		`Offsets:` + fmt.Sprintf("%v", this.Offsets) + `,`,
+		`}`,
+	}, "")
+	return s
+}
 func (this *Column) String() string {
 	if this == nil {
 		return "nil"
@@ -2600,6 +2855,16 @@ func (this *Column_StringData) String() string {
 	}, "")
 	return s
 }
+func (this *Column_EncodedData) String() string {
+	if this == nil {
+		return "nil"
+	}
+	s := strings.Join([]string{`&Column_EncodedData{`,
+		`EncodedData:` + strings.Replace(fmt.Sprintf("%v", this.EncodedData), "EncodedColumn", "EncodedColumn", 1) + `,`,
+		`}`,
+	}, "")
+	return s
+}
 func (this *RowBatchData) String() string {
 	if this == nil {
 		return "nil"
@@ -3338,6 +3603,143 @@ func (m *StringColumn) Unmarshal(dAtA []byte) error {
 	}
 	return nil
 }
+func (m *EncodedColumn) Unmarshal(dAtA []byte) error {
+	l := len(dAtA)
+	iNdEx := 0
+	for iNdEx < l {
+		preIndex := iNdEx
+		var wire uint64
+		for shift := uint(0); ; shift += 7 {
+			if shift >= 64 {
+				return ErrIntOverflowSchema
+			}
+			if iNdEx >= l {
+				return io.ErrUnexpectedEOF
+			}
+			b := dAtA[iNdEx]
+			iNdEx++
+			wire |= uint64(b&0x7F) << shift
+			if b < 0x80 {
+				break
+			}
+		}
+		fieldNum := int32(wire >> 3)
+		wireType := int(wire & 0x7)
+		if wireType == 4 {
+			return fmt.Errorf("proto: EncodedColumn: wiretype end group for non-group")
+		}
+		if fieldNum <= 0 {
+			return fmt.Errorf("proto: EncodedColumn: illegal tag %d (wire type %d)", fieldNum, wire)
+		}
+		switch fieldNum {
+		case 1:
+			if wireType != 0 {
+				return fmt.Errorf("proto: wrong wireType = %d for field DataType", wireType)
+			}
+			m.DataType = 0
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowSchema
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				m.DataType |= typespb.DataType(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+		case 2:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Values", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowSchema
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthSchema
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex < 0 {
+				return ErrInvalidLengthSchema
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Values = append(m.Values[:0], dAtA[iNdEx:postIndex]...)
+			if m.Values == nil {
+				m.Values = []byte{}
+			}
+			iNdEx = postIndex
+		case 3:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field Offsets", wireType)
+			}
+			var byteLen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowSchema
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				byteLen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if byteLen < 0 {
+				return ErrInvalidLengthSchema
+			}
+			postIndex := iNdEx + byteLen
+			if postIndex < 0 {
+				return ErrInvalidLengthSchema
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			m.Offsets = append(m.Offsets[:0], dAtA[iNdEx:postIndex]...)
+			if m.Offsets == nil {
+				m.Offsets = []byte{}
+			}
+			iNdEx = postIndex
+		default:
+			iNdEx = preIndex
+			skippy, err := skipSchema(dAtA[iNdEx:])
+			if err != nil {
+				return err
+			}
+			if (skippy < 0) || (iNdEx+skippy) < 0 {
+				return ErrInvalidLengthSchema
+			}
+			if (iNdEx + skippy) > l {
+				return io.ErrUnexpectedEOF
+			}
+			iNdEx += skippy
+		}
+	}
+
+	if iNdEx > l {
+		return io.ErrUnexpectedEOF
+	}
+	return nil
+}
 func (m *Column) Unmarshal(dAtA []byte) error {
 	l := len(dAtA)
 	iNdEx := 0
@@ -3577,6 +3979,41 @@ func (m *Column) Unmarshal(dAtA []byte) error {
 			}
 			m.ColData = &Column_StringData{v}
 			iNdEx = postIndex
+		case 7:
+			if wireType != 2 {
+				return fmt.Errorf("proto: wrong wireType = %d for field EncodedData", wireType)
+			}
+			var msglen int
+			for shift := uint(0); ; shift += 7 {
+				if shift >= 64 {
+					return ErrIntOverflowSchema
+				}
+				if iNdEx >= l {
+					return io.ErrUnexpectedEOF
+				}
+				b := dAtA[iNdEx]
+				iNdEx++
+				msglen |= int(b&0x7F) << shift
+				if b < 0x80 {
+					break
+				}
+			}
+			if msglen < 0 {
+				return ErrInvalidLengthSchema
+			}
+			postIndex := iNdEx + msglen
+			if postIndex < 0 {
+				return ErrInvalidLengthSchema
+			}
+			if postIndex > l {
+				return io.ErrUnexpectedEOF
+			}
+			v := &EncodedColumn{}
+			if err := v.Unmarshal(dAtA[iNdEx:postIndex]); err != nil {
+				return err
+			}
+			m.ColData = &Column_EncodedData{v}
+			iNdEx = postIndex
 		default:
 			iNdEx = preIndex
 			skippy, err := skipSchema(dAtA[iNdEx:])
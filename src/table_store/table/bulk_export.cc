@@ -0,0 +1,93 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/table_store/table/bulk_export.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/shared/types/arrow_adapter.h"
+
+namespace px {
+namespace table_store {
+
+StatusOr<std::unique_ptr<BulkExporter>> BulkExporter::Create(const Table* table,
+                                                             const BulkExportSpec& spec) {
+  DCHECK(table != nullptr);
+  const schema::Relation relation = table->GetRelation();
+
+  std::vector<std::string> col_names = spec.columns;
+  if (col_names.empty()) {
+    col_names = relation.col_names();
+  }
+
+  std::vector<int64_t> col_indices;
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  col_indices.reserve(col_names.size());
+  fields.reserve(col_names.size());
+  for (const auto& name : col_names) {
+    if (!relation.HasColumn(name)) {
+      return error::NotFound("Column '$0' does not exist in table.", name);
+    }
+    int64_t idx = relation.GetColumnIndex(name);
+    col_indices.push_back(idx);
+    // Take the arrow type from the corresponding builder, so the schema always matches the
+    // arrays the table actually stores.
+    auto arrow_type =
+        types::MakeArrowBuilder(relation.GetColumnType(idx), arrow::default_memory_pool())->type();
+    fields.push_back(arrow::field(name, std::move(arrow_type)));
+  }
+  auto schema = arrow::schema(std::move(fields));
+
+  Table::Cursor::StartSpec start;
+  if (spec.start_time >= 0) {
+    start.type = Table::Cursor::StartSpec::StartAtTime;
+    start.start_time = spec.start_time;
+  }
+  Table::Cursor::StopSpec stop;
+  if (spec.stop_time >= 0) {
+    stop.type = Table::Cursor::StopSpec::StopAtTime;
+    stop.stop_time = spec.stop_time;
+  }
+
+  // Create via naked pointer, because std::make_unique() cannot access the private ctor.
+  return std::unique_ptr<BulkExporter>(new BulkExporter(std::move(col_indices), std::move(schema),
+                                                        Table::Cursor(table, start, stop)));
+}
+
+StatusOr<std::shared_ptr<arrow::RecordBatch>> BulkExporter::GetNextBatch() {
+  while (cursor_.NextBatchReady()) {
+    PL_ASSIGN_OR_RETURN(auto rb, cursor_.GetNextRowBatch(col_indices_));
+    if (rb->num_rows() == 0) {
+      // The cursor pruned the batch (e.g. it fell outside the time bounds); nothing to emit.
+      continue;
+    }
+    std::vector<std::shared_ptr<arrow::Array>> columns;
+    columns.reserve(col_indices_.size());
+    for (size_t i = 0; i < col_indices_.size(); ++i) {
+      columns.push_back(rb->ColumnAt(i));
+    }
+    return arrow::RecordBatch::Make(schema_, rb->num_rows(), std::move(columns));
+  }
+  return error::ResourceUnavailable("No export batch is ready; check NextBatchReady().");
+}
+
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <arrow/array.h>
+#include <memory>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/schema/relation.h"
+#include "src/table_store/table/bulk_export.h"
+#include "src/table_store/table/table.h"
+
+namespace px {
+namespace table_store {
+
+namespace {
+
+std::shared_ptr<Table> TestTable() {
+  schema::Relation rel({types::DataType::TIME64NS, types::DataType::INT64}, {"time_", "col2"});
+  auto table = Table::Create("test_table", rel);
+
+  auto rb1 = schema::RowBatch(schema::RowDescriptor(rel.col_types()), 3);
+  std::vector<types::Time64NSValue> time_in1 = {1, 2, 3};
+  std::vector<types::Int64Value> col2_in1 = {10, 20, 30};
+  PL_CHECK_OK(rb1.AddColumn(types::ToArrow(time_in1, arrow::default_memory_pool())));
+  PL_CHECK_OK(rb1.AddColumn(types::ToArrow(col2_in1, arrow::default_memory_pool())));
+  PL_CHECK_OK(table->WriteRowBatch(rb1));
+
+  auto rb2 = schema::RowBatch(schema::RowDescriptor(rel.col_types()), 2);
+  std::vector<types::Time64NSValue> time_in2 = {5, 6};
+  std::vector<types::Int64Value> col2_in2 = {50, 60};
+  PL_CHECK_OK(rb2.AddColumn(types::ToArrow(time_in2, arrow::default_memory_pool())));
+  PL_CHECK_OK(rb2.AddColumn(types::ToArrow(col2_in2, arrow::default_memory_pool())));
+  PL_CHECK_OK(table->WriteRowBatch(rb2));
+
+  return table;
+}
+
+}  // namespace
+
+TEST(BulkExportTest, streams_all_columns_without_projection) {
+  auto table = TestTable();
+  auto exporter = BulkExporter::Create(table.get(), BulkExportSpec{}).ConsumeValueOrDie();
+
+  ASSERT_EQ(2, exporter->schema()->num_fields());
+  EXPECT_EQ("time_", exporter->schema()->field(0)->name());
+  EXPECT_EQ("col2", exporter->schema()->field(1)->name());
+
+  ASSERT_TRUE(exporter->NextBatchReady());
+  auto batch1 = exporter->GetNextBatch().ConsumeValueOrDie();
+  EXPECT_EQ(3, batch1->num_rows());
+  std::vector<types::Int64Value> col2_in1 = {10, 20, 30};
+  EXPECT_TRUE(batch1->column(1)->Equals(types::ToArrow(col2_in1, arrow::default_memory_pool())));
+
+  ASSERT_TRUE(exporter->NextBatchReady());
+  auto batch2 = exporter->GetNextBatch().ConsumeValueOrDie();
+  EXPECT_EQ(2, batch2->num_rows());
+  std::vector<types::Int64Value> col2_in2 = {50, 60};
+  EXPECT_TRUE(batch2->column(1)->Equals(types::ToArrow(col2_in2, arrow::default_memory_pool())));
+
+  EXPECT_TRUE(exporter->Done());
+  EXPECT_NOT_OK(exporter->GetNextBatch());
+}
+
+TEST(BulkExportTest, honors_column_projection) {
+  auto table = TestTable();
+  BulkExportSpec spec;
+  spec.columns = {"col2"};
+  auto exporter = BulkExporter::Create(table.get(), spec).ConsumeValueOrDie();
+
+  ASSERT_EQ(1, exporter->schema()->num_fields());
+  EXPECT_EQ("col2", exporter->schema()->field(0)->name());
+  EXPECT_EQ(arrow::Type::INT64, exporter->schema()->field(0)->type()->id());
+
+  auto batch = exporter->GetNextBatch().ConsumeValueOrDie();
+  ASSERT_EQ(1, batch->num_columns());
+  std::vector<types::Int64Value> col2_in1 = {10, 20, 30};
+  EXPECT_TRUE(batch->column(0)->Equals(types::ToArrow(col2_in1, arrow::default_memory_pool())));
+}
+
+TEST(BulkExportTest, honors_time_bounds) {
+  auto table = TestTable();
+  BulkExportSpec spec;
+  spec.start_time = 5;
+  auto exporter = BulkExporter::Create(table.get(), spec).ConsumeValueOrDie();
+
+  auto batch = exporter->GetNextBatch().ConsumeValueOrDie();
+  EXPECT_EQ(2, batch->num_rows());
+  std::vector<types::Int64Value> col2_in2 = {50, 60};
+  EXPECT_TRUE(batch->column(1)->Equals(types::ToArrow(col2_in2, arrow::default_memory_pool())));
+  EXPECT_TRUE(exporter->Done());
+}
+
+TEST(BulkExportTest, rejects_unknown_column) {
+  auto table = TestTable();
+  BulkExportSpec spec;
+  spec.columns = {"no_such_col"};
+  auto exporter_or_s = BulkExporter::Create(table.get(), spec);
+  ASSERT_NOT_OK(exporter_or_s);
+  EXPECT_EQ(statuspb::NOT_FOUND, exporter_or_s.status().code());
+}
+
+}  // namespace table_store
+}  // namespace px
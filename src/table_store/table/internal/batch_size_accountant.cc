@@ -212,6 +212,13 @@ uint64_t BatchSizeAccountant::FinishCompactedBatch() {
   return rows_to_remove;
 }
 
+void BatchSizeAccountant::ReduceLastColdBatchBytes(uint64_t bytes_saved) {
+  DCHECK(!cold_batch_bytes_.empty());
+  DCHECK_LE(bytes_saved, cold_batch_bytes_.back());
+  cold_batch_bytes_.back() -= bytes_saved;
+  cold_bytes_ -= bytes_saved;
+}
+
 uint64_t BatchSizeAccountant::HotBytes() const { return hot_bytes_; }
 
 uint64_t BatchSizeAccountant::ColdBytes() const { return cold_bytes_; }
@@ -134,6 +134,13 @@ class BatchSizeAccountant {
    * into the cold store via CompactedBatchSpec.
    */
   uint64_t FinishCompactedBatch();
+  /**
+   * ReduceLastColdBatchBytes shrinks the recorded size of the most recent cold batch, e.g. after
+   * its columns have been compressed in place. Cold bytes accounting (and hence expiration) then
+   * reflects the batch's actual resident size.
+   * @param bytes_saved the number of bytes the most recent cold batch shrank by.
+   */
+  void ReduceLastColdBatchBytes(uint64_t bytes_saved);
   /**
    * @return the number of bytes stored in the hot store.
    */
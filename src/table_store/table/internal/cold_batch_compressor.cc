@@ -0,0 +1,89 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <arrow/buffer.h>
+
+#include "src/common/zlib/zlib_wrapper.h"
+#include "src/table_store/table/internal/cold_batch_compressor.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+StatusOr<CompressedColumn> CompressColdColumn(const ArrowArrayPtr& arr) {
+  DCHECK_EQ(arr->offset(), 0);
+  if (arr->type_id() == arrow::Type::DICTIONARY) {
+    return error::InvalidArgument("Dictionary-encoded columns cannot be compressed.");
+  }
+
+  CompressedColumn col;
+  col.type = arr->type();
+  col.length = arr->length();
+  col.uncompressed_bytes = 0;
+
+  std::string concatenated;
+  for (const auto& buffer : arr->data()->buffers) {
+    if (buffer == nullptr) {
+      col.buffer_sizes.push_back(-1);
+      continue;
+    }
+    col.buffer_sizes.push_back(buffer->size());
+    col.uncompressed_bytes += buffer->size();
+    concatenated.append(reinterpret_cast<const char*>(buffer->data()), buffer->size());
+  }
+
+  PL_ASSIGN_OR_RETURN(col.data, zlib::Deflate(concatenated));
+  return col;
+}
+
+StatusOr<ArrowArrayPtr> DecompressColdColumn(const CompressedColumn& col,
+                                             arrow::MemoryPool* mem_pool) {
+  PL_ASSIGN_OR_RETURN(auto decompressed, zlib::Inflate(col.data));
+  if (static_cast<int64_t>(decompressed.size()) != col.uncompressed_bytes) {
+    return error::Internal("Decompressed column size ($0) doesn't match expected size ($1).",
+                           decompressed.size(), col.uncompressed_bytes);
+  }
+
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+  buffers.reserve(col.buffer_sizes.size());
+  int64_t offset = 0;
+  for (int64_t size : col.buffer_sizes) {
+    if (size == -1) {
+      buffers.push_back(nullptr);
+      continue;
+    }
+    std::shared_ptr<arrow::Buffer> buffer;
+    PL_RETURN_IF_ERROR(arrow::AllocateBuffer(mem_pool, size, &buffer));
+    memcpy(buffer->mutable_data(), decompressed.data() + offset, size);
+    offset += size;
+    buffers.push_back(std::move(buffer));
+  }
+
+  auto data = arrow::ArrayData::Make(col.type, col.length, std::move(buffers), /* null_count */ 0);
+  return arrow::MakeArray(data);
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
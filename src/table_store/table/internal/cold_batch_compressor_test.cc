@@ -0,0 +1,83 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/table/internal/cold_batch_compressor.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+TEST(ColdBatchCompressorTest, Int64RoundTrip) {
+  std::vector<types::Int64Value> values;
+  for (int i = 0; i < 4096; ++i) {
+    values.emplace_back(i % 7);
+  }
+  auto arr = types::ToArrow(values, arrow::default_memory_pool());
+
+  ASSERT_OK_AND_ASSIGN(auto compressed, CompressColdColumn(arr));
+  EXPECT_EQ(arr->length(), compressed.length);
+  EXPECT_LT(static_cast<int64_t>(compressed.data.size()), compressed.uncompressed_bytes);
+
+  ASSERT_OK_AND_ASSIGN(auto decompressed,
+                       DecompressColdColumn(compressed, arrow::default_memory_pool()));
+  EXPECT_TRUE(arr->Equals(decompressed));
+}
+
+TEST(ColdBatchCompressorTest, StringRoundTrip) {
+  std::vector<types::StringValue> values;
+  for (int i = 0; i < 1024; ++i) {
+    values.emplace_back("req_path=/api/v1/endpoint/" + std::to_string(i % 5));
+  }
+  auto arr = types::ToArrow(values, arrow::default_memory_pool());
+
+  ASSERT_OK_AND_ASSIGN(auto compressed, CompressColdColumn(arr));
+  ASSERT_OK_AND_ASSIGN(auto decompressed,
+                       DecompressColdColumn(compressed, arrow::default_memory_pool()));
+  EXPECT_TRUE(arr->Equals(decompressed));
+}
+
+TEST(ColdBatchCompressorTest, PreservesAbsentBuffers) {
+  std::vector<types::Float64Value> values(256, 1.5);
+  auto arr = types::ToArrow(values, arrow::default_memory_pool());
+  // Null-free arrays built through ToArrow have no validity bitmap; the round trip must not
+  // materialize one.
+  ASSERT_EQ(nullptr, arr->data()->buffers[0]);
+
+  ASSERT_OK_AND_ASSIGN(auto compressed, CompressColdColumn(arr));
+  ASSERT_OK_AND_ASSIGN(auto decompressed,
+                       DecompressColdColumn(compressed, arrow::default_memory_pool()));
+  EXPECT_EQ(nullptr, decompressed->data()->buffers[0]);
+  EXPECT_TRUE(arr->Equals(decompressed));
+}
+
+TEST(ColdBatchCompressorTest, SizeMismatchFails) {
+  std::vector<types::Int64Value> values(128, 42);
+  auto arr = types::ToArrow(values, arrow::default_memory_pool());
+  ASSERT_OK_AND_ASSIGN(auto compressed, CompressColdColumn(arr));
+  compressed.uncompressed_bytes += 1;
+  EXPECT_NOT_OK(DecompressColdColumn(compressed, arrow::default_memory_pool()));
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,183 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/strings/substitute.h>
+
+#include "src/common/fs/fs_wrapper.h"
+#include "src/table_store/table/internal/cold_batch_spiller.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+namespace {
+
+// Buffers are laid out in the spill file at multiples of arrow's preferred 64-byte alignment.
+constexpr int64_t kBufferAlignment = 64;
+
+inline int64_t AlignUp(int64_t val) {
+  return (val + kBufferAlignment - 1) & ~(kBufferAlignment - 1);
+}
+
+// An arrow Buffer that owns an mmap'd region and unmaps it when the last reference is dropped.
+// Individual array buffers are created as slices of a single MmapBuffer covering the whole file.
+class MmapBuffer : public arrow::Buffer {
+ public:
+  MmapBuffer(const uint8_t* data, int64_t size) : arrow::Buffer(data, size) {}
+  ~MmapBuffer() override {
+    munmap(const_cast<uint8_t*>(data_), static_cast<size_t>(size_));
+  }
+};
+
+}  // namespace
+
+StatusOr<std::unique_ptr<ColdBatchSpiller>> ColdBatchSpiller::Create(const std::string& spill_dir,
+                                                                     const std::string& table_name) {
+  PL_RETURN_IF_ERROR(fs::CreateDirectories(spill_dir));
+  return std::unique_ptr<ColdBatchSpiller>(new ColdBatchSpiller(spill_dir, table_name));
+}
+
+std::string ColdBatchSpiller::NextSpillFilePath() {
+  // Files are unlinked as soon as they are mapped, so the names only need to be unique within the
+  // process's lifetime.
+  return absl::Substitute("$0/$1-$2-$3.spill", spill_dir_, table_name_, getpid(), next_file_id_++);
+}
+
+StatusOr<ColdBatch> ColdBatchSpiller::Spill(const ColdBatch& batch) {
+  // A dictionary-encoded column is spilled as its two underlying flat arrays (indices and
+  // dictionary); all other columns map to a single flat array.
+  std::vector<std::vector<std::shared_ptr<arrow::ArrayData>>> col_parts(batch.size());
+  for (const auto& [col_idx, arr] : Enumerate(batch)) {
+    // Compaction always produces fresh arrays, so the buffer layout maps 1:1 to the array.
+    DCHECK_EQ(arr->offset(), 0);
+    if (arr->type_id() == arrow::Type::DICTIONARY) {
+      const auto& dict_arr = static_cast<const arrow::DictionaryArray&>(*arr);
+      col_parts[col_idx] = {dict_arr.indices()->data(), dict_arr.dictionary()->data()};
+    } else {
+      col_parts[col_idx] = {arr->data()};
+    }
+  }
+
+  // Compute the file offset for each of the batch's buffers. A null buffer (e.g. the validity
+  // bitmap of a null-free array) is recorded with offset -1 and reconstructed as nullptr.
+  struct BufferSlot {
+    std::shared_ptr<arrow::Buffer> src;
+    int64_t offset = -1;
+    int64_t size = 0;
+  };
+  std::vector<std::vector<BufferSlot>> part_buffers;
+  int64_t file_size = 0;
+  for (const auto& parts : col_parts) {
+    for (const auto& part : parts) {
+      auto& buffers = part_buffers.emplace_back();
+      for (const auto& buffer : part->buffers) {
+        BufferSlot slot;
+        if (buffer != nullptr) {
+          slot.src = buffer;
+          slot.offset = AlignUp(file_size);
+          slot.size = buffer->size();
+          file_size = slot.offset + slot.size;
+        }
+        buffers.push_back(std::move(slot));
+      }
+    }
+  }
+  if (file_size == 0) {
+    return error::InvalidArgument("Cannot spill a batch with no buffers.");
+  }
+
+  auto path = NextSpillFilePath();
+  int fd = open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) {
+    return error::Internal("Failed to create spill file $0: $1", path, strerror(errno));
+  }
+  // Unlink up front: the fd and the subsequent mapping keep the inode alive, and the disk space is
+  // reclaimed automatically when the batch is expired or the process dies.
+  unlink(path.c_str());
+
+  if (ftruncate(fd, file_size) != 0) {
+    close(fd);
+    return error::Internal("Failed to size spill file $0: $1", path, strerror(errno));
+  }
+  for (const auto& buffers : part_buffers) {
+    for (const auto& slot : buffers) {
+      if (slot.src == nullptr || slot.size == 0) {
+        continue;
+      }
+      if (pwrite(fd, slot.src->data(), slot.size, slot.offset) != slot.size) {
+        close(fd);
+        return error::Internal("Failed to write spill file $0: $1", path, strerror(errno));
+      }
+    }
+  }
+
+  void* base = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    return error::Internal("Failed to mmap spill file $0: $1", path, strerror(errno));
+  }
+  auto file_buffer =
+      std::make_shared<MmapBuffer>(reinterpret_cast<const uint8_t*>(base), file_size);
+
+  // Rebuild each flat array part over the mapping, then reassemble the columns.
+  size_t part_idx = 0;
+  auto rebuild_part = [&](const std::shared_ptr<arrow::ArrayData>& part) {
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+    buffers.reserve(part_buffers[part_idx].size());
+    for (const auto& slot : part_buffers[part_idx]) {
+      if (slot.src == nullptr) {
+        buffers.push_back(nullptr);
+        continue;
+      }
+      buffers.push_back(arrow::SliceBuffer(file_buffer, slot.offset, slot.size));
+    }
+    part_idx++;
+    auto data = arrow::ArrayData::Make(part->type, part->length, std::move(buffers),
+                                       /* null_count */ 0);
+    return arrow::MakeArray(data);
+  };
+
+  ColdBatch out_batch;
+  out_batch.reserve(batch.size());
+  for (const auto& [col_idx, arr] : Enumerate(batch)) {
+    if (arr->type_id() == arrow::Type::DICTIONARY) {
+      auto indices = rebuild_part(col_parts[col_idx][0]);
+      auto dict = rebuild_part(col_parts[col_idx][1]);
+      out_batch.push_back(
+          std::make_shared<arrow::DictionaryArray>(arr->type(), indices, dict));
+    } else {
+      out_batch.push_back(rebuild_part(col_parts[col_idx][0]));
+    }
+  }
+  return out_batch;
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "src/common/base/base.h"
+#include "src/table_store/table/internal/types.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+/**
+ * ColdBatchSpiller moves cold batches from the heap to memory-mapped files on disk.
+ *
+ * Spill() writes all of a batch's arrow buffers to a file, maps the file read-only, unlinks it,
+ * and returns the same columns backed by the mapping. Reads through the returned arrays are
+ * zero-copy against the page cache, so spilled batches no longer contribute to the heap footprint
+ * and their pages can be evicted under memory pressure. Because the file is unlinked immediately
+ * after mapping, its disk space is reclaimed automatically once the batch is expired from the cold
+ * store (i.e. when the last array reference is dropped); no separate cleanup pass is needed, and a
+ * crashed process leaks no files.
+ *
+ * Note: the vendored arrow build does not include the IPC or io modules, so this uses a private
+ * in-process layout (a straight concatenation of the arrays' buffers, 64-byte aligned) rather than
+ * the Arrow IPC file format. The files are never re-opened across processes, so the layout never
+ * needs to be stable.
+ */
+class ColdBatchSpiller {
+ public:
+  /**
+   * Create a ColdBatchSpiller that writes its spill files under the given directory. The directory
+   * is created if it doesn't exist.
+   */
+  static StatusOr<std::unique_ptr<ColdBatchSpiller>> Create(const std::string& spill_dir,
+                                                            const std::string& table_name);
+
+  /**
+   * Spill writes the given batch to a memory-mapped spill file and returns the equivalent columns
+   * backed by the mapping. The input batch is left untouched; on error the caller should keep
+   * using the in-memory batch.
+   */
+  StatusOr<ColdBatch> Spill(const ColdBatch& batch);
+
+ private:
+  ColdBatchSpiller(std::string spill_dir, std::string table_name)
+      : spill_dir_(std::move(spill_dir)), table_name_(std::move(table_name)) {}
+
+  std::string NextSpillFilePath();
+
+  const std::string spill_dir_;
+  const std::string table_name_;
+  int64_t next_file_id_ = 0;
+};
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/common/testing/temp_dir.h"
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/table/internal/cold_batch_spiller.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+TEST(ColdBatchSpillerTest, SpillRoundTrip) {
+  testing::TempDir temp_dir;
+  auto spiller_or = ColdBatchSpiller::Create(temp_dir.path().string(), "test_table");
+  ASSERT_OK(spiller_or);
+  auto spiller = spiller_or.ConsumeValueOrDie();
+
+  std::vector<types::Time64NSValue> times = {1, 2, 3, 4, 5};
+  std::vector<types::StringValue> strings = {"a", "bc", "", "defg", "h"};
+  std::vector<types::BoolValue> bools = {true, false, true, true, false};
+  ColdBatch batch{
+      types::ToArrow(times, arrow::default_memory_pool()),
+      types::ToArrow(strings, arrow::default_memory_pool()),
+      types::ToArrow(bools, arrow::default_memory_pool()),
+  };
+
+  auto spilled_or = spiller->Spill(batch);
+  ASSERT_OK(spilled_or);
+  auto spilled = spilled_or.ConsumeValueOrDie();
+
+  ASSERT_EQ(batch.size(), spilled.size());
+  for (size_t i = 0; i < batch.size(); ++i) {
+    EXPECT_TRUE(batch[i]->Equals(spilled[i])) << "column " << i;
+  }
+
+  // Spill files are unlinked as soon as they are mapped, so the spill dir should be empty even
+  // while the spilled batch is alive.
+  EXPECT_TRUE(std::filesystem::is_empty(temp_dir.path()));
+}
+
+TEST(ColdBatchSpillerTest, SpillManyBatches) {
+  testing::TempDir temp_dir;
+  auto spiller =
+      ColdBatchSpiller::Create(temp_dir.path().string(), "test_table").ConsumeValueOrDie();
+
+  for (int64_t b = 0; b < 10; ++b) {
+    std::vector<types::Int64Value> vals;
+    for (int64_t i = 0; i < 1000; ++i) {
+      vals.emplace_back(b * 1000 + i);
+    }
+    ColdBatch batch{types::ToArrow(vals, arrow::default_memory_pool())};
+    auto spilled_or = spiller->Spill(batch);
+    ASSERT_OK(spilled_or);
+    EXPECT_TRUE(batch[0]->Equals(spilled_or.ConsumeValueOrDie()[0]));
+  }
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
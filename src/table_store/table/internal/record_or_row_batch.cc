@@ -20,6 +20,7 @@
 
 #include "src/common/base/utils.h"
 #include "src/table_store/table/internal/record_or_row_batch.h"
+#include "src/table_store/table/internal/simd_time_search.h"
 
 namespace px {
 namespace table_store {
@@ -44,12 +45,19 @@ int64_t RecordOrRowBatch::FindTimeFirstGreaterThanOrEqual(int64_t time_col_idx,
       overloaded{
           [this, time, time_col_idx](const RecordBatchWithCache& record_batch_w_cache) -> int64_t {
             auto col = (*record_batch_w_cache.record_batch)[time_col_idx];
-            auto iterable = types::ColumnWrapperIterator<types::DataType::TIME64NS>(col.get());
-            auto it = std::lower_bound(iterable.begin() + row_offset_, iterable.end(), time);
-            if (it == iterable.end()) {
+            // Time64NSValue is a single int64, so the column's raw data can be searched directly.
+            static_assert(sizeof(types::Time64NSValue) == sizeof(int64_t));
+            const auto* data =
+                reinterpret_cast<const int64_t*>(
+                    static_cast<const types::Time64NSValueColumnWrapper*>(col.get())
+                        ->UnsafeRawData()) +
+                row_offset_;
+            auto size = col->Size() - row_offset_;
+            auto idx = SimdLowerBound(data, size, time);
+            if (idx == size) {
               return -1;
             }
-            return std::distance(iterable.begin(), it) - row_offset_;
+            return idx;
           },
           [this, time, time_col_idx](const schema::RowBatch& row_batch) {
             auto length = row_batch.num_rows() - row_offset_;
@@ -66,12 +74,18 @@ int64_t RecordOrRowBatch::FindTimeFirstGreaterThan(int64_t time_col_idx, Time ti
       overloaded{
           [this, time, time_col_idx](const RecordBatchWithCache& record_batch_w_cache) -> int64_t {
             auto col = (*record_batch_w_cache.record_batch)[time_col_idx];
-            auto iterable = types::ColumnWrapperIterator<types::DataType::TIME64NS>(col.get());
-            auto it = std::upper_bound(iterable.begin() + row_offset_, iterable.end(), time);
-            if (it == iterable.end()) {
+            static_assert(sizeof(types::Time64NSValue) == sizeof(int64_t));
+            const auto* data =
+                reinterpret_cast<const int64_t*>(
+                    static_cast<const types::Time64NSValueColumnWrapper*>(col.get())
+                        ->UnsafeRawData()) +
+                row_offset_;
+            auto size = col->Size() - row_offset_;
+            auto idx = SimdUpperBound(data, size, time);
+            if (idx == size) {
               return -1;
             }
-            return std::distance(iterable.begin(), it) - row_offset_;
+            return idx;
           },
           [this, time, time_col_idx](const schema::RowBatch& row_batch) -> int64_t {
             auto length = row_batch.num_rows() - row_offset_;
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+// Block size (in rows) below which the binary search switches to a linear SIMD scan. 64 int64
+// values span 8 cache lines, which keeps the tail scan branch-free without blowing the cache.
+static constexpr size_t kSimdSearchBlockRows = 64;
+
+namespace simd_detail {
+
+// Returns the number of values in [data, data + size) that are strictly less than val. `size` must
+// be at most kSimdSearchBlockRows and `data` must be sorted ascending, so the count is also the
+// lower-bound index within the block.
+inline size_t CountLessThanInBlock(const int64_t* data, size_t size, int64_t val) {
+  size_t count = 0;
+  size_t i = 0;
+#if defined(__AVX2__)
+  const __m256i val_vec = _mm256_set1_epi64x(val);
+  for (; i + 4 <= size; i += 4) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    // val > data[i] <=> data[i] < val.
+    __m256i lt = _mm256_cmpgt_epi64(val_vec, block);
+    count += __builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(lt)));
+  }
+#elif defined(__SSE4_2__)
+  const __m128i val_vec = _mm_set1_epi64x(val);
+  for (; i + 2 <= size; i += 2) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    __m128i lt = _mm_cmpgt_epi64(val_vec, block);
+    count += __builtin_popcount(_mm_movemask_pd(_mm_castsi128_pd(lt)));
+  }
+#endif
+  for (; i < size; ++i) {
+    // Branchless accumulate, the compiler lowers this to a setcc/add pair.
+    count += static_cast<size_t>(data[i] < val);
+  }
+  return count;
+}
+
+}  // namespace simd_detail
+
+/**
+ * SimdLowerBound returns the index of the first value in the sorted span [data, data + size) that
+ * is greater than or equal to val, or `size` if no such value exists. Equivalent to
+ * std::lower_bound but narrows with a branch-free binary search and finishes with a SIMD scan over
+ * the final block, which profiles much better than std::lower_bound on the int64 time columns of
+ * large batches.
+ */
+inline size_t SimdLowerBound(const int64_t* data, size_t size, int64_t val) {
+  size_t begin = 0;
+  size_t len = size;
+  while (len > kSimdSearchBlockRows) {
+    size_t half = len / 2;
+    // Conditional move rather than a branch; mispredicts dominate std::lower_bound's cost here.
+    begin = (data[begin + half - 1] < val) ? begin + half : begin;
+    len -= half;
+  }
+  return begin + simd_detail::CountLessThanInBlock(data + begin, len, val);
+}
+
+/**
+ * SimdUpperBound returns the index of the first value in the sorted span [data, data + size) that
+ * is strictly greater than val, or `size` if no such value exists.
+ */
+inline size_t SimdUpperBound(const int64_t* data, size_t size, int64_t val) {
+  if (val == std::numeric_limits<int64_t>::max()) {
+    return size;
+  }
+  // For integers, upper_bound(val) == lower_bound(val + 1).
+  return SimdLowerBound(data, size, val + 1);
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/table_store/table/internal/simd_time_search.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+TEST(SimdTimeSearchTest, LowerBoundBasic) {
+  std::vector<int64_t> data{1, 3, 3, 5, 7, 9};
+  EXPECT_EQ(0, SimdLowerBound(data.data(), data.size(), 0));
+  EXPECT_EQ(0, SimdLowerBound(data.data(), data.size(), 1));
+  EXPECT_EQ(1, SimdLowerBound(data.data(), data.size(), 2));
+  EXPECT_EQ(1, SimdLowerBound(data.data(), data.size(), 3));
+  EXPECT_EQ(3, SimdLowerBound(data.data(), data.size(), 4));
+  EXPECT_EQ(5, SimdLowerBound(data.data(), data.size(), 9));
+  EXPECT_EQ(6, SimdLowerBound(data.data(), data.size(), 10));
+}
+
+TEST(SimdTimeSearchTest, UpperBoundBasic) {
+  std::vector<int64_t> data{1, 3, 3, 5, 7, 9};
+  EXPECT_EQ(0, SimdUpperBound(data.data(), data.size(), 0));
+  EXPECT_EQ(1, SimdUpperBound(data.data(), data.size(), 1));
+  EXPECT_EQ(3, SimdUpperBound(data.data(), data.size(), 3));
+  EXPECT_EQ(6, SimdUpperBound(data.data(), data.size(), 9));
+  EXPECT_EQ(6, SimdUpperBound(data.data(), data.size(), 10));
+}
+
+TEST(SimdTimeSearchTest, EmptySpan) {
+  std::vector<int64_t> data;
+  EXPECT_EQ(0, SimdLowerBound(data.data(), data.size(), 0));
+  EXPECT_EQ(0, SimdUpperBound(data.data(), data.size(), 0));
+}
+
+TEST(SimdTimeSearchTest, Int64MaxUpperBound) {
+  std::vector<int64_t> data{1, 2, std::numeric_limits<int64_t>::max()};
+  EXPECT_EQ(2, SimdLowerBound(data.data(), data.size(), std::numeric_limits<int64_t>::max()));
+  EXPECT_EQ(3, SimdUpperBound(data.data(), data.size(), std::numeric_limits<int64_t>::max()));
+}
+
+TEST(SimdTimeSearchTest, MatchesStdLowerBoundOnRandomData) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int64_t> dist(0, 1000);
+  // Cover sizes below, at, and well above the SIMD block size.
+  for (size_t size : {1ul, 7ul, kSimdSearchBlockRows - 1, kSimdSearchBlockRows,
+                      kSimdSearchBlockRows + 1, 1000ul, 4096ul}) {
+    std::vector<int64_t> data(size);
+    for (auto& v : data) {
+      v = dist(gen);
+    }
+    std::sort(data.begin(), data.end());
+    for (int64_t val = -1; val <= 1001; val += 13) {
+      auto expected_lower =
+          std::distance(data.begin(), std::lower_bound(data.begin(), data.end(), val));
+      auto expected_upper =
+          std::distance(data.begin(), std::upper_bound(data.begin(), data.end(), val));
+      EXPECT_EQ(static_cast<size_t>(expected_lower), SimdLowerBound(data.data(), data.size(), val))
+          << "size=" << size << " val=" << val;
+      EXPECT_EQ(static_cast<size_t>(expected_upper), SimdUpperBound(data.data(), data.size(), val))
+          << "size=" << size << " val=" << val;
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
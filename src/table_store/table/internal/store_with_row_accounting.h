@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <deque>
 #include <memory>
 #include <optional>
@@ -28,7 +29,11 @@
 #include "src/shared/types/arrow_adapter.h"
 #include "src/shared/types/column_wrapper.h"
 #include "src/table_store/schema/relation.h"
+#include "src/table_store/table/internal/cold_batch_compressor.h"
+#include "src/table_store/table/internal/simd_time_search.h"
+#include "src/table_store/table/internal/string_dictionary.h"
 #include "src/table_store/table/internal/types.h"
+#include "src/table_store/table/internal/zone_map.h"
 
 namespace px {
 namespace table_store {
@@ -87,12 +92,16 @@ class StoreWithRowTimeAccounting {
    * @param stop_row_id, an optional unique RowID to stop the batch at. If provided, the batch will
    * be sliced such that no rows are included with `RowID >= stop_row_id.value()`.
    * @param cols, a vector of column indices to include in the outputted row batch.
+   * @param zone_filter, optional value range predicate. For the Cold store, a batch whose zone
+   * map proves it can't contain matching rows is skipped without touching its memory: the cursor
+   * is advanced past it and an empty row batch is returned. The Hot store doesn't maintain zone
+   * maps, so the filter is ignored there. Passing a `nullptr` disables skipping.
    * @return a unique_ptr to the RowBatch or nullptr if there are no more rows in this store that
    * match the parameters above. On error returns a Status.
    */
   StatusOr<std::unique_ptr<schema::RowBatch>> GetNextRowBatch(
       RowID* last_read_row_id, BatchHints* hints, std::optional<RowID> stop_row_id,
-      const std::vector<int64_t>& cols) const {
+      const std::vector<int64_t>& cols, const ZoneMapFilter* zone_filter = nullptr) const {
     auto start_row_id = *last_read_row_id + 1;
     if (batches_.empty() || start_row_id < FirstRowID() || start_row_id > LastRowID()) {
       return std::unique_ptr<schema::RowBatch>(nullptr);
@@ -124,10 +133,24 @@ class StoreWithRowTimeAccounting {
       DCHECK(static_cast<size_t>(col_idx) < rel_.NumColumns());
       col_types.push_back(rel_.col_types()[col_idx]);
     }
+
+    if constexpr (TStoreType == StoreType::Cold) {
+      if (zone_filter != nullptr &&
+          !ZoneMapMayContain(zone_maps_[batch_id - first_batch_id_], *zone_filter)) {
+        // The zone map proves this batch has no matching rows, so advance the cursor past it
+        // without touching the batch's memory and hand back an empty row batch.
+        *last_read_row_id = start_row_id + batch_size - 1;
+        hints->batch_id = batch_id + 1;
+        hints->hint_type = TStoreType;
+        return schema::RowBatch::WithZeroRows(schema::RowDescriptor(col_types), /* eow */ false,
+                                              /* eos */ false);
+      }
+    }
+
     auto output_rb =
         std::make_unique<schema::RowBatch>(schema::RowDescriptor(col_types), batch_size);
     PL_RETURN_IF_ERROR(
-        AddBatchSliceToRowBatch(batch, row_offset, batch_size, cols, output_rb.get()));
+        AddBatchSliceToRowBatch(batch, batch_id, row_offset, batch_size, cols, output_rb.get()));
 
     // Update the ptr to the last read row.
     *last_read_row_id = start_row_id + batch_size - 1;
@@ -154,6 +177,46 @@ class StoreWithRowTimeAccounting {
     return batches_.front();
   }
 
+  /**
+   * back gets a reference to the last batch in the store.
+   * @return reference to the last batch in the store.
+   */
+  TBatch& back() {
+    DCHECK(!batches_.empty());
+    return batches_.back();
+  }
+
+  /**
+   * BackFirstRowID returns the RowID of the first row of the last batch in the store.
+   * @return RowID of the first row of the last batch.
+   */
+  RowID BackFirstRowID() const {
+    DCHECK(!batches_.empty());
+    return row_ids_.back().first;
+  }
+
+  /**
+   * AttachCompressedColumnsToBack replaces columns of the last batch in the store with their
+   * compressed representations. Columns with a compressed entry are dropped from the batch
+   * (freeing their arrow buffers) and rebuilt lazily on read. Only valid for the Cold store.
+   * @param cols per-column compressed representations; columns without a value stay resident.
+   */
+  void AttachCompressedColumnsToBack(std::vector<std::optional<CompressedColumn>>&& cols) {
+    if constexpr (TStoreType == StoreType::Cold) {
+      DCHECK(!batches_.empty());
+      DCHECK_EQ(cols.size(), batches_.back().size());
+      compressed_cols_.back() = std::move(cols);
+      auto& batch = batches_.back();
+      for (const auto& [col_idx, compressed] : Enumerate(compressed_cols_.back())) {
+        if (compressed.has_value()) {
+          batch[col_idx] = nullptr;
+        }
+      }
+    } else {
+      constexpr_else_static_assert_false();
+    }
+  }
+
   /**
    * PopFront removes the first batch in the store, and returns an rvalue reference to it.
    * @return rvalue reference to the removed batch.
@@ -164,6 +227,10 @@ class StoreWithRowTimeAccounting {
 
     row_ids_.pop_front();
     if (time_col_idx_ != -1) times_.pop_front();
+    if constexpr (TStoreType == StoreType::Cold) {
+      zone_maps_.pop_front();
+      compressed_cols_.pop_front();
+    }
 
     auto&& front = std::move(batches_.front());
     batches_.pop_front();
@@ -186,6 +253,10 @@ class StoreWithRowTimeAccounting {
       auto last_time = GetTimeValue(batch, BatchLength(batch) - 1);
       times_.emplace_back(first_time, last_time);
     }
+    if constexpr (TStoreType == StoreType::Cold) {
+      zone_maps_.emplace_back(BuildZoneMap(batch, rel_));
+      compressed_cols_.emplace_back();
+    }
     return batch;
   }
 
@@ -340,8 +411,10 @@ class StoreWithRowTimeAccounting {
 
   size_t FindTimeFirstGreaterThanOrEqual(const TBatch& batch, Time time) const {
     if constexpr (std::is_same_v<TBatch, ColdBatch>) {
-      return types::SearchArrowArrayGreaterThanOrEqual<types::DataType::TIME64NS>(
-          batch[time_col_idx_].get(), time);
+      // Cold time columns are contiguous null-free int64s (TIME64NS or INT64 backed), so search
+      // the raw value buffer directly.
+      const auto& arr = batch[time_col_idx_];
+      return SimdLowerBound(arr->data()->GetValues<int64_t>(1), arr->length(), time);
     } else if constexpr (std::is_same_v<TBatch, HotBatch>) {
       return batch.FindTimeFirstGreaterThanOrEqual(time_col_idx_, time);
     } else {
@@ -351,9 +424,8 @@ class StoreWithRowTimeAccounting {
 
   size_t FindTimeFirstGreaterThan(const TBatch& batch, Time time) const {
     if constexpr (std::is_same_v<TBatch, ColdBatch>) {
-      return types::SearchArrowArrayLessThanOrEqual<types::DataType::TIME64NS>(
-                 batch[time_col_idx_].get(), time) +
-             1;
+      const auto& arr = batch[time_col_idx_];
+      return SimdUpperBound(arr->data()->GetValues<int64_t>(1), arr->length(), time);
     } else if constexpr (std::is_same_v<TBatch, HotBatch>) {
       return batch.FindTimeFirstGreaterThan(time_col_idx_, time);
     } else {
@@ -372,12 +444,22 @@ class StoreWithRowTimeAccounting {
     }
   }
 
-  Status AddBatchSliceToRowBatch(const TBatch& batch, size_t row_offset, size_t batch_size,
-                                 const std::vector<int64_t>& cols,
+  Status AddBatchSliceToRowBatch(const TBatch& batch, BatchID batch_id, size_t row_offset,
+                                 size_t batch_size, const std::vector<int64_t>& cols,
                                  schema::RowBatch* output_rb) const {
     if constexpr (std::is_same_v<TBatch, ColdBatch>) {
       for (auto col_idx : cols) {
-        auto arr = batch[col_idx]->Slice(row_offset, batch_size);
+        auto full_arr = batch[col_idx];
+        if (full_arr == nullptr) {
+          // The column was compressed after compaction; decompress it (or reuse a cached copy).
+          PL_ASSIGN_OR_RETURN(full_arr, GetDecompressedColumn(batch_id, col_idx));
+        }
+        auto arr = full_arr->Slice(row_offset, batch_size);
+        if (arr->type_id() == arrow::Type::DICTIONARY) {
+          // Query execution only understands the flat string layout, so dictionary-encoded cold
+          // columns are materialized on read.
+          PL_ASSIGN_OR_RETURN(arr, DecodeDictionarySlice(*arr, arrow::default_memory_pool()));
+        }
         PL_RETURN_IF_ERROR(output_rb->AddColumn(arr));
       }
       return Status::OK();
@@ -388,12 +470,48 @@ class StoreWithRowTimeAccounting {
     }
   }
 
+  StatusOr<ArrowArrayPtr> GetDecompressedColumn(BatchID batch_id, int64_t col_idx) const {
+    for (auto it = decompressed_cache_.begin(); it != decompressed_cache_.end(); ++it) {
+      if (it->batch_id == batch_id && it->col_idx == col_idx) {
+        // Move the hit to the front so the cache evicts in LRU order.
+        std::rotate(decompressed_cache_.begin(), it, it + 1);
+        return decompressed_cache_.front().array;
+      }
+    }
+    const auto& compressed = compressed_cols_[batch_id - first_batch_id_][col_idx];
+    DCHECK(compressed.has_value());
+    PL_ASSIGN_OR_RETURN(auto arr,
+                        DecompressColdColumn(compressed.value(), arrow::default_memory_pool()));
+    decompressed_cache_.insert(decompressed_cache_.begin(),
+                               DecompressedCacheEntry{batch_id, col_idx, arr});
+    if (decompressed_cache_.size() > kDecompressedCacheMaxEntries) {
+      decompressed_cache_.pop_back();
+    }
+    return arr;
+  }
+
   BatchID first_batch_id_ = 0;
   const schema::Relation& rel_;
   const int64_t time_col_idx_;
   std::deque<TBatch> batches_;
   std::deque<RowIDInterval> row_ids_;
   std::deque<TimeInterval> times_;
+  // Cold only: per-batch zone maps, parallel to batches_. Hot batches are short-lived and still
+  // growing, so maintaining zone maps for them isn't worth the per-write scan.
+  std::deque<ZoneMap> zone_maps_;
+  // Cold only: per-batch compressed column sidecars, parallel to batches_. A compressed column
+  // holds nullptr in the ColdBatch and its bytes here.
+  std::deque<std::vector<std::optional<CompressedColumn>>> compressed_cols_;
+
+  struct DecompressedCacheEntry {
+    BatchID batch_id;
+    int64_t col_idx;
+    ArrowArrayPtr array;
+  };
+  static constexpr size_t kDecompressedCacheMaxEntries = 8;
+  // Small LRU of decompressed columns (most recent first), so adjacent slice reads of the same
+  // cold batch don't decompress it repeatedly. Entries for expired batches age out naturally.
+  mutable std::vector<DecompressedCacheEntry> decompressed_cache_;
 };
 
 }  // namespace internal
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+
+#include "src/table_store/table/internal/string_dictionary.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+StatusOr<ArrowArrayPtr> DictionaryEncodeIfBeneficial(const ArrowArrayPtr& arr,
+                                                     arrow::MemoryPool* mem_pool) {
+  DCHECK_EQ(arr->type_id(), arrow::Type::STRING);
+  const auto& str_arr = static_cast<const arrow::StringArray&>(*arr);
+  const int64_t num_rows = str_arr.length();
+  if (num_rows < kMinRowsForDictionaryEncoding) {
+    return arr;
+  }
+
+  const auto max_distinct = static_cast<int64_t>(num_rows * kMaxDictionaryCardinalityRatio);
+  absl::flat_hash_map<std::string_view, int32_t> codes;
+  std::vector<int32_t> indices(num_rows);
+  int64_t dict_bytes = 0;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    auto view = str_arr.GetView(i);
+    auto [it, inserted] =
+        codes.try_emplace(std::string_view(view.data(), view.size()), codes.size());
+    if (inserted) {
+      if (static_cast<int64_t>(codes.size()) > max_distinct) {
+        // Too many distinct values; leave the column as a plain StringArray.
+        return arr;
+      }
+      dict_bytes += view.size();
+    }
+    indices[i] = it->second;
+  }
+
+  arrow::StringBuilder dict_builder(mem_pool);
+  PL_RETURN_IF_ERROR(dict_builder.Reserve(codes.size()));
+  PL_RETURN_IF_ERROR(dict_builder.ReserveData(dict_bytes));
+  // flat_hash_map iteration order is arbitrary, so place values by their assigned code.
+  std::vector<std::string_view> dict_values(codes.size());
+  for (const auto& [view, code] : codes) {
+    dict_values[code] = view;
+  }
+  for (const auto& view : dict_values) {
+    dict_builder.UnsafeAppend(view.data(), view.size());
+  }
+  std::shared_ptr<arrow::Array> dict_arr;
+  PL_RETURN_IF_ERROR(dict_builder.Finish(&dict_arr));
+
+  arrow::Int32Builder indices_builder(mem_pool);
+  PL_RETURN_IF_ERROR(indices_builder.Reserve(num_rows));
+  for (int32_t idx : indices) {
+    indices_builder.UnsafeAppend(idx);
+  }
+  std::shared_ptr<arrow::Array> indices_arr;
+  PL_RETURN_IF_ERROR(indices_builder.Finish(&indices_arr));
+
+  auto dict_type = arrow::dictionary(arrow::int32(), arrow::utf8());
+  return std::static_pointer_cast<arrow::Array>(
+      std::make_shared<arrow::DictionaryArray>(dict_type, indices_arr, dict_arr));
+}
+
+StatusOr<ArrowArrayPtr> DecodeDictionarySlice(const arrow::Array& arr,
+                                              arrow::MemoryPool* mem_pool) {
+  DCHECK_EQ(arr.type_id(), arrow::Type::DICTIONARY);
+  const auto& dict_arr = static_cast<const arrow::DictionaryArray&>(arr);
+  const auto& dict = static_cast<const arrow::StringArray&>(*dict_arr.dictionary());
+  const auto& indices = static_cast<const arrow::Int32Array&>(*dict_arr.indices());
+
+  const int64_t num_rows = indices.length();
+  int64_t data_bytes = 0;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    data_bytes += dict.GetView(indices.Value(i)).size();
+  }
+
+  arrow::StringBuilder builder(mem_pool);
+  PL_RETURN_IF_ERROR(builder.Reserve(num_rows));
+  PL_RETURN_IF_ERROR(builder.ReserveData(data_bytes));
+  for (int64_t i = 0; i < num_rows; ++i) {
+    auto view = dict.GetView(indices.Value(i));
+    builder.UnsafeAppend(view.data(), view.size());
+  }
+  std::shared_ptr<arrow::Array> out;
+  PL_RETURN_IF_ERROR(builder.Finish(&out));
+  return out;
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "src/common/base/base.h"
+#include "src/table_store/table/internal/types.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+// A string column is dictionary encoded at compaction time if it has at least this many rows and
+// its distinct-value ratio is at most kMaxDictionaryCardinalityRatio. The row minimum avoids
+// paying the cardinality scan on tiny batches where the savings are noise.
+constexpr int64_t kMinRowsForDictionaryEncoding = 256;
+constexpr double kMaxDictionaryCardinalityRatio = 0.2;
+
+/**
+ * DictionaryEncodeIfBeneficial dictionary-encodes the given StringArray if its cardinality is low
+ * enough to be worthwhile (columns like req_method, remote_addr or pod names compress heavily).
+ * Returns the input array unchanged when encoding isn't beneficial. The returned DictionaryArray
+ * uses int32 codes and a deduplicated string dictionary.
+ */
+StatusOr<ArrowArrayPtr> DictionaryEncodeIfBeneficial(const ArrowArrayPtr& arr,
+                                                     arrow::MemoryPool* mem_pool);
+
+/**
+ * DecodeDictionarySlice materializes a (possibly sliced) string DictionaryArray back into a plain
+ * StringArray, for handing to query execution which only understands the flat layout.
+ */
+StatusOr<ArrowArrayPtr> DecodeDictionarySlice(const arrow::Array& arr, arrow::MemoryPool* mem_pool);
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/table/internal/string_dictionary.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+namespace {
+ArrowArrayPtr MakeStringArray(const std::vector<std::string>& values) {
+  std::vector<types::StringValue> string_values(values.begin(), values.end());
+  return types::ToArrow(string_values, arrow::default_memory_pool());
+}
+}  // namespace
+
+TEST(StringDictionaryTest, EncodesLowCardinalityColumn) {
+  std::vector<std::string> methods = {"GET", "POST", "PUT"};
+  std::vector<std::string> values;
+  for (int i = 0; i < 2 * kMinRowsForDictionaryEncoding; ++i) {
+    values.push_back(methods[i % methods.size()]);
+  }
+  auto arr = MakeStringArray(values);
+
+  auto encoded_or = DictionaryEncodeIfBeneficial(arr, arrow::default_memory_pool());
+  ASSERT_OK(encoded_or);
+  auto encoded = encoded_or.ConsumeValueOrDie();
+  ASSERT_EQ(arrow::Type::DICTIONARY, encoded->type_id());
+
+  auto decoded_or = DecodeDictionarySlice(*encoded, arrow::default_memory_pool());
+  ASSERT_OK(decoded_or);
+  EXPECT_TRUE(arr->Equals(decoded_or.ConsumeValueOrDie()));
+}
+
+TEST(StringDictionaryTest, DecodesSlices) {
+  std::vector<std::string> values;
+  for (int i = 0; i < 2 * kMinRowsForDictionaryEncoding; ++i) {
+    values.push_back(i % 2 == 0 ? "pod-a" : "pod-b");
+  }
+  auto arr = MakeStringArray(values);
+  auto encoded =
+      DictionaryEncodeIfBeneficial(arr, arrow::default_memory_pool()).ConsumeValueOrDie();
+  ASSERT_EQ(arrow::Type::DICTIONARY, encoded->type_id());
+
+  auto slice = encoded->Slice(10, 100);
+  auto decoded_or = DecodeDictionarySlice(*slice, arrow::default_memory_pool());
+  ASSERT_OK(decoded_or);
+  EXPECT_TRUE(arr->Slice(10, 100)->Equals(decoded_or.ConsumeValueOrDie()));
+}
+
+TEST(StringDictionaryTest, SkipsHighCardinalityColumn) {
+  std::vector<std::string> values;
+  for (int i = 0; i < 2 * kMinRowsForDictionaryEncoding; ++i) {
+    values.push_back("unique-value-" + std::to_string(i));
+  }
+  auto arr = MakeStringArray(values);
+
+  auto encoded_or = DictionaryEncodeIfBeneficial(arr, arrow::default_memory_pool());
+  ASSERT_OK(encoded_or);
+  // High-cardinality columns should be returned unchanged.
+  EXPECT_EQ(arr.get(), encoded_or.ConsumeValueOrDie().get());
+}
+
+TEST(StringDictionaryTest, SkipsSmallBatches) {
+  auto arr = MakeStringArray({"a", "a", "a"});
+  auto encoded_or = DictionaryEncodeIfBeneficial(arr, arrow::default_memory_pool());
+  ASSERT_OK(encoded_or);
+  EXPECT_EQ(arr.get(), encoded_or.ConsumeValueOrDie().get());
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
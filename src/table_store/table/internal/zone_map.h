@@ -0,0 +1,103 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <absl/container/flat_hash_map.h>
+
+#include "src/common/base/base.h"
+#include "src/table_store/schema/relation.h"
+#include "src/table_store/table/internal/types.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+/**
+ * ZoneMapRange is the inclusive [min, max] value range of one column within one batch.
+ */
+struct ZoneMapRange {
+  int64_t min;
+  int64_t max;
+};
+
+/**
+ * ZoneMap summarizes one batch as a per-column value range, keyed by column index. Only
+ * int64-backed columns (TIME64NS and INT64) are summarized; columns without an entry must be
+ * treated as matching any predicate.
+ */
+using ZoneMap = absl::flat_hash_map<int64_t, ZoneMapRange>;
+
+/**
+ * ZoneMapFilter is an inclusive value range predicate on a single column. Batches whose zone map
+ * range for the column doesn't intersect [lower, upper] can be skipped without touching their
+ * memory.
+ */
+struct ZoneMapFilter {
+  int64_t col_idx;
+  int64_t lower;
+  int64_t upper;
+};
+
+/**
+ * BuildZoneMap computes the zone map for a cold batch. This touches each int64-backed column
+ * once, so it should only be called when the batch's data is already warm (i.e. at compaction
+ * time).
+ * @param batch the cold batch to summarize.
+ * @param rel the table's relation.
+ * @return zone map with an entry for each summarized column.
+ */
+inline ZoneMap BuildZoneMap(const ColdBatch& batch, const schema::Relation& rel) {
+  ZoneMap zone_map;
+  for (const auto& [col_idx, arr] : Enumerate(batch)) {
+    auto col_type = rel.col_types()[col_idx];
+    if (col_type != types::DataType::TIME64NS && col_type != types::DataType::INT64) {
+      continue;
+    }
+    if (arr->length() == 0 || arr->type_id() == arrow::Type::DICTIONARY) {
+      continue;
+    }
+    const int64_t* values = arr->data()->GetValues<int64_t>(1);
+    int64_t min = values[0];
+    int64_t max = values[0];
+    for (int64_t i = 1; i < arr->length(); ++i) {
+      min = std::min(min, values[i]);
+      max = std::max(max, values[i]);
+    }
+    zone_map.emplace(static_cast<int64_t>(col_idx), ZoneMapRange{min, max});
+  }
+  return zone_map;
+}
+
+/**
+ * ZoneMapMayContain returns whether a batch with the given zone map may contain rows matching the
+ * filter. Columns without a zone map entry conservatively match.
+ */
+inline bool ZoneMapMayContain(const ZoneMap& zone_map, const ZoneMapFilter& filter) {
+  auto it = zone_map.find(filter.col_idx);
+  if (it == zone_map.end()) {
+    return true;
+  }
+  return it->second.min <= filter.upper && it->second.max >= filter.lower;
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/table/internal/zone_map.h"
+
+namespace px {
+namespace table_store {
+namespace internal {
+
+TEST(ZoneMapTest, BuildsRangesForInt64BackedColumns) {
+  schema::Relation rel(
+      {types::DataType::TIME64NS, types::DataType::INT64, types::DataType::STRING},
+      {"time_", "latency", "req_path"});
+
+  std::vector<types::Time64NSValue> times = {100, 200, 300};
+  std::vector<types::Int64Value> latencies = {7, 3, 5};
+  std::vector<types::StringValue> paths = {"/a", "/b", "/c"};
+  ColdBatch batch = {types::ToArrow(times, arrow::default_memory_pool()),
+                     types::ToArrow(latencies, arrow::default_memory_pool()),
+                     types::ToArrow(paths, arrow::default_memory_pool())};
+
+  auto zone_map = BuildZoneMap(batch, rel);
+  ASSERT_EQ(2, zone_map.size());
+  EXPECT_EQ(100, zone_map.at(0).min);
+  EXPECT_EQ(300, zone_map.at(0).max);
+  EXPECT_EQ(3, zone_map.at(1).min);
+  EXPECT_EQ(7, zone_map.at(1).max);
+}
+
+TEST(ZoneMapTest, MayContain) {
+  ZoneMap zone_map;
+  zone_map.emplace(0, ZoneMapRange{100, 300});
+
+  // Overlapping ranges match.
+  EXPECT_TRUE(ZoneMapMayContain(zone_map, ZoneMapFilter{0, 150, 250}));
+  EXPECT_TRUE(ZoneMapMayContain(zone_map, ZoneMapFilter{0, 0, 100}));
+  EXPECT_TRUE(ZoneMapMayContain(zone_map, ZoneMapFilter{0, 300, 500}));
+  // Disjoint ranges don't.
+  EXPECT_FALSE(ZoneMapMayContain(zone_map, ZoneMapFilter{0, 0, 99}));
+  EXPECT_FALSE(ZoneMapMayContain(zone_map, ZoneMapFilter{0, 301, 500}));
+  // Columns without a zone map entry conservatively match.
+  EXPECT_TRUE(ZoneMapMayContain(zone_map, ZoneMapFilter{1, 0, 0}));
+}
+
+}  // namespace internal
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "src/table_store/table/shared_scan.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace px {
+namespace table_store {
+
+namespace {
+// Once the scan map holds this many entries, AttachConsumer sweeps out expired ones so keys that
+// are never scanned again (e.g. one-off queries) cannot accumulate indefinitely.
+constexpr size_t kScanMapSweepThreshold = 64;
+}  // namespace
+
+/**
+ * SharedScan is one physical sweep: the underlying cursor plus the batches read so far that some
+ * attached consumer has not yet consumed. Each consumer tracks its own position as a sequence
+ * number; batch N is fetched from the table exactly once, when the first consumer reaches it, and
+ * released once every consumer has moved past it. All state is guarded by a single spin lock,
+ * consistent with Table's own locking; fetches run under the lock, which serializes consumers
+ * racing past the buffered range onto one cursor advance.
+ */
+class SharedScanManager::Consumer::SharedScan {
+ public:
+  SharedScan(const Table* table, std::vector<int64_t> cols,
+             const Table::Cursor::StartSpec& start, const Table::Cursor::StopSpec& stop)
+      : cols_(std::move(cols)), cursor_(table, start, stop) {}
+
+  // Attaches a new consumer at the start of the sweep and returns its id, or -1 if the sweep has
+  // already released batches and can no longer serve a consumer from the beginning.
+  int64_t Attach() {
+    absl::base_internal::SpinLockHolder lock(&lock_);
+    if (base_seq_ > 0) {
+      return -1;
+    }
+    int64_t id = next_consumer_id_++;
+    consumer_pos_[id] = 0;
+    return id;
+  }
+
+  void Detach(int64_t id) {
+    absl::base_internal::SpinLockHolder lock(&lock_);
+    consumer_pos_.erase(id);
+    if (consumer_pos_.empty()) {
+      buffer_.clear();
+    } else {
+      ReleaseConsumedLocked();
+    }
+  }
+
+  bool NextBatchReady(int64_t id) {
+    absl::base_internal::SpinLockHolder lock(&lock_);
+    if (ConsumerPosLocked(id) < base_seq_ + static_cast<int64_t>(buffer_.size())) {
+      return true;
+    }
+    return cursor_.NextBatchReady();
+  }
+
+  bool Done(int64_t id) {
+    absl::base_internal::SpinLockHolder lock(&lock_);
+    if (ConsumerPosLocked(id) < base_seq_ + static_cast<int64_t>(buffer_.size())) {
+      return false;
+    }
+    return cursor_.Done();
+  }
+
+  StatusOr<std::shared_ptr<const schema::RowBatch>> GetNextRowBatch(int64_t id) {
+    absl::base_internal::SpinLockHolder lock(&lock_);
+    int64_t pos = ConsumerPosLocked(id);
+    if (pos >= base_seq_ + static_cast<int64_t>(buffer_.size())) {
+      // This consumer is the furthest ahead, so it drives the cursor.
+      if (!scan_status_.ok()) {
+        return scan_status_;
+      }
+      if (cursor_.Done()) {
+        return error::ResourceUnavailable("Shared scan is exhausted.");
+      }
+      auto batch_or_s = cursor_.GetNextRowBatch(cols_);
+      if (!batch_or_s.ok()) {
+        // A cursor error fails the sweep for every consumer; replaying different data to
+        // different consumers would defeat the point of sharing the scan.
+        scan_status_ = batch_or_s.status();
+        return scan_status_;
+      }
+      buffer_.emplace_back(batch_or_s.ConsumeValueOrDie());
+    }
+    auto batch = buffer_[pos - base_seq_];
+    consumer_pos_[id] = pos + 1;
+    ReleaseConsumedLocked();
+    return batch;
+  }
+
+ private:
+  int64_t ConsumerPosLocked(int64_t id) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    auto it = consumer_pos_.find(id);
+    DCHECK(it != consumer_pos_.end());
+    return it->second;
+  }
+
+  // Releases the prefix of the buffer that every attached consumer has consumed.
+  void ReleaseConsumedLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    int64_t min_pos = base_seq_ + static_cast<int64_t>(buffer_.size());
+    for (const auto& [id, pos] : consumer_pos_) {
+      min_pos = std::min(min_pos, pos);
+    }
+    while (base_seq_ < min_pos && !buffer_.empty()) {
+      buffer_.pop_front();
+      base_seq_++;
+    }
+  }
+
+  const std::vector<int64_t> cols_;
+
+  absl::base_internal::SpinLock lock_;
+  Table::Cursor cursor_ ABSL_GUARDED_BY(lock_);
+  // Batches [base_seq_, base_seq_ + buffer_.size()) in sweep order.
+  std::deque<std::shared_ptr<const schema::RowBatch>> buffer_ ABSL_GUARDED_BY(lock_);
+  int64_t base_seq_ ABSL_GUARDED_BY(lock_) = 0;
+  // First cursor error, if any; returned to all consumers from then on.
+  Status scan_status_ ABSL_GUARDED_BY(lock_);
+  int64_t next_consumer_id_ ABSL_GUARDED_BY(lock_) = 0;
+  // Consumer id -> sequence number of the next batch that consumer will read.
+  absl::flat_hash_map<int64_t, int64_t> consumer_pos_ ABSL_GUARDED_BY(lock_);
+};
+
+SharedScanManager::Consumer::~Consumer() { scan_->Detach(consumer_id_); }
+
+bool SharedScanManager::Consumer::NextBatchReady() { return scan_->NextBatchReady(consumer_id_); }
+
+bool SharedScanManager::Consumer::Done() { return scan_->Done(consumer_id_); }
+
+StatusOr<std::shared_ptr<const schema::RowBatch>> SharedScanManager::Consumer::GetNextRowBatch() {
+  return scan_->GetNextRowBatch(consumer_id_);
+}
+
+std::unique_ptr<SharedScanManager::Consumer> SharedScanManager::AttachConsumer(
+    const Table* table, const std::vector<int64_t>& cols, const Table::Cursor::StartSpec& start,
+    const Table::Cursor::StopSpec& stop) {
+  ScanKey key{table, cols, start.type, start.start_time, stop.type, stop.stop_time};
+
+  absl::base_internal::SpinLockHolder lock(&scans_lock_);
+  auto it = scans_.find(key);
+  if (it != scans_.end()) {
+    if (auto scan = it->second.lock()) {
+      int64_t id = scan->Attach();
+      if (id >= 0) {
+        return std::unique_ptr<Consumer>(new Consumer(std::move(scan), id));
+      }
+      // The sweep has advanced past its retained prefix; fall through to start a fresh one.
+    } else {
+      // All consumers have detached; drop the dead entry rather than waiting for the next
+      // NumActiveScans call to collect it.
+      scans_.erase(it);
+    }
+  }
+
+  if (scans_.size() >= kScanMapSweepThreshold) {
+    for (auto sweep_it = scans_.begin(); sweep_it != scans_.end();) {
+      if (sweep_it->second.expired()) {
+        scans_.erase(sweep_it++);
+      } else {
+        ++sweep_it;
+      }
+    }
+  }
+
+  auto scan = std::make_shared<Consumer::SharedScan>(table, cols, start, stop);
+  int64_t id = scan->Attach();
+  DCHECK_GE(id, 0);
+  scans_[key] = scan;
+  return std::unique_ptr<Consumer>(new Consumer(std::move(scan), id));
+}
+
+int64_t SharedScanManager::NumActiveScans() {
+  absl::base_internal::SpinLockHolder lock(&scans_lock_);
+  int64_t count = 0;
+  for (auto it = scans_.begin(); it != scans_.end();) {
+    if (it->second.expired()) {
+      scans_.erase(it++);
+    } else {
+      count++;
+      ++it;
+    }
+  }
+  return count;
+}
+
+}  // namespace table_store
+}  // namespace px
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <absl/base/internal/spinlock.h>
+#include <absl/container/flat_hash_map.h>
+
+#include "src/common/base/base.h"
+#include "src/table_store/table/table.h"
+
+namespace px {
+namespace table_store {
+
+/**
+ * SharedScanManager coalesces concurrent scans of the same table slice into one physical sweep.
+ * When several queries scan the same table with the same column projection and time bounds (the
+ * common case for dashboards refreshing the same view), attaching them to the manager gives each
+ * its own consumer handle while only one underlying Table::Cursor reads the stored batches. Each
+ * batch is materialized once and handed to every consumer as a shared, immutable row batch, so N
+ * concurrent readers cost roughly one reader's worth of memory bandwidth.
+ *
+ * A consumer can join an existing sweep as long as the sweep still retains every batch it has
+ * read so far; batches are released once all attached consumers have consumed them, after which
+ * late arrivals get a fresh sweep. Consumers poll independently and may be on different threads;
+ * whichever consumer is furthest ahead drives the underlying cursor forward.
+ */
+class SharedScanManager : public NotCopyable {
+ public:
+  /**
+   * Consumer is one query's view of a shared sweep. It mirrors the Table::Cursor interface,
+   * except that batches are shared and immutable since other consumers see the same objects.
+   * Detaches from the sweep on destruction.
+   */
+  class Consumer : public NotCopyable {
+   public:
+    ~Consumer();
+
+    /**
+     * Whether a call to GetNextRowBatch() can currently produce data, either from batches the
+     * sweep has already read or from the underlying cursor. See Table::Cursor::NextBatchReady
+     * for the caveats around concurrent writes.
+     */
+    bool NextBatchReady();
+
+    /**
+     * Whether this consumer has seen every batch the sweep will produce.
+     */
+    bool Done();
+
+    /**
+     * Returns the next row batch for this consumer. If this consumer is the furthest ahead, the
+     * underlying cursor is advanced; otherwise the batch comes from the sweep's buffer without
+     * touching the table. A cursor error fails the whole sweep and is returned to every consumer.
+     */
+    StatusOr<std::shared_ptr<const schema::RowBatch>> GetNextRowBatch();
+
+   private:
+    friend class SharedScanManager;
+    class SharedScan;
+
+    Consumer(std::shared_ptr<SharedScan> scan, int64_t consumer_id)
+        : scan_(std::move(scan)), consumer_id_(consumer_id) {}
+
+    std::shared_ptr<SharedScan> scan_;
+    int64_t consumer_id_;
+  };
+
+  /**
+   * Attaches a consumer for the given scan. If a sweep over the same table, columns and bounds is
+   * in progress and still joinable, the consumer shares it; otherwise a new sweep is started.
+   * The table must outlive the returned consumer.
+   */
+  std::unique_ptr<Consumer> AttachConsumer(const Table* table, const std::vector<int64_t>& cols,
+                                           const Table::Cursor::StartSpec& start,
+                                           const Table::Cursor::StopSpec& stop);
+
+  /**
+   * Number of sweeps that currently have at least one attached consumer. Exposed for tests and
+   * stats collection.
+   */
+  int64_t NumActiveScans();
+
+ private:
+  struct ScanKey {
+    const Table* table;
+    std::vector<int64_t> cols;
+    Table::Cursor::StartSpec::StartType start_type;
+    Table::Time start_time;
+    Table::Cursor::StopSpec::StopType stop_type;
+    Table::Time stop_time;
+
+    bool operator==(const ScanKey& other) const {
+      return table == other.table && cols == other.cols && start_type == other.start_type &&
+             start_time == other.start_time && stop_type == other.stop_type &&
+             stop_time == other.stop_time;
+    }
+
+    template <typename H>
+    friend H AbslHashValue(H h, const ScanKey& key) {
+      return H::combine(std::move(h), key.table, key.cols, key.start_type, key.start_time,
+                        key.stop_type, key.stop_time);
+    }
+  };
+
+  // Scans are owned by their consumers; the manager only keeps weak references so an abandoned
+  // sweep releases its buffered batches as soon as the last consumer detaches.
+  absl::base_internal::SpinLock scans_lock_;
+  absl::flat_hash_map<ScanKey, std::weak_ptr<Consumer::SharedScan>> scans_
+      ABSL_GUARDED_BY(scans_lock_);
+};
+
+}  // namespace table_store
+}  // namespace px
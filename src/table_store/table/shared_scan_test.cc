@@ -0,0 +1,151 @@
+/*
+ * Copyright 2018- The Pixie Authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <vector>
+
+#include "src/common/testing/testing.h"
+#include "src/shared/types/arrow_adapter.h"
+#include "src/table_store/schema/relation.h"
+#include "src/table_store/table/shared_scan.h"
+#include "src/table_store/table/table.h"
+
+namespace px {
+namespace table_store {
+
+namespace {
+
+std::shared_ptr<Table> TestTable() {
+  schema::Relation rel({types::DataType::TIME64NS, types::DataType::INT64}, {"time_", "col2"});
+  auto table = Table::Create("test_table", rel);
+
+  auto rb1 = schema::RowBatch(schema::RowDescriptor(rel.col_types()), 3);
+  std::vector<types::Time64NSValue> time_in1 = {1, 2, 3};
+  std::vector<types::Int64Value> col2_in1 = {10, 20, 30};
+  PL_CHECK_OK(rb1.AddColumn(types::ToArrow(time_in1, arrow::default_memory_pool())));
+  PL_CHECK_OK(rb1.AddColumn(types::ToArrow(col2_in1, arrow::default_memory_pool())));
+  PL_CHECK_OK(table->WriteRowBatch(rb1));
+
+  auto rb2 = schema::RowBatch(schema::RowDescriptor(rel.col_types()), 2);
+  std::vector<types::Time64NSValue> time_in2 = {5, 6};
+  std::vector<types::Int64Value> col2_in2 = {50, 60};
+  PL_CHECK_OK(rb2.AddColumn(types::ToArrow(time_in2, arrow::default_memory_pool())));
+  PL_CHECK_OK(rb2.AddColumn(types::ToArrow(col2_in2, arrow::default_memory_pool())));
+  PL_CHECK_OK(table->WriteRowBatch(rb2));
+
+  return table;
+}
+
+}  // namespace
+
+TEST(SharedScanTest, concurrent_consumers_share_one_sweep) {
+  auto table = TestTable();
+  SharedScanManager manager;
+  std::vector<int64_t> cols = {0, 1};
+
+  auto consumer1 = manager.AttachConsumer(table.get(), cols, Table::Cursor::StartSpec{},
+                                          Table::Cursor::StopSpec{});
+  auto consumer2 = manager.AttachConsumer(table.get(), cols, Table::Cursor::StartSpec{},
+                                          Table::Cursor::StopSpec{});
+  EXPECT_EQ(1, manager.NumActiveScans());
+
+  // The first consumer drives the cursor; the second gets the exact same batch objects without
+  // touching the table again.
+  auto c1_rb1 = consumer1->GetNextRowBatch().ConsumeValueOrDie();
+  auto c2_rb1 = consumer2->GetNextRowBatch().ConsumeValueOrDie();
+  EXPECT_EQ(c1_rb1.get(), c2_rb1.get());
+  EXPECT_EQ(3, c1_rb1->num_rows());
+
+  auto c1_rb2 = consumer1->GetNextRowBatch().ConsumeValueOrDie();
+  auto c2_rb2 = consumer2->GetNextRowBatch().ConsumeValueOrDie();
+  EXPECT_EQ(c1_rb2.get(), c2_rb2.get());
+  EXPECT_EQ(2, c1_rb2->num_rows());
+
+  EXPECT_TRUE(consumer1->Done());
+  EXPECT_TRUE(consumer2->Done());
+  EXPECT_NOT_OK(consumer1->GetNextRowBatch());
+}
+
+TEST(SharedScanTest, lagging_consumer_reads_buffered_batches) {
+  auto table = TestTable();
+  SharedScanManager manager;
+  std::vector<int64_t> cols = {1};
+
+  auto fast = manager.AttachConsumer(table.get(), cols, Table::Cursor::StartSpec{},
+                                     Table::Cursor::StopSpec{});
+  auto slow = manager.AttachConsumer(table.get(), cols, Table::Cursor::StartSpec{},
+                                     Table::Cursor::StopSpec{});
+
+  // The fast consumer sweeps to the end; the slow one still sees every batch in order.
+  auto fast_rb1 = fast->GetNextRowBatch().ConsumeValueOrDie();
+  auto fast_rb2 = fast->GetNextRowBatch().ConsumeValueOrDie();
+  EXPECT_TRUE(fast->Done());
+  EXPECT_FALSE(slow->Done());
+
+  EXPECT_TRUE(slow->NextBatchReady());
+  EXPECT_EQ(fast_rb1.get(), slow->GetNextRowBatch().ConsumeValueOrDie().get());
+  EXPECT_EQ(fast_rb2.get(), slow->GetNextRowBatch().ConsumeValueOrDie().get());
+  EXPECT_TRUE(slow->Done());
+}
+
+TEST(SharedScanTest, late_attach_after_release_starts_fresh_sweep) {
+  auto table = TestTable();
+  SharedScanManager manager;
+  std::vector<int64_t> cols = {0, 1};
+
+  auto consumer1 = manager.AttachConsumer(table.get(), cols, Table::Cursor::StartSpec{},
+                                          Table::Cursor::StopSpec{});
+  // With a single consumer attached, consumed batches are released immediately, so a later
+  // consumer can't replay the sweep and must get its own.
+  PL_CHECK_OK(consumer1->GetNextRowBatch());
+
+  auto consumer2 = manager.AttachConsumer(table.get(), cols, Table::Cursor::StartSpec{},
+                                          Table::Cursor::StopSpec{});
+  EXPECT_EQ(2, manager.NumActiveScans());
+
+  auto rb1 = consumer2->GetNextRowBatch().ConsumeValueOrDie();
+  EXPECT_EQ(3, rb1->num_rows());
+}
+
+TEST(SharedScanTest, different_projections_do_not_coalesce) {
+  auto table = TestTable();
+  SharedScanManager manager;
+
+  auto consumer1 = manager.AttachConsumer(table.get(), {0, 1}, Table::Cursor::StartSpec{},
+                                          Table::Cursor::StopSpec{});
+  auto consumer2 = manager.AttachConsumer(table.get(), {1}, Table::Cursor::StartSpec{},
+                                          Table::Cursor::StopSpec{});
+  EXPECT_EQ(2, manager.NumActiveScans());
+
+  EXPECT_EQ(2, consumer1->GetNextRowBatch().ConsumeValueOrDie()->num_columns());
+  EXPECT_EQ(1, consumer2->GetNextRowBatch().ConsumeValueOrDie()->num_columns());
+}
+
+TEST(SharedScanTest, detached_scans_are_released) {
+  auto table = TestTable();
+  SharedScanManager manager;
+
+  auto consumer = manager.AttachConsumer(table.get(), {0, 1}, Table::Cursor::StartSpec{},
+                                         Table::Cursor::StopSpec{});
+  EXPECT_EQ(1, manager.NumActiveScans());
+  consumer.reset();
+  EXPECT_EQ(0, manager.NumActiveScans());
+}
+
+}  // namespace table_store
+}  // namespace px
@@ -34,7 +34,9 @@
 #include "src/shared/types/type_utils.h"
 #include "src/table_store/schema/relation.h"
 #include "src/table_store/table/internal/batch_size_accountant.h"
+#include "src/table_store/table/internal/cold_batch_compressor.h"
 #include "src/table_store/table/internal/record_or_row_batch.h"
+#include "src/table_store/table/internal/string_dictionary.h"
 #include "src/table_store/table/internal/types.h"
 #include "src/table_store/table/table.h"
 
@@ -45,6 +47,25 @@ DEFINE_int32(table_store_table_size_limit,
              "The maximal size a table allows. When the size grows beyond this limit, "
              "old data will be discarded.");
 
+DEFINE_bool(table_store_dictionary_encode_cold_strings,
+            gflags::BoolFromEnv("PL_TABLE_STORE_DICTIONARY_ENCODE_COLD_STRINGS", true),
+            "Whether to dictionary encode low-cardinality string columns (e.g. req_method, pod "
+            "names) when compacting them into cold batches. Encoded columns are materialized "
+            "back to plain string arrays on read.");
+
+DEFINE_string(table_store_cold_spill_dir,
+              gflags::StringFromEnv("PL_TABLE_STORE_COLD_SPILL_DIR", ""),
+              "If set, compacted cold batches are spilled to memory-mapped files under this "
+              "directory instead of staying on the heap. Reads remain zero-copy through the "
+              "mapping. Empty (the default) disables spilling.");
+
+DEFINE_bool(table_store_compress_cold_batches,
+            gflags::BoolFromEnv("PL_TABLE_STORE_COMPRESS_COLD_BATCHES", false),
+            "Whether to compress cold batch columns after compaction. Compressed columns are "
+            "decompressed lazily when a cursor reads them, trading read-side CPU for longer "
+            "retention within the table size limit. Mutually exclusive with "
+            "--table_store_cold_spill_dir.");
+
 namespace px {
 namespace table_store {
 
@@ -149,6 +170,23 @@ Table::Table(std::string_view table_name, const schema::Relation& relation, size
       rel_, time_col_idx_);
   cold_store_ = std::make_unique<internal::StoreWithRowTimeAccounting<internal::StoreType::Cold>>(
       rel_, time_col_idx_);
+  if (!FLAGS_table_store_cold_spill_dir.empty() && FLAGS_table_store_compress_cold_batches) {
+    LOG(WARNING) << absl::Substitute(
+        "Both --table_store_cold_spill_dir and --table_store_compress_cold_batches are set for "
+        "table $0. Spilling is disabled; cold batches will be compressed in memory.",
+        table_name);
+  } else if (!FLAGS_table_store_cold_spill_dir.empty()) {
+    auto spiller_or = internal::ColdBatchSpiller::Create(FLAGS_table_store_cold_spill_dir,
+                                                         std::string(table_name));
+    if (spiller_or.ok()) {
+      cold_batch_spiller_ = spiller_or.ConsumeValueOrDie();
+    } else {
+      LOG(WARNING) << absl::Substitute(
+          "Failed to initialize cold batch spiller for table $0: $1. Cold batches will stay in "
+          "memory.",
+          table_name, spiller_or.msg());
+    }
+  }
 }
 
 Status Table::ToProto(table_store::schemapb::Table* table_proto) const {
@@ -177,7 +215,8 @@ StatusOr<std::unique_ptr<schema::RowBatch>> Table::GetNextRowBatch(
   absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
   PL_ASSIGN_OR_RETURN(auto rb,
                       cold_store_->GetNextRowBatch(cursor->LastReadRowID(), cursor->Hints(),
-                                                   cursor->StopRowID(), cols));
+                                                   cursor->StopRowID(), cols,
+                                                   cursor->ZoneFilter()));
   if (rb == nullptr) {
     absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
     PL_ASSIGN_OR_RETURN(rb, hot_store_->GetNextRowBatch(cursor->LastReadRowID(), cursor->Hints(),
@@ -204,22 +243,36 @@ Status Table::ExpireRowBatches(int64_t row_batch_size) {
     return error::InvalidArgument("RowBatch size ($0) is bigger than maximum table size ($1).",
                                   row_batch_size, max_table_size_);
   }
-  int64_t bytes;
+
+  // Expired batches are moved out under the locks and destroyed after the locks are released, so
+  // freeing their memory doesn't stall concurrent writers or readers. The accountant tracks
+  // per-batch sizes up front, so each eviction decision is O(1): the oldest batch is popped and
+  // its known size is deducted.
+  std::vector<ColdBatch> expired_cold;
+  std::vector<internal::HotBatch> expired_hot;
   {
+    absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
     absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
-    bytes = batch_size_accountant_->HotBytes() + batch_size_accountant_->ColdBytes();
-  }
-  while (bytes + row_batch_size > max_table_size_) {
-    PL_RETURN_IF_ERROR(ExpireBatch());
-    {
-      absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
+    int64_t bytes = batch_size_accountant_->HotBytes() + batch_size_accountant_->ColdBytes();
+    while (bytes + row_batch_size > max_table_size_) {
+      if (cold_store_->Size() > 0) {
+        expired_cold.emplace_back(cold_store_->PopFront());
+        batch_size_accountant_->ExpireColdBatch();
+      } else if (hot_store_->Size() > 0) {
+        expired_hot.emplace_back(hot_store_->PopFront());
+        batch_size_accountant_->ExpireHotBatch();
+      } else {
+        return error::InvalidArgument("Failed to expire row batch, no row batches in table");
+      }
       bytes = batch_size_accountant_->HotBytes() + batch_size_accountant_->ColdBytes();
     }
-    {
-      absl::base_internal::SpinLockHolder lock(&stats_lock_);
-      batches_expired_++;
-      metrics_.batches_expired_counter.Increment();
-    }
+  }
+
+  auto num_expired = static_cast<int64_t>(expired_cold.size() + expired_hot.size());
+  if (num_expired > 0) {
+    absl::base_internal::SpinLockHolder lock(&stats_lock_);
+    batches_expired_ += num_expired;
+    metrics_.batches_expired_counter.Increment(num_expired);
   }
   return Status::OK();
 }
@@ -280,9 +333,30 @@ Status Table::WriteHot(internal::RecordOrRowBatch&& record_or_row_batch) {
 
   // Make sure locks are released for this call, since they are reacquired inside.
   PL_RETURN_IF_ERROR(UpdateTableMetricGauges());
+
+  NotifyBatchArrival();
   return Status::OK();
 }
 
+int64_t Table::RegisterBatchArrivalCallback(std::function<void()> callback) {
+  absl::base_internal::SpinLockHolder lock(&callbacks_lock_);
+  int64_t id = next_callback_id_++;
+  batch_arrival_callbacks_[id] = std::move(callback);
+  return id;
+}
+
+void Table::UnregisterBatchArrivalCallback(int64_t callback_id) {
+  absl::base_internal::SpinLockHolder lock(&callbacks_lock_);
+  batch_arrival_callbacks_.erase(callback_id);
+}
+
+void Table::NotifyBatchArrival() {
+  absl::base_internal::SpinLockHolder lock(&callbacks_lock_);
+  for (const auto& [id, callback] : batch_arrival_callbacks_) {
+    callback();
+  }
+}
+
 Table::RowID Table::FirstRowID() const {
   absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
   if (cold_store_->Size() > 0) {
@@ -371,7 +445,7 @@ TableStats Table::GetTableStats() const {
   return info;
 }
 
-Status Table::CompactSingleBatchUnlocked(arrow::MemoryPool*) {
+StatusOr<Table::RowID> Table::CompactSingleBatchUnlocked(arrow::MemoryPool*) {
   const auto& compaction_spec = batch_size_accountant_->GetNextCompactedBatchSpec();
 
   PL_RETURN_IF_ERROR(
@@ -391,6 +465,17 @@ Status Table::CompactSingleBatchUnlocked(arrow::MemoryPool*) {
 
   PL_ASSIGN_OR_RETURN(std::vector<ArrowArrayPtr> out_columns, compactor_.Finish());
 
+  if (FLAGS_table_store_dictionary_encode_cold_strings) {
+    for (size_t col_idx = 0; col_idx < out_columns.size(); ++col_idx) {
+      if (rel_.GetColumnType(col_idx) != types::DataType::STRING) {
+        continue;
+      }
+      PL_ASSIGN_OR_RETURN(out_columns[col_idx],
+                          internal::DictionaryEncodeIfBeneficial(out_columns[col_idx],
+                                                                 arrow::default_memory_pool()));
+    }
+  }
+
   cold_store_->EmplaceBack(first_row_id, out_columns);
 
   auto num_rows_to_remove = batch_size_accountant_->FinishCompactedBatch();
@@ -403,58 +488,119 @@ Status Table::CompactSingleBatchUnlocked(arrow::MemoryPool*) {
     compacted_batches_++;
     metrics_.compacted_batches_counter.Increment();
   }
-  return Status::OK();
+  return first_row_id;
 }
 
 Status Table::CompactHotToCold(arrow::MemoryPool* mem_pool) {
+  return CompactHotToCold(mem_pool, std::chrono::steady_clock::time_point::max());
+}
+
+Status Table::CompactHotToCold(arrow::MemoryPool* mem_pool,
+                               std::chrono::steady_clock::time_point deadline) {
   bool next_ready = false;
   {
     absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
     next_ready = batch_size_accountant_->CompactedBatchReady();
   }
   while (next_ready) {
-    absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
-    absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
-    // We have to check CompactedBatchReady() again, in case hot batches were expired since the last
-    // check.
-    if (!batch_size_accountant_->CompactedBatchReady()) {
+    // Check the deadline before taking the locks, so that an expired budget never blocks writers
+    // for another batch compaction. Any remaining hot batches are picked up by the next call.
+    if (std::chrono::steady_clock::now() >= deadline) {
       break;
     }
-    PL_RETURN_IF_ERROR(CompactSingleBatchUnlocked(mem_pool));
-    next_ready = batch_size_accountant_->CompactedBatchReady();
+    RowID compacted_first_row_id = -1;
+    {
+      absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
+      absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
+      // We have to check CompactedBatchReady() again, in case hot batches were expired since the
+      // last check.
+      if (!batch_size_accountant_->CompactedBatchReady()) {
+        break;
+      }
+      PL_ASSIGN_OR_RETURN(compacted_first_row_id, CompactSingleBatchUnlocked(mem_pool));
+      next_ready = batch_size_accountant_->CompactedBatchReady();
+    }
+    if (FLAGS_table_store_compress_cold_batches) {
+      // Compression is CPU-heavy, so it happens outside the table locks.
+      CompressColdBatch(compacted_first_row_id);
+    } else if (cold_batch_spiller_ != nullptr) {
+      // Spilling does disk I/O, so it happens outside the table locks.
+      SpillColdBatchToDisk(compacted_first_row_id);
+    }
   }
   return Status::OK();
 }
 
-StatusOr<bool> Table::ExpireCold() {
+void Table::SpillColdBatchToDisk(RowID first_row_id) {
+  ColdBatch batch_copy;
+  {
+    absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
+    if (cold_store_->Size() == 0 || cold_store_->BackFirstRowID() != first_row_id) {
+      return;
+    }
+    batch_copy = cold_store_->back();
+  }
+  auto spilled_or = cold_batch_spiller_->Spill(batch_copy);
+  if (!spilled_or.ok()) {
+    LOG_EVERY_N(WARNING, 100) << absl::Substitute("Failed to spill cold batch to disk: $0",
+                                                  spilled_or.msg());
+    return;
+  }
   absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
-  if (cold_store_->Size() == 0) {
-    return false;
+  // The batch may have been expired (or, in principle, another compaction may have run) while the
+  // spill was in flight; in that case just drop the spilled copy.
+  if (cold_store_->Size() == 0 || cold_store_->BackFirstRowID() != first_row_id) {
+    return;
   }
-  cold_store_->PopFront();
-  absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
-  batch_size_accountant_->ExpireColdBatch();
-  return true;
+  cold_store_->back() = spilled_or.ConsumeValueOrDie();
 }
 
-Status Table::ExpireHot() {
-  absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
-  if (hot_store_->Size() == 0) {
-    return error::InvalidArgument("Failed to expire row batch, no row batches in table");
+void Table::CompressColdBatch(RowID first_row_id) {
+  ColdBatch batch_copy;
+  {
+    absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
+    if (cold_store_->Size() == 0 || cold_store_->BackFirstRowID() != first_row_id) {
+      return;
+    }
+    batch_copy = cold_store_->back();
   }
-  hot_store_->PopFront();
-  batch_size_accountant_->ExpireHotBatch();
-  return Status::OK();
-}
 
-Status Table::ExpireBatch() {
-  PL_ASSIGN_OR_RETURN(auto expired_cold, ExpireCold());
-  if (expired_cold) {
-    return Status::OK();
+  std::vector<std::optional<internal::CompressedColumn>> compressed_cols(batch_copy.size());
+  uint64_t bytes_saved = 0;
+  for (const auto& [col_idx, arr] : Enumerate(batch_copy)) {
+    // The time column stays uncompressed since it backs time-based cursor positioning, and
+    // dictionary-encoded columns are already compact.
+    if (static_cast<int64_t>(col_idx) == time_col_idx_ ||
+        arr->type_id() == arrow::Type::DICTIONARY) {
+      continue;
+    }
+    auto compressed_or = internal::CompressColdColumn(arr);
+    if (!compressed_or.ok()) {
+      LOG_EVERY_N(WARNING, 100) << absl::Substitute("Failed to compress cold batch column: $0",
+                                                    compressed_or.msg());
+      return;
+    }
+    auto compressed = compressed_or.ConsumeValueOrDie();
+    // Skip columns that don't compress (e.g. random-looking data), so reads of them stay free.
+    if (static_cast<int64_t>(compressed.data.size()) >= compressed.uncompressed_bytes) {
+      continue;
+    }
+    bytes_saved += compressed.uncompressed_bytes - compressed.data.size();
+    compressed_cols[col_idx] = std::move(compressed);
   }
-  // If we get to this point then there were no cold batches to expire, so we try to expire a hot
-  // batch.
-  return ExpireHot();
+  if (bytes_saved == 0) {
+    return;
+  }
+
+  absl::base_internal::SpinLockHolder cold_lock(&cold_lock_);
+  // The batch may have been expired while compression was in flight; in that case just drop the
+  // compressed copies.
+  if (cold_store_->Size() == 0 || cold_store_->BackFirstRowID() != first_row_id) {
+    return;
+  }
+  cold_store_->AttachCompressedColumnsToBack(std::move(compressed_cols));
+  absl::base_internal::SpinLockHolder hot_lock(&hot_lock_);
+  batch_size_accountant_->ReduceLastColdBatchBytes(bytes_saved);
 }
 
 Status Table::UpdateTableMetricGauges() {
@@ -22,7 +22,9 @@
 #include <arrow/array.h>
 #include <arrow/record_batch.h>
 #include <algorithm>
+#include <chrono>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -32,6 +34,7 @@
 #include <vector>
 
 #include <absl/base/internal/spinlock.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/strings/str_format.h>
 #include "src/common/base/base.h"
 #include "src/common/metrics/metrics.h"
@@ -43,12 +46,17 @@
 #include "src/table_store/schemapb/schema.pb.h"
 #include "src/table_store/table/internal/arrow_array_compactor.h"
 #include "src/table_store/table/internal/batch_size_accountant.h"
+#include "src/table_store/table/internal/cold_batch_spiller.h"
 #include "src/table_store/table/internal/record_or_row_batch.h"
 #include "src/table_store/table/internal/store_with_row_accounting.h"
 #include "src/table_store/table/internal/types.h"
+#include "src/table_store/table/internal/zone_map.h"
 #include "src/table_store/table/table_metrics.h"
 
 DECLARE_int32(table_store_table_size_limit);
+DECLARE_bool(table_store_dictionary_encode_cold_strings);
+DECLARE_string(table_store_cold_spill_dir);
+DECLARE_bool(table_store_compress_cold_batches);
 
 namespace px {
 namespace table_store {
@@ -178,6 +186,16 @@ class Table : public NotCopyable {
     // Change the StopSpec of the cursor.
     void UpdateStopSpec(StopSpec stop);
 
+    using ZoneMapFilter = internal::ZoneMapFilter;
+    /**
+     * SetZoneMapFilter attaches an inclusive value range predicate on a single column to the
+     * cursor. Cold batches whose per-batch zone map proves they can't contain matching rows are
+     * skipped without touching their memory; GetNextRowBatch returns an empty row batch for them
+     * so cursor accounting is unchanged. This is only a pruning hint: returned batches may still
+     * contain non-matching rows, so callers must keep applying the predicate themselves.
+     */
+    void SetZoneMapFilter(const ZoneMapFilter& filter) { zone_filter_ = filter; }
+
    private:
     void AdvanceToStart(const StartSpec& start);
     void StopStateFromSpec(StopSpec&& stop);
@@ -186,6 +204,9 @@ class Table : public NotCopyable {
     internal::RowID* LastReadRowID();
     internal::BatchHints* Hints();
     std::optional<internal::RowID> StopRowID() const;
+    const internal::ZoneMapFilter* ZoneFilter() const {
+      return zone_filter_.has_value() ? &zone_filter_.value() : nullptr;
+    }
 
     struct StopState {
       StopSpec spec;
@@ -195,6 +216,7 @@ class Table : public NotCopyable {
     internal::BatchHints hints_;
     RowID last_read_row_id_;
     StopState stop_;
+    std::optional<internal::ZoneMapFilter> zone_filter_;
 
     friend class Table;
   };
@@ -267,6 +289,23 @@ class Table : public NotCopyable {
    */
   Status TransferRecordBatch(std::unique_ptr<px::types::ColumnWrapperRecordBatch> record_batch);
 
+  /**
+   * Registers a callback invoked after each new batch is written to the table. Streaming readers
+   * use this to wake up on batch arrival instead of polling on a timer. The callback is invoked
+   * from the writer's thread with an internal lock held, so it must be cheap (e.g. signal a
+   * condition variable) and must not call back into this table.
+   * @param callback the callback to invoke on batch arrival.
+   * @return an id to pass to UnregisterBatchArrivalCallback.
+   */
+  int64_t RegisterBatchArrivalCallback(std::function<void()> callback);
+
+  /**
+   * Unregisters a batch-arrival callback. Once this returns, the callback is guaranteed to no
+   * longer be running and will not be invoked again, so any state it captures can be destroyed.
+   * @param callback_id the id returned by RegisterBatchArrivalCallback.
+   */
+  void UnregisterBatchArrivalCallback(int64_t callback_id);
+
   schema::Relation GetRelation() const;
   StatusOr<std::vector<RecordBatchSPtr>> GetTableAsRecordBatches() const;
 
@@ -286,11 +325,33 @@ class Table : public NotCopyable {
    */
   Status CompactHotToCold(arrow::MemoryPool* mem_pool);
 
+  /**
+   * Same as CompactHotToCold, but stops compacting once the given deadline has passed. The table
+   * locks are released between each compacted batch, so concurrent writers are blocked for at most
+   * the duration of a single batch compaction. Compaction resumes from where it left off on the
+   * next call.
+   * @param mem_pool arrow MemoryPool to be used for creating new cold batches.
+   * @param deadline steady_clock time after which no further batches are compacted.
+   */
+  Status CompactHotToCold(arrow::MemoryPool* mem_pool,
+                          std::chrono::steady_clock::time_point deadline);
+
  private:
+  // Invokes all registered batch-arrival callbacks. Called after a new hot batch is written,
+  // outside of the data locks.
+  void NotifyBatchArrival();
+
   TableMetrics metrics_;
 
   schema::Relation rel_;
 
+  // Guards the batch-arrival callbacks. Held while invoking them, so that unregistration is a
+  // barrier: after UnregisterBatchArrivalCallback returns, the callback can't be in flight.
+  mutable absl::base_internal::SpinLock callbacks_lock_;
+  int64_t next_callback_id_ ABSL_GUARDED_BY(callbacks_lock_) = 0;
+  absl::flat_hash_map<int64_t, std::function<void()>> batch_arrival_callbacks_
+      ABSL_GUARDED_BY(callbacks_lock_);
+
   mutable absl::base_internal::SpinLock stats_lock_;
   int64_t batches_expired_ ABSL_GUARDED_BY(stats_lock_) = 0;
   int64_t batches_added_ ABSL_GUARDED_BY(stats_lock_) = 0;
@@ -314,18 +375,33 @@ class Table : public NotCopyable {
 
   Status WriteHot(internal::RecordOrRowBatch&& record_or_row_batch);
 
-  Status ExpireBatch();
-  Status ExpireHot();
-  StatusOr<bool> ExpireCold();
+  // Expires the oldest batches (cold first, then hot) until the table has room for a new batch of
+  // the given size. Eviction decisions are O(1) per batch via the BatchSizeAccountant, and the
+  // expired batches' memory is freed after the table locks are released.
   Status ExpireRowBatches(int64_t row_batch_size);
-  Status CompactSingleBatchUnlocked(arrow::MemoryPool* mem_pool)
+  // Compacts the next ready hot batch into cold and returns the RowID of the first row of the new
+  // cold batch.
+  StatusOr<RowID> CompactSingleBatchUnlocked(arrow::MemoryPool* mem_pool)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(cold_lock_) ABSL_EXCLUSIVE_LOCKS_REQUIRED(hot_lock_);
+  // Replaces the heap-backed arrays of the cold batch starting at the given RowID with
+  // memory-mapped copies on disk. Called outside the table locks; a no-op if the batch has already
+  // been expired or is no longer the most recent cold batch.
+  void SpillColdBatchToDisk(RowID first_row_id);
+  // Compresses the columns of the cold batch starting at the given RowID, attaching the compressed
+  // sidecars to the cold store and shrinking the batch's accounted size. Called outside the table
+  // locks; a no-op if the batch has already been expired or is no longer the most recent cold
+  // batch.
+  void CompressColdBatch(RowID first_row_id);
   Status UpdateTableMetricGauges();
 
   std::unique_ptr<internal::BatchSizeAccountant> batch_size_accountant_ ABSL_GUARDED_BY(hot_lock_);
 
   internal::ArrowArrayCompactor compactor_;
 
+  // When --table_store_cold_spill_dir is set, newly compacted cold batches are moved to
+  // memory-mapped files on disk via the spiller. Only accessed from the compaction caller.
+  std::unique_ptr<internal::ColdBatchSpiller> cold_batch_spiller_;
+
   friend class Cursor;
 };
 
@@ -19,6 +19,8 @@
 #include <absl/synchronization/barrier.h>
 #include <absl/synchronization/notification.h>
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <deque>
 #include <numeric>
@@ -360,6 +362,90 @@ static void BM_TableThreaded(benchmark::State& state) {
   state.counters["Write"] = benchmark::Counter(write_average_time);
 }
 
+// Runs N streaming cursor readers against a continuous TransferRecordBatch writer with the
+// compaction thread enabled, mirroring the production contention pattern of queries running
+// against the Stirling writer. Reports the writer's p99 latency and aggregate reader throughput.
+// The number of readers is the benchmark argument.
+// NOLINTNEXTLINE : runtime/references.
+static void BM_TableConcurrentReadWrite(benchmark::State& state) {
+  int num_read_threads = state.range(0);
+  int64_t batch_size = 1024;
+  int64_t num_batches = 16 * 1024;
+  auto table = MakeTable(64 * 1024 * 1024, 64 * 1024);
+
+  auto done = std::make_shared<absl::Notification>();
+  auto result_lock = std::make_shared<absl::base_internal::SpinLock>();
+  auto write_results = std::make_shared<std::deque<double>>();
+  auto rows_read = std::make_shared<std::atomic<int64_t>>(0);
+  auto barrier = std::make_shared<absl::Barrier>(num_read_threads + 1);
+
+  std::thread compaction_thread([&]() {
+    while (!done->WaitForNotificationWithTimeout(absl::Milliseconds(50))) {
+      PL_CHECK_OK(table->CompactHotToCold(arrow::default_memory_pool()));
+    }
+    PL_CHECK_OK(table->CompactHotToCold(arrow::default_memory_pool()));
+  });
+
+  std::thread writer_thread([&]() {
+    barrier->Block();
+    int64_t time_counter = 0;
+    for (int64_t i = 0; i < num_batches; ++i) {
+      auto batch = MakeHotBatch(batch_size, &time_counter);
+      auto start = std::chrono::high_resolution_clock::now();
+      PL_CHECK_OK(table->TransferRecordBatch(std::move(batch)));
+      auto end = std::chrono::high_resolution_clock::now();
+      auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+      {
+        absl::base_internal::SpinLockHolder lock(result_lock.get());
+        write_results->push_back(elapsed_seconds.count());
+      }
+    }
+    done->Notify();
+  });
+
+  auto reader_work = [&]() {
+    barrier->Block();
+    // Streaming cursor: never exhausts, so the reader continuously chases the writer.
+    Table::Cursor cursor(table.get(), Table::Cursor::StartSpec{},
+                         Table::Cursor::StopSpec{Table::Cursor::StopSpec::StopType::Infinite});
+    while (true) {
+      bool writer_done = done->HasBeenNotified();
+      while (cursor.NextBatchReady()) {
+        auto batch_or_s = cursor.GetNextRowBatch({0, 1});
+        if (batch_or_s.ok()) {
+          rows_read->fetch_add(batch_or_s.ValueOrDie()->num_rows());
+        }
+      }
+      if (writer_done) {
+        break;
+      }
+    }
+  };
+
+  std::vector<std::thread> reader_threads;
+  for (int i = 0; i < num_read_threads; ++i) {
+    reader_threads.emplace_back(reader_work);
+  }
+
+  auto bench_start = std::chrono::high_resolution_clock::now();
+  for (auto _ : state) {
+  }
+  writer_thread.join();
+  compaction_thread.join();
+  for (auto& t : reader_threads) {
+    t.join();
+  }
+  auto bench_end = std::chrono::high_resolution_clock::now();
+  auto total_seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(bench_end - bench_start).count();
+
+  std::sort(write_results->begin(), write_results->end());
+  auto write_p99 = (*write_results)[static_cast<size_t>(0.99 * (write_results->size() - 1))];
+  state.counters["WriteP99"] = benchmark::Counter(write_p99);
+  state.counters["ReadRowsPerSecond"] = benchmark::Counter(rows_read->load() / total_seconds);
+  state.SetBytesProcessed(num_batches * batch_size * (sizeof(int64_t) + sizeof(double)));
+}
+
 BENCHMARK(BM_TableReadAllHot);
 BENCHMARK(BM_TableReadAllCold);
 BENCHMARK(BM_TableReadLastBatchAllHot)->Iterations(1000);
@@ -368,5 +454,11 @@ BENCHMARK(BM_TableWriteEmpty);
 BENCHMARK(BM_TableWriteFull);
 BENCHMARK(BM_TableCompaction);
 BENCHMARK(BM_TableThreaded)->UseManualTime()->Iterations(1);
+BENCHMARK(BM_TableConcurrentReadWrite)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseManualTime()
+    ->Iterations(1);
 
 }  // namespace px::table_store
@@ -17,11 +17,18 @@
  */
 
 #include <algorithm>
+#include <chrono>
 #include <utility>
 #include <vector>
 
 #include "src/table_store/table/table_store.h"
 
+DEFINE_int32(table_store_compaction_time_budget_ms,
+             gflags::Int32FromEnv("PL_TABLE_STORE_COMPACTION_TIME_BUDGET_MS", 50),
+             "The maximum wall-clock time a single table store compaction pass may spend, in "
+             "milliseconds. Compaction resumes from where it left off on the next pass. Set to 0 "
+             "to disable the budget.");
+
 namespace px {
 namespace table_store {
 
@@ -159,8 +166,32 @@ std::vector<uint64_t> TableStore::GetTableIDs() const {
 }
 
 Status TableStore::RunCompaction(arrow::MemoryPool* mem_pool) {
+  auto deadline = std::chrono::steady_clock::time_point::max();
+  if (FLAGS_table_store_compaction_time_budget_ms > 0) {
+    deadline = std::chrono::steady_clock::now() +
+               std::chrono::milliseconds(FLAGS_table_store_compaction_time_budget_ms);
+  }
+
+  std::vector<Table*> tables;
+  tables.reserve(name_to_table_map_.size());
   for (const auto& it : name_to_table_map_) {
-    PL_RETURN_IF_ERROR(it.second->CompactHotToCold(mem_pool));
+    tables.push_back(it.second.get());
+  }
+  if (tables.empty()) {
+    return Status::OK();
+  }
+
+  // Visit tables round-robin starting from where the last pass stopped, so that when the time
+  // budget runs out mid-pass, the tables at the end of the list still make progress on later
+  // passes.
+  compaction_rr_offset_ %= tables.size();
+  for (size_t i = 0; i < tables.size(); ++i) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      break;
+    }
+    size_t idx = (compaction_rr_offset_ + i) % tables.size();
+    PL_RETURN_IF_ERROR(tables[idx]->CompactHotToCold(mem_pool, deadline));
+    compaction_rr_offset_ = (idx + 1) % tables.size();
   }
   return Status::OK();
 }
@@ -34,6 +34,8 @@
 #include "src/table_store/table/table.h"
 #include "src/table_store/table/tablets_group.h"
 
+DECLARE_int32(table_store_compaction_time_budget_ms);
+
 namespace px {
 namespace table_store {
 
@@ -165,6 +167,12 @@ class TableStore {
     return "";
   }
 
+  /**
+   * RunCompaction compacts hot batches to cold across all tables in the store. Each call is
+   * bounded by FLAGS_table_store_compaction_time_budget_ms; tables are visited round-robin across
+   * calls so that a single large table cannot starve the others, and compaction resumes from where
+   * it left off on the next invocation.
+   */
   Status RunCompaction(arrow::MemoryPool* mem_pool);
 
  private:
@@ -197,6 +205,9 @@ class TableStore {
   absl::flat_hash_map<std::string, schema::Relation> name_to_relation_map_;
   // Mapping from id to name and relation pair for adding new tablets.
   absl::flat_hash_map<uint64_t, TableInfo> id_to_table_info_map_;
+  // Index of the table to start the next RunCompaction pass from, for round-robin fairness when a
+  // pass runs out of time budget.
+  size_t compaction_rr_offset_ = 0;
 };
 
 }  // namespace table_store
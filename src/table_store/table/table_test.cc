@@ -92,6 +92,37 @@ TEST(TableTest, basic_test) {
       actual_rb2->ColumnAt(1)->Equals(types::ToArrow(col2_in2, arrow::default_memory_pool())));
 }
 
+TEST(TableTest, batch_arrival_callbacks) {
+  schema::Relation rel({types::DataType::BOOLEAN, types::DataType::INT64}, {"col1", "col2"});
+
+  std::shared_ptr<Table> table_ptr = Table::Create("test_table", rel);
+  Table& table = *table_ptr;
+
+  int64_t num_notifications = 0;
+  auto callback_id = table.RegisterBatchArrivalCallback([&] { num_notifications++; });
+
+  auto rb1 = schema::RowBatch(schema::RowDescriptor(rel.col_types()), 3);
+  std::vector<types::BoolValue> col1_in1 = {true, false, true};
+  std::vector<types::Int64Value> col2_in1 = {1, 2, 3};
+  EXPECT_OK(rb1.AddColumn(types::ToArrow(col1_in1, arrow::default_memory_pool())));
+  EXPECT_OK(rb1.AddColumn(types::ToArrow(col2_in1, arrow::default_memory_pool())));
+  EXPECT_OK(table.WriteRowBatch(rb1));
+  EXPECT_EQ(1, num_notifications);
+
+  auto rb2 = schema::RowBatch(schema::RowDescriptor(rel.col_types()), 2);
+  std::vector<types::BoolValue> col1_in2 = {false, false};
+  std::vector<types::Int64Value> col2_in2 = {5, 6};
+  EXPECT_OK(rb2.AddColumn(types::ToArrow(col1_in2, arrow::default_memory_pool())));
+  EXPECT_OK(rb2.AddColumn(types::ToArrow(col2_in2, arrow::default_memory_pool())));
+  EXPECT_OK(table.WriteRowBatch(rb2));
+  EXPECT_EQ(2, num_notifications);
+
+  // No further notifications after unregistering.
+  table.UnregisterBatchArrivalCallback(callback_id);
+  EXPECT_OK(table.WriteRowBatch(rb1));
+  EXPECT_EQ(2, num_notifications);
+}
+
 TEST(TableTest, bytes_test) {
   auto rd = schema::RowDescriptor({types::DataType::INT64, types::DataType::STRING});
   schema::Relation rel(rd.types(), {"col1", "col2"});
@@ -766,6 +797,98 @@ class NotifyOnDeath {
   absl::Notification* notification_;
 };
 
+TEST(TableTest, compaction_deadline) {
+  schema::Relation rel({types::DataType::TIME64NS}, {"time_"});
+  schema::RowDescriptor rd({types::DataType::TIME64NS});
+  // Use a small compacted batch size so the writes below are enough to trigger compaction.
+  Table table("test_table", rel, 128 * 1024, 64);
+
+  std::vector<types::Time64NSValue> times = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  schema::RowBatch rb(rd, times.size());
+  EXPECT_OK(rb.AddColumn(types::ToArrow(times, arrow::default_memory_pool())));
+  EXPECT_OK(table.WriteRowBatch(rb));
+  EXPECT_OK(table.WriteRowBatch(rb));
+
+  // A deadline in the past should prevent any batches from being compacted.
+  EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool(),
+                                   std::chrono::steady_clock::now() - std::chrono::seconds(1)));
+  EXPECT_EQ(table.GetTableStats().cold_bytes, 0);
+
+  // An unbounded deadline should compact as usual.
+  EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool(),
+                                   std::chrono::steady_clock::time_point::max()));
+  EXPECT_GT(table.GetTableStats().cold_bytes, 0);
+}
+
+TEST(TableTest, zone_map_filter_skips_cold_batches) {
+  schema::Relation rel({types::DataType::TIME64NS}, {"time_"});
+  schema::RowDescriptor rd({types::DataType::TIME64NS});
+  // Use a small compacted batch size so each written batch compacts into its own cold batch.
+  Table table("test_table", rel, 128 * 1024, 64);
+
+  std::vector<std::vector<types::Time64NSValue>> batches = {
+      {1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+      {101, 102, 103, 104, 105, 106, 107, 108, 109, 110},
+      {201, 202, 203, 204, 205, 206, 207, 208, 209, 210},
+  };
+  for (const auto& times : batches) {
+    schema::RowBatch rb(rd, times.size());
+    EXPECT_OK(rb.AddColumn(types::ToArrow(times, arrow::default_memory_pool())));
+    EXPECT_OK(table.WriteRowBatch(rb));
+    EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool()));
+  }
+
+  Table::Cursor cursor(&table);
+  cursor.SetZoneMapFilter(Table::Cursor::ZoneMapFilter{/* col_idx */ 0, 101, 110});
+
+  // The first and last batches fall outside the filter range, so they come back empty.
+  std::vector<int64_t> num_rows;
+  while (!cursor.Done()) {
+    ASSERT_OK_AND_ASSIGN(auto rb, cursor.GetNextRowBatch({0}));
+    num_rows.push_back(rb->num_rows());
+  }
+  EXPECT_EQ((std::vector<int64_t>{0, 10, 0}), num_rows);
+}
+
+TEST(TableTest, compressed_cold_batch_round_trip) {
+  bool old_flag = FLAGS_table_store_compress_cold_batches;
+  FLAGS_table_store_compress_cold_batches = true;
+
+  schema::Relation rel({types::DataType::TIME64NS, types::DataType::INT64}, {"time_", "col1"});
+  schema::RowDescriptor rd({types::DataType::TIME64NS, types::DataType::INT64});
+  Table table("test_table", rel, 128 * 1024, 64);
+
+  std::vector<types::Time64NSValue> times;
+  std::vector<types::Int64Value> vals;
+  for (int i = 0; i < 1024; ++i) {
+    times.emplace_back(i);
+    // Repetitive values, so the column compresses well.
+    vals.emplace_back(i % 3);
+  }
+  schema::RowBatch rb(rd, times.size());
+  EXPECT_OK(rb.AddColumn(types::ToArrow(times, arrow::default_memory_pool())));
+  EXPECT_OK(rb.AddColumn(types::ToArrow(vals, arrow::default_memory_pool())));
+  EXPECT_OK(table.WriteRowBatch(rb));
+
+  auto hot_bytes_before = table.GetTableStats().hot_bytes;
+  EXPECT_OK(table.CompactHotToCold(arrow::default_memory_pool()));
+  // The compacted batch's accounted size should shrink once its columns are compressed.
+  EXPECT_LT(table.GetTableStats().cold_bytes, hot_bytes_before);
+
+  // Reads decompress transparently and return the original data.
+  Table::Cursor cursor(&table);
+  int64_t row_offset = 0;
+  while (!cursor.Done()) {
+    ASSERT_OK_AND_ASSIGN(auto out_rb, cursor.GetNextRowBatch({0, 1}));
+    EXPECT_TRUE(rb.ColumnAt(0)->Slice(row_offset, out_rb->num_rows())->Equals(out_rb->ColumnAt(0)));
+    EXPECT_TRUE(rb.ColumnAt(1)->Slice(row_offset, out_rb->num_rows())->Equals(out_rb->ColumnAt(1)));
+    row_offset += out_rb->num_rows();
+  }
+  EXPECT_EQ(1024, row_offset);
+
+  FLAGS_table_store_compress_cold_batches = old_flag;
+}
+
 TEST(TableTest, threaded) {
   schema::Relation rel({types::DataType::TIME64NS}, {"time_"});
   schema::RowDescriptor rd({types::DataType::TIME64NS});
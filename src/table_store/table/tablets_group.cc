@@ -16,11 +16,48 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "src/table_store/table/tablets_group.h"
 
 namespace px {
 namespace table_store {
 
+namespace {
+
+// Runs fn(i) for each tablet index in [0, num_tablets), spreading the indices across up to
+// hardware_concurrency threads. Each index is processed by exactly one thread.
+template <typename TFn>
+void ParallelForEachTablet(size_t num_tablets, const TFn& fn) {
+  size_t num_threads = std::min<size_t>(
+      num_tablets, std::max<size_t>(1, std::thread::hardware_concurrency()));
+  if (num_threads <= 1) {
+    for (size_t i = 0; i < num_tablets; ++i) {
+      fn(i);
+    }
+    return;
+  }
+  std::atomic<size_t> next_idx(0);
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads);
+  for (size_t t = 0; t < num_threads; ++t) {
+    workers.emplace_back([&]() {
+      for (size_t i = next_idx.fetch_add(1); i < num_tablets; i = next_idx.fetch_add(1)) {
+        fn(i);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+}  // namespace
+
 void TabletsGroup::CreateTablet(const types::TabletID& tablet_id) {
   LOG_IF(DFATAL, HasTablet(tablet_id))
       << absl::Substitute("Tablet with id $0 already exists in Table.", tablet_id);
@@ -46,5 +83,54 @@ bool TabletsGroup::HasTablet(const types::TabletID& tablet_id) const {
   return tablet_id_to_tablet_map_.find(tablet_id) != tablet_id_to_tablet_map_.end();
 }
 
+Status TabletsGroup::ParallelTransferRecordBatches(std::vector<TabletRecordBatch>&& batches) {
+  // Shard the incoming batches by tablet, preserving the input order within each tablet. Tablet
+  // creation mutates the map, so it happens up front on the calling thread.
+  std::unordered_map<types::TabletID, std::vector<size_t>> tablet_batch_indices;
+  for (const auto& [i, tablet_batch] : Enumerate(batches)) {
+    if (!HasTablet(tablet_batch.first)) {
+      CreateTablet(tablet_batch.first);
+    }
+    tablet_batch_indices[tablet_batch.first].push_back(i);
+  }
+
+  std::vector<std::pair<Table*, std::vector<size_t>*>> work;
+  work.reserve(tablet_batch_indices.size());
+  for (auto& [tablet_id, indices] : tablet_batch_indices) {
+    work.emplace_back(GetTablet(tablet_id), &indices);
+  }
+
+  std::vector<Status> statuses(work.size());
+  ParallelForEachTablet(work.size(), [&](size_t i) {
+    auto [tablet, indices] = work[i];
+    for (size_t batch_idx : *indices) {
+      auto s = tablet->TransferRecordBatch(std::move(batches[batch_idx].second));
+      if (!s.ok()) {
+        statuses[i] = s;
+        return;
+      }
+    }
+  });
+  for (const auto& s : statuses) {
+    PL_RETURN_IF_ERROR(s);
+  }
+  return Status::OK();
+}
+
+Status TabletsGroup::ParallelCompactTablets(arrow::MemoryPool* mem_pool) {
+  std::vector<Table*> tablets;
+  tablets.reserve(tablet_id_to_tablet_map_.size());
+  for (const auto& [tablet_id, tablet] : tablet_id_to_tablet_map_) {
+    tablets.push_back(tablet.get());
+  }
+  std::vector<Status> statuses(tablets.size());
+  ParallelForEachTablet(tablets.size(),
+                        [&](size_t i) { statuses[i] = tablets[i]->CompactHotToCold(mem_pool); });
+  for (const auto& s : statuses) {
+    PL_RETURN_IF_ERROR(s);
+  }
+  return Status::OK();
+}
+
 }  // namespace table_store
 }  // namespace px
@@ -21,6 +21,8 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "src/common/base/base.h"
 #include "src/shared/types/column_wrapper.h"
@@ -81,6 +83,28 @@ class TabletsGroup {
    */
   const schema::Relation& GetRelation() const { return relation_; }
 
+  using TabletRecordBatch =
+      std::pair<types::TabletID, std::unique_ptr<types::ColumnWrapperRecordBatch>>;
+
+  /**
+   * @brief Transfers the given record batches into their tablets, fanning independent tablets out
+   * across threads. Batches for the same tablet are written sequentially in their given order, so
+   * per-tablet time ordering is preserved; different tablets are written in parallel. Tablets that
+   * don't exist yet are created.
+   *
+   * @param batches: (tablet_id, record batch) pairs to write. Consumed by this call.
+   * @return Status: first error encountered on any tablet, if any.
+   */
+  Status ParallelTransferRecordBatches(std::vector<TabletRecordBatch>&& batches);
+
+  /**
+   * @brief Runs hot-to-cold compaction on all tablets in this group in parallel.
+   *
+   * @param mem_pool: arrow MemoryPool used for the compacted cold batches.
+   * @return Status: first error encountered on any tablet, if any.
+   */
+  Status ParallelCompactTablets(arrow::MemoryPool* mem_pool);
+
  private:
   schema::Relation relation_;
   std::unordered_map<types::TabletID, std::shared_ptr<Table>> tablet_id_to_tablet_map_;
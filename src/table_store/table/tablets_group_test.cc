@@ -50,6 +50,38 @@ class TabletsGroupTest : public ::testing::Test {
   schema::Relation rel2;
 };
 
+TEST_F(TabletsGroupTest, ParallelTransferRecordBatches) {
+  auto table = TabletsGroup(rel1);
+
+  std::vector<TabletsGroup::TabletRecordBatch> batches;
+  constexpr int kNumTablets = 8;
+  constexpr int kBatchesPerTablet = 4;
+  for (int b = 0; b < kBatchesPerTablet; ++b) {
+    for (int t = 0; t < kNumTablets; ++t) {
+      auto record_batch = std::make_unique<ColumnWrapperRecordBatch>();
+      auto col1 = std::make_shared<types::BoolValueColumnWrapper>(0);
+      auto col2 = std::make_shared<types::Float64ValueColumnWrapper>(0);
+      for (int i = 0; i < 3; ++i) {
+        col1->Append(types::BoolValue(i % 2 == 0));
+        col2->Append(types::Float64Value(i + b));
+      }
+      record_batch->push_back(col1);
+      record_batch->push_back(col2);
+      batches.emplace_back(std::to_string(t), std::move(record_batch));
+    }
+  }
+
+  EXPECT_OK(table.ParallelTransferRecordBatches(std::move(batches)));
+
+  for (int t = 0; t < kNumTablets; ++t) {
+    auto* tablet = table.GetTablet(std::to_string(t));
+    ASSERT_NE(tablet, nullptr);
+    EXPECT_EQ(tablet->GetTableStats().batches_added, kBatchesPerTablet);
+  }
+
+  EXPECT_OK(table.ParallelCompactTablets(arrow::default_memory_pool()));
+}
+
 TEST_F(TabletsGroupTest, TabletIdNotFoundMissing) {
   types::TabletID tablet_id1 = "123";
   types::TabletID tablet_id2 = "456";
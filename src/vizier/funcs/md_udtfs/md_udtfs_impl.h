@@ -22,6 +22,7 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -136,22 +137,29 @@ class GetTables final : public carnot::udf::UDTF<GetTables> {
   }
 
   Status Init(FunctionContext*) {
-    px::vizier::services::metadata::SchemaRequest req;
-    px::vizier::services::metadata::SchemaResponse resp;
-
-    grpc::ClientContext ctx;
-    add_context_authentication_func_(&ctx);
-    auto s = stub_->GetSchemas(&ctx, req, &resp);
-    if (!s.ok()) {
-      return error::Internal("Failed to make RPC call to metadata service");
-    }
+    // Start the RPC without blocking; WaitForInit() joins it right before records are generated,
+    // so the call overlaps the rest of query setup.
+    rpc_result_ = std::async(std::launch::async, [this]() -> Status {
+      px::vizier::services::metadata::SchemaRequest req;
+      px::vizier::services::metadata::SchemaResponse resp;
+
+      grpc::ClientContext ctx;
+      add_context_authentication_func_(&ctx);
+      auto s = stub_->GetSchemas(&ctx, req, &resp);
+      if (!s.ok()) {
+        return error::Internal("Failed to make RPC call to metadata service");
+      }
 
-    for (const auto& [table_name, rel] : resp.schema().relation_map()) {
-      table_info_.emplace_back(table_name, rel.desc());
-    }
+      for (const auto& [table_name, rel] : resp.schema().relation_map()) {
+        table_info_.emplace_back(table_name, rel.desc());
+      }
+      return Status::OK();
+    });
     return Status::OK();
   }
 
+  Status WaitForInit() { return rpc_result_.get(); }
+
   bool NextRecord(FunctionContext*, RecordWriter* rw) {
     if (!table_info_.size()) {
       return false;
@@ -174,6 +182,7 @@ class GetTables final : public carnot::udf::UDTF<GetTables> {
 
   int idx_ = 0;
   std::vector<TableInfo> table_info_;
+  std::future<Status> rpc_result_;
   std::shared_ptr<MDSStub> stub_;
   std::function<void(grpc::ClientContext*)> add_context_authentication_func_;
 };
@@ -206,29 +215,34 @@ class GetTableSchemas final : public carnot::udf::UDTF<GetTableSchemas> {
   }
 
   Status Init(FunctionContext*) {
-    px::vizier::services::metadata::SchemaRequest req;
-    px::vizier::services::metadata::SchemaResponse resp;
-
-    grpc::ClientContext ctx;
-    add_context_authentication_func_(&ctx);
-    auto s = stub_->GetSchemas(&ctx, req, &resp);
-    if (!s.ok()) {
-      return error::Internal("Failed to make RPC call to metadata service");
-    }
+    rpc_result_ = std::async(std::launch::async, [this]() -> Status {
+      px::vizier::services::metadata::SchemaRequest req;
+      px::vizier::services::metadata::SchemaResponse resp;
+
+      grpc::ClientContext ctx;
+      add_context_authentication_func_(&ctx);
+      auto s = stub_->GetSchemas(&ctx, req, &resp);
+      if (!s.ok()) {
+        return error::Internal("Failed to make RPC call to metadata service");
+      }
 
-    // TODO(zasgar): We store the data since it's hard to traverse two maps at once. We should
-    // either do that or perhaps have an interface that allows UDTFs to write multiple records in
-    // a single invocation.
-    for (const auto& [table_name, rel] : resp.schema().relation_map()) {
-      for (const auto& col : rel.columns()) {
-        relation_info_.emplace_back(
-            table_name, col.column_name(), std::string(magic_enum::enum_name(col.column_type())),
-            std::string(types::ToString(col.pattern_type())), col.column_desc());
+      // TODO(zasgar): We store the data since it's hard to traverse two maps at once. We should
+      // either do that or perhaps have an interface that allows UDTFs to write multiple records in
+      // a single invocation.
+      for (const auto& [table_name, rel] : resp.schema().relation_map()) {
+        for (const auto& col : rel.columns()) {
+          relation_info_.emplace_back(
+              table_name, col.column_name(), std::string(magic_enum::enum_name(col.column_type())),
+              std::string(types::ToString(col.pattern_type())), col.column_desc());
+        }
       }
-    }
+      return Status::OK();
+    });
     return Status::OK();
   }
 
+  Status WaitForInit() { return rpc_result_.get(); }
+
   bool NextRecord(FunctionContext*, RecordWriter* rw) {
     if (!relation_info_.size()) {
       return false;
@@ -263,6 +277,7 @@ class GetTableSchemas final : public carnot::udf::UDTF<GetTableSchemas> {
 
   int idx_ = 0;
   std::vector<RelationInfo> relation_info_;
+  std::future<Status> rpc_result_;
   std::shared_ptr<MDSStub> stub_;
   std::function<void(grpc::ClientContext*)> add_context_authentication_func_;
 };
@@ -299,19 +314,28 @@ class GetAgentStatus final : public carnot::udf::UDTF<GetAgentStatus> {
   }
 
   Status Init(FunctionContext*) {
-    px::vizier::services::metadata::AgentInfoRequest req;
     resp_ = std::make_unique<px::vizier::services::metadata::AgentInfoResponse>();
 
-    grpc::ClientContext ctx;
-    add_context_authentication_func_(&ctx);
-    auto s = stub_->GetAgentInfo(&ctx, req, resp_.get());
-    if (!s.ok()) {
-      return error::Internal("Failed to make RPC call to GetAgentInfo");
-    }
+    rpc_result_ = std::async(std::launch::async, [this]() -> Status {
+      px::vizier::services::metadata::AgentInfoRequest req;
+
+      grpc::ClientContext ctx;
+      add_context_authentication_func_(&ctx);
+      auto s = stub_->GetAgentInfo(&ctx, req, resp_.get());
+      if (!s.ok()) {
+        return error::Internal("Failed to make RPC call to GetAgentInfo");
+      }
+      return Status::OK();
+    });
     return Status::OK();
   }
 
+  Status WaitForInit() { return rpc_result_.get(); }
+
   bool NextRecord(FunctionContext*, RecordWriter* rw) {
+    if (resp_->info_size() == 0) {
+      return false;
+    }
     const auto& agent_metadata = resp_->info(idx_);
     const auto& agent_info = agent_metadata.agent();
     const auto& agent_status = agent_metadata.status();
@@ -338,6 +362,7 @@ class GetAgentStatus final : public carnot::udf::UDTF<GetAgentStatus> {
  private:
   int idx_ = 0;
   std::unique_ptr<px::vizier::services::metadata::AgentInfoResponse> resp_;
+  std::future<Status> rpc_result_;
   std::shared_ptr<MDSStub> stub_;
   std::function<void(grpc::ClientContext*)> add_context_authentication_func_;
 };
@@ -616,22 +641,27 @@ class GetDebugMDWithPrefix final : public carnot::udf::UDTF<GetDebugMDWithPrefix
   }
 
   Status Init(FunctionContext*, types::StringValue prefix, types::StringValue proto) {
-    px::vizier::services::metadata::WithPrefixKeyRequest req;
     resp_ = std::make_unique<px::vizier::services::metadata::WithPrefixKeyResponse>();
     idx_ = 0;
 
-    req.set_prefix(prefix);
-    req.set_proto(proto);
+    rpc_result_ = std::async(std::launch::async, [this, prefix, proto]() -> Status {
+      px::vizier::services::metadata::WithPrefixKeyRequest req;
+      req.set_prefix(prefix);
+      req.set_proto(proto);
 
-    grpc::ClientContext ctx;
-    add_context_authentication_func_(&ctx);
-    auto s = stub_->GetWithPrefixKey(&ctx, req, resp_.get());
-    if (!s.ok()) {
-      return error::Internal(s.error_message());
-    }
+      grpc::ClientContext ctx;
+      add_context_authentication_func_(&ctx);
+      auto s = stub_->GetWithPrefixKey(&ctx, req, resp_.get());
+      if (!s.ok()) {
+        return error::Internal(s.error_message());
+      }
+      return Status::OK();
+    });
     return Status::OK();
   }
 
+  Status WaitForInit() { return rpc_result_.get(); }
+
   bool NextRecord(FunctionContext*, RecordWriter* rw) {
     if (idx_ >= resp_->kvs().size()) {
       return false;
@@ -647,6 +677,7 @@ class GetDebugMDWithPrefix final : public carnot::udf::UDTF<GetDebugMDWithPrefix
  private:
   std::unique_ptr<px::vizier::services::metadata::WithPrefixKeyResponse> resp_;
   int idx_;
+  std::future<Status> rpc_result_;
 
   std::shared_ptr<MDSStub> stub_;
   std::function<void(grpc::ClientContext*)> add_context_authentication_func_;
@@ -756,19 +787,25 @@ class GetTracepointStatus final : public carnot::udf::UDTF<GetTracepointStatus>
   }
 
   Status Init(FunctionContext*) {
-    px::vizier::services::metadata::GetTracepointInfoRequest req;
     resp_ = std::make_unique<px::vizier::services::metadata::GetTracepointInfoResponse>();
 
-    grpc::ClientContext ctx;
-    add_context_authentication_func_(&ctx);
-    auto s = stub_->GetTracepointInfo(&ctx, req, resp_.get());
-    if (!s.ok()) {
-      return error::Internal("Failed to make RPC call to GetTracepointStatus: $0",
-                             s.error_message());
-    }
+    rpc_result_ = std::async(std::launch::async, [this]() -> Status {
+      px::vizier::services::metadata::GetTracepointInfoRequest req;
+
+      grpc::ClientContext ctx;
+      add_context_authentication_func_(&ctx);
+      auto s = stub_->GetTracepointInfo(&ctx, req, resp_.get());
+      if (!s.ok()) {
+        return error::Internal("Failed to make RPC call to GetTracepointStatus: $0",
+                               s.error_message());
+      }
+      return Status::OK();
+    });
     return Status::OK();
   }
 
+  Status WaitForInit() { return rpc_result_.get(); }
+
   bool NextRecord(FunctionContext*, RecordWriter* rw) {
     if (resp_->tracepoints_size() == 0) {
       return false;
@@ -843,6 +880,7 @@ class GetTracepointStatus final : public carnot::udf::UDTF<GetTracepointStatus>
  private:
   int idx_ = 0;
   std::unique_ptr<px::vizier::services::metadata::GetTracepointInfoResponse> resp_;
+  std::future<Status> rpc_result_;
   std::shared_ptr<MDTPStub> stub_;
   std::function<void(grpc::ClientContext*)> add_context_authentication_func_;
 };
@@ -878,19 +916,25 @@ class GetCronScriptHistory final : public carnot::udf::UDTF<GetCronScriptHistory
   }
 
   Status Init(FunctionContext*) {
-    px::vizier::services::metadata::GetAllExecutionResultsRequest req;
     resp_ = std::make_unique<px::vizier::services::metadata::GetAllExecutionResultsResponse>();
 
-    grpc::ClientContext ctx;
-    add_context_authentication_func_(&ctx);
-    auto s = stub_->GetAllExecutionResults(&ctx, req, resp_.get());
-    if (!s.ok()) {
-      return error::Internal("Failed to make RPC call to GetTracepointStatus: $0",
-                             s.error_message());
-    }
+    rpc_result_ = std::async(std::launch::async, [this]() -> Status {
+      px::vizier::services::metadata::GetAllExecutionResultsRequest req;
+
+      grpc::ClientContext ctx;
+      add_context_authentication_func_(&ctx);
+      auto s = stub_->GetAllExecutionResults(&ctx, req, resp_.get());
+      if (!s.ok()) {
+        return error::Internal("Failed to make RPC call to GetTracepointStatus: $0",
+                               s.error_message());
+      }
+      return Status::OK();
+    });
     return Status::OK();
   }
 
+  Status WaitForInit() { return rpc_result_.get(); }
+
   bool NextRecord(FunctionContext*, RecordWriter* rw) {
     if (resp_->results_size() == 0) {
       return false;
@@ -932,6 +976,7 @@ class GetCronScriptHistory final : public carnot::udf::UDTF<GetCronScriptHistory
  private:
   int idx_ = 0;
   std::unique_ptr<px::vizier::services::metadata::GetAllExecutionResultsResponse> resp_;
+  std::future<Status> rpc_result_;
   std::shared_ptr<CronScriptStoreStub> stub_;
   std::function<void(grpc::ClientContext*)> add_context_authentication_func_;
 };
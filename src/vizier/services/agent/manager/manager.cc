@@ -203,6 +203,9 @@ Status Manager::Stop(std::chrono::milliseconds timeout) {
   }
   stop_called_ = true;
 
+  // The table_store usage callback captures `this`; drop it before teardown.
+  px::metrics::MemoryAttributionRegistry::GetInstance().DeregisterSource("table_store");
+
   dispatcher_->Stop();
   auto s = StopImpl(timeout);
 
@@ -347,6 +350,18 @@ Status Manager::PostRegisterHook(uint32_t asid) {
   });
   tablestore_compaction_timer_->EnableTimer(kTableStoreCompactionPeriod);
 
+  // Attribute table store usage in the memory metrics, so memory growth on a PEM can be named.
+  px::metrics::MemoryAttributionRegistry::GetInstance().RegisterSource("table_store", [this]() {
+    int64_t bytes = 0;
+    for (uint64_t id : table_store()->GetTableIDs()) {
+      auto* table = table_store()->GetTable(id);
+      if (table != nullptr) {
+        bytes += table->GetTableStats().bytes;
+      }
+    }
+    return bytes;
+  });
+
   memory_metrics_timer_ = dispatcher()->CreateTimer([this]() {
     memory_metrics_.MeasureMemory();
     if (memory_metrics_timer_) {